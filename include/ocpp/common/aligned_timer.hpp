@@ -3,12 +3,23 @@
 
 #pragma once
 
+#include <memory>
+
 #include <everest/logging.hpp>
 #include <everest/timer.hpp>
 #include <ocpp/common/types.hpp>
 
 namespace ocpp {
 
+/// \brief Creates a steady timer that runs its callbacks on \p io_context, or on a thread of its own if \p io_context
+/// is nullptr
+inline std::unique_ptr<Everest::SteadyTimer> make_steady_timer(boost::asio::io_context* io_context) {
+    if (io_context != nullptr) {
+        return std::make_unique<Everest::SteadyTimer>(io_context);
+    }
+    return std::make_unique<Everest::SteadyTimer>();
+}
+
 class ClockAlignedTimer : private Everest::Timer<std::chrono::system_clock> {
 public:
     using system_time_point = std::chrono::time_point<std::chrono::system_clock>;
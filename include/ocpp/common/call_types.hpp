@@ -14,6 +14,7 @@
 #include <string>
 
 #include <ocpp/common/cistring.hpp>
+#include <ocpp/common/json_writer.hpp>
 
 using json = nlohmann::json;
 
@@ -76,6 +77,16 @@ template <class T> struct Call {
         j.push_back(json(c.msg));
     }
 
+    /// \brief Writes the given Call \p c to \p writer, the output is the same as json(c).dump()
+    friend void write_json(JsonWriter& writer, const Call& c) {
+        writer.begin_array();
+        writer.value(static_cast<std::int32_t>(MessageTypeId::CALL));
+        writer.value(c.uniqueId.view());
+        writer.value(c.msg.get_type());
+        write_json(writer, c.msg);
+        writer.end_array();
+    }
+
     /// \brief Conversion from a given json object \p j to a given Call message \p c
     friend void from_json(const json& j, Call& c) {
         // the required parts of the message
@@ -114,6 +125,15 @@ template <class T> struct CallResult {
         j.push_back(json(c.msg));
     }
 
+    /// \brief Writes the given CallResult \p c to \p writer, the output is the same as json(c).dump()
+    friend void write_json(JsonWriter& writer, const CallResult& c) {
+        writer.begin_array();
+        writer.value(static_cast<std::int32_t>(MessageTypeId::CALLRESULT));
+        writer.value(c.uniqueId.view());
+        write_json(writer, c.msg);
+        writer.end_array();
+    }
+
     /// \brief Conversion from a given json object \p j to a given CallResult message \p c
     friend void from_json(const json& j, CallResult& c) {
         // the required parts of the message
@@ -151,6 +171,9 @@ void to_json(json& j, const CallError& c);
 /// \brief Conversion from a given json object \p j to a given CallError message \p c
 void from_json(const json& j, CallError& c);
 
+/// \brief Writes the given CallError \p c to \p writer, the output is the same as json(c).dump()
+void write_json(JsonWriter& writer, const CallError& c);
+
 /// \brief Writes the given case CallError \p c to the given output stream \p os
 /// \returns an output stream with the CallError written to
 std::ostream& operator<<(std::ostream& os, const CallError& c);
@@ -3,8 +3,12 @@
 #ifndef OCPP_COMMON_CHARGE_POINT_HPP
 #define OCPP_COMMON_CHARGE_POINT_HPP
 
+#include <functional>
+#include <future>
+
 #include <boost/shared_ptr.hpp>
 
+#include <ocpp/common/charging_station_host.hpp>
 #include <ocpp/common/evse_security.hpp>
 #include <ocpp/common/evse_security_impl.hpp>
 #include <ocpp/common/message_queue.hpp>
@@ -19,12 +23,30 @@ protected:
     std::shared_ptr<EvseSecurity> evse_security;
     std::shared_ptr<MessageLogging> logging;
 
+    std::shared_ptr<ChargingStationHost> host;
     boost::shared_ptr<boost::asio::io_service::work> work;
-    boost::asio::io_service io_service;
+    boost::asio::io_service local_io_service;
+    /// \brief io_service that runs the timers and deferred work of the charging station. This is either the
+    /// local_io_service, run by the io_service_thread, or the io_service of an executor of the host
+    boost::asio::io_service& io_service;
     std::thread io_service_thread;
+    /// \brief Set by hold_io_service(), released by the destructor of ChargingStationBase
+    std::optional<std::promise<void>> io_service_released;
 
     boost::uuids::random_generator uuid_generator;
 
+    /// \brief Blocks the io_service until the destructor of ChargingStationBase has run, so that no handler of the
+    /// charging station runs while its members are destroyed. Has to be called in the destructor of every charging
+    /// station before any of its members is destroyed.
+    ///
+    /// \p stop_timers has to stop all timers of the charging station that run on the io_service. It is called once the
+    /// io_service is blocked. Handlers of timers that expired before they were stopped can already be queued, these
+    /// are run on the calling thread while the charging station is still intact. \p stop_timers is called again after
+    /// each of these handlers in case it started a timer. The handlers of the stopped timers return without accessing
+    /// them when the io_service continues. While the io_service is held, the other charging stations of its executor
+    /// are paused as well
+    void hold_io_service(const std::function<void()>& stop_timers);
+
     /// \brief Generates a uuid
     /// \return uuid
     std::string uuid();
@@ -35,8 +57,11 @@ public:
     /// security_configuration must be set
     /// \param security_configuration specifies the file paths that are required to set up the internal evse_security
     /// implementation
+    /// \param host optional host that runs the timers and deferred work of the charging station together with those of
+    /// other charging stations; if nullptr the charging station starts a thread of its own for this
     explicit ChargingStationBase(const std::shared_ptr<EvseSecurity> evse_security,
-                                 const std::optional<SecurityConfiguration> security_configuration = std::nullopt);
+                                 const std::optional<SecurityConfiguration> security_configuration = std::nullopt,
+                                 std::shared_ptr<ChargingStationHost> host = nullptr);
     virtual ~ChargingStationBase();
 };
 
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_COMMON_CHARGING_STATION_HOST_HPP
+#define OCPP_COMMON_CHARGING_STATION_HOST_HPP
+
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/io_service.hpp>
+
+namespace ocpp {
+
+/// \brief Hosts many charging stations in one process, e.g. in simulators or gateways.
+///
+/// Without a host every charging station runs its timers and deferred work on an io_service thread of its own. Stations
+/// that are created with a host share the fixed number of executors of the host instead. Every station is bound to
+/// a single executor, so the handlers of one station are still executed one after another like with a thread of its
+/// own, while the stations are spread evenly over the executors.
+class ChargingStationHost {
+public:
+    /// \brief Creates a host with \p number_of_executors executors, each running an io_service on a thread of its
+    /// own. At least one executor is created
+    explicit ChargingStationHost(const size_t number_of_executors = 1);
+    ~ChargingStationHost();
+
+    ChargingStationHost(const ChargingStationHost&) = delete;
+    ChargingStationHost& operator=(const ChargingStationHost&) = delete;
+
+    /// \brief Binds a charging station to the executor with the fewest charging stations
+    /// \returns the io_service of that executor, which stays valid as long as the host exists
+    boost::asio::io_service& acquire_io_service();
+
+    /// \brief Unbinds a charging station from the executor of \p io_service, which must have been returned by
+    /// acquire_io_service()
+    void release_io_service(boost::asio::io_service& io_service);
+
+    /// \brief Returns the number of executors of the host
+    size_t get_number_of_executors() const;
+
+    /// \brief Returns the number of charging stations that are currently bound to the executors of the host
+    size_t get_number_of_stations();
+
+private:
+    struct Executor {
+        boost::asio::io_service io_service;
+        std::unique_ptr<boost::asio::io_service::work> work;
+        std::thread thread;
+        size_t stations = 0;
+    };
+
+    std::mutex executors_mutex;
+    std::vector<std::unique_ptr<Executor>> executors;
+};
+
+} // namespace ocpp
+
+#endif // OCPP_COMMON_CHARGING_STATION_HOST_HPP
@@ -3,6 +3,9 @@
 #ifndef OCPP_COMMON_CISTRING_HPP
 #define OCPP_COMMON_CISTRING_HPP
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include <nlohmann/json.hpp>
 
 #include <ocpp/common/string.hpp>
@@ -23,8 +26,7 @@ public:
     CiString(const char* data) : String<L>(data) {
     }
 
-    CiString(const CiString<L>& data) : String<L>(data.get()) {
-    }
+    CiString(const CiString<L>& data) = default;
 
     /// \brief Creates a string
     CiString() : String<L>() {
@@ -34,13 +36,11 @@ public:
     CiString& operator=(const CiString&) = default;
     CiString& operator=(CiString&&) = default;
 
-    /// \brief CaseInsensitive string implementation only allows printable ASCII characters
-    bool is_valid(const std::string& data) {
-        for (const char& character : data) {
-            // printable ASCII starts at code 0x20 (space) and ends with code 0x7e (tilde) and 0xa (\n)
-            if ((character < 0x20 || character > 0x7e) && character != 0xa) {
-                throw std::runtime_error("CiString can only contain printable ASCII characters");
-            }
+    /// \brief Checks that \p data only contains printable ASCII characters and throws a std::runtime_error otherwise.
+    /// set() and the constructors do not apply this check, so that values that have been accepted before still are
+    bool is_valid(std::string_view data) const {
+        if (not is_printable_ascii(data)) {
+            throw std::runtime_error("CiString can only contain printable ASCII characters");
         }
         return true;
     }
@@ -53,38 +53,59 @@ public:
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
 template <size_t L> bool operator==(const CiString<L>& lhs, const char* rhs) {
-    return iequals(lhs.get(), rhs);
+    return iequals(lhs.view(), rhs);
 }
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
 template <size_t L> bool operator==(const CiString<L>& lhs, const CiString<L>& rhs) {
-    return iequals(lhs.get(), rhs.get());
+    return iequals(lhs.view(), rhs.view());
 }
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
 template <size_t L> bool operator!=(const CiString<L>& lhs, const char* rhs) {
-    return !(lhs.get() == rhs);
+    return !(lhs == rhs);
 }
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
 template <size_t L> bool operator!=(const CiString<L>& lhs, const CiString<L>& rhs) {
-    return !(lhs.get() == rhs.get());
+    return !(lhs == rhs);
 }
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
 template <size_t L> bool operator<(const CiString<L>& lhs, const CiString<L>& rhs) {
-    return lhs.get() < rhs.get();
+    return iless(lhs.view(), rhs.view());
 }
 
 /// \brief Writes the given string \p str to the given output stream \p os
 /// \returns an output stream with the case insensitive string written to
 template <size_t L> std::ostream& operator<<(std::ostream& os, const CiString<L>& str) {
-    os << str.get();
+    os << str.view();
     return os;
 }
 
+/// \brief Case insensitive hash for a case insensitive (Ci)String, consistent with its operator==
+template <size_t L> struct CiStringHash {
+    size_t operator()(const CiString<L>& str) const noexcept {
+        return ihash(str.view());
+    }
+};
+
+/// \brief Case insensitive equality for a case insensitive (Ci)String
+template <size_t L> struct CiStringEqual {
+    bool operator()(const CiString<L>& lhs, const CiString<L>& rhs) const {
+        return iequals(lhs.view(), rhs.view());
+    }
+};
+
+/// \brief Hash map with case insensitive (Ci)String keys
+template <size_t L, typename T>
+using CiStringMap = std::unordered_map<CiString<L>, T, CiStringHash<L>, CiStringEqual<L>>;
+
+/// \brief Hash set of case insensitive (Ci)Strings
+template <size_t L> using CiStringSet = std::unordered_set<CiString<L>, CiStringHash<L>, CiStringEqual<L>>;
+
 template <size_t L> void to_json(json& j, const CiString<L>& k) {
-    j = json(k.get());
+    j = k.view();
 }
 
 template <size_t L> void from_json(const json& j, CiString<L>& k) {
@@ -93,4 +114,11 @@ template <size_t L> void from_json(const json& j, CiString<L>& k) {
 
 } // namespace ocpp
 
+namespace std {
+
+/// \brief Hashes a CiString case insensitively, so that it is consistent with its operator==
+template <size_t L> struct hash<ocpp::CiString<L>> : ocpp::CiStringHash<L> {};
+
+} // namespace std
+
 #endif
@@ -3,10 +3,15 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include <everest/timer.hpp>
+
 #include <ocpp/common/database/database_connection.hpp>
 #include <ocpp/common/database/database_exceptions.hpp>
 #include <ocpp/common/types.hpp>
@@ -14,14 +19,75 @@
 namespace ocpp::common {
 
 struct DBTransactionMessage {
-    json json_message;
+    json json_message; ///< May be null on insertion if serialized_message is set
     std::string message_type;
     int32_t message_attempts;
     DateTime timestamp;
     std::string unique_id;
+    std::shared_ptr<const std::string> serialized_message; ///< Serialized json_message, used on insertion if set
+    int64_t position = 0; ///< Position in the message queue table, set by get_message_queue_messages_page()
 };
 
+/// \brief Default maximum number of message queue operations that are committed within one database transaction
+constexpr std::size_t DEFAULT_MESSAGE_QUEUE_MAX_BATCH_SIZE = 100;
+/// \brief Default maximum time a message queue operation is buffered before it is committed
+constexpr std::chrono::milliseconds DEFAULT_MESSAGE_QUEUE_MAX_FLUSH_LATENCY{500};
+/// \brief Number of failed commits after which a buffered message queue operation is dropped, so that e.g. an insert
+/// violating a constraint does not block all other operations forever
+constexpr int32_t MESSAGE_QUEUE_OPERATION_MAX_ATTEMPTS = 3;
+
 class DatabaseHandlerCommon {
+private:
+    /// \brief A buffered insert into or delete from one of the message queue tables
+    struct MessageQueueOperation {
+        bool insert;
+        QueueType queue_type;
+        DBTransactionMessage message; ///< Only set for inserts; for deletes only message.unique_id is used
+        int32_t failed_attempts = 0;  ///< Number of commits this operation has failed
+    };
+
+    std::mutex message_queue_operations_mutex;
+    std::vector<MessageQueueOperation> message_queue_operations;
+    std::chrono::steady_clock::time_point oldest_message_queue_operation;
+    std::size_t message_queue_max_batch_size;
+    std::chrono::milliseconds message_queue_max_flush_latency;
+    boost::asio::io_context* message_queue_flush_io_context;
+    /// \brief Commits the buffered operations once the flush latency elapsed. Created with the first buffered operation
+    std::unique_ptr<Everest::SteadyTimer> message_queue_flush_timer;
+
+    void insert_message_queue_message_internal(const DBTransactionMessage& db_message, const QueueType queue_type);
+    void remove_message_queue_message_internal(const std::string& unique_id, const QueueType queue_type);
+
+    /// \brief Executes the given \p operation without any transaction handling. Throws a QueryExecutionException on
+    /// failure
+    void execute_message_queue_operation(const MessageQueueOperation& operation);
+
+    /// \brief Executes all buffered operations without removing them from the buffer. Must be called within a
+    /// database transaction and with message_queue_operations_mutex held. If an operation fails, its failed attempts
+    /// are counted and the QueryExecutionException is rethrown, so the caller must roll back the transaction. An
+    /// operation that failed MESSAGE_QUEUE_OPERATION_MAX_ATTEMPTS times is dropped from the buffer
+    void execute_message_queue_operations();
+
+    /// \brief Commits all buffered operations in one database transaction and clears the buffer. Must be called with
+    /// message_queue_operations_mutex held. On failure the transaction is rolled back, the operations are kept for the
+    /// next attempt and a QueryExecutionException is thrown
+    void flush_message_queue_operations_locked();
+
+    /// \brief Like flush_message_queue_operations_locked(), but a failure is logged and the flush is retried by the
+    /// flush timer after the flush latency. Used for flushes that are not requested by a caller
+    void try_flush_message_queue_operations_locked();
+
+    /// \brief Buffers the given \p operation and commits the buffer if it is full. Must be called with
+    /// message_queue_operations_mutex held
+    void buffer_message_queue_operation(MessageQueueOperation&& operation);
+
+    /// \brief Arms the flush timer for the flush latency of the oldest buffered operation. Must be called with
+    /// message_queue_operations_mutex held
+    void arm_message_queue_flush_timer();
+
+    /// \brief Commits all buffered operations, called by the flush timer
+    void flush_message_queue_operations_on_timeout();
+
 protected:
     std::unique_ptr<DatabaseConnectionInterface> database;
     const fs::path sql_migration_files_path;
@@ -40,33 +106,84 @@ public:
     explicit DatabaseHandlerCommon(std::unique_ptr<DatabaseConnectionInterface> database,
                                    const fs::path& sql_migration_files_path, uint32_t target_schema_version) noexcept;
 
-    ~DatabaseHandlerCommon() = default;
+    virtual ~DatabaseHandlerCommon();
 
     /// \brief Opens connection to database file and performs the initialization by calling init_sql()
     void open_connection();
 
-    /// \brief Closes the database connection.
+    /// \brief Closes the database connection. Buffered message queue operations are committed before.
     void close_connection();
 
-    /// \brief Get messages from messages queue table specified by \p queue_type
+    /// \brief Configures the write-behind stage of the message queue tables.
+    ///
+    /// Inserts into and deletes from both message queue tables are buffered and committed in batches of at most
+    /// \p max_batch_size operations within one database transaction, at the latest \p max_flush_latency after the
+    /// first operation of a batch was buffered. Callers that need transaction related messages to survive a crash
+    /// call flush_message_queue_operations() after inserting them; the MessageQueue does this once for all messages
+    /// pushed concurrently. A lost delete only causes a message to be sent again after a restart, which can happen
+    /// anyway if the station reboots between sending a message and receiving its response.
+    /// A \p max_batch_size of 1 disables buffering.
+    void set_message_queue_write_behind(std::size_t max_batch_size, std::chrono::milliseconds max_flush_latency);
+
+    /// \brief Runs the timer that commits buffered message queue operations after the flush latency on \p io_context,
+    /// e.g. the io_service of the charging station, instead of a thread of its own. Must be called before the first
+    /// message queue operation is buffered and \p io_context must outlive the database handler
+    void set_message_queue_flush_io_context(boost::asio::io_context* io_context);
+
+    /// \brief Commits all buffered message queue operations. Throws a QueryExecutionException if they could not be
+    /// committed; the operations are kept and committed with the next flush
+    virtual void flush_message_queue_operations();
+
+    /// \brief Stops the timer that commits buffered message queue operations after the flush latency. The operations
+    /// stay buffered until the next flush
+    void stop_message_queue_flush_timer();
+
+    /// \brief Get messages from messages queue table specified by \p queue_type. Buffered operations are committed
+    /// before.
     /// \param queue_type , defaults to QueueType::Transaction
     /// \return The transaction messages.
     virtual std::vector<DBTransactionMessage>
     get_message_queue_messages(const QueueType queue_type = QueueType::Transaction);
 
-    /// \brief Insert a new message into messages queue table specified by \p queue_type
+    /// \brief Get the position of the most recently inserted message of the messages queue table specified by
+    /// \p queue_type. Buffered operations are committed before.
+    /// \return The position or 0 if the table is empty.
+    virtual int64_t get_message_queue_end(const QueueType queue_type);
+
+    /// \brief Get at most \p limit messages from messages queue table specified by \p queue_type in the order they have
+    /// been inserted, starting after position \p after up to and including position \p until. Buffered operations are
+    /// committed before. In contrast to get_message_queue_messages() the messages are not parsed: json_message is null
+    /// and serialized_message contains the message.
+    /// \param message_type if set, only messages of this type are returned
+    /// \return The messages, the position of the last message can be used as \p after for the next page.
+    virtual std::vector<DBTransactionMessage>
+    get_message_queue_messages_page(const QueueType queue_type, const int64_t after, const int64_t until,
+                                    const std::size_t limit,
+                                    const std::optional<std::string>& message_type = std::nullopt);
+
+    /// \brief Insert a new message into messages queue table specified by \p queue_type. The insert may be buffered,
+    /// see set_message_queue_write_behind()
     /// \param message  The message to be stored.
     /// \param queue_type , defaults to QueueType::Transaction
     virtual void insert_message_queue_message(const DBTransactionMessage& message,
                                               const QueueType queue_type = QueueType::Transaction);
 
-    /// \brief Remove a message from the messages queue table specified by \p queue_type
+    /// \brief Remove a message from the messages queue table specified by \p queue_type. The delete may be buffered,
+    /// see set_message_queue_write_behind()
     /// \param unique_id    The unique id of the transaction message
     /// \param queue_type , defaults to QueueType::Transaction
     /// \return True on success.
     virtual void remove_message_queue_message(const std::string& unique_id,
                                               const QueueType queue_type = QueueType::Transaction);
 
+    /// \brief Removes the messages with the given \p unique_ids from the messages queue table specified by
+    /// \p queue_type using as few statements as possible. Buffered operations are committed within the same database
+    /// transaction. Throws a QueryExecutionException on failure, in which case nothing is committed.
+    /// \param unique_ids  The unique ids of the messages
+    /// \param queue_type , defaults to QueueType::Transaction
+    virtual void remove_message_queue_messages(const std::vector<std::string>& unique_ids,
+                                               const QueueType queue_type = QueueType::Transaction);
+
     /// \brief Deletes all entries from message queue table specified by \p queue_type
     /// \param queue_type , defaults to QueueType::Transaction
     virtual void clear_message_queue(const QueueType queue_type = QueueType::Transaction);
@@ -32,6 +32,8 @@ public:
                           SQLiteString lifetime = SQLiteString::Static) = 0;
     virtual int bind_int(const int idx, const int val) = 0;
     virtual int bind_int(const std::string& param, const int val) = 0;
+    virtual int bind_int64(const int idx, const int64_t val) = 0;
+    virtual int bind_int64(const std::string& param, const int64_t val) = 0;
     virtual int bind_datetime(const int idx, const ocpp::DateTime val) = 0;
     virtual int bind_datetime(const std::string& param, const ocpp::DateTime val) = 0;
     virtual int bind_double(const int idx, const double val) = 0;
@@ -44,6 +46,7 @@ public:
     virtual std::string column_text(const int idx) = 0;
     virtual std::optional<std::string> column_text_nullable(const int idx) = 0;
     virtual int column_int(const int idx) = 0;
+    virtual int64_t column_int64(const int idx) = 0;
     virtual ocpp::DateTime column_datetime(const int idx) = 0;
     virtual double column_double(const int idx) = 0;
 };
@@ -67,6 +70,8 @@ public:
                   SQLiteString lifetime = SQLiteString::Static) override;
     int bind_int(const int idx, const int val) override;
     int bind_int(const std::string& param, const int val) override;
+    int bind_int64(const int idx, const int64_t val) override;
+    int bind_int64(const std::string& param, const int64_t val) override;
     int bind_datetime(const int idx, const ocpp::DateTime val) override;
     int bind_datetime(const std::string& param, const ocpp::DateTime val) override;
     int bind_double(const int idx, const double val) override;
@@ -79,6 +84,7 @@ public:
     std::string column_text(const int idx) override;
     std::optional<std::string> column_text_nullable(const int idx) override;
     int column_int(const int idx) override;
+    int64_t column_int64(const int idx) override;
     ocpp::DateTime column_datetime(const int idx) override;
     double column_double(const int idx) override;
 };
@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_COMMON_JSON_SAX_FIELDS_HPP
+#define OCPP_COMMON_JSON_SAX_FIELDS_HPP
+
+#include <string_view>
+#include <vector>
+
+namespace ocpp {
+
+struct JsonSaxValueHandler;
+
+/// \brief A value that the JsonSaxReader reads the next json value into, \p handler describes the type of \p value.
+/// A target without a handler skips the json value
+struct JsonSaxTarget {
+    const JsonSaxValueHandler* handler = nullptr;
+    void* value = nullptr;
+};
+
+/// \brief A member of a struct that is read from the json object key \p key
+struct JsonSaxField {
+    std::string_view key;
+    bool required;                         ///< true if the key has to be present in the json object
+    JsonSaxTarget (*target)(void* object); ///< Provides the member of the given struct that the value is read into
+};
+
+/// \brief The members of a struct that the JsonSaxReader reads from a json object, at most 64 per struct.
+/// They are provided by json_sax_fields(const T*) next to the from_json(const json&, T&) of every generated struct
+using JsonSaxFields = std::vector<JsonSaxField>;
+
+} // namespace ocpp
+
+#endif // OCPP_COMMON_JSON_SAX_FIELDS_HPP
@@ -0,0 +1,277 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_COMMON_JSON_SAX_READER_HPP
+#define OCPP_COMMON_JSON_SAX_READER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <ocpp/common/call_types.hpp>
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/string.hpp>
+#include <ocpp/common/types.hpp>
+
+namespace ocpp {
+
+/// \brief A null, boolean, number or string value reported by the SAX parser
+struct JsonSaxPrimitive {
+    json::value_t type;
+    bool boolean = false;
+    json::number_integer_t number_integer = 0;
+    json::number_unsigned_t number_unsigned = 0;
+    json::number_float_t number_float = 0;
+    std::string* string = nullptr; ///< Buffer of the parser that may be moved from
+};
+
+/// \brief Describes how the JsonSaxReader reads json values into a value of one C++ type
+struct JsonSaxValueHandler {
+    enum class Kind {
+        Primitive, ///< read from a null, boolean, number or string
+        Object,    ///< a struct read from a json object
+        Array,     ///< a std::vector (or a CALL) read from a json array
+        Json       ///< a json value that is built from any json value
+    };
+
+    Kind kind;
+    /// \brief Reads a primitive json value into the value (Primitive and Json)
+    void (*read)(void* value, JsonSaxPrimitive& primitive);
+    /// \brief Provides the fields of the struct (Object)
+    const JsonSaxFields* (*fields)();
+    /// \brief Provides the target of the element with the given index (Array)
+    JsonSaxTarget (*element)(void* value, std::size_t index);
+    /// \brief Resets the value before a duplicate key of an object is read into it again (Object and Array)
+    void (*reset)(void* value);
+    /// \brief Number of elements the json array must at least contain (Array)
+    std::size_t required_elements;
+};
+
+/// \brief SAX handler for nlohmann::json::sax_parse that reads json text directly into generated OCPP types without
+/// building a json value first. Missing required keys and values of the wrong type throw the json::exception the
+/// from_json conversion throws in the same case. Unknown keys are skipped
+class JsonSaxReader {
+public:
+    /// \brief Creates a reader that reads the json text into \p root
+    explicit JsonSaxReader(JsonSaxTarget root);
+
+    /// \brief Reads the json text \p text into the root target
+    void parse(std::string_view text);
+
+    bool null();
+    bool boolean(bool val);
+    bool number_integer(json::number_integer_t val);
+    bool number_unsigned(json::number_unsigned_t val);
+    bool number_float(json::number_float_t val, const json::string_t& s);
+    bool string(json::string_t& val);
+    bool binary(json::binary_t& val);
+    bool start_object(std::size_t elements);
+    bool key(json::string_t& val);
+    bool end_object();
+    bool start_array(std::size_t elements);
+    bool end_array();
+
+    /// \brief Throws the json::parse_error \p ex, like json::parse does
+    template <typename Exception>
+    bool parse_error(std::size_t /*position*/, const std::string& /*last_token*/, const Exception& ex) {
+        throw ex;
+    }
+
+private:
+    /// \brief A json object or array that is currently read
+    struct Frame {
+        JsonSaxTarget target;
+        bool array;
+        std::size_t elements = 0;      ///< Number of elements of an array read so far
+        std::uint64_t read_fields = 0; ///< Fields of a struct read so far, by their index
+        JsonSaxTarget next;            ///< Target of the value of the last key of an object
+    };
+
+    JsonSaxTarget next_target();
+    void read_primitive(JsonSaxPrimitive& primitive);
+    void start_container(bool array);
+    void end_container();
+
+    JsonSaxTarget root;
+    std::vector<Frame> frames;
+    std::size_t skip_depth = 0; ///< Depth within a json value that is skipped
+};
+
+/// \brief Returns the name of the json type \p type as used in the messages of json::exception
+const char* json_type_name(json::value_t type);
+
+/// \brief Reads a json value into a json value, used for CustomData and other untyped parts of a message
+const JsonSaxValueHandler* json_sax_json_handler();
+
+template <typename T> struct is_json_sax_optional : std::false_type {};
+template <typename T> struct is_json_sax_optional<std::optional<T>> : std::true_type {};
+
+template <typename T> struct is_json_sax_vector : std::false_type {};
+template <typename T> struct is_json_sax_vector<std::vector<T>> : std::true_type {};
+
+template <std::size_t L> std::true_type is_json_sax_string(const String<L>*);
+std::false_type is_json_sax_string(...);
+
+/// \brief True for types that are read from a json primitive
+template <typename T>
+constexpr bool is_json_sax_primitive =
+    std::is_arithmetic_v<T> or std::is_enum_v<T> or std::is_same_v<T, std::string> or
+    std::is_same_v<T, DateTime> or decltype(is_json_sax_string(static_cast<const T*>(nullptr)))::value;
+
+template <typename T, auto Convert> void json_sax_read_primitive(void* value, JsonSaxPrimitive& primitive) {
+    auto& v = *static_cast<T*>(value);
+    if constexpr (std::is_same_v<T, bool>) {
+        if (primitive.type != json::value_t::boolean) {
+            throw json::type_error::create(302, std::string("type must be boolean, but is ") +
+                                                    json_type_name(primitive.type),
+                                           nullptr);
+        }
+        v = primitive.boolean;
+    } else if constexpr (std::is_arithmetic_v<T>) {
+        switch (primitive.type) {
+        case json::value_t::number_integer:
+            v = static_cast<T>(primitive.number_integer);
+            break;
+        case json::value_t::number_unsigned:
+            v = static_cast<T>(primitive.number_unsigned);
+            break;
+        case json::value_t::number_float:
+            v = static_cast<T>(primitive.number_float);
+            break;
+        case json::value_t::boolean:
+            v = static_cast<T>(primitive.boolean);
+            break;
+        default:
+            throw json::type_error::create(302, std::string("type must be number, but is ") +
+                                                    json_type_name(primitive.type),
+                                           nullptr);
+        }
+    } else {
+        if (primitive.type != json::value_t::string) {
+            throw json::type_error::create(302, std::string("type must be string, but is ") +
+                                                    json_type_name(primitive.type),
+                                           nullptr);
+        }
+        if constexpr (std::is_enum_v<T>) {
+            static_assert(!std::is_same_v<decltype(Convert), std::nullptr_t>,
+                          "enum fields need a string to enum conversion");
+            v = Convert(*primitive.string);
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            v = std::move(*primitive.string);
+        } else if constexpr (std::is_same_v<T, DateTime>) {
+            v = DateTime(*primitive.string);
+        } else {
+            v.set(*primitive.string);
+        }
+    }
+}
+
+template <typename T> const JsonSaxFields* json_sax_struct_fields() {
+    // found by argument dependent lookup in the namespace of T
+    return &json_sax_fields(static_cast<const T*>(nullptr));
+}
+
+template <typename T> void json_sax_reset_struct(void* value) {
+    *static_cast<T*>(value) = T{};
+}
+
+template <typename T> void json_sax_reset_vector(void* value) {
+    static_cast<T*>(value)->clear();
+}
+
+template <typename T, auto Convert = nullptr> const JsonSaxValueHandler* json_sax_handler();
+
+template <typename T, auto Convert> JsonSaxTarget json_sax_vector_element(void* value, std::size_t) {
+    auto& vector = *static_cast<T*>(value);
+    vector.emplace_back();
+    return {json_sax_handler<typename T::value_type, Convert>(), &vector.back()};
+}
+
+/// \brief Provides the handler that reads json values into values of type \p T. \p Convert is the string to enum
+/// conversion of enum types, or of the elements of a vector of enums
+template <typename T, auto Convert> const JsonSaxValueHandler* json_sax_handler() {
+    using Kind = JsonSaxValueHandler::Kind;
+    if constexpr (std::is_same_v<T, json>) {
+        return json_sax_json_handler();
+    } else if constexpr (is_json_sax_primitive<T>) {
+        static const JsonSaxValueHandler handler{Kind::Primitive, &json_sax_read_primitive<T, Convert>, nullptr,
+                                                 nullptr, nullptr, 0};
+        return &handler;
+    } else if constexpr (is_json_sax_vector<T>::value) {
+        static const JsonSaxValueHandler handler{
+            Kind::Array, nullptr, nullptr, &json_sax_vector_element<T, Convert>, &json_sax_reset_vector<T>, 0};
+        return &handler;
+    } else {
+        static const JsonSaxValueHandler handler{
+            Kind::Object, nullptr, &json_sax_struct_fields<T>, nullptr, &json_sax_reset_struct<T>, 0};
+        return &handler;
+    }
+}
+
+template <typename T> struct JsonSaxMember;
+template <typename C, typename M> struct JsonSaxMember<M C::*> {
+    using Class = C;
+    using Type = M;
+};
+
+template <auto Member, auto Convert> JsonSaxTarget json_sax_member_target(void* object) {
+    using Class = typename JsonSaxMember<decltype(Member)>::Class;
+    using Type = typename JsonSaxMember<decltype(Member)>::Type;
+    auto& member = static_cast<Class*>(object)->*Member;
+    if constexpr (is_json_sax_optional<Type>::value) {
+        member.emplace();
+        return {json_sax_handler<typename Type::value_type, Convert>(), &member.value()};
+    } else {
+        return {json_sax_handler<Type, Convert>(), &member};
+    }
+}
+
+/// \brief Creates the field that reads the json object key \p key into \p Member. The field is required unless the
+/// member is a std::optional. \p Convert is the string to enum conversion of enum members
+template <auto Member, auto Convert = nullptr> JsonSaxField json_sax_field(std::string_view key) {
+    using Type = typename JsonSaxMember<decltype(Member)>::Type;
+    return {key, !is_json_sax_optional<Type>::value, &json_sax_member_target<Member, Convert>};
+}
+
+template <typename T> JsonSaxTarget json_sax_call_element(void* value, std::size_t index) {
+    auto& call = *static_cast<Call<T>*>(value);
+    if (index == MESSAGE_ID) {
+        return {json_sax_handler<MessageId>(), &call.uniqueId};
+    }
+    if (index == CALL_PAYLOAD) {
+        return {json_sax_handler<T>(), &call.msg};
+    }
+    return {};
+}
+
+/// \brief Reads the json text \p text directly into \p value
+template <typename T> void read_json(std::string_view text, T& value) {
+    JsonSaxReader reader({json_sax_handler<T>(), &value});
+    reader.parse(text);
+}
+
+/// \brief Reads the received CALL \p message directly into a Call<T>
+template <typename T> Call<T> read_call(std::string_view message) {
+    static const JsonSaxValueHandler handler{
+        JsonSaxValueHandler::Kind::Array, nullptr, nullptr, &json_sax_call_element<T>, nullptr, CALL_PAYLOAD + 1};
+    Call<T> call;
+    JsonSaxReader reader({&handler, &call});
+    reader.parse(message);
+    return call;
+}
+
+/// \brief Parses the received OCPP \p message like json::parse, but skips the payload of a CALL if \p skip_payload
+/// returns true for its action. The payload is then replaced by null and can be read with read_call from the message
+/// text. \p payload_skipped is set to true if the payload has been skipped
+json parse_message(std::string_view message, const std::function<bool(const std::string& action)>& skip_payload,
+                   bool& payload_skipped);
+
+} // namespace ocpp
+
+#endif // OCPP_COMMON_JSON_SAX_READER_HPP
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_COMMON_JSON_WRITER_HPP
+#define OCPP_COMMON_JSON_WRITER_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <nlohmann/json_fwd.hpp>
+
+namespace ocpp {
+
+class DateTime;
+
+/// \brief Writes json text into a buffer that is kept across messages. The generated write_json functions use it to
+/// serialize OCPP types without building a json value first, their output is byte for byte the output of
+/// json(value).dump(): object keys are written in the order of a json object and strings, numbers and invalid UTF-8
+/// are handled like by json::dump. Commas between the elements of arrays and objects are inserted by the writer
+class JsonWriter {
+public:
+    /// \brief Removes the text written so far, the capacity of the buffer is kept for the next message
+    void clear();
+
+    /// \brief Provides the text written since the last clear()
+    const std::string& str() const;
+
+    /// \brief Moves the written text out of the writer
+    std::string release();
+
+    void begin_object();
+    void end_object();
+    void begin_array();
+    void end_array();
+
+    /// \brief Writes the key of the next member of the current object. Keys of the generated types are plain
+    /// identifiers, so \p key is not escaped
+    void key(std::string_view key);
+
+    void value(bool value);
+    void value(std::int32_t value);
+    void value(double value);
+    void value(std::string_view value);
+    void value(const std::string& value);
+    void value(const char* value);
+    void value(const nlohmann::json& value);
+
+    /// \brief Writes \p value as its RFC 3339 string without creating a std::string for it
+    void value(const DateTime& value);
+
+private:
+    /// \brief Writes the comma that separates a value from the previous element of an array
+    void separate();
+    void write_escaped(std::string_view value);
+
+    std::string buffer;
+};
+
+} // namespace ocpp
+
+#endif // OCPP_COMMON_JSON_WRITER_HPP
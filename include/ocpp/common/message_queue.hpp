@@ -3,11 +3,17 @@
 #ifndef OCPP_COMMON_MESSAGE_QUEUE_HPP
 #define OCPP_COMMON_MESSAGE_QUEUE_HPP
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <future>
+#include <limits>
+#include <map>
 #include <mutex>
+#include <optional>
 #include <queue>
 #include <set>
 #include <thread>
@@ -18,8 +24,11 @@
 
 #include <everest/timer.hpp>
 
+#include <ocpp/common/aligned_timer.hpp>
 #include <ocpp/common/call_types.hpp>
 #include <ocpp/common/database/database_handler_common.hpp>
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/mpsc_queue.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v16/messages/StopTransaction.hpp>
 #include <ocpp/v16/types.hpp>
@@ -30,6 +39,24 @@ namespace ocpp {
 
 using QueryExecutionException = common::QueryExecutionException;
 
+/// \brief Scheduling class of a non-transaction related message. Ready messages of a higher class are sent before ready
+/// messages of a lower class
+enum class MessageSchedulingClass {
+    High,
+    Normal,
+    Low
+};
+
+constexpr size_t NUMBER_OF_MESSAGE_SCHEDULING_CLASSES = 3;
+
+/// \brief Counters of a scheduling class of the MessageQueue
+struct MessageSchedulingClassStatistics {
+    size_t depth = 0; ///< Number of messages of this class that are currently queued
+    size_t sent = 0;  ///< Number of messages of this class that have been sent
+    std::chrono::steady_clock::duration total_latency{}; ///< Accumulated time the sent messages have been queued
+    std::chrono::steady_clock::duration max_latency{};   ///< Maximum time a sent message has been queued
+};
+
 template <typename M> struct MessageQueueConfig {
     int transaction_message_attempts;
     int transaction_message_retry_interval; // seconds
@@ -47,6 +74,44 @@ template <typename M> struct MessageQueueConfig {
         60; // interval for BootNotification.req in case response by CSMS is CALLERROR or CSMS does not respond at all
             // (within specified MessageTimeout)
 
+    // maximum number of CALLs that may await a response at the same time. A value of 1 keeps the strict single
+    // in-flight behavior of OCPP; larger values pipeline non-transactional CALLs while transaction related messages
+    // are still delivered one at a time and in order
+    int max_messages_in_flight = 1;
+
+    // scheduling classes of non-transaction related message types; message types that are not listed are scheduled as
+    // MessageSchedulingClass::Normal
+    std::map<M, MessageSchedulingClass> message_scheduling_classes;
+
+    // if true, ready messages of MessageSchedulingClass::High are also sent before older queued transaction related
+    // messages, the order of the transaction related messages among each other is not affected. A BootNotification is
+    // always sent first
+    bool high_priority_messages_before_transaction_messages = false;
+
+    // if true, ready messages are selected by weighted round robin over the scheduling classes using
+    // scheduling_class_weights (indexed by MessageSchedulingClass), so that lower classes are not starved; otherwise
+    // strictly by priority
+    bool weighted_fair_scheduling = false;
+    std::array<int, NUMBER_OF_MESSAGE_SCHEDULING_CLASSES> scheduling_class_weights{4, 2, 1};
+
+    // non-transaction related message types for which a queued message is replaced by a newer message of the same
+    // type reporting the same state (cf. ControlMessage::coalescing_key), e.g. the status of the same connector
+    std::set<M> coalesced_message_types;
+
+    // number of persisted messages that are restored from the database at a time. Persisted messages are restored
+    // in batches once the previously restored messages have been sent
+    int persisted_messages_replay_batch_size = 100;
+
+    // message types of received CALLs whose payload is not parsed into a json value but read directly into the request
+    // type by the JsonSaxReader when it is handled (cf. to_call)
+    std::set<M> directly_deserialized_message_types;
+
+    /// \brief Returns the scheduling class of the given \p message_type
+    MessageSchedulingClass get_scheduling_class(const M& message_type) const {
+        const auto it = message_scheduling_classes.find(message_type);
+        return it != message_scheduling_classes.end() ? it->second : MessageSchedulingClass::Normal;
+    }
+
     /// \brief Returns true if the given \p message_type shall be queued based on the configuration of
     /// queue_all_messages and message_types_discard_for_queueing
     bool check_queue(const M& message_type) {
@@ -55,37 +120,133 @@ template <typename M> struct MessageQueueConfig {
 };
 
 /// \brief Contains a OCPP message in json form with additional information
+/// A received message is parsed exactly once by MessageQueue::receive(); logging and message handlers work on the
+/// parsed \p message by reference instead of parsing or copying the frame again.
 template <typename M> struct EnhancedMessage {
     json message;                     ///< The OCPP message as json
     size_t message_size;              ///< size of the json message in bytes
     MessageId uniqueId;               ///< The unique ID of the json message
     M messageType = M::InternalError; ///< The OCPP message type
     MessageTypeId messageTypeId;      ///< The OCPP message type ID (CALL/CALLRESULT/CALLERROR)
-    json call_message;    ///< If the message is a CALLRESULT or CALLERROR this can contain the original CALL message
+    json call_message; ///< If the message is a CALLERROR or the CALLRESULT of a transaction related message this
+                       ///< contains the original CALL message. It is not set for a CALL, use message instead
     bool offline = false; ///< A flag indicating if the connection to the central system is offline
+    std::optional<std::string> call_text; ///< The received CALL if its payload has not been parsed into message
+                                          ///< because its type is directly deserialized, use to_call to read it
 };
 
+/// \brief Provides the received CALL \p message as a Call<T>. If the payload has not been parsed into a json value, the
+/// Call is read directly from the received text
+template <typename T, typename M> Call<T> to_call(const EnhancedMessage<M>& message) {
+    if (message.call_text.has_value()) {
+        return read_call<T>(message.call_text.value());
+    }
+    return message.message;
+}
+
 /// \brief This contains an internal control message
 template <typename M> struct ControlMessage {
-    json::array_t message;    ///< The OCPP message as a json array
     M messageType;            ///< The OCPP message type
     int32_t message_attempts; ///< The number of times this message has been rejected by the central system
     std::promise<EnhancedMessage<M>> promise; ///< A promise used by the async send interface
     DateTime timestamp;                       ///< A timestamp that shows when this message can be sent
     MessageId initial_unique_id;
     bool stall_until_accepted; // if true, message shall be sent only if registration status is accepted
+    std::chrono::steady_clock::time_point in_flight_deadline; ///< Point in time at which the sent message times out
+    bool replayed = false; ///< true if the message has been restored from the database after a restart
 
     /// \brief Creates a new ControlMessage object from the provided \p message
     explicit ControlMessage(const json& message, const bool stall_until_accepted = false);
 
+    /// \brief Creates a new ControlMessage object of the given \p message_type and \p unique_id from its
+    /// \p serialized_message, e.g. as written by the generated write_json. The json value of the message is only built
+    /// if it is needed, see json_message()
+    ControlMessage(std::string serialized_message, const M message_type, const MessageId& unique_id,
+                   const bool stall_until_accepted = false) :
+        messageType(message_type),
+        message_attempts(0),
+        initial_unique_id(unique_id),
+        stall_until_accepted(stall_until_accepted),
+        unique_id(unique_id),
+        serialized(std::make_shared<const std::string>(std::move(serialized_message))) {
+    }
+
     /// \brief Provides the unique message ID stored in the message
     /// \returns the unique ID of the contained message
     [[nodiscard]] MessageId uniqueId() const {
-        return this->message[MESSAGE_ID];
+        return this->unique_id;
+    }
+
+    /// \brief Replaces the unique message ID stored in the message, e.g. when the message is sent again
+    void set_unique_id(const MessageId& unique_id) {
+        this->json_message()[MESSAGE_ID] = unique_id;
+        this->unique_id = unique_id;
+        this->invalidate_serialized_message();
+    }
+
+    /// \brief Provides the OCPP message as a json array. If the message has been created from its serialization, the
+    /// json value is parsed on first use, e.g. to edit the message or to read its transaction id.
+    /// invalidate_serialized_message() has to be called whenever the message is modified
+    json::array_t& json_message() {
+        if (!this->message.has_value()) {
+            this->message = json::parse(*this->serialized).get<json::array_t>();
+        }
+        return this->message.value();
+    }
+
+    const json::array_t& json_message() const {
+        if (!this->message.has_value()) {
+            this->message = json::parse(*this->serialized).get<json::array_t>();
+        }
+        return this->message.value();
+    }
+
+    /// \brief Provides the serialized message as it is sent, logged and persisted. The serialization is cached until
+    /// invalidate_serialized_message() is called
+    const std::shared_ptr<const std::string>& serialized_message() {
+        if (this->serialized == nullptr) {
+            // serialize the elements directly instead of copying the array into a json value first
+            const auto& message = this->message.value();
+            std::string serialized_message = "[";
+            for (size_t i = 0; i < message.size(); i++) {
+                if (i > 0) {
+                    serialized_message += ",";
+                }
+                serialized_message += message[i].dump();
+            }
+            serialized_message += "]";
+            this->serialized = std::make_shared<const std::string>(std::move(serialized_message));
+        }
+        return this->serialized;
+    }
+
+    /// \brief Has to be called whenever the json value of the message is modified
+    void invalidate_serialized_message() {
+        this->json_message();
+        this->serialized = nullptr;
     }
 
     /// \brief True for transactional messages containing updates (measurements) for a transaction
     bool is_transaction_update_message() const;
+
+    /// \brief Provides the id of the transaction this message belongs to
+    /// \returns the transaction id or std::nullopt if it is not (yet) known
+    std::optional<std::string> transaction_id() const;
+
+    /// \brief True for messages containing signed meter values, which shall never be dropped when the queue is thinned
+    bool contains_signed_meter_values() const;
+
+    /// \brief Provides the key of the state that is reported by this message (e.g. the connector of a
+    /// StatusNotification). A queued message is superseded by a newer message of the same type with the same key
+    /// \returns the key or std::nullopt if messages of this type can not be coalesced
+    std::optional<std::string> coalescing_key() const;
+
+private:
+    MessageId unique_id;
+    /// The OCPP message as a json array, built from serialized on first use if the message has been created from its
+    /// serialization
+    mutable std::optional<json::array_t> message;
+    std::shared_ptr<const std::string> serialized; ///< cached serialization of message
 };
 
 /// \brief Indicates the transmission priority of a message that is being pushed to the message queue
@@ -132,6 +293,16 @@ bool is_start_transaction_message(const ocpp::v16::MessageType message_type);
 /// \return Always return false
 bool is_start_transaction_message(const ocpp::v201::MessageType message_type);
 
+/// \brief Indicates if the given \p message_type is a TransactionEvent message.
+/// \param message_type
+/// \return Always return false
+bool is_transaction_event_message(const ocpp::v16::MessageType message_type);
+
+/// \brief Indicates if the given \p message_type is a TransactionEvent message
+/// \param message_type
+/// \return true if MessageType is a TransactionEvent
+bool is_transaction_event_message(const ocpp::v201::MessageType message_type);
+
 /// \brief Indicates if the given \p control_message is a start transaction message
 template <typename M> auto is_start_transaction_message(const ControlMessage<M>& control_message) {
     return is_start_transaction_message(control_message.messageType);
@@ -164,6 +335,260 @@ bool allowed_to_send_message(const ControlMessage<M>& message, const DateTime& t
     return true;
 }
 
+/// \brief Queue of non-transaction related messages that is indexed by the point in time at which a message may be
+/// sent, by the registration gate (stall_until_accepted) and by the scheduling class of the message. Selecting the next
+/// message that is allowed to be sent does not have to look at messages that are still waiting for their timestamp or
+/// for the registration status.
+template <typename M> class ScheduledMessageQueue {
+public:
+    /// \brief Position of a message within the queue, messages with smaller keys are sent first
+    using Key = int64_t;
+    using TimePoint = std::chrono::time_point<date::utc_clock>;
+
+private:
+    struct Entry {
+        std::shared_ptr<ControlMessage<M>> message;
+        TimePoint send_time; ///< timestamp of the message at the time it was added
+        MessageSchedulingClass scheduling_class;
+        std::chrono::steady_clock::time_point queued_at;
+        std::optional<std::string> coalescing_key;
+    };
+
+    std::map<Key, Entry> messages; ///< all messages in queue order
+    /// messages that are allowed to be sent now, per scheduling class
+    std::array<std::set<Key>, NUMBER_OF_MESSAGE_SCHEDULING_CLASSES> ready;
+    std::set<std::pair<TimePoint, Key>> scheduled; ///< messages that can be sent once their send_time is reached
+    std::set<Key> stalled;                         ///< messages waiting for the registration status to be accepted
+    std::map<std::string, Key> coalescing_index;   ///< newest queued message per coalescing key
+    Key front_key = 0;
+    Key back_key = 0;
+    // restored messages are keyed below all other messages, so that they are sent first and in the order they have
+    // been restored
+    static constexpr Key REPLAYED_KEYS_BEGIN = std::numeric_limits<Key>::min() / 2;
+    static constexpr Key REPLAYED_KEYS_END = std::numeric_limits<Key>::min() / 4;
+    Key replayed_key = REPLAYED_KEYS_BEGIN;
+    bool registration_status_accepted = false;
+
+    bool weighted_fair_scheduling = false;
+    std::array<int, NUMBER_OF_MESSAGE_SCHEDULING_CLASSES> weights{1, 1, 1};
+    std::array<int, NUMBER_OF_MESSAGE_SCHEDULING_CLASSES> credits{0, 0, 0};
+
+    std::array<MessageSchedulingClassStatistics, NUMBER_OF_MESSAGE_SCHEDULING_CLASSES> statistics;
+
+    void add(const Key key, std::shared_ptr<ControlMessage<M>> message, const MessageSchedulingClass scheduling_class,
+             const std::optional<std::string>& coalescing_key, const bool newest) {
+        const auto send_time = message->timestamp.to_time_point();
+        const auto stall = message->stall_until_accepted and !this->registration_status_accepted;
+        this->messages.emplace(key, Entry{std::move(message), send_time, scheduling_class,
+                                          std::chrono::steady_clock::now(), coalescing_key});
+        if (coalescing_key.has_value()) {
+            if (newest) {
+                this->coalescing_index[coalescing_key.value()] = key;
+            } else {
+                this->coalescing_index.emplace(coalescing_key.value(), key);
+            }
+        }
+        this->statistics[static_cast<size_t>(scheduling_class)].depth++;
+        if (stall) {
+            this->stalled.insert(key);
+        } else {
+            this->scheduled.emplace(send_time, key);
+        }
+    }
+
+    // Moves all scheduled messages whose send_time has been reached to the ready messages
+    void promote(const TimePoint& now) {
+        while (!this->scheduled.empty() and this->scheduled.begin()->first <= now) {
+            const auto key = this->scheduled.begin()->second;
+            this->ready[static_cast<size_t>(this->messages.at(key).scheduling_class)].insert(key);
+            this->scheduled.erase(this->scheduled.begin());
+        }
+    }
+
+    // Returns the highest scheduling class that has ready messages and credits left, if any
+    std::optional<size_t> next_class_with_credits() const {
+        for (size_t i = 0; i < NUMBER_OF_MESSAGE_SCHEDULING_CLASSES; i++) {
+            if (!this->ready[i].empty() and this->credits[i] > 0) {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+public:
+    /// \brief Selects ready messages by weighted round robin over the scheduling classes with the given \p weights
+    /// if \p weighted_fair_scheduling is true, otherwise strictly by the priority of the scheduling classes
+    void configure_scheduling(const bool weighted_fair_scheduling,
+                              const std::array<int, NUMBER_OF_MESSAGE_SCHEDULING_CLASSES>& weights) {
+        this->weighted_fair_scheduling = weighted_fair_scheduling;
+        for (size_t i = 0; i < NUMBER_OF_MESSAGE_SCHEDULING_CLASSES; i++) {
+            this->weights[i] = std::max(weights[i], 1);
+        }
+        this->credits = this->weights;
+    }
+
+    /// \brief Adds the given \p message to the end of the queue. If a \p coalescing_key is given, the message can be
+    /// found by find_coalesced()
+    void push_back(std::shared_ptr<ControlMessage<M>> message,
+                   const MessageSchedulingClass scheduling_class = MessageSchedulingClass::Normal,
+                   const std::optional<std::string>& coalescing_key = std::nullopt) {
+        this->add(this->back_key++, std::move(message), scheduling_class, coalescing_key, true);
+    }
+
+    /// \brief Adds the given \p message to the front of the queue. A queued message with the same \p coalescing_key
+    /// is considered to be newer than the given \p message
+    void push_front(std::shared_ptr<ControlMessage<M>> message,
+                    const MessageSchedulingClass scheduling_class = MessageSchedulingClass::Normal,
+                    const std::optional<std::string>& coalescing_key = std::nullopt) {
+        this->add(--this->front_key, std::move(message), scheduling_class, coalescing_key, false);
+    }
+
+    /// \brief Adds the given \p message that has been restored from the database. Restored messages are placed in
+    /// front of all other messages in the order they are pushed
+    void push_replayed(std::shared_ptr<ControlMessage<M>> message,
+                       const MessageSchedulingClass scheduling_class = MessageSchedulingClass::Normal,
+                       const std::optional<std::string>& coalescing_key = std::nullopt) {
+        this->add(this->replayed_key++, std::move(message), scheduling_class, coalescing_key, false);
+    }
+
+    /// \brief Returns true if the queue contains messages added by push_replayed()
+    bool contains_replayed() const {
+        return !this->messages.empty() and this->messages.begin()->first < REPLAYED_KEYS_END;
+    }
+
+    /// \brief Returns the key of the newest queued message that has been added with the given \p coalescing_key
+    std::optional<Key> find_coalesced(const std::string& coalescing_key) const {
+        const auto it = this->coalescing_index.find(coalescing_key);
+        if (it == this->coalescing_index.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    /// \brief Replaces the message with the given \p key by \p message. The position in the queue, the scheduling
+    /// class and the coalescing key of the replaced message are kept
+    void replace(const Key key, std::shared_ptr<ControlMessage<M>> message) {
+        const auto& entry = this->messages.at(key);
+        const auto scheduling_class = entry.scheduling_class;
+        const auto coalescing_key = entry.coalescing_key;
+        this->erase(key);
+        this->add(key, std::move(message), scheduling_class, coalescing_key, true);
+    }
+
+    size_t size() const {
+        return this->messages.size();
+    }
+
+    bool empty() const {
+        return this->messages.empty();
+    }
+
+    /// \brief Returns the first message in queue order, regardless of whether it is allowed to be sent
+    const std::shared_ptr<ControlMessage<M>>& front() const {
+        return this->messages.begin()->second.message;
+    }
+
+    void pop_front() {
+        this->erase(this->messages.begin()->first);
+    }
+
+    /// \brief Returns the message with the given \p key
+    const std::shared_ptr<ControlMessage<M>>& at(const Key key) const {
+        return this->messages.at(key).message;
+    }
+
+    /// \brief Returns the scheduling class of the message with the given \p key
+    MessageSchedulingClass scheduling_class(const Key key) const {
+        return this->messages.at(key).scheduling_class;
+    }
+
+    /// \brief Removes the message with the given \p key without sending it
+    void erase(const Key key) {
+        const auto it = this->messages.find(key);
+        if (it == this->messages.end()) {
+            return;
+        }
+        const auto index = static_cast<size_t>(it->second.scheduling_class);
+        if (it->second.coalescing_key.has_value()) {
+            const auto coalesced = this->coalescing_index.find(it->second.coalescing_key.value());
+            if (coalesced != this->coalescing_index.end() and coalesced->second == key) {
+                this->coalescing_index.erase(coalesced);
+            }
+        }
+        this->ready[index].erase(key);
+        this->stalled.erase(key);
+        this->scheduled.erase({it->second.send_time, key});
+        this->statistics[index].depth--;
+        this->messages.erase(it);
+    }
+
+    /// \brief Removes the message with the given \p key because it has been sent
+    void take(const Key key) {
+        const auto it = this->messages.find(key);
+        if (it == this->messages.end()) {
+            return;
+        }
+        const auto index = static_cast<size_t>(it->second.scheduling_class);
+        const auto latency = std::chrono::steady_clock::now() - it->second.queued_at;
+        auto& statistics = this->statistics[index];
+        statistics.sent++;
+        statistics.total_latency += latency;
+        statistics.max_latency = std::max(statistics.max_latency, latency);
+        if (this->credits[index] > 0) {
+            this->credits[index]--;
+        }
+        this->erase(key);
+    }
+
+    /// \brief Returns the key of the message that shall be sent next out of the messages that are allowed to be sent at
+    /// \p now. Within a scheduling class messages are selected in queue order
+    std::optional<Key> next_ready(const TimePoint& now) {
+        this->promote(now);
+        std::optional<size_t> index;
+        if (this->weighted_fair_scheduling) {
+            index = this->next_class_with_credits();
+            if (!index.has_value()) {
+                // every class with ready messages has used up its share of this round, so start the next round
+                this->credits = this->weights;
+                index = this->next_class_with_credits();
+            }
+        } else {
+            for (size_t i = 0; i < NUMBER_OF_MESSAGE_SCHEDULING_CLASSES and !index.has_value(); i++) {
+                if (!this->ready[i].empty()) {
+                    index = i;
+                }
+            }
+        }
+        if (!index.has_value()) {
+            return std::nullopt;
+        }
+        return *this->ready[index.value()].begin();
+    }
+
+    /// \brief Returns the earliest point in time at which a message that is not ready yet may be sent. Messages
+    /// waiting for the registration status are not considered
+    std::optional<TimePoint> next_send_time() const {
+        if (this->scheduled.empty()) {
+            return std::nullopt;
+        }
+        return this->scheduled.begin()->first;
+    }
+
+    /// \brief Releases all messages that were waiting for the registration status to be accepted
+    void set_registration_status_accepted() {
+        this->registration_status_accepted = true;
+        for (const auto key : this->stalled) {
+            this->scheduled.emplace(this->messages.at(key).send_time, key);
+        }
+        this->stalled.clear();
+    }
+
+    /// \brief Returns the counters of the given \p scheduling_class
+    const MessageSchedulingClassStatistics& get_statistics(const MessageSchedulingClass scheduling_class) const {
+        return this->statistics[static_cast<size_t>(scheduling_class)];
+    }
+};
+
 /// \brief contains a message queue that makes sure that OCPPs synchronicity requirements are met
 template <typename M> class MessageQueue {
 private:
@@ -173,12 +598,48 @@ private:
     std::thread worker_thread;
     /// message deque for transaction related messages
     std::deque<std::shared_ptr<ControlMessage<M>>> transaction_message_queue;
+    /// number of TransactionEvent messages in the transaction_message_queue per transactionId
+    CiStringMap<36, size_t> queued_transaction_events;
     /// message queue for non-transaction related messages
-    std::deque<std::shared_ptr<ControlMessage<M>>> normal_message_queue;
-    std::shared_ptr<ControlMessage<M>> in_flight;
+    ScheduledMessageQueue<M> normal_message_queue;
+    /// CALL messages that have been sent and are awaiting a CALLRESULT or CALLERROR, keyed by their unique id
+    std::map<MessageId, std::shared_ptr<ControlMessage<M>>> in_flight;
+    /// A message pushed to the ingress
+    struct PushedMessage {
+        std::shared_ptr<ControlMessage<M>> message; ///< nullptr for a barrier pushed by wait_for_worker()
+        QueueType queue_type;
+        /// set if the pushing thread waits until the message has been added to the queues and committed to the database
+        std::optional<std::promise<void>> committed;
+    };
+    /// messages pushed by any thread that have not been added to the message queues yet. The messages are added to the
+    /// queues and persisted by whoever holds the message_mutex next (usually the worker thread), so pushing a message
+    /// never waits for the message_mutex or the database
+    MpscQueue<PushedMessage> ingress;
+    /// promises of the drained messages whose database operations have not been committed yet
+    std::vector<std::promise<void>> uncommitted_messages;
+    /// true while the worker thread commits the drained messages, cf. wait_for_commit()
+    std::atomic<bool> worker_commits;
+    std::atomic<std::thread::id> worker_thread_id;
+    /// true while the worker thread is (about to be) waiting on the cv
+    std::atomic<bool> worker_waiting;
+    /// number of times the worker thread has been woken up
+    size_t worker_wakeups = 0;
+
+    /// Position of the persisted messages of a queue table that are restored after a restart
+    struct PersistedMessagesReplay {
+        int64_t position = 0; ///< position of the last restored message
+        int64_t end = 0;      ///< position of the last message that was persisted before the restart
+    };
+    PersistedMessagesReplay normal_messages_replay;
+    PersistedMessagesReplay transaction_messages_replay;
+    /// number of persisted transaction related messages per message type and transactionId that have not been restored
+    /// yet. The counts of a message type are read from the database when they are looked up first and are updated as
+    /// the messages are restored
+    std::map<M, CiStringMap<36, size_t>> persisted_transaction_ids;
+    bool ignore_security_event_notifications = false;
     std::recursive_mutex message_mutex;
     std::condition_variable_any cv;
-    std::function<bool(json message)> send_callback;
+    std::function<bool(const std::string& message)> send_callback;
     std::vector<M> external_notify;
     bool paused;
     // Transiently true while the queue is paused, but is waiting to unpause
@@ -190,11 +651,13 @@ private:
     std::recursive_mutex next_message_mutex;
     std::optional<MessageId> next_message_to_send;
 
-    Everest::SteadyTimer in_flight_timeout_timer;
-    Everest::SteadyTimer notify_queue_timer;
+    // The timers run on the io_context given to the constructor or, if there is none, on threads of their own
+    std::unique_ptr<Everest::SteadyTimer> in_flight_timeout_timer;
+    // wakes up the worker once the next queued message is allowed to be sent
+    std::unique_ptr<Everest::SteadyTimer> notify_queue_timer;
 
     // This timer schedules the resumption of the message queue
-    Everest::SteadyTimer resume_timer;
+    std::unique_ptr<Everest::SteadyTimer> resume_timer;
     // Counts the number of pause()/resume() calls.
     // Used by the resume timer callback to abort itself in case the timer triggered before it could be cancelled.
     u_int64_t pause_resume_ctr = 0;
@@ -240,20 +703,69 @@ private:
         return false;
     }
 
+    MessageSchedulingClass get_scheduling_class(const M& message_type) const {
+        if (message_type == M::BootNotification) {
+            return MessageSchedulingClass::High;
+        }
+        return this->config.get_scheduling_class(message_type);
+    }
+
+    std::optional<std::string> get_coalescing_key(const ControlMessage<M>& message) {
+        if (!this->config.coalesced_message_types.count(message.messageType)) {
+            return std::nullopt;
+        }
+        const auto coalescing_key = message.coalescing_key();
+        if (!coalescing_key.has_value()) {
+            return std::nullopt;
+        }
+        return messagetype_to_string(message.messageType) + "/" + coalescing_key.value();
+    }
+
+    // Replaces the queued message that is superseded by the given message, if any
+    bool coalesce(const std::shared_ptr<ControlMessage<M>>& message, const std::optional<std::string>& coalescing_key) {
+        if (!coalescing_key.has_value()) {
+            return false;
+        }
+        const auto key = this->normal_message_queue.find_coalesced(coalescing_key.value());
+        if (!key.has_value()) {
+            return false;
+        }
+        const auto superseded_message = this->normal_message_queue.at(key.value());
+        EVLOG_debug << "Message " << superseded_message->uniqueId() << " is superseded by " << message->uniqueId();
+        this->normal_message_queue.replace(key.value(), message);
+        EnhancedMessage<M> enhanced_message;
+        enhanced_message.offline = true;
+        superseded_message->promise.set_value(enhanced_message);
+        if (this->config.check_queue(superseded_message->messageType)) {
+            try {
+                this->database_handler->remove_message_queue_message(superseded_message->initial_unique_id,
+                                                                     QueueType::Normal);
+            } catch (const QueryExecutionException& e) {
+                EVLOG_warning << "Could not delete message from message queue: " << e.what();
+            }
+        }
+        return true;
+    }
+
     void add_to_normal_message_queue(std::shared_ptr<ControlMessage<M>> message) {
         EVLOG_debug << "Adding message to normal message queue";
         {
             std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
-            // A BootNotification message should always jump the queue
-            if (message->messageType == M::BootNotification) {
-                this->normal_message_queue.push_front(message);
-            } else {
-                this->normal_message_queue.push_back(message);
+            const auto scheduling_class = this->get_scheduling_class(message->messageType);
+            const auto coalescing_key = this->get_coalescing_key(*message);
+            // A superseded message is replaced in place, otherwise the message is appended to the queue
+            if (!this->coalesce(message, coalescing_key)) {
+                // A BootNotification message should always jump the queue
+                if (message->messageType == M::BootNotification) {
+                    this->normal_message_queue.push_front(message, scheduling_class);
+                } else {
+                    this->normal_message_queue.push_back(message, scheduling_class, coalescing_key);
+                }
             }
             if (this->config.check_queue(message->messageType)) {
-                ocpp::common::DBTransactionMessage db_message{
-                    message->message, messagetype_to_string(message->messageType), message->message_attempts,
-                    message->timestamp, message->uniqueId()};
+                ocpp::common::DBTransactionMessage db_message{nullptr, messagetype_to_string(message->messageType),
+                                                              message->message_attempts, message->timestamp,
+                                                              message->uniqueId(), message->serialized_message()};
                 try {
                     this->database_handler->insert_message_queue_message(db_message, QueueType::Normal);
                 } catch (const QueryExecutionException& e) {
@@ -266,14 +778,37 @@ private:
         this->cv.notify_all();
         EVLOG_debug << "Notified message queue worker";
     }
+    /// \brief Counts the given \p message of the transaction_message_queue in queued_transaction_events if it has been
+    /// \p queued, or removes it from the count
+    void count_queued_transaction_event(const ControlMessage<M>& message, const bool queued) {
+        if (!is_transaction_event_message(message.messageType)) {
+            return;
+        }
+        const auto transaction_id = message.transaction_id();
+        // a transactionId that is too long can not be equal to any transactionId that is looked up
+        if (!transaction_id.has_value() or transaction_id.value().size() > 36) {
+            return;
+        }
+        const CiString<36> key(transaction_id.value());
+        if (queued) {
+            this->queued_transaction_events[key]++;
+            return;
+        }
+        const auto it = this->queued_transaction_events.find(key);
+        if (it != this->queued_transaction_events.end() and --it->second == 0) {
+            this->queued_transaction_events.erase(it);
+        }
+    }
+
     void add_to_transaction_message_queue(std::shared_ptr<ControlMessage<M>> message) {
         EVLOG_debug << "Adding message to transaction message queue";
         {
             std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
             this->transaction_message_queue.push_back(message);
-            ocpp::common::DBTransactionMessage db_message{message->message, messagetype_to_string(message->messageType),
+            this->count_queued_transaction_event(*message, true);
+            ocpp::common::DBTransactionMessage db_message{nullptr, messagetype_to_string(message->messageType),
                                                           message->message_attempts, message->timestamp,
-                                                          message->uniqueId()};
+                                                          message->uniqueId(), message->serialized_message()};
             try {
                 this->database_handler->insert_message_queue_message(db_message);
             } catch (const QueryExecutionException& e) {
@@ -286,6 +821,323 @@ private:
         EVLOG_debug << "Notified message queue worker";
     }
 
+    // Adds the messages of the ingress to the message queues, must be called with the message_mutex held. The
+    // database operations of the messages are committed by commit_drained_messages()
+    void drain_ingress() {
+        while (auto pushed = this->ingress.pop()) {
+            auto& [message, queue_type, committed] = pushed.value();
+            if (committed.has_value()) {
+                this->uncommitted_messages.push_back(std::move(committed.value()));
+            }
+            if (message == nullptr) {
+                continue;
+            }
+            if (queue_type == QueueType::Transaction) {
+                this->add_to_transaction_message_queue(std::move(message));
+            } else if (!this->paused || this->resuming || this->config.check_queue(message->messageType) ||
+                       message->messageType == M::BootNotification) {
+                // all other messages are allowed to "jump the queue" to improve user experience
+                this->add_to_normal_message_queue(std::move(message));
+            } else {
+                // do not add a normal message to the queue if the queue is paused/offline
+                EnhancedMessage<M> enhanced_message;
+                enhanced_message.offline = true;
+                message->promise.set_value(enhanced_message);
+            }
+        }
+        if (!this->uncommitted_messages.empty()) {
+            // messages drained by another thread are committed by the worker
+            this->cv.notify_all();
+        }
+    }
+
+    // Commits the database operations of all drained messages in one database transaction and releases the threads
+    // waiting for them in wait_for_commit(), so that concurrent producers share one commit. Must be called with the
+    // message_mutex held by \p lk, which is released while committing
+    void commit_drained_messages(std::unique_lock<std::recursive_mutex>& lk) {
+        if (this->uncommitted_messages.empty()) {
+            return;
+        }
+        auto committed_messages = std::move(this->uncommitted_messages);
+        this->uncommitted_messages.clear();
+        lk.unlock();
+        try {
+            this->database_handler->flush_message_queue_operations();
+        } catch (const std::exception& e) {
+            // the database handler keeps the operations and retries to commit them after its flush latency
+            EVLOG_warning << "Could not commit message queue operations: " << e.what();
+        }
+        for (auto& committed : committed_messages) {
+            committed.set_value();
+        }
+        lk.lock();
+    }
+
+    // Waits until the message belonging to \p committed has been added to the message queues and committed to the
+    // database. This is done by the worker thread, or by the calling thread if the worker is not running, e.g. before
+    // start() or after stop()
+    void wait_for_commit(std::future<void>& committed) {
+        // pairs with the fence in stop(): either stop() drains the pushed message or this thread sees that the worker
+        // does not commit anymore
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (std::this_thread::get_id() == this->worker_thread_id.load()) {
+            // the worker itself pushed the message, it is committed with its next iteration
+            return;
+        }
+        if (!this->worker_commits.load()) {
+            std::unique_lock<std::recursive_mutex> lk(this->message_mutex);
+            this->drain_ingress();
+            this->commit_drained_messages(lk);
+        }
+        committed.wait();
+    }
+
+    // Waits until the worker has added all messages that have been pushed so far to the message queues
+    void wait_for_worker() {
+        std::promise<void> drained;
+        auto future = drained.get_future();
+        this->ingress.push({nullptr, QueueType::None, std::move(drained)});
+        this->notify_worker_of_ingress();
+        this->wait_for_commit(future);
+    }
+
+    void push_to_ingress(std::shared_ptr<ControlMessage<M>> message, const QueueType queue_type) {
+        this->ingress.push({std::move(message), queue_type, std::nullopt});
+        this->notify_worker_of_ingress();
+    }
+
+    // Writes \p message with its generated write_json into the writer of the calling thread, which keeps its buffer
+    // across messages. The text is returned as a copy because it has to outlive the next message written by this
+    // thread, e.g. while the message is queued or if send_callback pushes another message
+    template <class T> static std::string write_message(const T& message) {
+        static thread_local JsonWriter writer;
+        writer.clear();
+        write_json(writer, message);
+        return writer.str();
+    }
+
+    // Pushes the transaction related \p message to the ingress and waits until the worker has committed it to the
+    // database, so that it survives a crash once push() or push_async() returns. The pushing thread does not access the
+    // database itself, messages pushed while the worker commits are committed together with its next iteration
+    void push_transaction_message(std::shared_ptr<ControlMessage<M>> message) {
+        std::promise<void> committed;
+        auto future = committed.get_future();
+        this->ingress.push({std::move(message), QueueType::Transaction, std::move(committed)});
+        this->notify_worker_of_ingress();
+        this->wait_for_commit(future);
+    }
+
+    void notify_worker_of_ingress() {
+        // pairs with the fence in the wait predicate of the worker: either the worker sees the pushed message before it
+        // waits or this thread sees that the worker is waiting and wakes it up
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (this->worker_waiting.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+            this->cv.notify_all();
+        }
+    }
+
+    /// \brief pushes the new \p control_message onto the message queue
+    void push_control_message(std::shared_ptr<ControlMessage<M>> control_message) {
+        if (is_transaction_message(*control_message)) {
+            // according to the spec the "transaction related messages" StartTransaction, StopTransaction and
+            // MeterValues have to be delivered in chronological order
+
+            // intentionally break this message for testing...
+            // message->message[CALL_PAYLOAD]["broken"] = this->createMessageId();
+            this->push_transaction_message(std::move(control_message));
+        } else {
+            // whether the message is queued or dropped because the queue is paused is decided when the ingress is
+            // drained, so that it is consistent with the state of the worker
+            this->push_to_ingress(std::move(control_message), QueueType::Normal);
+        }
+    }
+
+    PersistedMessagesReplay& get_persisted_messages_replay(const QueueType queue_type) {
+        return queue_type == QueueType::Normal ? this->normal_messages_replay : this->transaction_messages_replay;
+    }
+
+    std::shared_ptr<ControlMessage<M>> restore_persisted_message(const common::DBTransactionMessage& persisted_message,
+                                                                 const QueueType queue_type) {
+        if (this->ignore_security_event_notifications &&
+            persisted_message.message_type == "SecurityEventNotification") {
+            try {
+                // remove from database in case SecurityEventNotification.req should not be sent
+                this->database_handler->remove_message_queue_message(persisted_message.unique_id, queue_type);
+            } catch (const QueryExecutionException& e) {
+                EVLOG_warning << "Could not delete message from message queue: " << e.what();
+            } catch (const std::exception& e) {
+                EVLOG_warning << "Could not delete message from message queue: " << e.what();
+            }
+            return nullptr;
+        }
+        try {
+            auto message = std::make_shared<ControlMessage<M>>(json::parse(*persisted_message.serialized_message));
+            message->messageType = string_to_messagetype(persisted_message.message_type);
+            message->timestamp = persisted_message.timestamp;
+            message->message_attempts = persisted_message.message_attempts;
+            message->replayed = true;
+            return message;
+        } catch (const std::exception& e) {
+            EVLOG_error << "Could not restore persisted message " << persisted_message.unique_id << ": " << e.what();
+            return nullptr;
+        }
+    }
+
+    // Restores the next batch of persisted messages of the given queue. If the batch can not be read from the
+    // database, the replay is left unchanged so that it is retried on the next wake-up of the worker
+    // \returns false if the batch could not be read from the database
+    bool replay_persisted_messages(const QueueType queue_type) {
+        auto& replay = this->get_persisted_messages_replay(queue_type);
+        if (replay.position >= replay.end) {
+            return true;
+        }
+        std::vector<common::DBTransactionMessage> persisted_messages;
+        try {
+            persisted_messages = this->database_handler->get_message_queue_messages_page(
+                queue_type, replay.position, replay.end,
+                static_cast<size_t>(std::max(this->config.persisted_messages_replay_batch_size, 1)));
+        } catch (const QueryExecutionException& e) {
+            EVLOG_warning << "Could not get persisted messages from database: " << e.what();
+            return false;
+        }
+        if (persisted_messages.empty()) {
+            replay.position = replay.end;
+            return true;
+        }
+        replay.position = persisted_messages.back().position;
+
+        // restored transaction related messages are sent before the ones that have been pushed since the restart
+        auto transaction_message_it =
+            std::find_if(this->transaction_message_queue.begin(), this->transaction_message_queue.end(),
+                         [](const std::shared_ptr<ControlMessage<M>>& message) { return !message->replayed; });
+        for (const auto& persisted_message : persisted_messages) {
+            auto message = this->restore_persisted_message(persisted_message, queue_type);
+            if (message == nullptr) {
+                continue;
+            }
+            if (queue_type == QueueType::Normal) {
+                this->normal_message_queue.push_replayed(message, this->get_scheduling_class(message->messageType),
+                                                         this->get_coalescing_key(*message));
+            } else {
+                transaction_message_it =
+                    std::next(this->transaction_message_queue.insert(transaction_message_it, message));
+                this->count_queued_transaction_event(*message, true);
+                this->uncount_persisted_transaction_id(*message);
+            }
+        }
+        this->new_message = true;
+        return true;
+    }
+
+    // Without queue_all_messages the messages of the normal message queue table are not removed when they have been
+    // sent, so all of them are restored at once and the table is cleared afterwards. If not all messages could be
+    // restored, the table is kept and this is retried on the next wake-up of the worker
+    void replay_and_clear_normal_message_queue() {
+        auto& replay = this->normal_messages_replay;
+        if (replay.end == 0) {
+            return;
+        }
+        while (replay.position < replay.end) {
+            if (!this->replay_persisted_messages(QueueType::Normal)) {
+                return;
+            }
+        }
+        try {
+            this->database_handler->clear_message_queue(QueueType::Normal);
+        } catch (const QueryExecutionException& e) {
+            EVLOG_warning << "Could not clear normal message queue table: " << e.what();
+            return;
+        }
+        replay.position = 0;
+        replay.end = 0;
+    }
+
+    // Restores the next batch of persisted messages of a queue once all restored messages of that queue have been sent
+    void replay_next_persisted_messages() {
+        if (this->transaction_message_queue.empty() or !this->transaction_message_queue.front()->replayed) {
+            this->replay_persisted_messages(QueueType::Transaction);
+        }
+        if (!this->config.queue_all_messages) {
+            this->replay_and_clear_normal_message_queue();
+        } else if (!this->normal_message_queue.contains_replayed()) {
+            this->replay_persisted_messages(QueueType::Normal);
+        }
+    }
+
+    // Reads the number of persisted transaction related messages of the given \p message_type per transactionId that
+    // have not been restored yet from the database
+    // \returns std::nullopt if the messages could not be read from the database
+    std::optional<CiStringMap<36, size_t>> read_persisted_transaction_ids(const M message_type) {
+        CiStringMap<36, size_t> transaction_ids;
+        const auto& replay = this->transaction_messages_replay;
+        auto position = replay.position;
+        while (position < replay.end) {
+            std::vector<common::DBTransactionMessage> persisted_messages;
+            try {
+                persisted_messages = this->database_handler->get_message_queue_messages_page(
+                    QueueType::Transaction, position, replay.end,
+                    static_cast<size_t>(std::max(this->config.persisted_messages_replay_batch_size, 1)),
+                    messagetype_to_string(message_type));
+            } catch (const QueryExecutionException& e) {
+                EVLOG_warning << "Could not get persisted messages from database: " << e.what();
+                return std::nullopt;
+            }
+            if (persisted_messages.empty()) {
+                break;
+            }
+            position = persisted_messages.back().position;
+            for (const auto& persisted_message : persisted_messages) {
+                try {
+                    const ControlMessage<M> message(json::parse(*persisted_message.serialized_message));
+                    const auto transaction_id = message.transaction_id();
+                    if (transaction_id.has_value() and transaction_id.value().size() <= 36) {
+                        transaction_ids[CiString<36>(transaction_id.value())]++;
+                    }
+                } catch (const std::exception& e) {
+                    EVLOG_warning << "Could not parse persisted message " << persisted_message.unique_id << ": "
+                                  << e.what();
+                }
+            }
+        }
+        return transaction_ids;
+    }
+
+    // Returns true if a persisted transaction related message of the given \p message_type and \p transaction_id has
+    // not been restored yet. Only the first lookup of a message type reads the persisted messages from the database
+    bool contains_persisted_transaction_id(const M message_type, const std::string& transaction_id) {
+        // a transactionId that is too long can not be equal to any transactionId that has been counted
+        if (transaction_id.size() > 36) {
+            return false;
+        }
+        auto transaction_ids = this->persisted_transaction_ids.find(message_type);
+        if (transaction_ids == this->persisted_transaction_ids.end()) {
+            auto read_transaction_ids = this->read_persisted_transaction_ids(message_type);
+            if (!read_transaction_ids.has_value()) {
+                return false;
+            }
+            transaction_ids =
+                this->persisted_transaction_ids.emplace(message_type, std::move(read_transaction_ids.value())).first;
+        }
+        return transaction_ids->second.count(CiString<36>(transaction_id)) > 0;
+    }
+
+    // Updates persisted_transaction_ids for the persisted transaction related \p message that has been restored
+    void uncount_persisted_transaction_id(const ControlMessage<M>& message) {
+        const auto transaction_ids = this->persisted_transaction_ids.find(message.messageType);
+        if (transaction_ids == this->persisted_transaction_ids.end()) {
+            return;
+        }
+        const auto transaction_id = message.transaction_id();
+        if (!transaction_id.has_value() or transaction_id.value().size() > 36) {
+            return;
+        }
+        const auto it = transaction_ids->second.find(CiString<36>(transaction_id.value()));
+        if (it != transaction_ids->second.end() and --it->second == 0) {
+            transaction_ids->second.erase(it);
+        }
+    }
+
     void check_queue_sizes() {
         if (this->transaction_message_queue.size() + this->normal_message_queue.size() <=
             this->config.queues_total_size_threshold) {
@@ -295,86 +1147,131 @@ private:
                       << this->transaction_message_queue.size() << " transaction and "
                       << this->normal_message_queue.size() << " normal messages in queue";
 
-        while (this->transaction_message_queue.size() + this->normal_message_queue.size() >
-                   this->config.queues_total_size_threshold &&
-               !this->normal_message_queue.empty()) {
-            this->drop_messages_from_normal_message_queue();
+        // messages are dropped in chunks of approx 10% of the allowed size (at least 1), so that the queues are not
+        // thinned again on every message that is added while offline
+        const size_t chunk_size = std::max(this->config.queues_total_size_threshold / 10, 1);
+        const auto number_of_messages_to_drop = [this, chunk_size]() -> size_t {
+            const size_t total_size = this->transaction_message_queue.size() + this->normal_message_queue.size();
+            const size_t threshold = std::max(this->config.queues_total_size_threshold, 0);
+            if (total_size <= threshold) {
+                return 0;
+            }
+            return (total_size - threshold + chunk_size - 1) / chunk_size * chunk_size;
+        };
+
+        if (!this->normal_message_queue.empty()) {
+            this->drop_messages_from_normal_message_queue(
+                std::min(number_of_messages_to_drop(), this->normal_message_queue.size()));
         }
 
-        while (this->transaction_message_queue.size() + this->normal_message_queue.size() >
-                   this->config.queues_total_size_threshold &&
-               this->drop_update_messages_from_transactional_message_queue()) {
+        if (number_of_messages_to_drop() > 0) {
+            this->thin_transaction_message_queue(number_of_messages_to_drop());
         }
     }
 
-    void drop_messages_from_normal_message_queue() {
-        // try to drop approx 10% of the allowed size (at least 1)
-        int number_of_dropped_messages = std::min((int)this->normal_message_queue.size(),
-                                                  std::max(this->config.queues_total_size_threshold / 10, 1));
-
+    void drop_messages_from_normal_message_queue(const size_t number_of_dropped_messages) {
         EVLOG_warning << "Dropping " << number_of_dropped_messages << " messages from normal message queue.";
 
-        for (int i = 0; i < number_of_dropped_messages; i++) {
-            if (this->config.queue_all_messages) {
-                try {
-                    database_handler->remove_message_queue_message(
-                        this->normal_message_queue.front()->initial_unique_id, QueueType::Normal);
-                } catch (const QueryExecutionException& e) {
-                    EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
-                } catch (const std::exception& e) {
-                    EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
-                }
-            }
+        std::vector<std::string> dropped_message_ids;
+        for (size_t i = 0; i < number_of_dropped_messages; i++) {
+            dropped_message_ids.push_back(this->normal_message_queue.front()->initial_unique_id);
             this->normal_message_queue.pop_front();
         }
+
+        if (this->config.queue_all_messages) {
+            try {
+                database_handler->remove_message_queue_messages(dropped_message_ids, QueueType::Normal);
+            } catch (const QueryExecutionException& e) {
+                EVLOG_warning << "Could not delete messages from normal queue: " << e.what();
+            } catch (const std::exception& e) {
+                EVLOG_warning << "Could not delete messages from normal queue: " << e.what();
+            }
+        }
     }
 
     /**
-     *  Heuristically drops every second update messag.
-     *  Drops every first, third, ... update message in between two non-update message; disregards transaction
-     * ids etc!
+     * Drops at least \p number_of_messages_to_drop transaction update messages in a single pass, if there are enough
+     * update messages that may be dropped.
+     * The update messages are grouped per transaction and every transaction is downsampled by the same ratio, evenly
+     * spread over its updates. The first and the last update of a transaction as well as updates that contain signed
+     * meter values are always kept.
      * Cf. OCPP 2.0.1. specification 2.1.9 "QueueAllMessages"
+     * \returns the number of dropped messages
      */
-    bool drop_update_messages_from_transactional_message_queue() {
-        int drop_count = 0;
-        std::deque<std::shared_ptr<ControlMessage<M>>> temporary_swap_queue;
-        bool remove_next_update_message = true;
-        while (!transaction_message_queue.empty()) {
-            auto element = transaction_message_queue.front();
-            transaction_message_queue.pop_front();
-            // drop every second update message (except last one)
-            if (remove_next_update_message && element->is_transaction_update_message() &&
-                transaction_message_queue.size() > 1) {
-                EVLOG_debug << "Drop transactional message " << element->initial_unique_id;
-                try {
-                    database_handler->remove_message_queue_message(element->initial_unique_id);
-                } catch (const QueryExecutionException& e) {
-                    EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
-                } catch (const std::exception& e) {
-                    EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
-                }
-                drop_count++;
-                remove_next_update_message = false;
-            } else {
-                remove_next_update_message = true;
-                temporary_swap_queue.push_back(element);
+    size_t thin_transaction_message_queue(const size_t number_of_messages_to_drop) {
+        // positions of the update messages within the transaction message queue, grouped per transaction
+        std::map<std::optional<std::string>, std::vector<size_t>> update_messages;
+        for (size_t i = 0; i < this->transaction_message_queue.size(); i++) {
+            const auto& message = *this->transaction_message_queue[i];
+            if (message.is_transaction_update_message()) {
+                update_messages[message.transaction_id()].push_back(i);
             }
         }
 
-        std::swap(transaction_message_queue, temporary_swap_queue);
+        // updates that may be dropped, grouped per transaction
+        std::vector<std::vector<size_t>> droppable_messages;
+        size_t number_of_droppable_messages = 0;
+        for (const auto& [transaction_id, positions] : update_messages) {
+            std::vector<size_t> droppable;
+            for (size_t i = 1; i + 1 < positions.size(); i++) {
+                if (!this->transaction_message_queue[positions[i]]->contains_signed_meter_values()) {
+                    droppable.push_back(positions[i]);
+                }
+            }
+            number_of_droppable_messages += droppable.size();
+            droppable_messages.push_back(std::move(droppable));
+        }
 
-        if (drop_count > 0) {
-            EVLOG_warning << "Dropped " << drop_count << " transactional update messages to reduce queue size.";
-            return true;
-        } else {
+        if (number_of_droppable_messages == 0) {
             EVLOG_warning << "There are no further transaction update messages to drop!";
-            return false;
+            return 0;
+        }
+
+        const size_t number_to_drop = std::min(number_of_messages_to_drop, number_of_droppable_messages);
+        std::vector<bool> drop(this->transaction_message_queue.size(), false);
+        for (const auto& droppable : droppable_messages) {
+            // round up so that at least number_to_drop messages are dropped in total
+            const size_t drop_count =
+                (droppable.size() * number_to_drop + number_of_droppable_messages - 1) / number_of_droppable_messages;
+            const size_t keep_count = droppable.size() - drop_count;
+            for (size_t i = 0; i < droppable.size(); i++) {
+                // keep the message if it starts a new keep_count-th of the droppable messages
+                if ((i + 1) * keep_count / droppable.size() == i * keep_count / droppable.size()) {
+                    drop[droppable[i]] = true;
+                }
+            }
+        }
+
+        std::deque<std::shared_ptr<ControlMessage<M>>> thinned_queue;
+        std::vector<std::string> dropped_message_ids;
+        for (size_t i = 0; i < this->transaction_message_queue.size(); i++) {
+            if (drop[i]) {
+                EVLOG_debug << "Drop transactional message " << this->transaction_message_queue[i]->initial_unique_id;
+                dropped_message_ids.push_back(this->transaction_message_queue[i]->initial_unique_id);
+                this->count_queued_transaction_event(*this->transaction_message_queue[i], false);
+            } else {
+                thinned_queue.push_back(std::move(this->transaction_message_queue[i]));
+            }
+        }
+        std::swap(this->transaction_message_queue, thinned_queue);
+
+        try {
+            database_handler->remove_message_queue_messages(dropped_message_ids, QueueType::Transaction);
+        } catch (const QueryExecutionException& e) {
+            EVLOG_warning << "Could not delete messages from transaction queue: " << e.what();
+        } catch (const std::exception& e) {
+            EVLOG_warning << "Could not delete messages from transaction queue: " << e.what();
         }
+
+        EVLOG_warning << "Dropped " << dropped_message_ids.size()
+                      << " transactional update messages to reduce queue size.";
+        return dropped_message_ids.size();
     }
 
     // The public resume() delegates the actual resumption to this method
     void resume_now(u_int64_t expected_pause_resume_ctr) {
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+        this->drain_ingress();
         if (this->pause_resume_ctr == expected_pause_resume_ctr) {
             this->paused = false;
             this->resuming = false;
@@ -389,36 +1286,156 @@ private:
                                     (this->config.transaction_message_retry_interval * attempt));
     }
 
+    // Returns true if another CALL may be sent without exceeding the configured in-flight window
+    bool in_flight_window_available() {
+        if (this->in_flight.empty()) {
+            return true;
+        }
+        if (this->in_flight.size() >= static_cast<size_t>(std::max(this->config.max_messages_in_flight, 1))) {
+            return false;
+        }
+        // a BootNotification.req is never pipelined with other messages
+        return std::none_of(this->in_flight.begin(), this->in_flight.end(), [](const auto& entry) {
+            return is_boot_notification_message(entry.second->messageType);
+        });
+    }
+
+    // Returns true if a transaction related message is awaiting a response. Transaction related messages have to be
+    // delivered in chronological order, so only one of them is in flight at any time
+    bool transaction_message_in_flight() {
+        return std::any_of(this->in_flight.begin(), this->in_flight.end(),
+                           [](const auto& entry) { return is_transaction_message(*entry.second); });
+    }
+
+    // Arms the in-flight timeout timer for the in-flight message that times out next
+    void update_in_flight_timeout_timer() {
+        if (this->in_flight.empty()) {
+            this->in_flight_timeout_timer->stop();
+            return;
+        }
+        const auto next_deadline = std::min_element(this->in_flight.begin(), this->in_flight.end(),
+                                                    [](const auto& lhs, const auto& rhs) {
+                                                        return lhs.second->in_flight_deadline <
+                                                               rhs.second->in_flight_deadline;
+                                                    })
+                                       ->second->in_flight_deadline;
+        const auto now = std::chrono::steady_clock::now();
+        this->in_flight_timeout_timer->timeout([this]() { this->handle_in_flight_timeouts(); },
+                                               next_deadline > now ? next_deadline - now
+                                                                   : std::chrono::steady_clock::duration::zero());
+    }
+
+    // Handles all in-flight messages whose timeout elapsed
+    void handle_in_flight_timeouts() {
+        std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+        const auto now = std::chrono::steady_clock::now();
+        std::vector<MessageId> timed_out_message_ids;
+        for (const auto& [unique_id, message] : this->in_flight) {
+            if (message->in_flight_deadline <= now) {
+                timed_out_message_ids.push_back(unique_id);
+            }
+        }
+        for (const auto& unique_id : timed_out_message_ids) {
+            this->handle_timeout_or_callerror(unique_id, std::nullopt);
+        }
+        this->update_in_flight_timeout_timer();
+    }
+
+    // Removes the message with the given \p unique_id from the in-flight messages
+    // \returns the removed message or nullptr if no such message is in flight
+    std::shared_ptr<ControlMessage<M>> take_in_flight(const MessageId& unique_id) {
+        auto it = this->in_flight.find(unique_id);
+        if (it == this->in_flight.end()) {
+            return nullptr;
+        }
+        auto message = it->second;
+        this->in_flight.erase(it);
+        this->update_in_flight_timeout_timer();
+        if (!this->transaction_message_queue.empty() || !this->normal_message_queue.empty()) {
+            // the in-flight window has room again, so the worker shall check the queues
+            this->new_message = true;
+        }
+        return message;
+    }
+
+    // Arms the notify queue timer for the earliest point in time at which a queued message that is not allowed to be
+    // sent yet becomes sendable. Messages that are already sendable but held back, e.g. by a transaction related
+    // message or a BootNotification.req in flight, are not considered: the response or timeout of the message in flight
+    // wakes up the worker (cf. take_in_flight), waking it up earlier would only make it spin
+    void schedule_queue_wakeup() {
+        std::optional<typename ScheduledMessageQueue<M>::TimePoint> next_send_time =
+            this->normal_message_queue.next_send_time();
+        if (!this->transaction_message_queue.empty() and !this->transaction_message_in_flight()) {
+            const auto& message = *this->transaction_message_queue.front();
+            if (!message.stall_until_accepted or this->is_registration_status_accepted) {
+                const auto transaction_send_time = message.timestamp.to_time_point();
+                if (transaction_send_time > date::utc_clock::now() and
+                    (!next_send_time.has_value() or transaction_send_time < next_send_time.value())) {
+                    next_send_time = transaction_send_time;
+                }
+            }
+        }
+        if (!next_send_time.has_value()) {
+            this->notify_queue_timer->stop();
+            return;
+        }
+        const auto delay = next_send_time.value() - date::utc_clock::now();
+        this->notify_queue_timer->timeout(
+            [this]() {
+                {
+                    std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+                    this->new_message = true;
+                }
+                this->cv.notify_all();
+            },
+            std::max(std::chrono::duration_cast<std::chrono::steady_clock::duration>(delay),
+                     std::chrono::steady_clock::duration::zero()));
+    }
+
 public:
     /// \brief Creates a new MessageQueue object with the provided \p configuration and \p send_callback
+    /// The timers of the queue run on \p io_context if one is given, e.g. the io_service of the charging station, and
+    /// on threads of their own otherwise
     MessageQueue(
-        const std::function<bool(json message)>& send_callback, const MessageQueueConfig<M>& config,
+        const std::function<bool(const std::string& message)>& send_callback, const MessageQueueConfig<M>& config,
         const std::vector<M>& external_notify, std::shared_ptr<common::DatabaseHandlerCommon> database_handler,
         const std::function<void(const std::string& new_message_id, const std::string& old_message_id)>
             start_transaction_message_retry_callback =
-                [](const std::string& new_message_id, const std::string& old_message_id) {}) :
+                [](const std::string& new_message_id, const std::string& old_message_id) {},
+        boost::asio::io_context* io_context = nullptr) :
         database_handler(std::move(database_handler)),
         config(config),
         external_notify(external_notify),
+        worker_commits(false),
+        worker_waiting(false),
         paused(true),
         resuming(false),
         running(true),
         new_message(false),
         is_registration_status_accepted(false),
         uuid_generator(boost::uuids::random_generator()),
+        in_flight_timeout_timer(make_steady_timer(io_context)),
+        notify_queue_timer(make_steady_timer(io_context)),
+        resume_timer(make_steady_timer(io_context)),
         start_transaction_message_retry_callback(start_transaction_message_retry_callback) {
 
         this->send_callback = send_callback;
-        this->in_flight = nullptr;
+        this->normal_message_queue.configure_scheduling(this->config.weighted_fair_scheduling,
+                                                        this->config.scheduling_class_weights);
     }
 
-    MessageQueue(const std::function<bool(json message)>& send_callback, const MessageQueueConfig<M>& config,
-                 std::shared_ptr<common::DatabaseHandlerCommon> databaseHandler) :
-        MessageQueue(send_callback, config, {}, databaseHandler) {
+    MessageQueue(const std::function<bool(const std::string& message)>& send_callback,
+                 const MessageQueueConfig<M>& config, std::shared_ptr<common::DatabaseHandlerCommon> databaseHandler,
+                 boost::asio::io_context* io_context = nullptr) :
+        MessageQueue(
+            send_callback, config, {}, databaseHandler,
+            [](const std::string& new_message_id, const std::string& old_message_id) {}, io_context) {
     }
 
     void start() {
+        this->worker_commits = true;
         this->worker_thread = std::thread([this]() {
+            this->worker_thread_id = std::this_thread::get_id();
             // TODO(kai): implement message timeout
             while (this->running) {
                 EVLOG_debug << "Waiting for a message from the message queue";
@@ -427,8 +1444,16 @@ public:
                 using namespace std::chrono_literals;
                 // It's safe to wait on the cv here because we're guaranteed to only lock this->message_mutex once
                 this->cv.wait(lk, [this]() {
-                    return !this->running || (!this->paused && this->new_message && this->in_flight == nullptr);
+                    this->worker_waiting.store(true, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    return !this->running || !this->ingress.empty() || !this->uncommitted_messages.empty() ||
+                           (!this->paused && this->new_message && this->in_flight_window_available());
                 });
+                this->worker_waiting.store(false, std::memory_order_relaxed);
+                this->worker_wakeups++;
+                this->drain_ingress();
+                this->commit_drained_messages(lk);
+                this->replay_next_persisted_messages();
                 if (this->transaction_message_queue.empty() && this->normal_message_queue.empty()) {
                     // There is nothing in the message queue, not progressing further
                     continue;
@@ -443,27 +1468,25 @@ public:
                     continue;
                 }
 
-                if (this->in_flight != nullptr) {
-                    // There already is a message in flight, not progressing further
+                if (!this->in_flight_window_available()) {
+                    // The in-flight window is exhausted, not progressing further
                     continue;
                 } else {
-                    EVLOG_debug << "There is no message in flight, checking message queue for a new message.";
+                    EVLOG_debug << "There are " << this->in_flight.size()
+                                << " messages in flight, checking message queue for a new message.";
                 }
 
                 // prioritize the message with the oldest timestamp
                 std::shared_ptr<ControlMessage<M>> message = nullptr;
                 QueueType queue_type = QueueType::None;
                 const auto now = DateTime();
+                const bool pipelining = !this->in_flight.empty();
 
                 // Find the first allowed normal message
-                auto selected_normal_message_it =
-                    std::find_if(normal_message_queue.begin(), normal_message_queue.end(),
-                                 [&](const std::shared_ptr<ControlMessage<M>>& msg) {
-                                     return allowed_to_send_message(*msg, now, this->is_registration_status_accepted);
-                                 });
-
-                if (selected_normal_message_it != normal_message_queue.end()) {
-                    message = *selected_normal_message_it;
+                const auto selected_normal_message_key = this->normal_message_queue.next_ready(now.to_time_point());
+
+                if (selected_normal_message_key.has_value()) {
+                    message = this->normal_message_queue.at(selected_normal_message_key.value());
                     queue_type = QueueType::Normal;
                 }
 
@@ -471,12 +1494,23 @@ public:
                     if (!allowed_to_send_message(*msg, now, this->is_registration_status_accepted)) {
                         return false;
                     }
+                    // transaction messages must be delivered in order, so wait for the response of the one in flight
+                    if (this->transaction_message_in_flight()) {
+                        return false;
+                    }
                     // no message selected from normal message queue, so select transaction message
                     if (message == nullptr) {
                         return true;
                     }
                     // message from normal message queue is BootNotification, this is prioritized
-                    if (message->messageType == M::BootNotification) {
+                    if (is_boot_notification_message(message->messageType)) {
+                        return false;
+                    }
+                    // message from normal message queue is of the highest scheduling class and configured to be sent
+                    // before transaction messages
+                    if (this->config.high_priority_messages_before_transaction_messages and
+                        this->normal_message_queue.scheduling_class(selected_normal_message_key.value()) ==
+                            MessageSchedulingClass::High) {
                         return false;
                     }
                     // transaction messages is older than normal message, so select transaction message
@@ -498,9 +1532,15 @@ public:
                     queue_type = QueueType::Transaction;
                 }
 
+                if (message != nullptr && pipelining && is_boot_notification_message(message->messageType)) {
+                    // a BootNotification.req is only sent once all other messages have been responded to
+                    message = nullptr;
+                }
+
                 if (message == nullptr) {
                     EVLOG_debug << "No message in queue ready to be sent yet";
                     this->new_message = false;
+                    this->schedule_queue_wakeup();
                     continue;
                 }
 
@@ -518,26 +1558,27 @@ public:
 
                 EVLOG_debug << "Attempting to send message to central system. UID: " << message->uniqueId()
                             << " attempt#: " << message->message_attempts;
-                this->in_flight = message;
-                this->in_flight->message_attempts += 1;
+                message->message_attempts += 1;
 
-                if (this->message_id_transaction_id_map.count(this->in_flight->message.at(1))) {
+                if (this->message_id_transaction_id_map.count(message->uniqueId())) {
                     EVLOG_debug << "Replacing transaction id";
-                    this->in_flight->message.at(3)["transactionId"] =
-                        this->message_id_transaction_id_map.at(this->in_flight->message.at(1));
-                    this->message_id_transaction_id_map.erase(this->in_flight->message.at(1));
+                    message->json_message().at(CALL_PAYLOAD)["transactionId"] =
+                        this->message_id_transaction_id_map.at(message->uniqueId());
+                    message->invalidate_serialized_message();
+                    this->message_id_transaction_id_map.erase(message->uniqueId());
                 }
 
-                if (!this->send_callback(this->in_flight->message)) {
+                if (!this->send_callback(*message->serialized_message())) {
                     this->paused = true;
                     EVLOG_error << "Could not send message, this is most likely because the charge point is offline.";
-                    if (this->in_flight && is_transaction_message(*this->in_flight)) {
+                    if (is_transaction_message(*message)) {
                         EVLOG_info << "The message in flight is transaction related and will be sent again once the "
                                       "connection can be established again.";
-                        if (this->in_flight->message.at(CALL_ACTION) == "TransactionEvent") {
-                            this->in_flight->message.at(CALL_PAYLOAD)["offline"] = true;
+                        if (messagetype_to_string(message->messageType) == "TransactionEvent") {
+                            message->json_message().at(CALL_PAYLOAD)["offline"] = true;
+                            message->invalidate_serialized_message();
                         }
-                    } else if (this->config.check_queue(this->in_flight->messageType)) {
+                    } else if (this->config.check_queue(message->messageType)) {
                         EVLOG_info << "The message in flight  will be sent again once the connection can be "
                                       "established again since QueueAllMessages is set to 'true'.";
                     } else {
@@ -545,27 +1586,30 @@ public:
                         if (queue_type == QueueType::Normal) {
                             EnhancedMessage<M> enhanced_message;
                             enhanced_message.offline = true;
-                            this->in_flight->promise.set_value(enhanced_message);
-                            this->normal_message_queue.pop_front();
+                            message->promise.set_value(enhanced_message);
+                            this->normal_message_queue.erase(selected_normal_message_key.value());
                         }
                     }
-                    this->reset_in_flight();
                 } else {
-                    EVLOG_debug << "Successfully sent message. UID: " << this->in_flight->uniqueId();
-                    this->in_flight_timeout_timer.timeout([this]() { this->handle_timeout_or_callerror(std::nullopt); },
-                                                          this->current_message_timeout(message->message_attempts));
+                    EVLOG_debug << "Successfully sent message. UID: " << message->uniqueId();
+                    message->in_flight_deadline =
+                        std::chrono::steady_clock::now() + this->current_message_timeout(message->message_attempts);
+                    this->in_flight[message->uniqueId()] = message;
+                    this->update_in_flight_timeout_timer();
                     switch (queue_type) {
                     case QueueType::Normal:
-                        this->normal_message_queue.erase(selected_normal_message_it);
+                        this->normal_message_queue.take(selected_normal_message_key.value());
                         break;
                     case QueueType::Transaction:
                         this->transaction_message_queue.erase(selected_transaction_message_it);
+                        this->count_queued_transaction_event(*message, false);
                         break;
 
                     default:
                         break;
                     }
                 }
+                this->replay_next_persisted_messages();
                 if (this->transaction_message_queue.empty() && this->normal_message_queue.empty()) {
                     this->new_message = false;
                 }
@@ -582,49 +1626,27 @@ public:
         this->next_message_to_send.reset();
     }
 
-    /// \brief Gets all persisted messages of normal message queue and persisted message queue from the database
+    /// \brief Prepares the replay of the persisted messages of the normal message queue and the transaction message
+    /// queue. The persisted messages are restored from the database in batches as they are sent, so the message queue
+    /// can be started right away, also with a large backlog of persisted messages
     void get_persisted_messages_from_db(bool ignore_security_event_notifications = false) {
-        std::vector<QueueType> queue_types = {QueueType::Normal, QueueType::Transaction};
-        // do for Normal and Transaction queue
-        for (const auto queue_type : queue_types) {
-            const auto persisted_messages = database_handler->get_message_queue_messages(queue_type);
-            if (!persisted_messages.empty()) {
-                for (auto& persisted_message : persisted_messages) {
-
-                    if (ignore_security_event_notifications &&
-                        persisted_message.message_type == "SecurityEventNotification") {
-                        try {
-                            // remove from database in case SecurityEventNotification.req should not be sent
-                            this->database_handler->remove_message_queue_message(persisted_message.unique_id,
-                                                                                 queue_type);
-                        } catch (const QueryExecutionException& e) {
-                            EVLOG_warning << "Could not delete message from message queue: " << e.what();
-                        } catch (const std::exception& e) {
-                            EVLOG_warning << "Could not delete message from message queue: " << e.what();
-                        }
-                    } else {
-                        std::shared_ptr<ControlMessage<M>> message =
-                            std::make_shared<ControlMessage<M>>(persisted_message.json_message);
-                        message->messageType = string_to_messagetype(persisted_message.message_type);
-                        message->timestamp = persisted_message.timestamp;
-                        message->message_attempts = persisted_message.message_attempts;
-
-                        if (queue_type == QueueType::Normal) {
-                            normal_message_queue.push_back(message);
-                        } else if (queue_type == QueueType::Transaction) {
-                            transaction_message_queue.push_back(message);
-                        }
-                    }
+        {
+            std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+            this->ignore_security_event_notifications = ignore_security_event_notifications;
+            this->persisted_transaction_ids.clear();
+            for (const auto queue_type : {QueueType::Normal, QueueType::Transaction}) {
+                auto& replay = this->get_persisted_messages_replay(queue_type);
+                try {
+                    replay.position = 0;
+                    replay.end = this->database_handler->get_message_queue_end(queue_type);
+                } catch (const QueryExecutionException& e) {
+                    EVLOG_warning << "Could not get persisted messages from database: " << e.what();
                 }
-                this->new_message = true;
             }
-        }
 
-        if (!this->config.queue_all_messages) {
-            // make sure to clear normal message queue table in case queue_all_messages is false, since without clearing
-            // it here messages would not be removed in handle_call_result or handle_call_timeout_or_error
-            this->database_handler->clear_message_queue(QueueType::Normal);
+            this->replay_next_persisted_messages();
         }
+        this->cv.notify_all();
     }
 
     /// \brief pushes a new \p call message onto the message queue
@@ -632,8 +1654,10 @@ public:
         if (!running) {
             return;
         }
-        json call_json = call;
-        push(call_json, stall_until_accepted);
+        // only the text of the message is written, its json value is built by the queue if it is needed
+        this->push_control_message(std::make_shared<ControlMessage<M>>(
+            write_message(call), this->string_to_messagetype(call.msg.get_type()), call.uniqueId,
+            stall_until_accepted));
     }
 
     void push(const json& message, const bool stall_until_accepted = false) {
@@ -641,23 +1665,7 @@ public:
             return;
         }
 
-        auto control_message = std::make_shared<ControlMessage<M>>(message, stall_until_accepted);
-        if (is_transaction_message(*control_message)) {
-            // according to the spec the "transaction related messages" StartTransaction, StopTransaction and
-            // MeterValues have to be delivered in chronological order
-
-            // intentionally break this message for testing...
-            // message->message[CALL_PAYLOAD]["broken"] = this->createMessageId();
-            this->add_to_transaction_message_queue(control_message);
-        } else {
-            // all other messages are allowed to "jump the queue" to improve user experience
-            // TODO: decide if we only want to allow this for a subset of messages
-            if (!this->paused || this->resuming || this->config.check_queue(control_message->messageType) ||
-                control_message->messageType == M::BootNotification) {
-                this->add_to_normal_message_queue(control_message);
-            }
-        }
-        this->cv.notify_all();
+        this->push_control_message(std::make_shared<ControlMessage<M>>(message, stall_until_accepted));
     }
 
     /// \brief Sends a new \p call_result message over the websocket
@@ -666,7 +1674,8 @@ public:
             return;
         }
 
-        this->send_callback(call_result);
+        // call results are not queued, so they are written without building a json value
+        this->send_callback(write_message(call_result));
         {
             std::lock_guard<std::recursive_mutex> lk(this->next_message_mutex);
             if (next_message_to_send.has_value()) {
@@ -685,7 +1694,7 @@ public:
             return;
         }
 
-        this->send_callback(call_error);
+        this->send_callback(write_message(call_error));
         {
             std::lock_guard<std::recursive_mutex> lk(this->next_message_mutex);
             if (next_message_to_send.has_value()) {
@@ -701,30 +1710,27 @@ public:
     /// \brief pushes a new \p call message onto the message queue
     /// \returns a future from which the CallResult can be extracted
     template <class T> std::future<EnhancedMessage<M>> push_async(Call<T> call) {
-        auto message = std::make_shared<ControlMessage<M>>(call);
-
         if (!running) {
+            std::promise<EnhancedMessage<M>> promise;
             auto enhanced_message = EnhancedMessage<M>();
             enhanced_message.offline = true;
-            message->promise.set_value(enhanced_message);
-        } else if (is_transaction_message(message->messageType)) {
+            promise.set_value(enhanced_message);
+            return promise.get_future();
+        }
+
+        auto message = std::make_shared<ControlMessage<M>>(
+            write_message(call), this->string_to_messagetype(call.msg.get_type()), call.uniqueId);
+        auto future = message->promise.get_future();
+        if (is_transaction_message(message->messageType)) {
             // according to the spec the "transaction related messages" StartTransaction, StopTransaction and
             // MeterValues have to be delivered in chronological order
-            this->add_to_transaction_message_queue(message);
+            this->push_transaction_message(std::move(message));
         } else {
-            // all other messages are allowed to "jump the queue" to improve user experience
-            // TODO: decide if we only want to allow this for a subset of messages
-            if (this->paused && !this->config.check_queue(message->messageType) && !this->resuming &&
-                message->messageType != M::BootNotification) {
-                // do not add a normal message to the queue if the queue is paused/offline
-                auto enhanced_message = EnhancedMessage<M>();
-                enhanced_message.offline = true;
-                message->promise.set_value(enhanced_message);
-            } else {
-                this->add_to_normal_message_queue(message);
-            }
+            // a normal message pushed while the queue is paused/offline is completed with offline set when the ingress
+            // is drained
+            this->push_to_ingress(std::move(message), QueueType::Normal);
         }
-        return message->promise.get_future();
+        return future;
     }
 
     /// \brief Enhances a received \p json_message with additional meta information, checks if it is a valid CallResult
@@ -733,13 +1739,26 @@ public:
     EnhancedMessage<M> receive(std::string_view message) {
         EnhancedMessage<M> enhanced_message;
 
-        enhanced_message.message = json::parse(message);
+        if (this->config.directly_deserialized_message_types.empty()) {
+            enhanced_message.message = json::parse(message);
+        } else {
+            bool payload_skipped = false;
+            enhanced_message.message = parse_message(
+                message,
+                [this](const std::string& action) {
+                    return this->config.directly_deserialized_message_types.count(
+                               this->string_to_messagetype(action)) != 0;
+                },
+                payload_skipped);
+            if (payload_skipped) {
+                enhanced_message.call_text.emplace(message);
+            }
+        }
         enhanced_message.uniqueId = this->getMessageId(enhanced_message.message);
         enhanced_message.messageTypeId = this->getMessageTypeId(enhanced_message.message);
 
         if (enhanced_message.messageTypeId == MessageTypeId::CALL) {
             enhanced_message.messageType = this->string_to_messagetype(enhanced_message.message.at(CALL_ACTION));
-            enhanced_message.call_message = enhanced_message.message;
 
             {
                 std::lock_guard<std::recursive_mutex> lk(this->next_message_mutex);
@@ -760,21 +1779,22 @@ public:
 
             // TODO(kai): we need to do some error handling in the CallError case
             std::unique_lock<std::recursive_mutex> lk(this->message_mutex);
-            if (this->in_flight == nullptr) {
+            if (this->in_flight.empty()) {
                 EVLOG_error << "Received a CALLRESULT OR CALLERROR without a message in flight, this should not happen";
                 return enhanced_message;
             }
-            if (this->in_flight->uniqueId() != enhanced_message.uniqueId) {
-                EVLOG_error << "Received a CALLRESULT OR CALLERROR with mismatching uid: "
-                            << this->in_flight->uniqueId() << " != " << enhanced_message.uniqueId;
+            const auto in_flight_it = this->in_flight.find(enhanced_message.uniqueId);
+            if (in_flight_it == this->in_flight.end()) {
+                EVLOG_error << "Received a CALLRESULT OR CALLERROR with a uid that is not in flight: "
+                            << enhanced_message.uniqueId;
                 return enhanced_message;
             }
             if (enhanced_message.messageTypeId == MessageTypeId::CALLERROR) {
                 EVLOG_error << "Received a CALLERROR for message with UID: " << enhanced_message.uniqueId;
                 // make sure the original call message is attached to the callerror
-                enhanced_message.call_message = this->in_flight->message;
+                enhanced_message.call_message = in_flight_it->second->json_message();
                 lk.unlock();
-                this->handle_timeout_or_callerror(enhanced_message);
+                this->handle_timeout_or_callerror(enhanced_message.uniqueId, enhanced_message);
             } else {
                 this->handle_call_result(enhanced_message);
             }
@@ -783,33 +1803,29 @@ public:
         return enhanced_message;
     }
 
-    void reset_in_flight() {
-        this->in_flight = nullptr;
-        this->in_flight_timeout_timer.stop();
-    }
-
     void handle_call_result(EnhancedMessage<M>& enhanced_message) {
-        if (this->in_flight->uniqueId() == enhanced_message.uniqueId) {
-            enhanced_message.call_message = this->in_flight->message;
-            enhanced_message.messageType = this->string_to_messagetype(
-                this->in_flight->message.at(CALL_ACTION).template get<std::string>() + std::string("Response"));
-            this->in_flight->promise.set_value(enhanced_message);
-
-            const auto queue_type =
-                is_transaction_message(*this->in_flight) ? QueueType::Transaction : QueueType::Normal;
-            if (is_transaction_message(*this->in_flight) or this->config.check_queue(this->in_flight->messageType)) {
+        const auto message = this->take_in_flight(enhanced_message.uniqueId);
+        if (message != nullptr) {
+            enhanced_message.messageType =
+                this->string_to_messagetype(this->messagetype_to_string(message->messageType) + "Response");
+            if (is_transaction_message(*message)) {
+                // the message has been delivered and is not needed by the queue anymore
+                enhanced_message.call_message = std::move(message->json_message());
+            }
+            message->promise.set_value(enhanced_message);
+
+            const auto queue_type = is_transaction_message(*message) ? QueueType::Transaction : QueueType::Normal;
+            if (is_transaction_message(*message) or this->config.check_queue(message->messageType)) {
                 try {
                     // We only remove the message as soon as a response is received. Otherwise we might miss a message
                     // if the charging station just boots after sending, but before receiving the result.
-                    this->database_handler->remove_message_queue_message(this->in_flight->initial_unique_id,
-                                                                         queue_type);
+                    this->database_handler->remove_message_queue_message(message->initial_unique_id, queue_type);
                 } catch (const QueryExecutionException& e) {
                     EVLOG_warning << "Could not delete message from message queue: " << e.what();
                 } catch (const std::exception& e) {
                     EVLOG_warning << "Could not delete message from message queue: " << e.what();
                 }
             }
-            this->reset_in_flight();
 
             // we want the start transaction response handler to be executed before the next message will be
             // send in order to be able to replace the transaction id if necessary
@@ -821,106 +1837,100 @@ public:
         }
     }
 
-    /// \brief Handles a message timeout or a CALLERROR. \p enhanced_message_opt is set only in case of CALLERROR
-    void handle_timeout_or_callerror(const std::optional<EnhancedMessage<M>>& enhanced_message_opt) {
+    /// \brief Handles a message timeout or a CALLERROR of the in-flight message with the given \p unique_id.
+    /// \p enhanced_message_opt is set only in case of CALLERROR
+    void handle_timeout_or_callerror(const MessageId& unique_id,
+                                     const std::optional<EnhancedMessage<M>>& enhanced_message_opt) {
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+        // The message might have been handled already, e.g. if a CALLERROR and the timeout arrive at the same time
+        const auto message = this->take_in_flight(unique_id);
+        if (message == nullptr) {
+            return;
+        }
         // We got a timeout iff enhanced_message_opt is empty. Otherwise, enhanced_message_opt contains the CallError.
         bool timeout = !enhanced_message_opt.has_value();
         if (timeout) {
-            EVLOG_warning << "Message timeout for: " << this->in_flight->messageType << " ("
-                          << this->in_flight->uniqueId() << ")";
+            EVLOG_warning << "Message timeout for: " << message->messageType << " (" << message->uniqueId() << ")";
         } else {
-            EVLOG_warning << "CALLERROR for: " << this->in_flight->messageType << " (" << this->in_flight->uniqueId()
-                          << ")";
+            EVLOG_warning << "CALLERROR for: " << message->messageType << " (" << message->uniqueId() << ")";
         }
 
-        const auto queue_type = is_transaction_message(*this->in_flight) ? QueueType::Transaction : QueueType::Normal;
-        if (is_transaction_message(*this->in_flight) or this->config.check_queue(this->in_flight->messageType)) {
-            if (this->in_flight->message_attempts < this->config.transaction_message_attempts) {
+        const auto queue_type = is_transaction_message(*message) ? QueueType::Transaction : QueueType::Normal;
+        if (is_transaction_message(*message) or this->config.check_queue(message->messageType)) {
+            if (message->message_attempts < this->config.transaction_message_attempts) {
                 EVLOG_warning << "Message shall be persisted and will therefore be sent again";
                 // Generate a new message ID for the retry
-                const auto old_message_id = this->in_flight->message[MESSAGE_ID];
-                this->in_flight->message[MESSAGE_ID] = this->createMessageId();
+                const auto old_message_id = message->uniqueId();
+                message->set_unique_id(this->createMessageId());
                 if (this->config.transaction_message_retry_interval > 0) {
                     // exponential backoff
-                    this->in_flight->timestamp =
-                        DateTime(this->in_flight->timestamp.to_time_point() +
+                    message->timestamp =
+                        DateTime(message->timestamp.to_time_point() +
                                  std::chrono::seconds(this->config.transaction_message_retry_interval) *
-                                     this->in_flight->message_attempts);
+                                     message->message_attempts);
                     EVLOG_debug << "Retry interval > 0: " << this->config.transaction_message_retry_interval
-                                << " attempting to retry message at: " << this->in_flight->timestamp;
+                                << " attempting to retry message at: " << message->timestamp;
                 } else {
                     // immediate retry
-                    this->in_flight->timestamp = DateTime();
+                    message->timestamp = DateTime();
                     EVLOG_debug << "Retry interval of 0 means immediate retry";
                 }
 
-                EVLOG_warning << "Attempt: " << this->in_flight->message_attempts + 1 << "/"
-                              << this->config.transaction_message_attempts << " will be sent at "
-                              << this->in_flight->timestamp;
+                EVLOG_warning << "Attempt: " << message->message_attempts + 1 << "/"
+                              << this->config.transaction_message_attempts << " will be sent at " << message->timestamp;
 
                 if (queue_type == QueueType::Transaction) {
-                    this->transaction_message_queue.push_front(this->in_flight);
+                    this->transaction_message_queue.push_front(message);
+                    this->count_queued_transaction_event(*message, true);
                 } else if (queue_type == QueueType::Normal) {
-                    this->normal_message_queue.push_front(this->in_flight);
+                    this->normal_message_queue.push_front(message, this->get_scheduling_class(message->messageType),
+                                                          this->get_coalescing_key(*message));
                 }
-                if (is_start_transaction_message(*this->in_flight)) {
-                    this->start_transaction_message_retry_callback(this->in_flight->message[MESSAGE_ID],
-                                                                   old_message_id);
+                if (is_start_transaction_message(*message)) {
+                    this->start_transaction_message_retry_callback(message->uniqueId().get(), old_message_id.get());
                 }
-                this->notify_queue_timer.at(
-                    [this]() {
-                        this->new_message = true;
-                        this->cv.notify_all();
-                    },
-                    this->in_flight->timestamp.to_time_point());
+                // the worker arms the notify queue timer for the retry
+                this->new_message = true;
             } else {
                 EVLOG_error << "Could not deliver message within the configured amount of attempts, "
                                "dropping message";
                 if (enhanced_message_opt) {
-                    this->in_flight->promise.set_value(enhanced_message_opt.value());
+                    message->promise.set_value(enhanced_message_opt.value());
                 } else {
                     EnhancedMessage<M> enhanced_message;
                     enhanced_message.offline = true;
-                    this->in_flight->promise.set_value(enhanced_message);
+                    message->promise.set_value(enhanced_message);
                 }
                 try {
                     // also drop the message from the database
-                    this->database_handler->remove_message_queue_message(this->in_flight->initial_unique_id,
-                                                                         queue_type);
+                    this->database_handler->remove_message_queue_message(message->initial_unique_id, queue_type);
                 } catch (const QueryExecutionException& e) {
                     EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
                 } catch (const std::exception& e) {
                     EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
                 }
             }
-        } else if (is_boot_notification_message(this->in_flight->messageType)) {
+        } else if (is_boot_notification_message(message->messageType)) {
             EVLOG_warning << "Message is BootNotification.req and will therefore be sent again";
             // Generate a new message ID for the retry
-            this->in_flight->message[MESSAGE_ID] = this->createMessageId();
+            message->set_unique_id(this->createMessageId());
             // Spec does not define how to handle retries for BootNotification.req: We use the
             // the boot_notification_retry_interval_seconds
-            this->in_flight->timestamp =
-                DateTime(this->in_flight->timestamp.to_time_point() +
-                         std::chrono::seconds(this->config.boot_notification_retry_interval_seconds));
-            this->normal_message_queue.push_front(this->in_flight);
-            this->notify_queue_timer.at(
-                [this]() {
-                    this->new_message = true;
-                    this->cv.notify_all();
-                },
-                this->in_flight->timestamp.to_time_point());
+            message->timestamp = DateTime(message->timestamp.to_time_point() +
+                                          std::chrono::seconds(this->config.boot_notification_retry_interval_seconds));
+            this->normal_message_queue.push_front(message, MessageSchedulingClass::High);
+            // the worker arms the notify queue timer for the retry
+            this->new_message = true;
         } else {
             EVLOG_warning << "Message is not transaction related, dropping it";
             if (enhanced_message_opt) {
-                this->in_flight->promise.set_value(enhanced_message_opt.value());
+                message->promise.set_value(enhanced_message_opt.value());
             } else {
                 EnhancedMessage<M> enhanced_message;
                 enhanced_message.offline = true;
-                this->in_flight->promise.set_value(enhanced_message);
+                message->promise.set_value(enhanced_message);
             }
         }
-        this->reset_in_flight();
         this->cv.notify_all();
     }
 
@@ -929,17 +1939,38 @@ public:
         EVLOG_debug << "stop()";
         // stop the running thread
         this->running = false;
+        this->worker_commits = false;
+        // pairs with the fence in wait_for_commit()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
         this->cv.notify_one();
         this->worker_thread.join();
+        this->worker_thread_id = std::thread::id();
+        {
+            // make sure that messages pushed right before stopping are persisted
+            std::unique_lock<std::recursive_mutex> lk(this->message_mutex);
+            this->drain_ingress();
+            this->commit_drained_messages(lk);
+        }
         EVLOG_debug << "stop() notified message queue";
     }
 
+    /// \brief Stops the timers of the message queue, e.g. before the io_context they run on is held to destroy the
+    /// message queue. The message queue has to be stopped before
+    void stop_timers() {
+        std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+        this->in_flight_timeout_timer->stop();
+        this->notify_queue_timer->stop();
+        this->resume_timer->stop();
+    }
+
     /// \brief Pauses the message queue
     void pause() {
         EVLOG_debug << "pause()";
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+        // messages pushed before the queue is paused are queued as if the queue was online
+        this->drain_ingress();
         this->pause_resume_ctr++;
-        this->resume_timer.stop();
+        this->resume_timer->stop();
         this->paused = true;
         this->resuming = false;
         this->cv.notify_one();
@@ -950,6 +1981,8 @@ public:
     void resume(std::chrono::seconds delay_on_reconnect) {
         EVLOG_debug << "resume() called";
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+        // messages pushed while the queue was paused are handled as offline messages
+        this->drain_ingress();
         if (!this->paused) {
             return;
         }
@@ -959,7 +1992,7 @@ public:
             this->resuming = true;
             EVLOG_debug << "Delaying message queue resume by " << delay_on_reconnect.count() << " seconds";
             u_int64_t expected_pause_resume_ctr = this->pause_resume_ctr;
-            this->resume_timer.timeout(
+            this->resume_timer->timeout(
                 [this, expected_pause_resume_ctr] { this->resume_now(expected_pause_resume_ctr); }, delay_on_reconnect);
         } else {
             this->resume_now(this->pause_resume_ctr);
@@ -970,39 +2003,54 @@ public:
         {
             std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
             this->is_registration_status_accepted = true;
+            this->normal_message_queue.set_registration_status_accepted();
+            this->new_message = true;
         }
         this->cv.notify_all();
     }
 
+    /// \brief Returns the depth and latency counters of the given \p scheduling_class of the normal message queue
+    MessageSchedulingClassStatistics get_scheduling_class_statistics(const MessageSchedulingClass scheduling_class) {
+        this->wait_for_worker();
+        std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+        return this->normal_message_queue.get_statistics(scheduling_class);
+    }
+
+    /// \brief Returns the number of times the worker thread has been woken up, e.g. to detect that it is busy waiting
+    size_t get_worker_wakeups() {
+        std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+        return this->worker_wakeups;
+    }
+
     bool is_transaction_message_queue_empty() {
+        this->wait_for_worker();
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
-        return this->transaction_message_queue.empty();
+        return this->transaction_message_queue.empty() and
+               this->transaction_messages_replay.position >= this->transaction_messages_replay.end;
     }
 
     bool contains_transaction_messages(const CiString<36> transaction_id) {
+        this->wait_for_worker();
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
-        for (const auto control_message : this->transaction_message_queue) {
-            if (control_message->messageType == v201::MessageType::TransactionEvent) {
-                v201::TransactionEventRequest req = control_message->message.at(CALL_PAYLOAD);
-                if (req.transactionInfo.transactionId == transaction_id) {
-                    return true;
-                }
-            }
+        if (this->queued_transaction_events.count(transaction_id)) {
+            return true;
         }
-        return false;
+        return this->contains_persisted_transaction_id(v201::MessageType::TransactionEvent, transaction_id.get());
     }
 
     bool contains_stop_transaction_message(const int32_t transaction_id) {
+        this->wait_for_worker();
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
         for (const auto control_message : this->transaction_message_queue) {
             if (control_message->messageType == v16::MessageType::StopTransaction) {
-                v16::StopTransactionRequest req = control_message->message.at(CALL_PAYLOAD);
+                v16::StopTransactionRequest req = control_message->json_message().at(CALL_PAYLOAD);
                 if (req.transactionId == transaction_id) {
                     return true;
                 }
             }
         }
-        return false;
+        return this->contains_persisted_transaction_id(v16::MessageType::StopTransaction,
+                                                       std::to_string(transaction_id));
     }
 
     /// \brief Set transaction_message_attempts to given \p transaction_message_attempts
@@ -1053,15 +2101,17 @@ public:
 
         // replace transaction id in meter values if start_transaction_message_id is present in map
         // this is necessary when the chargepoint queued MeterValue.req for a transaction with unknown transaction_id
+        this->wait_for_worker();
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
         if (this->start_transaction_mid_meter_values_mid_map.count(start_transaction_message_id)) {
             for (auto it = this->transaction_message_queue.begin(); it != transaction_message_queue.end(); ++it) {
                 for (const auto& meter_value_message_id :
                      this->start_transaction_mid_meter_values_mid_map.at(start_transaction_message_id)) {
 
-                    if (meter_value_message_id == (*it)->message.at(1)) {
+                    if (meter_value_message_id == (*it)->uniqueId().get()) {
                         EVLOG_debug << "Adding transactionId " << transaction_id << " to MeterValue.req";
-                        (*it)->message.at(3)["transactionId"] = transaction_id;
+                        (*it)->json_message().at(CALL_PAYLOAD)["transactionId"] = transaction_id;
+                        (*it)->invalidate_serialized_message();
                     }
                 }
             }
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_COMMON_MESSAGE_SCHEMA_VALIDATOR_HPP
+#define OCPP_COMMON_MESSAGE_SCHEMA_VALIDATOR_HPP
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <everest/logging.hpp>
+
+#include <ocpp/common/call_types.hpp>
+#include <ocpp/common/message_queue.hpp>
+#include <ocpp/common/schemas.hpp>
+#include <ocpp/common/support_older_cpp_versions.hpp>
+#include <ocpp/common/types.hpp>
+
+namespace ocpp {
+
+/// \brief Finds the OCPP JSON schemas of the requests in \p schemas_path. Both the OCPP 1.6 file names (Authorize.json)
+/// and the OCPP 2.0.1 file names (AuthorizeRequest.json) are supported, response schemas are ignored
+/// \returns the schema file of every action
+std::map<std::string, fs::path> find_request_schemas(const fs::path& schemas_path);
+
+/// \brief Loads the json schema \p schema_path and compiles it into a validator
+std::unique_ptr<json_validator> load_request_validator(const fs::path& schema_path);
+
+/// \brief Validates the \p payload of the received CALL with the given \p unique_id against \p validator
+/// \returns a PropertyConstraintViolation if a value violates a constraint of its property (length, range, enum,
+/// format) and a FormationViolation for every other violation (type, required or additional properties), std::nullopt
+/// if the payload is valid
+std::optional<CallError> validate_payload(const json_validator& validator, const MessageId& unique_id,
+                                          const json& payload);
+
+/// \brief Validates the payloads of received CALLs against the OCPP JSON schemas of their actions. Every schema is
+/// loaded and compiled once when the validator is created, validating a payload only looks up the validator of its
+/// message type
+template <typename M> class MessageSchemaValidator {
+private:
+    std::map<M, std::unique_ptr<json_validator>> validators;
+
+public:
+    /// \brief Creates a validator for every request schema in \p schemas_path. Schemas of actions that
+    /// \p string_to_messagetype does not know are ignored
+    MessageSchemaValidator(const fs::path& schemas_path,
+                           const std::function<M(const std::string&)>& string_to_messagetype) {
+        for (const auto& [action, schema_path] : find_request_schemas(schemas_path)) {
+            try {
+                this->validators[string_to_messagetype(action)] = load_request_validator(schema_path);
+            } catch (const StringToEnumException&) {
+                EVLOG_debug << "Ignoring schema of unknown action: " << schema_path;
+            } catch (const std::exception& e) {
+                EVLOG_error << "Could not load message schema " << schema_path << ": " << e.what();
+            }
+        }
+        EVLOG_info << "Validating received messages with " << this->validators.size() << " schemas from "
+                   << schemas_path;
+    }
+
+    /// \brief Provides the number of message types with a validator
+    std::size_t size() const {
+        return this->validators.size();
+    }
+
+    /// \brief Validates the payload of the received \p message if it is a CALL with a schema
+    /// \returns the CallError to send instead of handling the message, std::nullopt if the message can be handled
+    std::optional<CallError> validate(const EnhancedMessage<M>& message) const {
+        if (message.messageTypeId != MessageTypeId::CALL) {
+            return std::nullopt;
+        }
+        const auto it = this->validators.find(message.messageType);
+        if (it == this->validators.end()) {
+            return std::nullopt;
+        }
+        if (message.call_text.has_value()) {
+            // the payload of a directly deserialized CALL is only available as text
+            const auto call = json::parse(message.call_text.value());
+            return validate_payload(*it->second, message.uniqueId, call.at(CALL_PAYLOAD));
+        }
+        return validate_payload(*it->second, message.uniqueId, message.message.at(CALL_PAYLOAD));
+    }
+};
+
+} // namespace ocpp
+
+#endif // OCPP_COMMON_MESSAGE_SCHEMA_VALIDATOR_HPP
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace ocpp {
+
+/// \brief Unbounded lock-free multi-producer single-consumer queue (intrusive linked list with a stub node).
+/// push() may be called concurrently from any number of threads, it never blocks. pop() and empty() must only be
+/// called by one consumer at a time.
+template <typename T> class MpscQueue {
+private:
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        std::optional<T> value;
+    };
+
+    std::atomic<Node*> head; ///< most recently pushed node, producer side
+    Node* tail;              ///< node preceding the next node to be popped, consumer side
+
+public:
+    MpscQueue() {
+        this->tail = new Node();
+        this->head.store(this->tail, std::memory_order_relaxed);
+    }
+
+    ~MpscQueue() {
+        while (this->pop().has_value()) {
+        }
+        delete this->tail;
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    /// \brief Adds the given \p value to the end of the queue
+    void push(T value) {
+        auto node = new Node();
+        node->value.emplace(std::move(value));
+        const auto previous = this->head.exchange(node, std::memory_order_acq_rel);
+        // until this store the node is not visible to the consumer yet, so the queue might appear empty to it for a
+        // moment even though push() has been called
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    /// \brief Removes the first value of the queue
+    /// \returns the removed value or std::nullopt if the queue is empty
+    std::optional<T> pop() {
+        const auto next = this->tail->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return std::nullopt;
+        }
+        std::optional<T> value = std::move(next->value);
+        next->value.reset();
+        delete this->tail;
+        this->tail = next;
+        return value;
+    }
+
+    bool empty() const {
+        return this->tail->next.load(std::memory_order_acquire) == nullptr;
+    }
+};
+
+} // namespace ocpp
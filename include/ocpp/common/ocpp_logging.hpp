@@ -76,6 +76,9 @@ private:
     /// \brief Format the given \p json_str with the given \p message_type
     FormattedMessageWithType format_message(const std::string& message_type, const std::string& json_str);
 
+    /// \brief Format the given already parsed \p json_message with the given \p message_type
+    FormattedMessageWithType format_message(const std::string& message_type, const json& json_message);
+
     /// \brief Add opening html tags to the given stream \p os
     void open_html_tags(std::ofstream& os);
 
@@ -124,6 +127,10 @@ public:
     /// \brief Log a message originating from the central system
     void central_system(const std::string& message_type, const std::string& json_str);
 
+    /// \brief Log a message originating from the central system that has already been parsed into \p json_message,
+    /// so that it does not have to be parsed again for formatting
+    void central_system(const std::string& message_type, const std::string& json_str, const json& json_message);
+
     /// \brief Log a system message
     void sys(const std::string& msg);
 
@@ -3,56 +3,113 @@
 #ifndef OCPP_COMMON_STRING_HPP
 #define OCPP_COMMON_STRING_HPP
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 
 namespace ocpp {
 
+/// \brief Strings with a maximum length of up to this many characters are stored inline instead of on the heap. This
+/// covers the identifiers that are part of most messages, like idTag, idToken, transactionId or evse and component
+/// names
+constexpr size_t STRING_INLINE_CAPACITY = 64;
+
+/// \brief Storage of the characters of a String with a maximum length of \p L. Strings that are longer than
+/// STRING_INLINE_CAPACITY are stored in a std::string
+template <size_t L, bool Inline = (L <= STRING_INLINE_CAPACITY)> class StringStorage {
+private:
+    std::string data;
+
+public:
+    std::string_view view() const {
+        return this->data;
+    }
+
+    void assign(std::string_view data) {
+        this->data.assign(data.data(), data.size());
+    }
+};
+
+/// \brief Stores up to \p L characters in a fixed size array, copying the string does not allocate memory
+template <size_t L> class StringStorage<L, true> {
+private:
+    static_assert(STRING_INLINE_CAPACITY <= std::numeric_limits<std::uint8_t>::max());
+
+    std::array<char, L> data{};
+    std::uint8_t size = 0;
+
+public:
+    std::string_view view() const {
+        return {this->data.data(), this->size};
+    }
+
+    /// \brief Copies \p data into the array, its length has to be checked against \p L before
+    void assign(std::string_view data) {
+        std::copy(data.begin(), data.end(), this->data.begin());
+        this->size = static_cast<std::uint8_t>(data.size());
+    }
+};
+
 /// \brief Contains a String impementation with a maximum length
 template <size_t L> class String {
 private:
-    std::string data;
-    size_t length;
+    StringStorage<L> data;
+
+    void assign(std::string_view data) {
+        if (data.length() <= L) {
+            if (this->is_valid(data)) {
+                this->data.assign(data);
+            } else {
+                throw std::runtime_error("String has invalid format");
+            }
+        } else {
+            throw std::runtime_error("String length (" + std::to_string(data.length()) +
+                                     ") exceeds permitted length (" + std::to_string(L) + ")");
+        }
+    }
 
 public:
     /// \brief Creates a string from the given \p data
-    String(const std::string& data) : length(L) {
+    String(const std::string& data) {
         this->set(data);
     }
 
-    String(const char* data) : length(L) {
-        this->set(data);
+    String(const char* data) {
+        this->assign(data);
     }
 
     /// \brief Creates a string
-    String() : length(L) {
+    String() {
     }
 
     /// \brief Provides a std::string representation of the string
     /// \returns a std::string
     std::string get() const {
-        return data;
+        return std::string(this->data.view());
+    }
+
+    /// \brief Provides the characters of the string without copying them
+    /// \returns a std::string_view that is valid until the string is changed or destroyed
+    std::string_view view() const {
+        return this->data.view();
     }
 
     /// \brief Sets the content of the string to the given \p data
     void set(const std::string& data) {
-        if (data.length() <= this->length) {
-            if (this->is_valid(data)) {
-                this->data = data;
-            } else {
-                throw std::runtime_error("String has invalid format");
-            }
-        } else {
-            throw std::runtime_error("String length (" + std::to_string(data.length()) +
-                                     ") exceeds permitted length (" + std::to_string(this->length) + ")");
-        }
+        this->assign(data);
     }
 
-    /// \brief Override this to check for a specific format
-    bool is_valid(const std::string& data) {
+    /// \brief Checks the format of \p data, a String accepts any content. set() and the constructors always use this
+    /// check, also for derived classes that hide it with a check of their own
+    bool is_valid(std::string_view data) const {
         (void)data; // not needed here
         return true;
     }
@@ -65,31 +122,42 @@ public:
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
 template <size_t L> bool operator==(const String<L>& lhs, const char* rhs) {
-    return lhs.get() == rhs;
+    return lhs.view() == rhs;
 }
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
 template <size_t L> bool operator==(const String<L>& lhs, const String<L>& rhs) {
-    return lhs.get() == rhs.get();
+    return lhs.view() == rhs.view();
 }
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
 template <size_t L> bool operator!=(const String<L>& lhs, const char* rhs) {
-    return !(lhs.get() == rhs);
+    return !(lhs == rhs);
 }
 
 /// \brief Case insensitive compare for a case insensitive (Ci)String
 template <size_t L> bool operator!=(const String<L>& lhs, const String<L>& rhs) {
-    return !(lhs.get() == rhs.get());
+    return !(lhs == rhs);
 }
 
 /// \brief Writes the given string \p str to the given output stream \p os
 /// \returns an output stream with the case insensitive string written to
 template <size_t L> std::ostream& operator<<(std::ostream& os, const String<L>& str) {
-    os << str.get();
+    os << str.view();
     return os;
 }
 
 } // namespace ocpp
 
+namespace std {
+
+/// \brief Hashes the characters of a String without copying them
+template <size_t L> struct hash<ocpp::String<L>> {
+    size_t operator()(const ocpp::String<L>& str) const noexcept {
+        return hash<string_view>()(str.view());
+    }
+};
+
+} // namespace std
+
 #endif
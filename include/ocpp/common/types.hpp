@@ -4,6 +4,7 @@
 #ifndef OCPP_COMMON_TYPES_HPP
 #define OCPP_COMMON_TYPES_HPP
 
+#include <array>
 #include <chrono>
 #include <cstddef>
 #include <iostream>
@@ -11,6 +12,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 
 #include <nlohmann/json_fwd.hpp>
 
@@ -39,6 +41,9 @@ private:
     std::chrono::time_point<date::utc_clock> timepoint;
 
 public:
+    /// \brief Size of the buffer that to_rfc3339 can write the RFC 3339 string into
+    static constexpr std::size_t RFC3339_BUFFER_SIZE = 32;
+
     /// \brief Creates a new DateTimeImpl object with the current utc time
     DateTimeImpl();
 
@@ -54,6 +59,10 @@ public:
     /// \returns a RFC 3339 compatible string representation of the stored DateTime
     std::string to_rfc3339() const;
 
+    /// \brief Writes this DateTimeImpl as a RFC 3339 compatible string to \p buffer without allocating memory
+    /// \returns the written string, it points into \p buffer
+    std::string_view to_rfc3339(std::array<char, RFC3339_BUFFER_SIZE>& buffer) const;
+
     /// \brief Sets the timepoint of this DateTimeImpl to the given \p timepoint_str
     void from_rfc3339(const std::string& timepoint_str);
 
@@ -137,8 +146,8 @@ public:
     /// \param str input string that failed to convert
     /// \param type name of the enum trying to convert to
     StringToEnumException(std::string_view str, std::string_view type) :
-        EnumConversionException{std::string{"Provided string '"} + str.data() + "' could not be converted to " +
-                                type.data()} {
+        EnumConversionException{std::string{"Provided string '"}.append(str) + "' could not be converted to " +
+                                std::string{type}} {
     }
 };
 
@@ -3,14 +3,26 @@
 #ifndef OCPP_COMMON_UTILS_HPP
 #define OCPP_COMMON_UTILS_HPP
 
+#include <cstddef>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <vector>
 
 namespace ocpp {
 
-/// \brief Case insensitive compare for a case insensitive (Ci)String
-bool iequals(const std::string& lhs, const std::string rhs);
+/// \brief Case insensitive compare for a case insensitive (Ci)String, only ASCII letters are compared case
+/// insensitively
+bool iequals(std::string_view lhs, std::string_view rhs);
+
+/// \brief Case insensitive lexicographical compare for a case insensitive (Ci)String, consistent with iequals
+bool iless(std::string_view lhs, std::string_view rhs);
+
+/// \brief Case insensitive hash for a case insensitive (Ci)String, strings that are iequals have the same hash
+std::size_t ihash(std::string_view data);
+
+/// \brief Checks if \p data only contains printable ASCII characters (0x20 to 0x7e) and \n
+bool is_printable_ascii(std::string_view data);
 
 bool is_integer(const std::string& value);
 std::tuple<bool, int> is_positive_integer(const std::string& value);
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_COMMON_RECONNECT_SCHEDULER_HPP
+#define OCPP_COMMON_RECONNECT_SCHEDULER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+
+namespace ocpp {
+
+/// \brief Backoff of the reconnects to a network profile as configured by RetryBackOffWaitMinimum,
+/// RetryBackOffRandomRange and RetryBackOffRepeatTimes
+struct ReconnectBackoffParameters {
+    std::chrono::seconds wait_minimum{0};
+    std::chrono::seconds random_range{0};
+    int repeat_times = 0;
+};
+
+/// \brief Reconnects to a network profile since the scheduler was created
+struct ReconnectStatistics {
+    size_t reconnect_attempts = 0;       ///< Number of reconnects scheduled since the last successful connection
+    size_t total_reconnect_attempts = 0; ///< Number of reconnects scheduled in total
+    size_t connections = 0;              ///< Number of successful connections
+    size_t probe_shortcuts = 0;          ///< Number of reconnects brought forward since a probe reached the CSMS
+    /// Time from the first failed connection attempt until the last successful connection
+    std::optional<std::chrono::steady_clock::duration> last_time_to_connect;
+};
+
+/// \brief Schedules the reconnects of the websocket connections of a charging station.
+///
+/// The first reconnect after a connection loss is delayed by RetryBackOffWaitMinimum plus a random part of
+/// RetryBackOffRandomRange like the OCPP specification requires. Every following delay is drawn from
+/// [RetryBackOffWaitMinimum, 3 * previous delay] (decorrelated jitter) and capped at the delay the doubling backoff
+/// reaches after RetryBackOffRepeatTimes. Compared to doubling a common delay this keeps the reconnects of a fleet of
+/// charging stations spread out after a CSMS outage instead of letting them arrive in synchronized waves.
+///
+/// The backoff state is kept per network profile, so switching to another network profile starts with a short delay
+/// while the backoff to the unreachable one is remembered. A single scheduler can be shared by all websockets of a
+/// charging station. The scheduler also measures the time from start until the first BootNotification is accepted.
+class ReconnectScheduler {
+public:
+    /// \brief Creates a scheduler that draws its random delays from a generator seeded with \p seed
+    explicit ReconnectScheduler(std::uint32_t seed = std::random_device{}());
+
+    /// \brief Counts a reconnect attempt to the network profile \p profile and returns the delay before it
+    std::chrono::milliseconds next_reconnect_delay(const int32_t profile, const ReconnectBackoffParameters& parameters);
+
+    /// \brief Returns the delay before a reconnect to \p profile that replaces a pending reconnect with the
+    /// \p remaining delay because a probe reached the CSMS. The delay is randomized so that charging stations that
+    /// notice a recovered CSMS at the same time do not reconnect all at once
+    std::chrono::milliseconds probe_success_delay(const int32_t profile, const ReconnectBackoffParameters& parameters,
+                                                  const std::chrono::milliseconds remaining);
+
+    /// \brief Resets the backoff of the network profile \p profile after a successful connection
+    void on_connected(const int32_t profile);
+
+    /// \brief Starts measuring the time until the first BootNotification is accepted
+    void on_start();
+
+    /// \brief Stops measuring the time until the first BootNotification is accepted
+    /// \returns the time since on_start() if this is the first accepted BootNotification since then
+    std::optional<std::chrono::steady_clock::duration> on_boot_notification_accepted();
+
+    /// \brief Returns the reconnect statistics of the network profile \p profile
+    ReconnectStatistics get_statistics(const int32_t profile);
+
+    /// \brief Returns the time from the last on_start() until the first BootNotification was accepted, if it has been
+    /// accepted since then
+    std::optional<std::chrono::steady_clock::duration> get_time_to_boot_notification_accepted();
+
+    /// \brief Checks if a TCP connection to \p host at \p port can be established within \p timeout. This is much
+    /// cheaper for the CSMS than a websocket connection attempt including the TLS handshake
+    static bool probe(const std::string& host, const uint16_t port, const std::chrono::milliseconds timeout);
+
+private:
+    struct ProfileState {
+        std::chrono::milliseconds previous_delay{0};
+        std::optional<std::chrono::steady_clock::time_point> offline_since;
+        ReconnectStatistics statistics;
+    };
+
+    std::mutex state_mutex;
+    std::mt19937 random_engine;
+    std::map<int32_t, ProfileState> profiles;
+    std::optional<std::chrono::steady_clock::time_point> started_at;
+    size_t reconnect_attempts_since_start = 0;
+    std::optional<std::chrono::steady_clock::duration> time_to_boot_notification_accepted;
+
+    std::chrono::milliseconds random_delay(const std::chrono::milliseconds min, const std::chrono::milliseconds max);
+};
+
+} // namespace ocpp
+
+#endif // OCPP_COMMON_RECONNECT_SCHEDULER_HPP
@@ -67,6 +67,18 @@ public:
 
     /// \brief set the \p authorization_key of the connection_options
     void set_authorization_key(const std::string& authorization_key);
+
+    /// \brief Schedules the reconnects with \p scheduler, which keeps the backoff of the network profile \p profile
+    void set_reconnect_scheduler(std::shared_ptr<ReconnectScheduler> scheduler, const int32_t profile);
+
+    /// \brief Returns the delivery latency of the messages received so far
+    WebsocketReceiveLatencyStatistics get_receive_latency_statistics();
+
+    /// \brief Returns the number of bytes on the wire and the time spent for the permessage-deflate extension so far
+    WebsocketCompressionStatistics get_compression_statistics();
+
+    /// \brief Returns the number and duration of the TLS handshakes and TLS context loads so far
+    WebsocketTlsStatistics get_tls_statistics();
 };
 
 } // namespace ocpp
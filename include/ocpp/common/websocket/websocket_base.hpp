@@ -3,6 +3,7 @@
 #ifndef OCPP_WEBSOCKET_BASE_HPP
 #define OCPP_WEBSOCKET_BASE_HPP
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -11,6 +12,7 @@
 #include <everest/timer.hpp>
 
 #include <ocpp/common/types.hpp>
+#include <ocpp/common/websocket/reconnect_scheduler.hpp>
 #include <ocpp/common/websocket/websocket_uri.hpp>
 
 namespace ocpp {
@@ -38,6 +40,53 @@ struct WebsocketConnectionOptions {
     std::optional<std::string> iface; // Optional interface where the socket is created. Only usable for libwebsocket
     bool enable_tls_keylog = false;   ///< If set to true enables logging of TLS secrets to the keylog_file
     std::optional<std::filesystem::path> keylog_file; ///< Optional path to a keylog file
+    /// If set to true received messages are dispatched directly from the service loop of the libwebsockets connection
+    /// and send() returns as soon as the message is queued for writing. The message callback must not wait for
+    /// responses of the CSMS then. The v16 and v201 charge points never set it, since their message handlers and the
+    /// callbacks they invoke can wait for responses. The deferred callbacks keep their own thread in both modes
+    bool use_single_threaded_event_loop = false;
+    /// Maximum size in bytes of a received message, larger messages are discarded while they are received. 0 means
+    /// that the size of received messages is not limited
+    size_t max_received_message_size = 0;
+    /// If set to true the permessage-deflate extension (RFC 7692) is offered to the CSMS. Only supported by the
+    /// libwebsockets implementation
+    bool enable_permessage_deflate = false;
+    int permessage_deflate_window_bits = 15;      ///< Maximum LZ77 window of both directions in bits (9 - 15)
+    int permessage_deflate_compression_level = 6; ///< zlib compression level of sent messages (1 - 9)
+    /// Interval in seconds at which the CSMS is probed with a plain TCP connection while a reconnect is pending. The
+    /// reconnect is brought forward once a probe succeeds. 0 disables the probes. Only supported by the libwebsockets
+    /// implementation
+    int reconnect_probe_interval_s = 0;
+};
+
+/// \brief Delivery latency of received messages, measured from the moment a message has been completely received
+/// until the message callback is invoked with it
+struct WebsocketReceiveLatencyStatistics {
+    size_t received = 0;                                 ///< Number of messages passed to the message callback
+    std::chrono::steady_clock::duration total_latency{}; ///< Accumulated delivery latency of these messages
+    std::chrono::steady_clock::duration max_latency{};   ///< Maximum delivery latency of a message
+};
+
+/// \brief Sizes of the messages that passed the permessage-deflate extension before and after compression and the
+/// time spent compressing and decompressing them
+struct WebsocketCompressionStatistics {
+    size_t messages_sent = 0;                                 ///< Number of messages sent over the connection
+    size_t messages_received = 0;                             ///< Number of messages received over the connection
+    size_t payload_bytes_sent = 0;                            ///< Size of the sent messages before compression
+    size_t wire_bytes_sent = 0;                               ///< Size of the sent messages after compression
+    size_t payload_bytes_received = 0;                        ///< Size of the received messages after decompression
+    size_t wire_bytes_received = 0;                           ///< Size of the received messages before decompression
+    std::chrono::steady_clock::duration compression_time{};   ///< Accumulated time spent compressing
+    std::chrono::steady_clock::duration decompression_time{}; ///< Accumulated time spent decompressing
+};
+
+/// \brief TLS handshakes of the connections and how often the TLS context has been (re)created
+struct WebsocketTlsStatistics {
+    size_t handshakes = 0;         ///< Number of completed TLS handshakes
+    size_t resumed_handshakes = 0; ///< Number of completed TLS handshakes that resumed the session of a previous one
+    size_t context_loads = 0;      ///< Number of times the TLS context was created and certificates and keys loaded
+    std::chrono::steady_clock::duration total_handshake_time{}; ///< Accumulated duration of the completed handshakes
+    std::chrono::steady_clock::duration max_handshake_time{};   ///< Maximum duration of a completed handshake
 };
 
 ///
@@ -56,10 +105,17 @@ protected:
     std::unique_ptr<Everest::SteadyTimer> ping_timer;
     std::mutex reconnect_mutex;
     std::mutex connection_mutex;
-    std::atomic_int reconnect_backoff_ms;
     std::atomic_int connection_attempts;
+    std::shared_ptr<ReconnectScheduler> reconnect_scheduler;
+    std::atomic<int32_t> reconnect_profile;
     std::atomic_bool shutting_down;
     std::atomic_bool reconnecting;
+    std::mutex receive_latency_mutex;
+    WebsocketReceiveLatencyStatistics receive_latency_statistics;
+    std::mutex compression_statistics_mutex;
+    WebsocketCompressionStatistics compression_statistics;
+    std::mutex tls_statistics_mutex;
+    WebsocketTlsStatistics tls_statistics;
 
     /// \brief Indicates if the required callbacks are registered
     /// \returns true if the websocket is properly initialized
@@ -71,10 +127,16 @@ protected:
     /// \brief Logs websocket connection error
     void log_on_fail(const std::error_code& ec, const boost::system::error_code& transport_ec, const int http_status);
 
-    /// \brief Calculates and returns the reconnect interval based on int retry_backoff_random_range_s,
-    /// retry_backoff_repeat_times, int retry_backoff_wait_minimum_s of the WebsocketConnectionOptions
+    /// \brief Returns the backoff configured by retry_backoff_random_range_s, retry_backoff_repeat_times and
+    /// retry_backoff_wait_minimum_s of the WebsocketConnectionOptions
+    ReconnectBackoffParameters get_reconnect_backoff_parameters();
+
+    /// \brief Returns the interval in ms until the next reconnect as drawn by the reconnect scheduler
     long get_reconnect_interval();
 
+    /// \brief Resets the connection attempts and the reconnect backoff after a successful connection
+    void reset_reconnect_backoff();
+
     // \brief cancels the reconnect timer
     void cancel_reconnect_timer();
 
@@ -84,6 +146,25 @@ protected:
     /// \brief Called when a websocket pong timeout is received
     void on_pong_timeout(std::string msg);
 
+    /// \brief Adds the delivery latency of a message that has been completely received at \p received_at and is
+    /// passed to the message callback now to the receive latency statistics
+    void record_receive_latency(const std::chrono::steady_clock::time_point received_at);
+
+    /// \brief Counts a completely sent or received message, depending on \p sent, in the compression statistics
+    void record_message(const bool sent);
+
+    /// \brief Adds a pass of the compression (if \p sent) or decompression that converted between \p payload_bytes
+    /// and \p wire_bytes within \p duration to the compression statistics
+    void record_compression(const bool sent, const size_t payload_bytes, const size_t wire_bytes,
+                            const std::chrono::steady_clock::duration duration);
+
+    /// \brief Adds a TLS handshake that completed within \p duration and resumed a previous session if \p resumed to
+    /// the TLS statistics
+    void record_tls_handshake(const bool resumed, const std::chrono::steady_clock::duration duration);
+
+    /// \brief Counts the creation of a TLS context in the TLS statistics
+    void record_tls_context_load();
+
 public:
     /// \brief Creates a new WebsocketBase object. The `connection_options` must be initialised with
     /// `set_connection_options()`
@@ -135,6 +216,19 @@ public:
 
     /// \brief set the \p authorization_key of the connection_options
     void set_authorization_key(const std::string& authorization_key);
+
+    /// \brief Schedules the reconnects of this websocket with \p scheduler, which keeps the backoff of the network
+    /// profile \p profile. Websockets use a scheduler of their own and profile 0 by default
+    void set_reconnect_scheduler(std::shared_ptr<ReconnectScheduler> scheduler, const int32_t profile);
+
+    /// \brief Returns the delivery latency of the messages received so far
+    WebsocketReceiveLatencyStatistics get_receive_latency_statistics();
+
+    /// \brief Returns the number of bytes on the wire and the time spent for the permessage-deflate extension so far
+    WebsocketCompressionStatistics get_compression_statistics();
+
+    /// \brief Returns the number and duration of the TLS handshakes and TLS context loads so far
+    WebsocketTlsStatistics get_tls_statistics();
 };
 
 } // namespace ocpp
@@ -12,6 +12,8 @@
 #include <optional>
 #include <queue>
 #include <string>
+#include <utility>
+#include <vector>
 
 struct ssl_ctx_st;
 
@@ -19,8 +21,13 @@ namespace ocpp {
 
 struct ConnectionData;
 struct WebsocketMessage;
+class WebsocketMessagePool;
+struct TlsContextCache;
 
-/// \brief Experimental libwebsockets TLS connection
+/// \brief Experimental libwebsockets TLS connection. By default the service loop of libwebsockets, the dispatching of
+/// received messages and the deferred callbacks each run on their own thread. With
+/// WebsocketConnectionOptions::use_single_threaded_event_loop received messages are dispatched from the service loop
+/// directly
 class WebsocketTlsTPM final : public WebsocketBase {
 public:
     /// \brief Creates a new Websocket object with the providede \p connection_options
@@ -53,6 +60,15 @@ public:
 public:
     int process_callback(void* wsi_ptr, int callback_reason, void* user, void* in, size_t len);
 
+    /// \brief Called by the permessage-deflate extension when it compressed (if \p sent) or decompressed a part of a
+    /// message, converting between \p payload_bytes and \p wire_bytes within \p duration
+    void on_permessage_deflate(const bool sent, const size_t payload_bytes, const size_t wire_bytes,
+                               const std::chrono::steady_clock::duration duration);
+
+    /// \brief Called when a TLS handshake completed within \p duration, \p resumed indicates if the session of a
+    /// previous connection has been resumed
+    void on_tls_handshake(const bool resumed, const std::chrono::steady_clock::duration duration);
+
 private:
     bool tls_init(struct ssl_ctx_st* ctx, const std::string& path_chain, const std::string& path_key, bool custom_key,
                   std::optional<std::string>& password);
@@ -71,12 +87,16 @@ private:
     /// \brief When the connection can send data
     void on_writable();
 
-    /// \brief Called when a message is received over the TLS websocket, calls the message callback
-    void on_message(std::string&& message);
+    /// \brief Called when the message in recv_buffered_message has been received completely over the TLS websocket,
+    /// calls the message callback
+    void on_message();
 
     void request_write();
 
-    void poll_message(const std::shared_ptr<WebsocketMessage>& msg);
+    /// \brief Queues the \p msg for writing. Unless the single threaded event loop is used, this waits until the
+    /// message has been written
+    /// \returns true if the message has been written or, with the single threaded event loop, queued for writing
+    bool poll_message(const std::shared_ptr<WebsocketMessage>& msg);
 
     /// \brief Function to handle the deferred callbacks
     void handle_deferred_callback_queue();
@@ -84,6 +104,13 @@ private:
     /// \brief Add a callback to the queue of callbacks to be executed. All will be executed from a single thread
     void push_deferred_callback(const std::function<void()>& callback);
 
+    /// \brief Arms the reconnect timer for a reconnect at \p reconnect_at, with intermediate probes of the CSMS if
+    /// configured. Must be called with the reconnect_mutex held
+    void schedule_reconnect(const std::chrono::steady_clock::time_point reconnect_at);
+
+    /// \brief Probes the CSMS and brings the reconnect planned at \p reconnect_at forward if it is reachable
+    void on_reconnect_probe(const std::chrono::steady_clock::time_point reconnect_at);
+
 private:
     std::shared_ptr<EvseSecurity> evse_security;
 
@@ -94,18 +121,26 @@ private:
     std::unique_ptr<std::thread> websocket_thread;
     std::shared_ptr<ConnectionData> conn_data;
     std::condition_variable conn_cv;
+    // TLS context and session that are kept across reconnects, only used from the client loop thread
+    std::unique_ptr<TlsContextCache> tls_context_cache;
 
     std::mutex queue_mutex;
 
+    std::unique_ptr<WebsocketMessagePool> message_pool;
     std::queue<std::shared_ptr<WebsocketMessage>> message_queue;
     std::condition_variable msg_send_cv;
     std::mutex msg_send_cv_mutex;
 
     std::unique_ptr<std::thread> recv_message_thread;
     std::mutex recv_mutex;
-    std::queue<std::string> recv_message_queue;
+    std::queue<std::pair<std::string, std::chrono::steady_clock::time_point>> recv_message_queue;
     std::condition_variable recv_message_cv;
+    // Assembles the fragments of the message that is currently received, keeps its capacity across messages
     std::string recv_buffered_message;
+    // Set while the fragments of a message that exceeds the maximum message size are skipped
+    bool recv_discarding_message = false;
+    // Buffers of already processed messages that are reused for assembling the next received messages
+    std::vector<std::string> recv_spare_buffers;
 
     std::unique_ptr<std::thread> deferred_callback_thread;
     std::queue<std::function<void()>> deferred_callback_queue;
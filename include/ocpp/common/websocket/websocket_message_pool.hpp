@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_WEBSOCKET_MESSAGE_POOL_HPP
+#define OCPP_WEBSOCKET_MESSAGE_POOL_HPP
+
+#include <libwebsockets.h>
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ocpp {
+
+struct WebsocketMessage {
+    WebsocketMessage() : payload_length(0), protocol(LWS_WRITE_TEXT), sent_bytes(0), message_sent(false) {
+    }
+
+    virtual ~WebsocketMessage() {
+    }
+
+    /// \brief Copies the \p message behind the LWS_PRE bytes that libwebsockets requires in front of every write, so
+    /// that the buffer can be handed to lws_write as it is
+    void set_payload(const std::string& message, lws_write_protocol write_protocol) {
+        if (buffer.size() < LWS_PRE + message.length()) {
+            buffer.resize(LWS_PRE + message.length());
+        }
+        std::memcpy(buffer.data() + LWS_PRE, message.data(), message.length());
+        payload_length = message.length();
+        protocol = write_protocol;
+        sent_bytes = 0;
+        message_sent = false;
+    }
+
+    unsigned char* payload_data() {
+        return buffer.data() + LWS_PRE;
+    }
+
+    std::string_view payload() const {
+        return std::string_view(reinterpret_cast<const char*>(buffer.data() + LWS_PRE), payload_length);
+    }
+
+public:
+    // LWS_PRE bytes of padding followed by the payload, kept allocated while the message is pooled
+    std::vector<unsigned char> buffer;
+    size_t payload_length;
+    lws_write_protocol protocol;
+
+    // How many bytes we have sent to libwebsockets, does not
+    // necessarily mean that all bytes have been sent over the wire,
+    // just that these were sent to libwebsockets
+    size_t sent_bytes;
+    // If libwebsockets has sent all the bytes through the wire
+    std::atomic_bool message_sent;
+};
+
+/// \brief Pool of messages that are reused for sending, so that a send neither allocates a message nor its buffer
+/// once the pool is warmed up
+class WebsocketMessagePool {
+public:
+    /// \brief Returns a message that is neither queued nor waited for anymore with the given \p message as payload.
+    /// A new message is only allocated if all pooled messages are in use
+    std::shared_ptr<WebsocketMessage> acquire(const std::string& message, lws_write_protocol protocol) {
+        std::shared_ptr<WebsocketMessage> msg;
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            // only the pool hands out references, so a message that is solely referenced by the pool can not be
+            // referenced by another thread again until it is returned from here
+            for (const auto& pooled : this->messages) {
+                if (pooled.use_count() == 1) {
+                    msg = pooled;
+                    break;
+                }
+            }
+            if (msg == nullptr) {
+                msg = std::make_shared<WebsocketMessage>();
+                if (this->messages.size() < MAX_POOLED_MESSAGES) {
+                    this->messages.push_back(msg);
+                }
+            }
+        }
+        // pairs with the release of the last reference by the sending or the lws thread
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        // do not keep the memory of an exceptionally large message around
+        if (msg->buffer.capacity() > MAX_POOLED_BUFFER_SIZE) {
+            std::vector<unsigned char>().swap(msg->buffer);
+        }
+        msg->set_payload(message, protocol);
+        return msg;
+    }
+
+    /// \brief Number of messages that are kept for reuse
+    static constexpr size_t MAX_POOLED_MESSAGES = 8;
+    /// \brief Buffers with a larger capacity are released instead of being reused
+    static constexpr size_t MAX_POOLED_BUFFER_SIZE = 64 * 1024;
+
+private:
+    std::mutex mutex;
+    std::vector<std::shared_ptr<WebsocketMessage>> messages;
+};
+
+} // namespace ocpp
+#endif // OCPP_WEBSOCKET_MESSAGE_POOL_HPP
@@ -3,6 +3,7 @@
 #ifndef OCPP_V16_CHARGE_POINT_HPP
 #define OCPP_V16_CHARGE_POINT_HPP
 
+#include <ocpp/common/charging_station_host.hpp>
 #include <ocpp/common/cistring.hpp>
 #include <ocpp/common/evse_security.hpp>
 #include <ocpp/common/evse_security_impl.hpp>
@@ -64,10 +65,13 @@ public:
     /// security_configuration must be set
     /// \param security_configuration specifies the file paths that are required to set up the internal evse_security
     /// implementation
+    /// \param host optional host that runs the timers of the charge point together with those of other charge points;
+    /// if nullptr the charge point starts a thread of its own for them
     explicit ChargePoint(const std::string& config, const fs::path& share_path, const fs::path& user_config_path,
                          const fs::path& database_path, const fs::path& sql_init_path, const fs::path& message_log_path,
                          const std::shared_ptr<EvseSecurity> evse_security,
-                         const std::optional<SecurityConfiguration> security_configuration = std::nullopt);
+                         const std::optional<SecurityConfiguration> security_configuration = std::nullopt,
+                         std::shared_ptr<ChargingStationHost> host = nullptr);
 
     ~ChargePoint();
 
@@ -102,9 +102,15 @@ public:
     KeyValue getSupportedMeasurandsKeyValue();
     int getMaxMessageSize();
     KeyValue getMaxMessageSizeKeyValue();
+    int getMaxReceivedMessageSize();
+    KeyValue getMaxReceivedMessageSizeKeyValue();
 
     bool getEnableTLSKeylog();
     std::string getTLSKeylogFile();
+    bool getWebsocketPermessageDeflate();
+    int getWebsocketPermessageDeflateWindowBits();
+    int getWebsocketPermessageDeflateCompressionLevel();
+    int getReconnectProbeInterval();
 
     int32_t getRetryBackoffRandomRange();
     void setRetryBackoffRandomRange(int32_t retry_backoff_random_range);
@@ -142,6 +148,30 @@ public:
     std::optional<int> getMessageQueueSizeThreshold();
     std::optional<KeyValue> getMessageQueueSizeThresholdKeyValue();
 
+    std::optional<int> getMessageQueueMaxMessagesInFlight();
+    std::optional<KeyValue> getMessageQueueMaxMessagesInFlightKeyValue();
+
+    std::optional<std::string> getMessageQueueHighPriorityMessageTypes();
+    std::optional<KeyValue> getMessageQueueHighPriorityMessageTypesKeyValue();
+
+    std::optional<std::string> getMessageQueueLowPriorityMessageTypes();
+    std::optional<KeyValue> getMessageQueueLowPriorityMessageTypesKeyValue();
+
+    std::optional<bool> getMessageQueueHighPriorityBeforeTransactionMessages();
+    std::optional<KeyValue> getMessageQueueHighPriorityBeforeTransactionMessagesKeyValue();
+
+    std::optional<bool> getMessageQueueWeightedFairScheduling();
+    std::optional<KeyValue> getMessageQueueWeightedFairSchedulingKeyValue();
+
+    std::optional<std::string> getMessageQueueCoalescedMessageTypes();
+    std::optional<KeyValue> getMessageQueueCoalescedMessageTypesKeyValue();
+
+    std::optional<std::string> getMessageQueueDirectlyDeserializedMessageTypes();
+    std::optional<KeyValue> getMessageQueueDirectlyDeserializedMessageTypesKeyValue();
+
+    std::optional<std::string> getMessageSchemasPath();
+    std::optional<KeyValue> getMessageSchemasPathKeyValue();
+
     // Core Profile - optional
     std::optional<bool> getAllowOfflineTxForUnknownId();
     void setAllowOfflineTxForUnknownId(bool enabled);
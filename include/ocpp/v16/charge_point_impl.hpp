@@ -17,6 +17,7 @@
 #include <ocpp/common/aligned_timer.hpp>
 #include <ocpp/common/charging_station_base.hpp>
 #include <ocpp/common/message_queue.hpp>
+#include <ocpp/common/message_schema_validator.hpp>
 #include <ocpp/common/schemas.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/common/websocket/websocket.hpp>
@@ -95,8 +96,11 @@ private:
     std::string message_log_path;
 
     std::unique_ptr<Websocket> websocket;
+    // keeps the reconnect backoff per security profile across the websockets created on security profile switches
+    std::shared_ptr<ReconnectScheduler> reconnect_scheduler;
     Everest::SteadyTimer websocket_timer;
     std::unique_ptr<MessageQueue<v16::MessageType>> message_queue;
+    std::unique_ptr<MessageSchemaValidator<v16::MessageType>> message_schema_validator;
     std::map<int32_t, std::shared_ptr<Connector>> connectors;
     std::unique_ptr<SmartChargingHandler> smart_charging_handler;
     int32_t heartbeat_interval;
@@ -129,7 +133,7 @@ private:
     std::function<DataTransferResponse(const DataTransferRequest& request)> data_transfer_callback;
     std::map<std::string, std::function<void(Call<DataTransferRequest> call)>> data_transfer_pnc_callbacks;
     std::mutex data_transfer_callbacks_mutex;
-    std::map<CiString<50>, std::function<void(const KeyValue& key_value)>> configuration_key_changed_callbacks;
+    CiStringMap<50, std::function<void(const KeyValue& key_value)>> configuration_key_changed_callbacks;
     std::function<void(const KeyValue& key_value)> generic_configuration_key_changed_callback;
 
     std::mutex stop_transaction_mutex;
@@ -401,13 +405,14 @@ public:
     /// also available) configuration keys in the "Internal" section of the config file. Please note that this is
     /// intended for debugging purposes only as it logs all communication, including authentication messages.
     /// \param evse_security Pointer to evse_security that manages security related operations
+    /// \param host optional host that runs the timers of the charge point together with those of other charge points
     explicit ChargePointImpl(const std::string& config, const fs::path& share_path, const fs::path& user_config_path,
                              const fs::path& database_path, const fs::path& sql_init_path,
                              const fs::path& message_log_path, const std::shared_ptr<EvseSecurity> evse_security,
-                             const std::optional<SecurityConfiguration> security_configuration);
+                             const std::optional<SecurityConfiguration> security_configuration,
+                             std::shared_ptr<ChargingStationHost> host = nullptr);
 
-    ~ChargePointImpl() {
-    }
+    ~ChargePointImpl();
 
     /// \brief Starts the ChargePoint, initializes and connects to the Websocket endpoint and initializes a
     /// BootNotification.req
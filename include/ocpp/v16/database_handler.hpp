@@ -6,6 +6,7 @@
 #include "sqlite3.h"
 #include <fstream>
 #include <iostream>
+#include <mutex>
 
 #include <ocpp/common/database/database_handler_common.hpp>
 #include <ocpp/common/schemas.hpp>
@@ -44,10 +45,30 @@ class DatabaseHandler : public ocpp::common::DatabaseHandlerCommon {
 private:
     const int32_t number_of_connectors;
 
+    /// \brief In-memory copy of the AUTH_CACHE or AUTH_LIST table with case insensitive idTag keys. The table is read
+    /// on first use, afterwards lookups are answered from the copy and changes are written to both
+    struct AuthorizationTable {
+        const std::string name;        ///< name of the database table
+        const std::string description; ///< used in log messages
+        bool loaded = false;
+        CiStringMap<20, v16::IdTagInfo> entries;
+    };
+    std::mutex authorization_tables_mutex;
+    AuthorizationTable authorization_cache{"AUTH_CACHE", "auth cache"};
+    AuthorizationTable local_authorization_list{"AUTH_LIST", "auth list"};
+
     // Runs initialization script and initializes the CONNECTORS and AUTH_LIST_VERSION table.
     void init_sql() override;
     void init_connector_table();
 
+    // The following functions expect the authorization_tables_mutex to be held
+    void load_authorization_table(AuthorizationTable& table);
+    void insert_or_update_authorization_table_entry(AuthorizationTable& table, const CiString<20>& id_tag,
+                                                    const v16::IdTagInfo& id_tag_info);
+    std::optional<v16::IdTagInfo> get_authorization_table_entry(AuthorizationTable& table,
+                                                                const CiString<20>& id_tag);
+    void clear_authorization_table(AuthorizationTable& table);
+
 public:
     DatabaseHandler(std::unique_ptr<common::DatabaseConnectionInterface> database,
                     const fs::path& sql_migration_files_path, int32_t number_of_connectors);
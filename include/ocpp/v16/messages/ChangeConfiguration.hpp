@@ -7,6 +7,8 @@
 
 #include <nlohmann/json_fwd.hpp>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
@@ -30,6 +32,12 @@ void to_json(json& j, const ChangeConfigurationRequest& k);
 /// \brief Conversion from a given json object \p j to a given ChangeConfigurationRequest \p k
 void from_json(const json& j, ChangeConfigurationRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChangeConfigurationRequest
+const JsonSaxFields& json_sax_fields(const ChangeConfigurationRequest*);
+
+/// \brief Writes the given ChangeConfigurationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChangeConfigurationRequest& k);
+
 /// \brief Writes the string representation of the given ChangeConfigurationRequest \p k to the given output stream \p
 /// os \returns an output stream with the ChangeConfigurationRequest written to
 std::ostream& operator<<(std::ostream& os, const ChangeConfigurationRequest& k);
@@ -49,6 +57,12 @@ void to_json(json& j, const ChangeConfigurationResponse& k);
 /// \brief Conversion from a given json object \p j to a given ChangeConfigurationResponse \p k
 void from_json(const json& j, ChangeConfigurationResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChangeConfigurationResponse
+const JsonSaxFields& json_sax_fields(const ChangeConfigurationResponse*);
+
+/// \brief Writes the given ChangeConfigurationResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChangeConfigurationResponse& k);
+
 /// \brief Writes the string representation of the given ChangeConfigurationResponse \p k to the given output stream \p
 /// os \returns an output stream with the ChangeConfigurationResponse written to
 std::ostream& operator<<(std::ostream& os, const ChangeConfigurationResponse& k);
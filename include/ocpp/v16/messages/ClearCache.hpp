@@ -7,6 +7,8 @@
 
 #include <nlohmann/json_fwd.hpp>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 
@@ -27,6 +29,12 @@ void to_json(json& j, const ClearCacheRequest& k);
 /// \brief Conversion from a given json object \p j to a given ClearCacheRequest \p k
 void from_json(const json& j, ClearCacheRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearCacheRequest
+const JsonSaxFields& json_sax_fields(const ClearCacheRequest*);
+
+/// \brief Writes the given ClearCacheRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearCacheRequest& k);
+
 /// \brief Writes the string representation of the given ClearCacheRequest \p k to the given output stream \p os
 /// \returns an output stream with the ClearCacheRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearCacheRequest& k);
@@ -46,6 +54,12 @@ void to_json(json& j, const ClearCacheResponse& k);
 /// \brief Conversion from a given json object \p j to a given ClearCacheResponse \p k
 void from_json(const json& j, ClearCacheResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearCacheResponse
+const JsonSaxFields& json_sax_fields(const ClearCacheResponse*);
+
+/// \brief Writes the given ClearCacheResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearCacheResponse& k);
+
 /// \brief Writes the string representation of the given ClearCacheResponse \p k to the given output stream \p os
 /// \returns an output stream with the ClearCacheResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearCacheResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
@@ -32,6 +34,12 @@ void to_json(json& j, const DataTransferRequest& k);
 /// \brief Conversion from a given json object \p j to a given DataTransferRequest \p k
 void from_json(const json& j, DataTransferRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a DataTransferRequest
+const JsonSaxFields& json_sax_fields(const DataTransferRequest*);
+
+/// \brief Writes the given DataTransferRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const DataTransferRequest& k);
+
 /// \brief Writes the string representation of the given DataTransferRequest \p k to the given output stream \p os
 /// \returns an output stream with the DataTransferRequest written to
 std::ostream& operator<<(std::ostream& os, const DataTransferRequest& k);
@@ -52,6 +60,12 @@ void to_json(json& j, const DataTransferResponse& k);
 /// \brief Conversion from a given json object \p j to a given DataTransferResponse \p k
 void from_json(const json& j, DataTransferResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a DataTransferResponse
+const JsonSaxFields& json_sax_fields(const DataTransferResponse*);
+
+/// \brief Writes the given DataTransferResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const DataTransferResponse& k);
+
 /// \brief Writes the string representation of the given DataTransferResponse \p k to the given output stream \p os
 /// \returns an output stream with the DataTransferResponse written to
 std::ostream& operator<<(std::ostream& os, const DataTransferResponse& k);
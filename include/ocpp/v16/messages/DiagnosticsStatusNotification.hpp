@@ -7,6 +7,8 @@
 
 #include <nlohmann/json_fwd.hpp>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 
@@ -28,6 +30,14 @@ void to_json(json& j, const DiagnosticsStatusNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given DiagnosticsStatusNotificationRequest \p k
 void from_json(const json& j, DiagnosticsStatusNotificationRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a
+/// DiagnosticsStatusNotificationRequest
+const JsonSaxFields& json_sax_fields(const DiagnosticsStatusNotificationRequest*);
+
+/// \brief Writes the given DiagnosticsStatusNotificationRequest \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const DiagnosticsStatusNotificationRequest& k);
+
 /// \brief Writes the string representation of the given DiagnosticsStatusNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the DiagnosticsStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const DiagnosticsStatusNotificationRequest& k);
@@ -46,6 +56,14 @@ void to_json(json& j, const DiagnosticsStatusNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given DiagnosticsStatusNotificationResponse \p k
 void from_json(const json& j, DiagnosticsStatusNotificationResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a
+/// DiagnosticsStatusNotificationResponse
+const JsonSaxFields& json_sax_fields(const DiagnosticsStatusNotificationResponse*);
+
+/// \brief Writes the given DiagnosticsStatusNotificationResponse \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const DiagnosticsStatusNotificationResponse& k);
+
 /// \brief Writes the string representation of the given DiagnosticsStatusNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the DiagnosticsStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const DiagnosticsStatusNotificationResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 
@@ -30,6 +32,12 @@ void to_json(json& j, const ExtendedTriggerMessageRequest& k);
 /// \brief Conversion from a given json object \p j to a given ExtendedTriggerMessageRequest \p k
 void from_json(const json& j, ExtendedTriggerMessageRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ExtendedTriggerMessageRequest
+const JsonSaxFields& json_sax_fields(const ExtendedTriggerMessageRequest*);
+
+/// \brief Writes the given ExtendedTriggerMessageRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ExtendedTriggerMessageRequest& k);
+
 /// \brief Writes the string representation of the given ExtendedTriggerMessageRequest \p k to the given output stream
 /// \p os \returns an output stream with the ExtendedTriggerMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const ExtendedTriggerMessageRequest& k);
@@ -49,6 +57,12 @@ void to_json(json& j, const ExtendedTriggerMessageResponse& k);
 /// \brief Conversion from a given json object \p j to a given ExtendedTriggerMessageResponse \p k
 void from_json(const json& j, ExtendedTriggerMessageResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ExtendedTriggerMessageResponse
+const JsonSaxFields& json_sax_fields(const ExtendedTriggerMessageResponse*);
+
+/// \brief Writes the given ExtendedTriggerMessageResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ExtendedTriggerMessageResponse& k);
+
 /// \brief Writes the string representation of the given ExtendedTriggerMessageResponse \p k to the given output stream
 /// \p os \returns an output stream with the ExtendedTriggerMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const ExtendedTriggerMessageResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 
@@ -31,6 +33,12 @@ void to_json(json& j, const GetCompositeScheduleRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetCompositeScheduleRequest \p k
 void from_json(const json& j, GetCompositeScheduleRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetCompositeScheduleRequest
+const JsonSaxFields& json_sax_fields(const GetCompositeScheduleRequest*);
+
+/// \brief Writes the given GetCompositeScheduleRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetCompositeScheduleRequest& k);
+
 /// \brief Writes the string representation of the given GetCompositeScheduleRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetCompositeScheduleRequest written to
 std::ostream& operator<<(std::ostream& os, const GetCompositeScheduleRequest& k);
@@ -53,6 +61,12 @@ void to_json(json& j, const GetCompositeScheduleResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetCompositeScheduleResponse \p k
 void from_json(const json& j, GetCompositeScheduleResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetCompositeScheduleResponse
+const JsonSaxFields& json_sax_fields(const GetCompositeScheduleResponse*);
+
+/// \brief Writes the given GetCompositeScheduleResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetCompositeScheduleResponse& k);
+
 /// \brief Writes the string representation of the given GetCompositeScheduleResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetCompositeScheduleResponse written to
 std::ostream& operator<<(std::ostream& os, const GetCompositeScheduleResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 
@@ -29,6 +31,12 @@ void to_json(json& j, const GetConfigurationRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetConfigurationRequest \p k
 void from_json(const json& j, GetConfigurationRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetConfigurationRequest
+const JsonSaxFields& json_sax_fields(const GetConfigurationRequest*);
+
+/// \brief Writes the given GetConfigurationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetConfigurationRequest& k);
+
 /// \brief Writes the string representation of the given GetConfigurationRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetConfigurationRequest written to
 std::ostream& operator<<(std::ostream& os, const GetConfigurationRequest& k);
@@ -49,6 +57,12 @@ void to_json(json& j, const GetConfigurationResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetConfigurationResponse \p k
 void from_json(const json& j, GetConfigurationResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetConfigurationResponse
+const JsonSaxFields& json_sax_fields(const GetConfigurationResponse*);
+
+/// \brief Writes the given GetConfigurationResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetConfigurationResponse& k);
+
 /// \brief Writes the string representation of the given GetConfigurationResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetConfigurationResponse written to
 std::ostream& operator<<(std::ostream& os, const GetConfigurationResponse& k);
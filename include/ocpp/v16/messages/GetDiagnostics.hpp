@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 
@@ -33,6 +35,12 @@ void to_json(json& j, const GetDiagnosticsRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetDiagnosticsRequest \p k
 void from_json(const json& j, GetDiagnosticsRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetDiagnosticsRequest
+const JsonSaxFields& json_sax_fields(const GetDiagnosticsRequest*);
+
+/// \brief Writes the given GetDiagnosticsRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetDiagnosticsRequest& k);
+
 /// \brief Writes the string representation of the given GetDiagnosticsRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetDiagnosticsRequest written to
 std::ostream& operator<<(std::ostream& os, const GetDiagnosticsRequest& k);
@@ -52,6 +60,12 @@ void to_json(json& j, const GetDiagnosticsResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetDiagnosticsResponse \p k
 void from_json(const json& j, GetDiagnosticsResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetDiagnosticsResponse
+const JsonSaxFields& json_sax_fields(const GetDiagnosticsResponse*);
+
+/// \brief Writes the given GetDiagnosticsResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetDiagnosticsResponse& k);
+
 /// \brief Writes the string representation of the given GetDiagnosticsResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetDiagnosticsResponse written to
 std::ostream& operator<<(std::ostream& os, const GetDiagnosticsResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 
@@ -29,6 +31,13 @@ void to_json(json& j, const GetInstalledCertificateIdsRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetInstalledCertificateIdsRequest \p k
 void from_json(const json& j, GetInstalledCertificateIdsRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetInstalledCertificateIdsRequest
+const JsonSaxFields& json_sax_fields(const GetInstalledCertificateIdsRequest*);
+
+/// \brief Writes the given GetInstalledCertificateIdsRequest \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsRequest& k);
+
 /// \brief Writes the string representation of the given GetInstalledCertificateIdsRequest \p k to the given output
 /// stream \p os \returns an output stream with the GetInstalledCertificateIdsRequest written to
 std::ostream& operator<<(std::ostream& os, const GetInstalledCertificateIdsRequest& k);
@@ -49,6 +58,13 @@ void to_json(json& j, const GetInstalledCertificateIdsResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetInstalledCertificateIdsResponse \p k
 void from_json(const json& j, GetInstalledCertificateIdsResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetInstalledCertificateIdsResponse
+const JsonSaxFields& json_sax_fields(const GetInstalledCertificateIdsResponse*);
+
+/// \brief Writes the given GetInstalledCertificateIdsResponse \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsResponse& k);
+
 /// \brief Writes the string representation of the given GetInstalledCertificateIdsResponse \p k to the given output
 /// stream \p os \returns an output stream with the GetInstalledCertificateIdsResponse written to
 std::ostream& operator<<(std::ostream& os, const GetInstalledCertificateIdsResponse& k);
@@ -7,6 +7,8 @@
 
 #include <nlohmann/json_fwd.hpp>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 
 namespace ocpp {
@@ -26,6 +28,12 @@ void to_json(json& j, const GetLocalListVersionRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetLocalListVersionRequest \p k
 void from_json(const json& j, GetLocalListVersionRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetLocalListVersionRequest
+const JsonSaxFields& json_sax_fields(const GetLocalListVersionRequest*);
+
+/// \brief Writes the given GetLocalListVersionRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetLocalListVersionRequest& k);
+
 /// \brief Writes the string representation of the given GetLocalListVersionRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetLocalListVersionRequest written to
 std::ostream& operator<<(std::ostream& os, const GetLocalListVersionRequest& k);
@@ -45,6 +53,12 @@ void to_json(json& j, const GetLocalListVersionResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetLocalListVersionResponse \p k
 void from_json(const json& j, GetLocalListVersionResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetLocalListVersionResponse
+const JsonSaxFields& json_sax_fields(const GetLocalListVersionResponse*);
+
+/// \brief Writes the given GetLocalListVersionResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetLocalListVersionResponse& k);
+
 /// \brief Writes the string representation of the given GetLocalListVersionResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetLocalListVersionResponse written to
 std::ostream& operator<<(std::ostream& os, const GetLocalListVersionResponse& k);
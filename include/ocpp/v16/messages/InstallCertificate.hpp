@@ -7,6 +7,8 @@
 
 #include <nlohmann/json_fwd.hpp>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 
@@ -29,6 +31,12 @@ void to_json(json& j, const InstallCertificateRequest& k);
 /// \brief Conversion from a given json object \p j to a given InstallCertificateRequest \p k
 void from_json(const json& j, InstallCertificateRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a InstallCertificateRequest
+const JsonSaxFields& json_sax_fields(const InstallCertificateRequest*);
+
+/// \brief Writes the given InstallCertificateRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const InstallCertificateRequest& k);
+
 /// \brief Writes the string representation of the given InstallCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the InstallCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const InstallCertificateRequest& k);
@@ -48,6 +56,12 @@ void to_json(json& j, const InstallCertificateResponse& k);
 /// \brief Conversion from a given json object \p j to a given InstallCertificateResponse \p k
 void from_json(const json& j, InstallCertificateResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a InstallCertificateResponse
+const JsonSaxFields& json_sax_fields(const InstallCertificateResponse*);
+
+/// \brief Writes the given InstallCertificateResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const InstallCertificateResponse& k);
+
 /// \brief Writes the string representation of the given InstallCertificateResponse \p k to the given output stream \p
 /// os \returns an output stream with the InstallCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const InstallCertificateResponse& k);
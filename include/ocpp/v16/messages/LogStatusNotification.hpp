@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 
@@ -30,6 +32,12 @@ void to_json(json& j, const LogStatusNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given LogStatusNotificationRequest \p k
 void from_json(const json& j, LogStatusNotificationRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a LogStatusNotificationRequest
+const JsonSaxFields& json_sax_fields(const LogStatusNotificationRequest*);
+
+/// \brief Writes the given LogStatusNotificationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const LogStatusNotificationRequest& k);
+
 /// \brief Writes the string representation of the given LogStatusNotificationRequest \p k to the given output stream \p
 /// os \returns an output stream with the LogStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const LogStatusNotificationRequest& k);
@@ -48,6 +56,12 @@ void to_json(json& j, const LogStatusNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given LogStatusNotificationResponse \p k
 void from_json(const json& j, LogStatusNotificationResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a LogStatusNotificationResponse
+const JsonSaxFields& json_sax_fields(const LogStatusNotificationResponse*);
+
+/// \brief Writes the given LogStatusNotificationResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const LogStatusNotificationResponse& k);
+
 /// \brief Writes the string representation of the given LogStatusNotificationResponse \p k to the given output stream
 /// \p os \returns an output stream with the LogStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const LogStatusNotificationResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
@@ -32,6 +34,12 @@ void to_json(json& j, const RemoteStartTransactionRequest& k);
 /// \brief Conversion from a given json object \p j to a given RemoteStartTransactionRequest \p k
 void from_json(const json& j, RemoteStartTransactionRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a RemoteStartTransactionRequest
+const JsonSaxFields& json_sax_fields(const RemoteStartTransactionRequest*);
+
+/// \brief Writes the given RemoteStartTransactionRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const RemoteStartTransactionRequest& k);
+
 /// \brief Writes the string representation of the given RemoteStartTransactionRequest \p k to the given output stream
 /// \p os \returns an output stream with the RemoteStartTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RemoteStartTransactionRequest& k);
@@ -51,6 +59,12 @@ void to_json(json& j, const RemoteStartTransactionResponse& k);
 /// \brief Conversion from a given json object \p j to a given RemoteStartTransactionResponse \p k
 void from_json(const json& j, RemoteStartTransactionResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a RemoteStartTransactionResponse
+const JsonSaxFields& json_sax_fields(const RemoteStartTransactionResponse*);
+
+/// \brief Writes the given RemoteStartTransactionResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const RemoteStartTransactionResponse& k);
+
 /// \brief Writes the string representation of the given RemoteStartTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RemoteStartTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RemoteStartTransactionResponse& k);
@@ -7,6 +7,8 @@
 
 #include <nlohmann/json_fwd.hpp>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 
@@ -28,6 +30,12 @@ void to_json(json& j, const RemoteStopTransactionRequest& k);
 /// \brief Conversion from a given json object \p j to a given RemoteStopTransactionRequest \p k
 void from_json(const json& j, RemoteStopTransactionRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a RemoteStopTransactionRequest
+const JsonSaxFields& json_sax_fields(const RemoteStopTransactionRequest*);
+
+/// \brief Writes the given RemoteStopTransactionRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const RemoteStopTransactionRequest& k);
+
 /// \brief Writes the string representation of the given RemoteStopTransactionRequest \p k to the given output stream \p
 /// os \returns an output stream with the RemoteStopTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RemoteStopTransactionRequest& k);
@@ -47,6 +55,12 @@ void to_json(json& j, const RemoteStopTransactionResponse& k);
 /// \brief Conversion from a given json object \p j to a given RemoteStopTransactionResponse \p k
 void from_json(const json& j, RemoteStopTransactionResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a RemoteStopTransactionResponse
+const JsonSaxFields& json_sax_fields(const RemoteStopTransactionResponse*);
+
+/// \brief Writes the given RemoteStopTransactionResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const RemoteStopTransactionResponse& k);
+
 /// \brief Writes the string representation of the given RemoteStopTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RemoteStopTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RemoteStopTransactionResponse& k);
@@ -7,6 +7,8 @@
 
 #include <nlohmann/json_fwd.hpp>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 
@@ -28,6 +30,12 @@ void to_json(json& j, const ResetRequest& k);
 /// \brief Conversion from a given json object \p j to a given ResetRequest \p k
 void from_json(const json& j, ResetRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ResetRequest
+const JsonSaxFields& json_sax_fields(const ResetRequest*);
+
+/// \brief Writes the given ResetRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ResetRequest& k);
+
 /// \brief Writes the string representation of the given ResetRequest \p k to the given output stream \p os
 /// \returns an output stream with the ResetRequest written to
 std::ostream& operator<<(std::ostream& os, const ResetRequest& k);
@@ -47,6 +55,12 @@ void to_json(json& j, const ResetResponse& k);
 /// \brief Conversion from a given json object \p j to a given ResetResponse \p k
 void from_json(const json& j, ResetResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ResetResponse
+const JsonSaxFields& json_sax_fields(const ResetResponse*);
+
+/// \brief Writes the given ResetResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ResetResponse& k);
+
 /// \brief Writes the string representation of the given ResetResponse \p k to the given output stream \p os
 /// \returns an output stream with the ResetResponse written to
 std::ostream& operator<<(std::ostream& os, const ResetResponse& k);
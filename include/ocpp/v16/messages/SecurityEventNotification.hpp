@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 
@@ -31,6 +33,12 @@ void to_json(json& j, const SecurityEventNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given SecurityEventNotificationRequest \p k
 void from_json(const json& j, SecurityEventNotificationRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SecurityEventNotificationRequest
+const JsonSaxFields& json_sax_fields(const SecurityEventNotificationRequest*);
+
+/// \brief Writes the given SecurityEventNotificationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SecurityEventNotificationRequest& k);
+
 /// \brief Writes the string representation of the given SecurityEventNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the SecurityEventNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const SecurityEventNotificationRequest& k);
@@ -49,6 +57,13 @@ void to_json(json& j, const SecurityEventNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given SecurityEventNotificationResponse \p k
 void from_json(const json& j, SecurityEventNotificationResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SecurityEventNotificationResponse
+const JsonSaxFields& json_sax_fields(const SecurityEventNotificationResponse*);
+
+/// \brief Writes the given SecurityEventNotificationResponse \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const SecurityEventNotificationResponse& k);
+
 /// \brief Writes the string representation of the given SecurityEventNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the SecurityEventNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const SecurityEventNotificationResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
@@ -32,6 +34,12 @@ void to_json(json& j, const SendLocalListRequest& k);
 /// \brief Conversion from a given json object \p j to a given SendLocalListRequest \p k
 void from_json(const json& j, SendLocalListRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SendLocalListRequest
+const JsonSaxFields& json_sax_fields(const SendLocalListRequest*);
+
+/// \brief Writes the given SendLocalListRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SendLocalListRequest& k);
+
 /// \brief Writes the string representation of the given SendLocalListRequest \p k to the given output stream \p os
 /// \returns an output stream with the SendLocalListRequest written to
 std::ostream& operator<<(std::ostream& os, const SendLocalListRequest& k);
@@ -51,6 +59,12 @@ void to_json(json& j, const SendLocalListResponse& k);
 /// \brief Conversion from a given json object \p j to a given SendLocalListResponse \p k
 void from_json(const json& j, SendLocalListResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SendLocalListResponse
+const JsonSaxFields& json_sax_fields(const SendLocalListResponse*);
+
+/// \brief Writes the given SendLocalListResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SendLocalListResponse& k);
+
 /// \brief Writes the string representation of the given SendLocalListResponse \p k to the given output stream \p os
 /// \returns an output stream with the SendLocalListResponse written to
 std::ostream& operator<<(std::ostream& os, const SendLocalListResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 
@@ -30,6 +32,14 @@ void to_json(json& j, const SignedFirmwareStatusNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given SignedFirmwareStatusNotificationRequest \p k
 void from_json(const json& j, SignedFirmwareStatusNotificationRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a
+/// SignedFirmwareStatusNotificationRequest
+const JsonSaxFields& json_sax_fields(const SignedFirmwareStatusNotificationRequest*);
+
+/// \brief Writes the given SignedFirmwareStatusNotificationRequest \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const SignedFirmwareStatusNotificationRequest& k);
+
 /// \brief Writes the string representation of the given SignedFirmwareStatusNotificationRequest \p k to the given
 /// output stream \p os \returns an output stream with the SignedFirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const SignedFirmwareStatusNotificationRequest& k);
@@ -48,6 +58,14 @@ void to_json(json& j, const SignedFirmwareStatusNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given SignedFirmwareStatusNotificationResponse \p k
 void from_json(const json& j, SignedFirmwareStatusNotificationResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a
+/// SignedFirmwareStatusNotificationResponse
+const JsonSaxFields& json_sax_fields(const SignedFirmwareStatusNotificationResponse*);
+
+/// \brief Writes the given SignedFirmwareStatusNotificationResponse \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const SignedFirmwareStatusNotificationResponse& k);
+
 /// \brief Writes the string representation of the given SignedFirmwareStatusNotificationResponse \p k to the given
 /// output stream \p os \returns an output stream with the SignedFirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const SignedFirmwareStatusNotificationResponse& k);
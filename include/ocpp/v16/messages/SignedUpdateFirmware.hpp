@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 
@@ -32,6 +34,12 @@ void to_json(json& j, const SignedUpdateFirmwareRequest& k);
 /// \brief Conversion from a given json object \p j to a given SignedUpdateFirmwareRequest \p k
 void from_json(const json& j, SignedUpdateFirmwareRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SignedUpdateFirmwareRequest
+const JsonSaxFields& json_sax_fields(const SignedUpdateFirmwareRequest*);
+
+/// \brief Writes the given SignedUpdateFirmwareRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SignedUpdateFirmwareRequest& k);
+
 /// \brief Writes the string representation of the given SignedUpdateFirmwareRequest \p k to the given output stream \p
 /// os \returns an output stream with the SignedUpdateFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const SignedUpdateFirmwareRequest& k);
@@ -51,6 +59,12 @@ void to_json(json& j, const SignedUpdateFirmwareResponse& k);
 /// \brief Conversion from a given json object \p j to a given SignedUpdateFirmwareResponse \p k
 void from_json(const json& j, SignedUpdateFirmwareResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SignedUpdateFirmwareResponse
+const JsonSaxFields& json_sax_fields(const SignedUpdateFirmwareResponse*);
+
+/// \brief Writes the given SignedUpdateFirmwareResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SignedUpdateFirmwareResponse& k);
+
 /// \brief Writes the string representation of the given SignedUpdateFirmwareResponse \p k to the given output stream \p
 /// os \returns an output stream with the SignedUpdateFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const SignedUpdateFirmwareResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
@@ -34,6 +36,12 @@ void to_json(json& j, const StartTransactionRequest& k);
 /// \brief Conversion from a given json object \p j to a given StartTransactionRequest \p k
 void from_json(const json& j, StartTransactionRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a StartTransactionRequest
+const JsonSaxFields& json_sax_fields(const StartTransactionRequest*);
+
+/// \brief Writes the given StartTransactionRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const StartTransactionRequest& k);
+
 /// \brief Writes the string representation of the given StartTransactionRequest \p k to the given output stream \p os
 /// \returns an output stream with the StartTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const StartTransactionRequest& k);
@@ -54,6 +62,12 @@ void to_json(json& j, const StartTransactionResponse& k);
 /// \brief Conversion from a given json object \p j to a given StartTransactionResponse \p k
 void from_json(const json& j, StartTransactionResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a StartTransactionResponse
+const JsonSaxFields& json_sax_fields(const StartTransactionResponse*);
+
+/// \brief Writes the given StartTransactionResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const StartTransactionResponse& k);
+
 /// \brief Writes the string representation of the given StartTransactionResponse \p k to the given output stream \p os
 /// \returns an output stream with the StartTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const StartTransactionResponse& k);
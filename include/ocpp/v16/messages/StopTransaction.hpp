@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
@@ -35,6 +37,12 @@ void to_json(json& j, const StopTransactionRequest& k);
 /// \brief Conversion from a given json object \p j to a given StopTransactionRequest \p k
 void from_json(const json& j, StopTransactionRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a StopTransactionRequest
+const JsonSaxFields& json_sax_fields(const StopTransactionRequest*);
+
+/// \brief Writes the given StopTransactionRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const StopTransactionRequest& k);
+
 /// \brief Writes the string representation of the given StopTransactionRequest \p k to the given output stream \p os
 /// \returns an output stream with the StopTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const StopTransactionRequest& k);
@@ -54,6 +62,12 @@ void to_json(json& j, const StopTransactionResponse& k);
 /// \brief Conversion from a given json object \p j to a given StopTransactionResponse \p k
 void from_json(const json& j, StopTransactionResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a StopTransactionResponse
+const JsonSaxFields& json_sax_fields(const StopTransactionResponse*);
+
+/// \brief Writes the given StopTransactionResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const StopTransactionResponse& k);
+
 /// \brief Writes the string representation of the given StopTransactionResponse \p k to the given output stream \p os
 /// \returns an output stream with the StopTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const StopTransactionResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 
 namespace ocpp {
@@ -31,6 +33,12 @@ void to_json(json& j, const UpdateFirmwareRequest& k);
 /// \brief Conversion from a given json object \p j to a given UpdateFirmwareRequest \p k
 void from_json(const json& j, UpdateFirmwareRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a UpdateFirmwareRequest
+const JsonSaxFields& json_sax_fields(const UpdateFirmwareRequest*);
+
+/// \brief Writes the given UpdateFirmwareRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const UpdateFirmwareRequest& k);
+
 /// \brief Writes the string representation of the given UpdateFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the UpdateFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const UpdateFirmwareRequest& k);
@@ -49,6 +57,12 @@ void to_json(json& j, const UpdateFirmwareResponse& k);
 /// \brief Conversion from a given json object \p j to a given UpdateFirmwareResponse \p k
 void from_json(const json& j, UpdateFirmwareResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a UpdateFirmwareResponse
+const JsonSaxFields& json_sax_fields(const UpdateFirmwareResponse*);
+
+/// \brief Writes the given UpdateFirmwareResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const UpdateFirmwareResponse& k);
+
 /// \brief Writes the string representation of the given UpdateFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the UpdateFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const UpdateFirmwareResponse& k);
@@ -7,6 +7,7 @@
 
 #include <iosfwd>
 #include <string>
+#include <string_view>
 
 namespace ocpp {
 namespace v16 {
@@ -25,9 +26,9 @@ namespace conversions {
 /// \returns a string representation of the AuthorizationStatus
 std::string authorization_status_to_string(AuthorizationStatus e);
 
-/// \brief Converts the given std::string \p s to AuthorizationStatus
+/// \brief Converts the given std::string_view \p s to AuthorizationStatus
 /// \returns a AuthorizationStatus from a string representation
-AuthorizationStatus string_to_authorization_status(const std::string& s);
+AuthorizationStatus string_to_authorization_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given AuthorizationStatus \p authorization_status to the given output
@@ -46,9 +47,9 @@ namespace conversions {
 /// \returns a string representation of the RegistrationStatus
 std::string registration_status_to_string(RegistrationStatus e);
 
-/// \brief Converts the given std::string \p s to RegistrationStatus
+/// \brief Converts the given std::string_view \p s to RegistrationStatus
 /// \returns a RegistrationStatus from a string representation
-RegistrationStatus string_to_registration_status(const std::string& s);
+RegistrationStatus string_to_registration_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given RegistrationStatus \p registration_status to the given output
@@ -66,9 +67,9 @@ namespace conversions {
 /// \returns a string representation of the CancelReservationStatus
 std::string cancel_reservation_status_to_string(CancelReservationStatus e);
 
-/// \brief Converts the given std::string \p s to CancelReservationStatus
+/// \brief Converts the given std::string_view \p s to CancelReservationStatus
 /// \returns a CancelReservationStatus from a string representation
-CancelReservationStatus string_to_cancel_reservation_status(const std::string& s);
+CancelReservationStatus string_to_cancel_reservation_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given CancelReservationStatus \p cancel_reservation_status to the
@@ -86,9 +87,9 @@ namespace conversions {
 /// \returns a string representation of the CertificateSignedStatusEnumType
 std::string certificate_signed_status_enum_type_to_string(CertificateSignedStatusEnumType e);
 
-/// \brief Converts the given std::string \p s to CertificateSignedStatusEnumType
+/// \brief Converts the given std::string_view \p s to CertificateSignedStatusEnumType
 /// \returns a CertificateSignedStatusEnumType from a string representation
-CertificateSignedStatusEnumType string_to_certificate_signed_status_enum_type(const std::string& s);
+CertificateSignedStatusEnumType string_to_certificate_signed_status_enum_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given CertificateSignedStatusEnumType \p
@@ -107,9 +108,9 @@ namespace conversions {
 /// \returns a string representation of the AvailabilityType
 std::string availability_type_to_string(AvailabilityType e);
 
-/// \brief Converts the given std::string \p s to AvailabilityType
+/// \brief Converts the given std::string_view \p s to AvailabilityType
 /// \returns a AvailabilityType from a string representation
-AvailabilityType string_to_availability_type(const std::string& s);
+AvailabilityType string_to_availability_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given AvailabilityType \p availability_type to the given output
@@ -128,9 +129,9 @@ namespace conversions {
 /// \returns a string representation of the AvailabilityStatus
 std::string availability_status_to_string(AvailabilityStatus e);
 
-/// \brief Converts the given std::string \p s to AvailabilityStatus
+/// \brief Converts the given std::string_view \p s to AvailabilityStatus
 /// \returns a AvailabilityStatus from a string representation
-AvailabilityStatus string_to_availability_status(const std::string& s);
+AvailabilityStatus string_to_availability_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given AvailabilityStatus \p availability_status to the given output
@@ -150,9 +151,9 @@ namespace conversions {
 /// \returns a string representation of the ConfigurationStatus
 std::string configuration_status_to_string(ConfigurationStatus e);
 
-/// \brief Converts the given std::string \p s to ConfigurationStatus
+/// \brief Converts the given std::string_view \p s to ConfigurationStatus
 /// \returns a ConfigurationStatus from a string representation
-ConfigurationStatus string_to_configuration_status(const std::string& s);
+ConfigurationStatus string_to_configuration_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ConfigurationStatus \p configuration_status to the given output
@@ -170,9 +171,9 @@ namespace conversions {
 /// \returns a string representation of the ClearCacheStatus
 std::string clear_cache_status_to_string(ClearCacheStatus e);
 
-/// \brief Converts the given std::string \p s to ClearCacheStatus
+/// \brief Converts the given std::string_view \p s to ClearCacheStatus
 /// \returns a ClearCacheStatus from a string representation
-ClearCacheStatus string_to_clear_cache_status(const std::string& s);
+ClearCacheStatus string_to_clear_cache_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ClearCacheStatus \p clear_cache_status to the given output
@@ -191,9 +192,9 @@ namespace conversions {
 /// \returns a string representation of the ChargingProfilePurposeType
 std::string charging_profile_purpose_type_to_string(ChargingProfilePurposeType e);
 
-/// \brief Converts the given std::string \p s to ChargingProfilePurposeType
+/// \brief Converts the given std::string_view \p s to ChargingProfilePurposeType
 /// \returns a ChargingProfilePurposeType from a string representation
-ChargingProfilePurposeType string_to_charging_profile_purpose_type(const std::string& s);
+ChargingProfilePurposeType string_to_charging_profile_purpose_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ChargingProfilePurposeType \p charging_profile_purpose_type to
@@ -211,9 +212,9 @@ namespace conversions {
 /// \returns a string representation of the ClearChargingProfileStatus
 std::string clear_charging_profile_status_to_string(ClearChargingProfileStatus e);
 
-/// \brief Converts the given std::string \p s to ClearChargingProfileStatus
+/// \brief Converts the given std::string_view \p s to ClearChargingProfileStatus
 /// \returns a ClearChargingProfileStatus from a string representation
-ClearChargingProfileStatus string_to_clear_charging_profile_status(const std::string& s);
+ClearChargingProfileStatus string_to_clear_charging_profile_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ClearChargingProfileStatus \p clear_charging_profile_status to
@@ -233,9 +234,9 @@ namespace conversions {
 /// \returns a string representation of the DataTransferStatus
 std::string data_transfer_status_to_string(DataTransferStatus e);
 
-/// \brief Converts the given std::string \p s to DataTransferStatus
+/// \brief Converts the given std::string_view \p s to DataTransferStatus
 /// \returns a DataTransferStatus from a string representation
-DataTransferStatus string_to_data_transfer_status(const std::string& s);
+DataTransferStatus string_to_data_transfer_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given DataTransferStatus \p data_transfer_status to the given output
@@ -254,9 +255,9 @@ namespace conversions {
 /// \returns a string representation of the HashAlgorithmEnumType
 std::string hash_algorithm_enum_type_to_string(HashAlgorithmEnumType e);
 
-/// \brief Converts the given std::string \p s to HashAlgorithmEnumType
+/// \brief Converts the given std::string_view \p s to HashAlgorithmEnumType
 /// \returns a HashAlgorithmEnumType from a string representation
-HashAlgorithmEnumType string_to_hash_algorithm_enum_type(const std::string& s);
+HashAlgorithmEnumType string_to_hash_algorithm_enum_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given HashAlgorithmEnumType \p hash_algorithm_enum_type to the given
@@ -275,9 +276,9 @@ namespace conversions {
 /// \returns a string representation of the DeleteCertificateStatusEnumType
 std::string delete_certificate_status_enum_type_to_string(DeleteCertificateStatusEnumType e);
 
-/// \brief Converts the given std::string \p s to DeleteCertificateStatusEnumType
+/// \brief Converts the given std::string_view \p s to DeleteCertificateStatusEnumType
 /// \returns a DeleteCertificateStatusEnumType from a string representation
-DeleteCertificateStatusEnumType string_to_delete_certificate_status_enum_type(const std::string& s);
+DeleteCertificateStatusEnumType string_to_delete_certificate_status_enum_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given DeleteCertificateStatusEnumType \p
@@ -298,9 +299,9 @@ namespace conversions {
 /// \returns a string representation of the DiagnosticsStatus
 std::string diagnostics_status_to_string(DiagnosticsStatus e);
 
-/// \brief Converts the given std::string \p s to DiagnosticsStatus
+/// \brief Converts the given std::string_view \p s to DiagnosticsStatus
 /// \returns a DiagnosticsStatus from a string representation
-DiagnosticsStatus string_to_diagnostics_status(const std::string& s);
+DiagnosticsStatus string_to_diagnostics_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given DiagnosticsStatus \p diagnostics_status to the given output
@@ -323,9 +324,9 @@ namespace conversions {
 /// \returns a string representation of the MessageTriggerEnumType
 std::string message_trigger_enum_type_to_string(MessageTriggerEnumType e);
 
-/// \brief Converts the given std::string \p s to MessageTriggerEnumType
+/// \brief Converts the given std::string_view \p s to MessageTriggerEnumType
 /// \returns a MessageTriggerEnumType from a string representation
-MessageTriggerEnumType string_to_message_trigger_enum_type(const std::string& s);
+MessageTriggerEnumType string_to_message_trigger_enum_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given MessageTriggerEnumType \p message_trigger_enum_type to the
@@ -344,9 +345,9 @@ namespace conversions {
 /// \returns a string representation of the TriggerMessageStatusEnumType
 std::string trigger_message_status_enum_type_to_string(TriggerMessageStatusEnumType e);
 
-/// \brief Converts the given std::string \p s to TriggerMessageStatusEnumType
+/// \brief Converts the given std::string_view \p s to TriggerMessageStatusEnumType
 /// \returns a TriggerMessageStatusEnumType from a string representation
-TriggerMessageStatusEnumType string_to_trigger_message_status_enum_type(const std::string& s);
+TriggerMessageStatusEnumType string_to_trigger_message_status_enum_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given TriggerMessageStatusEnumType \p
@@ -370,9 +371,9 @@ namespace conversions {
 /// \returns a string representation of the FirmwareStatus
 std::string firmware_status_to_string(FirmwareStatus e);
 
-/// \brief Converts the given std::string \p s to FirmwareStatus
+/// \brief Converts the given std::string_view \p s to FirmwareStatus
 /// \returns a FirmwareStatus from a string representation
-FirmwareStatus string_to_firmware_status(const std::string& s);
+FirmwareStatus string_to_firmware_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given FirmwareStatus \p firmware_status to the given output stream \p
@@ -390,9 +391,9 @@ namespace conversions {
 /// \returns a string representation of the ChargingRateUnit
 std::string charging_rate_unit_to_string(ChargingRateUnit e);
 
-/// \brief Converts the given std::string \p s to ChargingRateUnit
+/// \brief Converts the given std::string_view \p s to ChargingRateUnit
 /// \returns a ChargingRateUnit from a string representation
-ChargingRateUnit string_to_charging_rate_unit(const std::string& s);
+ChargingRateUnit string_to_charging_rate_unit(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ChargingRateUnit \p charging_rate_unit to the given output
@@ -410,9 +411,9 @@ namespace conversions {
 /// \returns a string representation of the GetCompositeScheduleStatus
 std::string get_composite_schedule_status_to_string(GetCompositeScheduleStatus e);
 
-/// \brief Converts the given std::string \p s to GetCompositeScheduleStatus
+/// \brief Converts the given std::string_view \p s to GetCompositeScheduleStatus
 /// \returns a GetCompositeScheduleStatus from a string representation
-GetCompositeScheduleStatus string_to_get_composite_schedule_status(const std::string& s);
+GetCompositeScheduleStatus string_to_get_composite_schedule_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given GetCompositeScheduleStatus \p get_composite_schedule_status to
@@ -430,9 +431,9 @@ namespace conversions {
 /// \returns a string representation of the CertificateUseEnumType
 std::string certificate_use_enum_type_to_string(CertificateUseEnumType e);
 
-/// \brief Converts the given std::string \p s to CertificateUseEnumType
+/// \brief Converts the given std::string_view \p s to CertificateUseEnumType
 /// \returns a CertificateUseEnumType from a string representation
-CertificateUseEnumType string_to_certificate_use_enum_type(const std::string& s);
+CertificateUseEnumType string_to_certificate_use_enum_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given CertificateUseEnumType \p certificate_use_enum_type to the
@@ -450,9 +451,9 @@ namespace conversions {
 /// \returns a string representation of the GetInstalledCertificateStatusEnumType
 std::string get_installed_certificate_status_enum_type_to_string(GetInstalledCertificateStatusEnumType e);
 
-/// \brief Converts the given std::string \p s to GetInstalledCertificateStatusEnumType
+/// \brief Converts the given std::string_view \p s to GetInstalledCertificateStatusEnumType
 /// \returns a GetInstalledCertificateStatusEnumType from a string representation
-GetInstalledCertificateStatusEnumType string_to_get_installed_certificate_status_enum_type(const std::string& s);
+GetInstalledCertificateStatusEnumType string_to_get_installed_certificate_status_enum_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given GetInstalledCertificateStatusEnumType \p
@@ -472,9 +473,9 @@ namespace conversions {
 /// \returns a string representation of the LogEnumType
 std::string log_enum_type_to_string(LogEnumType e);
 
-/// \brief Converts the given std::string \p s to LogEnumType
+/// \brief Converts the given std::string_view \p s to LogEnumType
 /// \returns a LogEnumType from a string representation
-LogEnumType string_to_log_enum_type(const std::string& s);
+LogEnumType string_to_log_enum_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given LogEnumType \p log_enum_type to the given output stream \p os
@@ -493,9 +494,9 @@ namespace conversions {
 /// \returns a string representation of the LogStatusEnumType
 std::string log_status_enum_type_to_string(LogStatusEnumType e);
 
-/// \brief Converts the given std::string \p s to LogStatusEnumType
+/// \brief Converts the given std::string_view \p s to LogStatusEnumType
 /// \returns a LogStatusEnumType from a string representation
-LogStatusEnumType string_to_log_status_enum_type(const std::string& s);
+LogStatusEnumType string_to_log_status_enum_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given LogStatusEnumType \p log_status_enum_type to the given output
@@ -514,9 +515,9 @@ namespace conversions {
 /// \returns a string representation of the InstallCertificateStatusEnumType
 std::string install_certificate_status_enum_type_to_string(InstallCertificateStatusEnumType e);
 
-/// \brief Converts the given std::string \p s to InstallCertificateStatusEnumType
+/// \brief Converts the given std::string_view \p s to InstallCertificateStatusEnumType
 /// \returns a InstallCertificateStatusEnumType from a string representation
-InstallCertificateStatusEnumType string_to_install_certificate_status_enum_type(const std::string& s);
+InstallCertificateStatusEnumType string_to_install_certificate_status_enum_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given InstallCertificateStatusEnumType \p
@@ -541,9 +542,9 @@ namespace conversions {
 /// \returns a string representation of the UploadLogStatusEnumType
 std::string upload_log_status_enum_type_to_string(UploadLogStatusEnumType e);
 
-/// \brief Converts the given std::string \p s to UploadLogStatusEnumType
+/// \brief Converts the given std::string_view \p s to UploadLogStatusEnumType
 /// \returns a UploadLogStatusEnumType from a string representation
-UploadLogStatusEnumType string_to_upload_log_status_enum_type(const std::string& s);
+UploadLogStatusEnumType string_to_upload_log_status_enum_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given UploadLogStatusEnumType \p upload_log_status_enum_type to the
@@ -567,9 +568,9 @@ namespace conversions {
 /// \returns a string representation of the ReadingContext
 std::string reading_context_to_string(ReadingContext e);
 
-/// \brief Converts the given std::string \p s to ReadingContext
+/// \brief Converts the given std::string_view \p s to ReadingContext
 /// \returns a ReadingContext from a string representation
-ReadingContext string_to_reading_context(const std::string& s);
+ReadingContext string_to_reading_context(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ReadingContext \p reading_context to the given output stream \p
@@ -587,9 +588,9 @@ namespace conversions {
 /// \returns a string representation of the ValueFormat
 std::string value_format_to_string(ValueFormat e);
 
-/// \brief Converts the given std::string \p s to ValueFormat
+/// \brief Converts the given std::string_view \p s to ValueFormat
 /// \returns a ValueFormat from a string representation
-ValueFormat string_to_value_format(const std::string& s);
+ValueFormat string_to_value_format(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ValueFormat \p value_format to the given output stream \p os
@@ -627,9 +628,9 @@ namespace conversions {
 /// \returns a string representation of the Measurand
 std::string measurand_to_string(Measurand e);
 
-/// \brief Converts the given std::string \p s to Measurand
+/// \brief Converts the given std::string_view \p s to Measurand
 /// \returns a Measurand from a string representation
-Measurand string_to_measurand(const std::string& s);
+Measurand string_to_measurand(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given Measurand \p measurand to the given output stream \p os
@@ -655,9 +656,9 @@ namespace conversions {
 /// \returns a string representation of the Phase
 std::string phase_to_string(Phase e);
 
-/// \brief Converts the given std::string \p s to Phase
+/// \brief Converts the given std::string_view \p s to Phase
 /// \returns a Phase from a string representation
-Phase string_to_phase(const std::string& s);
+Phase string_to_phase(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given Phase \p phase to the given output stream \p os
@@ -678,9 +679,9 @@ namespace conversions {
 /// \returns a string representation of the Location
 std::string location_to_string(Location e);
 
-/// \brief Converts the given std::string \p s to Location
+/// \brief Converts the given std::string_view \p s to Location
 /// \returns a Location from a string representation
-Location string_to_location(const std::string& s);
+Location string_to_location(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given Location \p location to the given output stream \p os
@@ -713,9 +714,9 @@ namespace conversions {
 /// \returns a string representation of the UnitOfMeasure
 std::string unit_of_measure_to_string(UnitOfMeasure e);
 
-/// \brief Converts the given std::string \p s to UnitOfMeasure
+/// \brief Converts the given std::string_view \p s to UnitOfMeasure
 /// \returns a UnitOfMeasure from a string representation
-UnitOfMeasure string_to_unit_of_measure(const std::string& s);
+UnitOfMeasure string_to_unit_of_measure(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given UnitOfMeasure \p unit_of_measure to the given output stream \p
@@ -734,9 +735,9 @@ namespace conversions {
 /// \returns a string representation of the ChargingProfileKindType
 std::string charging_profile_kind_type_to_string(ChargingProfileKindType e);
 
-/// \brief Converts the given std::string \p s to ChargingProfileKindType
+/// \brief Converts the given std::string_view \p s to ChargingProfileKindType
 /// \returns a ChargingProfileKindType from a string representation
-ChargingProfileKindType string_to_charging_profile_kind_type(const std::string& s);
+ChargingProfileKindType string_to_charging_profile_kind_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ChargingProfileKindType \p charging_profile_kind_type to the
@@ -754,9 +755,9 @@ namespace conversions {
 /// \returns a string representation of the RecurrencyKindType
 std::string recurrency_kind_type_to_string(RecurrencyKindType e);
 
-/// \brief Converts the given std::string \p s to RecurrencyKindType
+/// \brief Converts the given std::string_view \p s to RecurrencyKindType
 /// \returns a RecurrencyKindType from a string representation
-RecurrencyKindType string_to_recurrency_kind_type(const std::string& s);
+RecurrencyKindType string_to_recurrency_kind_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given RecurrencyKindType \p recurrency_kind_type to the given output
@@ -774,9 +775,9 @@ namespace conversions {
 /// \returns a string representation of the RemoteStartStopStatus
 std::string remote_start_stop_status_to_string(RemoteStartStopStatus e);
 
-/// \brief Converts the given std::string \p s to RemoteStartStopStatus
+/// \brief Converts the given std::string_view \p s to RemoteStartStopStatus
 /// \returns a RemoteStartStopStatus from a string representation
-RemoteStartStopStatus string_to_remote_start_stop_status(const std::string& s);
+RemoteStartStopStatus string_to_remote_start_stop_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given RemoteStartStopStatus \p remote_start_stop_status to the given
@@ -797,9 +798,9 @@ namespace conversions {
 /// \returns a string representation of the ReservationStatus
 std::string reservation_status_to_string(ReservationStatus e);
 
-/// \brief Converts the given std::string \p s to ReservationStatus
+/// \brief Converts the given std::string_view \p s to ReservationStatus
 /// \returns a ReservationStatus from a string representation
-ReservationStatus string_to_reservation_status(const std::string& s);
+ReservationStatus string_to_reservation_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ReservationStatus \p reservation_status to the given output
@@ -817,9 +818,9 @@ namespace conversions {
 /// \returns a string representation of the ResetType
 std::string reset_type_to_string(ResetType e);
 
-/// \brief Converts the given std::string \p s to ResetType
+/// \brief Converts the given std::string_view \p s to ResetType
 /// \returns a ResetType from a string representation
-ResetType string_to_reset_type(const std::string& s);
+ResetType string_to_reset_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ResetType \p reset_type to the given output stream \p os
@@ -837,9 +838,9 @@ namespace conversions {
 /// \returns a string representation of the ResetStatus
 std::string reset_status_to_string(ResetStatus e);
 
-/// \brief Converts the given std::string \p s to ResetStatus
+/// \brief Converts the given std::string_view \p s to ResetStatus
 /// \returns a ResetStatus from a string representation
-ResetStatus string_to_reset_status(const std::string& s);
+ResetStatus string_to_reset_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ResetStatus \p reset_status to the given output stream \p os
@@ -857,9 +858,9 @@ namespace conversions {
 /// \returns a string representation of the UpdateType
 std::string update_type_to_string(UpdateType e);
 
-/// \brief Converts the given std::string \p s to UpdateType
+/// \brief Converts the given std::string_view \p s to UpdateType
 /// \returns a UpdateType from a string representation
-UpdateType string_to_update_type(const std::string& s);
+UpdateType string_to_update_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given UpdateType \p update_type to the given output stream \p os
@@ -879,9 +880,9 @@ namespace conversions {
 /// \returns a string representation of the UpdateStatus
 std::string update_status_to_string(UpdateStatus e);
 
-/// \brief Converts the given std::string \p s to UpdateStatus
+/// \brief Converts the given std::string_view \p s to UpdateStatus
 /// \returns a UpdateStatus from a string representation
-UpdateStatus string_to_update_status(const std::string& s);
+UpdateStatus string_to_update_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given UpdateStatus \p update_status to the given output stream \p os
@@ -900,9 +901,9 @@ namespace conversions {
 /// \returns a string representation of the ChargingProfileStatus
 std::string charging_profile_status_to_string(ChargingProfileStatus e);
 
-/// \brief Converts the given std::string \p s to ChargingProfileStatus
+/// \brief Converts the given std::string_view \p s to ChargingProfileStatus
 /// \returns a ChargingProfileStatus from a string representation
-ChargingProfileStatus string_to_charging_profile_status(const std::string& s);
+ChargingProfileStatus string_to_charging_profile_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ChargingProfileStatus \p charging_profile_status to the given
@@ -920,9 +921,9 @@ namespace conversions {
 /// \returns a string representation of the GenericStatusEnumType
 std::string generic_status_enum_type_to_string(GenericStatusEnumType e);
 
-/// \brief Converts the given std::string \p s to GenericStatusEnumType
+/// \brief Converts the given std::string_view \p s to GenericStatusEnumType
 /// \returns a GenericStatusEnumType from a string representation
-GenericStatusEnumType string_to_generic_status_enum_type(const std::string& s);
+GenericStatusEnumType string_to_generic_status_enum_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given GenericStatusEnumType \p generic_status_enum_type to the given
@@ -952,9 +953,9 @@ namespace conversions {
 /// \returns a string representation of the FirmwareStatusEnumType
 std::string firmware_status_enum_type_to_string(FirmwareStatusEnumType e);
 
-/// \brief Converts the given std::string \p s to FirmwareStatusEnumType
+/// \brief Converts the given std::string_view \p s to FirmwareStatusEnumType
 /// \returns a FirmwareStatusEnumType from a string representation
-FirmwareStatusEnumType string_to_firmware_status_enum_type(const std::string& s);
+FirmwareStatusEnumType string_to_firmware_status_enum_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given FirmwareStatusEnumType \p firmware_status_enum_type to the
@@ -975,9 +976,9 @@ namespace conversions {
 /// \returns a string representation of the UpdateFirmwareStatusEnumType
 std::string update_firmware_status_enum_type_to_string(UpdateFirmwareStatusEnumType e);
 
-/// \brief Converts the given std::string \p s to UpdateFirmwareStatusEnumType
+/// \brief Converts the given std::string_view \p s to UpdateFirmwareStatusEnumType
 /// \returns a UpdateFirmwareStatusEnumType from a string representation
-UpdateFirmwareStatusEnumType string_to_update_firmware_status_enum_type(const std::string& s);
+UpdateFirmwareStatusEnumType string_to_update_firmware_status_enum_type(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given UpdateFirmwareStatusEnumType \p
@@ -1010,9 +1011,9 @@ namespace conversions {
 /// \returns a string representation of the ChargePointErrorCode
 std::string charge_point_error_code_to_string(ChargePointErrorCode e);
 
-/// \brief Converts the given std::string \p s to ChargePointErrorCode
+/// \brief Converts the given std::string_view \p s to ChargePointErrorCode
 /// \returns a ChargePointErrorCode from a string representation
-ChargePointErrorCode string_to_charge_point_error_code(const std::string& s);
+ChargePointErrorCode string_to_charge_point_error_code(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ChargePointErrorCode \p charge_point_error_code to the given
@@ -1037,9 +1038,9 @@ namespace conversions {
 /// \returns a string representation of the ChargePointStatus
 std::string charge_point_status_to_string(ChargePointStatus e);
 
-/// \brief Converts the given std::string \p s to ChargePointStatus
+/// \brief Converts the given std::string_view \p s to ChargePointStatus
 /// \returns a ChargePointStatus from a string representation
-ChargePointStatus string_to_charge_point_status(const std::string& s);
+ChargePointStatus string_to_charge_point_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ChargePointStatus \p charge_point_status to the given output
@@ -1066,9 +1067,9 @@ namespace conversions {
 /// \returns a string representation of the Reason
 std::string reason_to_string(Reason e);
 
-/// \brief Converts the given std::string \p s to Reason
+/// \brief Converts the given std::string_view \p s to Reason
 /// \returns a Reason from a string representation
-Reason string_to_reason(const std::string& s);
+Reason string_to_reason(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given Reason \p reason to the given output stream \p os
@@ -1090,9 +1091,9 @@ namespace conversions {
 /// \returns a string representation of the MessageTrigger
 std::string message_trigger_to_string(MessageTrigger e);
 
-/// \brief Converts the given std::string \p s to MessageTrigger
+/// \brief Converts the given std::string_view \p s to MessageTrigger
 /// \returns a MessageTrigger from a string representation
-MessageTrigger string_to_message_trigger(const std::string& s);
+MessageTrigger string_to_message_trigger(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given MessageTrigger \p message_trigger to the given output stream \p
@@ -1111,9 +1112,9 @@ namespace conversions {
 /// \returns a string representation of the TriggerMessageStatus
 std::string trigger_message_status_to_string(TriggerMessageStatus e);
 
-/// \brief Converts the given std::string \p s to TriggerMessageStatus
+/// \brief Converts the given std::string_view \p s to TriggerMessageStatus
 /// \returns a TriggerMessageStatus from a string representation
-TriggerMessageStatus string_to_trigger_message_status(const std::string& s);
+TriggerMessageStatus string_to_trigger_message_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given TriggerMessageStatus \p trigger_message_status to the given
@@ -1132,9 +1133,9 @@ namespace conversions {
 /// \returns a string representation of the UnlockStatus
 std::string unlock_status_to_string(UnlockStatus e);
 
-/// \brief Converts the given std::string \p s to UnlockStatus
+/// \brief Converts the given std::string_view \p s to UnlockStatus
 /// \returns a UnlockStatus from a string representation
-UnlockStatus string_to_unlock_status(const std::string& s);
+UnlockStatus string_to_unlock_status(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given UnlockStatus \p unlock_status to the given output stream \p os
@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <random>
+#include <unordered_map>
 
 #include <everest/timer.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
@@ -157,10 +158,16 @@ private:
     std::vector<std::shared_ptr<Transaction>> active_transactions;
     // size does not depend on the number of connectors
     std::vector<std::shared_ptr<Transaction>> stopped_transactions;
+    // active and stopped transactions by the idTag they have been started with
+    std::unordered_multimap<CiString<20>, std::shared_ptr<Transaction>, CiStringHash<20>, CiStringEqual<20>>
+        transactions_by_id_tag;
 
     std::mt19937 gen;
     std::uniform_int_distribution<int32_t> distr;
 
+    /// \brief Removes the given \p transaction from transactions_by_id_tag
+    void erase_from_id_tag_index(const std::shared_ptr<Transaction>& transaction);
+
 public:
     /// \brief Creates and manages transactions for the provided \p number_of_connectors
     explicit TransactionHandler(int32_t number_of_connectors);
@@ -191,7 +198,8 @@ public:
     std::shared_ptr<Transaction> get_transaction(const std::string& start_transaction_message_id);
 
     ///
-    /// \brief Returns the transaction associated with the given id tag.
+    /// \brief Returns the transaction associated with the given id tag. Active transactions are preferred over stopped
+    /// ones and the id tag is compared case insensitively.
     /// \param id_tag   The id tag.
     /// \return The associated transaction if available.
     ///
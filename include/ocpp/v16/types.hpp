@@ -5,6 +5,7 @@
 
 #include <iostream>
 #include <sstream>
+#include <string_view>
 
 #include <nlohmann/json_fwd.hpp>
 
@@ -106,9 +107,9 @@ namespace conversions {
 /// \returns a string representation of the MessageType
 std::string messagetype_to_string(MessageType m);
 
-/// \brief Converts the given std::string \p s to MessageType
+/// \brief Converts the given std::string_view \p s to MessageType
 /// \returns a MessageType from a string representation
-MessageType string_to_messagetype(const std::string& s);
+MessageType string_to_messagetype(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given \p message_type to the given output stream \p os
@@ -134,9 +135,9 @@ namespace conversions {
 /// \returns a string representation of the SupportedFeatureProfiles
 std::string supported_feature_profiles_to_string(SupportedFeatureProfiles e);
 
-/// \brief Converts the given std::string \p s to SupportedFeatureProfiles
+/// \brief Converts the given std::string_view \p s to SupportedFeatureProfiles
 /// \returns a SupportedFeatureProfiles from a string representation
-SupportedFeatureProfiles string_to_supported_feature_profiles(const std::string& s);
+SupportedFeatureProfiles string_to_supported_feature_profiles(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given \p supported_feature_profiles to the given output stream \p os
@@ -156,9 +157,9 @@ namespace conversions {
 /// \returns a string representation of the ChargePointConnectionState
 std::string charge_point_connection_state_to_string(ChargePointConnectionState e);
 
-/// \brief Converts the given std::string \p s to ChargePointConnectionState
+/// \brief Converts the given std::string_view \p s to ChargePointConnectionState
 /// \returns a ChargePointConnectionState from a string representation
-ChargePointConnectionState string_to_charge_point_connection_state(const std::string& s);
+ChargePointConnectionState string_to_charge_point_connection_state(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given \p charge_point_connection_state
@@ -8,6 +8,7 @@
 #include <set>
 
 #include <ocpp/common/charging_station_base.hpp>
+#include <ocpp/common/message_schema_validator.hpp>
 
 #include <ocpp/v201/average_meter_values.hpp>
 #include <ocpp/v201/charge_point_callbacks.hpp>
@@ -328,6 +329,7 @@ private:
 
     // utility
     std::shared_ptr<MessageQueue<v201::MessageType>> message_queue;
+    std::unique_ptr<MessageSchemaValidator<v201::MessageType>> message_schema_validator;
     std::shared_ptr<DatabaseHandler> database_handler;
 
     std::map<int32_t, AvailabilityChange> scheduled_change_availability_requests;
@@ -346,12 +348,12 @@ private:
 
     Everest::SteadyTimer certificate_signed_timer;
 
-    // threads and synchronization
-    bool auth_cache_cleanup_required;
-    std::condition_variable auth_cache_cleanup_cv;
-    std::mutex auth_cache_cleanup_mutex;
-    std::thread auth_cache_cleanup_thread;
-    std::atomic_bool stop_auth_cache_cleanup_handler;
+    // periodically cleans up the authorization cache
+    Everest::SteadyTimer auth_cache_cleanup_timer;
+    // runs a cleanup of the authorization cache that was triggered before the next periodic one is due
+    Everest::SteadyTimer auth_cache_cleanup_trigger_timer;
+    // initializes the size of the authorization cache once the charge point has been created
+    Everest::SteadyTimer auth_cache_size_update_timer;
 
     // states
     RegistrationStatusEnum registration_status;
@@ -754,12 +756,15 @@ public:
     /// \param callbacks Callbacks that will be registered for ChargePoint
     /// \param security_configuration specifies the file paths that are required to set up the internal evse_security
     /// implementation
+    /// \param host Optional host that runs the timers of the charging station together with those of other charging
+    /// stations; if nullptr the charging station starts a thread of its own for them
     ChargePoint(const std::map<int32_t, int32_t>& evse_connector_structure,
                 const std::string& device_model_storage_address, const bool initialize_device_model,
                 const std::string& device_model_migration_path, const std::string& device_model_config_path,
                 const std::string& ocpp_main_path, const std::string& core_database_path,
                 const std::string& sql_init_path, const std::string& message_log_path,
-                const std::shared_ptr<EvseSecurity> evse_security, const Callbacks& callbacks);
+                const std::shared_ptr<EvseSecurity> evse_security, const Callbacks& callbacks,
+                std::shared_ptr<ChargingStationHost> host = nullptr);
 
     /// \brief Construct a new ChargePoint object
     /// \param evse_connector_structure Map that defines the structure of EVSE and connectors of the chargepoint. The
@@ -774,11 +779,13 @@ public:
     /// \param callbacks Callbacks that will be registered for ChargePoint
     /// \param security_configuration specifies the file paths that are required to set up the internal evse_security
     /// implementation
+    /// \param host Optional host that runs the timers of the charging station together with those of other charging
+    /// stations; if nullptr the charging station starts a thread of its own for them
     ChargePoint(const std::map<int32_t, int32_t>& evse_connector_structure,
                 const std::string& device_model_storage_address, const std::string& ocpp_main_path,
                 const std::string& core_database_path, const std::string& sql_init_path,
                 const std::string& message_log_path, const std::shared_ptr<EvseSecurity> evse_security,
-                const Callbacks& callbacks);
+                const Callbacks& callbacks, std::shared_ptr<ChargingStationHost> host = nullptr);
 
     /// \brief Construct a new ChargePoint object
     /// \param evse_connector_structure Map that defines the structure of EVSE and connectors of the chargepoint. The
@@ -790,11 +797,13 @@ public:
     /// \param message_log_path Path to where logfiles are written to
     /// \param evse_security Pointer to evse_security that manages security related operations
     /// \param callbacks Callbacks that will be registered for ChargePoint
+    /// \param host Optional host that runs the timers of the charging station together with those of other charging
+    /// stations; if nullptr the charging station starts a thread of its own for them
     ChargePoint(const std::map<int32_t, int32_t>& evse_connector_structure,
                 std::unique_ptr<DeviceModelStorage> device_model_storage, const std::string& ocpp_main_path,
                 const std::string& core_database_path, const std::string& sql_init_path,
                 const std::string& message_log_path, const std::shared_ptr<EvseSecurity> evse_security,
-                const Callbacks& callbacks);
+                const Callbacks& callbacks, std::shared_ptr<ChargingStationHost> host = nullptr);
 
     /// \brief Construct a new ChargePoint object
     /// \param evse_connector_structure Map that defines the structure of EVSE and connectors of the chargepoint. The
@@ -806,10 +815,13 @@ public:
     /// \param message_log_path Path to where logfiles are written to
     /// \param evse_security Pointer to evse_security that manages security related operations
     /// \param callbacks Callbacks that will be registered for ChargePoint
+    /// \param host Optional host that runs the timers of the charging station together with those of other charging
+    /// stations; if nullptr the charging station starts a thread of its own for them
     ChargePoint(const std::map<int32_t, int32_t>& evse_connector_structure, std::shared_ptr<DeviceModel> device_model,
                 std::shared_ptr<DatabaseHandler> database_handler,
                 std::shared_ptr<MessageQueue<v201::MessageType>> message_queue, const std::string& message_log_path,
-                const std::shared_ptr<EvseSecurity> evse_security, const Callbacks& callbacks);
+                const std::shared_ptr<EvseSecurity> evse_security, const Callbacks& callbacks,
+                std::shared_ptr<ChargingStationHost> host = nullptr);
 
     ~ChargePoint();
 
@@ -42,6 +42,8 @@ private:
     std::optional<ConfigureNetworkConnectionProfileCallback> configure_network_connection_profile_callback;
 
     Everest::SteadyTimer websocket_timer;
+    /// \brief Schedules the reconnects of the websockets of all network connection profiles
+    std::shared_ptr<ReconnectScheduler> reconnect_scheduler;
     bool disable_automatic_websocket_reconnects;
     int network_configuration_priority;
     /// @brief Local cached network connection profiles
@@ -94,6 +96,11 @@ public:
     ///
     bool is_websocket_connected();
 
+    /// \brief Get the reconnect scheduler that keeps the reconnect backoff and statistics per configuration slot
+    /// \return The reconnect scheduler shared by the websockets of all network connection profiles
+    ///
+    std::shared_ptr<ReconnectScheduler> get_reconnect_scheduler();
+
     /// \brief Start the connectivity manager
     ///
     void start();
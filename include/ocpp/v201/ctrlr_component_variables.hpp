@@ -73,6 +73,10 @@ extern const ComponentVariable& VerifyCsmsAllowWildcards;
 extern const ComponentVariable& IFace;
 extern const ComponentVariable& EnableTLSKeylog;
 extern const ComponentVariable& TLSKeylogFile;
+extern const ComponentVariable& WebsocketPermessageDeflate;
+extern const ComponentVariable& WebsocketPermessageDeflateWindowBits;
+extern const ComponentVariable& WebsocketPermessageDeflateCompressionLevel;
+extern const ComponentVariable& ReconnectProbeInterval;
 extern const ComponentVariable& OcspRequestInterval;
 extern const ComponentVariable& WebsocketPingPayload;
 extern const ComponentVariable& WebsocketPongTimeout;
@@ -83,7 +87,16 @@ extern const ComponentVariable& V2GCertificateExpireCheckIntervalSeconds;
 extern const ComponentVariable& ClientCertificateExpireCheckInitialDelaySeconds;
 extern const ComponentVariable& ClientCertificateExpireCheckIntervalSeconds;
 extern const ComponentVariable& MessageQueueSizeThreshold;
+extern const ComponentVariable& MessageQueueMaxMessagesInFlight;
+extern const ComponentVariable& MessageQueueHighPriorityMessageTypes;
+extern const ComponentVariable& MessageQueueLowPriorityMessageTypes;
+extern const ComponentVariable& MessageQueueHighPriorityBeforeTransactionMessages;
+extern const ComponentVariable& MessageQueueWeightedFairScheduling;
+extern const ComponentVariable& MessageQueueCoalescedMessageTypes;
+extern const ComponentVariable& MessageQueueDirectlyDeserializedMessageTypes;
+extern const ComponentVariable& MessageSchemasPath;
 extern const ComponentVariable& MaxMessageSize;
+extern const ComponentVariable& MaxReceivedMessageSize;
 extern const ComponentVariable& ResumeTransactionsOnBoot;
 extern const ComponentVariable& AlignedDataCtrlrEnabled;
 extern const ComponentVariable& AlignedDataCtrlrAvailable;
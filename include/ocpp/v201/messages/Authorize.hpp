@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -33,6 +35,12 @@ void to_json(json& j, const AuthorizeRequest& k);
 /// \brief Conversion from a given json object \p j to a given AuthorizeRequest \p k
 void from_json(const json& j, AuthorizeRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a AuthorizeRequest
+const JsonSaxFields& json_sax_fields(const AuthorizeRequest*);
+
+/// \brief Writes the given AuthorizeRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const AuthorizeRequest& k);
+
 /// \brief Writes the string representation of the given AuthorizeRequest \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizeRequest written to
 std::ostream& operator<<(std::ostream& os, const AuthorizeRequest& k);
@@ -54,6 +62,12 @@ void to_json(json& j, const AuthorizeResponse& k);
 /// \brief Conversion from a given json object \p j to a given AuthorizeResponse \p k
 void from_json(const json& j, AuthorizeResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a AuthorizeResponse
+const JsonSaxFields& json_sax_fields(const AuthorizeResponse*);
+
+/// \brief Writes the given AuthorizeResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const AuthorizeResponse& k);
+
 /// \brief Writes the string representation of the given AuthorizeResponse \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizeResponse written to
 std::ostream& operator<<(std::ostream& os, const AuthorizeResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -32,6 +34,12 @@ void to_json(json& j, const BootNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given BootNotificationRequest \p k
 void from_json(const json& j, BootNotificationRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a BootNotificationRequest
+const JsonSaxFields& json_sax_fields(const BootNotificationRequest*);
+
+/// \brief Writes the given BootNotificationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const BootNotificationRequest& k);
+
 /// \brief Writes the string representation of the given BootNotificationRequest \p k to the given output stream \p os
 /// \returns an output stream with the BootNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const BootNotificationRequest& k);
@@ -55,6 +63,12 @@ void to_json(json& j, const BootNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given BootNotificationResponse \p k
 void from_json(const json& j, BootNotificationResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a BootNotificationResponse
+const JsonSaxFields& json_sax_fields(const BootNotificationResponse*);
+
+/// \brief Writes the given BootNotificationResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const BootNotificationResponse& k);
+
 /// \brief Writes the string representation of the given BootNotificationResponse \p k to the given output stream \p os
 /// \returns an output stream with the BootNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const BootNotificationResponse& k);
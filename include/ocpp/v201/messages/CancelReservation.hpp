@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -31,6 +33,12 @@ void to_json(json& j, const CancelReservationRequest& k);
 /// \brief Conversion from a given json object \p j to a given CancelReservationRequest \p k
 void from_json(const json& j, CancelReservationRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CancelReservationRequest
+const JsonSaxFields& json_sax_fields(const CancelReservationRequest*);
+
+/// \brief Writes the given CancelReservationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CancelReservationRequest& k);
+
 /// \brief Writes the string representation of the given CancelReservationRequest \p k to the given output stream \p os
 /// \returns an output stream with the CancelReservationRequest written to
 std::ostream& operator<<(std::ostream& os, const CancelReservationRequest& k);
@@ -52,6 +60,12 @@ void to_json(json& j, const CancelReservationResponse& k);
 /// \brief Conversion from a given json object \p j to a given CancelReservationResponse \p k
 void from_json(const json& j, CancelReservationResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CancelReservationResponse
+const JsonSaxFields& json_sax_fields(const CancelReservationResponse*);
+
+/// \brief Writes the given CancelReservationResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CancelReservationResponse& k);
+
 /// \brief Writes the string representation of the given CancelReservationResponse \p k to the given output stream \p os
 /// \returns an output stream with the CancelReservationResponse written to
 std::ostream& operator<<(std::ostream& os, const CancelReservationResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -32,6 +34,12 @@ void to_json(json& j, const CertificateSignedRequest& k);
 /// \brief Conversion from a given json object \p j to a given CertificateSignedRequest \p k
 void from_json(const json& j, CertificateSignedRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CertificateSignedRequest
+const JsonSaxFields& json_sax_fields(const CertificateSignedRequest*);
+
+/// \brief Writes the given CertificateSignedRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CertificateSignedRequest& k);
+
 /// \brief Writes the string representation of the given CertificateSignedRequest \p k to the given output stream \p os
 /// \returns an output stream with the CertificateSignedRequest written to
 std::ostream& operator<<(std::ostream& os, const CertificateSignedRequest& k);
@@ -53,6 +61,12 @@ void to_json(json& j, const CertificateSignedResponse& k);
 /// \brief Conversion from a given json object \p j to a given CertificateSignedResponse \p k
 void from_json(const json& j, CertificateSignedResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CertificateSignedResponse
+const JsonSaxFields& json_sax_fields(const CertificateSignedResponse*);
+
+/// \brief Writes the given CertificateSignedResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CertificateSignedResponse& k);
+
 /// \brief Writes the string representation of the given CertificateSignedResponse \p k to the given output stream \p os
 /// \returns an output stream with the CertificateSignedResponse written to
 std::ostream& operator<<(std::ostream& os, const CertificateSignedResponse& k);
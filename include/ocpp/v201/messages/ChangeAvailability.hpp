@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -32,6 +34,12 @@ void to_json(json& j, const ChangeAvailabilityRequest& k);
 /// \brief Conversion from a given json object \p j to a given ChangeAvailabilityRequest \p k
 void from_json(const json& j, ChangeAvailabilityRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChangeAvailabilityRequest
+const JsonSaxFields& json_sax_fields(const ChangeAvailabilityRequest*);
+
+/// \brief Writes the given ChangeAvailabilityRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChangeAvailabilityRequest& k);
+
 /// \brief Writes the string representation of the given ChangeAvailabilityRequest \p k to the given output stream \p os
 /// \returns an output stream with the ChangeAvailabilityRequest written to
 std::ostream& operator<<(std::ostream& os, const ChangeAvailabilityRequest& k);
@@ -53,6 +61,12 @@ void to_json(json& j, const ChangeAvailabilityResponse& k);
 /// \brief Conversion from a given json object \p j to a given ChangeAvailabilityResponse \p k
 void from_json(const json& j, ChangeAvailabilityResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChangeAvailabilityResponse
+const JsonSaxFields& json_sax_fields(const ChangeAvailabilityResponse*);
+
+/// \brief Writes the given ChangeAvailabilityResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChangeAvailabilityResponse& k);
+
 /// \brief Writes the string representation of the given ChangeAvailabilityResponse \p k to the given output stream \p
 /// os \returns an output stream with the ChangeAvailabilityResponse written to
 std::ostream& operator<<(std::ostream& os, const ChangeAvailabilityResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -32,6 +34,12 @@ void to_json(json& j, const ClearChargingProfileRequest& k);
 /// \brief Conversion from a given json object \p j to a given ClearChargingProfileRequest \p k
 void from_json(const json& j, ClearChargingProfileRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearChargingProfileRequest
+const JsonSaxFields& json_sax_fields(const ClearChargingProfileRequest*);
+
+/// \brief Writes the given ClearChargingProfileRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearChargingProfileRequest& k);
+
 /// \brief Writes the string representation of the given ClearChargingProfileRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearChargingProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfileRequest& k);
@@ -53,6 +61,12 @@ void to_json(json& j, const ClearChargingProfileResponse& k);
 /// \brief Conversion from a given json object \p j to a given ClearChargingProfileResponse \p k
 void from_json(const json& j, ClearChargingProfileResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearChargingProfileResponse
+const JsonSaxFields& json_sax_fields(const ClearChargingProfileResponse*);
+
+/// \brief Writes the given ClearChargingProfileResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearChargingProfileResponse& k);
+
 /// \brief Writes the string representation of the given ClearChargingProfileResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearChargingProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfileResponse& k);
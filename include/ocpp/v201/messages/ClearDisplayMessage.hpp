@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -31,6 +33,12 @@ void to_json(json& j, const ClearDisplayMessageRequest& k);
 /// \brief Conversion from a given json object \p j to a given ClearDisplayMessageRequest \p k
 void from_json(const json& j, ClearDisplayMessageRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearDisplayMessageRequest
+const JsonSaxFields& json_sax_fields(const ClearDisplayMessageRequest*);
+
+/// \brief Writes the given ClearDisplayMessageRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearDisplayMessageRequest& k);
+
 /// \brief Writes the string representation of the given ClearDisplayMessageRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearDisplayMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearDisplayMessageRequest& k);
@@ -52,6 +60,12 @@ void to_json(json& j, const ClearDisplayMessageResponse& k);
 /// \brief Conversion from a given json object \p j to a given ClearDisplayMessageResponse \p k
 void from_json(const json& j, ClearDisplayMessageResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearDisplayMessageResponse
+const JsonSaxFields& json_sax_fields(const ClearDisplayMessageResponse*);
+
+/// \brief Writes the given ClearDisplayMessageResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearDisplayMessageResponse& k);
+
 /// \brief Writes the string representation of the given ClearDisplayMessageResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearDisplayMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearDisplayMessageResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -31,6 +33,12 @@ void to_json(json& j, const ClearVariableMonitoringRequest& k);
 /// \brief Conversion from a given json object \p j to a given ClearVariableMonitoringRequest \p k
 void from_json(const json& j, ClearVariableMonitoringRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearVariableMonitoringRequest
+const JsonSaxFields& json_sax_fields(const ClearVariableMonitoringRequest*);
+
+/// \brief Writes the given ClearVariableMonitoringRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearVariableMonitoringRequest& k);
+
 /// \brief Writes the string representation of the given ClearVariableMonitoringRequest \p k to the given output stream
 /// \p os \returns an output stream with the ClearVariableMonitoringRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearVariableMonitoringRequest& k);
@@ -51,6 +59,12 @@ void to_json(json& j, const ClearVariableMonitoringResponse& k);
 /// \brief Conversion from a given json object \p j to a given ClearVariableMonitoringResponse \p k
 void from_json(const json& j, ClearVariableMonitoringResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearVariableMonitoringResponse
+const JsonSaxFields& json_sax_fields(const ClearVariableMonitoringResponse*);
+
+/// \brief Writes the given ClearVariableMonitoringResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearVariableMonitoringResponse& k);
+
 /// \brief Writes the string representation of the given ClearVariableMonitoringResponse \p k to the given output stream
 /// \p os \returns an output stream with the ClearVariableMonitoringResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearVariableMonitoringResponse& k);
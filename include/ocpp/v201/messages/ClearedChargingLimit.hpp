@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -32,6 +34,12 @@ void to_json(json& j, const ClearedChargingLimitRequest& k);
 /// \brief Conversion from a given json object \p j to a given ClearedChargingLimitRequest \p k
 void from_json(const json& j, ClearedChargingLimitRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearedChargingLimitRequest
+const JsonSaxFields& json_sax_fields(const ClearedChargingLimitRequest*);
+
+/// \brief Writes the given ClearedChargingLimitRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearedChargingLimitRequest& k);
+
 /// \brief Writes the string representation of the given ClearedChargingLimitRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearedChargingLimitRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearedChargingLimitRequest& k);
@@ -51,6 +59,12 @@ void to_json(json& j, const ClearedChargingLimitResponse& k);
 /// \brief Conversion from a given json object \p j to a given ClearedChargingLimitResponse \p k
 void from_json(const json& j, ClearedChargingLimitResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearedChargingLimitResponse
+const JsonSaxFields& json_sax_fields(const ClearedChargingLimitResponse*);
+
+/// \brief Writes the given ClearedChargingLimitResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearedChargingLimitResponse& k);
+
 /// \brief Writes the string representation of the given ClearedChargingLimitResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearedChargingLimitResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearedChargingLimitResponse& k);
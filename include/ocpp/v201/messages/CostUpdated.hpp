@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
 
@@ -31,6 +33,12 @@ void to_json(json& j, const CostUpdatedRequest& k);
 /// \brief Conversion from a given json object \p j to a given CostUpdatedRequest \p k
 void from_json(const json& j, CostUpdatedRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CostUpdatedRequest
+const JsonSaxFields& json_sax_fields(const CostUpdatedRequest*);
+
+/// \brief Writes the given CostUpdatedRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CostUpdatedRequest& k);
+
 /// \brief Writes the string representation of the given CostUpdatedRequest \p k to the given output stream \p os
 /// \returns an output stream with the CostUpdatedRequest written to
 std::ostream& operator<<(std::ostream& os, const CostUpdatedRequest& k);
@@ -50,6 +58,12 @@ void to_json(json& j, const CostUpdatedResponse& k);
 /// \brief Conversion from a given json object \p j to a given CostUpdatedResponse \p k
 void from_json(const json& j, CostUpdatedResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CostUpdatedResponse
+const JsonSaxFields& json_sax_fields(const CostUpdatedResponse*);
+
+/// \brief Writes the given CostUpdatedResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CostUpdatedResponse& k);
+
 /// \brief Writes the string representation of the given CostUpdatedResponse \p k to the given output stream \p os
 /// \returns an output stream with the CostUpdatedResponse written to
 std::ostream& operator<<(std::ostream& os, const CostUpdatedResponse& k);
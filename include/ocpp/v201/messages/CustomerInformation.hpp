@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -36,6 +38,12 @@ void to_json(json& j, const CustomerInformationRequest& k);
 /// \brief Conversion from a given json object \p j to a given CustomerInformationRequest \p k
 void from_json(const json& j, CustomerInformationRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CustomerInformationRequest
+const JsonSaxFields& json_sax_fields(const CustomerInformationRequest*);
+
+/// \brief Writes the given CustomerInformationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CustomerInformationRequest& k);
+
 /// \brief Writes the string representation of the given CustomerInformationRequest \p k to the given output stream \p
 /// os \returns an output stream with the CustomerInformationRequest written to
 std::ostream& operator<<(std::ostream& os, const CustomerInformationRequest& k);
@@ -57,6 +65,12 @@ void to_json(json& j, const CustomerInformationResponse& k);
 /// \brief Conversion from a given json object \p j to a given CustomerInformationResponse \p k
 void from_json(const json& j, CustomerInformationResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CustomerInformationResponse
+const JsonSaxFields& json_sax_fields(const CustomerInformationResponse*);
+
+/// \brief Writes the given CustomerInformationResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CustomerInformationResponse& k);
+
 /// \brief Writes the string representation of the given CustomerInformationResponse \p k to the given output stream \p
 /// os \returns an output stream with the CustomerInformationResponse written to
 std::ostream& operator<<(std::ostream& os, const CustomerInformationResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -31,6 +33,12 @@ void to_json(json& j, const DeleteCertificateRequest& k);
 /// \brief Conversion from a given json object \p j to a given DeleteCertificateRequest \p k
 void from_json(const json& j, DeleteCertificateRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a DeleteCertificateRequest
+const JsonSaxFields& json_sax_fields(const DeleteCertificateRequest*);
+
+/// \brief Writes the given DeleteCertificateRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const DeleteCertificateRequest& k);
+
 /// \brief Writes the string representation of the given DeleteCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the DeleteCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const DeleteCertificateRequest& k);
@@ -52,6 +60,12 @@ void to_json(json& j, const DeleteCertificateResponse& k);
 /// \brief Conversion from a given json object \p j to a given DeleteCertificateResponse \p k
 void from_json(const json& j, DeleteCertificateResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a DeleteCertificateResponse
+const JsonSaxFields& json_sax_fields(const DeleteCertificateResponse*);
+
+/// \brief Writes the given DeleteCertificateResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const DeleteCertificateResponse& k);
+
 /// \brief Writes the string representation of the given DeleteCertificateResponse \p k to the given output stream \p os
 /// \returns an output stream with the DeleteCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const DeleteCertificateResponse& k);
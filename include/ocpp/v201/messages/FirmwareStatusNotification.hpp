@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -32,6 +34,13 @@ void to_json(json& j, const FirmwareStatusNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given FirmwareStatusNotificationRequest \p k
 void from_json(const json& j, FirmwareStatusNotificationRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a FirmwareStatusNotificationRequest
+const JsonSaxFields& json_sax_fields(const FirmwareStatusNotificationRequest*);
+
+/// \brief Writes the given FirmwareStatusNotificationRequest \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationRequest& k);
+
 /// \brief Writes the string representation of the given FirmwareStatusNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the FirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const FirmwareStatusNotificationRequest& k);
@@ -51,6 +60,13 @@ void to_json(json& j, const FirmwareStatusNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given FirmwareStatusNotificationResponse \p k
 void from_json(const json& j, FirmwareStatusNotificationResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a FirmwareStatusNotificationResponse
+const JsonSaxFields& json_sax_fields(const FirmwareStatusNotificationResponse*);
+
+/// \brief Writes the given FirmwareStatusNotificationResponse \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationResponse& k);
+
 /// \brief Writes the string representation of the given FirmwareStatusNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the FirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const FirmwareStatusNotificationResponse& k);
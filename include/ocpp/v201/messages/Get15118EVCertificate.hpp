@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -33,6 +35,12 @@ void to_json(json& j, const Get15118EVCertificateRequest& k);
 /// \brief Conversion from a given json object \p j to a given Get15118EVCertificateRequest \p k
 void from_json(const json& j, Get15118EVCertificateRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a Get15118EVCertificateRequest
+const JsonSaxFields& json_sax_fields(const Get15118EVCertificateRequest*);
+
+/// \brief Writes the given Get15118EVCertificateRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const Get15118EVCertificateRequest& k);
+
 /// \brief Writes the string representation of the given Get15118EVCertificateRequest \p k to the given output stream \p
 /// os \returns an output stream with the Get15118EVCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const Get15118EVCertificateRequest& k);
@@ -55,6 +63,12 @@ void to_json(json& j, const Get15118EVCertificateResponse& k);
 /// \brief Conversion from a given json object \p j to a given Get15118EVCertificateResponse \p k
 void from_json(const json& j, Get15118EVCertificateResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a Get15118EVCertificateResponse
+const JsonSaxFields& json_sax_fields(const Get15118EVCertificateResponse*);
+
+/// \brief Writes the given Get15118EVCertificateResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const Get15118EVCertificateResponse& k);
+
 /// \brief Writes the string representation of the given Get15118EVCertificateResponse \p k to the given output stream
 /// \p os \returns an output stream with the Get15118EVCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const Get15118EVCertificateResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -32,6 +34,12 @@ void to_json(json& j, const GetBaseReportRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetBaseReportRequest \p k
 void from_json(const json& j, GetBaseReportRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetBaseReportRequest
+const JsonSaxFields& json_sax_fields(const GetBaseReportRequest*);
+
+/// \brief Writes the given GetBaseReportRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetBaseReportRequest& k);
+
 /// \brief Writes the string representation of the given GetBaseReportRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetBaseReportRequest written to
 std::ostream& operator<<(std::ostream& os, const GetBaseReportRequest& k);
@@ -53,6 +61,12 @@ void to_json(json& j, const GetBaseReportResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetBaseReportResponse \p k
 void from_json(const json& j, GetBaseReportResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetBaseReportResponse
+const JsonSaxFields& json_sax_fields(const GetBaseReportResponse*);
+
+/// \brief Writes the given GetBaseReportResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetBaseReportResponse& k);
+
 /// \brief Writes the string representation of the given GetBaseReportResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetBaseReportResponse written to
 std::ostream& operator<<(std::ostream& os, const GetBaseReportResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -31,6 +33,12 @@ void to_json(json& j, const GetCertificateStatusRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetCertificateStatusRequest \p k
 void from_json(const json& j, GetCertificateStatusRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetCertificateStatusRequest
+const JsonSaxFields& json_sax_fields(const GetCertificateStatusRequest*);
+
+/// \brief Writes the given GetCertificateStatusRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetCertificateStatusRequest& k);
+
 /// \brief Writes the string representation of the given GetCertificateStatusRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetCertificateStatusRequest written to
 std::ostream& operator<<(std::ostream& os, const GetCertificateStatusRequest& k);
@@ -53,6 +61,12 @@ void to_json(json& j, const GetCertificateStatusResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetCertificateStatusResponse \p k
 void from_json(const json& j, GetCertificateStatusResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetCertificateStatusResponse
+const JsonSaxFields& json_sax_fields(const GetCertificateStatusResponse*);
+
+/// \brief Writes the given GetCertificateStatusResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetCertificateStatusResponse& k);
+
 /// \brief Writes the string representation of the given GetCertificateStatusResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetCertificateStatusResponse written to
 std::ostream& operator<<(std::ostream& os, const GetCertificateStatusResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -33,6 +35,12 @@ void to_json(json& j, const GetChargingProfilesRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetChargingProfilesRequest \p k
 void from_json(const json& j, GetChargingProfilesRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetChargingProfilesRequest
+const JsonSaxFields& json_sax_fields(const GetChargingProfilesRequest*);
+
+/// \brief Writes the given GetChargingProfilesRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetChargingProfilesRequest& k);
+
 /// \brief Writes the string representation of the given GetChargingProfilesRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetChargingProfilesRequest written to
 std::ostream& operator<<(std::ostream& os, const GetChargingProfilesRequest& k);
@@ -54,6 +62,12 @@ void to_json(json& j, const GetChargingProfilesResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetChargingProfilesResponse \p k
 void from_json(const json& j, GetChargingProfilesResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetChargingProfilesResponse
+const JsonSaxFields& json_sax_fields(const GetChargingProfilesResponse*);
+
+/// \brief Writes the given GetChargingProfilesResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetChargingProfilesResponse& k);
+
 /// \brief Writes the string representation of the given GetChargingProfilesResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetChargingProfilesResponse written to
 std::ostream& operator<<(std::ostream& os, const GetChargingProfilesResponse& k);
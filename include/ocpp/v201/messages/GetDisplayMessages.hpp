@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -34,6 +36,12 @@ void to_json(json& j, const GetDisplayMessagesRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetDisplayMessagesRequest \p k
 void from_json(const json& j, GetDisplayMessagesRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetDisplayMessagesRequest
+const JsonSaxFields& json_sax_fields(const GetDisplayMessagesRequest*);
+
+/// \brief Writes the given GetDisplayMessagesRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetDisplayMessagesRequest& k);
+
 /// \brief Writes the string representation of the given GetDisplayMessagesRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetDisplayMessagesRequest written to
 std::ostream& operator<<(std::ostream& os, const GetDisplayMessagesRequest& k);
@@ -55,6 +63,12 @@ void to_json(json& j, const GetDisplayMessagesResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetDisplayMessagesResponse \p k
 void from_json(const json& j, GetDisplayMessagesResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetDisplayMessagesResponse
+const JsonSaxFields& json_sax_fields(const GetDisplayMessagesResponse*);
+
+/// \brief Writes the given GetDisplayMessagesResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetDisplayMessagesResponse& k);
+
 /// \brief Writes the string representation of the given GetDisplayMessagesResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetDisplayMessagesResponse written to
 std::ostream& operator<<(std::ostream& os, const GetDisplayMessagesResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -35,6 +37,12 @@ void to_json(json& j, const GetLogRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetLogRequest \p k
 void from_json(const json& j, GetLogRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetLogRequest
+const JsonSaxFields& json_sax_fields(const GetLogRequest*);
+
+/// \brief Writes the given GetLogRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetLogRequest& k);
+
 /// \brief Writes the string representation of the given GetLogRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetLogRequest written to
 std::ostream& operator<<(std::ostream& os, const GetLogRequest& k);
@@ -57,6 +65,12 @@ void to_json(json& j, const GetLogResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetLogResponse \p k
 void from_json(const json& j, GetLogResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetLogResponse
+const JsonSaxFields& json_sax_fields(const GetLogResponse*);
+
+/// \brief Writes the given GetLogResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetLogResponse& k);
+
 /// \brief Writes the string representation of the given GetLogResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetLogResponse written to
 std::ostream& operator<<(std::ostream& os, const GetLogResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -33,6 +35,12 @@ void to_json(json& j, const GetMonitoringReportRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetMonitoringReportRequest \p k
 void from_json(const json& j, GetMonitoringReportRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetMonitoringReportRequest
+const JsonSaxFields& json_sax_fields(const GetMonitoringReportRequest*);
+
+/// \brief Writes the given GetMonitoringReportRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetMonitoringReportRequest& k);
+
 /// \brief Writes the string representation of the given GetMonitoringReportRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetMonitoringReportRequest written to
 std::ostream& operator<<(std::ostream& os, const GetMonitoringReportRequest& k);
@@ -54,6 +62,12 @@ void to_json(json& j, const GetMonitoringReportResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetMonitoringReportResponse \p k
 void from_json(const json& j, GetMonitoringReportResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetMonitoringReportResponse
+const JsonSaxFields& json_sax_fields(const GetMonitoringReportResponse*);
+
+/// \brief Writes the given GetMonitoringReportResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetMonitoringReportResponse& k);
+
 /// \brief Writes the string representation of the given GetMonitoringReportResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetMonitoringReportResponse written to
 std::ostream& operator<<(std::ostream& os, const GetMonitoringReportResponse& k);
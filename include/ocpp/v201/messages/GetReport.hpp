@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -33,6 +35,12 @@ void to_json(json& j, const GetReportRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetReportRequest \p k
 void from_json(const json& j, GetReportRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetReportRequest
+const JsonSaxFields& json_sax_fields(const GetReportRequest*);
+
+/// \brief Writes the given GetReportRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetReportRequest& k);
+
 /// \brief Writes the string representation of the given GetReportRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetReportRequest written to
 std::ostream& operator<<(std::ostream& os, const GetReportRequest& k);
@@ -54,6 +62,12 @@ void to_json(json& j, const GetReportResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetReportResponse \p k
 void from_json(const json& j, GetReportResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetReportResponse
+const JsonSaxFields& json_sax_fields(const GetReportResponse*);
+
+/// \brief Writes the given GetReportResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetReportResponse& k);
+
 /// \brief Writes the string representation of the given GetReportResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetReportResponse written to
 std::ostream& operator<<(std::ostream& os, const GetReportResponse& k);
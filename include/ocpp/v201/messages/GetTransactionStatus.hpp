@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
 
@@ -30,6 +32,12 @@ void to_json(json& j, const GetTransactionStatusRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetTransactionStatusRequest \p k
 void from_json(const json& j, GetTransactionStatusRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetTransactionStatusRequest
+const JsonSaxFields& json_sax_fields(const GetTransactionStatusRequest*);
+
+/// \brief Writes the given GetTransactionStatusRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetTransactionStatusRequest& k);
+
 /// \brief Writes the string representation of the given GetTransactionStatusRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetTransactionStatusRequest written to
 std::ostream& operator<<(std::ostream& os, const GetTransactionStatusRequest& k);
@@ -51,6 +59,12 @@ void to_json(json& j, const GetTransactionStatusResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetTransactionStatusResponse \p k
 void from_json(const json& j, GetTransactionStatusResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetTransactionStatusResponse
+const JsonSaxFields& json_sax_fields(const GetTransactionStatusResponse*);
+
+/// \brief Writes the given GetTransactionStatusResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetTransactionStatusResponse& k);
+
 /// \brief Writes the string representation of the given GetTransactionStatusResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetTransactionStatusResponse written to
 std::ostream& operator<<(std::ostream& os, const GetTransactionStatusResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -31,6 +33,12 @@ void to_json(json& j, const GetVariablesRequest& k);
 /// \brief Conversion from a given json object \p j to a given GetVariablesRequest \p k
 void from_json(const json& j, GetVariablesRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetVariablesRequest
+const JsonSaxFields& json_sax_fields(const GetVariablesRequest*);
+
+/// \brief Writes the given GetVariablesRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetVariablesRequest& k);
+
 /// \brief Writes the string representation of the given GetVariablesRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetVariablesRequest written to
 std::ostream& operator<<(std::ostream& os, const GetVariablesRequest& k);
@@ -51,6 +59,12 @@ void to_json(json& j, const GetVariablesResponse& k);
 /// \brief Conversion from a given json object \p j to a given GetVariablesResponse \p k
 void from_json(const json& j, GetVariablesResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetVariablesResponse
+const JsonSaxFields& json_sax_fields(const GetVariablesResponse*);
+
+/// \brief Writes the given GetVariablesResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetVariablesResponse& k);
+
 /// \brief Writes the string representation of the given GetVariablesResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetVariablesResponse written to
 std::ostream& operator<<(std::ostream& os, const GetVariablesResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
 
@@ -29,6 +31,12 @@ void to_json(json& j, const HeartbeatRequest& k);
 /// \brief Conversion from a given json object \p j to a given HeartbeatRequest \p k
 void from_json(const json& j, HeartbeatRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a HeartbeatRequest
+const JsonSaxFields& json_sax_fields(const HeartbeatRequest*);
+
+/// \brief Writes the given HeartbeatRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const HeartbeatRequest& k);
+
 /// \brief Writes the string representation of the given HeartbeatRequest \p k to the given output stream \p os
 /// \returns an output stream with the HeartbeatRequest written to
 std::ostream& operator<<(std::ostream& os, const HeartbeatRequest& k);
@@ -49,6 +57,12 @@ void to_json(json& j, const HeartbeatResponse& k);
 /// \brief Conversion from a given json object \p j to a given HeartbeatResponse \p k
 void from_json(const json& j, HeartbeatResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a HeartbeatResponse
+const JsonSaxFields& json_sax_fields(const HeartbeatResponse*);
+
+/// \brief Writes the given HeartbeatResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const HeartbeatResponse& k);
+
 /// \brief Writes the string representation of the given HeartbeatResponse \p k to the given output stream \p os
 /// \returns an output stream with the HeartbeatResponse written to
 std::ostream& operator<<(std::ostream& os, const HeartbeatResponse& k);
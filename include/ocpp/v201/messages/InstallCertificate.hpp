@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -32,6 +34,12 @@ void to_json(json& j, const InstallCertificateRequest& k);
 /// \brief Conversion from a given json object \p j to a given InstallCertificateRequest \p k
 void from_json(const json& j, InstallCertificateRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a InstallCertificateRequest
+const JsonSaxFields& json_sax_fields(const InstallCertificateRequest*);
+
+/// \brief Writes the given InstallCertificateRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const InstallCertificateRequest& k);
+
 /// \brief Writes the string representation of the given InstallCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the InstallCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const InstallCertificateRequest& k);
@@ -53,6 +61,12 @@ void to_json(json& j, const InstallCertificateResponse& k);
 /// \brief Conversion from a given json object \p j to a given InstallCertificateResponse \p k
 void from_json(const json& j, InstallCertificateResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a InstallCertificateResponse
+const JsonSaxFields& json_sax_fields(const InstallCertificateResponse*);
+
+/// \brief Writes the given InstallCertificateResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const InstallCertificateResponse& k);
+
 /// \brief Writes the string representation of the given InstallCertificateResponse \p k to the given output stream \p
 /// os \returns an output stream with the InstallCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const InstallCertificateResponse& k);
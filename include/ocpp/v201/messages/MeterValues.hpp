@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -32,6 +34,12 @@ void to_json(json& j, const MeterValuesRequest& k);
 /// \brief Conversion from a given json object \p j to a given MeterValuesRequest \p k
 void from_json(const json& j, MeterValuesRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a MeterValuesRequest
+const JsonSaxFields& json_sax_fields(const MeterValuesRequest*);
+
+/// \brief Writes the given MeterValuesRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const MeterValuesRequest& k);
+
 /// \brief Writes the string representation of the given MeterValuesRequest \p k to the given output stream \p os
 /// \returns an output stream with the MeterValuesRequest written to
 std::ostream& operator<<(std::ostream& os, const MeterValuesRequest& k);
@@ -51,6 +59,12 @@ void to_json(json& j, const MeterValuesResponse& k);
 /// \brief Conversion from a given json object \p j to a given MeterValuesResponse \p k
 void from_json(const json& j, MeterValuesResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a MeterValuesResponse
+const JsonSaxFields& json_sax_fields(const MeterValuesResponse*);
+
+/// \brief Writes the given MeterValuesResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const MeterValuesResponse& k);
+
 /// \brief Writes the string representation of the given MeterValuesResponse \p k to the given output stream \p os
 /// \returns an output stream with the MeterValuesResponse written to
 std::ostream& operator<<(std::ostream& os, const MeterValuesResponse& k);
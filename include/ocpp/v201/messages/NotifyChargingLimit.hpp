@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -33,6 +35,12 @@ void to_json(json& j, const NotifyChargingLimitRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyChargingLimitRequest \p k
 void from_json(const json& j, NotifyChargingLimitRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyChargingLimitRequest
+const JsonSaxFields& json_sax_fields(const NotifyChargingLimitRequest*);
+
+/// \brief Writes the given NotifyChargingLimitRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyChargingLimitRequest& k);
+
 /// \brief Writes the string representation of the given NotifyChargingLimitRequest \p k to the given output stream \p
 /// os \returns an output stream with the NotifyChargingLimitRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyChargingLimitRequest& k);
@@ -52,6 +60,12 @@ void to_json(json& j, const NotifyChargingLimitResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyChargingLimitResponse \p k
 void from_json(const json& j, NotifyChargingLimitResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyChargingLimitResponse
+const JsonSaxFields& json_sax_fields(const NotifyChargingLimitResponse*);
+
+/// \brief Writes the given NotifyChargingLimitResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyChargingLimitResponse& k);
+
 /// \brief Writes the string representation of the given NotifyChargingLimitResponse \p k to the given output stream \p
 /// os \returns an output stream with the NotifyChargingLimitResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyChargingLimitResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
 
@@ -34,6 +36,12 @@ void to_json(json& j, const NotifyCustomerInformationRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyCustomerInformationRequest \p k
 void from_json(const json& j, NotifyCustomerInformationRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyCustomerInformationRequest
+const JsonSaxFields& json_sax_fields(const NotifyCustomerInformationRequest*);
+
+/// \brief Writes the given NotifyCustomerInformationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyCustomerInformationRequest& k);
+
 /// \brief Writes the string representation of the given NotifyCustomerInformationRequest \p k to the given output
 /// stream \p os \returns an output stream with the NotifyCustomerInformationRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyCustomerInformationRequest& k);
@@ -53,6 +61,13 @@ void to_json(json& j, const NotifyCustomerInformationResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyCustomerInformationResponse \p k
 void from_json(const json& j, NotifyCustomerInformationResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyCustomerInformationResponse
+const JsonSaxFields& json_sax_fields(const NotifyCustomerInformationResponse*);
+
+/// \brief Writes the given NotifyCustomerInformationResponse \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const NotifyCustomerInformationResponse& k);
+
 /// \brief Writes the string representation of the given NotifyCustomerInformationResponse \p k to the given output
 /// stream \p os \returns an output stream with the NotifyCustomerInformationResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyCustomerInformationResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -33,6 +35,12 @@ void to_json(json& j, const NotifyDisplayMessagesRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyDisplayMessagesRequest \p k
 void from_json(const json& j, NotifyDisplayMessagesRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyDisplayMessagesRequest
+const JsonSaxFields& json_sax_fields(const NotifyDisplayMessagesRequest*);
+
+/// \brief Writes the given NotifyDisplayMessagesRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyDisplayMessagesRequest& k);
+
 /// \brief Writes the string representation of the given NotifyDisplayMessagesRequest \p k to the given output stream \p
 /// os \returns an output stream with the NotifyDisplayMessagesRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyDisplayMessagesRequest& k);
@@ -52,6 +60,12 @@ void to_json(json& j, const NotifyDisplayMessagesResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyDisplayMessagesResponse \p k
 void from_json(const json& j, NotifyDisplayMessagesResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyDisplayMessagesResponse
+const JsonSaxFields& json_sax_fields(const NotifyDisplayMessagesResponse*);
+
+/// \brief Writes the given NotifyDisplayMessagesResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyDisplayMessagesResponse& k);
+
 /// \brief Writes the string representation of the given NotifyDisplayMessagesResponse \p k to the given output stream
 /// \p os \returns an output stream with the NotifyDisplayMessagesResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyDisplayMessagesResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -33,6 +35,12 @@ void to_json(json& j, const NotifyEVChargingNeedsRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyEVChargingNeedsRequest \p k
 void from_json(const json& j, NotifyEVChargingNeedsRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyEVChargingNeedsRequest
+const JsonSaxFields& json_sax_fields(const NotifyEVChargingNeedsRequest*);
+
+/// \brief Writes the given NotifyEVChargingNeedsRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyEVChargingNeedsRequest& k);
+
 /// \brief Writes the string representation of the given NotifyEVChargingNeedsRequest \p k to the given output stream \p
 /// os \returns an output stream with the NotifyEVChargingNeedsRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingNeedsRequest& k);
@@ -54,6 +62,12 @@ void to_json(json& j, const NotifyEVChargingNeedsResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyEVChargingNeedsResponse \p k
 void from_json(const json& j, NotifyEVChargingNeedsResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyEVChargingNeedsResponse
+const JsonSaxFields& json_sax_fields(const NotifyEVChargingNeedsResponse*);
+
+/// \brief Writes the given NotifyEVChargingNeedsResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyEVChargingNeedsResponse& k);
+
 /// \brief Writes the string representation of the given NotifyEVChargingNeedsResponse \p k to the given output stream
 /// \p os \returns an output stream with the NotifyEVChargingNeedsResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingNeedsResponse& k);
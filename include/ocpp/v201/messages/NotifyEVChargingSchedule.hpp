@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -33,6 +35,12 @@ void to_json(json& j, const NotifyEVChargingScheduleRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyEVChargingScheduleRequest \p k
 void from_json(const json& j, NotifyEVChargingScheduleRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyEVChargingScheduleRequest
+const JsonSaxFields& json_sax_fields(const NotifyEVChargingScheduleRequest*);
+
+/// \brief Writes the given NotifyEVChargingScheduleRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyEVChargingScheduleRequest& k);
+
 /// \brief Writes the string representation of the given NotifyEVChargingScheduleRequest \p k to the given output stream
 /// \p os \returns an output stream with the NotifyEVChargingScheduleRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingScheduleRequest& k);
@@ -54,6 +62,12 @@ void to_json(json& j, const NotifyEVChargingScheduleResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyEVChargingScheduleResponse \p k
 void from_json(const json& j, NotifyEVChargingScheduleResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyEVChargingScheduleResponse
+const JsonSaxFields& json_sax_fields(const NotifyEVChargingScheduleResponse*);
+
+/// \brief Writes the given NotifyEVChargingScheduleResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyEVChargingScheduleResponse& k);
+
 /// \brief Writes the string representation of the given NotifyEVChargingScheduleResponse \p k to the given output
 /// stream \p os \returns an output stream with the NotifyEVChargingScheduleResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingScheduleResponse& k);
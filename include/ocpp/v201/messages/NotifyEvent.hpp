@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -34,6 +36,12 @@ void to_json(json& j, const NotifyEventRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyEventRequest \p k
 void from_json(const json& j, NotifyEventRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyEventRequest
+const JsonSaxFields& json_sax_fields(const NotifyEventRequest*);
+
+/// \brief Writes the given NotifyEventRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyEventRequest& k);
+
 /// \brief Writes the string representation of the given NotifyEventRequest \p k to the given output stream \p os
 /// \returns an output stream with the NotifyEventRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyEventRequest& k);
@@ -53,6 +61,12 @@ void to_json(json& j, const NotifyEventResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyEventResponse \p k
 void from_json(const json& j, NotifyEventResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyEventResponse
+const JsonSaxFields& json_sax_fields(const NotifyEventResponse*);
+
+/// \brief Writes the given NotifyEventResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyEventResponse& k);
+
 /// \brief Writes the string representation of the given NotifyEventResponse \p k to the given output stream \p os
 /// \returns an output stream with the NotifyEventResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyEventResponse& k);
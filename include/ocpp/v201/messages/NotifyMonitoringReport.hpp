@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -35,6 +37,12 @@ void to_json(json& j, const NotifyMonitoringReportRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyMonitoringReportRequest \p k
 void from_json(const json& j, NotifyMonitoringReportRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyMonitoringReportRequest
+const JsonSaxFields& json_sax_fields(const NotifyMonitoringReportRequest*);
+
+/// \brief Writes the given NotifyMonitoringReportRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyMonitoringReportRequest& k);
+
 /// \brief Writes the string representation of the given NotifyMonitoringReportRequest \p k to the given output stream
 /// \p os \returns an output stream with the NotifyMonitoringReportRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyMonitoringReportRequest& k);
@@ -54,6 +62,12 @@ void to_json(json& j, const NotifyMonitoringReportResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyMonitoringReportResponse \p k
 void from_json(const json& j, NotifyMonitoringReportResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyMonitoringReportResponse
+const JsonSaxFields& json_sax_fields(const NotifyMonitoringReportResponse*);
+
+/// \brief Writes the given NotifyMonitoringReportResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyMonitoringReportResponse& k);
+
 /// \brief Writes the string representation of the given NotifyMonitoringReportResponse \p k to the given output stream
 /// \p os \returns an output stream with the NotifyMonitoringReportResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyMonitoringReportResponse& k);
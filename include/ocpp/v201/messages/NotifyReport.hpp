@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -35,6 +37,12 @@ void to_json(json& j, const NotifyReportRequest& k);
 /// \brief Conversion from a given json object \p j to a given NotifyReportRequest \p k
 void from_json(const json& j, NotifyReportRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyReportRequest
+const JsonSaxFields& json_sax_fields(const NotifyReportRequest*);
+
+/// \brief Writes the given NotifyReportRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyReportRequest& k);
+
 /// \brief Writes the string representation of the given NotifyReportRequest \p k to the given output stream \p os
 /// \returns an output stream with the NotifyReportRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyReportRequest& k);
@@ -54,6 +62,12 @@ void to_json(json& j, const NotifyReportResponse& k);
 /// \brief Conversion from a given json object \p j to a given NotifyReportResponse \p k
 void from_json(const json& j, NotifyReportResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyReportResponse
+const JsonSaxFields& json_sax_fields(const NotifyReportResponse*);
+
+/// \brief Writes the given NotifyReportResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyReportResponse& k);
+
 /// \brief Writes the string representation of the given NotifyReportResponse \p k to the given output stream \p os
 /// \returns an output stream with the NotifyReportResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyReportResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -35,6 +37,12 @@ void to_json(json& j, const PublishFirmwareRequest& k);
 /// \brief Conversion from a given json object \p j to a given PublishFirmwareRequest \p k
 void from_json(const json& j, PublishFirmwareRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a PublishFirmwareRequest
+const JsonSaxFields& json_sax_fields(const PublishFirmwareRequest*);
+
+/// \brief Writes the given PublishFirmwareRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const PublishFirmwareRequest& k);
+
 /// \brief Writes the string representation of the given PublishFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the PublishFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareRequest& k);
@@ -56,6 +64,12 @@ void to_json(json& j, const PublishFirmwareResponse& k);
 /// \brief Conversion from a given json object \p j to a given PublishFirmwareResponse \p k
 void from_json(const json& j, PublishFirmwareResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a PublishFirmwareResponse
+const JsonSaxFields& json_sax_fields(const PublishFirmwareResponse*);
+
+/// \brief Writes the given PublishFirmwareResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const PublishFirmwareResponse& k);
+
 /// \brief Writes the string representation of the given PublishFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the PublishFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -33,6 +35,14 @@ void to_json(json& j, const PublishFirmwareStatusNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given PublishFirmwareStatusNotificationRequest \p k
 void from_json(const json& j, PublishFirmwareStatusNotificationRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a
+/// PublishFirmwareStatusNotificationRequest
+const JsonSaxFields& json_sax_fields(const PublishFirmwareStatusNotificationRequest*);
+
+/// \brief Writes the given PublishFirmwareStatusNotificationRequest \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const PublishFirmwareStatusNotificationRequest& k);
+
 /// \brief Writes the string representation of the given PublishFirmwareStatusNotificationRequest \p k to the given
 /// output stream \p os \returns an output stream with the PublishFirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareStatusNotificationRequest& k);
@@ -52,6 +62,14 @@ void to_json(json& j, const PublishFirmwareStatusNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given PublishFirmwareStatusNotificationResponse \p k
 void from_json(const json& j, PublishFirmwareStatusNotificationResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a
+/// PublishFirmwareStatusNotificationResponse
+const JsonSaxFields& json_sax_fields(const PublishFirmwareStatusNotificationResponse*);
+
+/// \brief Writes the given PublishFirmwareStatusNotificationResponse \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const PublishFirmwareStatusNotificationResponse& k);
+
 /// \brief Writes the string representation of the given PublishFirmwareStatusNotificationResponse \p k to the given
 /// output stream \p os \returns an output stream with the PublishFirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareStatusNotificationResponse& k);
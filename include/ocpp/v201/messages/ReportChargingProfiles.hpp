@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -35,6 +37,12 @@ void to_json(json& j, const ReportChargingProfilesRequest& k);
 /// \brief Conversion from a given json object \p j to a given ReportChargingProfilesRequest \p k
 void from_json(const json& j, ReportChargingProfilesRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ReportChargingProfilesRequest
+const JsonSaxFields& json_sax_fields(const ReportChargingProfilesRequest*);
+
+/// \brief Writes the given ReportChargingProfilesRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ReportChargingProfilesRequest& k);
+
 /// \brief Writes the string representation of the given ReportChargingProfilesRequest \p k to the given output stream
 /// \p os \returns an output stream with the ReportChargingProfilesRequest written to
 std::ostream& operator<<(std::ostream& os, const ReportChargingProfilesRequest& k);
@@ -54,6 +62,12 @@ void to_json(json& j, const ReportChargingProfilesResponse& k);
 /// \brief Conversion from a given json object \p j to a given ReportChargingProfilesResponse \p k
 void from_json(const json& j, ReportChargingProfilesResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ReportChargingProfilesResponse
+const JsonSaxFields& json_sax_fields(const ReportChargingProfilesResponse*);
+
+/// \brief Writes the given ReportChargingProfilesResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ReportChargingProfilesResponse& k);
+
 /// \brief Writes the string representation of the given ReportChargingProfilesResponse \p k to the given output stream
 /// \p os \returns an output stream with the ReportChargingProfilesResponse written to
 std::ostream& operator<<(std::ostream& os, const ReportChargingProfilesResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -35,6 +37,12 @@ void to_json(json& j, const RequestStartTransactionRequest& k);
 /// \brief Conversion from a given json object \p j to a given RequestStartTransactionRequest \p k
 void from_json(const json& j, RequestStartTransactionRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a RequestStartTransactionRequest
+const JsonSaxFields& json_sax_fields(const RequestStartTransactionRequest*);
+
+/// \brief Writes the given RequestStartTransactionRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const RequestStartTransactionRequest& k);
+
 /// \brief Writes the string representation of the given RequestStartTransactionRequest \p k to the given output stream
 /// \p os \returns an output stream with the RequestStartTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RequestStartTransactionRequest& k);
@@ -57,6 +65,12 @@ void to_json(json& j, const RequestStartTransactionResponse& k);
 /// \brief Conversion from a given json object \p j to a given RequestStartTransactionResponse \p k
 void from_json(const json& j, RequestStartTransactionResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a RequestStartTransactionResponse
+const JsonSaxFields& json_sax_fields(const RequestStartTransactionResponse*);
+
+/// \brief Writes the given RequestStartTransactionResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const RequestStartTransactionResponse& k);
+
 /// \brief Writes the string representation of the given RequestStartTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RequestStartTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RequestStartTransactionResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -31,6 +33,12 @@ void to_json(json& j, const RequestStopTransactionRequest& k);
 /// \brief Conversion from a given json object \p j to a given RequestStopTransactionRequest \p k
 void from_json(const json& j, RequestStopTransactionRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a RequestStopTransactionRequest
+const JsonSaxFields& json_sax_fields(const RequestStopTransactionRequest*);
+
+/// \brief Writes the given RequestStopTransactionRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const RequestStopTransactionRequest& k);
+
 /// \brief Writes the string representation of the given RequestStopTransactionRequest \p k to the given output stream
 /// \p os \returns an output stream with the RequestStopTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RequestStopTransactionRequest& k);
@@ -52,6 +60,12 @@ void to_json(json& j, const RequestStopTransactionResponse& k);
 /// \brief Conversion from a given json object \p j to a given RequestStopTransactionResponse \p k
 void from_json(const json& j, RequestStopTransactionResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a RequestStopTransactionResponse
+const JsonSaxFields& json_sax_fields(const RequestStopTransactionResponse*);
+
+/// \brief Writes the given RequestStopTransactionResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const RequestStopTransactionResponse& k);
+
 /// \brief Writes the string representation of the given RequestStopTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RequestStopTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RequestStopTransactionResponse& k);
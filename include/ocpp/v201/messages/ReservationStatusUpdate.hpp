@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -32,6 +34,12 @@ void to_json(json& j, const ReservationStatusUpdateRequest& k);
 /// \brief Conversion from a given json object \p j to a given ReservationStatusUpdateRequest \p k
 void from_json(const json& j, ReservationStatusUpdateRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ReservationStatusUpdateRequest
+const JsonSaxFields& json_sax_fields(const ReservationStatusUpdateRequest*);
+
+/// \brief Writes the given ReservationStatusUpdateRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ReservationStatusUpdateRequest& k);
+
 /// \brief Writes the string representation of the given ReservationStatusUpdateRequest \p k to the given output stream
 /// \p os \returns an output stream with the ReservationStatusUpdateRequest written to
 std::ostream& operator<<(std::ostream& os, const ReservationStatusUpdateRequest& k);
@@ -51,6 +59,12 @@ void to_json(json& j, const ReservationStatusUpdateResponse& k);
 /// \brief Conversion from a given json object \p j to a given ReservationStatusUpdateResponse \p k
 void from_json(const json& j, ReservationStatusUpdateResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ReservationStatusUpdateResponse
+const JsonSaxFields& json_sax_fields(const ReservationStatusUpdateResponse*);
+
+/// \brief Writes the given ReservationStatusUpdateResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ReservationStatusUpdateResponse& k);
+
 /// \brief Writes the string representation of the given ReservationStatusUpdateResponse \p k to the given output stream
 /// \p os \returns an output stream with the ReservationStatusUpdateResponse written to
 std::ostream& operator<<(std::ostream& os, const ReservationStatusUpdateResponse& k);
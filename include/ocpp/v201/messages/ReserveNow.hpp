@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -36,6 +38,12 @@ void to_json(json& j, const ReserveNowRequest& k);
 /// \brief Conversion from a given json object \p j to a given ReserveNowRequest \p k
 void from_json(const json& j, ReserveNowRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ReserveNowRequest
+const JsonSaxFields& json_sax_fields(const ReserveNowRequest*);
+
+/// \brief Writes the given ReserveNowRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ReserveNowRequest& k);
+
 /// \brief Writes the string representation of the given ReserveNowRequest \p k to the given output stream \p os
 /// \returns an output stream with the ReserveNowRequest written to
 std::ostream& operator<<(std::ostream& os, const ReserveNowRequest& k);
@@ -57,6 +65,12 @@ void to_json(json& j, const ReserveNowResponse& k);
 /// \brief Conversion from a given json object \p j to a given ReserveNowResponse \p k
 void from_json(const json& j, ReserveNowResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ReserveNowResponse
+const JsonSaxFields& json_sax_fields(const ReserveNowResponse*);
+
+/// \brief Writes the given ReserveNowResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ReserveNowResponse& k);
+
 /// \brief Writes the string representation of the given ReserveNowResponse \p k to the given output stream \p os
 /// \returns an output stream with the ReserveNowResponse written to
 std::ostream& operator<<(std::ostream& os, const ReserveNowResponse& k);
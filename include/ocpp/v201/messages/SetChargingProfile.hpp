@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -32,6 +34,12 @@ void to_json(json& j, const SetChargingProfileRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetChargingProfileRequest \p k
 void from_json(const json& j, SetChargingProfileRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetChargingProfileRequest
+const JsonSaxFields& json_sax_fields(const SetChargingProfileRequest*);
+
+/// \brief Writes the given SetChargingProfileRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetChargingProfileRequest& k);
+
 /// \brief Writes the string representation of the given SetChargingProfileRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetChargingProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const SetChargingProfileRequest& k);
@@ -53,6 +61,12 @@ void to_json(json& j, const SetChargingProfileResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetChargingProfileResponse \p k
 void from_json(const json& j, SetChargingProfileResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetChargingProfileResponse
+const JsonSaxFields& json_sax_fields(const SetChargingProfileResponse*);
+
+/// \brief Writes the given SetChargingProfileResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetChargingProfileResponse& k);
+
 /// \brief Writes the string representation of the given SetChargingProfileResponse \p k to the given output stream \p
 /// os \returns an output stream with the SetChargingProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const SetChargingProfileResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -31,6 +33,12 @@ void to_json(json& j, const SetDisplayMessageRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetDisplayMessageRequest \p k
 void from_json(const json& j, SetDisplayMessageRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetDisplayMessageRequest
+const JsonSaxFields& json_sax_fields(const SetDisplayMessageRequest*);
+
+/// \brief Writes the given SetDisplayMessageRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetDisplayMessageRequest& k);
+
 /// \brief Writes the string representation of the given SetDisplayMessageRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetDisplayMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const SetDisplayMessageRequest& k);
@@ -52,6 +60,12 @@ void to_json(json& j, const SetDisplayMessageResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetDisplayMessageResponse \p k
 void from_json(const json& j, SetDisplayMessageResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetDisplayMessageResponse
+const JsonSaxFields& json_sax_fields(const SetDisplayMessageResponse*);
+
+/// \brief Writes the given SetDisplayMessageResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetDisplayMessageResponse& k);
+
 /// \brief Writes the string representation of the given SetDisplayMessageResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetDisplayMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const SetDisplayMessageResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -31,6 +33,12 @@ void to_json(json& j, const SetMonitoringBaseRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetMonitoringBaseRequest \p k
 void from_json(const json& j, SetMonitoringBaseRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetMonitoringBaseRequest
+const JsonSaxFields& json_sax_fields(const SetMonitoringBaseRequest*);
+
+/// \brief Writes the given SetMonitoringBaseRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetMonitoringBaseRequest& k);
+
 /// \brief Writes the string representation of the given SetMonitoringBaseRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringBaseRequest written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringBaseRequest& k);
@@ -52,6 +60,12 @@ void to_json(json& j, const SetMonitoringBaseResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetMonitoringBaseResponse \p k
 void from_json(const json& j, SetMonitoringBaseResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetMonitoringBaseResponse
+const JsonSaxFields& json_sax_fields(const SetMonitoringBaseResponse*);
+
+/// \brief Writes the given SetMonitoringBaseResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetMonitoringBaseResponse& k);
+
 /// \brief Writes the string representation of the given SetMonitoringBaseResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringBaseResponse written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringBaseResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -31,6 +33,12 @@ void to_json(json& j, const SetMonitoringLevelRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetMonitoringLevelRequest \p k
 void from_json(const json& j, SetMonitoringLevelRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetMonitoringLevelRequest
+const JsonSaxFields& json_sax_fields(const SetMonitoringLevelRequest*);
+
+/// \brief Writes the given SetMonitoringLevelRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetMonitoringLevelRequest& k);
+
 /// \brief Writes the string representation of the given SetMonitoringLevelRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringLevelRequest written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringLevelRequest& k);
@@ -52,6 +60,12 @@ void to_json(json& j, const SetMonitoringLevelResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetMonitoringLevelResponse \p k
 void from_json(const json& j, SetMonitoringLevelResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetMonitoringLevelResponse
+const JsonSaxFields& json_sax_fields(const SetMonitoringLevelResponse*);
+
+/// \brief Writes the given SetMonitoringLevelResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetMonitoringLevelResponse& k);
+
 /// \brief Writes the string representation of the given SetMonitoringLevelResponse \p k to the given output stream \p
 /// os \returns an output stream with the SetMonitoringLevelResponse written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringLevelResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -32,6 +34,12 @@ void to_json(json& j, const SetNetworkProfileRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetNetworkProfileRequest \p k
 void from_json(const json& j, SetNetworkProfileRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetNetworkProfileRequest
+const JsonSaxFields& json_sax_fields(const SetNetworkProfileRequest*);
+
+/// \brief Writes the given SetNetworkProfileRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetNetworkProfileRequest& k);
+
 /// \brief Writes the string representation of the given SetNetworkProfileRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetNetworkProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const SetNetworkProfileRequest& k);
@@ -53,6 +61,12 @@ void to_json(json& j, const SetNetworkProfileResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetNetworkProfileResponse \p k
 void from_json(const json& j, SetNetworkProfileResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetNetworkProfileResponse
+const JsonSaxFields& json_sax_fields(const SetNetworkProfileResponse*);
+
+/// \brief Writes the given SetNetworkProfileResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetNetworkProfileResponse& k);
+
 /// \brief Writes the string representation of the given SetNetworkProfileResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetNetworkProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const SetNetworkProfileResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -31,6 +33,12 @@ void to_json(json& j, const SetVariableMonitoringRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetVariableMonitoringRequest \p k
 void from_json(const json& j, SetVariableMonitoringRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetVariableMonitoringRequest
+const JsonSaxFields& json_sax_fields(const SetVariableMonitoringRequest*);
+
+/// \brief Writes the given SetVariableMonitoringRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetVariableMonitoringRequest& k);
+
 /// \brief Writes the string representation of the given SetVariableMonitoringRequest \p k to the given output stream \p
 /// os \returns an output stream with the SetVariableMonitoringRequest written to
 std::ostream& operator<<(std::ostream& os, const SetVariableMonitoringRequest& k);
@@ -51,6 +59,12 @@ void to_json(json& j, const SetVariableMonitoringResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetVariableMonitoringResponse \p k
 void from_json(const json& j, SetVariableMonitoringResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetVariableMonitoringResponse
+const JsonSaxFields& json_sax_fields(const SetVariableMonitoringResponse*);
+
+/// \brief Writes the given SetVariableMonitoringResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetVariableMonitoringResponse& k);
+
 /// \brief Writes the string representation of the given SetVariableMonitoringResponse \p k to the given output stream
 /// \p os \returns an output stream with the SetVariableMonitoringResponse written to
 std::ostream& operator<<(std::ostream& os, const SetVariableMonitoringResponse& k);
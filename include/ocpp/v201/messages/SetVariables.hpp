@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -31,6 +33,12 @@ void to_json(json& j, const SetVariablesRequest& k);
 /// \brief Conversion from a given json object \p j to a given SetVariablesRequest \p k
 void from_json(const json& j, SetVariablesRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetVariablesRequest
+const JsonSaxFields& json_sax_fields(const SetVariablesRequest*);
+
+/// \brief Writes the given SetVariablesRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetVariablesRequest& k);
+
 /// \brief Writes the string representation of the given SetVariablesRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetVariablesRequest written to
 std::ostream& operator<<(std::ostream& os, const SetVariablesRequest& k);
@@ -51,6 +59,12 @@ void to_json(json& j, const SetVariablesResponse& k);
 /// \brief Conversion from a given json object \p j to a given SetVariablesResponse \p k
 void from_json(const json& j, SetVariablesResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetVariablesResponse
+const JsonSaxFields& json_sax_fields(const SetVariablesResponse*);
+
+/// \brief Writes the given SetVariablesResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetVariablesResponse& k);
+
 /// \brief Writes the string representation of the given SetVariablesResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetVariablesResponse written to
 std::ostream& operator<<(std::ostream& os, const SetVariablesResponse& k);
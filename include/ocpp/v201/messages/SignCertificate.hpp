@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -32,6 +34,12 @@ void to_json(json& j, const SignCertificateRequest& k);
 /// \brief Conversion from a given json object \p j to a given SignCertificateRequest \p k
 void from_json(const json& j, SignCertificateRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SignCertificateRequest
+const JsonSaxFields& json_sax_fields(const SignCertificateRequest*);
+
+/// \brief Writes the given SignCertificateRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SignCertificateRequest& k);
+
 /// \brief Writes the string representation of the given SignCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the SignCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const SignCertificateRequest& k);
@@ -53,6 +61,12 @@ void to_json(json& j, const SignCertificateResponse& k);
 /// \brief Conversion from a given json object \p j to a given SignCertificateResponse \p k
 void from_json(const json& j, SignCertificateResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SignCertificateResponse
+const JsonSaxFields& json_sax_fields(const SignCertificateResponse*);
+
+/// \brief Writes the given SignCertificateResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SignCertificateResponse& k);
+
 /// \brief Writes the string representation of the given SignCertificateResponse \p k to the given output stream \p os
 /// \returns an output stream with the SignCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const SignCertificateResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -34,6 +36,12 @@ void to_json(json& j, const StatusNotificationRequest& k);
 /// \brief Conversion from a given json object \p j to a given StatusNotificationRequest \p k
 void from_json(const json& j, StatusNotificationRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a StatusNotificationRequest
+const JsonSaxFields& json_sax_fields(const StatusNotificationRequest*);
+
+/// \brief Writes the given StatusNotificationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const StatusNotificationRequest& k);
+
 /// \brief Writes the string representation of the given StatusNotificationRequest \p k to the given output stream \p os
 /// \returns an output stream with the StatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const StatusNotificationRequest& k);
@@ -53,6 +61,12 @@ void to_json(json& j, const StatusNotificationResponse& k);
 /// \brief Conversion from a given json object \p j to a given StatusNotificationResponse \p k
 void from_json(const json& j, StatusNotificationResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a StatusNotificationResponse
+const JsonSaxFields& json_sax_fields(const StatusNotificationResponse*);
+
+/// \brief Writes the given StatusNotificationResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const StatusNotificationResponse& k);
+
 /// \brief Writes the string representation of the given StatusNotificationResponse \p k to the given output stream \p
 /// os \returns an output stream with the StatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const StatusNotificationResponse& k);
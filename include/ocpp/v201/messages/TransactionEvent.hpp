@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -42,6 +44,12 @@ void to_json(json& j, const TransactionEventRequest& k);
 /// \brief Conversion from a given json object \p j to a given TransactionEventRequest \p k
 void from_json(const json& j, TransactionEventRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a TransactionEventRequest
+const JsonSaxFields& json_sax_fields(const TransactionEventRequest*);
+
+/// \brief Writes the given TransactionEventRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const TransactionEventRequest& k);
+
 /// \brief Writes the string representation of the given TransactionEventRequest \p k to the given output stream \p os
 /// \returns an output stream with the TransactionEventRequest written to
 std::ostream& operator<<(std::ostream& os, const TransactionEventRequest& k);
@@ -65,6 +73,12 @@ void to_json(json& j, const TransactionEventResponse& k);
 /// \brief Conversion from a given json object \p j to a given TransactionEventResponse \p k
 void from_json(const json& j, TransactionEventResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a TransactionEventResponse
+const JsonSaxFields& json_sax_fields(const TransactionEventResponse*);
+
+/// \brief Writes the given TransactionEventResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const TransactionEventResponse& k);
+
 /// \brief Writes the string representation of the given TransactionEventResponse \p k to the given output stream \p os
 /// \returns an output stream with the TransactionEventResponse written to
 std::ostream& operator<<(std::ostream& os, const TransactionEventResponse& k);
@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -32,6 +34,12 @@ void to_json(json& j, const TriggerMessageRequest& k);
 /// \brief Conversion from a given json object \p j to a given TriggerMessageRequest \p k
 void from_json(const json& j, TriggerMessageRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a TriggerMessageRequest
+const JsonSaxFields& json_sax_fields(const TriggerMessageRequest*);
+
+/// \brief Writes the given TriggerMessageRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const TriggerMessageRequest& k);
+
 /// \brief Writes the string representation of the given TriggerMessageRequest \p k to the given output stream \p os
 /// \returns an output stream with the TriggerMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const TriggerMessageRequest& k);
@@ -53,6 +61,12 @@ void to_json(json& j, const TriggerMessageResponse& k);
 /// \brief Conversion from a given json object \p j to a given TriggerMessageResponse \p k
 void from_json(const json& j, TriggerMessageResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a TriggerMessageResponse
+const JsonSaxFields& json_sax_fields(const TriggerMessageResponse*);
+
+/// \brief Writes the given TriggerMessageResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const TriggerMessageResponse& k);
+
 /// \brief Writes the string representation of the given TriggerMessageResponse \p k to the given output stream \p os
 /// \returns an output stream with the TriggerMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const TriggerMessageResponse& k);
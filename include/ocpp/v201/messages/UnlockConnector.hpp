@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -32,6 +34,12 @@ void to_json(json& j, const UnlockConnectorRequest& k);
 /// \brief Conversion from a given json object \p j to a given UnlockConnectorRequest \p k
 void from_json(const json& j, UnlockConnectorRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a UnlockConnectorRequest
+const JsonSaxFields& json_sax_fields(const UnlockConnectorRequest*);
+
+/// \brief Writes the given UnlockConnectorRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const UnlockConnectorRequest& k);
+
 /// \brief Writes the string representation of the given UnlockConnectorRequest \p k to the given output stream \p os
 /// \returns an output stream with the UnlockConnectorRequest written to
 std::ostream& operator<<(std::ostream& os, const UnlockConnectorRequest& k);
@@ -53,6 +61,12 @@ void to_json(json& j, const UnlockConnectorResponse& k);
 /// \brief Conversion from a given json object \p j to a given UnlockConnectorResponse \p k
 void from_json(const json& j, UnlockConnectorResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a UnlockConnectorResponse
+const JsonSaxFields& json_sax_fields(const UnlockConnectorResponse*);
+
+/// \brief Writes the given UnlockConnectorResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const UnlockConnectorResponse& k);
+
 /// \brief Writes the string representation of the given UnlockConnectorResponse \p k to the given output stream \p os
 /// \returns an output stream with the UnlockConnectorResponse written to
 std::ostream& operator<<(std::ostream& os, const UnlockConnectorResponse& k);
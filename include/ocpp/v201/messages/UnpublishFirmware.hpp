@@ -8,6 +8,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -31,6 +33,12 @@ void to_json(json& j, const UnpublishFirmwareRequest& k);
 /// \brief Conversion from a given json object \p j to a given UnpublishFirmwareRequest \p k
 void from_json(const json& j, UnpublishFirmwareRequest& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a UnpublishFirmwareRequest
+const JsonSaxFields& json_sax_fields(const UnpublishFirmwareRequest*);
+
+/// \brief Writes the given UnpublishFirmwareRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const UnpublishFirmwareRequest& k);
+
 /// \brief Writes the string representation of the given UnpublishFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the UnpublishFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const UnpublishFirmwareRequest& k);
@@ -51,6 +59,12 @@ void to_json(json& j, const UnpublishFirmwareResponse& k);
 /// \brief Conversion from a given json object \p j to a given UnpublishFirmwareResponse \p k
 void from_json(const json& j, UnpublishFirmwareResponse& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a UnpublishFirmwareResponse
+const JsonSaxFields& json_sax_fields(const UnpublishFirmwareResponse*);
+
+/// \brief Writes the given UnpublishFirmwareResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const UnpublishFirmwareResponse& k);
+
 /// \brief Writes the string representation of the given UnpublishFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the UnpublishFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const UnpublishFirmwareResponse& k);
@@ -7,6 +7,7 @@
 
 #include <iosfwd>
 #include <string>
+#include <string_view>
 
 namespace ocpp {
 namespace v201 {
@@ -28,9 +29,9 @@ namespace conversions {
 /// \returns a string representation of the IdTokenEnum
 std::string id_token_enum_to_string(IdTokenEnum e);
 
-/// \brief Converts the given std::string \p s to IdTokenEnum
+/// \brief Converts the given std::string_view \p s to IdTokenEnum
 /// \returns a IdTokenEnum from a string representation
-IdTokenEnum string_to_id_token_enum(const std::string& s);
+IdTokenEnum string_to_id_token_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given IdTokenEnum \p id_token_enum to the given output stream \p os
@@ -49,9 +50,9 @@ namespace conversions {
 /// \returns a string representation of the HashAlgorithmEnum
 std::string hash_algorithm_enum_to_string(HashAlgorithmEnum e);
 
-/// \brief Converts the given std::string \p s to HashAlgorithmEnum
+/// \brief Converts the given std::string_view \p s to HashAlgorithmEnum
 /// \returns a HashAlgorithmEnum from a string representation
-HashAlgorithmEnum string_to_hash_algorithm_enum(const std::string& s);
+HashAlgorithmEnum string_to_hash_algorithm_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given HashAlgorithmEnum \p hash_algorithm_enum to the given output
@@ -77,9 +78,9 @@ namespace conversions {
 /// \returns a string representation of the AuthorizationStatusEnum
 std::string authorization_status_enum_to_string(AuthorizationStatusEnum e);
 
-/// \brief Converts the given std::string \p s to AuthorizationStatusEnum
+/// \brief Converts the given std::string_view \p s to AuthorizationStatusEnum
 /// \returns a AuthorizationStatusEnum from a string representation
-AuthorizationStatusEnum string_to_authorization_status_enum(const std::string& s);
+AuthorizationStatusEnum string_to_authorization_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given AuthorizationStatusEnum \p authorization_status_enum to the
@@ -99,9 +100,9 @@ namespace conversions {
 /// \returns a string representation of the MessageFormatEnum
 std::string message_format_enum_to_string(MessageFormatEnum e);
 
-/// \brief Converts the given std::string \p s to MessageFormatEnum
+/// \brief Converts the given std::string_view \p s to MessageFormatEnum
 /// \returns a MessageFormatEnum from a string representation
-MessageFormatEnum string_to_message_format_enum(const std::string& s);
+MessageFormatEnum string_to_message_format_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given MessageFormatEnum \p message_format_enum to the given output
@@ -124,9 +125,9 @@ namespace conversions {
 /// \returns a string representation of the AuthorizeCertificateStatusEnum
 std::string authorize_certificate_status_enum_to_string(AuthorizeCertificateStatusEnum e);
 
-/// \brief Converts the given std::string \p s to AuthorizeCertificateStatusEnum
+/// \brief Converts the given std::string_view \p s to AuthorizeCertificateStatusEnum
 /// \returns a AuthorizeCertificateStatusEnum from a string representation
-AuthorizeCertificateStatusEnum string_to_authorize_certificate_status_enum(const std::string& s);
+AuthorizeCertificateStatusEnum string_to_authorize_certificate_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given AuthorizeCertificateStatusEnum \p
@@ -152,9 +153,9 @@ namespace conversions {
 /// \returns a string representation of the BootReasonEnum
 std::string boot_reason_enum_to_string(BootReasonEnum e);
 
-/// \brief Converts the given std::string \p s to BootReasonEnum
+/// \brief Converts the given std::string_view \p s to BootReasonEnum
 /// \returns a BootReasonEnum from a string representation
-BootReasonEnum string_to_boot_reason_enum(const std::string& s);
+BootReasonEnum string_to_boot_reason_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given BootReasonEnum \p boot_reason_enum to the given output stream
@@ -173,9 +174,9 @@ namespace conversions {
 /// \returns a string representation of the RegistrationStatusEnum
 std::string registration_status_enum_to_string(RegistrationStatusEnum e);
 
-/// \brief Converts the given std::string \p s to RegistrationStatusEnum
+/// \brief Converts the given std::string_view \p s to RegistrationStatusEnum
 /// \returns a RegistrationStatusEnum from a string representation
-RegistrationStatusEnum string_to_registration_status_enum(const std::string& s);
+RegistrationStatusEnum string_to_registration_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given RegistrationStatusEnum \p registration_status_enum to the given
@@ -193,9 +194,9 @@ namespace conversions {
 /// \returns a string representation of the CancelReservationStatusEnum
 std::string cancel_reservation_status_enum_to_string(CancelReservationStatusEnum e);
 
-/// \brief Converts the given std::string \p s to CancelReservationStatusEnum
+/// \brief Converts the given std::string_view \p s to CancelReservationStatusEnum
 /// \returns a CancelReservationStatusEnum from a string representation
-CancelReservationStatusEnum string_to_cancel_reservation_status_enum(const std::string& s);
+CancelReservationStatusEnum string_to_cancel_reservation_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given CancelReservationStatusEnum \p cancel_reservation_status_enum
@@ -213,9 +214,9 @@ namespace conversions {
 /// \returns a string representation of the CertificateSigningUseEnum
 std::string certificate_signing_use_enum_to_string(CertificateSigningUseEnum e);
 
-/// \brief Converts the given std::string \p s to CertificateSigningUseEnum
+/// \brief Converts the given std::string_view \p s to CertificateSigningUseEnum
 /// \returns a CertificateSigningUseEnum from a string representation
-CertificateSigningUseEnum string_to_certificate_signing_use_enum(const std::string& s);
+CertificateSigningUseEnum string_to_certificate_signing_use_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given CertificateSigningUseEnum \p certificate_signing_use_enum to
@@ -233,9 +234,9 @@ namespace conversions {
 /// \returns a string representation of the CertificateSignedStatusEnum
 std::string certificate_signed_status_enum_to_string(CertificateSignedStatusEnum e);
 
-/// \brief Converts the given std::string \p s to CertificateSignedStatusEnum
+/// \brief Converts the given std::string_view \p s to CertificateSignedStatusEnum
 /// \returns a CertificateSignedStatusEnum from a string representation
-CertificateSignedStatusEnum string_to_certificate_signed_status_enum(const std::string& s);
+CertificateSignedStatusEnum string_to_certificate_signed_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given CertificateSignedStatusEnum \p certificate_signed_status_enum
@@ -253,9 +254,9 @@ namespace conversions {
 /// \returns a string representation of the OperationalStatusEnum
 std::string operational_status_enum_to_string(OperationalStatusEnum e);
 
-/// \brief Converts the given std::string \p s to OperationalStatusEnum
+/// \brief Converts the given std::string_view \p s to OperationalStatusEnum
 /// \returns a OperationalStatusEnum from a string representation
-OperationalStatusEnum string_to_operational_status_enum(const std::string& s);
+OperationalStatusEnum string_to_operational_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given OperationalStatusEnum \p operational_status_enum to the given
@@ -274,9 +275,9 @@ namespace conversions {
 /// \returns a string representation of the ChangeAvailabilityStatusEnum
 std::string change_availability_status_enum_to_string(ChangeAvailabilityStatusEnum e);
 
-/// \brief Converts the given std::string \p s to ChangeAvailabilityStatusEnum
+/// \brief Converts the given std::string_view \p s to ChangeAvailabilityStatusEnum
 /// \returns a ChangeAvailabilityStatusEnum from a string representation
-ChangeAvailabilityStatusEnum string_to_change_availability_status_enum(const std::string& s);
+ChangeAvailabilityStatusEnum string_to_change_availability_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ChangeAvailabilityStatusEnum \p change_availability_status_enum
@@ -294,9 +295,9 @@ namespace conversions {
 /// \returns a string representation of the ClearCacheStatusEnum
 std::string clear_cache_status_enum_to_string(ClearCacheStatusEnum e);
 
-/// \brief Converts the given std::string \p s to ClearCacheStatusEnum
+/// \brief Converts the given std::string_view \p s to ClearCacheStatusEnum
 /// \returns a ClearCacheStatusEnum from a string representation
-ClearCacheStatusEnum string_to_clear_cache_status_enum(const std::string& s);
+ClearCacheStatusEnum string_to_clear_cache_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ClearCacheStatusEnum \p clear_cache_status_enum to the given
@@ -316,9 +317,9 @@ namespace conversions {
 /// \returns a string representation of the ChargingProfilePurposeEnum
 std::string charging_profile_purpose_enum_to_string(ChargingProfilePurposeEnum e);
 
-/// \brief Converts the given std::string \p s to ChargingProfilePurposeEnum
+/// \brief Converts the given std::string_view \p s to ChargingProfilePurposeEnum
 /// \returns a ChargingProfilePurposeEnum from a string representation
-ChargingProfilePurposeEnum string_to_charging_profile_purpose_enum(const std::string& s);
+ChargingProfilePurposeEnum string_to_charging_profile_purpose_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ChargingProfilePurposeEnum \p charging_profile_purpose_enum to
@@ -336,9 +337,9 @@ namespace conversions {
 /// \returns a string representation of the ClearChargingProfileStatusEnum
 std::string clear_charging_profile_status_enum_to_string(ClearChargingProfileStatusEnum e);
 
-/// \brief Converts the given std::string \p s to ClearChargingProfileStatusEnum
+/// \brief Converts the given std::string_view \p s to ClearChargingProfileStatusEnum
 /// \returns a ClearChargingProfileStatusEnum from a string representation
-ClearChargingProfileStatusEnum string_to_clear_charging_profile_status_enum(const std::string& s);
+ClearChargingProfileStatusEnum string_to_clear_charging_profile_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ClearChargingProfileStatusEnum \p
@@ -357,9 +358,9 @@ namespace conversions {
 /// \returns a string representation of the ClearMessageStatusEnum
 std::string clear_message_status_enum_to_string(ClearMessageStatusEnum e);
 
-/// \brief Converts the given std::string \p s to ClearMessageStatusEnum
+/// \brief Converts the given std::string_view \p s to ClearMessageStatusEnum
 /// \returns a ClearMessageStatusEnum from a string representation
-ClearMessageStatusEnum string_to_clear_message_status_enum(const std::string& s);
+ClearMessageStatusEnum string_to_clear_message_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ClearMessageStatusEnum \p clear_message_status_enum to the
@@ -378,9 +379,9 @@ namespace conversions {
 /// \returns a string representation of the ClearMonitoringStatusEnum
 std::string clear_monitoring_status_enum_to_string(ClearMonitoringStatusEnum e);
 
-/// \brief Converts the given std::string \p s to ClearMonitoringStatusEnum
+/// \brief Converts the given std::string_view \p s to ClearMonitoringStatusEnum
 /// \returns a ClearMonitoringStatusEnum from a string representation
-ClearMonitoringStatusEnum string_to_clear_monitoring_status_enum(const std::string& s);
+ClearMonitoringStatusEnum string_to_clear_monitoring_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ClearMonitoringStatusEnum \p clear_monitoring_status_enum to
@@ -400,9 +401,9 @@ namespace conversions {
 /// \returns a string representation of the ChargingLimitSourceEnum
 std::string charging_limit_source_enum_to_string(ChargingLimitSourceEnum e);
 
-/// \brief Converts the given std::string \p s to ChargingLimitSourceEnum
+/// \brief Converts the given std::string_view \p s to ChargingLimitSourceEnum
 /// \returns a ChargingLimitSourceEnum from a string representation
-ChargingLimitSourceEnum string_to_charging_limit_source_enum(const std::string& s);
+ChargingLimitSourceEnum string_to_charging_limit_source_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ChargingLimitSourceEnum \p charging_limit_source_enum to the
@@ -421,9 +422,9 @@ namespace conversions {
 /// \returns a string representation of the CustomerInformationStatusEnum
 std::string customer_information_status_enum_to_string(CustomerInformationStatusEnum e);
 
-/// \brief Converts the given std::string \p s to CustomerInformationStatusEnum
+/// \brief Converts the given std::string_view \p s to CustomerInformationStatusEnum
 /// \returns a CustomerInformationStatusEnum from a string representation
-CustomerInformationStatusEnum string_to_customer_information_status_enum(const std::string& s);
+CustomerInformationStatusEnum string_to_customer_information_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given CustomerInformationStatusEnum \p
@@ -444,9 +445,9 @@ namespace conversions {
 /// \returns a string representation of the DataTransferStatusEnum
 std::string data_transfer_status_enum_to_string(DataTransferStatusEnum e);
 
-/// \brief Converts the given std::string \p s to DataTransferStatusEnum
+/// \brief Converts the given std::string_view \p s to DataTransferStatusEnum
 /// \returns a DataTransferStatusEnum from a string representation
-DataTransferStatusEnum string_to_data_transfer_status_enum(const std::string& s);
+DataTransferStatusEnum string_to_data_transfer_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given DataTransferStatusEnum \p data_transfer_status_enum to the
@@ -465,9 +466,9 @@ namespace conversions {
 /// \returns a string representation of the DeleteCertificateStatusEnum
 std::string delete_certificate_status_enum_to_string(DeleteCertificateStatusEnum e);
 
-/// \brief Converts the given std::string \p s to DeleteCertificateStatusEnum
+/// \brief Converts the given std::string_view \p s to DeleteCertificateStatusEnum
 /// \returns a DeleteCertificateStatusEnum from a string representation
-DeleteCertificateStatusEnum string_to_delete_certificate_status_enum(const std::string& s);
+DeleteCertificateStatusEnum string_to_delete_certificate_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given DeleteCertificateStatusEnum \p delete_certificate_status_enum
@@ -497,9 +498,9 @@ namespace conversions {
 /// \returns a string representation of the FirmwareStatusEnum
 std::string firmware_status_enum_to_string(FirmwareStatusEnum e);
 
-/// \brief Converts the given std::string \p s to FirmwareStatusEnum
+/// \brief Converts the given std::string_view \p s to FirmwareStatusEnum
 /// \returns a FirmwareStatusEnum from a string representation
-FirmwareStatusEnum string_to_firmware_status_enum(const std::string& s);
+FirmwareStatusEnum string_to_firmware_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given FirmwareStatusEnum \p firmware_status_enum to the given output
@@ -517,9 +518,9 @@ namespace conversions {
 /// \returns a string representation of the CertificateActionEnum
 std::string certificate_action_enum_to_string(CertificateActionEnum e);
 
-/// \brief Converts the given std::string \p s to CertificateActionEnum
+/// \brief Converts the given std::string_view \p s to CertificateActionEnum
 /// \returns a CertificateActionEnum from a string representation
-CertificateActionEnum string_to_certificate_action_enum(const std::string& s);
+CertificateActionEnum string_to_certificate_action_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given CertificateActionEnum \p certificate_action_enum to the given
@@ -537,9 +538,9 @@ namespace conversions {
 /// \returns a string representation of the Iso15118EVCertificateStatusEnum
 std::string iso15118evcertificate_status_enum_to_string(Iso15118EVCertificateStatusEnum e);
 
-/// \brief Converts the given std::string \p s to Iso15118EVCertificateStatusEnum
+/// \brief Converts the given std::string_view \p s to Iso15118EVCertificateStatusEnum
 /// \returns a Iso15118EVCertificateStatusEnum from a string representation
-Iso15118EVCertificateStatusEnum string_to_iso15118evcertificate_status_enum(const std::string& s);
+Iso15118EVCertificateStatusEnum string_to_iso15118evcertificate_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given Iso15118EVCertificateStatusEnum \p
@@ -559,9 +560,9 @@ namespace conversions {
 /// \returns a string representation of the ReportBaseEnum
 std::string report_base_enum_to_string(ReportBaseEnum e);
 
-/// \brief Converts the given std::string \p s to ReportBaseEnum
+/// \brief Converts the given std::string_view \p s to ReportBaseEnum
 /// \returns a ReportBaseEnum from a string representation
-ReportBaseEnum string_to_report_base_enum(const std::string& s);
+ReportBaseEnum string_to_report_base_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ReportBaseEnum \p report_base_enum to the given output stream
@@ -581,9 +582,9 @@ namespace conversions {
 /// \returns a string representation of the GenericDeviceModelStatusEnum
 std::string generic_device_model_status_enum_to_string(GenericDeviceModelStatusEnum e);
 
-/// \brief Converts the given std::string \p s to GenericDeviceModelStatusEnum
+/// \brief Converts the given std::string_view \p s to GenericDeviceModelStatusEnum
 /// \returns a GenericDeviceModelStatusEnum from a string representation
-GenericDeviceModelStatusEnum string_to_generic_device_model_status_enum(const std::string& s);
+GenericDeviceModelStatusEnum string_to_generic_device_model_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given GenericDeviceModelStatusEnum \p
@@ -602,9 +603,9 @@ namespace conversions {
 /// \returns a string representation of the GetCertificateStatusEnum
 std::string get_certificate_status_enum_to_string(GetCertificateStatusEnum e);
 
-/// \brief Converts the given std::string \p s to GetCertificateStatusEnum
+/// \brief Converts the given std::string_view \p s to GetCertificateStatusEnum
 /// \returns a GetCertificateStatusEnum from a string representation
-GetCertificateStatusEnum string_to_get_certificate_status_enum(const std::string& s);
+GetCertificateStatusEnum string_to_get_certificate_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given GetCertificateStatusEnum \p get_certificate_status_enum to the
@@ -622,9 +623,9 @@ namespace conversions {
 /// \returns a string representation of the GetChargingProfileStatusEnum
 std::string get_charging_profile_status_enum_to_string(GetChargingProfileStatusEnum e);
 
-/// \brief Converts the given std::string \p s to GetChargingProfileStatusEnum
+/// \brief Converts the given std::string_view \p s to GetChargingProfileStatusEnum
 /// \returns a GetChargingProfileStatusEnum from a string representation
-GetChargingProfileStatusEnum string_to_get_charging_profile_status_enum(const std::string& s);
+GetChargingProfileStatusEnum string_to_get_charging_profile_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given GetChargingProfileStatusEnum \p
@@ -643,9 +644,9 @@ namespace conversions {
 /// \returns a string representation of the ChargingRateUnitEnum
 std::string charging_rate_unit_enum_to_string(ChargingRateUnitEnum e);
 
-/// \brief Converts the given std::string \p s to ChargingRateUnitEnum
+/// \brief Converts the given std::string_view \p s to ChargingRateUnitEnum
 /// \returns a ChargingRateUnitEnum from a string representation
-ChargingRateUnitEnum string_to_charging_rate_unit_enum(const std::string& s);
+ChargingRateUnitEnum string_to_charging_rate_unit_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ChargingRateUnitEnum \p charging_rate_unit_enum to the given
@@ -663,9 +664,9 @@ namespace conversions {
 /// \returns a string representation of the GenericStatusEnum
 std::string generic_status_enum_to_string(GenericStatusEnum e);
 
-/// \brief Converts the given std::string \p s to GenericStatusEnum
+/// \brief Converts the given std::string_view \p s to GenericStatusEnum
 /// \returns a GenericStatusEnum from a string representation
-GenericStatusEnum string_to_generic_status_enum(const std::string& s);
+GenericStatusEnum string_to_generic_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given GenericStatusEnum \p generic_status_enum to the given output
@@ -684,9 +685,9 @@ namespace conversions {
 /// \returns a string representation of the MessagePriorityEnum
 std::string message_priority_enum_to_string(MessagePriorityEnum e);
 
-/// \brief Converts the given std::string \p s to MessagePriorityEnum
+/// \brief Converts the given std::string_view \p s to MessagePriorityEnum
 /// \returns a MessagePriorityEnum from a string representation
-MessagePriorityEnum string_to_message_priority_enum(const std::string& s);
+MessagePriorityEnum string_to_message_priority_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given MessagePriorityEnum \p message_priority_enum to the given
@@ -706,9 +707,9 @@ namespace conversions {
 /// \returns a string representation of the MessageStateEnum
 std::string message_state_enum_to_string(MessageStateEnum e);
 
-/// \brief Converts the given std::string \p s to MessageStateEnum
+/// \brief Converts the given std::string_view \p s to MessageStateEnum
 /// \returns a MessageStateEnum from a string representation
-MessageStateEnum string_to_message_state_enum(const std::string& s);
+MessageStateEnum string_to_message_state_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given MessageStateEnum \p message_state_enum to the given output
@@ -726,9 +727,9 @@ namespace conversions {
 /// \returns a string representation of the GetDisplayMessagesStatusEnum
 std::string get_display_messages_status_enum_to_string(GetDisplayMessagesStatusEnum e);
 
-/// \brief Converts the given std::string \p s to GetDisplayMessagesStatusEnum
+/// \brief Converts the given std::string_view \p s to GetDisplayMessagesStatusEnum
 /// \returns a GetDisplayMessagesStatusEnum from a string representation
-GetDisplayMessagesStatusEnum string_to_get_display_messages_status_enum(const std::string& s);
+GetDisplayMessagesStatusEnum string_to_get_display_messages_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given GetDisplayMessagesStatusEnum \p
@@ -750,9 +751,9 @@ namespace conversions {
 /// \returns a string representation of the GetCertificateIdUseEnum
 std::string get_certificate_id_use_enum_to_string(GetCertificateIdUseEnum e);
 
-/// \brief Converts the given std::string \p s to GetCertificateIdUseEnum
+/// \brief Converts the given std::string_view \p s to GetCertificateIdUseEnum
 /// \returns a GetCertificateIdUseEnum from a string representation
-GetCertificateIdUseEnum string_to_get_certificate_id_use_enum(const std::string& s);
+GetCertificateIdUseEnum string_to_get_certificate_id_use_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given GetCertificateIdUseEnum \p get_certificate_id_use_enum to the
@@ -770,9 +771,9 @@ namespace conversions {
 /// \returns a string representation of the GetInstalledCertificateStatusEnum
 std::string get_installed_certificate_status_enum_to_string(GetInstalledCertificateStatusEnum e);
 
-/// \brief Converts the given std::string \p s to GetInstalledCertificateStatusEnum
+/// \brief Converts the given std::string_view \p s to GetInstalledCertificateStatusEnum
 /// \returns a GetInstalledCertificateStatusEnum from a string representation
-GetInstalledCertificateStatusEnum string_to_get_installed_certificate_status_enum(const std::string& s);
+GetInstalledCertificateStatusEnum string_to_get_installed_certificate_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given GetInstalledCertificateStatusEnum \p
@@ -792,9 +793,9 @@ namespace conversions {
 /// \returns a string representation of the LogEnum
 std::string log_enum_to_string(LogEnum e);
 
-/// \brief Converts the given std::string \p s to LogEnum
+/// \brief Converts the given std::string_view \p s to LogEnum
 /// \returns a LogEnum from a string representation
-LogEnum string_to_log_enum(const std::string& s);
+LogEnum string_to_log_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given LogEnum \p log_enum to the given output stream \p os
@@ -813,9 +814,9 @@ namespace conversions {
 /// \returns a string representation of the LogStatusEnum
 std::string log_status_enum_to_string(LogStatusEnum e);
 
-/// \brief Converts the given std::string \p s to LogStatusEnum
+/// \brief Converts the given std::string_view \p s to LogStatusEnum
 /// \returns a LogStatusEnum from a string representation
-LogStatusEnum string_to_log_status_enum(const std::string& s);
+LogStatusEnum string_to_log_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given LogStatusEnum \p log_status_enum to the given output stream \p
@@ -834,9 +835,9 @@ namespace conversions {
 /// \returns a string representation of the MonitoringCriterionEnum
 std::string monitoring_criterion_enum_to_string(MonitoringCriterionEnum e);
 
-/// \brief Converts the given std::string \p s to MonitoringCriterionEnum
+/// \brief Converts the given std::string_view \p s to MonitoringCriterionEnum
 /// \returns a MonitoringCriterionEnum from a string representation
-MonitoringCriterionEnum string_to_monitoring_criterion_enum(const std::string& s);
+MonitoringCriterionEnum string_to_monitoring_criterion_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given MonitoringCriterionEnum \p monitoring_criterion_enum to the
@@ -856,9 +857,9 @@ namespace conversions {
 /// \returns a string representation of the ComponentCriterionEnum
 std::string component_criterion_enum_to_string(ComponentCriterionEnum e);
 
-/// \brief Converts the given std::string \p s to ComponentCriterionEnum
+/// \brief Converts the given std::string_view \p s to ComponentCriterionEnum
 /// \returns a ComponentCriterionEnum from a string representation
-ComponentCriterionEnum string_to_component_criterion_enum(const std::string& s);
+ComponentCriterionEnum string_to_component_criterion_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ComponentCriterionEnum \p component_criterion_enum to the given
@@ -878,9 +879,9 @@ namespace conversions {
 /// \returns a string representation of the AttributeEnum
 std::string attribute_enum_to_string(AttributeEnum e);
 
-/// \brief Converts the given std::string \p s to AttributeEnum
+/// \brief Converts the given std::string_view \p s to AttributeEnum
 /// \returns a AttributeEnum from a string representation
-AttributeEnum string_to_attribute_enum(const std::string& s);
+AttributeEnum string_to_attribute_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given AttributeEnum \p attribute_enum to the given output stream \p
@@ -901,9 +902,9 @@ namespace conversions {
 /// \returns a string representation of the GetVariableStatusEnum
 std::string get_variable_status_enum_to_string(GetVariableStatusEnum e);
 
-/// \brief Converts the given std::string \p s to GetVariableStatusEnum
+/// \brief Converts the given std::string_view \p s to GetVariableStatusEnum
 /// \returns a GetVariableStatusEnum from a string representation
-GetVariableStatusEnum string_to_get_variable_status_enum(const std::string& s);
+GetVariableStatusEnum string_to_get_variable_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given GetVariableStatusEnum \p get_variable_status_enum to the given
@@ -923,9 +924,9 @@ namespace conversions {
 /// \returns a string representation of the InstallCertificateUseEnum
 std::string install_certificate_use_enum_to_string(InstallCertificateUseEnum e);
 
-/// \brief Converts the given std::string \p s to InstallCertificateUseEnum
+/// \brief Converts the given std::string_view \p s to InstallCertificateUseEnum
 /// \returns a InstallCertificateUseEnum from a string representation
-InstallCertificateUseEnum string_to_install_certificate_use_enum(const std::string& s);
+InstallCertificateUseEnum string_to_install_certificate_use_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given InstallCertificateUseEnum \p install_certificate_use_enum to
@@ -944,9 +945,9 @@ namespace conversions {
 /// \returns a string representation of the InstallCertificateStatusEnum
 std::string install_certificate_status_enum_to_string(InstallCertificateStatusEnum e);
 
-/// \brief Converts the given std::string \p s to InstallCertificateStatusEnum
+/// \brief Converts the given std::string_view \p s to InstallCertificateStatusEnum
 /// \returns a InstallCertificateStatusEnum from a string representation
-InstallCertificateStatusEnum string_to_install_certificate_status_enum(const std::string& s);
+InstallCertificateStatusEnum string_to_install_certificate_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given InstallCertificateStatusEnum \p install_certificate_status_enum
@@ -970,9 +971,9 @@ namespace conversions {
 /// \returns a string representation of the UploadLogStatusEnum
 std::string upload_log_status_enum_to_string(UploadLogStatusEnum e);
 
-/// \brief Converts the given std::string \p s to UploadLogStatusEnum
+/// \brief Converts the given std::string_view \p s to UploadLogStatusEnum
 /// \returns a UploadLogStatusEnum from a string representation
-UploadLogStatusEnum string_to_upload_log_status_enum(const std::string& s);
+UploadLogStatusEnum string_to_upload_log_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given UploadLogStatusEnum \p upload_log_status_enum to the given
@@ -996,9 +997,9 @@ namespace conversions {
 /// \returns a string representation of the ReadingContextEnum
 std::string reading_context_enum_to_string(ReadingContextEnum e);
 
-/// \brief Converts the given std::string \p s to ReadingContextEnum
+/// \brief Converts the given std::string_view \p s to ReadingContextEnum
 /// \returns a ReadingContextEnum from a string representation
-ReadingContextEnum string_to_reading_context_enum(const std::string& s);
+ReadingContextEnum string_to_reading_context_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ReadingContextEnum \p reading_context_enum to the given output
@@ -1039,9 +1040,9 @@ namespace conversions {
 /// \returns a string representation of the MeasurandEnum
 std::string measurand_enum_to_string(MeasurandEnum e);
 
-/// \brief Converts the given std::string \p s to MeasurandEnum
+/// \brief Converts the given std::string_view \p s to MeasurandEnum
 /// \returns a MeasurandEnum from a string representation
-MeasurandEnum string_to_measurand_enum(const std::string& s);
+MeasurandEnum string_to_measurand_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given MeasurandEnum \p measurand_enum to the given output stream \p
@@ -1067,9 +1068,9 @@ namespace conversions {
 /// \returns a string representation of the PhaseEnum
 std::string phase_enum_to_string(PhaseEnum e);
 
-/// \brief Converts the given std::string \p s to PhaseEnum
+/// \brief Converts the given std::string_view \p s to PhaseEnum
 /// \returns a PhaseEnum from a string representation
-PhaseEnum string_to_phase_enum(const std::string& s);
+PhaseEnum string_to_phase_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given PhaseEnum \p phase_enum to the given output stream \p os
@@ -1090,9 +1091,9 @@ namespace conversions {
 /// \returns a string representation of the LocationEnum
 std::string location_enum_to_string(LocationEnum e);
 
-/// \brief Converts the given std::string \p s to LocationEnum
+/// \brief Converts the given std::string_view \p s to LocationEnum
 /// \returns a LocationEnum from a string representation
-LocationEnum string_to_location_enum(const std::string& s);
+LocationEnum string_to_location_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given LocationEnum \p location_enum to the given output stream \p os
@@ -1111,9 +1112,9 @@ namespace conversions {
 /// \returns a string representation of the CostKindEnum
 std::string cost_kind_enum_to_string(CostKindEnum e);
 
-/// \brief Converts the given std::string \p s to CostKindEnum
+/// \brief Converts the given std::string_view \p s to CostKindEnum
 /// \returns a CostKindEnum from a string representation
-CostKindEnum string_to_cost_kind_enum(const std::string& s);
+CostKindEnum string_to_cost_kind_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given CostKindEnum \p cost_kind_enum to the given output stream \p os
@@ -1133,9 +1134,9 @@ namespace conversions {
 /// \returns a string representation of the EnergyTransferModeEnum
 std::string energy_transfer_mode_enum_to_string(EnergyTransferModeEnum e);
 
-/// \brief Converts the given std::string \p s to EnergyTransferModeEnum
+/// \brief Converts the given std::string_view \p s to EnergyTransferModeEnum
 /// \returns a EnergyTransferModeEnum from a string representation
-EnergyTransferModeEnum string_to_energy_transfer_mode_enum(const std::string& s);
+EnergyTransferModeEnum string_to_energy_transfer_mode_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given EnergyTransferModeEnum \p energy_transfer_mode_enum to the
@@ -1154,9 +1155,9 @@ namespace conversions {
 /// \returns a string representation of the NotifyEVChargingNeedsStatusEnum
 std::string notify_evcharging_needs_status_enum_to_string(NotifyEVChargingNeedsStatusEnum e);
 
-/// \brief Converts the given std::string \p s to NotifyEVChargingNeedsStatusEnum
+/// \brief Converts the given std::string_view \p s to NotifyEVChargingNeedsStatusEnum
 /// \returns a NotifyEVChargingNeedsStatusEnum from a string representation
-NotifyEVChargingNeedsStatusEnum string_to_notify_evcharging_needs_status_enum(const std::string& s);
+NotifyEVChargingNeedsStatusEnum string_to_notify_evcharging_needs_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given NotifyEVChargingNeedsStatusEnum \p
@@ -1176,9 +1177,9 @@ namespace conversions {
 /// \returns a string representation of the EventTriggerEnum
 std::string event_trigger_enum_to_string(EventTriggerEnum e);
 
-/// \brief Converts the given std::string \p s to EventTriggerEnum
+/// \brief Converts the given std::string_view \p s to EventTriggerEnum
 /// \returns a EventTriggerEnum from a string representation
-EventTriggerEnum string_to_event_trigger_enum(const std::string& s);
+EventTriggerEnum string_to_event_trigger_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given EventTriggerEnum \p event_trigger_enum to the given output
@@ -1198,9 +1199,9 @@ namespace conversions {
 /// \returns a string representation of the EventNotificationEnum
 std::string event_notification_enum_to_string(EventNotificationEnum e);
 
-/// \brief Converts the given std::string \p s to EventNotificationEnum
+/// \brief Converts the given std::string_view \p s to EventNotificationEnum
 /// \returns a EventNotificationEnum from a string representation
-EventNotificationEnum string_to_event_notification_enum(const std::string& s);
+EventNotificationEnum string_to_event_notification_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given EventNotificationEnum \p event_notification_enum to the given
@@ -1221,9 +1222,9 @@ namespace conversions {
 /// \returns a string representation of the MonitorEnum
 std::string monitor_enum_to_string(MonitorEnum e);
 
-/// \brief Converts the given std::string \p s to MonitorEnum
+/// \brief Converts the given std::string_view \p s to MonitorEnum
 /// \returns a MonitorEnum from a string representation
-MonitorEnum string_to_monitor_enum(const std::string& s);
+MonitorEnum string_to_monitor_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given MonitorEnum \p monitor_enum to the given output stream \p os
@@ -1242,9 +1243,9 @@ namespace conversions {
 /// \returns a string representation of the MutabilityEnum
 std::string mutability_enum_to_string(MutabilityEnum e);
 
-/// \brief Converts the given std::string \p s to MutabilityEnum
+/// \brief Converts the given std::string_view \p s to MutabilityEnum
 /// \returns a MutabilityEnum from a string representation
-MutabilityEnum string_to_mutability_enum(const std::string& s);
+MutabilityEnum string_to_mutability_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given MutabilityEnum \p mutability_enum to the given output stream \p
@@ -1268,9 +1269,9 @@ namespace conversions {
 /// \returns a string representation of the DataEnum
 std::string data_enum_to_string(DataEnum e);
 
-/// \brief Converts the given std::string \p s to DataEnum
+/// \brief Converts the given std::string_view \p s to DataEnum
 /// \returns a DataEnum from a string representation
-DataEnum string_to_data_enum(const std::string& s);
+DataEnum string_to_data_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given DataEnum \p data_enum to the given output stream \p os
@@ -1296,9 +1297,9 @@ namespace conversions {
 /// \returns a string representation of the PublishFirmwareStatusEnum
 std::string publish_firmware_status_enum_to_string(PublishFirmwareStatusEnum e);
 
-/// \brief Converts the given std::string \p s to PublishFirmwareStatusEnum
+/// \brief Converts the given std::string_view \p s to PublishFirmwareStatusEnum
 /// \returns a PublishFirmwareStatusEnum from a string representation
-PublishFirmwareStatusEnum string_to_publish_firmware_status_enum(const std::string& s);
+PublishFirmwareStatusEnum string_to_publish_firmware_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given PublishFirmwareStatusEnum \p publish_firmware_status_enum to
@@ -1317,9 +1318,9 @@ namespace conversions {
 /// \returns a string representation of the ChargingProfileKindEnum
 std::string charging_profile_kind_enum_to_string(ChargingProfileKindEnum e);
 
-/// \brief Converts the given std::string \p s to ChargingProfileKindEnum
+/// \brief Converts the given std::string_view \p s to ChargingProfileKindEnum
 /// \returns a ChargingProfileKindEnum from a string representation
-ChargingProfileKindEnum string_to_charging_profile_kind_enum(const std::string& s);
+ChargingProfileKindEnum string_to_charging_profile_kind_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ChargingProfileKindEnum \p charging_profile_kind_enum to the
@@ -1337,9 +1338,9 @@ namespace conversions {
 /// \returns a string representation of the RecurrencyKindEnum
 std::string recurrency_kind_enum_to_string(RecurrencyKindEnum e);
 
-/// \brief Converts the given std::string \p s to RecurrencyKindEnum
+/// \brief Converts the given std::string_view \p s to RecurrencyKindEnum
 /// \returns a RecurrencyKindEnum from a string representation
-RecurrencyKindEnum string_to_recurrency_kind_enum(const std::string& s);
+RecurrencyKindEnum string_to_recurrency_kind_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given RecurrencyKindEnum \p recurrency_kind_enum to the given output
@@ -1357,9 +1358,9 @@ namespace conversions {
 /// \returns a string representation of the RequestStartStopStatusEnum
 std::string request_start_stop_status_enum_to_string(RequestStartStopStatusEnum e);
 
-/// \brief Converts the given std::string \p s to RequestStartStopStatusEnum
+/// \brief Converts the given std::string_view \p s to RequestStartStopStatusEnum
 /// \returns a RequestStartStopStatusEnum from a string representation
-RequestStartStopStatusEnum string_to_request_start_stop_status_enum(const std::string& s);
+RequestStartStopStatusEnum string_to_request_start_stop_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given RequestStartStopStatusEnum \p request_start_stop_status_enum to
@@ -1377,9 +1378,9 @@ namespace conversions {
 /// \returns a string representation of the ReservationUpdateStatusEnum
 std::string reservation_update_status_enum_to_string(ReservationUpdateStatusEnum e);
 
-/// \brief Converts the given std::string \p s to ReservationUpdateStatusEnum
+/// \brief Converts the given std::string_view \p s to ReservationUpdateStatusEnum
 /// \returns a ReservationUpdateStatusEnum from a string representation
-ReservationUpdateStatusEnum string_to_reservation_update_status_enum(const std::string& s);
+ReservationUpdateStatusEnum string_to_reservation_update_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ReservationUpdateStatusEnum \p reservation_update_status_enum
@@ -1417,9 +1418,9 @@ namespace conversions {
 /// \returns a string representation of the ConnectorEnum
 std::string connector_enum_to_string(ConnectorEnum e);
 
-/// \brief Converts the given std::string \p s to ConnectorEnum
+/// \brief Converts the given std::string_view \p s to ConnectorEnum
 /// \returns a ConnectorEnum from a string representation
-ConnectorEnum string_to_connector_enum(const std::string& s);
+ConnectorEnum string_to_connector_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ConnectorEnum \p connector_enum to the given output stream \p
@@ -1440,9 +1441,9 @@ namespace conversions {
 /// \returns a string representation of the ReserveNowStatusEnum
 std::string reserve_now_status_enum_to_string(ReserveNowStatusEnum e);
 
-/// \brief Converts the given std::string \p s to ReserveNowStatusEnum
+/// \brief Converts the given std::string_view \p s to ReserveNowStatusEnum
 /// \returns a ReserveNowStatusEnum from a string representation
-ReserveNowStatusEnum string_to_reserve_now_status_enum(const std::string& s);
+ReserveNowStatusEnum string_to_reserve_now_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ReserveNowStatusEnum \p reserve_now_status_enum to the given
@@ -1460,9 +1461,9 @@ namespace conversions {
 /// \returns a string representation of the ResetEnum
 std::string reset_enum_to_string(ResetEnum e);
 
-/// \brief Converts the given std::string \p s to ResetEnum
+/// \brief Converts the given std::string_view \p s to ResetEnum
 /// \returns a ResetEnum from a string representation
-ResetEnum string_to_reset_enum(const std::string& s);
+ResetEnum string_to_reset_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ResetEnum \p reset_enum to the given output stream \p os
@@ -1481,9 +1482,9 @@ namespace conversions {
 /// \returns a string representation of the ResetStatusEnum
 std::string reset_status_enum_to_string(ResetStatusEnum e);
 
-/// \brief Converts the given std::string \p s to ResetStatusEnum
+/// \brief Converts the given std::string_view \p s to ResetStatusEnum
 /// \returns a ResetStatusEnum from a string representation
-ResetStatusEnum string_to_reset_status_enum(const std::string& s);
+ResetStatusEnum string_to_reset_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ResetStatusEnum \p reset_status_enum to the given output stream
@@ -1501,9 +1502,9 @@ namespace conversions {
 /// \returns a string representation of the UpdateEnum
 std::string update_enum_to_string(UpdateEnum e);
 
-/// \brief Converts the given std::string \p s to UpdateEnum
+/// \brief Converts the given std::string_view \p s to UpdateEnum
 /// \returns a UpdateEnum from a string representation
-UpdateEnum string_to_update_enum(const std::string& s);
+UpdateEnum string_to_update_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given UpdateEnum \p update_enum to the given output stream \p os
@@ -1522,9 +1523,9 @@ namespace conversions {
 /// \returns a string representation of the SendLocalListStatusEnum
 std::string send_local_list_status_enum_to_string(SendLocalListStatusEnum e);
 
-/// \brief Converts the given std::string \p s to SendLocalListStatusEnum
+/// \brief Converts the given std::string_view \p s to SendLocalListStatusEnum
 /// \returns a SendLocalListStatusEnum from a string representation
-SendLocalListStatusEnum string_to_send_local_list_status_enum(const std::string& s);
+SendLocalListStatusEnum string_to_send_local_list_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given SendLocalListStatusEnum \p send_local_list_status_enum to the
@@ -1542,9 +1543,9 @@ namespace conversions {
 /// \returns a string representation of the ChargingProfileStatusEnum
 std::string charging_profile_status_enum_to_string(ChargingProfileStatusEnum e);
 
-/// \brief Converts the given std::string \p s to ChargingProfileStatusEnum
+/// \brief Converts the given std::string_view \p s to ChargingProfileStatusEnum
 /// \returns a ChargingProfileStatusEnum from a string representation
-ChargingProfileStatusEnum string_to_charging_profile_status_enum(const std::string& s);
+ChargingProfileStatusEnum string_to_charging_profile_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ChargingProfileStatusEnum \p charging_profile_status_enum to
@@ -1566,9 +1567,9 @@ namespace conversions {
 /// \returns a string representation of the DisplayMessageStatusEnum
 std::string display_message_status_enum_to_string(DisplayMessageStatusEnum e);
 
-/// \brief Converts the given std::string \p s to DisplayMessageStatusEnum
+/// \brief Converts the given std::string_view \p s to DisplayMessageStatusEnum
 /// \returns a DisplayMessageStatusEnum from a string representation
-DisplayMessageStatusEnum string_to_display_message_status_enum(const std::string& s);
+DisplayMessageStatusEnum string_to_display_message_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given DisplayMessageStatusEnum \p display_message_status_enum to the
@@ -1587,9 +1588,9 @@ namespace conversions {
 /// \returns a string representation of the MonitoringBaseEnum
 std::string monitoring_base_enum_to_string(MonitoringBaseEnum e);
 
-/// \brief Converts the given std::string \p s to MonitoringBaseEnum
+/// \brief Converts the given std::string_view \p s to MonitoringBaseEnum
 /// \returns a MonitoringBaseEnum from a string representation
-MonitoringBaseEnum string_to_monitoring_base_enum(const std::string& s);
+MonitoringBaseEnum string_to_monitoring_base_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given MonitoringBaseEnum \p monitoring_base_enum to the given output
@@ -1609,9 +1610,9 @@ namespace conversions {
 /// \returns a string representation of the APNAuthenticationEnum
 std::string apnauthentication_enum_to_string(APNAuthenticationEnum e);
 
-/// \brief Converts the given std::string \p s to APNAuthenticationEnum
+/// \brief Converts the given std::string_view \p s to APNAuthenticationEnum
 /// \returns a APNAuthenticationEnum from a string representation
-APNAuthenticationEnum string_to_apnauthentication_enum(const std::string& s);
+APNAuthenticationEnum string_to_apnauthentication_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given APNAuthenticationEnum \p apnauthentication_enum to the given
@@ -1631,9 +1632,9 @@ namespace conversions {
 /// \returns a string representation of the OCPPVersionEnum
 std::string ocppversion_enum_to_string(OCPPVersionEnum e);
 
-/// \brief Converts the given std::string \p s to OCPPVersionEnum
+/// \brief Converts the given std::string_view \p s to OCPPVersionEnum
 /// \returns a OCPPVersionEnum from a string representation
-OCPPVersionEnum string_to_ocppversion_enum(const std::string& s);
+OCPPVersionEnum string_to_ocppversion_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given OCPPVersionEnum \p ocppversion_enum to the given output stream
@@ -1651,9 +1652,9 @@ namespace conversions {
 /// \returns a string representation of the OCPPTransportEnum
 std::string ocpptransport_enum_to_string(OCPPTransportEnum e);
 
-/// \brief Converts the given std::string \p s to OCPPTransportEnum
+/// \brief Converts the given std::string_view \p s to OCPPTransportEnum
 /// \returns a OCPPTransportEnum from a string representation
-OCPPTransportEnum string_to_ocpptransport_enum(const std::string& s);
+OCPPTransportEnum string_to_ocpptransport_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given OCPPTransportEnum \p ocpptransport_enum to the given output
@@ -1677,9 +1678,9 @@ namespace conversions {
 /// \returns a string representation of the OCPPInterfaceEnum
 std::string ocppinterface_enum_to_string(OCPPInterfaceEnum e);
 
-/// \brief Converts the given std::string \p s to OCPPInterfaceEnum
+/// \brief Converts the given std::string_view \p s to OCPPInterfaceEnum
 /// \returns a OCPPInterfaceEnum from a string representation
-OCPPInterfaceEnum string_to_ocppinterface_enum(const std::string& s);
+OCPPInterfaceEnum string_to_ocppinterface_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given OCPPInterfaceEnum \p ocppinterface_enum to the given output
@@ -1699,9 +1700,9 @@ namespace conversions {
 /// \returns a string representation of the VPNEnum
 std::string vpnenum_to_string(VPNEnum e);
 
-/// \brief Converts the given std::string \p s to VPNEnum
+/// \brief Converts the given std::string_view \p s to VPNEnum
 /// \returns a VPNEnum from a string representation
-VPNEnum string_to_vpnenum(const std::string& s);
+VPNEnum string_to_vpnenum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given VPNEnum \p vpnenum to the given output stream \p os
@@ -1720,9 +1721,9 @@ namespace conversions {
 /// \returns a string representation of the SetNetworkProfileStatusEnum
 std::string set_network_profile_status_enum_to_string(SetNetworkProfileStatusEnum e);
 
-/// \brief Converts the given std::string \p s to SetNetworkProfileStatusEnum
+/// \brief Converts the given std::string_view \p s to SetNetworkProfileStatusEnum
 /// \returns a SetNetworkProfileStatusEnum from a string representation
-SetNetworkProfileStatusEnum string_to_set_network_profile_status_enum(const std::string& s);
+SetNetworkProfileStatusEnum string_to_set_network_profile_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given SetNetworkProfileStatusEnum \p set_network_profile_status_enum
@@ -1744,9 +1745,9 @@ namespace conversions {
 /// \returns a string representation of the SetMonitoringStatusEnum
 std::string set_monitoring_status_enum_to_string(SetMonitoringStatusEnum e);
 
-/// \brief Converts the given std::string \p s to SetMonitoringStatusEnum
+/// \brief Converts the given std::string_view \p s to SetMonitoringStatusEnum
 /// \returns a SetMonitoringStatusEnum from a string representation
-SetMonitoringStatusEnum string_to_set_monitoring_status_enum(const std::string& s);
+SetMonitoringStatusEnum string_to_set_monitoring_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given SetMonitoringStatusEnum \p set_monitoring_status_enum to the
@@ -1768,9 +1769,9 @@ namespace conversions {
 /// \returns a string representation of the SetVariableStatusEnum
 std::string set_variable_status_enum_to_string(SetVariableStatusEnum e);
 
-/// \brief Converts the given std::string \p s to SetVariableStatusEnum
+/// \brief Converts the given std::string_view \p s to SetVariableStatusEnum
 /// \returns a SetVariableStatusEnum from a string representation
-SetVariableStatusEnum string_to_set_variable_status_enum(const std::string& s);
+SetVariableStatusEnum string_to_set_variable_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given SetVariableStatusEnum \p set_variable_status_enum to the given
@@ -1791,9 +1792,9 @@ namespace conversions {
 /// \returns a string representation of the ConnectorStatusEnum
 std::string connector_status_enum_to_string(ConnectorStatusEnum e);
 
-/// \brief Converts the given std::string \p s to ConnectorStatusEnum
+/// \brief Converts the given std::string_view \p s to ConnectorStatusEnum
 /// \returns a ConnectorStatusEnum from a string representation
-ConnectorStatusEnum string_to_connector_status_enum(const std::string& s);
+ConnectorStatusEnum string_to_connector_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ConnectorStatusEnum \p connector_status_enum to the given
@@ -1812,9 +1813,9 @@ namespace conversions {
 /// \returns a string representation of the TransactionEventEnum
 std::string transaction_event_enum_to_string(TransactionEventEnum e);
 
-/// \brief Converts the given std::string \p s to TransactionEventEnum
+/// \brief Converts the given std::string_view \p s to TransactionEventEnum
 /// \returns a TransactionEventEnum from a string representation
-TransactionEventEnum string_to_transaction_event_enum(const std::string& s);
+TransactionEventEnum string_to_transaction_event_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given TransactionEventEnum \p transaction_event_enum to the given
@@ -1851,9 +1852,9 @@ namespace conversions {
 /// \returns a string representation of the TriggerReasonEnum
 std::string trigger_reason_enum_to_string(TriggerReasonEnum e);
 
-/// \brief Converts the given std::string \p s to TriggerReasonEnum
+/// \brief Converts the given std::string_view \p s to TriggerReasonEnum
 /// \returns a TriggerReasonEnum from a string representation
-TriggerReasonEnum string_to_trigger_reason_enum(const std::string& s);
+TriggerReasonEnum string_to_trigger_reason_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given TriggerReasonEnum \p trigger_reason_enum to the given output
@@ -1874,9 +1875,9 @@ namespace conversions {
 /// \returns a string representation of the ChargingStateEnum
 std::string charging_state_enum_to_string(ChargingStateEnum e);
 
-/// \brief Converts the given std::string \p s to ChargingStateEnum
+/// \brief Converts the given std::string_view \p s to ChargingStateEnum
 /// \returns a ChargingStateEnum from a string representation
-ChargingStateEnum string_to_charging_state_enum(const std::string& s);
+ChargingStateEnum string_to_charging_state_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ChargingStateEnum \p charging_state_enum to the given output
@@ -1911,9 +1912,9 @@ namespace conversions {
 /// \returns a string representation of the ReasonEnum
 std::string reason_enum_to_string(ReasonEnum e);
 
-/// \brief Converts the given std::string \p s to ReasonEnum
+/// \brief Converts the given std::string_view \p s to ReasonEnum
 /// \returns a ReasonEnum from a string representation
-ReasonEnum string_to_reason_enum(const std::string& s);
+ReasonEnum string_to_reason_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given ReasonEnum \p reason_enum to the given output stream \p os
@@ -1940,9 +1941,9 @@ namespace conversions {
 /// \returns a string representation of the MessageTriggerEnum
 std::string message_trigger_enum_to_string(MessageTriggerEnum e);
 
-/// \brief Converts the given std::string \p s to MessageTriggerEnum
+/// \brief Converts the given std::string_view \p s to MessageTriggerEnum
 /// \returns a MessageTriggerEnum from a string representation
-MessageTriggerEnum string_to_message_trigger_enum(const std::string& s);
+MessageTriggerEnum string_to_message_trigger_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given MessageTriggerEnum \p message_trigger_enum to the given output
@@ -1961,9 +1962,9 @@ namespace conversions {
 /// \returns a string representation of the TriggerMessageStatusEnum
 std::string trigger_message_status_enum_to_string(TriggerMessageStatusEnum e);
 
-/// \brief Converts the given std::string \p s to TriggerMessageStatusEnum
+/// \brief Converts the given std::string_view \p s to TriggerMessageStatusEnum
 /// \returns a TriggerMessageStatusEnum from a string representation
-TriggerMessageStatusEnum string_to_trigger_message_status_enum(const std::string& s);
+TriggerMessageStatusEnum string_to_trigger_message_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given TriggerMessageStatusEnum \p trigger_message_status_enum to the
@@ -1983,9 +1984,9 @@ namespace conversions {
 /// \returns a string representation of the UnlockStatusEnum
 std::string unlock_status_enum_to_string(UnlockStatusEnum e);
 
-/// \brief Converts the given std::string \p s to UnlockStatusEnum
+/// \brief Converts the given std::string_view \p s to UnlockStatusEnum
 /// \returns a UnlockStatusEnum from a string representation
-UnlockStatusEnum string_to_unlock_status_enum(const std::string& s);
+UnlockStatusEnum string_to_unlock_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given UnlockStatusEnum \p unlock_status_enum to the given output
@@ -2004,9 +2005,9 @@ namespace conversions {
 /// \returns a string representation of the UnpublishFirmwareStatusEnum
 std::string unpublish_firmware_status_enum_to_string(UnpublishFirmwareStatusEnum e);
 
-/// \brief Converts the given std::string \p s to UnpublishFirmwareStatusEnum
+/// \brief Converts the given std::string_view \p s to UnpublishFirmwareStatusEnum
 /// \returns a UnpublishFirmwareStatusEnum from a string representation
-UnpublishFirmwareStatusEnum string_to_unpublish_firmware_status_enum(const std::string& s);
+UnpublishFirmwareStatusEnum string_to_unpublish_firmware_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given UnpublishFirmwareStatusEnum \p unpublish_firmware_status_enum
@@ -2027,9 +2028,9 @@ namespace conversions {
 /// \returns a string representation of the UpdateFirmwareStatusEnum
 std::string update_firmware_status_enum_to_string(UpdateFirmwareStatusEnum e);
 
-/// \brief Converts the given std::string \p s to UpdateFirmwareStatusEnum
+/// \brief Converts the given std::string_view \p s to UpdateFirmwareStatusEnum
 /// \returns a UpdateFirmwareStatusEnum from a string representation
-UpdateFirmwareStatusEnum string_to_update_firmware_status_enum(const std::string& s);
+UpdateFirmwareStatusEnum string_to_update_firmware_status_enum(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given UpdateFirmwareStatusEnum \p update_firmware_status_enum to the
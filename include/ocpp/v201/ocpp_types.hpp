@@ -10,6 +10,8 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_sax_fields.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 
@@ -29,6 +31,12 @@ void to_json(json& j, const AdditionalInfo& k);
 /// \brief Conversion from a given json object \p j to a given AdditionalInfo \p k
 void from_json(const json& j, AdditionalInfo& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a AdditionalInfo
+const JsonSaxFields& json_sax_fields(const AdditionalInfo*);
+
+/// \brief Writes the given AdditionalInfo \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const AdditionalInfo& k);
+
 // \brief Writes the string representation of the given AdditionalInfo \p k to the given output stream \p os
 /// \returns an output stream with the AdditionalInfo written to
 std::ostream& operator<<(std::ostream& os, const AdditionalInfo& k);
@@ -45,6 +53,12 @@ void to_json(json& j, const IdToken& k);
 /// \brief Conversion from a given json object \p j to a given IdToken \p k
 void from_json(const json& j, IdToken& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a IdToken
+const JsonSaxFields& json_sax_fields(const IdToken*);
+
+/// \brief Writes the given IdToken \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const IdToken& k);
+
 // \brief Writes the string representation of the given IdToken \p k to the given output stream \p os
 /// \returns an output stream with the IdToken written to
 std::ostream& operator<<(std::ostream& os, const IdToken& k);
@@ -63,6 +77,12 @@ void to_json(json& j, const OCSPRequestData& k);
 /// \brief Conversion from a given json object \p j to a given OCSPRequestData \p k
 void from_json(const json& j, OCSPRequestData& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a OCSPRequestData
+const JsonSaxFields& json_sax_fields(const OCSPRequestData*);
+
+/// \brief Writes the given OCSPRequestData \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const OCSPRequestData& k);
+
 // \brief Writes the string representation of the given OCSPRequestData \p k to the given output stream \p os
 /// \returns an output stream with the OCSPRequestData written to
 std::ostream& operator<<(std::ostream& os, const OCSPRequestData& k);
@@ -79,6 +99,12 @@ void to_json(json& j, const MessageContent& k);
 /// \brief Conversion from a given json object \p j to a given MessageContent \p k
 void from_json(const json& j, MessageContent& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a MessageContent
+const JsonSaxFields& json_sax_fields(const MessageContent*);
+
+/// \brief Writes the given MessageContent \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const MessageContent& k);
+
 // \brief Writes the string representation of the given MessageContent \p k to the given output stream \p os
 /// \returns an output stream with the MessageContent written to
 std::ostream& operator<<(std::ostream& os, const MessageContent& k);
@@ -100,6 +126,12 @@ void to_json(json& j, const IdTokenInfo& k);
 /// \brief Conversion from a given json object \p j to a given IdTokenInfo \p k
 void from_json(const json& j, IdTokenInfo& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a IdTokenInfo
+const JsonSaxFields& json_sax_fields(const IdTokenInfo*);
+
+/// \brief Writes the given IdTokenInfo \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const IdTokenInfo& k);
+
 // \brief Writes the string representation of the given IdTokenInfo \p k to the given output stream \p os
 /// \returns an output stream with the IdTokenInfo written to
 std::ostream& operator<<(std::ostream& os, const IdTokenInfo& k);
@@ -115,6 +147,12 @@ void to_json(json& j, const Modem& k);
 /// \brief Conversion from a given json object \p j to a given Modem \p k
 void from_json(const json& j, Modem& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a Modem
+const JsonSaxFields& json_sax_fields(const Modem*);
+
+/// \brief Writes the given Modem \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const Modem& k);
+
 // \brief Writes the string representation of the given Modem \p k to the given output stream \p os
 /// \returns an output stream with the Modem written to
 std::ostream& operator<<(std::ostream& os, const Modem& k);
@@ -133,6 +171,12 @@ void to_json(json& j, const ChargingStation& k);
 /// \brief Conversion from a given json object \p j to a given ChargingStation \p k
 void from_json(const json& j, ChargingStation& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChargingStation
+const JsonSaxFields& json_sax_fields(const ChargingStation*);
+
+/// \brief Writes the given ChargingStation \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChargingStation& k);
+
 // \brief Writes the string representation of the given ChargingStation \p k to the given output stream \p os
 /// \returns an output stream with the ChargingStation written to
 std::ostream& operator<<(std::ostream& os, const ChargingStation& k);
@@ -148,6 +192,12 @@ void to_json(json& j, const StatusInfo& k);
 /// \brief Conversion from a given json object \p j to a given StatusInfo \p k
 void from_json(const json& j, StatusInfo& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a StatusInfo
+const JsonSaxFields& json_sax_fields(const StatusInfo*);
+
+/// \brief Writes the given StatusInfo \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const StatusInfo& k);
+
 // \brief Writes the string representation of the given StatusInfo \p k to the given output stream \p os
 /// \returns an output stream with the StatusInfo written to
 std::ostream& operator<<(std::ostream& os, const StatusInfo& k);
@@ -163,6 +213,12 @@ void to_json(json& j, const EVSE& k);
 /// \brief Conversion from a given json object \p j to a given EVSE \p k
 void from_json(const json& j, EVSE& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a EVSE
+const JsonSaxFields& json_sax_fields(const EVSE*);
+
+/// \brief Writes the given EVSE \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const EVSE& k);
+
 // \brief Writes the string representation of the given EVSE \p k to the given output stream \p os
 /// \returns an output stream with the EVSE written to
 std::ostream& operator<<(std::ostream& os, const EVSE& k);
@@ -179,6 +235,12 @@ void to_json(json& j, const ClearChargingProfile& k);
 /// \brief Conversion from a given json object \p j to a given ClearChargingProfile \p k
 void from_json(const json& j, ClearChargingProfile& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearChargingProfile
+const JsonSaxFields& json_sax_fields(const ClearChargingProfile*);
+
+/// \brief Writes the given ClearChargingProfile \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearChargingProfile& k);
+
 // \brief Writes the string representation of the given ClearChargingProfile \p k to the given output stream \p os
 /// \returns an output stream with the ClearChargingProfile written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfile& k);
@@ -195,6 +257,12 @@ void to_json(json& j, const ClearMonitoringResult& k);
 /// \brief Conversion from a given json object \p j to a given ClearMonitoringResult \p k
 void from_json(const json& j, ClearMonitoringResult& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearMonitoringResult
+const JsonSaxFields& json_sax_fields(const ClearMonitoringResult*);
+
+/// \brief Writes the given ClearMonitoringResult \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearMonitoringResult& k);
+
 // \brief Writes the string representation of the given ClearMonitoringResult \p k to the given output stream \p os
 /// \returns an output stream with the ClearMonitoringResult written to
 std::ostream& operator<<(std::ostream& os, const ClearMonitoringResult& k);
@@ -212,6 +280,12 @@ void to_json(json& j, const CertificateHashDataType& k);
 /// \brief Conversion from a given json object \p j to a given CertificateHashDataType \p k
 void from_json(const json& j, CertificateHashDataType& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CertificateHashDataType
+const JsonSaxFields& json_sax_fields(const CertificateHashDataType*);
+
+/// \brief Writes the given CertificateHashDataType \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CertificateHashDataType& k);
+
 // \brief Writes the string representation of the given CertificateHashDataType \p k to the given output stream \p os
 /// \returns an output stream with the CertificateHashDataType written to
 std::ostream& operator<<(std::ostream& os, const CertificateHashDataType& k);
@@ -229,6 +303,12 @@ void to_json(json& j, const ChargingProfileCriterion& k);
 /// \brief Conversion from a given json object \p j to a given ChargingProfileCriterion \p k
 void from_json(const json& j, ChargingProfileCriterion& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChargingProfileCriterion
+const JsonSaxFields& json_sax_fields(const ChargingProfileCriterion*);
+
+/// \brief Writes the given ChargingProfileCriterion \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChargingProfileCriterion& k);
+
 // \brief Writes the string representation of the given ChargingProfileCriterion \p k to the given output stream \p os
 /// \returns an output stream with the ChargingProfileCriterion written to
 std::ostream& operator<<(std::ostream& os, const ChargingProfileCriterion& k);
@@ -246,6 +326,12 @@ void to_json(json& j, const ChargingSchedulePeriod& k);
 /// \brief Conversion from a given json object \p j to a given ChargingSchedulePeriod \p k
 void from_json(const json& j, ChargingSchedulePeriod& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChargingSchedulePeriod
+const JsonSaxFields& json_sax_fields(const ChargingSchedulePeriod*);
+
+/// \brief Writes the given ChargingSchedulePeriod \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChargingSchedulePeriod& k);
+
 // \brief Writes the string representation of the given ChargingSchedulePeriod \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedulePeriod written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedulePeriod& k);
@@ -264,6 +350,12 @@ void to_json(json& j, const CompositeSchedule& k);
 /// \brief Conversion from a given json object \p j to a given CompositeSchedule \p k
 void from_json(const json& j, CompositeSchedule& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CompositeSchedule
+const JsonSaxFields& json_sax_fields(const CompositeSchedule*);
+
+/// \brief Writes the given CompositeSchedule \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CompositeSchedule& k);
+
 // \brief Writes the string representation of the given CompositeSchedule \p k to the given output stream \p os
 /// \returns an output stream with the CompositeSchedule written to
 std::ostream& operator<<(std::ostream& os, const CompositeSchedule& k);
@@ -280,6 +372,12 @@ void to_json(json& j, const CertificateHashDataChain& k);
 /// \brief Conversion from a given json object \p j to a given CertificateHashDataChain \p k
 void from_json(const json& j, CertificateHashDataChain& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CertificateHashDataChain
+const JsonSaxFields& json_sax_fields(const CertificateHashDataChain*);
+
+/// \brief Writes the given CertificateHashDataChain \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CertificateHashDataChain& k);
+
 // \brief Writes the string representation of the given CertificateHashDataChain \p k to the given output stream \p os
 /// \returns an output stream with the CertificateHashDataChain written to
 std::ostream& operator<<(std::ostream& os, const CertificateHashDataChain& k);
@@ -296,6 +394,12 @@ void to_json(json& j, const LogParameters& k);
 /// \brief Conversion from a given json object \p j to a given LogParameters \p k
 void from_json(const json& j, LogParameters& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a LogParameters
+const JsonSaxFields& json_sax_fields(const LogParameters*);
+
+/// \brief Writes the given LogParameters \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const LogParameters& k);
+
 // \brief Writes the string representation of the given LogParameters \p k to the given output stream \p os
 /// \returns an output stream with the LogParameters written to
 std::ostream& operator<<(std::ostream& os, const LogParameters& k);
@@ -312,6 +416,12 @@ void to_json(json& j, const Component& k);
 /// \brief Conversion from a given json object \p j to a given Component \p k
 void from_json(const json& j, Component& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a Component
+const JsonSaxFields& json_sax_fields(const Component*);
+
+/// \brief Writes the given Component \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const Component& k);
+
 // \brief Writes the string representation of the given Component \p k to the given output stream \p os
 /// \returns an output stream with the Component written to
 std::ostream& operator<<(std::ostream& os, const Component& k);
@@ -327,6 +437,12 @@ void to_json(json& j, const Variable& k);
 /// \brief Conversion from a given json object \p j to a given Variable \p k
 void from_json(const json& j, Variable& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a Variable
+const JsonSaxFields& json_sax_fields(const Variable*);
+
+/// \brief Writes the given Variable \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const Variable& k);
+
 // \brief Writes the string representation of the given Variable \p k to the given output stream \p os
 /// \returns an output stream with the Variable written to
 std::ostream& operator<<(std::ostream& os, const Variable& k);
@@ -342,6 +458,12 @@ void to_json(json& j, const ComponentVariable& k);
 /// \brief Conversion from a given json object \p j to a given ComponentVariable \p k
 void from_json(const json& j, ComponentVariable& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ComponentVariable
+const JsonSaxFields& json_sax_fields(const ComponentVariable*);
+
+/// \brief Writes the given ComponentVariable \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ComponentVariable& k);
+
 // \brief Writes the string representation of the given ComponentVariable \p k to the given output stream \p os
 /// \returns an output stream with the ComponentVariable written to
 std::ostream& operator<<(std::ostream& os, const ComponentVariable& k);
@@ -358,6 +480,12 @@ void to_json(json& j, const GetVariableData& k);
 /// \brief Conversion from a given json object \p j to a given GetVariableData \p k
 void from_json(const json& j, GetVariableData& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetVariableData
+const JsonSaxFields& json_sax_fields(const GetVariableData*);
+
+/// \brief Writes the given GetVariableData \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetVariableData& k);
+
 // \brief Writes the string representation of the given GetVariableData \p k to the given output stream \p os
 /// \returns an output stream with the GetVariableData written to
 std::ostream& operator<<(std::ostream& os, const GetVariableData& k);
@@ -377,6 +505,12 @@ void to_json(json& j, const GetVariableResult& k);
 /// \brief Conversion from a given json object \p j to a given GetVariableResult \p k
 void from_json(const json& j, GetVariableResult& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetVariableResult
+const JsonSaxFields& json_sax_fields(const GetVariableResult*);
+
+/// \brief Writes the given GetVariableResult \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetVariableResult& k);
+
 // \brief Writes the string representation of the given GetVariableResult \p k to the given output stream \p os
 /// \returns an output stream with the GetVariableResult written to
 std::ostream& operator<<(std::ostream& os, const GetVariableResult& k);
@@ -394,6 +528,12 @@ void to_json(json& j, const SignedMeterValue& k);
 /// \brief Conversion from a given json object \p j to a given SignedMeterValue \p k
 void from_json(const json& j, SignedMeterValue& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SignedMeterValue
+const JsonSaxFields& json_sax_fields(const SignedMeterValue*);
+
+/// \brief Writes the given SignedMeterValue \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SignedMeterValue& k);
+
 // \brief Writes the string representation of the given SignedMeterValue \p k to the given output stream \p os
 /// \returns an output stream with the SignedMeterValue written to
 std::ostream& operator<<(std::ostream& os, const SignedMeterValue& k);
@@ -409,6 +549,12 @@ void to_json(json& j, const UnitOfMeasure& k);
 /// \brief Conversion from a given json object \p j to a given UnitOfMeasure \p k
 void from_json(const json& j, UnitOfMeasure& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a UnitOfMeasure
+const JsonSaxFields& json_sax_fields(const UnitOfMeasure*);
+
+/// \brief Writes the given UnitOfMeasure \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const UnitOfMeasure& k);
+
 // \brief Writes the string representation of the given UnitOfMeasure \p k to the given output stream \p os
 /// \returns an output stream with the UnitOfMeasure written to
 std::ostream& operator<<(std::ostream& os, const UnitOfMeasure& k);
@@ -429,6 +575,12 @@ void to_json(json& j, const SampledValue& k);
 /// \brief Conversion from a given json object \p j to a given SampledValue \p k
 void from_json(const json& j, SampledValue& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SampledValue
+const JsonSaxFields& json_sax_fields(const SampledValue*);
+
+/// \brief Writes the given SampledValue \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SampledValue& k);
+
 // \brief Writes the string representation of the given SampledValue \p k to the given output stream \p os
 /// \returns an output stream with the SampledValue written to
 std::ostream& operator<<(std::ostream& os, const SampledValue& k);
@@ -444,6 +596,12 @@ void to_json(json& j, const MeterValue& k);
 /// \brief Conversion from a given json object \p j to a given MeterValue \p k
 void from_json(const json& j, MeterValue& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a MeterValue
+const JsonSaxFields& json_sax_fields(const MeterValue*);
+
+/// \brief Writes the given MeterValue \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const MeterValue& k);
+
 // \brief Writes the string representation of the given MeterValue \p k to the given output stream \p os
 /// \returns an output stream with the MeterValue written to
 std::ostream& operator<<(std::ostream& os, const MeterValue& k);
@@ -459,6 +617,12 @@ void to_json(json& j, const RelativeTimeInterval& k);
 /// \brief Conversion from a given json object \p j to a given RelativeTimeInterval \p k
 void from_json(const json& j, RelativeTimeInterval& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a RelativeTimeInterval
+const JsonSaxFields& json_sax_fields(const RelativeTimeInterval*);
+
+/// \brief Writes the given RelativeTimeInterval \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const RelativeTimeInterval& k);
+
 // \brief Writes the string representation of the given RelativeTimeInterval \p k to the given output stream \p os
 /// \returns an output stream with the RelativeTimeInterval written to
 std::ostream& operator<<(std::ostream& os, const RelativeTimeInterval& k);
@@ -475,6 +639,12 @@ void to_json(json& j, const Cost& k);
 /// \brief Conversion from a given json object \p j to a given Cost \p k
 void from_json(const json& j, Cost& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a Cost
+const JsonSaxFields& json_sax_fields(const Cost*);
+
+/// \brief Writes the given Cost \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const Cost& k);
+
 // \brief Writes the string representation of the given Cost \p k to the given output stream \p os
 /// \returns an output stream with the Cost written to
 std::ostream& operator<<(std::ostream& os, const Cost& k);
@@ -490,6 +660,12 @@ void to_json(json& j, const ConsumptionCost& k);
 /// \brief Conversion from a given json object \p j to a given ConsumptionCost \p k
 void from_json(const json& j, ConsumptionCost& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ConsumptionCost
+const JsonSaxFields& json_sax_fields(const ConsumptionCost*);
+
+/// \brief Writes the given ConsumptionCost \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ConsumptionCost& k);
+
 // \brief Writes the string representation of the given ConsumptionCost \p k to the given output stream \p os
 /// \returns an output stream with the ConsumptionCost written to
 std::ostream& operator<<(std::ostream& os, const ConsumptionCost& k);
@@ -506,6 +682,12 @@ void to_json(json& j, const SalesTariffEntry& k);
 /// \brief Conversion from a given json object \p j to a given SalesTariffEntry \p k
 void from_json(const json& j, SalesTariffEntry& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SalesTariffEntry
+const JsonSaxFields& json_sax_fields(const SalesTariffEntry*);
+
+/// \brief Writes the given SalesTariffEntry \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SalesTariffEntry& k);
+
 // \brief Writes the string representation of the given SalesTariffEntry \p k to the given output stream \p os
 /// \returns an output stream with the SalesTariffEntry written to
 std::ostream& operator<<(std::ostream& os, const SalesTariffEntry& k);
@@ -523,6 +705,12 @@ void to_json(json& j, const SalesTariff& k);
 /// \brief Conversion from a given json object \p j to a given SalesTariff \p k
 void from_json(const json& j, SalesTariff& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SalesTariff
+const JsonSaxFields& json_sax_fields(const SalesTariff*);
+
+/// \brief Writes the given SalesTariff \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SalesTariff& k);
+
 // \brief Writes the string representation of the given SalesTariff \p k to the given output stream \p os
 /// \returns an output stream with the SalesTariff written to
 std::ostream& operator<<(std::ostream& os, const SalesTariff& k);
@@ -543,6 +731,12 @@ void to_json(json& j, const ChargingSchedule& k);
 /// \brief Conversion from a given json object \p j to a given ChargingSchedule \p k
 void from_json(const json& j, ChargingSchedule& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChargingSchedule
+const JsonSaxFields& json_sax_fields(const ChargingSchedule*);
+
+/// \brief Writes the given ChargingSchedule \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChargingSchedule& k);
+
 // \brief Writes the string representation of the given ChargingSchedule \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedule written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedule& k);
@@ -558,6 +752,12 @@ void to_json(json& j, const ChargingLimit& k);
 /// \brief Conversion from a given json object \p j to a given ChargingLimit \p k
 void from_json(const json& j, ChargingLimit& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChargingLimit
+const JsonSaxFields& json_sax_fields(const ChargingLimit*);
+
+/// \brief Writes the given ChargingLimit \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChargingLimit& k);
+
 // \brief Writes the string representation of the given ChargingLimit \p k to the given output stream \p os
 /// \returns an output stream with the ChargingLimit written to
 std::ostream& operator<<(std::ostream& os, const ChargingLimit& k);
@@ -579,6 +779,12 @@ void to_json(json& j, const MessageInfo& k);
 /// \brief Conversion from a given json object \p j to a given MessageInfo \p k
 void from_json(const json& j, MessageInfo& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a MessageInfo
+const JsonSaxFields& json_sax_fields(const MessageInfo*);
+
+/// \brief Writes the given MessageInfo \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const MessageInfo& k);
+
 // \brief Writes the string representation of the given MessageInfo \p k to the given output stream \p os
 /// \returns an output stream with the MessageInfo written to
 std::ostream& operator<<(std::ostream& os, const MessageInfo& k);
@@ -596,6 +802,12 @@ void to_json(json& j, const ACChargingParameters& k);
 /// \brief Conversion from a given json object \p j to a given ACChargingParameters \p k
 void from_json(const json& j, ACChargingParameters& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ACChargingParameters
+const JsonSaxFields& json_sax_fields(const ACChargingParameters*);
+
+/// \brief Writes the given ACChargingParameters \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ACChargingParameters& k);
+
 // \brief Writes the string representation of the given ACChargingParameters \p k to the given output stream \p os
 /// \returns an output stream with the ACChargingParameters written to
 std::ostream& operator<<(std::ostream& os, const ACChargingParameters& k);
@@ -617,6 +829,12 @@ void to_json(json& j, const DCChargingParameters& k);
 /// \brief Conversion from a given json object \p j to a given DCChargingParameters \p k
 void from_json(const json& j, DCChargingParameters& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a DCChargingParameters
+const JsonSaxFields& json_sax_fields(const DCChargingParameters*);
+
+/// \brief Writes the given DCChargingParameters \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const DCChargingParameters& k);
+
 // \brief Writes the string representation of the given DCChargingParameters \p k to the given output stream \p os
 /// \returns an output stream with the DCChargingParameters written to
 std::ostream& operator<<(std::ostream& os, const DCChargingParameters& k);
@@ -634,6 +852,12 @@ void to_json(json& j, const ChargingNeeds& k);
 /// \brief Conversion from a given json object \p j to a given ChargingNeeds \p k
 void from_json(const json& j, ChargingNeeds& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChargingNeeds
+const JsonSaxFields& json_sax_fields(const ChargingNeeds*);
+
+/// \brief Writes the given ChargingNeeds \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChargingNeeds& k);
+
 // \brief Writes the string representation of the given ChargingNeeds \p k to the given output stream \p os
 /// \returns an output stream with the ChargingNeeds written to
 std::ostream& operator<<(std::ostream& os, const ChargingNeeds& k);
@@ -660,6 +884,12 @@ void to_json(json& j, const EventData& k);
 /// \brief Conversion from a given json object \p j to a given EventData \p k
 void from_json(const json& j, EventData& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a EventData
+const JsonSaxFields& json_sax_fields(const EventData*);
+
+/// \brief Writes the given EventData \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const EventData& k);
+
 // \brief Writes the string representation of the given EventData \p k to the given output stream \p os
 /// \returns an output stream with the EventData written to
 std::ostream& operator<<(std::ostream& os, const EventData& k);
@@ -678,6 +908,12 @@ void to_json(json& j, const VariableMonitoring& k);
 /// \brief Conversion from a given json object \p j to a given VariableMonitoring \p k
 void from_json(const json& j, VariableMonitoring& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a VariableMonitoring
+const JsonSaxFields& json_sax_fields(const VariableMonitoring*);
+
+/// \brief Writes the given VariableMonitoring \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const VariableMonitoring& k);
+
 // \brief Writes the string representation of the given VariableMonitoring \p k to the given output stream \p os
 /// \returns an output stream with the VariableMonitoring written to
 std::ostream& operator<<(std::ostream& os, const VariableMonitoring& k);
@@ -694,6 +930,12 @@ void to_json(json& j, const MonitoringData& k);
 /// \brief Conversion from a given json object \p j to a given MonitoringData \p k
 void from_json(const json& j, MonitoringData& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a MonitoringData
+const JsonSaxFields& json_sax_fields(const MonitoringData*);
+
+/// \brief Writes the given MonitoringData \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const MonitoringData& k);
+
 // \brief Writes the string representation of the given MonitoringData \p k to the given output stream \p os
 /// \returns an output stream with the MonitoringData written to
 std::ostream& operator<<(std::ostream& os, const MonitoringData& k);
@@ -712,6 +954,12 @@ void to_json(json& j, const VariableAttribute& k);
 /// \brief Conversion from a given json object \p j to a given VariableAttribute \p k
 void from_json(const json& j, VariableAttribute& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a VariableAttribute
+const JsonSaxFields& json_sax_fields(const VariableAttribute*);
+
+/// \brief Writes the given VariableAttribute \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const VariableAttribute& k);
+
 // \brief Writes the string representation of the given VariableAttribute \p k to the given output stream \p os
 /// \returns an output stream with the VariableAttribute written to
 std::ostream& operator<<(std::ostream& os, const VariableAttribute& k);
@@ -731,6 +979,12 @@ void to_json(json& j, const VariableCharacteristics& k);
 /// \brief Conversion from a given json object \p j to a given VariableCharacteristics \p k
 void from_json(const json& j, VariableCharacteristics& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a VariableCharacteristics
+const JsonSaxFields& json_sax_fields(const VariableCharacteristics*);
+
+/// \brief Writes the given VariableCharacteristics \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const VariableCharacteristics& k);
+
 // \brief Writes the string representation of the given VariableCharacteristics \p k to the given output stream \p os
 /// \returns an output stream with the VariableCharacteristics written to
 std::ostream& operator<<(std::ostream& os, const VariableCharacteristics& k);
@@ -748,6 +1002,12 @@ void to_json(json& j, const ReportData& k);
 /// \brief Conversion from a given json object \p j to a given ReportData \p k
 void from_json(const json& j, ReportData& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ReportData
+const JsonSaxFields& json_sax_fields(const ReportData*);
+
+/// \brief Writes the given ReportData \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ReportData& k);
+
 // \brief Writes the string representation of the given ReportData \p k to the given output stream \p os
 /// \returns an output stream with the ReportData written to
 std::ostream& operator<<(std::ostream& os, const ReportData& k);
@@ -770,6 +1030,12 @@ void to_json(json& j, const ChargingProfile& k);
 /// \brief Conversion from a given json object \p j to a given ChargingProfile \p k
 void from_json(const json& j, ChargingProfile& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChargingProfile
+const JsonSaxFields& json_sax_fields(const ChargingProfile*);
+
+/// \brief Writes the given ChargingProfile \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChargingProfile& k);
+
 // \brief Writes the string representation of the given ChargingProfile \p k to the given output stream \p os
 /// \returns an output stream with the ChargingProfile written to
 std::ostream& operator<<(std::ostream& os, const ChargingProfile& k);
@@ -785,6 +1051,12 @@ void to_json(json& j, const AuthorizationData& k);
 /// \brief Conversion from a given json object \p j to a given AuthorizationData \p k
 void from_json(const json& j, AuthorizationData& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a AuthorizationData
+const JsonSaxFields& json_sax_fields(const AuthorizationData*);
+
+/// \brief Writes the given AuthorizationData \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const AuthorizationData& k);
+
 // \brief Writes the string representation of the given AuthorizationData \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizationData written to
 std::ostream& operator<<(std::ostream& os, const AuthorizationData& k);
@@ -805,6 +1077,12 @@ void to_json(json& j, const APN& k);
 /// \brief Conversion from a given json object \p j to a given APN \p k
 void from_json(const json& j, APN& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a APN
+const JsonSaxFields& json_sax_fields(const APN*);
+
+/// \brief Writes the given APN \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const APN& k);
+
 // \brief Writes the string representation of the given APN \p k to the given output stream \p os
 /// \returns an output stream with the APN written to
 std::ostream& operator<<(std::ostream& os, const APN& k);
@@ -824,6 +1102,12 @@ void to_json(json& j, const VPN& k);
 /// \brief Conversion from a given json object \p j to a given VPN \p k
 void from_json(const json& j, VPN& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a VPN
+const JsonSaxFields& json_sax_fields(const VPN*);
+
+/// \brief Writes the given VPN \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const VPN& k);
+
 // \brief Writes the string representation of the given VPN \p k to the given output stream \p os
 /// \returns an output stream with the VPN written to
 std::ostream& operator<<(std::ostream& os, const VPN& k);
@@ -845,6 +1129,12 @@ void to_json(json& j, const NetworkConnectionProfile& k);
 /// \brief Conversion from a given json object \p j to a given NetworkConnectionProfile \p k
 void from_json(const json& j, NetworkConnectionProfile& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NetworkConnectionProfile
+const JsonSaxFields& json_sax_fields(const NetworkConnectionProfile*);
+
+/// \brief Writes the given NetworkConnectionProfile \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NetworkConnectionProfile& k);
+
 // \brief Writes the string representation of the given NetworkConnectionProfile \p k to the given output stream \p os
 /// \returns an output stream with the NetworkConnectionProfile written to
 std::ostream& operator<<(std::ostream& os, const NetworkConnectionProfile& k);
@@ -865,6 +1155,12 @@ void to_json(json& j, const SetMonitoringData& k);
 /// \brief Conversion from a given json object \p j to a given SetMonitoringData \p k
 void from_json(const json& j, SetMonitoringData& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetMonitoringData
+const JsonSaxFields& json_sax_fields(const SetMonitoringData*);
+
+/// \brief Writes the given SetMonitoringData \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetMonitoringData& k);
+
 // \brief Writes the string representation of the given SetMonitoringData \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringData written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringData& k);
@@ -885,6 +1181,12 @@ void to_json(json& j, const SetMonitoringResult& k);
 /// \brief Conversion from a given json object \p j to a given SetMonitoringResult \p k
 void from_json(const json& j, SetMonitoringResult& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetMonitoringResult
+const JsonSaxFields& json_sax_fields(const SetMonitoringResult*);
+
+/// \brief Writes the given SetMonitoringResult \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetMonitoringResult& k);
+
 // \brief Writes the string representation of the given SetMonitoringResult \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringResult written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringResult& k);
@@ -902,6 +1204,12 @@ void to_json(json& j, const SetVariableData& k);
 /// \brief Conversion from a given json object \p j to a given SetVariableData \p k
 void from_json(const json& j, SetVariableData& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetVariableData
+const JsonSaxFields& json_sax_fields(const SetVariableData*);
+
+/// \brief Writes the given SetVariableData \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetVariableData& k);
+
 // \brief Writes the string representation of the given SetVariableData \p k to the given output stream \p os
 /// \returns an output stream with the SetVariableData written to
 std::ostream& operator<<(std::ostream& os, const SetVariableData& k);
@@ -920,6 +1228,12 @@ void to_json(json& j, const SetVariableResult& k);
 /// \brief Conversion from a given json object \p j to a given SetVariableResult \p k
 void from_json(const json& j, SetVariableResult& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetVariableResult
+const JsonSaxFields& json_sax_fields(const SetVariableResult*);
+
+/// \brief Writes the given SetVariableResult \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetVariableResult& k);
+
 // \brief Writes the string representation of the given SetVariableResult \p k to the given output stream \p os
 /// \returns an output stream with the SetVariableResult written to
 std::ostream& operator<<(std::ostream& os, const SetVariableResult& k);
@@ -938,6 +1252,12 @@ void to_json(json& j, const Transaction& k);
 /// \brief Conversion from a given json object \p j to a given Transaction \p k
 void from_json(const json& j, Transaction& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a Transaction
+const JsonSaxFields& json_sax_fields(const Transaction*);
+
+/// \brief Writes the given Transaction \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const Transaction& k);
+
 // \brief Writes the string representation of the given Transaction \p k to the given output stream \p os
 /// \returns an output stream with the Transaction written to
 std::ostream& operator<<(std::ostream& os, const Transaction& k);
@@ -956,6 +1276,12 @@ void to_json(json& j, const Firmware& k);
 /// \brief Conversion from a given json object \p j to a given Firmware \p k
 void from_json(const json& j, Firmware& k);
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a Firmware
+const JsonSaxFields& json_sax_fields(const Firmware*);
+
+/// \brief Writes the given Firmware \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const Firmware& k);
+
 // \brief Writes the string representation of the given Firmware \p k to the given output stream \p os
 /// \returns an output stream with the Firmware written to
 std::ostream& operator<<(std::ostream& os, const Firmware& k);
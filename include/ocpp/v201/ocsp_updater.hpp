@@ -5,9 +5,13 @@
 #define OCPP_OCSP_UPDATER_HPP
 
 #include <chrono>
+#include <future>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <stdexcept>
-#include <thread>
+
+#include <everest/timer.hpp>
 
 #include <ocpp/common/call_types.hpp>
 #include <ocpp/common/evse_security.hpp>
@@ -36,6 +40,11 @@ private:
 
 typedef std::function<GetCertificateStatusResponse(GetCertificateStatusRequest)> cert_status_func;
 
+/// \brief Default time between two successful OCSP cache updates
+constexpr std::chrono::seconds DEFAULT_OCSP_CACHE_UPDATE_INTERVAL = std::chrono::hours(167);
+/// \brief Default time after which a failed OCSP cache update is retried
+constexpr std::chrono::seconds DEFAULT_OCSP_CACHE_UPDATE_RETRY_INTERVAL = std::chrono::hours(24);
+
 // Forward declarations to avoid include loops
 class ChargePoint;
 class UnexpectedMessageTypeFromCSMS;
@@ -43,32 +52,38 @@ class UnexpectedMessageTypeFromCSMS;
 class OcspUpdater {
 public:
     OcspUpdater() = delete;
+    /// \brief Creates an OcspUpdater that schedules its updates on \p io_context, e.g. the io_service of the charging
+    /// station, or on a thread of its own if \p io_context is nullptr
     OcspUpdater(std::shared_ptr<EvseSecurity> evse_security, cert_status_func get_cert_status_from_csms,
-                std::chrono::seconds ocsp_cache_update_interval = std::chrono::hours(167),
-                std::chrono::seconds ocsp_cache_update_retry_interval = std::chrono::hours(24));
+                std::chrono::seconds ocsp_cache_update_interval = DEFAULT_OCSP_CACHE_UPDATE_INTERVAL,
+                std::chrono::seconds ocsp_cache_update_retry_interval = DEFAULT_OCSP_CACHE_UPDATE_RETRY_INTERVAL,
+                boost::asio::io_context* io_context = nullptr);
+    ~OcspUpdater();
 
     void start();
     void stop();
 
-    // Wake up the updater thread and tell it to update
+    // Schedule an update right away
     // Used e.g. when a new charging station cert was just installed
     void trigger_ocsp_cache_update();
 
 private:
-    // Updater thread responsible for executing the updates
-    std::thread updater_thread;
-
-    // This mutex guards access to everything below it, INCLUDING explicit_update_trigger
-    // - The updater thread always holds the lock, except when it's waiting on explicit_update_trigger
-    // - The lib needs to hold the lock to notify the explicit_update_trigger (this guarantees it wakes up the worker)
+    // Fires when the next update is due
+    std::unique_ptr<Everest::SteadyTimer> update_timer;
+    // Executes a running update, guarded by update_ocsp_cache_lock. get_cert_status_from_csms blocks until the CSMS
+    // responded, which requires the timers of the message queue to run, so the update must not block the executor of
+    // update_timer
+    std::future<void> update_task;
+
+    // This mutex guards access to everything below it
     std::mutex update_ocsp_cache_lock;
-    // Condition variable used to wake up the updater thread
-    std::condition_variable explicit_update_trigger;
-    // Deadline by which libocpp must automatically trigger an OCSP cache update
-    std::chrono::time_point<std::chrono::steady_clock> update_deadline;
     std::shared_ptr<EvseSecurity> evse_security;
-    // Set this when starting and stopping the updater thread
+    // Set this when starting and stopping the updater
     bool running;
+    // Set while update_task executes an update
+    bool update_running;
+    // Set when an update was triggered while another update was running
+    bool update_triggered;
 
     // This function captures a pointer to a ChargePoint, which has to remain valid.
     // The OcspUpdater class is part of the ChargePoint, and thus it cannot outlive the ChargePoint.
@@ -78,9 +93,13 @@ private:
     const std::chrono::seconds ocsp_cache_update_interval;
     const std::chrono::seconds ocsp_cache_update_retry_interval;
 
-    // Running loop of the OCSP updater thread
-    void updater_thread_loop();
-    // Helper method, only called within updater_thread_loop().
+    // Arms update_timer, must be called with update_ocsp_cache_lock held
+    void schedule_update(std::chrono::seconds delay);
+    // Called by update_timer, starts update_task unless an update is running already
+    void start_update();
+    // Runs in update_task: performs the update and schedules the next one
+    void run_update();
+    // Helper method, only called within run_update().
     void execute_ocsp_update();
 };
 
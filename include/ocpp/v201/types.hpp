@@ -5,6 +5,7 @@
 
 #include <ostream>
 #include <string>
+#include <string_view>
 
 namespace ocpp {
 namespace v201 {
@@ -147,9 +148,9 @@ namespace conversions {
 /// \returns a string representation of the MessageType
 std::string messagetype_to_string(MessageType m);
 
-/// \brief Converts the given std::string \p s to MessageType
+/// \brief Converts the given std::string_view \p s to MessageType
 /// \returns a MessageType from a string representation
-MessageType string_to_messagetype(const std::string& s);
+MessageType string_to_messagetype(std::string_view s);
 
 } // namespace conversions
 
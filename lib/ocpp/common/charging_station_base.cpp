@@ -1,33 +1,82 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
 
+#include <boost/asio/post.hpp>
 #include <boost/make_shared.hpp>
 #include <ocpp/common/charging_station_base.hpp>
 
 namespace ocpp {
 ChargingStationBase::ChargingStationBase(const std::shared_ptr<EvseSecurity> evse_security,
-                                         const std::optional<SecurityConfiguration> security_configuration) :
+                                         const std::optional<SecurityConfiguration> security_configuration,
+                                         std::shared_ptr<ChargingStationHost> host) :
+    host(host),
+    io_service(host != nullptr ? host->acquire_io_service() : this->local_io_service),
     uuid_generator(boost::uuids::random_generator()) {
 
     if (evse_security != nullptr) {
         this->evse_security = evse_security;
     } else {
         if (!security_configuration.has_value()) {
+            if (this->host != nullptr) {
+                this->host->release_io_service(this->io_service);
+            }
             throw std::runtime_error("No implementation of EvseSecurity interface and no SecurityConfiguration "
                                      "provided to chargepoint constructor. One of options must be set");
         }
         this->evse_security = std::make_shared<EvseSecurityImpl>(security_configuration.value());
     }
-    this->work = boost::make_shared<boost::asio::io_service::work>(this->io_service);
-    this->io_service_thread = std::thread([this]() { this->io_service.run(); });
+
+    if (this->host == nullptr) {
+        this->work = boost::make_shared<boost::asio::io_service::work>(this->local_io_service);
+        this->io_service_thread = std::thread([this]() { this->local_io_service.run(); });
+    }
 }
 
 ChargingStationBase::~ChargingStationBase() {
+    if (this->io_service_released.has_value()) {
+        this->io_service_released->set_value();
+    }
+    if (this->host != nullptr) {
+        // The executor keeps running for the other charging stations of the host
+        this->host->release_io_service(this->io_service);
+        return;
+    }
     work->get_io_context().stop();
-    io_service.stop();
+    local_io_service.stop();
     io_service_thread.join();
 }
 
+void ChargingStationBase::hold_io_service(const std::function<void()>& stop_timers) {
+    if (this->io_service_released.has_value()) {
+        return;
+    }
+    if (this->io_service.get_executor().running_in_this_thread()) {
+        // no other handler can run while the charging station is destroyed by a handler of its own io_service
+        stop_timers();
+        return;
+    }
+    auto held = std::make_shared<std::promise<void>>();
+    auto held_future = held->get_future();
+    this->io_service_released.emplace();
+    boost::asio::post(this->io_service, [held, released = this->io_service_released->get_future().share()]() {
+        // all handlers that have been queued before have been executed now
+        held->set_value();
+        released.wait();
+    });
+    held_future.wait();
+
+    stop_timers();
+    // The executor thread is blocked, so the handlers queued behind the hold run on this thread one after another.
+    // The timers are stopped after each of them, before an expired timer that it started can be queued. Handlers
+    // queued after the marker, e.g. of timers of other charging stations, are left to the executor
+    bool drained = false;
+    boost::asio::post(this->io_service, [&drained]() { drained = true; });
+    while (!drained) {
+        this->io_service.run_one();
+        stop_timers();
+    }
+}
+
 std::string ChargingStationBase::uuid() {
     std::stringstream s;
     s << this->uuid_generator();
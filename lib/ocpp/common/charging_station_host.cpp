@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <algorithm>
+
+#include <everest/logging.hpp>
+#include <ocpp/common/charging_station_host.hpp>
+
+namespace ocpp {
+
+ChargingStationHost::ChargingStationHost(const size_t number_of_executors) {
+    const auto executor_count = std::max<size_t>(number_of_executors, 1);
+    for (size_t i = 0; i < executor_count; i++) {
+        auto executor = std::make_unique<Executor>();
+        executor->work = std::make_unique<boost::asio::io_service::work>(executor->io_service);
+        auto& io_service = executor->io_service;
+        executor->thread = std::thread([&io_service]() { io_service.run(); });
+        this->executors.push_back(std::move(executor));
+    }
+}
+
+ChargingStationHost::~ChargingStationHost() {
+    for (auto& executor : this->executors) {
+        if (executor->stations > 0) {
+            EVLOG_warning << "Charging station host is destroyed while " << executor->stations
+                          << " charging station(s) are still bound to it";
+        }
+        executor->work.reset();
+        executor->io_service.stop();
+    }
+    for (auto& executor : this->executors) {
+        if (executor->thread.joinable()) {
+            executor->thread.join();
+        }
+    }
+}
+
+boost::asio::io_service& ChargingStationHost::acquire_io_service() {
+    std::lock_guard<std::mutex> lk(this->executors_mutex);
+    auto& executor = *std::min_element(this->executors.begin(), this->executors.end(),
+                                       [](const auto& a, const auto& b) { return a->stations < b->stations; });
+    executor->stations += 1;
+    return executor->io_service;
+}
+
+void ChargingStationHost::release_io_service(boost::asio::io_service& io_service) {
+    std::lock_guard<std::mutex> lk(this->executors_mutex);
+    const auto it = std::find_if(this->executors.begin(), this->executors.end(),
+                                 [&io_service](const auto& executor) { return &executor->io_service == &io_service; });
+    if (it == this->executors.end() or (*it)->stations == 0) {
+        EVLOG_error << "Charging station is released from an executor it was not bound to";
+        return;
+    }
+    (*it)->stations -= 1;
+}
+
+size_t ChargingStationHost::get_number_of_executors() const {
+    return this->executors.size();
+}
+
+size_t ChargingStationHost::get_number_of_stations() {
+    std::lock_guard<std::mutex> lk(this->executors_mutex);
+    size_t stations = 0;
+    for (const auto& executor : this->executors) {
+        stations += executor->stations;
+    }
+    return stations;
+}
+
+} // namespace ocpp
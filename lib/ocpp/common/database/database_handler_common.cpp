@@ -3,17 +3,46 @@
 
 #include <ocpp/common/database/database_handler_common.hpp>
 
+#include <algorithm>
+#include <set>
+
 #include <everest/logging.hpp>
+#include <ocpp/common/aligned_timer.hpp>
 #include <ocpp/common/database/database_schema_updater.hpp>
 
 namespace ocpp::common {
 
+namespace {
+/// \brief Rolls back the given \p transaction after a failed statement. SQLite may already have rolled back the
+/// transaction itself, e.g. on SQLITE_FULL, so a failing ROLLBACK is only logged instead of throwing from the
+/// destructor of the transaction
+void rollback_transaction(DatabaseTransactionInterface& transaction) {
+    try {
+        transaction.rollback();
+    } catch (const std::exception& e) {
+        EVLOG_warning << "Could not roll back message queue operations: " << e.what();
+    }
+}
+} // namespace
+
 DatabaseHandlerCommon::DatabaseHandlerCommon(std::unique_ptr<DatabaseConnectionInterface> database,
                                              const fs::path& sql_migration_files_path,
                                              uint32_t target_schema_version) noexcept :
     database(std::move(database)),
     sql_migration_files_path(sql_migration_files_path),
-    target_schema_version(target_schema_version) {
+    target_schema_version(target_schema_version),
+    message_queue_max_batch_size(DEFAULT_MESSAGE_QUEUE_MAX_BATCH_SIZE),
+    message_queue_max_flush_latency(DEFAULT_MESSAGE_QUEUE_MAX_FLUSH_LATENCY),
+    message_queue_flush_io_context(nullptr) {
+}
+
+DatabaseHandlerCommon::~DatabaseHandlerCommon() {
+    try {
+        this->stop_message_queue_flush_timer();
+        this->flush_message_queue_operations();
+    } catch (const std::exception& e) {
+        EVLOG_error << "Could not commit buffered message queue operations: " << e.what();
+    }
 }
 
 void DatabaseHandlerCommon::open_connection() {
@@ -31,10 +60,136 @@ void DatabaseHandlerCommon::open_connection() {
 }
 
 void DatabaseHandlerCommon::close_connection() {
+    this->stop_message_queue_flush_timer();
+    this->flush_message_queue_operations();
     this->database->close_connection();
 }
 
+void DatabaseHandlerCommon::set_message_queue_write_behind(std::size_t max_batch_size,
+                                                           std::chrono::milliseconds max_flush_latency) {
+    std::lock_guard<std::mutex> lk(this->message_queue_operations_mutex);
+    this->message_queue_max_batch_size = std::max<std::size_t>(max_batch_size, 1);
+    this->message_queue_max_flush_latency = max_flush_latency;
+    if (this->message_queue_operations.size() >= this->message_queue_max_batch_size) {
+        this->try_flush_message_queue_operations_locked();
+    } else if (!this->message_queue_operations.empty()) {
+        this->arm_message_queue_flush_timer();
+    }
+}
+
+void DatabaseHandlerCommon::set_message_queue_flush_io_context(boost::asio::io_context* io_context) {
+    std::lock_guard<std::mutex> lk(this->message_queue_operations_mutex);
+    if (this->message_queue_flush_timer != nullptr) {
+        EVLOG_warning << "Message queue flush timer is already running, keeping it on its current executor";
+        return;
+    }
+    this->message_queue_flush_io_context = io_context;
+}
+
+void DatabaseHandlerCommon::flush_message_queue_operations() {
+    std::lock_guard<std::mutex> lk(this->message_queue_operations_mutex);
+    this->flush_message_queue_operations_locked();
+}
+
+void DatabaseHandlerCommon::execute_message_queue_operation(const MessageQueueOperation& operation) {
+    if (operation.insert) {
+        this->insert_message_queue_message_internal(operation.message, operation.queue_type);
+    } else {
+        this->remove_message_queue_message_internal(operation.message.unique_id, operation.queue_type);
+    }
+}
+
+void DatabaseHandlerCommon::execute_message_queue_operations() {
+    for (auto operation = this->message_queue_operations.begin(); operation != this->message_queue_operations.end();
+         operation++) {
+        try {
+            this->execute_message_queue_operation(*operation);
+        } catch (const std::exception& e) {
+            operation->failed_attempts++;
+            if (operation->failed_attempts < MESSAGE_QUEUE_OPERATION_MAX_ATTEMPTS) {
+                EVLOG_warning << "Could not " << (operation->insert ? "insert" : "remove") << " message with id "
+                              << operation->message.unique_id << " in message queue table: " << e.what();
+            } else {
+                EVLOG_error << "Could not " << (operation->insert ? "insert" : "remove") << " message with id "
+                            << operation->message.unique_id << " in message queue table after "
+                            << operation->failed_attempts << " attempts, dropping the operation: " << e.what();
+                this->message_queue_operations.erase(operation);
+            }
+            throw;
+        }
+    }
+}
+
+void DatabaseHandlerCommon::flush_message_queue_operations_locked() {
+    if (this->message_queue_operations.empty()) {
+        return;
+    }
+    // the transaction is rolled back if an operation fails, so all operations are kept for the next attempt
+    auto transaction = this->database->begin_transaction();
+    try {
+        this->execute_message_queue_operations();
+    } catch (...) {
+        rollback_transaction(*transaction);
+        throw;
+    }
+    transaction->commit();
+    this->message_queue_operations.clear();
+}
+
+void DatabaseHandlerCommon::try_flush_message_queue_operations_locked() {
+    try {
+        this->flush_message_queue_operations_locked();
+    } catch (const std::exception& e) {
+        EVLOG_error << "Could not commit buffered message queue operations, retrying later: " << e.what();
+        if (!this->message_queue_operations.empty()) {
+            this->oldest_message_queue_operation = std::chrono::steady_clock::now();
+            this->arm_message_queue_flush_timer();
+        }
+    }
+}
+
+void DatabaseHandlerCommon::buffer_message_queue_operation(MessageQueueOperation&& operation) {
+    if (this->message_queue_operations.empty()) {
+        this->oldest_message_queue_operation = std::chrono::steady_clock::now();
+    }
+    this->message_queue_operations.push_back(std::move(operation));
+
+    if (this->message_queue_operations.size() >= this->message_queue_max_batch_size) {
+        this->try_flush_message_queue_operations_locked();
+        return;
+    }
+
+    if (this->message_queue_operations.size() == 1) {
+        this->arm_message_queue_flush_timer();
+    }
+}
+
+void DatabaseHandlerCommon::arm_message_queue_flush_timer() {
+    if (this->message_queue_flush_timer == nullptr) {
+        this->message_queue_flush_timer = make_steady_timer(this->message_queue_flush_io_context);
+    }
+    const auto deadline = this->oldest_message_queue_operation + this->message_queue_max_flush_latency;
+    const auto now = std::chrono::steady_clock::now();
+    this->message_queue_flush_timer->timeout([this]() { this->flush_message_queue_operations_on_timeout(); },
+                                             deadline > now ? deadline - now
+                                                            : std::chrono::steady_clock::duration::zero());
+}
+
+void DatabaseHandlerCommon::flush_message_queue_operations_on_timeout() {
+    std::lock_guard<std::mutex> lk(this->message_queue_operations_mutex);
+    this->try_flush_message_queue_operations_locked();
+}
+
+void DatabaseHandlerCommon::stop_message_queue_flush_timer() {
+    std::lock_guard<std::mutex> lk(this->message_queue_operations_mutex);
+    if (this->message_queue_flush_timer != nullptr) {
+        this->message_queue_flush_timer->stop();
+    }
+}
+
 std::vector<DBTransactionMessage> DatabaseHandlerCommon::get_message_queue_messages(const QueueType queue_type) {
+    this->flush_message_queue_operations();
+
     std::vector<DBTransactionMessage> messages;
 
     const std::string table_name = queue_type == QueueType::Normal ? "NORMAL_QUEUE" : "TRANSACTION_QUEUE";
@@ -78,8 +233,83 @@ std::vector<DBTransactionMessage> DatabaseHandlerCommon::get_message_queue_messa
     return messages;
 }
 
+int64_t DatabaseHandlerCommon::get_message_queue_end(const QueueType queue_type) {
+    this->flush_message_queue_operations();
+
+    const std::string table_name = queue_type == QueueType::Normal ? "NORMAL_QUEUE" : "TRANSACTION_QUEUE";
+    auto stmt = this->database->new_statement("SELECT IFNULL(MAX(ROWID), 0) FROM " + table_name);
+
+    if (stmt->step() != SQLITE_ROW) {
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+    return stmt->column_int64(0);
+}
+
+std::vector<DBTransactionMessage>
+DatabaseHandlerCommon::get_message_queue_messages_page(const QueueType queue_type, const int64_t after,
+                                                       const int64_t until, const std::size_t limit,
+                                                       const std::optional<std::string>& message_type) {
+    this->flush_message_queue_operations();
+
+    std::vector<DBTransactionMessage> messages;
+
+    const std::string table_name = queue_type == QueueType::Normal ? "NORMAL_QUEUE" : "TRANSACTION_QUEUE";
+
+    std::string sql = "SELECT ROWID, UNIQUE_ID, MESSAGE, MESSAGE_TYPE, MESSAGE_ATTEMPTS, MESSAGE_TIMESTAMP FROM " +
+                      table_name + " WHERE ROWID > @after AND ROWID <= @until";
+    if (message_type.has_value()) {
+        sql += " AND MESSAGE_TYPE = @message_type";
+    }
+    sql += " ORDER BY ROWID LIMIT @limit";
+
+    auto stmt = this->database->new_statement(sql);
+    stmt->bind_int64("@after", after);
+    stmt->bind_int64("@until", until);
+    stmt->bind_int64("@limit", static_cast<int64_t>(limit));
+    if (message_type.has_value()) {
+        stmt->bind_text("@message_type", message_type.value(), SQLiteString::Transient);
+    }
+
+    int status;
+    while ((status = stmt->step()) == SQLITE_ROW) {
+        DBTransactionMessage message;
+        message.json_message = nullptr;
+        message.position = stmt->column_int64(0);
+        message.unique_id = stmt->column_text(1);
+        message.serialized_message = std::make_shared<const std::string>(stmt->column_text(2));
+        message.message_type = stmt->column_text(3);
+        message.message_attempts = stmt->column_int(4);
+        try {
+            message.timestamp = DateTime(stmt->column_text(5));
+        } catch (const std::exception& e) {
+            // the message is still returned (and sent immediately) so that the position of the page is not lost
+            EVLOG_error << "can not get timestamp of queued message from database: "
+                        << "(" << e.what() << ")";
+        }
+        messages.push_back(std::move(message));
+    }
+
+    if (status != SQLITE_DONE) {
+        EVLOG_error << "Could not get queued messages from database";
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+
+    return messages;
+}
+
 void DatabaseHandlerCommon::insert_message_queue_message(const DBTransactionMessage& db_message,
                                                          const QueueType queue_type) {
+    std::lock_guard<std::mutex> lk(this->message_queue_operations_mutex);
+    if (this->message_queue_max_batch_size <= 1) {
+        this->insert_message_queue_message_internal(db_message, queue_type);
+        return;
+    }
+
+    this->buffer_message_queue_operation({true, queue_type, db_message});
+}
+
+void DatabaseHandlerCommon::insert_message_queue_message_internal(const DBTransactionMessage& db_message,
+                                                                  const QueueType queue_type) {
     const std::string table_name = queue_type == QueueType::Normal ? "NORMAL_QUEUE" : "TRANSACTION_QUEUE";
 
     const std::string sql = "INSERT INTO " + table_name +
@@ -88,9 +318,13 @@ void DatabaseHandlerCommon::insert_message_queue_message(const DBTransactionMess
 
     auto stmt = this->database->new_statement(sql);
 
-    const std::string message = db_message.json_message.dump();
+    // reuse the serialization of the message queue if available
+    std::string message;
+    if (db_message.serialized_message == nullptr) {
+        message = db_message.json_message.dump();
+    }
     stmt->bind_text("@unique_id", db_message.unique_id);
-    stmt->bind_text("@message", message);
+    stmt->bind_text("@message", db_message.serialized_message != nullptr ? *db_message.serialized_message : message);
     stmt->bind_text("@message_type", db_message.message_type);
     stmt->bind_int("@message_attempts", db_message.message_attempts);
     stmt->bind_text("@message_timestamp", db_message.timestamp.to_rfc3339(), SQLiteString::Transient);
@@ -101,6 +335,30 @@ void DatabaseHandlerCommon::insert_message_queue_message(const DBTransactionMess
 }
 
 void DatabaseHandlerCommon::remove_message_queue_message(const std::string& unique_id, const QueueType queue_type) {
+    std::lock_guard<std::mutex> lk(this->message_queue_operations_mutex);
+    if (this->message_queue_max_batch_size <= 1) {
+        this->remove_message_queue_message_internal(unique_id, queue_type);
+        return;
+    }
+
+    // an insert that has not been committed yet does not need to reach the database at all
+    const auto pending_insert = std::find_if(
+        this->message_queue_operations.begin(), this->message_queue_operations.end(), [&](const auto& operation) {
+            return operation.insert and operation.queue_type == queue_type and
+                   operation.message.unique_id == unique_id;
+        });
+    if (pending_insert != this->message_queue_operations.end()) {
+        this->message_queue_operations.erase(pending_insert);
+        return;
+    }
+
+    DBTransactionMessage message;
+    message.unique_id = unique_id;
+    this->buffer_message_queue_operation({false, queue_type, std::move(message)});
+}
+
+void DatabaseHandlerCommon::remove_message_queue_message_internal(const std::string& unique_id,
+                                                                  const QueueType queue_type) {
     const std::string table_name = queue_type == QueueType::Normal ? "NORMAL_QUEUE" : "TRANSACTION_QUEUE";
     std::string sql = "DELETE FROM " + table_name + " WHERE UNIQUE_ID = @unique_id";
 
@@ -113,7 +371,72 @@ void DatabaseHandlerCommon::remove_message_queue_message(const std::string& uniq
     }
 }
 
+void DatabaseHandlerCommon::remove_message_queue_messages(const std::vector<std::string>& unique_ids,
+                                                          const QueueType queue_type) {
+    // keep the number of host parameters of a statement well below SQLITE_MAX_VARIABLE_NUMBER
+    constexpr std::size_t max_ids_per_statement = 500;
+
+    std::lock_guard<std::mutex> lk(this->message_queue_operations_mutex);
+
+    // inserts that have not been committed yet do not need to reach the database at all
+    std::set<std::string> ids(unique_ids.begin(), unique_ids.end());
+    this->message_queue_operations.erase(
+        std::remove_if(this->message_queue_operations.begin(), this->message_queue_operations.end(),
+                       [&](const auto& operation) {
+                           return operation.insert and operation.queue_type == queue_type and
+                                  ids.erase(operation.message.unique_id) > 0;
+                       }),
+        this->message_queue_operations.end());
+    if (ids.empty()) {
+        return;
+    }
+
+    const std::string table_name = queue_type == QueueType::Normal ? "NORMAL_QUEUE" : "TRANSACTION_QUEUE";
+    auto transaction = this->database->begin_transaction();
+    try {
+        this->execute_message_queue_operations();
+    } catch (...) {
+        rollback_transaction(*transaction);
+        throw;
+    }
+
+    auto it = ids.begin();
+    while (it != ids.end()) {
+        std::vector<std::string> chunk;
+        while (it != ids.end() and chunk.size() < max_ids_per_statement) {
+            chunk.push_back(*it++);
+        }
+
+        std::string sql = "DELETE FROM " + table_name + " WHERE UNIQUE_ID IN (";
+        for (std::size_t i = 0; i < chunk.size(); i++) {
+            sql += (i == 0 ? "?" : ", ?");
+        }
+        sql += ")";
+
+        auto stmt = this->database->new_statement(sql);
+        for (std::size_t i = 0; i < chunk.size(); i++) {
+            stmt->bind_text(static_cast<int>(i + 1), chunk.at(i), SQLiteString::Transient);
+        }
+
+        if (stmt->step() != SQLITE_DONE) {
+            // the buffered operations are kept for the next attempt
+            const std::string error_message = this->database->get_error_message();
+            rollback_transaction(*transaction);
+            throw QueryExecutionException(error_message);
+        }
+    }
+    transaction->commit();
+    this->message_queue_operations.clear();
+}
+
 void DatabaseHandlerCommon::clear_message_queue(const QueueType queue_type) {
+    {
+        std::lock_guard<std::mutex> lk(this->message_queue_operations_mutex);
+        this->message_queue_operations.erase(
+            std::remove_if(this->message_queue_operations.begin(), this->message_queue_operations.end(),
+                           [queue_type](const auto& operation) { return operation.queue_type == queue_type; }),
+            this->message_queue_operations.end());
+    }
     const std::string table_name = queue_type == QueueType::Normal ? "NORMAL_QUEUE" : "TRANSACTION_QUEUE";
     const auto retval = this->database->clear_table(table_name);
     if (retval == false) {
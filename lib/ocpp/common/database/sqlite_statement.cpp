@@ -61,6 +61,18 @@ int SQLiteStatement::bind_int(const std::string& param, const int val) {
     return bind_int(index, val);
 }
 
+int SQLiteStatement::bind_int64(const int idx, const int64_t val) {
+    return sqlite3_bind_int64(this->stmt, idx, val);
+}
+
+int SQLiteStatement::bind_int64(const std::string& param, const int64_t val) {
+    int index = sqlite3_bind_parameter_index(this->stmt, param.c_str());
+    if (index <= 0) {
+        throw std::out_of_range("Parameter not found in SQL query");
+    }
+    return bind_int64(index, val);
+}
+
 int SQLiteStatement::bind_datetime(const int idx, const ocpp::DateTime val) {
     return sqlite3_bind_int64(
         this->stmt, idx,
@@ -124,6 +136,10 @@ int SQLiteStatement::column_int(const int idx) {
     return sqlite3_column_int(this->stmt, idx);
 }
 
+int64_t SQLiteStatement::column_int64(const int idx) {
+    return sqlite3_column_int64(this->stmt, idx);
+}
+
 ocpp::DateTime SQLiteStatement::column_datetime(const int idx) {
     int64_t time = sqlite3_column_int64(this->stmt, idx);
     return DateTime(date::utc_clock::time_point(std::chrono::milliseconds(time)));
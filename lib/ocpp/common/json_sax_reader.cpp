@@ -0,0 +1,315 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <algorithm>
+
+#include <ocpp/common/json_sax_reader.hpp>
+
+namespace ocpp {
+
+namespace {
+
+void read_json_primitive(void* value, JsonSaxPrimitive& primitive) {
+    auto& j = *static_cast<json*>(value);
+    switch (primitive.type) {
+    case json::value_t::boolean:
+        j = primitive.boolean;
+        break;
+    case json::value_t::number_integer:
+        j = primitive.number_integer;
+        break;
+    case json::value_t::number_unsigned:
+        j = primitive.number_unsigned;
+        break;
+    case json::value_t::number_float:
+        j = primitive.number_float;
+        break;
+    case json::value_t::string:
+        j = std::move(*primitive.string);
+        break;
+    default:
+        j = nullptr;
+        break;
+    }
+}
+
+JsonSaxTarget json_array_element(void* value, std::size_t) {
+    auto& j = *static_cast<json*>(value);
+    j.push_back(nullptr);
+    return {json_sax_json_handler(), &j.back()};
+}
+
+void reset_json(void* value) {
+    *static_cast<json*>(value) = nullptr;
+}
+
+/// \brief The envelope of a received message that is read by parse_message
+struct MessageEnvelope {
+    json message = json::array();
+    const std::function<bool(const std::string& action)>* skip_payload;
+    bool payload_skipped = false;
+};
+
+JsonSaxTarget message_envelope_element(void* value, std::size_t index) {
+    auto& envelope = *static_cast<MessageEnvelope*>(value);
+    auto& message = envelope.message;
+    if (index == CALL_PAYLOAD and message.at(MESSAGE_TYPE_ID) == MessageTypeId::CALL and
+        message.at(CALL_ACTION).is_string() and
+        (*envelope.skip_payload)(message.at(CALL_ACTION).get_ref<const std::string&>())) {
+        envelope.payload_skipped = true;
+        // keeps the position of the elements after the payload
+        message.push_back(nullptr);
+        return {};
+    }
+    message.push_back(nullptr);
+    return {json_sax_json_handler(), &message.back()};
+}
+
+/// \brief Throws the json::exception from_json throws if a json value of type \p type is read into the struct or CALL
+/// of \p handler. Returns if the value can be skipped because it has no required parts
+void check_not_container(const JsonSaxValueHandler& handler, json::value_t type) {
+    bool required = handler.required_elements > 0;
+    if (handler.kind == JsonSaxValueHandler::Kind::Object) {
+        const auto& fields = *handler.fields();
+        required = std::any_of(fields.begin(), fields.end(), [](const JsonSaxField& field) { return field.required; });
+    } else if (not required) {
+        throw json::type_error::create(302, std::string("type must be array, but is ") + json_type_name(type), nullptr);
+    }
+    if (required) {
+        // from_json reads the required parts with json::at
+        throw json::type_error::create(304, std::string("cannot use at() with ") + json_type_name(type), nullptr);
+    }
+}
+
+} // namespace
+
+const char* json_type_name(json::value_t type) {
+    switch (type) {
+    case json::value_t::null:
+        return "null";
+    case json::value_t::object:
+        return "object";
+    case json::value_t::array:
+        return "array";
+    case json::value_t::string:
+        return "string";
+    case json::value_t::boolean:
+        return "boolean";
+    case json::value_t::binary:
+        return "binary";
+    case json::value_t::discarded:
+        return "discarded";
+    default:
+        return "number";
+    }
+}
+
+const JsonSaxValueHandler* json_sax_json_handler() {
+    static const JsonSaxValueHandler handler{
+        JsonSaxValueHandler::Kind::Json, &read_json_primitive, nullptr, &json_array_element, &reset_json, 0};
+    return &handler;
+}
+
+JsonSaxReader::JsonSaxReader(JsonSaxTarget root) : root(root) {
+}
+
+void JsonSaxReader::parse(std::string_view text) {
+    json::sax_parse(text.begin(), text.end(), this);
+}
+
+JsonSaxTarget JsonSaxReader::next_target() {
+    if (this->frames.empty()) {
+        return this->root;
+    }
+    auto& frame = this->frames.back();
+    if (not frame.array) {
+        return frame.next;
+    }
+    const auto index = frame.elements++;
+    return frame.target.handler->element(frame.target.value, index);
+}
+
+void JsonSaxReader::read_primitive(JsonSaxPrimitive& primitive) {
+    if (this->skip_depth > 0) {
+        return;
+    }
+    const auto target = this->next_target();
+    if (target.handler == nullptr) {
+        return;
+    }
+    switch (target.handler->kind) {
+    case JsonSaxValueHandler::Kind::Primitive:
+    case JsonSaxValueHandler::Kind::Json:
+        target.handler->read(target.value, primitive);
+        break;
+    case JsonSaxValueHandler::Kind::Object:
+    case JsonSaxValueHandler::Kind::Array:
+        check_not_container(*target.handler, primitive.type);
+        break;
+    }
+}
+
+void JsonSaxReader::start_container(bool array) {
+    if (this->skip_depth > 0) {
+        this->skip_depth++;
+        return;
+    }
+    const auto target = this->next_target();
+    if (target.handler == nullptr) {
+        this->skip_depth = 1;
+        return;
+    }
+    const auto type = array ? json::value_t::array : json::value_t::object;
+    switch (target.handler->kind) {
+    case JsonSaxValueHandler::Kind::Primitive: {
+        // throws the type error of the primitive type
+        JsonSaxPrimitive primitive{type};
+        target.handler->read(target.value, primitive);
+        return;
+    }
+    case JsonSaxValueHandler::Kind::Json:
+        *static_cast<json*>(target.value) = array ? json::array() : json::object();
+        break;
+    case JsonSaxValueHandler::Kind::Object:
+    case JsonSaxValueHandler::Kind::Array:
+        if (array != (target.handler->kind == JsonSaxValueHandler::Kind::Array)) {
+            check_not_container(*target.handler, type);
+            this->skip_depth = 1;
+            return;
+        }
+        break;
+    }
+    this->frames.push_back({target, array});
+}
+
+void JsonSaxReader::end_container() {
+    if (this->skip_depth > 0) {
+        this->skip_depth--;
+        return;
+    }
+    const auto& frame = this->frames.back();
+    const auto* handler = frame.target.handler;
+    if (handler->kind == JsonSaxValueHandler::Kind::Object) {
+        const auto& fields = *handler->fields();
+        for (std::size_t i = 0; i < fields.size(); i++) {
+            if (fields[i].required and (frame.read_fields & (std::uint64_t{1} << i)) == 0) {
+                throw json::out_of_range::create(403, "key '" + std::string(fields[i].key) + "' not found", nullptr);
+            }
+        }
+    } else if (handler->kind == JsonSaxValueHandler::Kind::Array and frame.elements < handler->required_elements) {
+        throw json::out_of_range::create(401, "array index " + std::to_string(frame.elements) + " is out of range",
+                                         nullptr);
+    }
+    this->frames.pop_back();
+}
+
+bool JsonSaxReader::null() {
+    JsonSaxPrimitive primitive{json::value_t::null};
+    this->read_primitive(primitive);
+    return true;
+}
+
+bool JsonSaxReader::boolean(bool val) {
+    JsonSaxPrimitive primitive{json::value_t::boolean};
+    primitive.boolean = val;
+    this->read_primitive(primitive);
+    return true;
+}
+
+bool JsonSaxReader::number_integer(json::number_integer_t val) {
+    JsonSaxPrimitive primitive{json::value_t::number_integer};
+    primitive.number_integer = val;
+    this->read_primitive(primitive);
+    return true;
+}
+
+bool JsonSaxReader::number_unsigned(json::number_unsigned_t val) {
+    JsonSaxPrimitive primitive{json::value_t::number_unsigned};
+    primitive.number_unsigned = val;
+    this->read_primitive(primitive);
+    return true;
+}
+
+bool JsonSaxReader::number_float(json::number_float_t val, const json::string_t& /*s*/) {
+    JsonSaxPrimitive primitive{json::value_t::number_float};
+    primitive.number_float = val;
+    this->read_primitive(primitive);
+    return true;
+}
+
+bool JsonSaxReader::string(json::string_t& val) {
+    JsonSaxPrimitive primitive{json::value_t::string};
+    primitive.string = &val;
+    this->read_primitive(primitive);
+    return true;
+}
+
+bool JsonSaxReader::binary(json::binary_t& /*val*/) {
+    // binary values are not part of json text
+    JsonSaxPrimitive primitive{json::value_t::binary};
+    this->read_primitive(primitive);
+    return true;
+}
+
+bool JsonSaxReader::start_object(std::size_t /*elements*/) {
+    this->start_container(false);
+    return true;
+}
+
+bool JsonSaxReader::key(json::string_t& val) {
+    if (this->skip_depth > 0) {
+        return true;
+    }
+    auto& frame = this->frames.back();
+    const auto* handler = frame.target.handler;
+    if (handler->kind == JsonSaxValueHandler::Kind::Json) {
+        frame.next = {handler, &(*static_cast<json*>(frame.target.value))[val]};
+        return true;
+    }
+
+    const auto& fields = *handler->fields();
+    for (std::size_t i = 0; i < fields.size(); i++) {
+        if (fields[i].key == val) {
+            const auto bit = std::uint64_t{1} << i;
+            frame.next = fields[i].target(frame.target.value);
+            if ((frame.read_fields & bit) != 0 and frame.next.handler->reset != nullptr) {
+                // like json::parse, the last of duplicate keys wins
+                frame.next.handler->reset(frame.next.value);
+            }
+            frame.read_fields |= bit;
+            return true;
+        }
+    }
+    // unknown keys are ignored like by from_json
+    frame.next = {};
+    return true;
+}
+
+bool JsonSaxReader::end_object() {
+    this->end_container();
+    return true;
+}
+
+bool JsonSaxReader::start_array(std::size_t /*elements*/) {
+    this->start_container(true);
+    return true;
+}
+
+bool JsonSaxReader::end_array() {
+    this->end_container();
+    return true;
+}
+
+json parse_message(std::string_view message, const std::function<bool(const std::string& action)>& skip_payload,
+                   bool& payload_skipped) {
+    static const JsonSaxValueHandler handler{
+        JsonSaxValueHandler::Kind::Array, nullptr, nullptr, &message_envelope_element, nullptr, 0};
+    MessageEnvelope envelope;
+    envelope.skip_payload = &skip_payload;
+    JsonSaxReader reader({&handler, &envelope});
+    reader.parse(message);
+    payload_skipped = envelope.payload_skipped;
+    return std::move(envelope.message);
+}
+
+} // namespace ocpp
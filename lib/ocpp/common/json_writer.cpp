@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <array>
+#include <charconv>
+#include <cmath>
+
+#include <nlohmann/json.hpp>
+
+#include <ocpp/common/json_writer.hpp>
+#include <ocpp/common/types.hpp>
+
+namespace ocpp {
+
+namespace {
+
+/// \brief Returns the length of the valid UTF-8 sequence at the start of \p s, or 0 if the sequence is invalid or
+/// incomplete. Overlong encodings, surrogates and code points above U+10FFFF are invalid, like for json::dump
+std::size_t utf8_sequence_length(std::string_view s) {
+    const auto byte = [&s](std::size_t i) { return static_cast<unsigned char>(s[i]); };
+    const auto continuation = [&](std::size_t i, unsigned char low = 0x80, unsigned char high = 0xBF) {
+        return i < s.size() and byte(i) >= low and byte(i) <= high;
+    };
+
+    const auto lead = byte(0);
+    if (lead >= 0xC2 and lead <= 0xDF) {
+        return continuation(1) ? 2 : 0;
+    }
+    if (lead >= 0xE0 and lead <= 0xEF) {
+        const unsigned char low = lead == 0xE0 ? 0xA0 : 0x80;
+        const unsigned char high = lead == 0xED ? 0x9F : 0xBF;
+        return continuation(1, low, high) and continuation(2) ? 3 : 0;
+    }
+    if (lead >= 0xF0 and lead <= 0xF4) {
+        const unsigned char low = lead == 0xF0 ? 0x90 : 0x80;
+        const unsigned char high = lead == 0xF4 ? 0x8F : 0xBF;
+        return continuation(1, low, high) and continuation(2) and continuation(3) ? 4 : 0;
+    }
+    return 0;
+}
+
+} // namespace
+
+void JsonWriter::clear() {
+    this->buffer.clear();
+}
+
+const std::string& JsonWriter::str() const {
+    return this->buffer;
+}
+
+std::string JsonWriter::release() {
+    return std::move(this->buffer);
+}
+
+void JsonWriter::separate() {
+    if (not this->buffer.empty()) {
+        const auto last = this->buffer.back();
+        if (last != '[' and last != '{' and last != ':') {
+            this->buffer.push_back(',');
+        }
+    }
+}
+
+void JsonWriter::begin_object() {
+    this->separate();
+    this->buffer.push_back('{');
+}
+
+void JsonWriter::end_object() {
+    this->buffer.push_back('}');
+}
+
+void JsonWriter::begin_array() {
+    this->separate();
+    this->buffer.push_back('[');
+}
+
+void JsonWriter::end_array() {
+    this->buffer.push_back(']');
+}
+
+void JsonWriter::key(std::string_view key) {
+    this->separate();
+    this->buffer.push_back('"');
+    this->buffer.append(key);
+    this->buffer.append("\":");
+}
+
+void JsonWriter::value(bool value) {
+    this->separate();
+    this->buffer.append(value ? "true" : "false");
+}
+
+void JsonWriter::value(std::int32_t value) {
+    this->separate();
+    std::array<char, 16> digits;
+    const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+    this->buffer.append(digits.data(), static_cast<std::size_t>(result.ptr - digits.data()));
+}
+
+void JsonWriter::value(double value) {
+    this->separate();
+    if (not std::isfinite(value)) {
+        this->buffer.append("null");
+        return;
+    }
+    // the shortest representation that is read back as the same double, as written by json::dump
+    std::array<char, 64> digits;
+    const auto* end = nlohmann::detail::to_chars(digits.data(), digits.data() + digits.size(), value);
+    this->buffer.append(digits.data(), static_cast<std::size_t>(end - digits.data()));
+}
+
+void JsonWriter::value(std::string_view value) {
+    this->separate();
+    this->buffer.push_back('"');
+    this->write_escaped(value);
+    this->buffer.push_back('"');
+}
+
+void JsonWriter::value(const std::string& value) {
+    this->value(std::string_view(value));
+}
+
+void JsonWriter::value(const char* value) {
+    this->value(std::string_view(value));
+}
+
+void JsonWriter::value(const DateTime& value) {
+    std::array<char, DateTime::RFC3339_BUFFER_SIZE> rfc3339;
+    this->value(value.to_rfc3339(rfc3339));
+}
+
+void JsonWriter::value(const nlohmann::json& value) {
+    this->separate();
+    // untyped values like CustomData are rare, they are serialized by json::dump
+    this->buffer.append(value.dump());
+}
+
+void JsonWriter::write_escaped(std::string_view value) {
+    static constexpr const char* hex = "0123456789abcdef";
+    std::size_t unescaped = 0; // start of the characters that are written as they are
+    for (std::size_t i = 0; i < value.size();) {
+        const auto c = static_cast<unsigned char>(value[i]);
+        if (c >= 0x80) {
+            auto length = utf8_sequence_length(value.substr(i));
+            if (length == 0) {
+                // throws the json::type_error that json::dump throws for this string
+                static_cast<void>(nlohmann::json(std::string(value)).dump());
+                length = 1;
+            }
+            i += length;
+            continue;
+        }
+        if (c >= 0x20 and c != '"' and c != '\\') {
+            i++;
+            continue;
+        }
+
+        this->buffer.append(value.data() + unescaped, i - unescaped);
+        this->buffer.push_back('\\');
+        switch (c) {
+        case '\b':
+            this->buffer.push_back('b');
+            break;
+        case '\t':
+            this->buffer.push_back('t');
+            break;
+        case '\n':
+            this->buffer.push_back('n');
+            break;
+        case '\f':
+            this->buffer.push_back('f');
+            break;
+        case '\r':
+            this->buffer.push_back('r');
+            break;
+        case '"':
+        case '\\':
+            this->buffer.push_back(static_cast<char>(c));
+            break;
+        default:
+            this->buffer.append("u00");
+            this->buffer.push_back(hex[c >> 4]);
+            this->buffer.push_back(hex[c & 0x0F]);
+            break;
+        }
+        unescaped = ++i;
+    }
+    this->buffer.append(value.data() + unescaped, value.size() - unescaped);
+}
+
+} // namespace ocpp
@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <array>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+
+#include <ocpp/common/message_schema_validator.hpp>
+
+namespace ocpp {
+
+namespace {
+
+const std::string REQUEST_SUFFIX = "Request";
+const std::string RESPONSE_SUFFIX = "Response";
+
+bool ends_with(const std::string& str, const std::string& suffix) {
+    return str.size() >= suffix.size() and str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+/// \brief Prefixes of the json-schema-validator messages of violated value constraints: maxLength, minLength,
+/// pattern, format, enum, const, maximum, minimum and multipleOf
+constexpr std::array<std::string_view, 9> PROPERTY_CONSTRAINT_MESSAGES = {
+    "instance is too long",
+    "instance is too short",
+    "instance does not match regex pattern",
+    "format-checking failed",
+    "instance not found in required enum",
+    "instance not const",
+    "instance exceeds",
+    "instance is below",
+    "instance is not a multiple of",
+};
+
+/// \brief Keeps the first error reported by the validator, the following errors are usually caused by it
+class FirstErrorHandler : public nlohmann::json_schema::error_handler {
+public:
+    std::optional<std::string> pointer;
+    std::string message;
+
+    void error(const json::json_pointer& ptr, const json& /*instance*/, const std::string& message) override {
+        if (not this->pointer.has_value()) {
+            this->pointer = ptr.to_string();
+            this->message = message;
+        }
+    }
+};
+
+bool is_property_constraint_violation(std::string_view message) {
+    for (const auto prefix : PROPERTY_CONSTRAINT_MESSAGES) {
+        if (message.substr(0, prefix.size()) == prefix) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+std::map<std::string, fs::path> find_request_schemas(const fs::path& schemas_path) {
+    std::map<std::string, fs::path> schemas;
+    if (!fs::exists(schemas_path) || !fs::is_directory(schemas_path)) {
+        EVLOG_error << schemas_path << " does not exist";
+        return schemas;
+    }
+    for (const auto& file : fs::directory_iterator(schemas_path)) {
+        if (file.path().extension() != ".json") {
+            continue;
+        }
+        auto action = file.path().stem().string();
+        if (ends_with(action, RESPONSE_SUFFIX)) {
+            continue;
+        }
+        if (ends_with(action, REQUEST_SUFFIX)) {
+            action.erase(action.size() - REQUEST_SUFFIX.size());
+        }
+        schemas[action] = file.path();
+    }
+    return schemas;
+}
+
+std::unique_ptr<json_validator> load_request_validator(const fs::path& schema_path) {
+    std::ifstream ifs(schema_path.c_str());
+    const auto schema = json::parse(ifs);
+
+    auto validator = std::make_unique<json_validator>(
+        [](const json_uri& uri, json& schema) {
+            if (uri.location() == "http://json-schema.org/draft-07/schema") {
+                schema = nlohmann::json_schema::draft7_schema_builtin;
+                return;
+            }
+            throw std::runtime_error(uri.url() + " is not supported for schema loading at the moment");
+        },
+        Schemas::format_checker);
+    validator->set_root_schema(schema);
+    return validator;
+}
+
+std::optional<CallError> validate_payload(const json_validator& validator, const MessageId& unique_id,
+                                          const json& payload) {
+    FirstErrorHandler error_handler;
+    validator.validate(payload, error_handler);
+    if (not error_handler.pointer.has_value()) {
+        return std::nullopt;
+    }
+
+    const auto error_code =
+        is_property_constraint_violation(error_handler.message) ? "PropertyConstraintViolation" : "FormationViolation";
+    const auto& pointer = error_handler.pointer.value();
+    return CallError(unique_id, error_code, (pointer.empty() ? "/" : pointer) + ": " + error_handler.message,
+                     json({{"property", pointer}}));
+}
+
+} // namespace ocpp
@@ -265,8 +265,10 @@ void MessageLogging::charge_point(const std::string& message_type, const std::st
     if (this->message_callback != nullptr) {
         this->message_callback(json_str, MessageDirection::ChargingStationToCSMS);
     }
-    auto formatted = format_message(message_type, json_str);
-    log_output(0, formatted.message_type, formatted.message);
+    if (this->log_messages) {
+        auto formatted = format_message(message_type, json_str);
+        log_output(0, formatted.message_type, formatted.message);
+    }
     if (this->session_logging) {
         std::scoped_lock lock(this->session_id_logging_mutex);
         for (auto const& [session_id, logging] : this->session_id_logging) {
@@ -279,8 +281,10 @@ void MessageLogging::central_system(const std::string& message_type, const std::
     if (this->message_callback != nullptr) {
         this->message_callback(json_str, MessageDirection::CSMSToChargingStation);
     }
-    auto formatted = format_message(message_type, json_str);
-    log_output(1, formatted.message_type, formatted.message);
+    if (this->log_messages) {
+        auto formatted = format_message(message_type, json_str);
+        log_output(1, formatted.message_type, formatted.message);
+    }
     if (this->session_logging) {
         std::scoped_lock lock(this->session_id_logging_mutex);
         for (auto const& [session_id, logging] : this->session_id_logging) {
@@ -289,6 +293,23 @@ void MessageLogging::central_system(const std::string& message_type, const std::
     }
 }
 
+void MessageLogging::central_system(const std::string& message_type, const std::string& json_str,
+                                    const json& json_message) {
+    if (this->message_callback != nullptr) {
+        this->message_callback(json_str, MessageDirection::CSMSToChargingStation);
+    }
+    if (this->log_messages) {
+        auto formatted = format_message(message_type, json_message);
+        log_output(1, formatted.message_type, formatted.message);
+    }
+    if (this->session_logging) {
+        std::scoped_lock lock(this->session_id_logging_mutex);
+        for (auto const& [session_id, logging] : this->session_id_logging) {
+            logging->central_system(message_type, json_str, json_message);
+        }
+    }
+}
+
 void MessageLogging::sys(const std::string& msg) {
     log_output(2, msg, "");
     if (this->session_logging) {
@@ -369,11 +390,20 @@ std::string MessageLogging::html_encode(const std::string& msg) {
 }
 
 FormattedMessageWithType MessageLogging::format_message(const std::string& message_type, const std::string& json_str) {
+    try {
+        return this->format_message(message_type, json::parse(json_str));
+    } catch (const std::exception& e) {
+        EVLOG_warning << "Error parsing OCPP message " << message_type << ": " << e.what();
+    }
+
+    return {message_type, json_str};
+}
+
+FormattedMessageWithType MessageLogging::format_message(const std::string& message_type, const json& json_object) {
     auto extracted_message_type = message_type;
-    auto formatted_message = json_str;
+    std::string formatted_message;
 
     try {
-        auto json_object = json::parse(json_str);
         if (json_object.at(MESSAGE_TYPE_ID) == MessageTypeId::CALL) {
             extracted_message_type = json_object.at(CALL_ACTION);
             this->lookup_map[json_object.at(MESSAGE_ID)] = extracted_message_type + "Response";
@@ -383,7 +413,8 @@ FormattedMessageWithType MessageLogging::format_message(const std::string& messa
         }
         formatted_message = json_object.dump(2);
     } catch (const std::exception& e) {
-        EVLOG_warning << "Error parsing OCPP message " << message_type << ": " << e.what();
+        EVLOG_warning << "Error formatting OCPP message " << message_type << ": " << e.what();
+        formatted_message = json_object.dump();
     }
 
     return {extracted_message_type, formatted_message};
@@ -7,6 +7,145 @@
 
 namespace ocpp {
 
+namespace {
+
+using TimePoint = std::chrono::time_point<date::utc_clock>;
+
+/// \brief Length of the YYYY-MM-DDThh:mm:ss.sssZ strings written by to_rfc3339
+constexpr std::size_t RFC3339_LENGTH = 24;
+
+bool is_digit(char c) {
+    return c >= '0' and c <= '9';
+}
+
+/// \brief Reads the \p count digits at \p pos of \p str into \p value
+/// \returns false if \p str does not have \p count digits at \p pos
+bool read_digits(std::string_view str, std::size_t pos, std::size_t count, int& value) {
+    if (pos + count > str.size()) {
+        return false;
+    }
+    value = 0;
+    for (std::size_t i = pos; i < pos + count; i++) {
+        if (not is_digit(str[i])) {
+            return false;
+        }
+        value = value * 10 + (str[i] - '0');
+    }
+    return true;
+}
+
+/// \brief Writes \p value with \p count digits to \p buffer, padded with zeros
+void write_digits(char* buffer, int value, std::size_t count) {
+    for (std::size_t i = count; i > 0; i--) {
+        buffer[i - 1] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+}
+
+/// \brief Parses the usual forms YYYY-MM-DDThh:mm:ss[.s{1,9}][Z|+hh:mm|-hh:mm] of RFC 3339 timestamps into
+/// \p timepoint without allocating memory. The result is the same as the one of date::parse, other forms that
+/// date::parse accepts, like leap seconds, are left to it
+/// \returns false if \p str does not have one of these forms, \p timepoint is not changed then
+bool parse_rfc3339(std::string_view str, TimePoint& timepoint) {
+    int year = 0;
+    int month = 0;
+    int day = 0;
+    int hours = 0;
+    int minutes = 0;
+    int seconds = 0;
+    if (str.size() < 19 or not read_digits(str, 0, 4, year) or str[4] != '-' or not read_digits(str, 5, 2, month) or
+        str[7] != '-' or not read_digits(str, 8, 2, day) or str[10] != 'T' or not read_digits(str, 11, 2, hours) or
+        str[13] != ':' or not read_digits(str, 14, 2, minutes) or str[16] != ':' or
+        not read_digits(str, 17, 2, seconds)) {
+        return false;
+    }
+    const date::year_month_day ymd{date::year{year}, date::month{static_cast<unsigned>(month)},
+                                   date::day{static_cast<unsigned>(day)}};
+    if (not ymd.ok() or hours > 23 or minutes > 59 or seconds > 59) {
+        return false;
+    }
+
+    std::size_t pos = 19;
+    std::chrono::nanoseconds fraction{0};
+    if (pos < str.size() and str[pos] == '.') {
+        const auto start = ++pos;
+        std::int64_t nanoseconds = 0;
+        while (pos < str.size() and pos - start < 9 and is_digit(str[pos])) {
+            nanoseconds = nanoseconds * 10 + (str[pos] - '0');
+            pos++;
+        }
+        if (pos == start) {
+            return false;
+        }
+        for (auto digits = pos - start; digits < 9; digits++) {
+            nanoseconds *= 10;
+        }
+        fraction = std::chrono::nanoseconds{nanoseconds};
+    }
+
+    std::chrono::minutes offset{0};
+    if (pos + 1 == str.size() and str[pos] == 'Z') {
+        // UTC
+    } else if (pos + 6 == str.size() and (str[pos] == '+' or str[pos] == '-')) {
+        int offset_hours = 0;
+        int offset_minutes = 0;
+        if (not read_digits(str, pos + 1, 2, offset_hours) or str[pos + 3] != ':' or
+            not read_digits(str, pos + 4, 2, offset_minutes) or offset_hours > 23 or offset_minutes > 59) {
+            return false;
+        }
+        offset = std::chrono::hours{offset_hours} + std::chrono::minutes{offset_minutes};
+        if (str[pos] == '-') {
+            offset = -offset;
+        }
+    } else if (pos != str.size()) {
+        return false;
+    }
+
+    // date::parse rounds the seconds to the precision of the time point
+    const auto time_of_day = std::chrono::hours{hours} + std::chrono::minutes{minutes} +
+                             std::chrono::round<TimePoint::duration>(std::chrono::seconds{seconds} + fraction);
+    timepoint = std::chrono::time_point_cast<TimePoint::duration>(
+        date::utc_clock::from_sys(date::sys_days{ymd} - offset + time_of_day));
+    return true;
+}
+
+/// \brief Writes \p timepoint as YYYY-MM-DDThh:mm:ss.sssZ to \p buffer like date::format("%FT%TZ") without allocating
+/// memory
+/// \returns false for leap seconds and years without four digits, they are left to date::format
+bool format_rfc3339(const TimePoint& timepoint, char* buffer) {
+    const auto utc = std::chrono::time_point_cast<std::chrono::milliseconds>(timepoint);
+    const auto sys = date::utc_clock::to_sys(utc);
+    if (date::utc_clock::from_sys(sys) != utc) {
+        // a leap second, written as hh:mm:60
+        return false;
+    }
+    const auto days = date::floor<date::days>(sys);
+    const date::year_month_day ymd{days};
+    const auto year = static_cast<int>(ymd.year());
+    if (year < 1000 or year > 9999) {
+        return false;
+    }
+    const date::hh_mm_ss<std::chrono::milliseconds> time{sys - days};
+
+    write_digits(buffer, year, 4);
+    buffer[4] = '-';
+    write_digits(buffer + 5, static_cast<int>(static_cast<unsigned>(ymd.month())), 2);
+    buffer[7] = '-';
+    write_digits(buffer + 8, static_cast<int>(static_cast<unsigned>(ymd.day())), 2);
+    buffer[10] = 'T';
+    write_digits(buffer + 11, static_cast<int>(time.hours().count()), 2);
+    buffer[13] = ':';
+    write_digits(buffer + 14, static_cast<int>(time.minutes().count()), 2);
+    buffer[16] = ':';
+    write_digits(buffer + 17, static_cast<int>(time.seconds().count()), 2);
+    buffer[19] = '.';
+    write_digits(buffer + 20, static_cast<int>(time.subseconds().count()), 3);
+    buffer[23] = 'Z';
+    return true;
+}
+
+} // namespace
+
 DateTime::DateTime() : DateTimeImpl() {
 }
 
@@ -38,10 +177,24 @@ DateTimeImpl::DateTimeImpl(const std::string& timepoint_str) {
 }
 
 std::string DateTimeImpl::to_rfc3339() const {
-    return date::format("%FT%TZ", std::chrono::time_point_cast<std::chrono::milliseconds>(this->timepoint));
+    std::array<char, RFC3339_BUFFER_SIZE> buffer;
+    return std::string(this->to_rfc3339(buffer));
+}
+
+std::string_view DateTimeImpl::to_rfc3339(std::array<char, RFC3339_BUFFER_SIZE>& buffer) const {
+    if (format_rfc3339(this->timepoint, buffer.data())) {
+        return {buffer.data(), RFC3339_LENGTH};
+    }
+    const auto formatted =
+        date::format("%FT%TZ", std::chrono::time_point_cast<std::chrono::milliseconds>(this->timepoint));
+    return {buffer.data(), formatted.copy(buffer.data(), buffer.size())};
 }
 
 void DateTimeImpl::from_rfc3339(const std::string& timepoint_str) {
+    if (parse_rfc3339(timepoint_str, this->timepoint)) {
+        return;
+    }
+    // the less common forms that date::parse accepts, e.g. leap seconds or single digit fields
     std::istringstream in{timepoint_str};
     in >> date::parse("%FT%T%Ez", this->timepoint);
     if (in.fail()) {
@@ -70,7 +223,8 @@ DateTimeImpl& DateTimeImpl::operator=(const DateTimeImpl& dt) {
 }
 
 std::ostream& operator<<(std::ostream& os, const DateTimeImpl& dt) {
-    os << dt.to_rfc3339();
+    std::array<char, DateTimeImpl::RFC3339_BUFFER_SIZE> buffer;
+    os << dt.to_rfc3339(buffer);
     return os;
 }
 
@@ -122,6 +276,16 @@ void from_json(const json& j, CallError& c) {
     c.errorDetails = j.at(CALLERROR_ERROR_DETAILS);
 }
 
+void write_json(JsonWriter& writer, const CallError& c) {
+    writer.begin_array();
+    writer.value(static_cast<std::int32_t>(MessageTypeId::CALLERROR));
+    writer.value(c.uniqueId.view());
+    writer.value(c.errorCode);
+    writer.value(c.errorDescription);
+    writer.value(c.errorDetails);
+    writer.end_array();
+}
+
 std::ostream& operator<<(std::ostream& os, const CallError& c) {
     os << json(c).dump(4);
     return os;
@@ -574,7 +738,8 @@ void from_json(const json& j, DisplayMessageContent& m) {
     }
 
     if (j.contains("format")) {
-        m.message_format = v201::conversions::string_to_message_format_enum(j.at("format"));
+        m.message_format =
+            v201::conversions::string_to_message_format_enum(j.at("format").get_ref<const std::string&>());
     }
 
     if (j.contains("language")) {
@@ -694,7 +859,7 @@ void from_json(const json& j, RunningCost& c) {
     }
 
     if (j.contains("state")) {
-        c.state = conversions::string_to_running_cost_state(j.at("state"));
+        c.state = conversions::string_to_running_cost_state(j.at("state").get_ref<const std::string&>());
     }
 
     if (j.contains("chargingPrice")) {
@@ -982,7 +1147,8 @@ void to_json(json& j, const CertificateHashDataType& k) {
 /// \brief Conversion from a given json object \p j to a given CertificateHashDataType \p k
 void from_json(const json& j, CertificateHashDataType& k) {
     // the required parts of the message
-    k.hashAlgorithm = conversions::string_to_hash_algorithm_enum_type(j.at("hashAlgorithm"));
+    k.hashAlgorithm =
+        conversions::string_to_hash_algorithm_enum_type(j.at("hashAlgorithm").get_ref<const std::string&>());
     k.issuerNameHash = j.at("issuerNameHash");
     k.issuerKeyHash = j.at("issuerKeyHash");
     k.serialNumber = j.at("serialNumber");
@@ -1017,7 +1183,7 @@ void to_json(json& j, const CertificateHashDataChain& k) {
 void from_json(const json& j, CertificateHashDataChain& k) {
     // the required parts of the message
     k.certificateHashData = j.at("certificateHashData");
-    k.certificateType = conversions::string_to_certificate_type(j.at("certificateType"));
+    k.certificateType = conversions::string_to_certificate_type(j.at("certificateType").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("childCertificateHashData")) {
@@ -1,7 +1,9 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
 
-#include <boost/algorithm/string/predicate.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <mutex>
 #include <regex>
 #include <sstream>
@@ -10,8 +12,73 @@
 
 namespace ocpp {
 
-bool iequals(const std::string& lhs, const std::string rhs) {
-    return boost::algorithm::iequals(lhs, rhs);
+namespace {
+
+constexpr std::uint64_t BYTES_0x01 = 0x0101010101010101;
+constexpr std::uint64_t BYTES_0x80 = 0x8080808080808080;
+
+char to_lower_ascii(char c) {
+    return (c >= 'A' and c <= 'Z') ? static_cast<char>(c | 0x20) : c;
+}
+
+bool is_printable_ascii_character(char c) {
+    return (c >= 0x20 and c <= 0x7e) or c == '\n';
+}
+
+} // namespace
+
+bool iequals(std::string_view lhs, std::string_view rhs) {
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < lhs.size(); i++) {
+        if (lhs[i] != rhs[i] and to_lower_ascii(lhs[i]) != to_lower_ascii(rhs[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool iless(std::string_view lhs, std::string_view rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](char l, char r) {
+        return static_cast<unsigned char>(to_lower_ascii(l)) < static_cast<unsigned char>(to_lower_ascii(r));
+    });
+}
+
+std::size_t ihash(std::string_view data) {
+    // 64 bit FNV-1a of the lower case characters
+    std::uint64_t hash = 0xcbf29ce484222325;
+    for (const char c : data) {
+        hash ^= static_cast<unsigned char>(to_lower_ascii(c));
+        hash *= 0x100000001b3;
+    }
+    return static_cast<std::size_t>(hash);
+}
+
+bool is_printable_ascii(std::string_view data) {
+    std::size_t i = 0;
+    // checks eight characters at once, only blocks with a character outside of 0x20 to 0x7e are checked one by one
+    for (; i + sizeof(std::uint64_t) <= data.size(); i += sizeof(std::uint64_t)) {
+        std::uint64_t block = 0;
+        std::memcpy(&block, data.data() + i, sizeof(block));
+        // the high bit of a byte is set if it is below 0x20, or above 0x7e including all bytes above 0x7f
+        const auto below = (block - BYTES_0x01 * 0x20) & ~block;
+        const auto above = (block + BYTES_0x01) | block;
+        if (((below | above) & BYTES_0x80) == 0) {
+            continue;
+        }
+        for (std::size_t j = i; j < i + sizeof(std::uint64_t); j++) {
+            if (not is_printable_ascii_character(data[j])) {
+                return false;
+            }
+        }
+    }
+    for (; i < data.size(); i++) {
+        if (not is_printable_ascii_character(data[i])) {
+            return false;
+        }
+    }
+    return true;
 }
 
 bool is_integer(const std::string& value) {
@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <algorithm>
+#include <cerrno>
+
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <everest/logging.hpp>
+#include <ocpp/common/websocket/reconnect_scheduler.hpp>
+
+namespace ocpp {
+
+namespace {
+// Limits the shift of the doubling backoff that caps the delays
+constexpr int MAX_BACKOFF_DOUBLINGS = 16;
+// Lower bound of the range the delays are drawn from if no RetryBackOffWaitMinimum is configured, otherwise the
+// decorrelated jitter could never grow again from a delay of 0
+constexpr std::chrono::milliseconds MIN_JITTER_RANGE(1000);
+
+std::chrono::milliseconds get_backoff_cap(const ReconnectBackoffParameters& parameters) {
+    const auto doublings = std::clamp(parameters.repeat_times, 0, MAX_BACKOFF_DOUBLINGS);
+    return std::chrono::duration_cast<std::chrono::milliseconds>(parameters.wait_minimum + parameters.random_range) *
+           (1LL << doublings);
+}
+} // namespace
+
+ReconnectScheduler::ReconnectScheduler(std::uint32_t seed) : random_engine(seed) {
+}
+
+std::chrono::milliseconds ReconnectScheduler::random_delay(const std::chrono::milliseconds min,
+                                                           const std::chrono::milliseconds max) {
+    if (max <= min) {
+        return min;
+    }
+    std::uniform_int_distribution<std::chrono::milliseconds::rep> distr(min.count(), max.count());
+    return std::chrono::milliseconds(distr(this->random_engine));
+}
+
+std::chrono::milliseconds ReconnectScheduler::next_reconnect_delay(const int32_t profile,
+                                                                   const ReconnectBackoffParameters& parameters) {
+    std::lock_guard<std::mutex> lk(this->state_mutex);
+    auto& state = this->profiles[profile];
+
+    const std::chrono::milliseconds wait_minimum = parameters.wait_minimum;
+    std::chrono::milliseconds delay;
+    if (state.statistics.reconnect_attempts == 0) {
+        state.offline_since = std::chrono::steady_clock::now();
+        delay = this->random_delay(wait_minimum, wait_minimum + parameters.random_range);
+    } else {
+        const auto cap = std::max(get_backoff_cap(parameters), wait_minimum);
+        const auto upper = std::max(state.previous_delay * 3, wait_minimum + MIN_JITTER_RANGE);
+        delay = std::min(this->random_delay(wait_minimum, upper), cap);
+    }
+
+    state.previous_delay = delay;
+    state.statistics.reconnect_attempts += 1;
+    state.statistics.total_reconnect_attempts += 1;
+    if (this->started_at.has_value()) {
+        this->reconnect_attempts_since_start += 1;
+    }
+    return delay;
+}
+
+std::chrono::milliseconds ReconnectScheduler::probe_success_delay(const int32_t profile,
+                                                                  const ReconnectBackoffParameters& parameters,
+                                                                  const std::chrono::milliseconds remaining) {
+    std::lock_guard<std::mutex> lk(this->state_mutex);
+    auto& state = this->profiles[profile];
+    state.statistics.probe_shortcuts += 1;
+
+    // Spread the reconnects over the random range, but never delay them beyond the pending reconnect
+    const auto spread = std::max<std::chrono::milliseconds>(parameters.random_range, MIN_JITTER_RANGE);
+    return this->random_delay(std::chrono::milliseconds(0), std::min(spread, remaining));
+}
+
+void ReconnectScheduler::on_connected(const int32_t profile) {
+    std::lock_guard<std::mutex> lk(this->state_mutex);
+    auto& state = this->profiles[profile];
+
+    if (state.offline_since.has_value()) {
+        const auto time_to_connect = std::chrono::steady_clock::now() - state.offline_since.value();
+        state.statistics.last_time_to_connect = time_to_connect;
+        EVLOG_info << "Connected to network profile " << profile << " after " << state.statistics.reconnect_attempts
+                   << " reconnect attempt(s) and "
+                   << std::chrono::duration_cast<std::chrono::milliseconds>(time_to_connect).count() << "ms";
+    }
+
+    state.previous_delay = std::chrono::milliseconds(0);
+    state.offline_since.reset();
+    state.statistics.reconnect_attempts = 0;
+    state.statistics.connections += 1;
+}
+
+void ReconnectScheduler::on_start() {
+    std::lock_guard<std::mutex> lk(this->state_mutex);
+    this->started_at = std::chrono::steady_clock::now();
+    this->reconnect_attempts_since_start = 0;
+    this->time_to_boot_notification_accepted.reset();
+}
+
+std::optional<std::chrono::steady_clock::duration> ReconnectScheduler::on_boot_notification_accepted() {
+    std::lock_guard<std::mutex> lk(this->state_mutex);
+    if (!this->started_at.has_value()) {
+        return std::nullopt;
+    }
+
+    const auto time_to_accepted = std::chrono::steady_clock::now() - this->started_at.value();
+    this->started_at.reset();
+    this->time_to_boot_notification_accepted = time_to_accepted;
+    EVLOG_info << "BootNotification accepted "
+               << std::chrono::duration_cast<std::chrono::milliseconds>(time_to_accepted).count()
+               << "ms after start with " << this->reconnect_attempts_since_start << " reconnect attempt(s)";
+    return time_to_accepted;
+}
+
+ReconnectStatistics ReconnectScheduler::get_statistics(const int32_t profile) {
+    std::lock_guard<std::mutex> lk(this->state_mutex);
+    const auto it = this->profiles.find(profile);
+    if (it == this->profiles.end()) {
+        return {};
+    }
+    return it->second.statistics;
+}
+
+std::optional<std::chrono::steady_clock::duration> ReconnectScheduler::get_time_to_boot_notification_accepted() {
+    std::lock_guard<std::mutex> lk(this->state_mutex);
+    return this->time_to_boot_notification_accepted;
+}
+
+bool ReconnectScheduler::probe(const std::string& host, const uint16_t port, const std::chrono::milliseconds timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_NUMERICSERV;
+
+    addrinfo* addresses = nullptr;
+    if (getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &addresses) != 0) {
+        EVLOG_debug << "Probe could not resolve " << host;
+        return false;
+    }
+
+    bool reachable = false;
+    for (addrinfo* address = addresses; address != nullptr and !reachable; address = address->ai_next) {
+        const auto remaining =
+            std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        if (remaining.count() <= 0) {
+            break;
+        }
+
+        const int fd = socket(address->ai_family, address->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC,
+                              address->ai_protocol);
+        if (fd < 0) {
+            continue;
+        }
+
+        if (connect(fd, address->ai_addr, address->ai_addrlen) == 0) {
+            reachable = true;
+        } else if (errno == EINPROGRESS) {
+            pollfd poll_fd{fd, POLLOUT, 0};
+            if (poll(&poll_fd, 1, static_cast<int>(remaining.count())) == 1) {
+                int error = 0;
+                socklen_t error_len = sizeof(error);
+                reachable = getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &error_len) == 0 and error == 0;
+            }
+        }
+        ::close(fd);
+    }
+
+    freeaddrinfo(addresses);
+    return reachable;
+}
+
+} // namespace ocpp
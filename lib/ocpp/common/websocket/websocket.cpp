@@ -107,4 +107,20 @@ void Websocket::set_authorization_key(const std::string& authorization_key) {
     this->websocket->set_authorization_key(authorization_key);
 }
 
+void Websocket::set_reconnect_scheduler(std::shared_ptr<ReconnectScheduler> scheduler, const int32_t profile) {
+    this->websocket->set_reconnect_scheduler(scheduler, profile);
+}
+
+WebsocketReceiveLatencyStatistics Websocket::get_receive_latency_statistics() {
+    return this->websocket->get_receive_latency_statistics();
+}
+
+WebsocketCompressionStatistics Websocket::get_compression_statistics() {
+    return this->websocket->get_compression_statistics();
+}
+
+WebsocketTlsStatistics Websocket::get_tls_statistics() {
+    return this->websocket->get_tls_statistics();
+}
+
 } // namespace ocpp
@@ -1,6 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
-#include <random>
+#include <algorithm>
 
 #include <everest/logging.hpp>
 #include <ocpp/common/websocket/websocket_base.hpp>
@@ -14,7 +14,8 @@ WebsocketBase::WebsocketBase() :
     message_callback(nullptr),
     reconnect_timer(nullptr),
     connection_attempts(1),
-    reconnect_backoff_ms(0),
+    reconnect_scheduler(std::make_shared<ReconnectScheduler>()),
+    reconnect_profile(0),
     shutting_down(false),
     reconnecting(false) {
 
@@ -128,26 +129,29 @@ void WebsocketBase::log_on_fail(const std::error_code& ec, const boost::system::
                 << ", Transport error category: " << transport_ec.category().name();
 }
 
-long WebsocketBase::get_reconnect_interval() {
+ReconnectBackoffParameters WebsocketBase::get_reconnect_backoff_parameters() {
+    return {std::chrono::seconds(this->connection_options.retry_backoff_wait_minimum_s),
+            std::chrono::seconds(this->connection_options.retry_backoff_random_range_s),
+            this->connection_options.retry_backoff_repeat_times};
+}
 
-    // We need to add 1 to the repeat times since the first try is already connection_attempt 1
-    if (this->connection_attempts > (this->connection_options.retry_backoff_repeat_times + 1)) {
-        return this->reconnect_backoff_ms;
+long WebsocketBase::get_reconnect_interval() {
+    std::shared_ptr<ReconnectScheduler> scheduler;
+    {
+        std::lock_guard<std::mutex> lk(this->reconnect_mutex);
+        scheduler = this->reconnect_scheduler;
     }
+    return scheduler->next_reconnect_delay(this->reconnect_profile, this->get_reconnect_backoff_parameters()).count();
+}
 
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> distr(0, this->connection_options.retry_backoff_random_range_s);
-
-    int random_number = distr(gen);
-
-    if (this->connection_attempts == 1) {
-        this->reconnect_backoff_ms = (this->connection_options.retry_backoff_wait_minimum_s + random_number) * 1000;
-        return this->reconnect_backoff_ms;
+void WebsocketBase::reset_reconnect_backoff() {
+    this->connection_attempts = 1;
+    std::shared_ptr<ReconnectScheduler> scheduler;
+    {
+        std::lock_guard<std::mutex> lk(this->reconnect_mutex);
+        scheduler = this->reconnect_scheduler;
     }
-
-    this->reconnect_backoff_ms = this->reconnect_backoff_ms * 2 + (random_number * 1000);
-    return this->reconnect_backoff_ms;
+    scheduler->on_connected(this->reconnect_profile);
 }
 
 void WebsocketBase::cancel_reconnect_timer() {
@@ -172,6 +176,16 @@ void WebsocketBase::set_authorization_key(const std::string& authorization_key)
     this->connection_options.authorization_key = authorization_key;
 }
 
+void WebsocketBase::set_reconnect_scheduler(std::shared_ptr<ReconnectScheduler> scheduler, const int32_t profile) {
+    if (scheduler == nullptr) {
+        EVLOG_error << "Cannot use an empty reconnect scheduler";
+        return;
+    }
+    std::lock_guard<std::mutex> lk(this->reconnect_mutex);
+    this->reconnect_scheduler = scheduler;
+    this->reconnect_profile = profile;
+}
+
 void WebsocketBase::on_pong_timeout(std::string msg) {
     if (!this->reconnecting) {
         EVLOG_info << "Reconnecting because of a pong timeout after " << this->connection_options.pong_timeout_s << "s";
@@ -180,4 +194,65 @@ void WebsocketBase::on_pong_timeout(std::string msg) {
     }
 }
 
+void WebsocketBase::record_receive_latency(const std::chrono::steady_clock::time_point received_at) {
+    const auto latency = std::chrono::steady_clock::now() - received_at;
+    std::lock_guard<std::mutex> lk(this->receive_latency_mutex);
+    this->receive_latency_statistics.received += 1;
+    this->receive_latency_statistics.total_latency += latency;
+    this->receive_latency_statistics.max_latency = std::max(this->receive_latency_statistics.max_latency, latency);
+}
+
+WebsocketReceiveLatencyStatistics WebsocketBase::get_receive_latency_statistics() {
+    std::lock_guard<std::mutex> lk(this->receive_latency_mutex);
+    return this->receive_latency_statistics;
+}
+
+void WebsocketBase::record_message(const bool sent) {
+    std::lock_guard<std::mutex> lk(this->compression_statistics_mutex);
+    if (sent) {
+        this->compression_statistics.messages_sent += 1;
+    } else {
+        this->compression_statistics.messages_received += 1;
+    }
+}
+
+void WebsocketBase::record_compression(const bool sent, const size_t payload_bytes, const size_t wire_bytes,
+                                       const std::chrono::steady_clock::duration duration) {
+    std::lock_guard<std::mutex> lk(this->compression_statistics_mutex);
+    if (sent) {
+        this->compression_statistics.payload_bytes_sent += payload_bytes;
+        this->compression_statistics.wire_bytes_sent += wire_bytes;
+        this->compression_statistics.compression_time += duration;
+    } else {
+        this->compression_statistics.payload_bytes_received += payload_bytes;
+        this->compression_statistics.wire_bytes_received += wire_bytes;
+        this->compression_statistics.decompression_time += duration;
+    }
+}
+
+WebsocketCompressionStatistics WebsocketBase::get_compression_statistics() {
+    std::lock_guard<std::mutex> lk(this->compression_statistics_mutex);
+    return this->compression_statistics;
+}
+
+void WebsocketBase::record_tls_handshake(const bool resumed, const std::chrono::steady_clock::duration duration) {
+    std::lock_guard<std::mutex> lk(this->tls_statistics_mutex);
+    this->tls_statistics.handshakes += 1;
+    if (resumed) {
+        this->tls_statistics.resumed_handshakes += 1;
+    }
+    this->tls_statistics.total_handshake_time += duration;
+    this->tls_statistics.max_handshake_time = std::max(this->tls_statistics.max_handshake_time, duration);
+}
+
+void WebsocketBase::record_tls_context_load() {
+    std::lock_guard<std::mutex> lk(this->tls_statistics_mutex);
+    this->tls_statistics.context_loads += 1;
+}
+
+WebsocketTlsStatistics WebsocketBase::get_tls_statistics() {
+    std::lock_guard<std::mutex> lk(this->tls_statistics_mutex);
+    return this->tls_statistics;
+}
+
 } // namespace ocpp
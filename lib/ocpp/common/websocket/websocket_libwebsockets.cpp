@@ -2,16 +2,23 @@
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
 #include <evse_security/crypto/openssl/openssl_provider.hpp>
 #include <ocpp/common/websocket/websocket_libwebsockets.hpp>
+#include <ocpp/common/websocket/websocket_message_pool.hpp>
 
 #include <everest/logging.hpp>
 
 #include <libwebsockets.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <openssl/opensslv.h>
 #include <openssl/ssl.h>
@@ -68,6 +75,12 @@ enum class EConnectionState {
 /// \brief Message to return in the callback to close the socket connection
 static constexpr int LWS_CLOSE_SOCKET_RESPONSE_MESSAGE = -1;
 
+/// \brief Maximum number of buffers of processed received messages that are kept for reuse
+static constexpr size_t MAX_SPARE_RECEIVE_BUFFERS = 4;
+
+/// \brief Maximum time a probe of the CSMS waits for the TCP connection while a reconnect is pending
+static constexpr std::chrono::milliseconds MAX_RECONNECT_PROBE_TIMEOUT(5000);
+
 /// \brief Per thread connection data
 struct ConnectionData {
     ConnectionData() :
@@ -131,8 +144,11 @@ struct ConnectionData {
 
 public:
     // This public block will only be used from client loop thread, no locking needed
-    // Openssl context, must be destroyed in this order
-    std::unique_ptr<SSL_CTX> sec_context;
+    // Extensions offered to the server, referenced by the libwebsockets context
+    std::string permessage_deflate_offer;
+    lws_extension extensions[2];
+    // Openssl context, shared with the TLS context cache of the owner, must be destroyed after the libwebsockets state
+    std::shared_ptr<SSL_CTX> sec_context;
     // libwebsockets state
     std::unique_ptr<lws_context> lws_ctx;
 
@@ -148,25 +164,132 @@ private:
     std::atomic<EConnectionState> state;
 };
 
-struct WebsocketMessage {
-    WebsocketMessage() : sent_bytes(0), message_sent(false) {
+/// \brief Identifies a file by its resolved path and the time of its last modification
+struct FileVersion {
+    std::filesystem::path path;
+    std::filesystem::file_time_type last_write_time;
+
+    static FileVersion of(const std::string& path) {
+        if (path.empty()) {
+            return {};
+        }
+        std::error_code ec;
+        FileVersion version{std::filesystem::weakly_canonical(path, ec), std::filesystem::file_time_type::min()};
+        if (ec) {
+            version.path = path;
+        }
+        const auto last_write_time = std::filesystem::last_write_time(version.path, ec);
+        if (!ec) {
+            version.last_write_time = last_write_time;
+        }
+        return version;
     }
 
-    virtual ~WebsocketMessage() {
+    bool operator==(const FileVersion& other) const {
+        return path == other.path and last_write_time == other.last_write_time;
     }
+};
 
-public:
-    std::string payload;
-    lws_write_protocol protocol;
-
-    // How many bytes we have sent to libwebsockets, does not
-    // necessarily mean that all bytes have been sent over the wire,
-    // just that these were sent to libwebsockets
-    size_t sent_bytes;
-    // If libwebsockets has sent all the bytes through the wire
-    std::atomic_bool message_sent;
+/// \brief Everything a TLS context is created from, the context is created again when any of it changes
+struct TlsContextKey {
+    int security_profile = 0;
+    FileVersion certificate_chain;
+    FileVersion private_key;
+    FileVersion verify_file;
+    std::string supported_ciphers_12;
+    std::string supported_ciphers_13;
+    bool use_ssl_default_verify_paths = false;
+    std::optional<std::filesystem::path> keylog_file;
+
+    bool operator==(const TlsContextKey& other) const {
+        return security_profile == other.security_profile and certificate_chain == other.certificate_chain and
+               private_key == other.private_key and verify_file == other.verify_file and
+               supported_ciphers_12 == other.supported_ciphers_12 and
+               supported_ciphers_13 == other.supported_ciphers_13 and
+               use_ssl_default_verify_paths == other.use_ssl_default_verify_paths and
+               keylog_file == other.keylog_file;
+    }
 };
 
+/// \brief TLS context that is kept across reconnects, so that certificates and keys are only loaded again when they
+/// changed. Also keeps the session of the last connection, so that the next handshake with the same CSMS can resume it
+/// (with a TLS 1.3 session ticket or a TLS 1.2 session ID or ticket). Only used from the client loop thread
+struct TlsContextCache {
+    explicit TlsContextCache(WebsocketTlsTPM* owner) : owner(owner) {
+    }
+
+    ~TlsContextCache() {
+        clear_session();
+    }
+
+    void reset(const TlsContextKey& key, std::shared_ptr<SSL_CTX> context) {
+        this->key = key;
+        this->context = std::move(context);
+        clear_session();
+    }
+
+    void clear_session() {
+        if (this->session != nullptr) {
+            SSL_SESSION_free(this->session);
+            this->session = nullptr;
+        }
+        this->session_peer.clear();
+    }
+
+    WebsocketTlsTPM* owner;
+    TlsContextKey key;
+    std::shared_ptr<SSL_CTX> context;
+
+    // Session of the last connection and the peer it has been established with
+    SSL_SESSION* session = nullptr;
+    std::string session_peer;
+
+    // Peer of the connection that is currently established
+    std::string peer;
+    std::optional<std::chrono::steady_clock::time_point> handshake_started_at;
+};
+
+static TlsContextCache* get_tls_context_cache(const SSL* ssl) {
+    return static_cast<TlsContextCache*>(SSL_CTX_get_app_data(SSL_get_SSL_CTX(ssl)));
+}
+
+/// \brief Called by OpenSSL when the server issued a session that can be resumed, a TLS 1.3 server may issue several
+static int tls_new_session_callback(SSL* ssl, SSL_SESSION* session) {
+    auto* cache = get_tls_context_cache(ssl);
+    if (cache == nullptr) {
+        return 0;
+    }
+
+    cache->clear_session();
+    cache->session = session;
+    cache->session_peer = cache->peer;
+
+    // Returning 1 takes the ownership of the session
+    return 1;
+}
+
+static void tls_info_callback(const SSL* ssl, int where, int ret) {
+    auto* cache = get_tls_context_cache(ssl);
+    if (cache == nullptr) {
+        return;
+    }
+
+    if (where & SSL_CB_HANDSHAKE_START) {
+        cache->handshake_started_at = std::chrono::steady_clock::now();
+
+        // libwebsockets offers no callback between creating the SSL object and starting the handshake, so the session
+        // to resume is set here, before the ClientHello is constructed
+        if (cache->session != nullptr and cache->session_peer == cache->peer and SSL_get_session(ssl) == nullptr and
+            SSL_SESSION_is_resumable(cache->session)) {
+            SSL_set_session(const_cast<SSL*>(ssl), cache->session);
+        }
+    } else if ((where & SSL_CB_HANDSHAKE_DONE) and cache->handshake_started_at.has_value()) {
+        const auto duration = std::chrono::steady_clock::now() - cache->handshake_started_at.value();
+        cache->handshake_started_at.reset();
+        cache->owner->on_tls_handshake(SSL_session_reused(ssl) == 1, duration);
+    }
+}
+
 static bool verify_csms_cn(const std::string& hostname, bool preverified, const X509_STORE_CTX* ctx,
                            bool allow_wildcards) {
 
@@ -233,7 +356,11 @@ static bool verify_csms_cn(const std::string& hostname, bool preverified, const
 
 WebsocketTlsTPM::WebsocketTlsTPM(const WebsocketConnectionOptions& connection_options,
                                  std::shared_ptr<EvseSecurity> evse_security) :
-    WebsocketBase(), evse_security(evse_security), stop_deferred_handler(false) {
+    WebsocketBase(),
+    evse_security(evse_security),
+    tls_context_cache(std::make_unique<TlsContextCache>(this)),
+    message_pool(std::make_unique<WebsocketMessagePool>()),
+    stop_deferred_handler(false) {
 
     set_connection_options(connection_options);
 
@@ -317,6 +444,40 @@ constexpr auto local_protocol_name = "lws-everest-client";
 static const struct lws_protocols protocols[] = {{local_protocol_name, callback_minimal, 0, 0, 0, NULL, 0},
                                                  LWS_PROTOCOL_LIST_TERM};
 
+#ifndef LWS_WITHOUT_EXTENSIONS
+/// \brief Forwards to the permessage-deflate extension of libwebsockets and records the sizes of the compressed and
+/// decompressed payload and the time this took
+static int callback_permessage_deflate(lws_context* context, const lws_extension* ext, lws* wsi,
+                                       lws_extension_callback_reasons reason, void* user, void* in, size_t len) {
+    if (reason != LWS_EXT_CB_PAYLOAD_TX and reason != LWS_EXT_CB_PAYLOAD_RX) {
+        return lws_extension_callback_pm_deflate(context, ext, wsi, reason, user, in, len);
+    }
+
+    auto* pmdrx = reinterpret_cast<lws_ext_pm_deflate_rx_ebufs*>(in);
+    const int input_len = pmdrx->eb_in.len;
+
+    const auto start = std::chrono::steady_clock::now();
+    const int result = lws_extension_callback_pm_deflate(context, ext, wsi, reason, user, in, len);
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    // eb_in is updated to what has not been consumed, eb_out refers to what has been produced
+    const size_t consumed = input_len > pmdrx->eb_in.len ? input_len - pmdrx->eb_in.len : 0;
+    const size_t produced = pmdrx->eb_out.len > 0 ? pmdrx->eb_out.len : 0;
+
+    if (ConnectionData* data = reinterpret_cast<ConnectionData*>(lws_wsi_user(wsi))) {
+        if (auto owner = data->get_owner()) {
+            if (reason == LWS_EXT_CB_PAYLOAD_TX) {
+                owner->on_permessage_deflate(true, consumed, produced, duration);
+            } else {
+                owner->on_permessage_deflate(false, produced, consumed, duration);
+            }
+        }
+    }
+
+    return result;
+}
+#endif
+
 bool WebsocketTlsTPM::tls_init(SSL_CTX* ctx, const std::string& path_chain, const std::string& path_key,
                                bool custom_key, std::optional<std::string>& password) {
     auto rc = SSL_CTX_set_cipher_list(ctx, this->connection_options.supported_ciphers_12.c_str());
@@ -354,7 +515,13 @@ bool WebsocketTlsTPM::tls_init(SSL_CTX* ctx, const std::string& path_chain, cons
             SSL_CTX_set_default_passwd_cb(ctx, private_key_callback);
         }
 
-        if (1 != SSL_CTX_use_PrivateKey_file(ctx, path_key.c_str(), SSL_FILETYPE_PEM)) {
+        const auto key_loaded = SSL_CTX_use_PrivateKey_file(ctx, path_key.c_str(), SSL_FILETYPE_PEM);
+
+        // The password is only needed for loading the key, the context outlives it
+        SSL_CTX_set_default_passwd_cb(ctx, nullptr);
+        SSL_CTX_set_default_passwd_cb_userdata(ctx, nullptr);
+
+        if (1 != key_loaded) {
             ERR_print_errors_fp(stderr);
             EVLOG_error << "Could not set private key file within SSL context";
 
@@ -438,22 +605,33 @@ void WebsocketTlsTPM::recv_loop() {
 
     EVLOG_debug << "Init recv loop with ID: " << std::hex << std::this_thread::get_id();
 
+    std::string message{};
+
     while (!local_data->is_interupted()) {
         // Process all messages
         while (true) {
-            std::string message{};
+            std::chrono::steady_clock::time_point received_at;
 
             {
                 std::lock_guard lk(this->recv_mutex);
+                // Hand the buffer of the previous message back, so that the next messages can be assembled into it
+                if (message.capacity() > 0 and recv_spare_buffers.size() < MAX_SPARE_RECEIVE_BUFFERS) {
+                    message.clear();
+                    recv_spare_buffers.push_back(std::move(message));
+                    message = std::string{};
+                }
+
                 if (recv_message_queue.empty())
                     break;
 
-                message = std::move(recv_message_queue.front());
+                message = std::move(recv_message_queue.front().first);
+                received_at = recv_message_queue.front().second;
                 recv_message_queue.pop();
             }
 
             // Invoke our processing callback, that might trigger a send back that
             // can cause a deadlock if is not managed on a different thread
+            this->record_receive_latency(received_at);
             this->message_callback(message);
         }
 
@@ -502,6 +680,27 @@ void WebsocketTlsTPM::client_loop() {
 
     info.fd_limit_per_thread = 1 + 1 + 1;
 
+    if (this->connection_options.enable_permessage_deflate) {
+#ifndef LWS_WITHOUT_EXTENSIONS
+        const int window_bits = std::clamp(this->connection_options.permessage_deflate_window_bits, 9, 15);
+
+        // Ask the server for the window size as well, since it determines the memory needed for decompression
+        local_data->permessage_deflate_offer = "permessage-deflate; client_max_window_bits";
+        if (window_bits < 15) {
+            local_data->permessage_deflate_offer = "permessage-deflate; client_max_window_bits=" +
+                                                   std::to_string(window_bits) +
+                                                   "; server_max_window_bits=" + std::to_string(window_bits);
+        }
+
+        local_data->extensions[0] = {"permessage-deflate", callback_permessage_deflate,
+                                     local_data->permessage_deflate_offer.c_str()};
+        local_data->extensions[1] = {nullptr, nullptr, nullptr};
+        info.extensions = local_data->extensions;
+#else
+        EVLOG_warning << "permessage-deflate is enabled, but libwebsockets has been built without extension support";
+#endif
+    }
+
     // Lifetime of this is important since we use the data from this in private_key_callback()
     std::optional<std::string> private_key_password;
 
@@ -547,59 +746,93 @@ void WebsocketTlsTPM::client_loop() {
             private_key_password = certificate_info.password;
         }
 
-        SSL_CTX* ssl_ctx = nullptr;
-        bool custom_key = false;
-
-        if (!path_key.empty()) {
-            custom_key = is_custom_private_key_file(path_key);
+        TlsContextKey key;
+        key.security_profile = this->connection_options.security_profile;
+        key.certificate_chain = FileVersion::of(path_chain);
+        key.private_key = FileVersion::of(path_key);
+        if (this->evse_security->is_ca_certificate_installed(ocpp::CaCertificateType::CSMS)) {
+            key.verify_file = FileVersion::of(this->evse_security->get_verify_file(ocpp::CaCertificateType::CSMS));
+        }
+        key.supported_ciphers_12 = this->connection_options.supported_ciphers_12;
+        key.supported_ciphers_13 = this->connection_options.supported_ciphers_13;
+        key.use_ssl_default_verify_paths = this->connection_options.use_ssl_default_verify_paths;
+        if (this->connection_options.enable_tls_keylog) {
+            key.keylog_file = this->connection_options.keylog_file;
         }
 
-        OpenSSLProvider provider;
+        // The context is kept across reconnects and only created again if the certificates, keys or settings changed
+        if (this->tls_context_cache->context == nullptr or !(this->tls_context_cache->key == key)) {
+            bool custom_key = false;
 
-        if (custom_key) {
-            provider.set_tls_mode(OpenSSLProvider::mode_t::custom_provider);
-        } else {
-            provider.set_tls_mode(OpenSSLProvider::mode_t::default_provider);
-        }
+            if (!path_key.empty()) {
+                custom_key = is_custom_private_key_file(path_key);
+            }
 
-        const SSL_METHOD* method = SSLv23_client_method();
-        ssl_ctx = SSL_CTX_new_ex(provider, provider.propquery_tls_str(), method);
+            OpenSSLProvider provider;
 
-        if (ssl_ctx == nullptr) {
-            ERR_print_errors_fp(stderr);
-            EVLOG_error << "Unable to create ssl ctx";
+            if (custom_key) {
+                provider.set_tls_mode(OpenSSLProvider::mode_t::custom_provider);
+            } else {
+                provider.set_tls_mode(OpenSSLProvider::mode_t::default_provider);
+            }
 
-            local_data->update_state(EConnectionState::ERROR);
-            on_conn_fail();
+            const SSL_METHOD* method = SSLv23_client_method();
+            std::unique_ptr<SSL_CTX> ssl_ctx(SSL_CTX_new_ex(provider, provider.propquery_tls_str(), method));
 
-            // Notify conn waiter
-            conn_cv.notify_one();
-            return;
-        }
+            if (ssl_ctx == nullptr) {
+                ERR_print_errors_fp(stderr);
+                EVLOG_error << "Unable to create ssl ctx";
 
-        if (this->connection_options.enable_tls_keylog and this->connection_options.keylog_file.has_value()) {
-            EVLOG_info << "Logging TLS secrets to: " << this->connection_options.keylog_file.value().string();
-            keylog_file = this->connection_options.keylog_file;
-            SSL_CTX_set_keylog_callback(ssl_ctx, keylog_callback);
-        }
+                local_data->update_state(EConnectionState::ERROR);
+                on_conn_fail();
+
+                // Notify conn waiter
+                conn_cv.notify_one();
+                return;
+            }
+
+            if (this->connection_options.enable_tls_keylog and this->connection_options.keylog_file.has_value()) {
+                EVLOG_info << "Logging TLS secrets to: " << this->connection_options.keylog_file.value().string();
+                keylog_file = this->connection_options.keylog_file;
+                SSL_CTX_set_keylog_callback(ssl_ctx.get(), keylog_callback);
+            }
 
-        // Init TLS data
-        if (tls_init(ssl_ctx, path_chain, path_key, custom_key, private_key_password) == false) {
-            EVLOG_error << "Unable to init tls";
+            // Init TLS data
+            if (tls_init(ssl_ctx.get(), path_chain, path_key, custom_key, private_key_password) == false) {
+                EVLOG_error << "Unable to init tls";
 
-            local_data->update_state(EConnectionState::ERROR);
-            on_conn_fail();
+                local_data->update_state(EConnectionState::ERROR);
+                on_conn_fail();
 
-            // Notify conn waiter
-            conn_cv.notify_one();
-            return;
+                // Notify conn waiter
+                conn_cv.notify_one();
+                return;
+            }
+
+            // Sessions are handed to the cache, which offers them for resumption on the next connection
+            SSL_CTX_set_session_cache_mode(ssl_ctx.get(), SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+            SSL_CTX_sess_set_new_cb(ssl_ctx.get(), tls_new_session_callback);
+            SSL_CTX_set_info_callback(ssl_ctx.get(), tls_info_callback);
+            SSL_CTX_set_app_data(ssl_ctx.get(), this->tls_context_cache.get());
+
+            this->tls_context_cache->reset(key, std::shared_ptr<SSL_CTX>(std::move(ssl_ctx)));
+            this->record_tls_context_load();
+        } else {
+            EVLOG_debug << "Reusing TLS context of the previous connection";
         }
 
+        // A session is only resumed with the server it has been established with
+        this->tls_context_cache->peer = this->connection_options.csms_uri.get_hostname() + ":" +
+                                        std::to_string(this->connection_options.csms_uri.get_port()) + ":" +
+                                        std::to_string(this->connection_options.verify_csms_common_name) +
+                                        std::to_string(this->connection_options.verify_csms_allow_wildcards);
+        this->tls_context_cache->handshake_started_at.reset();
+
         // Setup our context
-        info.provided_client_ssl_ctx = ssl_ctx;
+        info.provided_client_ssl_ctx = this->tls_context_cache->context.get();
 
-        // Connection acquire the contexts
-        local_data->sec_context = std::unique_ptr<SSL_CTX>(ssl_ctx);
+        // Connection shares the context with the cache
+        local_data->sec_context = this->tls_context_cache->context;
     }
 
     lws_context* lws_ctx = lws_create_context(&info);
@@ -724,6 +957,7 @@ bool WebsocketTlsTPM::connect() {
         // Awake the receiving message thread to finish
         recv_message_cv.notify_one();
         this->recv_message_thread->join();
+        this->recv_message_thread.reset();
     }
 
     if (this->deferred_callback_thread == nullptr) {
@@ -746,7 +980,7 @@ bool WebsocketTlsTPM::connect() {
 
     {
         std::lock_guard<std::mutex> lock(recv_mutex);
-        std::queue<std::string> empty;
+        std::queue<std::pair<std::string, std::chrono::steady_clock::time_point>> empty;
         empty.swap(recv_message_queue);
     }
 
@@ -775,7 +1009,11 @@ bool WebsocketTlsTPM::connect() {
         // will send back another message, and since we're waiting for that message to be
         // sent over the wire on the client_loop, not giving the opportunity to the loop to
         // advance we will have a dead-lock
-        this->recv_message_thread.reset(new std::thread(&WebsocketTlsTPM::recv_loop, this));
+        // With the single threaded event loop sending does not wait for the loop, so received messages are
+        // dispatched from it directly
+        if (!this->connection_options.use_single_threaded_event_loop) {
+            this->recv_message_thread.reset(new std::thread(&WebsocketTlsTPM::recv_loop, this));
+        }
 
         // Wait until connect or timeout
         timeouted = !conn_cv.wait_for(lock, std::chrono::seconds(60), [&]() {
@@ -825,6 +1063,15 @@ void WebsocketTlsTPM::reconnect(long delay) {
 
     {
         std::lock_guard<std::mutex> lk(this->reconnect_mutex);
+        this->schedule_reconnect(std::chrono::steady_clock::now() + std::chrono::milliseconds(delay));
+    }
+}
+
+void WebsocketTlsTPM::schedule_reconnect(const std::chrono::steady_clock::time_point reconnect_at) {
+    const auto remaining = reconnect_at - std::chrono::steady_clock::now();
+    const std::chrono::seconds probe_interval(this->connection_options.reconnect_probe_interval_s);
+
+    if (probe_interval.count() <= 0 or remaining <= probe_interval) {
         this->reconnect_timer_tpm.timeout(
             [this]() {
                 if (this->reconnect_callback) {
@@ -833,8 +1080,38 @@ void WebsocketTlsTPM::reconnect(long delay) {
                     EVLOG_error << "Invalid reconnect callback!";
                 }
             },
-            std::chrono::milliseconds(delay));
+            std::chrono::duration_cast<std::chrono::milliseconds>(remaining));
+        return;
     }
+
+    // Probe the CSMS in between, so that the reconnect can happen as soon as it is reachable again
+    this->reconnect_timer_tpm.timeout([this, reconnect_at]() { this->on_reconnect_probe(reconnect_at); },
+                                      probe_interval);
+}
+
+void WebsocketTlsTPM::on_reconnect_probe(const std::chrono::steady_clock::time_point reconnect_at) {
+    if (this->shutting_down) {
+        return;
+    }
+
+    auto uri = this->connection_options.csms_uri;
+    const auto probe_timeout = std::min<std::chrono::milliseconds>(
+        std::chrono::seconds(this->connection_options.reconnect_probe_interval_s), MAX_RECONNECT_PROBE_TIMEOUT);
+    const bool reachable = ReconnectScheduler::probe(uri.get_hostname(), uri.get_port(), probe_timeout);
+
+    std::lock_guard<std::mutex> lk(this->reconnect_mutex);
+    if (!reachable) {
+        this->schedule_reconnect(reconnect_at);
+        return;
+    }
+
+    const auto remaining =
+        std::chrono::duration_cast<std::chrono::milliseconds>(reconnect_at - std::chrono::steady_clock::now());
+    const auto delay = this->reconnect_scheduler->probe_success_delay(
+        this->reconnect_profile, this->get_reconnect_backoff_parameters(), remaining);
+    EVLOG_info << "CSMS is reachable again, reconnecting in: " << delay.count() << "ms instead of "
+               << remaining.count() << "ms";
+    this->schedule_reconnect(std::chrono::steady_clock::now() + delay);
 }
 
 void WebsocketTlsTPM::close(const WebsocketCloseReason code, const std::string& reason) {
@@ -880,12 +1157,13 @@ void WebsocketTlsTPM::close(const WebsocketCloseReason code, const std::string&
 void WebsocketTlsTPM::on_conn_connected() {
     EVLOG_info << "OCPP client successfully connected to server";
 
-    this->connection_attempts = 1; // reset connection attempts
+    this->reset_reconnect_backoff();
     this->m_is_connected = true;
     this->reconnecting = false;
 
     // Clear any irrelevant data after a DC
     recv_buffered_message.clear();
+    recv_discarding_message = false;
 
     this->push_deferred_callback([this]() {
         if (connected_callback) {
@@ -953,34 +1231,42 @@ void WebsocketTlsTPM::on_conn_fail() {
     }
 }
 
-void WebsocketTlsTPM::on_message(std::string&& message) {
+void WebsocketTlsTPM::on_message() {
     if (!this->initialized()) {
         EVLOG_error << "Message received but TLS websocket has not been correctly initialized. Discarding message.";
+        recv_buffered_message.clear();
         return;
     }
 
-    EVLOG_debug << "Received message over TLS websocket polling for process: " << message;
+    EVLOG_debug << "Received message over TLS websocket polling for process: " << recv_buffered_message;
+
+    const auto received_at = std::chrono::steady_clock::now();
+    this->record_message(false);
+
+    if (this->connection_options.use_single_threaded_event_loop) {
+        this->record_receive_latency(received_at);
+        this->message_callback(recv_buffered_message);
+        recv_buffered_message.clear();
+        return;
+    }
 
     {
         std::lock_guard<std::mutex> lock(this->recv_mutex);
-        recv_message_queue.push(std::move(message));
+        // Continue with a spare buffer, so that neither queueing nor assembling the next message allocates
+        std::string message;
+        if (!recv_spare_buffers.empty()) {
+            message = std::move(recv_spare_buffers.back());
+            recv_spare_buffers.pop_back();
+        }
+        message.swap(recv_buffered_message);
+        recv_message_queue.emplace(std::move(message), received_at);
     }
 
     recv_message_cv.notify_one();
 }
 
 static bool send_internal(lws* wsi, WebsocketMessage* msg) {
-    static std::vector<char> buff;
-
-    std::string& message = msg->payload;
-    size_t message_len = message.length();
-    size_t buff_req_size = message_len + LWS_PRE;
-
-    if (buff.size() < buff_req_size)
-        buff.resize(buff_req_size);
-
-    // Copy data in send buffer
-    memcpy(&buff[LWS_PRE], message.data(), message_len);
+    size_t message_len = msg->payload_length;
 
     // TODO (ioan): if we require certain sending over the wire,
     // we'll have to send chunked manually something like this:
@@ -992,7 +1278,8 @@ static bool send_internal(lws* wsi, WebsocketMessage* msg) {
     // int flags = lws_write_ws_flags(proto, is_start, is_end);
     // already_written += lws_write(wsi, buff + LWS_PRE, BUFF_SIZE - LWS_PRE, flags);
 
-    auto sent = lws_write(wsi, reinterpret_cast<unsigned char*>(&buff[LWS_PRE]), message_len, msg->protocol);
+    // The message buffer already contains the LWS_PRE padding, so it is written without another copy
+    auto sent = lws_write(wsi, msg->payload_data(), message_len, msg->protocol);
 
     if (sent < 0) {
         // Fatal error, conn closed
@@ -1054,7 +1341,7 @@ void WebsocketTlsTPM::on_writable() {
         }
 
         // This message was polled in a previous iteration
-        if (message->sent_bytes >= message->payload.length()) {
+        if (message->sent_bytes >= message->payload_length) {
             EVLOG_debug << "Websocket message fully written, popping processing thread from queue!";
 
             // If we have written all bytes to libwebsockets it means that if we received
@@ -1066,6 +1353,10 @@ void WebsocketTlsTPM::on_writable() {
                 message_queue.pop();
             }
 
+            if (message->protocol == LWS_WRITE_TEXT) {
+                this->record_message(true);
+            }
+
             EVLOG_debug << "Notifying waiting thread!";
             // Notify any waiting thread to check it's state
             msg_send_cv.notify_all();
@@ -1099,7 +1390,7 @@ void WebsocketTlsTPM::on_writable() {
             EVLOG_AND_THROW(std::runtime_error("Null message in queue, fatal error!"));
         }
 
-        if (message->sent_bytes >= message->payload.length()) {
+        if (message->sent_bytes >= message->payload_length) {
             EVLOG_AND_THROW(std::runtime_error("Already polled message should be handled above, fatal error!"));
         }
 
@@ -1128,29 +1419,33 @@ void WebsocketTlsTPM::request_write() {
     }
 }
 
-void WebsocketTlsTPM::poll_message(const std::shared_ptr<WebsocketMessage>& msg) {
+bool WebsocketTlsTPM::poll_message(const std::shared_ptr<WebsocketMessage>& msg) {
     if (this->m_is_connected == false) {
         EVLOG_debug << "Trying to poll message without being connected!";
-        return;
+        return false;
     }
 
+    const bool single_threaded = this->connection_options.use_single_threaded_event_loop;
+    bool from_lws_thread = false;
+
     std::shared_ptr<ConnectionData> local_data = conn_data;
 
     if (local_data != nullptr) {
         auto cd_tid = local_data->get_lws_thread_id();
+        from_lws_thread = std::this_thread::get_id() == cd_tid;
 
-        if (std::this_thread::get_id() == cd_tid) {
+        if (from_lws_thread and !single_threaded) {
             EVLOG_AND_THROW(std::runtime_error("Deadlock detected, polling send from client lws thread!"));
         }
 
         // If we are interupted or finalized
         if (local_data->is_interupted() || local_data->get_state() == EConnectionState::FINALIZED) {
             EVLOG_warning << "Trying to poll message to interrupted/finalized state!";
-            return;
+            return false;
         }
     }
 
-    EVLOG_debug << "Queueing message over TLS websocket: " << msg->payload;
+    EVLOG_debug << "Queueing message over TLS websocket: " << msg->payload();
 
     {
         std::lock_guard<std::mutex> lock(this->queue_mutex);
@@ -1158,7 +1453,18 @@ void WebsocketTlsTPM::poll_message(const std::shared_ptr<WebsocketMessage>& msg)
     }
 
     // Request a write callback
-    request_write();
+    if (from_lws_thread) {
+        // called from a callback of the service loop, which is allowed to request the writable callback directly
+        lws_callback_on_writable(local_data->get_conn());
+    } else {
+        request_write();
+    }
+
+    if (single_threaded) {
+        // Waiting here would block the caller on the service loop, which might wait for a lock the caller holds
+        // while dispatching a received message
+        return true;
+    }
 
     {
         std::unique_lock lock(this->msg_send_cv_mutex);
@@ -1168,6 +1474,8 @@ void WebsocketTlsTPM::poll_message(const std::shared_ptr<WebsocketMessage>& msg)
             EVLOG_warning << "Could not send last message over TLS websocket!";
         }
     }
+
+    return msg->message_sent;
 }
 
 // Will be called from external threads
@@ -1177,13 +1485,9 @@ bool WebsocketTlsTPM::send(const std::string& message) {
         return false;
     }
 
-    auto msg = std::make_shared<WebsocketMessage>();
-    msg->payload = std::move(message);
-    msg->protocol = LWS_WRITE_TEXT;
+    auto msg = this->message_pool->acquire(message, LWS_WRITE_TEXT);
 
-    poll_message(msg);
-
-    return msg->message_sent;
+    return poll_message(msg);
 }
 
 void WebsocketTlsTPM::ping() {
@@ -1191,9 +1495,7 @@ void WebsocketTlsTPM::ping() {
         EVLOG_error << "Could not send ping because websocket is not properly initialized.";
     }
 
-    auto msg = std::make_shared<WebsocketMessage>();
-    msg->payload = this->connection_options.ping_payload;
-    msg->protocol = LWS_WRITE_PING;
+    auto msg = this->message_pool->acquire(this->connection_options.ping_payload, LWS_WRITE_PING);
 
     poll_message(msg);
 }
@@ -1310,6 +1612,18 @@ int WebsocketTlsTPM::process_callback(void* wsi_ptr, int callback_reason, void*
 
         on_conn_connected();
 
+#ifndef LWS_WITHOUT_EXTENSIONS
+        if (this->connection_options.enable_permessage_deflate) {
+            // Fails if the server did not accept the extension, in which case messages are sent uncompressed
+            const auto compression_level =
+                std::to_string(std::clamp(this->connection_options.permessage_deflate_compression_level, 1, 9));
+            if (0 != lws_set_extension_option(wsi, "permessage-deflate", "compression_level",
+                                              compression_level.c_str())) {
+                EVLOG_info << "permessage-deflate has not been negotiated with the server";
+            }
+        }
+#endif
+
         // Attempt first write after connection
         lws_callback_on_writable(wsi);
         break;
@@ -1376,15 +1690,38 @@ int WebsocketTlsTPM::process_callback(void* wsi_ptr, int callback_reason, void*
         }
     } break;
 
-    case LWS_CALLBACK_CLIENT_RECEIVE:
-        recv_buffered_message.append(reinterpret_cast<char*>(in), reinterpret_cast<char*>(in) + len);
+    case LWS_CALLBACK_CLIENT_RECEIVE: {
+        const size_t remaining = lws_remaining_packet_payload(wsi);
+        const size_t max_size = this->connection_options.max_received_message_size;
 
-        // Message is complete
-        if (lws_remaining_packet_payload(wsi) <= 0) {
-            on_message(std::move(recv_buffered_message));
+        // The size of the remaining payload of the frame is known in advance, so oversized messages are rejected
+        // before they are buffered
+        if (!recv_discarding_message and max_size > 0 and recv_buffered_message.size() + len + remaining > max_size) {
+            EVLOG_error << "Discarding received message that exceeds the maximum message size of " << max_size
+                        << " bytes";
+            recv_discarding_message = true;
             recv_buffered_message.clear();
         }
 
+        if (!recv_discarding_message) {
+            // Grow at most once per frame, reserve is only called when it increases the capacity since it may shrink
+            // the buffer otherwise
+            const size_t required_size = recv_buffered_message.size() + len + remaining;
+            if (recv_buffered_message.capacity() < required_size) {
+                recv_buffered_message.reserve(required_size);
+            }
+            recv_buffered_message.append(reinterpret_cast<char*>(in), len);
+        }
+
+        // Message is complete
+        if (remaining == 0 and lws_is_final_fragment(wsi)) {
+            if (recv_discarding_message) {
+                recv_discarding_message = false;
+            } else {
+                on_message();
+            }
+        }
+
         {
             bool message_queue_empty;
             {
@@ -1395,7 +1732,7 @@ int WebsocketTlsTPM::process_callback(void* wsi_ptr, int callback_reason, void*
                 lws_callback_on_writable(data->get_conn());
             }
         }
-        break;
+    } break;
 
     case LWS_CALLBACK_EVENT_WAIT_CANCELLED: {
         bool message_queue_empty;
@@ -1428,6 +1765,18 @@ int WebsocketTlsTPM::process_callback(void* wsi_ptr, int callback_reason, void*
     return 0;
 }
 
+void WebsocketTlsTPM::on_permessage_deflate(const bool sent, const size_t payload_bytes, const size_t wire_bytes,
+                                            const std::chrono::steady_clock::duration duration) {
+    this->record_compression(sent, payload_bytes, wire_bytes, duration);
+}
+
+void WebsocketTlsTPM::on_tls_handshake(const bool resumed, const std::chrono::steady_clock::duration duration) {
+    EVLOG_debug << "TLS handshake completed in "
+                << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() << "ms"
+                << (resumed ? ", resumed previous session" : "");
+    this->record_tls_handshake(resumed, duration);
+}
+
 void WebsocketTlsTPM::push_deferred_callback(const std::function<void()>& callback) {
     if (!callback) {
         EVLOG_error << "Attempting to push stale callback in deferred queue!";
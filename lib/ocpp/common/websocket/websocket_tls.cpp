@@ -315,7 +315,7 @@ void WebsocketTLS::connect_tls() {
 void WebsocketTLS::on_open_tls(tls_client* c, websocketpp::connection_hdl hdl) {
     (void)c; // tls_client is not used in this function
     EVLOG_info << "OCPP client successfully connected to TLS websocket server";
-    this->connection_attempts = 1; // reset connection attempts
+    this->reset_reconnect_backoff();
     this->m_is_connected = true;
     this->reconnecting = false;
     this->set_websocket_ping_interval(this->connection_options.ping_interval_s);
@@ -341,7 +341,8 @@ std::vector<ChargingProfilePurposeType> ChargePointConfiguration::getSupportedCh
     std::vector<ChargingProfilePurposeType> supported_purpose_types;
     const auto str_list = this->config["Internal"]["SupportedChargingProfilePurposeTypes"];
     for (const auto& str : str_list) {
-        supported_purpose_types.push_back(conversions::string_to_charging_profile_purpose_type(str));
+        supported_purpose_types.push_back(
+            conversions::string_to_charging_profile_purpose_type(str.get_ref<const std::string&>()));
     }
     return supported_purpose_types;
 }
@@ -636,6 +637,18 @@ KeyValue ChargePointConfiguration::getMaxMessageSizeKeyValue() {
     return kv;
 }
 
+int ChargePointConfiguration::getMaxReceivedMessageSize() {
+    return this->config["Internal"]["MaxReceivedMessageSize"];
+}
+
+KeyValue ChargePointConfiguration::getMaxReceivedMessageSizeKeyValue() {
+    KeyValue kv;
+    kv.key = "MaxReceivedMessageSize";
+    kv.readonly = true;
+    kv.value.emplace(std::to_string(this->getMaxReceivedMessageSize()));
+    return kv;
+}
+
 bool ChargePointConfiguration::getEnableTLSKeylog() {
     return this->config["Internal"]["EnableTLSKeylog"];
 }
@@ -644,6 +657,22 @@ std::string ChargePointConfiguration::getTLSKeylogFile() {
     return this->config["Internal"]["TLSKeylogFile"];
 }
 
+bool ChargePointConfiguration::getWebsocketPermessageDeflate() {
+    return this->config["Internal"]["WebsocketPermessageDeflate"];
+}
+
+int ChargePointConfiguration::getWebsocketPermessageDeflateWindowBits() {
+    return this->config["Internal"]["WebsocketPermessageDeflateWindowBits"];
+}
+
+int ChargePointConfiguration::getWebsocketPermessageDeflateCompressionLevel() {
+    return this->config["Internal"]["WebsocketPermessageDeflateCompressionLevel"];
+}
+
+int ChargePointConfiguration::getReconnectProbeInterval() {
+    return this->config["Internal"]["ReconnectProbeInterval"];
+}
+
 KeyValue ChargePointConfiguration::getWebsocketPingPayloadKeyValue() {
     KeyValue kv;
     kv.key = "WebsocketPingPayload";
@@ -905,6 +934,169 @@ std::optional<KeyValue> ChargePointConfiguration::getMessageQueueSizeThresholdKe
     return message_queue_size_threshold_kv;
 }
 
+std::optional<int> ChargePointConfiguration::getMessageQueueMaxMessagesInFlight() {
+    std::optional<int> message_queue_max_messages_in_flight = std::nullopt;
+    if (this->config["Internal"].contains("MessageQueueMaxMessagesInFlight")) {
+        message_queue_max_messages_in_flight.emplace(this->config["Internal"]["MessageQueueMaxMessagesInFlight"]);
+    }
+    return message_queue_max_messages_in_flight;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getMessageQueueMaxMessagesInFlightKeyValue() {
+    std::optional<KeyValue> message_queue_max_messages_in_flight_kv = std::nullopt;
+    auto message_queue_max_messages_in_flight = this->getMessageQueueMaxMessagesInFlight();
+    if (message_queue_max_messages_in_flight.has_value()) {
+        KeyValue kv;
+        kv.key = "MessageQueueMaxMessagesInFlight";
+        kv.readonly = true;
+        kv.value.emplace(std::to_string(message_queue_max_messages_in_flight.value()));
+        message_queue_max_messages_in_flight_kv.emplace(kv);
+    }
+    return message_queue_max_messages_in_flight_kv;
+}
+
+std::optional<std::string> ChargePointConfiguration::getMessageQueueHighPriorityMessageTypes() {
+    if (this->config["Internal"].contains("MessageQueueHighPriorityMessageTypes")) {
+        return this->config["Internal"]["MessageQueueHighPriorityMessageTypes"];
+    }
+    return std::nullopt;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getMessageQueueHighPriorityMessageTypesKeyValue() {
+    std::optional<KeyValue> message_queue_high_priority_message_types_kv = std::nullopt;
+    auto message_queue_high_priority_message_types = this->getMessageQueueHighPriorityMessageTypes();
+    if (message_queue_high_priority_message_types.has_value()) {
+        KeyValue kv;
+        kv.key = "MessageQueueHighPriorityMessageTypes";
+        kv.readonly = true;
+        kv.value.emplace(message_queue_high_priority_message_types.value());
+        message_queue_high_priority_message_types_kv.emplace(kv);
+    }
+    return message_queue_high_priority_message_types_kv;
+}
+
+std::optional<std::string> ChargePointConfiguration::getMessageQueueCoalescedMessageTypes() {
+    if (this->config["Internal"].contains("MessageQueueCoalescedMessageTypes")) {
+        return this->config["Internal"]["MessageQueueCoalescedMessageTypes"];
+    }
+    return std::nullopt;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getMessageQueueCoalescedMessageTypesKeyValue() {
+    std::optional<KeyValue> message_queue_coalesced_message_types_kv = std::nullopt;
+    auto message_queue_coalesced_message_types = this->getMessageQueueCoalescedMessageTypes();
+    if (message_queue_coalesced_message_types.has_value()) {
+        KeyValue kv;
+        kv.key = "MessageQueueCoalescedMessageTypes";
+        kv.readonly = true;
+        kv.value.emplace(message_queue_coalesced_message_types.value());
+        message_queue_coalesced_message_types_kv.emplace(kv);
+    }
+    return message_queue_coalesced_message_types_kv;
+}
+
+std::optional<std::string> ChargePointConfiguration::getMessageQueueDirectlyDeserializedMessageTypes() {
+    if (this->config["Internal"].contains("MessageQueueDirectlyDeserializedMessageTypes")) {
+        return this->config["Internal"]["MessageQueueDirectlyDeserializedMessageTypes"];
+    }
+    return std::nullopt;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getMessageQueueDirectlyDeserializedMessageTypesKeyValue() {
+    std::optional<KeyValue> message_queue_directly_deserialized_message_types_kv = std::nullopt;
+    auto message_queue_directly_deserialized_message_types = this->getMessageQueueDirectlyDeserializedMessageTypes();
+    if (message_queue_directly_deserialized_message_types.has_value()) {
+        KeyValue kv;
+        kv.key = "MessageQueueDirectlyDeserializedMessageTypes";
+        kv.readonly = true;
+        kv.value.emplace(message_queue_directly_deserialized_message_types.value());
+        message_queue_directly_deserialized_message_types_kv.emplace(kv);
+    }
+    return message_queue_directly_deserialized_message_types_kv;
+}
+
+std::optional<std::string> ChargePointConfiguration::getMessageSchemasPath() {
+    if (this->config["Internal"].contains("MessageSchemasPath")) {
+        return this->config["Internal"]["MessageSchemasPath"];
+    }
+    return std::nullopt;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getMessageSchemasPathKeyValue() {
+    std::optional<KeyValue> message_schemas_path_kv = std::nullopt;
+    auto message_schemas_path = this->getMessageSchemasPath();
+    if (message_schemas_path.has_value()) {
+        KeyValue kv;
+        kv.key = "MessageSchemasPath";
+        kv.readonly = true;
+        kv.value.emplace(message_schemas_path.value());
+        message_schemas_path_kv.emplace(kv);
+    }
+    return message_schemas_path_kv;
+}
+
+std::optional<std::string> ChargePointConfiguration::getMessageQueueLowPriorityMessageTypes() {
+    if (this->config["Internal"].contains("MessageQueueLowPriorityMessageTypes")) {
+        return this->config["Internal"]["MessageQueueLowPriorityMessageTypes"];
+    }
+    return std::nullopt;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getMessageQueueLowPriorityMessageTypesKeyValue() {
+    std::optional<KeyValue> message_queue_low_priority_message_types_kv = std::nullopt;
+    auto message_queue_low_priority_message_types = this->getMessageQueueLowPriorityMessageTypes();
+    if (message_queue_low_priority_message_types.has_value()) {
+        KeyValue kv;
+        kv.key = "MessageQueueLowPriorityMessageTypes";
+        kv.readonly = true;
+        kv.value.emplace(message_queue_low_priority_message_types.value());
+        message_queue_low_priority_message_types_kv.emplace(kv);
+    }
+    return message_queue_low_priority_message_types_kv;
+}
+
+std::optional<bool> ChargePointConfiguration::getMessageQueueHighPriorityBeforeTransactionMessages() {
+    std::optional<bool> message_queue_high_priority_before_transaction_messages = std::nullopt;
+    if (this->config["Internal"].contains("MessageQueueHighPriorityBeforeTransactionMessages")) {
+        message_queue_high_priority_before_transaction_messages.emplace(this->config["Internal"]["MessageQueueHighPriorityBeforeTransactionMessages"]);
+    }
+    return message_queue_high_priority_before_transaction_messages;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getMessageQueueHighPriorityBeforeTransactionMessagesKeyValue() {
+    std::optional<KeyValue> message_queue_high_priority_before_transaction_messages_kv = std::nullopt;
+    auto message_queue_high_priority_before_transaction_messages = this->getMessageQueueHighPriorityBeforeTransactionMessages();
+    if (message_queue_high_priority_before_transaction_messages.has_value()) {
+        KeyValue kv;
+        kv.key = "MessageQueueHighPriorityBeforeTransactionMessages";
+        kv.readonly = true;
+        kv.value.emplace(ocpp::conversions::bool_to_string(message_queue_high_priority_before_transaction_messages.value()));
+        message_queue_high_priority_before_transaction_messages_kv.emplace(kv);
+    }
+    return message_queue_high_priority_before_transaction_messages_kv;
+}
+
+std::optional<bool> ChargePointConfiguration::getMessageQueueWeightedFairScheduling() {
+    std::optional<bool> message_queue_weighted_fair_scheduling = std::nullopt;
+    if (this->config["Internal"].contains("MessageQueueWeightedFairScheduling")) {
+        message_queue_weighted_fair_scheduling.emplace(this->config["Internal"]["MessageQueueWeightedFairScheduling"]);
+    }
+    return message_queue_weighted_fair_scheduling;
+}
+
+std::optional<KeyValue> ChargePointConfiguration::getMessageQueueWeightedFairSchedulingKeyValue() {
+    std::optional<KeyValue> message_queue_weighted_fair_scheduling_kv = std::nullopt;
+    auto message_queue_weighted_fair_scheduling = this->getMessageQueueWeightedFairScheduling();
+    if (message_queue_weighted_fair_scheduling.has_value()) {
+        KeyValue kv;
+        kv.key = "MessageQueueWeightedFairScheduling";
+        kv.readonly = true;
+        kv.value.emplace(ocpp::conversions::bool_to_string(message_queue_weighted_fair_scheduling.value()));
+        message_queue_weighted_fair_scheduling_kv.emplace(kv);
+    }
+    return message_queue_weighted_fair_scheduling_kv;
+}
+
 // Core Profile - optional
 std::optional<bool> ChargePointConfiguration::getAllowOfflineTxForUnknownId() {
     std::optional<bool> unknown_offline_auth = std::nullopt;
@@ -2888,6 +3080,9 @@ std::optional<KeyValue> ChargePointConfiguration::get(CiString<50> key) {
     if (key == "MaxMessageSize") {
         return this->getMaxMessageSizeKeyValue();
     }
+    if (key == "MaxReceivedMessageSize") {
+        return this->getMaxReceivedMessageSizeKeyValue();
+    }
     if (key == "QueueAllMessages") {
         return this->getQueueAllMessagesKeyValue();
     }
@@ -2897,6 +3092,30 @@ std::optional<KeyValue> ChargePointConfiguration::get(CiString<50> key) {
     if (key == "MessageQueueSizeThreshold") {
         return this->getMessageQueueSizeThresholdKeyValue();
     }
+    if (key == "MessageQueueMaxMessagesInFlight") {
+        return this->getMessageQueueMaxMessagesInFlightKeyValue();
+    }
+    if (key == "MessageQueueHighPriorityMessageTypes") {
+        return this->getMessageQueueHighPriorityMessageTypesKeyValue();
+    }
+    if (key == "MessageQueueCoalescedMessageTypes") {
+        return this->getMessageQueueCoalescedMessageTypesKeyValue();
+    }
+    if (key == "MessageQueueDirectlyDeserializedMessageTypes") {
+        return this->getMessageQueueDirectlyDeserializedMessageTypesKeyValue();
+    }
+    if (key == "MessageSchemasPath") {
+        return this->getMessageSchemasPathKeyValue();
+    }
+    if (key == "MessageQueueLowPriorityMessageTypes") {
+        return this->getMessageQueueLowPriorityMessageTypesKeyValue();
+    }
+    if (key == "MessageQueueHighPriorityBeforeTransactionMessages") {
+        return this->getMessageQueueHighPriorityBeforeTransactionMessagesKeyValue();
+    }
+    if (key == "MessageQueueWeightedFairScheduling") {
+        return this->getMessageQueueWeightedFairSchedulingKeyValue();
+    }
 
     // Core Profile
     if (key == "AllowOfflineTxForUnknownId") {
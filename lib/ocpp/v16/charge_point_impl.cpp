@@ -31,6 +31,8 @@ const auto OCSP_REQUEST_TIMER_INTERVAL = std::chrono::hours(12);
 const auto INITIAL_CERTIFICATE_REQUESTS_DELAY = std::chrono::seconds(60);
 const auto WEBSOCKET_INIT_DELAY = std::chrono::seconds(2);
 const auto DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD = 2E5;
+const auto DEFAULT_MESSAGE_QUEUE_MAX_MESSAGES_IN_FLIGHT = 1;
+const auto DEFAULT_MESSAGE_QUEUE_COALESCED_MESSAGE_TYPES = "StatusNotification";
 const auto DEFAULT_BOOT_NOTIFICATION_INTERVAL_S = 60; // fallback interval if BootNotification returns interval of 0.
 const auto DEFAULT_WAIT_FOR_FUTURE_TIMEOUT = std::chrono::seconds(60);
 const auto DEFAULT_PRICE_NUMBER_OF_DECIMALS = 3;
@@ -39,8 +41,9 @@ ChargePointImpl::ChargePointImpl(const std::string& config, const fs::path& shar
                                  const fs::path& user_config_path, const fs::path& database_path,
                                  const fs::path& sql_init_path, const fs::path& message_log_path,
                                  const std::shared_ptr<EvseSecurity> evse_security,
-                                 const std::optional<SecurityConfiguration> security_configuration) :
-    ocpp::ChargingStationBase(evse_security, security_configuration),
+                                 const std::optional<SecurityConfiguration> security_configuration,
+                                 std::shared_ptr<ChargingStationHost> host) :
+    ocpp::ChargingStationBase(evse_security, security_configuration, host),
     bootreason(BootReasonEnum::PowerUp),
     connection_state(ChargePointConnectionState::Disconnected),
     registration_status(RegistrationStatus::Pending),
@@ -50,16 +53,24 @@ ChargePointImpl::ChargePointImpl(const std::string& config, const fs::path& shar
     message_log_path(message_log_path.string()), // .string() for compatibility with boost::filesystem
     switch_security_profile_callback(nullptr) {
     this->configuration = std::make_shared<ocpp::v16::ChargePointConfiguration>(config, share_path, user_config_path);
+    this->reconnect_scheduler = std::make_shared<ReconnectScheduler>();
     this->heartbeat_timer = std::make_unique<Everest::SteadyTimer>(&this->io_service, [this]() { this->heartbeat(); });
     this->heartbeat_interval = this->configuration->getHeartbeatInterval();
     auto database_connection =
         std::make_unique<common::DatabaseConnection>(database_path / (this->configuration->getChargePointId() + ".db"));
     this->database_handler = std::make_shared<DatabaseHandler>(std::move(database_connection), sql_init_path,
                                                                this->configuration->getNumberOfConnectors());
+    this->database_handler->set_message_queue_flush_io_context(&this->io_service);
     this->database_handler->open_connection();
     this->transaction_handler = std::make_unique<TransactionHandler>(this->configuration->getNumberOfConnectors());
     this->external_notify = {v16::MessageType::StartTransactionResponse};
     this->message_queue = this->create_message_queue();
+    const auto message_schemas_path = this->configuration->getMessageSchemasPath();
+    if (message_schemas_path.has_value() and !message_schemas_path.value().empty()) {
+        this->message_schema_validator = std::make_unique<MessageSchemaValidator<v16::MessageType>>(
+            message_schemas_path.value(),
+            [](const std::string& action) { return conversions::string_to_messagetype(action); });
+    }
     auto log_formats = this->configuration->getLogMessagesFormat();
     bool log_to_console = std::find(log_formats.begin(), log_formats.end(), "console") != log_formats.end();
     bool detailed_log_to_console =
@@ -226,6 +237,40 @@ ChargePointImpl::ChargePointImpl(const std::string& config, const fs::path& shar
     }
 }
 
+ChargePointImpl::~ChargePointImpl() {
+    this->hold_io_service([this]() {
+        for (auto* timer : {this->boot_notification_timer.get(), this->heartbeat_timer.get(),
+                            this->ocsp_request_timer.get(), this->client_certificate_timer.get(),
+                            this->v2g_certificate_timer.get()}) {
+            if (timer != nullptr) {
+                timer->stop();
+            }
+        }
+        for (const auto& timer : this->status_notification_timers) {
+            timer->stop();
+        }
+        if (this->clock_aligned_meter_values_timer != nullptr) {
+            this->clock_aligned_meter_values_timer->stop();
+        }
+        if (this->change_time_offset_timer != nullptr) {
+            this->change_time_offset_timer->stop();
+        }
+        for (const auto& [id, connector] : this->connectors) {
+            if (connector->trigger_metervalue_at_time_timer != nullptr) {
+                connector->trigger_metervalue_at_time_timer->stop();
+            }
+            const auto transaction = this->transaction_handler->get_transaction(id);
+            if (transaction != nullptr) {
+                transaction->stop();
+            }
+        }
+        if (this->message_queue != nullptr) {
+            this->message_queue->stop_timers();
+        }
+        this->database_handler->stop_message_queue_flush_timer();
+    });
+}
+
 std::unique_ptr<ocpp::MessageQueue<v16::MessageType>> ChargePointImpl::create_message_queue() {
 
     // The StartTransaction.conf handler attempts to get the transaction based on the message id. The message id changes
@@ -265,14 +310,76 @@ std::unique_ptr<ocpp::MessageQueue<v16::MessageType>> ChargePointImpl::create_me
         }
     }
 
+    MessageQueueConfig<v16::MessageType> message_queue_config{
+        this->configuration->getTransactionMessageAttempts(),
+        this->configuration->getTransactionMessageRetryInterval(),
+        this->configuration->getMessageQueueSizeThreshold().value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
+        this->configuration->getQueueAllMessages().value_or(false), message_types_discard_for_queueing};
+    message_queue_config.max_messages_in_flight = this->configuration->getMessageQueueMaxMessagesInFlight().value_or(
+        DEFAULT_MESSAGE_QUEUE_MAX_MESSAGES_IN_FLIGHT);
+
+    const auto apply_scheduling_class = [&message_queue_config](const std::string& message_types_csl,
+                                                                const MessageSchedulingClass scheduling_class,
+                                                                const std::string& configuration_key) {
+        try {
+            for (const auto& element : ocpp::split_string(message_types_csl, ',')) {
+                message_queue_config.message_scheduling_classes[conversions::string_to_messagetype(element)] =
+                    scheduling_class;
+            }
+        } catch (const StringToEnumException& e) {
+            EVLOG_warning << "Could not convert configured MessageType value of " << configuration_key
+                          << ". Please check your configuration: " << e.what();
+        } catch (...) {
+            EVLOG_warning << "Could not apply " << configuration_key << " configuration";
+        }
+    };
+    apply_scheduling_class(this->configuration->getMessageQueueHighPriorityMessageTypes().value_or(""),
+                           MessageSchedulingClass::High, "MessageQueueHighPriorityMessageTypes");
+    apply_scheduling_class(this->configuration->getMessageQueueLowPriorityMessageTypes().value_or(""),
+                           MessageSchedulingClass::Low, "MessageQueueLowPriorityMessageTypes");
+    message_queue_config.high_priority_messages_before_transaction_messages =
+        this->configuration->getMessageQueueHighPriorityBeforeTransactionMessages().value_or(false);
+    message_queue_config.weighted_fair_scheduling =
+        this->configuration->getMessageQueueWeightedFairScheduling().value_or(false);
+
+    try {
+        const auto coalesced_message_types_csl = ocpp::split_string(
+            this->configuration->getMessageQueueCoalescedMessageTypes().value_or(
+                DEFAULT_MESSAGE_QUEUE_COALESCED_MESSAGE_TYPES),
+            ',');
+        std::transform(coalesced_message_types_csl.begin(), coalesced_message_types_csl.end(),
+                       std::inserter(message_queue_config.coalesced_message_types,
+                                     message_queue_config.coalesced_message_types.end()),
+                       [](const std::string element) { return conversions::string_to_messagetype(element); });
+    } catch (const StringToEnumException& e) {
+        EVLOG_warning << "Could not convert configured MessageType value of MessageQueueCoalescedMessageTypes. Please "
+                         "check your configuration: "
+                      << e.what();
+    } catch (...) {
+        EVLOG_warning << "Could not apply MessageQueueCoalescedMessageTypes configuration";
+    }
+
+    const auto directly_deserialized_message_types =
+        this->configuration->getMessageQueueDirectlyDeserializedMessageTypes();
+    if (directly_deserialized_message_types.has_value()) {
+        try {
+            const auto message_types_csl = ocpp::split_string(directly_deserialized_message_types.value(), ',');
+            std::transform(message_types_csl.begin(), message_types_csl.end(),
+                           std::inserter(message_queue_config.directly_deserialized_message_types,
+                                         message_queue_config.directly_deserialized_message_types.end()),
+                           [](const std::string element) { return conversions::string_to_messagetype(element); });
+        } catch (const StringToEnumException& e) {
+            EVLOG_warning << "Could not convert configured MessageType value of "
+                             "MessageQueueDirectlyDeserializedMessageTypes. Please check your configuration: "
+                          << e.what();
+        } catch (...) {
+            EVLOG_warning << "Could not apply MessageQueueDirectlyDeserializedMessageTypes configuration";
+        }
+    }
+
     return std::make_unique<ocpp::MessageQueue<v16::MessageType>>(
-        [this](json message) -> bool { return this->websocket->send(message.dump()); },
-        MessageQueueConfig<v16::MessageType>{
-            this->configuration->getTransactionMessageAttempts(),
-            this->configuration->getTransactionMessageRetryInterval(),
-            this->configuration->getMessageQueueSizeThreshold().value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
-            this->configuration->getQueueAllMessages().value_or(false), message_types_discard_for_queueing},
-        this->external_notify, this->database_handler, start_transaction_message_retry_callback);
+        [this](const std::string& message) -> bool { return this->websocket->send(message); }, message_queue_config,
+        this->external_notify, this->database_handler, start_transaction_message_retry_callback, &this->io_service);
 }
 
 void ChargePointImpl::init_websocket() {
@@ -280,6 +387,7 @@ void ChargePointImpl::init_websocket() {
     auto connection_options = this->get_ws_connection_options();
 
     this->websocket = std::make_unique<Websocket>(connection_options, this->evse_security, this->logging);
+    this->websocket->set_reconnect_scheduler(this->reconnect_scheduler, connection_options.security_profile);
     this->websocket->register_connected_callback([this](const int security_profile) {
         if (this->connection_state_changed_callback != nullptr) {
             this->connection_state_changed_callback(true);
@@ -364,7 +472,15 @@ WebsocketConnectionOptions ChargePointImpl::get_ws_connection_options() {
                                                   this->configuration->getVerifyCsmsAllowWildcards(),
                                                   this->configuration->getIFace(),
                                                   this->configuration->getEnableTLSKeylog(),
-                                                  this->configuration->getTLSKeylogFile()};
+                                                  this->configuration->getTLSKeylogFile(),
+                                                  // the message handlers can wait for responses of the CSMS
+                                                  false,
+                                                  static_cast<size_t>(
+                                                      this->configuration->getMaxReceivedMessageSize()),
+                                                  this->configuration->getWebsocketPermessageDeflate(),
+                                                  this->configuration->getWebsocketPermessageDeflateWindowBits(),
+                                                  this->configuration->getWebsocketPermessageDeflateCompressionLevel(),
+                                                  this->configuration->getReconnectProbeInterval()};
     return connection_options;
 }
 
@@ -1043,6 +1159,7 @@ void ChargePointImpl::reset_pricing_triggers(const int32_t connector_number) {
 bool ChargePointImpl::start(const std::map<int, ChargePointStatus>& connector_status_map, BootReasonEnum bootreason,
                             const std::set<std::string>& resuming_session_ids) {
     this->message_queue->start();
+    this->reconnect_scheduler->on_start();
     this->bootreason = bootreason;
     this->init_state_machine(connector_status_map);
     this->init_websocket();
@@ -1236,8 +1353,14 @@ void ChargePointImpl::message_callback(const std::string& message) {
         return;
     }
 
-    auto json_message = enhanced_message.message;
-    this->logging->central_system(conversions::messagetype_to_string(enhanced_message.messageType), message);
+    const auto& json_message = enhanced_message.message;
+    if (enhanced_message.call_text.has_value()) {
+        // the payload is missing from json_message, format the received text instead
+        this->logging->central_system(conversions::messagetype_to_string(enhanced_message.messageType), message);
+    } else {
+        this->logging->central_system(conversions::messagetype_to_string(enhanced_message.messageType), message,
+                                      json_message);
+    }
     try {
         // reject unsupported messages
         if (this->configuration->getSupportedMessageTypesReceiving().count(enhanced_message.messageType) == 0) {
@@ -1254,6 +1377,26 @@ void ChargePointImpl::message_callback(const std::string& message) {
             return;
         }
 
+        if (this->message_schema_validator != nullptr) {
+            const auto call_error = this->message_schema_validator->validate(enhanced_message);
+            if (call_error.has_value()) {
+                EVLOG_error << "Received an invalid "
+                            << conversions::messagetype_to_string(enhanced_message.messageType) << ": "
+                            << call_error.value().errorDescription;
+                this->send(call_error.value());
+                // the raw message does not fit into techInfo, so the action and the violation are reported instead
+                auto tech_info = conversions::messagetype_to_string(enhanced_message.messageType) + ": " +
+                                 call_error.value().errorDescription;
+                tech_info = tech_info.substr(0, 255);
+                std::replace_if(
+                    tech_info.begin(), tech_info.end(),
+                    [](const char c) { return not is_printable_ascii(std::string_view(&c, 1)); }, '?');
+                this->securityEventNotification(ocpp::security_events::INVALIDMESSAGES,
+                                                std::optional<CiString<255>>(tech_info), true);
+                return;
+            }
+        }
+
         switch (this->connection_state) {
         case ChargePointConnectionState::Disconnected: {
             EVLOG_error << "Received a message in disconnected state, this cannot be correct";
@@ -1337,23 +1480,23 @@ void ChargePointImpl::handle_message(const EnhancedMessage<v16::MessageType>& me
         break;
 
     case MessageType::CertificateSigned:
-        this->handleCertificateSignedRequest(json_message);
+        this->handleCertificateSignedRequest(to_call<CertificateSignedRequest>(message));
         break;
 
     case MessageType::ChangeAvailability:
-        this->handleChangeAvailabilityRequest(json_message);
+        this->handleChangeAvailabilityRequest(to_call<ChangeAvailabilityRequest>(message));
         break;
 
     case MessageType::ChangeConfiguration:
-        this->handleChangeConfigurationRequest(json_message);
+        this->handleChangeConfigurationRequest(to_call<ChangeConfigurationRequest>(message));
         break;
 
     case MessageType::ClearCache:
-        this->handleClearCacheRequest(json_message);
+        this->handleClearCacheRequest(to_call<ClearCacheRequest>(message));
         break;
 
     case MessageType::DataTransfer:
-        this->handleDataTransferRequest(json_message);
+        this->handleDataTransferRequest(to_call<DataTransferRequest>(message));
         break;
 
     case MessageType::DataTransferResponse:
@@ -1361,19 +1504,19 @@ void ChargePointImpl::handle_message(const EnhancedMessage<v16::MessageType>& me
         break;
 
     case MessageType::GetConfiguration:
-        this->handleGetConfigurationRequest(json_message);
+        this->handleGetConfigurationRequest(to_call<GetConfigurationRequest>(message));
         break;
 
     case MessageType::RemoteStartTransaction:
-        this->handleRemoteStartTransactionRequest(json_message);
+        this->handleRemoteStartTransactionRequest(to_call<RemoteStartTransactionRequest>(message));
         break;
 
     case MessageType::RemoteStopTransaction:
-        this->handleRemoteStopTransactionRequest(json_message);
+        this->handleRemoteStopTransactionRequest(to_call<RemoteStopTransactionRequest>(message));
         break;
 
     case MessageType::Reset:
-        this->handleResetRequest(json_message);
+        this->handleResetRequest(to_call<ResetRequest>(message));
         break;
 
     case MessageType::StartTransactionResponse:
@@ -1385,71 +1528,71 @@ void ChargePointImpl::handle_message(const EnhancedMessage<v16::MessageType>& me
         break;
 
     case MessageType::UnlockConnector:
-        this->handleUnlockConnectorRequest(json_message);
+        this->handleUnlockConnectorRequest(to_call<UnlockConnectorRequest>(message));
         break;
 
     case MessageType::SetChargingProfile:
-        this->handleSetChargingProfileRequest(json_message);
+        this->handleSetChargingProfileRequest(to_call<SetChargingProfileRequest>(message));
         break;
 
     case MessageType::GetCompositeSchedule:
-        this->handleGetCompositeScheduleRequest(json_message);
+        this->handleGetCompositeScheduleRequest(to_call<GetCompositeScheduleRequest>(message));
         break;
 
     case MessageType::ClearChargingProfile:
-        this->handleClearChargingProfileRequest(json_message);
+        this->handleClearChargingProfileRequest(to_call<ClearChargingProfileRequest>(message));
         break;
 
     case MessageType::TriggerMessage:
-        this->handleTriggerMessageRequest(json_message);
+        this->handleTriggerMessageRequest(to_call<TriggerMessageRequest>(message));
         break;
 
     case MessageType::GetDiagnostics:
-        this->handleGetDiagnosticsRequest(json_message);
+        this->handleGetDiagnosticsRequest(to_call<GetDiagnosticsRequest>(message));
         break;
 
     case MessageType::UpdateFirmware:
-        this->handleUpdateFirmwareRequest(json_message);
+        this->handleUpdateFirmwareRequest(to_call<UpdateFirmwareRequest>(message));
         break;
 
     case MessageType::GetInstalledCertificateIds:
-        this->handleGetInstalledCertificateIdsRequest(json_message);
+        this->handleGetInstalledCertificateIdsRequest(to_call<GetInstalledCertificateIdsRequest>(message));
         break;
 
     case MessageType::DeleteCertificate:
-        this->handleDeleteCertificateRequest(json_message);
+        this->handleDeleteCertificateRequest(to_call<DeleteCertificateRequest>(message));
         break;
 
     case MessageType::InstallCertificate:
-        this->handleInstallCertificateRequest(json_message);
+        this->handleInstallCertificateRequest(to_call<InstallCertificateRequest>(message));
         break;
 
     case MessageType::GetLog:
-        this->handleGetLogRequest(json_message);
+        this->handleGetLogRequest(to_call<GetLogRequest>(message));
         break;
 
     case MessageType::SignedUpdateFirmware:
-        this->handleSignedUpdateFirmware(json_message);
+        this->handleSignedUpdateFirmware(to_call<SignedUpdateFirmwareRequest>(message));
         break;
 
     case MessageType::ReserveNow:
-        this->handleReserveNowRequest(json_message);
+        this->handleReserveNowRequest(to_call<ReserveNowRequest>(message));
         break;
 
     case MessageType::CancelReservation:
-        this->handleCancelReservationRequest(json_message);
+        this->handleCancelReservationRequest(to_call<CancelReservationRequest>(message));
         break;
 
     case MessageType::ExtendedTriggerMessage:
-        this->handleExtendedTriggerMessageRequest(json_message);
+        this->handleExtendedTriggerMessageRequest(to_call<ExtendedTriggerMessageRequest>(message));
         break;
 
     case MessageType::SendLocalList:
-        this->handleSendLocalListRequest(json_message);
+        this->handleSendLocalListRequest(to_call<SendLocalListRequest>(message));
         break;
 
     case MessageType::GetLocalListVersion:
-        this->handleGetLocalListVersionRequest(json_message);
+        this->handleGetLocalListVersionRequest(to_call<GetLocalListVersionRequest>(message));
         break;
 
     case MessageType::HeartbeatResponse:
@@ -1482,6 +1625,7 @@ void ChargePointImpl::handleBootNotificationResponse(ocpp::CallResult<BootNotifi
     case RegistrationStatus::Accepted: {
         this->connection_state = ChargePointConnectionState::Booted;
         this->message_queue->set_registration_status_accepted();
+        this->reconnect_scheduler->on_boot_notification_accepted();
 
         if (this->set_system_time_callback != nullptr) {
             this->set_system_time_callback(call_result.msg.currentTime.to_rfc3339());
@@ -3188,7 +3332,8 @@ void ChargePointImpl::set_time_offset_timer(const std::string& date_time) {
 }
 
 template <class T> bool ChargePointImpl::send(ocpp::Call<T> call, bool initiated_by_trigger_message) {
-    const auto message_type = conversions::string_to_messagetype(json(call).at(CALL_ACTION));
+    const auto message_type =
+        conversions::string_to_messagetype(json(call).at(CALL_ACTION).get_ref<const std::string&>());
     const auto message_transmission_priority = get_message_transmission_priority(
         is_boot_notification_message(message_type), initiated_by_trigger_message,
         (this->registration_status == RegistrationStatus::Accepted), is_transaction_message(message_type),
@@ -3209,7 +3354,8 @@ template <class T> bool ChargePointImpl::send(ocpp::Call<T> call, bool initiated
 template <class T>
 std::future<EnhancedMessage<v16::MessageType>> ChargePointImpl::send_async(ocpp::Call<T> call,
                                                                            bool initiated_by_trigger_message) {
-    const auto message_type = conversions::string_to_messagetype(json(call).at(CALL_ACTION));
+    const auto message_type =
+        conversions::string_to_messagetype(json(call).at(CALL_ACTION).get_ref<const std::string&>());
     const auto message_transmission_priority = get_message_transmission_priority(
         is_boot_notification_message(message_type), initiated_by_trigger_message,
         (this->registration_status == RegistrationStatus::Accepted), is_transaction_message(message_type),
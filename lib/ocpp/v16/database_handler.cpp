@@ -223,13 +223,61 @@ std::vector<TransactionEntry> DatabaseHandler::get_transactions(bool filter_inco
     return transactions;
 }
 
-// authorization cache
-void DatabaseHandler::insert_or_update_authorization_cache_entry(const CiString<20>& id_tag,
+// authorization cache and local authorization list
+void DatabaseHandler::load_authorization_table(AuthorizationTable& table) {
+    if (table.loaded) {
+        return;
+    }
+
+    std::string sql = "SELECT ID_TAG, AUTH_STATUS, EXPIRY_DATE, PARENT_ID_TAG FROM " + table.name;
+    auto stmt = this->database->new_statement(sql);
+
+    CiStringMap<20, v16::IdTagInfo> entries;
+    int status;
+    while ((status = stmt->step()) == SQLITE_ROW) {
+        v16::IdTagInfo id_tag_info;
+        id_tag_info.status = v16::conversions::string_to_authorization_status(stmt->column_text(1));
+
+        if (stmt->column_type(2) != SQLITE_NULL) {
+            id_tag_info.expiryDate.emplace(stmt->column_text(2));
+        }
+
+        if (stmt->column_type(3) != SQLITE_NULL) {
+            id_tag_info.parentIdTag.emplace(stmt->column_text(3));
+        }
+
+        entries.insert_or_assign(CiString<20>(stmt->column_text(0)), std::move(id_tag_info));
+    }
+
+    if (status != SQLITE_DONE) {
+        throw QueryExecutionException(this->database->get_error_message());
+    }
+
+    table.entries = std::move(entries);
+    table.loaded = true;
+}
+
+void DatabaseHandler::insert_or_update_authorization_table_entry(AuthorizationTable& table,
+                                                                 const CiString<20>& id_tag,
                                                                  const v16::IdTagInfo& id_tag_info) {
+    this->load_authorization_table(table);
 
-    // TODO(piet): Only call this when authorization cache is enabled!
+    // ID_TAG is compared case sensitively by the database, so an entry for the same idTag in a different case has to
+    // be removed first
+    const auto entry = table.entries.find(id_tag);
+    if (entry != table.entries.end() and entry->first.view() != id_tag.view()) {
+        std::string sql = "DELETE FROM " + table.name + " WHERE ID_TAG = @id_tag COLLATE NOCASE";
+        auto stmt = this->database->new_statement(sql);
 
-    std::string sql = "INSERT OR REPLACE INTO AUTH_CACHE (ID_TAG, AUTH_STATUS, EXPIRY_DATE, PARENT_ID_TAG) VALUES "
+        stmt->bind_text("@id_tag", id_tag.get(), SQLiteString::Transient);
+        if (stmt->step() != SQLITE_DONE) {
+            throw QueryExecutionException(this->database->get_error_message());
+        }
+        table.entries.erase(entry);
+    }
+
+    std::string sql = "INSERT OR REPLACE INTO " + table.name +
+                      " (ID_TAG, AUTH_STATUS, EXPIRY_DATE, PARENT_ID_TAG) VALUES "
                       "(@id_tag, @auth_status, @expiry_date, @parent_id_tag)";
     auto stmt = this->database->new_statement(sql);
 
@@ -244,59 +292,66 @@ void DatabaseHandler::insert_or_update_authorization_cache_entry(const CiString<
     }
 
     if (stmt->step() != SQLITE_DONE) {
+        EVLOG_error << "Could not insert or update " << table.description << " entry into the database";
         throw QueryExecutionException(this->database->get_error_message());
     }
-}
-
-std::optional<v16::IdTagInfo> DatabaseHandler::get_authorization_cache_entry(const CiString<20>& id_tag) {
-
-    std::string sql = "SELECT ID_TAG, AUTH_STATUS, EXPIRY_DATE, PARENT_ID_TAG FROM AUTH_CACHE WHERE ID_TAG = @id_tag";
-    auto stmt = this->database->new_statement(sql);
 
-    stmt->bind_text("@id_tag", id_tag.get(), SQLiteString::Transient);
+    table.entries.insert_or_assign(id_tag, id_tag_info);
+}
 
-    int status = stmt->step();
+std::optional<v16::IdTagInfo> DatabaseHandler::get_authorization_table_entry(AuthorizationTable& table,
+                                                                             const CiString<20>& id_tag) {
+    this->load_authorization_table(table);
 
-    // entry was not found
-    if (status == SQLITE_DONE) {
+    const auto entry = table.entries.find(id_tag);
+    if (entry == table.entries.end()) {
         return std::nullopt;
     }
 
-    if (status == SQLITE_ROW) {
-        v16::IdTagInfo id_tag_info;
-        id_tag_info.status = v16::conversions::string_to_authorization_status(stmt->column_text(1));
+    v16::IdTagInfo id_tag_info = entry->second;
 
-        if (stmt->column_type(2) != SQLITE_NULL) {
-            id_tag_info.expiryDate.emplace(stmt->column_text(2));
-        }
-
-        if (stmt->column_type(3) != SQLITE_NULL) {
-            id_tag_info.parentIdTag.emplace(stmt->column_text(3));
-        }
-
-        // check if expiry date is set and the entry should be set to Expired
-        if (id_tag_info.status != v16::AuthorizationStatus::Expired) {
-            if (id_tag_info.expiryDate) {
-                auto now = DateTime();
-                if (id_tag_info.expiryDate.value() <= now) {
-                    EVLOG_debug << "IdTag " << id_tag
-                                << " in auth cache has expiry date in the past, setting entry to expired.";
-                    id_tag_info.status = v16::AuthorizationStatus::Expired;
-                    this->insert_or_update_authorization_cache_entry(id_tag, id_tag_info);
-                }
+    // check if expiry date is set and the entry should be set to Expired
+    if (id_tag_info.status != v16::AuthorizationStatus::Expired) {
+        if (id_tag_info.expiryDate) {
+            auto now = DateTime();
+            if (id_tag_info.expiryDate.value() <= now) {
+                EVLOG_debug << "IdTag " << id_tag << " in " << table.description
+                            << " has expiry date in the past, setting entry to expired.";
+                id_tag_info.status = v16::AuthorizationStatus::Expired;
+                const auto stored_id_tag = entry->first;
+                this->insert_or_update_authorization_table_entry(table, stored_id_tag, id_tag_info);
             }
         }
-        return id_tag_info;
     }
-
-    throw QueryExecutionException(this->database->get_error_message());
+    return id_tag_info;
 }
 
-void DatabaseHandler::clear_authorization_cache() {
-    const auto retval = this->database->clear_table("AUTH_CACHE");
+void DatabaseHandler::clear_authorization_table(AuthorizationTable& table) {
+    const auto retval = this->database->clear_table(table.name);
     if (retval == false) {
         throw QueryExecutionException(this->database->get_error_message());
     }
+    table.entries.clear();
+    table.loaded = true;
+}
+
+void DatabaseHandler::insert_or_update_authorization_cache_entry(const CiString<20>& id_tag,
+                                                                 const v16::IdTagInfo& id_tag_info) {
+
+    // TODO(piet): Only call this when authorization cache is enabled!
+
+    std::lock_guard<std::mutex> lk(this->authorization_tables_mutex);
+    this->insert_or_update_authorization_table_entry(this->authorization_cache, id_tag, id_tag_info);
+}
+
+std::optional<v16::IdTagInfo> DatabaseHandler::get_authorization_cache_entry(const CiString<20>& id_tag) {
+    std::lock_guard<std::mutex> lk(this->authorization_tables_mutex);
+    return this->get_authorization_table_entry(this->authorization_cache, id_tag);
+}
+
+void DatabaseHandler::clear_authorization_cache() {
+    std::lock_guard<std::mutex> lk(this->authorization_tables_mutex);
+    this->clear_authorization_table(this->authorization_cache);
 }
 
 void DatabaseHandler::insert_or_update_connector_availability(int32_t connector,
@@ -399,25 +454,8 @@ int32_t DatabaseHandler::get_local_list_version() {
 
 void DatabaseHandler::insert_or_update_local_authorization_list_entry(const CiString<20>& id_tag,
                                                                       const v16::IdTagInfo& id_tag_info) {
-    // add or replace
-    std::string sql = "INSERT OR REPLACE INTO AUTH_LIST (ID_TAG, AUTH_STATUS, EXPIRY_DATE, PARENT_ID_TAG) VALUES "
-                      "(@id_tag, @auth_status, @expiry_date, @parent_id_tag)";
-    auto stmt = this->database->new_statement(sql);
-
-    stmt->bind_text("@id_tag", id_tag.get(), SQLiteString::Transient);
-    stmt->bind_text("@auth_status", v16::conversions::authorization_status_to_string(id_tag_info.status),
-                    SQLiteString::Transient);
-    if (id_tag_info.expiryDate.has_value()) {
-        stmt->bind_text("@expiry_date", id_tag_info.expiryDate.value().to_rfc3339(), SQLiteString::Transient);
-    }
-    if (id_tag_info.parentIdTag.has_value()) {
-        stmt->bind_text("@parent_id_tag", id_tag_info.parentIdTag.value().get(), SQLiteString::Transient);
-    }
-
-    if (stmt->step() != SQLITE_DONE) {
-        EVLOG_error << "Could not insert or update local authorization list entry into the database";
-        throw QueryExecutionException(this->database->get_error_message());
-    }
+    std::lock_guard<std::mutex> lk(this->authorization_tables_mutex);
+    this->insert_or_update_authorization_table_entry(this->local_authorization_list, id_tag, id_tag_info);
 }
 
 void DatabaseHandler::insert_or_update_local_authorization_list(
@@ -443,64 +481,28 @@ void DatabaseHandler::insert_or_update_local_authorization_list(
 }
 
 void DatabaseHandler::delete_local_authorization_list_entry(const std::string& id_tag) {
-    std::string sql = "DELETE FROM AUTH_LIST WHERE ID_TAG = @id_tag;";
+    std::lock_guard<std::mutex> lk(this->authorization_tables_mutex);
+    std::string sql = "DELETE FROM AUTH_LIST WHERE ID_TAG = @id_tag COLLATE NOCASE;";
     auto stmt = this->database->new_statement(sql);
 
     stmt->bind_text("@id_tag", id_tag);
     if (stmt->step() != SQLITE_DONE) {
         throw QueryExecutionException(this->database->get_error_message());
     }
-}
 
-std::optional<v16::IdTagInfo> DatabaseHandler::get_local_authorization_list_entry(const CiString<20>& id_tag) {
-    std::string sql = "SELECT ID_TAG, AUTH_STATUS, EXPIRY_DATE, PARENT_ID_TAG FROM AUTH_LIST WHERE ID_TAG = @id_tag";
-    auto stmt = this->database->new_statement(sql);
-
-    stmt->bind_text("@id_tag", id_tag.get(), SQLiteString::Transient);
-
-    int status = stmt->step();
-
-    // entry was not found
-    if (status == SQLITE_DONE) {
-        return std::nullopt;
-    }
-
-    // entry was found
-    if (status == SQLITE_ROW) {
-        v16::IdTagInfo id_tag_info;
-        id_tag_info.status = v16::conversions::string_to_authorization_status(stmt->column_text(1));
-
-        if (stmt->column_type(2) != SQLITE_NULL) {
-            id_tag_info.expiryDate.emplace(stmt->column_text(2));
-        }
-
-        if (stmt->column_type(3) != SQLITE_NULL) {
-            id_tag_info.parentIdTag.emplace(stmt->column_text(3));
-        }
-
-        // check if expiry date is set and the entry should be set to Expired
-        if (id_tag_info.status != v16::AuthorizationStatus::Expired) {
-            if (id_tag_info.expiryDate) {
-                auto now = DateTime();
-                if (id_tag_info.expiryDate.value() <= now) {
-                    EVLOG_debug << "IdTag " << id_tag
-                                << " in auth list has expiry date in the past, setting entry to expired.";
-                    id_tag_info.status = v16::AuthorizationStatus::Expired;
-                    this->insert_or_update_local_authorization_list_entry(id_tag, id_tag_info);
-                }
-            }
-        }
-        return id_tag_info;
+    if (this->local_authorization_list.loaded and id_tag.size() <= 20) {
+        this->local_authorization_list.entries.erase(CiString<20>(id_tag));
     }
+}
 
-    throw QueryExecutionException(this->database->get_error_message());
+std::optional<v16::IdTagInfo> DatabaseHandler::get_local_authorization_list_entry(const CiString<20>& id_tag) {
+    std::lock_guard<std::mutex> lk(this->authorization_tables_mutex);
+    return this->get_authorization_table_entry(this->local_authorization_list, id_tag);
 }
 
 void DatabaseHandler::clear_local_authorization_list() {
-    const auto retval = this->database->clear_table("AUTH_LIST");
-    if (retval == false) {
-        throw QueryExecutionException(this->database->get_error_message());
-    }
+    std::lock_guard<std::mutex> lk(this->authorization_tables_mutex);
+    this->clear_authorization_table(this->local_authorization_list);
 }
 
 int32_t DatabaseHandler::get_local_authorization_list_number_of_entries() {
@@ -9,11 +9,12 @@ namespace ocpp {
 
 template <>
 ControlMessage<v16::MessageType>::ControlMessage(const json& message, const bool stall_until_accepted) :
-    message(message.get<json::array_t>()),
-    messageType(v16::conversions::string_to_messagetype(message.at(CALL_ACTION))),
+    messageType(v16::conversions::string_to_messagetype(message.at(CALL_ACTION).get_ref<const std::string&>())),
     message_attempts(0),
     initial_unique_id(message[MESSAGE_ID]),
-    stall_until_accepted(stall_until_accepted) {
+    stall_until_accepted(stall_until_accepted),
+    unique_id(message[MESSAGE_ID]),
+    message(message.get<json::array_t>()) {
 }
 
 bool is_transaction_message(const ocpp::v16::MessageType message_type) {
@@ -26,6 +27,10 @@ bool is_start_transaction_message(const ocpp::v16::MessageType message_type) {
     return message_type == v16::MessageType::StartTransaction;
 }
 
+bool is_transaction_event_message(const ocpp::v16::MessageType message_type) {
+    return false;
+}
+
 bool is_boot_notification_message(const ocpp::v16::MessageType message_type) {
     return message_type == ocpp::v16::MessageType::BootNotification;
 }
@@ -34,6 +39,52 @@ template <> bool ControlMessage<v16::MessageType>::is_transaction_update_message
     return (this->messageType == v16::MessageType::MeterValues);
 }
 
+template <> std::optional<std::string> ControlMessage<v16::MessageType>::transaction_id() const {
+    if (this->messageType != v16::MessageType::MeterValues and
+        this->messageType != v16::MessageType::StopTransaction) {
+        return std::nullopt;
+    }
+    const auto& payload = this->json_message().at(CALL_PAYLOAD);
+    if (payload.contains("transactionId")) {
+        return payload.at("transactionId").dump();
+    }
+    return std::nullopt;
+}
+
+template <> bool ControlMessage<v16::MessageType>::contains_signed_meter_values() const {
+    if (this->messageType != v16::MessageType::MeterValues) {
+        return false;
+    }
+    const auto& payload = this->json_message().at(CALL_PAYLOAD);
+    for (const auto& meter_value : payload.value("meterValue", json::array())) {
+        for (const auto& sampled_value : meter_value.value("sampledValue", json::array())) {
+            if (sampled_value.value("format", "") == "SignedData") {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template <> std::optional<std::string> ControlMessage<v16::MessageType>::coalescing_key() const {
+    const auto& payload = this->json_message().at(CALL_PAYLOAD);
+    switch (this->messageType) {
+    case v16::MessageType::StatusNotification:
+        return payload.at("connectorId").dump();
+    case v16::MessageType::Heartbeat:
+        return "";
+    case v16::MessageType::LogStatusNotification:
+        // only the states of the same log upload supersede each other
+        if (payload.contains("requestId")) {
+            return payload.at("requestId").dump();
+        }
+        return std::nullopt;
+    default:
+        // the intermediate states of firmware and diagnostics sequences are never coalesced
+        return std::nullopt;
+    }
+}
+
 template <> v16::MessageType MessageQueue<v16::MessageType>::string_to_messagetype(const std::string& s) {
     return v16::conversions::string_to_messagetype(s);
 }
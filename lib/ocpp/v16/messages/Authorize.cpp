@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -32,6 +35,23 @@ void from_json(const json& j, AuthorizeRequest& k) {
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a AuthorizeRequest
+const JsonSaxFields& json_sax_fields(const AuthorizeRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&AuthorizeRequest::idTag>("idTag"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given AuthorizeRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const AuthorizeRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("idTag");
+    writer.value(k.idTag.view());
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given AuthorizeRequest \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizeRequest written to
 std::ostream& operator<<(std::ostream& os, const AuthorizeRequest& k) {
@@ -58,6 +78,23 @@ void from_json(const json& j, AuthorizeResponse& k) {
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a AuthorizeResponse
+const JsonSaxFields& json_sax_fields(const AuthorizeResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&AuthorizeResponse::idTagInfo>("idTagInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given AuthorizeResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const AuthorizeResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("idTagInfo");
+    write_json(writer, k.idTagInfo);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given AuthorizeResponse \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizeResponse written to
 std::ostream& operator<<(std::ostream& os, const AuthorizeResponse& k) {
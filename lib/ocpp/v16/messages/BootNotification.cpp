@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -76,6 +79,61 @@ void from_json(const json& j, BootNotificationRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a BootNotificationRequest
+const JsonSaxFields& json_sax_fields(const BootNotificationRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&BootNotificationRequest::chargePointVendor>("chargePointVendor"),
+        json_sax_field<&BootNotificationRequest::chargePointModel>("chargePointModel"),
+        json_sax_field<&BootNotificationRequest::chargePointSerialNumber>("chargePointSerialNumber"),
+        json_sax_field<&BootNotificationRequest::chargeBoxSerialNumber>("chargeBoxSerialNumber"),
+        json_sax_field<&BootNotificationRequest::firmwareVersion>("firmwareVersion"),
+        json_sax_field<&BootNotificationRequest::iccid>("iccid"),
+        json_sax_field<&BootNotificationRequest::imsi>("imsi"),
+        json_sax_field<&BootNotificationRequest::meterType>("meterType"),
+        json_sax_field<&BootNotificationRequest::meterSerialNumber>("meterSerialNumber"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given BootNotificationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const BootNotificationRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.chargeBoxSerialNumber) {
+        writer.key("chargeBoxSerialNumber");
+        writer.value(k.chargeBoxSerialNumber.value().view());
+    }
+    writer.key("chargePointModel");
+    writer.value(k.chargePointModel.view());
+    if (k.chargePointSerialNumber) {
+        writer.key("chargePointSerialNumber");
+        writer.value(k.chargePointSerialNumber.value().view());
+    }
+    writer.key("chargePointVendor");
+    writer.value(k.chargePointVendor.view());
+    if (k.firmwareVersion) {
+        writer.key("firmwareVersion");
+        writer.value(k.firmwareVersion.value().view());
+    }
+    if (k.iccid) {
+        writer.key("iccid");
+        writer.value(k.iccid.value().view());
+    }
+    if (k.imsi) {
+        writer.key("imsi");
+        writer.value(k.imsi.value().view());
+    }
+    if (k.meterSerialNumber) {
+        writer.key("meterSerialNumber");
+        writer.value(k.meterSerialNumber.value().view());
+    }
+    if (k.meterType) {
+        writer.key("meterType");
+        writer.value(k.meterType.value().view());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given BootNotificationRequest \p k to the given output stream \p os
 /// \returns an output stream with the BootNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const BootNotificationRequest& k) {
@@ -99,13 +157,36 @@ void to_json(json& j, const BootNotificationResponse& k) {
 
 void from_json(const json& j, BootNotificationResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_registration_status(j.at("status"));
+    k.status = conversions::string_to_registration_status(j.at("status").get_ref<const std::string&>());
     k.currentTime = ocpp::DateTime(std::string(j.at("currentTime")));
     k.interval = j.at("interval");
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a BootNotificationResponse
+const JsonSaxFields& json_sax_fields(const BootNotificationResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&BootNotificationResponse::status, conversions::string_to_registration_status>("status"),
+        json_sax_field<&BootNotificationResponse::currentTime>("currentTime"),
+        json_sax_field<&BootNotificationResponse::interval>("interval"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given BootNotificationResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const BootNotificationResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("currentTime");
+    writer.value(k.currentTime);
+    writer.key("interval");
+    writer.value(k.interval);
+    writer.key("status");
+    writer.value(conversions::registration_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given BootNotificationResponse \p k to the given output stream \p os
 /// \returns an output stream with the BootNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const BootNotificationResponse& k) {
@@ -7,6 +7,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -31,6 +34,23 @@ void from_json(const json& j, CancelReservationRequest& k) {
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CancelReservationRequest
+const JsonSaxFields& json_sax_fields(const CancelReservationRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&CancelReservationRequest::reservationId>("reservationId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given CancelReservationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CancelReservationRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("reservationId");
+    writer.value(k.reservationId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CancelReservationRequest \p k to the given output stream \p os
 /// \returns an output stream with the CancelReservationRequest written to
 std::ostream& operator<<(std::ostream& os, const CancelReservationRequest& k) {
@@ -52,11 +72,28 @@ void to_json(json& j, const CancelReservationResponse& k) {
 
 void from_json(const json& j, CancelReservationResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_cancel_reservation_status(j.at("status"));
+    k.status = conversions::string_to_cancel_reservation_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CancelReservationResponse
+const JsonSaxFields& json_sax_fields(const CancelReservationResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&CancelReservationResponse::status, conversions::string_to_cancel_reservation_status>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given CancelReservationResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CancelReservationResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::cancel_reservation_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CancelReservationResponse \p k to the given output stream \p os
 /// \returns an output stream with the CancelReservationResponse written to
 std::ostream& operator<<(std::ostream& os, const CancelReservationResponse& k) {
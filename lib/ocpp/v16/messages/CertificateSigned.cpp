@@ -7,6 +7,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -31,6 +34,23 @@ void from_json(const json& j, CertificateSignedRequest& k) {
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CertificateSignedRequest
+const JsonSaxFields& json_sax_fields(const CertificateSignedRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&CertificateSignedRequest::certificateChain>("certificateChain"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given CertificateSignedRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CertificateSignedRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("certificateChain");
+    writer.value(k.certificateChain.view());
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CertificateSignedRequest \p k to the given output stream \p os
 /// \returns an output stream with the CertificateSignedRequest written to
 std::ostream& operator<<(std::ostream& os, const CertificateSignedRequest& k) {
@@ -52,11 +72,29 @@ void to_json(json& j, const CertificateSignedResponse& k) {
 
 void from_json(const json& j, CertificateSignedResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_certificate_signed_status_enum_type(j.at("status"));
+    k.status = conversions::string_to_certificate_signed_status_enum_type(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CertificateSignedResponse
+const JsonSaxFields& json_sax_fields(const CertificateSignedResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&CertificateSignedResponse::status,
+                       conversions::string_to_certificate_signed_status_enum_type>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given CertificateSignedResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CertificateSignedResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::certificate_signed_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CertificateSignedResponse \p k to the given output stream \p os
 /// \returns an output stream with the CertificateSignedResponse written to
 std::ostream& operator<<(std::ostream& os, const CertificateSignedResponse& k) {
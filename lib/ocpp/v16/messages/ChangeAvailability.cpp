@@ -7,6 +7,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -28,11 +31,31 @@ void to_json(json& j, const ChangeAvailabilityRequest& k) {
 void from_json(const json& j, ChangeAvailabilityRequest& k) {
     // the required parts of the message
     k.connectorId = j.at("connectorId");
-    k.type = conversions::string_to_availability_type(j.at("type"));
+    k.type = conversions::string_to_availability_type(j.at("type").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChangeAvailabilityRequest
+const JsonSaxFields& json_sax_fields(const ChangeAvailabilityRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ChangeAvailabilityRequest::connectorId>("connectorId"),
+        json_sax_field<&ChangeAvailabilityRequest::type, conversions::string_to_availability_type>("type"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ChangeAvailabilityRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChangeAvailabilityRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("connectorId");
+    writer.value(k.connectorId);
+    writer.key("type");
+    writer.value(conversions::availability_type_to_string(k.type));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ChangeAvailabilityRequest \p k to the given output stream \p os
 /// \returns an output stream with the ChangeAvailabilityRequest written to
 std::ostream& operator<<(std::ostream& os, const ChangeAvailabilityRequest& k) {
@@ -54,11 +77,28 @@ void to_json(json& j, const ChangeAvailabilityResponse& k) {
 
 void from_json(const json& j, ChangeAvailabilityResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_availability_status(j.at("status"));
+    k.status = conversions::string_to_availability_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChangeAvailabilityResponse
+const JsonSaxFields& json_sax_fields(const ChangeAvailabilityResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ChangeAvailabilityResponse::status, conversions::string_to_availability_status>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ChangeAvailabilityResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChangeAvailabilityResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::availability_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ChangeAvailabilityResponse \p k to the given output stream \p
 /// os \returns an output stream with the ChangeAvailabilityResponse written to
 std::ostream& operator<<(std::ostream& os, const ChangeAvailabilityResponse& k) {
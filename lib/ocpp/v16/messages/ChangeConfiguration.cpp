@@ -7,6 +7,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -33,6 +36,26 @@ void from_json(const json& j, ChangeConfigurationRequest& k) {
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChangeConfigurationRequest
+const JsonSaxFields& json_sax_fields(const ChangeConfigurationRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ChangeConfigurationRequest::key>("key"),
+        json_sax_field<&ChangeConfigurationRequest::value>("value"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ChangeConfigurationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChangeConfigurationRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("key");
+    writer.value(k.key.view());
+    writer.key("value");
+    writer.value(k.value.view());
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ChangeConfigurationRequest \p k to the given output stream \p
 /// os \returns an output stream with the ChangeConfigurationRequest written to
 std::ostream& operator<<(std::ostream& os, const ChangeConfigurationRequest& k) {
@@ -54,11 +77,28 @@ void to_json(json& j, const ChangeConfigurationResponse& k) {
 
 void from_json(const json& j, ChangeConfigurationResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_configuration_status(j.at("status"));
+    k.status = conversions::string_to_configuration_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChangeConfigurationResponse
+const JsonSaxFields& json_sax_fields(const ChangeConfigurationResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ChangeConfigurationResponse::status, conversions::string_to_configuration_status>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ChangeConfigurationResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChangeConfigurationResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::configuration_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ChangeConfigurationResponse \p k to the given output stream \p
 /// os \returns an output stream with the ChangeConfigurationResponse written to
 std::ostream& operator<<(std::ostream& os, const ChangeConfigurationResponse& k) {
@@ -7,6 +7,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -32,6 +35,19 @@ void from_json(const json& j, ClearCacheRequest& k) {
     (void)k;
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearCacheRequest
+const JsonSaxFields& json_sax_fields(const ClearCacheRequest*) {
+    static const JsonSaxFields fields;
+    return fields;
+}
+
+/// \brief Writes the given ClearCacheRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearCacheRequest& k) {
+    writer.begin_object();
+    writer.end_object();
+    (void)k; // no members to write, silence unused parameter warning
+}
+
 /// \brief Writes the string representation of the given ClearCacheRequest \p k to the given output stream \p os
 /// \returns an output stream with the ClearCacheRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearCacheRequest& k) {
@@ -53,11 +69,28 @@ void to_json(json& j, const ClearCacheResponse& k) {
 
 void from_json(const json& j, ClearCacheResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_clear_cache_status(j.at("status"));
+    k.status = conversions::string_to_clear_cache_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearCacheResponse
+const JsonSaxFields& json_sax_fields(const ClearCacheResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ClearCacheResponse::status, conversions::string_to_clear_cache_status>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ClearCacheResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearCacheResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::clear_cache_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearCacheResponse \p k to the given output stream \p os
 /// \returns an output stream with the ClearCacheResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearCacheResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -48,13 +51,49 @@ void from_json(const json& j, ClearChargingProfileRequest& k) {
     }
     if (j.contains("chargingProfilePurpose")) {
         k.chargingProfilePurpose.emplace(
-            conversions::string_to_charging_profile_purpose_type(j.at("chargingProfilePurpose")));
+            conversions::string_to_charging_profile_purpose_type(
+                j.at("chargingProfilePurpose").get_ref<const std::string&>()));
     }
     if (j.contains("stackLevel")) {
         k.stackLevel.emplace(j.at("stackLevel"));
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearChargingProfileRequest
+const JsonSaxFields& json_sax_fields(const ClearChargingProfileRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ClearChargingProfileRequest::id>("id"),
+        json_sax_field<&ClearChargingProfileRequest::connectorId>("connectorId"),
+        json_sax_field<&ClearChargingProfileRequest::chargingProfilePurpose,
+                       conversions::string_to_charging_profile_purpose_type>("chargingProfilePurpose"),
+        json_sax_field<&ClearChargingProfileRequest::stackLevel>("stackLevel"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ClearChargingProfileRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearChargingProfileRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.chargingProfilePurpose) {
+        writer.key("chargingProfilePurpose");
+        writer.value(conversions::charging_profile_purpose_type_to_string(k.chargingProfilePurpose.value()));
+    }
+    if (k.connectorId) {
+        writer.key("connectorId");
+        writer.value(k.connectorId.value());
+    }
+    if (k.id) {
+        writer.key("id");
+        writer.value(k.id.value());
+    }
+    if (k.stackLevel) {
+        writer.key("stackLevel");
+        writer.value(k.stackLevel.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearChargingProfileRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearChargingProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfileRequest& k) {
@@ -76,11 +115,29 @@ void to_json(json& j, const ClearChargingProfileResponse& k) {
 
 void from_json(const json& j, ClearChargingProfileResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_clear_charging_profile_status(j.at("status"));
+    k.status = conversions::string_to_clear_charging_profile_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearChargingProfileResponse
+const JsonSaxFields& json_sax_fields(const ClearChargingProfileResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ClearChargingProfileResponse::status,
+                       conversions::string_to_clear_charging_profile_status>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ClearChargingProfileResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearChargingProfileResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::clear_charging_profile_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearChargingProfileResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearChargingProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfileResponse& k) {
@@ -7,6 +7,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -31,6 +34,23 @@ void from_json(const json& j, DeleteCertificateRequest& k) {
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a DeleteCertificateRequest
+const JsonSaxFields& json_sax_fields(const DeleteCertificateRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&DeleteCertificateRequest::certificateHashData>("certificateHashData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given DeleteCertificateRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const DeleteCertificateRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("certificateHashData");
+    write_json(writer, k.certificateHashData);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given DeleteCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the DeleteCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const DeleteCertificateRequest& k) {
@@ -52,11 +72,29 @@ void to_json(json& j, const DeleteCertificateResponse& k) {
 
 void from_json(const json& j, DeleteCertificateResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_delete_certificate_status_enum_type(j.at("status"));
+    k.status = conversions::string_to_delete_certificate_status_enum_type(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a DeleteCertificateResponse
+const JsonSaxFields& json_sax_fields(const DeleteCertificateResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&DeleteCertificateResponse::status,
+                       conversions::string_to_delete_certificate_status_enum_type>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given DeleteCertificateResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const DeleteCertificateResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::delete_certificate_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given DeleteCertificateResponse \p k to the given output stream \p os
 /// \returns an output stream with the DeleteCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const DeleteCertificateResponse& k) {
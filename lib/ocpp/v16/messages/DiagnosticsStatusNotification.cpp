@@ -7,6 +7,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -26,11 +29,31 @@ void to_json(json& j, const DiagnosticsStatusNotificationRequest& k) {
 
 void from_json(const json& j, DiagnosticsStatusNotificationRequest& k) {
     // the required parts of the message
-    k.status = conversions::string_to_diagnostics_status(j.at("status"));
+    k.status = conversions::string_to_diagnostics_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a
+/// DiagnosticsStatusNotificationRequest
+const JsonSaxFields& json_sax_fields(const DiagnosticsStatusNotificationRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&DiagnosticsStatusNotificationRequest::status,
+                       conversions::string_to_diagnostics_status>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given DiagnosticsStatusNotificationRequest \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const DiagnosticsStatusNotificationRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::diagnostics_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given DiagnosticsStatusNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the DiagnosticsStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const DiagnosticsStatusNotificationRequest& k) {
@@ -58,6 +81,21 @@ void from_json(const json& j, DiagnosticsStatusNotificationResponse& k) {
     (void)k;
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a
+/// DiagnosticsStatusNotificationResponse
+const JsonSaxFields& json_sax_fields(const DiagnosticsStatusNotificationResponse*) {
+    static const JsonSaxFields fields;
+    return fields;
+}
+
+/// \brief Writes the given DiagnosticsStatusNotificationResponse \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const DiagnosticsStatusNotificationResponse& k) {
+    writer.begin_object();
+    writer.end_object();
+    (void)k; // no members to write, silence unused parameter warning
+}
+
 /// \brief Writes the string representation of the given DiagnosticsStatusNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the DiagnosticsStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const DiagnosticsStatusNotificationResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -30,7 +33,8 @@ void to_json(json& j, const ExtendedTriggerMessageRequest& k) {
 
 void from_json(const json& j, ExtendedTriggerMessageRequest& k) {
     // the required parts of the message
-    k.requestedMessage = conversions::string_to_message_trigger_enum_type(j.at("requestedMessage"));
+    k.requestedMessage =
+        conversions::string_to_message_trigger_enum_type(j.at("requestedMessage").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("connectorId")) {
@@ -38,6 +42,29 @@ void from_json(const json& j, ExtendedTriggerMessageRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ExtendedTriggerMessageRequest
+const JsonSaxFields& json_sax_fields(const ExtendedTriggerMessageRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ExtendedTriggerMessageRequest::requestedMessage,
+                       conversions::string_to_message_trigger_enum_type>("requestedMessage"),
+        json_sax_field<&ExtendedTriggerMessageRequest::connectorId>("connectorId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ExtendedTriggerMessageRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ExtendedTriggerMessageRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.connectorId) {
+        writer.key("connectorId");
+        writer.value(k.connectorId.value());
+    }
+    writer.key("requestedMessage");
+    writer.value(conversions::message_trigger_enum_type_to_string(k.requestedMessage));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ExtendedTriggerMessageRequest \p k to the given output stream
 /// \p os \returns an output stream with the ExtendedTriggerMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const ExtendedTriggerMessageRequest& k) {
@@ -59,11 +86,29 @@ void to_json(json& j, const ExtendedTriggerMessageResponse& k) {
 
 void from_json(const json& j, ExtendedTriggerMessageResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_trigger_message_status_enum_type(j.at("status"));
+    k.status = conversions::string_to_trigger_message_status_enum_type(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ExtendedTriggerMessageResponse
+const JsonSaxFields& json_sax_fields(const ExtendedTriggerMessageResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ExtendedTriggerMessageResponse::status,
+                       conversions::string_to_trigger_message_status_enum_type>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ExtendedTriggerMessageResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ExtendedTriggerMessageResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::trigger_message_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ExtendedTriggerMessageResponse \p k to the given output stream
 /// \p os \returns an output stream with the ExtendedTriggerMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const ExtendedTriggerMessageResponse& k) {
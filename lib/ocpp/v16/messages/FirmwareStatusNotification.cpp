@@ -7,6 +7,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -26,11 +29,29 @@ void to_json(json& j, const FirmwareStatusNotificationRequest& k) {
 
 void from_json(const json& j, FirmwareStatusNotificationRequest& k) {
     // the required parts of the message
-    k.status = conversions::string_to_firmware_status(j.at("status"));
+    k.status = conversions::string_to_firmware_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a FirmwareStatusNotificationRequest
+const JsonSaxFields& json_sax_fields(const FirmwareStatusNotificationRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&FirmwareStatusNotificationRequest::status, conversions::string_to_firmware_status>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given FirmwareStatusNotificationRequest \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::firmware_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given FirmwareStatusNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the FirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const FirmwareStatusNotificationRequest& k) {
@@ -58,6 +79,20 @@ void from_json(const json& j, FirmwareStatusNotificationResponse& k) {
     (void)k;
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a FirmwareStatusNotificationResponse
+const JsonSaxFields& json_sax_fields(const FirmwareStatusNotificationResponse*) {
+    static const JsonSaxFields fields;
+    return fields;
+}
+
+/// \brief Writes the given FirmwareStatusNotificationResponse \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationResponse& k) {
+    writer.begin_object();
+    writer.end_object();
+    (void)k; // no members to write, silence unused parameter warning
+}
+
 /// \brief Writes the string representation of the given FirmwareStatusNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the FirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const FirmwareStatusNotificationResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -36,8 +39,35 @@ void from_json(const json& j, GetCompositeScheduleRequest& k) {
 
     // the optional parts of the message
     if (j.contains("chargingRateUnit")) {
-        k.chargingRateUnit.emplace(conversions::string_to_charging_rate_unit(j.at("chargingRateUnit")));
+        k.chargingRateUnit.emplace(
+            conversions::string_to_charging_rate_unit(j.at("chargingRateUnit").get_ref<const std::string&>()));
+    }
+}
+
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetCompositeScheduleRequest
+const JsonSaxFields& json_sax_fields(const GetCompositeScheduleRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetCompositeScheduleRequest::connectorId>("connectorId"),
+        json_sax_field<&GetCompositeScheduleRequest::duration>("duration"),
+        json_sax_field<&GetCompositeScheduleRequest::chargingRateUnit,
+                       conversions::string_to_charging_rate_unit>("chargingRateUnit"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetCompositeScheduleRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetCompositeScheduleRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.chargingRateUnit) {
+        writer.key("chargingRateUnit");
+        writer.value(conversions::charging_rate_unit_to_string(k.chargingRateUnit.value()));
     }
+    writer.key("connectorId");
+    writer.value(k.connectorId);
+    writer.key("duration");
+    writer.value(k.duration);
+    writer.end_object();
 }
 
 /// \brief Writes the string representation of the given GetCompositeScheduleRequest \p k to the given output stream \p
@@ -70,7 +100,7 @@ void to_json(json& j, const GetCompositeScheduleResponse& k) {
 
 void from_json(const json& j, GetCompositeScheduleResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_get_composite_schedule_status(j.at("status"));
+    k.status = conversions::string_to_get_composite_schedule_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("connectorId")) {
@@ -84,6 +114,39 @@ void from_json(const json& j, GetCompositeScheduleResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetCompositeScheduleResponse
+const JsonSaxFields& json_sax_fields(const GetCompositeScheduleResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetCompositeScheduleResponse::status,
+                       conversions::string_to_get_composite_schedule_status>("status"),
+        json_sax_field<&GetCompositeScheduleResponse::connectorId>("connectorId"),
+        json_sax_field<&GetCompositeScheduleResponse::scheduleStart>("scheduleStart"),
+        json_sax_field<&GetCompositeScheduleResponse::chargingSchedule>("chargingSchedule"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetCompositeScheduleResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetCompositeScheduleResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.chargingSchedule) {
+        writer.key("chargingSchedule");
+        write_json(writer, k.chargingSchedule.value());
+    }
+    if (k.connectorId) {
+        writer.key("connectorId");
+        writer.value(k.connectorId.value());
+    }
+    if (k.scheduleStart) {
+        writer.key("scheduleStart");
+        writer.value(k.scheduleStart.value());
+    }
+    writer.key("status");
+    writer.value(conversions::get_composite_schedule_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetCompositeScheduleResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetCompositeScheduleResponse written to
 std::ostream& operator<<(std::ostream& os, const GetCompositeScheduleResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -47,6 +50,29 @@ void from_json(const json& j, GetConfigurationRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetConfigurationRequest
+const JsonSaxFields& json_sax_fields(const GetConfigurationRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetConfigurationRequest::key>("key"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetConfigurationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetConfigurationRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.key) {
+        writer.key("key");
+        writer.begin_array();
+        for (const auto& val : k.key.value()) {
+            writer.value(val.view());
+        }
+        writer.end_array();
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetConfigurationRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetConfigurationRequest written to
 std::ostream& operator<<(std::ostream& os, const GetConfigurationRequest& k) {
@@ -106,6 +132,38 @@ void from_json(const json& j, GetConfigurationResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetConfigurationResponse
+const JsonSaxFields& json_sax_fields(const GetConfigurationResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetConfigurationResponse::configurationKey>("configurationKey"),
+        json_sax_field<&GetConfigurationResponse::unknownKey>("unknownKey"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetConfigurationResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetConfigurationResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.configurationKey) {
+        writer.key("configurationKey");
+        writer.begin_array();
+        for (const auto& val : k.configurationKey.value()) {
+            write_json(writer, val);
+        }
+        writer.end_array();
+    }
+    if (k.unknownKey) {
+        writer.key("unknownKey");
+        writer.begin_array();
+        for (const auto& val : k.unknownKey.value()) {
+            writer.value(val.view());
+        }
+        writer.end_array();
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetConfigurationResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetConfigurationResponse written to
 std::ostream& operator<<(std::ostream& os, const GetConfigurationResponse& k) {
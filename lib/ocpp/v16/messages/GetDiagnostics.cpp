@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -56,6 +59,43 @@ void from_json(const json& j, GetDiagnosticsRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetDiagnosticsRequest
+const JsonSaxFields& json_sax_fields(const GetDiagnosticsRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetDiagnosticsRequest::location>("location"),
+        json_sax_field<&GetDiagnosticsRequest::retries>("retries"),
+        json_sax_field<&GetDiagnosticsRequest::retryInterval>("retryInterval"),
+        json_sax_field<&GetDiagnosticsRequest::startTime>("startTime"),
+        json_sax_field<&GetDiagnosticsRequest::stopTime>("stopTime"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetDiagnosticsRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetDiagnosticsRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("location");
+    writer.value(k.location);
+    if (k.retries) {
+        writer.key("retries");
+        writer.value(k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.key("retryInterval");
+        writer.value(k.retryInterval.value());
+    }
+    if (k.startTime) {
+        writer.key("startTime");
+        writer.value(k.startTime.value());
+    }
+    if (k.stopTime) {
+        writer.key("stopTime");
+        writer.value(k.stopTime.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetDiagnosticsRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetDiagnosticsRequest written to
 std::ostream& operator<<(std::ostream& os, const GetDiagnosticsRequest& k) {
@@ -85,6 +125,25 @@ void from_json(const json& j, GetDiagnosticsResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetDiagnosticsResponse
+const JsonSaxFields& json_sax_fields(const GetDiagnosticsResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetDiagnosticsResponse::fileName>("fileName"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetDiagnosticsResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetDiagnosticsResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.fileName) {
+        writer.key("fileName");
+        writer.value(k.fileName.value().view());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetDiagnosticsResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetDiagnosticsResponse written to
 std::ostream& operator<<(std::ostream& os, const GetDiagnosticsResponse& k) {
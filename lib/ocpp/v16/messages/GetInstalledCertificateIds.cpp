@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -27,11 +30,31 @@ void to_json(json& j, const GetInstalledCertificateIdsRequest& k) {
 
 void from_json(const json& j, GetInstalledCertificateIdsRequest& k) {
     // the required parts of the message
-    k.certificateType = conversions::string_to_certificate_use_enum_type(j.at("certificateType"));
+    k.certificateType =
+        conversions::string_to_certificate_use_enum_type(j.at("certificateType").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetInstalledCertificateIdsRequest
+const JsonSaxFields& json_sax_fields(const GetInstalledCertificateIdsRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetInstalledCertificateIdsRequest::certificateType,
+                       conversions::string_to_certificate_use_enum_type>("certificateType"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetInstalledCertificateIdsRequest \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("certificateType");
+    writer.value(conversions::certificate_use_enum_type_to_string(k.certificateType));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetInstalledCertificateIdsRequest \p k to the given output
 /// stream \p os \returns an output stream with the GetInstalledCertificateIdsRequest written to
 std::ostream& operator<<(std::ostream& os, const GetInstalledCertificateIdsRequest& k) {
@@ -59,7 +82,8 @@ void to_json(json& j, const GetInstalledCertificateIdsResponse& k) {
 
 void from_json(const json& j, GetInstalledCertificateIdsResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_get_installed_certificate_status_enum_type(j.at("status"));
+    k.status =
+        conversions::string_to_get_installed_certificate_status_enum_type(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("certificateHashData")) {
@@ -72,6 +96,34 @@ void from_json(const json& j, GetInstalledCertificateIdsResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetInstalledCertificateIdsResponse
+const JsonSaxFields& json_sax_fields(const GetInstalledCertificateIdsResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetInstalledCertificateIdsResponse::status,
+                       conversions::string_to_get_installed_certificate_status_enum_type>("status"),
+        json_sax_field<&GetInstalledCertificateIdsResponse::certificateHashData>("certificateHashData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetInstalledCertificateIdsResponse \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.certificateHashData) {
+        writer.key("certificateHashData");
+        writer.begin_array();
+        for (const auto& val : k.certificateHashData.value()) {
+            write_json(writer, val);
+        }
+        writer.end_array();
+    }
+    writer.key("status");
+    writer.value(conversions::get_installed_certificate_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetInstalledCertificateIdsResponse \p k to the given output
 /// stream \p os \returns an output stream with the GetInstalledCertificateIdsResponse written to
 std::ostream& operator<<(std::ostream& os, const GetInstalledCertificateIdsResponse& k) {
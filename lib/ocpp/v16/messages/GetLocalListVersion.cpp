@@ -7,6 +7,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -32,6 +35,19 @@ void from_json(const json& j, GetLocalListVersionRequest& k) {
     (void)k;
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetLocalListVersionRequest
+const JsonSaxFields& json_sax_fields(const GetLocalListVersionRequest*) {
+    static const JsonSaxFields fields;
+    return fields;
+}
+
+/// \brief Writes the given GetLocalListVersionRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetLocalListVersionRequest& k) {
+    writer.begin_object();
+    writer.end_object();
+    (void)k; // no members to write, silence unused parameter warning
+}
+
 /// \brief Writes the string representation of the given GetLocalListVersionRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetLocalListVersionRequest written to
 std::ostream& operator<<(std::ostream& os, const GetLocalListVersionRequest& k) {
@@ -58,6 +74,23 @@ void from_json(const json& j, GetLocalListVersionResponse& k) {
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetLocalListVersionResponse
+const JsonSaxFields& json_sax_fields(const GetLocalListVersionResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetLocalListVersionResponse::listVersion>("listVersion"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetLocalListVersionResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetLocalListVersionResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("listVersion");
+    writer.value(k.listVersion);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetLocalListVersionResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetLocalListVersionResponse written to
 std::ostream& operator<<(std::ostream& os, const GetLocalListVersionResponse& k) {
@@ -7,6 +7,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -32,6 +35,19 @@ void from_json(const json& j, HeartbeatRequest& k) {
     (void)k;
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a HeartbeatRequest
+const JsonSaxFields& json_sax_fields(const HeartbeatRequest*) {
+    static const JsonSaxFields fields;
+    return fields;
+}
+
+/// \brief Writes the given HeartbeatRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const HeartbeatRequest& k) {
+    writer.begin_object();
+    writer.end_object();
+    (void)k; // no members to write, silence unused parameter warning
+}
+
 /// \brief Writes the string representation of the given HeartbeatRequest \p k to the given output stream \p os
 /// \returns an output stream with the HeartbeatRequest written to
 std::ostream& operator<<(std::ostream& os, const HeartbeatRequest& k) {
@@ -58,6 +74,23 @@ void from_json(const json& j, HeartbeatResponse& k) {
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a HeartbeatResponse
+const JsonSaxFields& json_sax_fields(const HeartbeatResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&HeartbeatResponse::currentTime>("currentTime"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given HeartbeatResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const HeartbeatResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("currentTime");
+    writer.value(k.currentTime);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given HeartbeatResponse \p k to the given output stream \p os
 /// \returns an output stream with the HeartbeatResponse written to
 std::ostream& operator<<(std::ostream& os, const HeartbeatResponse& k) {
@@ -7,6 +7,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -27,12 +30,34 @@ void to_json(json& j, const InstallCertificateRequest& k) {
 
 void from_json(const json& j, InstallCertificateRequest& k) {
     // the required parts of the message
-    k.certificateType = conversions::string_to_certificate_use_enum_type(j.at("certificateType"));
+    k.certificateType =
+        conversions::string_to_certificate_use_enum_type(j.at("certificateType").get_ref<const std::string&>());
     k.certificate = j.at("certificate");
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a InstallCertificateRequest
+const JsonSaxFields& json_sax_fields(const InstallCertificateRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&InstallCertificateRequest::certificateType,
+                       conversions::string_to_certificate_use_enum_type>("certificateType"),
+        json_sax_field<&InstallCertificateRequest::certificate>("certificate"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given InstallCertificateRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const InstallCertificateRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("certificate");
+    writer.value(k.certificate.view());
+    writer.key("certificateType");
+    writer.value(conversions::certificate_use_enum_type_to_string(k.certificateType));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given InstallCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the InstallCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const InstallCertificateRequest& k) {
@@ -54,11 +79,30 @@ void to_json(json& j, const InstallCertificateResponse& k) {
 
 void from_json(const json& j, InstallCertificateResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_install_certificate_status_enum_type(j.at("status"));
+    k.status =
+        conversions::string_to_install_certificate_status_enum_type(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a InstallCertificateResponse
+const JsonSaxFields& json_sax_fields(const InstallCertificateResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&InstallCertificateResponse::status,
+                       conversions::string_to_install_certificate_status_enum_type>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given InstallCertificateResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const InstallCertificateResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::install_certificate_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given InstallCertificateResponse \p k to the given output stream \p
 /// os \returns an output stream with the InstallCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const InstallCertificateResponse& k) {
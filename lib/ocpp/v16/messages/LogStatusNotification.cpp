@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -30,7 +33,7 @@ void to_json(json& j, const LogStatusNotificationRequest& k) {
 
 void from_json(const json& j, LogStatusNotificationRequest& k) {
     // the required parts of the message
-    k.status = conversions::string_to_upload_log_status_enum_type(j.at("status"));
+    k.status = conversions::string_to_upload_log_status_enum_type(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("requestId")) {
@@ -38,6 +41,29 @@ void from_json(const json& j, LogStatusNotificationRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a LogStatusNotificationRequest
+const JsonSaxFields& json_sax_fields(const LogStatusNotificationRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&LogStatusNotificationRequest::status,
+                       conversions::string_to_upload_log_status_enum_type>("status"),
+        json_sax_field<&LogStatusNotificationRequest::requestId>("requestId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given LogStatusNotificationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const LogStatusNotificationRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.requestId) {
+        writer.key("requestId");
+        writer.value(k.requestId.value());
+    }
+    writer.key("status");
+    writer.value(conversions::upload_log_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given LogStatusNotificationRequest \p k to the given output stream \p
 /// os \returns an output stream with the LogStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const LogStatusNotificationRequest& k) {
@@ -65,6 +91,19 @@ void from_json(const json& j, LogStatusNotificationResponse& k) {
     (void)k;
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a LogStatusNotificationResponse
+const JsonSaxFields& json_sax_fields(const LogStatusNotificationResponse*) {
+    static const JsonSaxFields fields;
+    return fields;
+}
+
+/// \brief Writes the given LogStatusNotificationResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const LogStatusNotificationResponse& k) {
+    writer.begin_object();
+    writer.end_object();
+    (void)k; // no members to write, silence unused parameter warning
+}
+
 /// \brief Writes the string representation of the given LogStatusNotificationResponse \p k to the given output stream
 /// \p os \returns an output stream with the LogStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const LogStatusNotificationResponse& k) {
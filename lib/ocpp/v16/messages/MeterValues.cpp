@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -42,6 +45,35 @@ void from_json(const json& j, MeterValuesRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a MeterValuesRequest
+const JsonSaxFields& json_sax_fields(const MeterValuesRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&MeterValuesRequest::connectorId>("connectorId"),
+        json_sax_field<&MeterValuesRequest::meterValue>("meterValue"),
+        json_sax_field<&MeterValuesRequest::transactionId>("transactionId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given MeterValuesRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const MeterValuesRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("connectorId");
+    writer.value(k.connectorId);
+    writer.key("meterValue");
+    writer.begin_array();
+    for (const auto& val : k.meterValue) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    if (k.transactionId) {
+        writer.key("transactionId");
+        writer.value(k.transactionId.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given MeterValuesRequest \p k to the given output stream \p os
 /// \returns an output stream with the MeterValuesRequest written to
 std::ostream& operator<<(std::ostream& os, const MeterValuesRequest& k) {
@@ -69,6 +101,19 @@ void from_json(const json& j, MeterValuesResponse& k) {
     (void)k;
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a MeterValuesResponse
+const JsonSaxFields& json_sax_fields(const MeterValuesResponse*) {
+    static const JsonSaxFields fields;
+    return fields;
+}
+
+/// \brief Writes the given MeterValuesResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const MeterValuesResponse& k) {
+    writer.begin_object();
+    writer.end_object();
+    (void)k; // no members to write, silence unused parameter warning
+}
+
 /// \brief Writes the string representation of the given MeterValuesResponse \p k to the given output stream \p os
 /// \returns an output stream with the MeterValuesResponse written to
 std::ostream& operator<<(std::ostream& os, const MeterValuesResponse& k) {
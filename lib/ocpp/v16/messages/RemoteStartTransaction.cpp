@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -44,6 +47,33 @@ void from_json(const json& j, RemoteStartTransactionRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a RemoteStartTransactionRequest
+const JsonSaxFields& json_sax_fields(const RemoteStartTransactionRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&RemoteStartTransactionRequest::idTag>("idTag"),
+        json_sax_field<&RemoteStartTransactionRequest::connectorId>("connectorId"),
+        json_sax_field<&RemoteStartTransactionRequest::chargingProfile>("chargingProfile"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given RemoteStartTransactionRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const RemoteStartTransactionRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.chargingProfile) {
+        writer.key("chargingProfile");
+        write_json(writer, k.chargingProfile.value());
+    }
+    if (k.connectorId) {
+        writer.key("connectorId");
+        writer.value(k.connectorId.value());
+    }
+    writer.key("idTag");
+    writer.value(k.idTag.view());
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given RemoteStartTransactionRequest \p k to the given output stream
 /// \p os \returns an output stream with the RemoteStartTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RemoteStartTransactionRequest& k) {
@@ -65,11 +95,29 @@ void to_json(json& j, const RemoteStartTransactionResponse& k) {
 
 void from_json(const json& j, RemoteStartTransactionResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_remote_start_stop_status(j.at("status"));
+    k.status = conversions::string_to_remote_start_stop_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a RemoteStartTransactionResponse
+const JsonSaxFields& json_sax_fields(const RemoteStartTransactionResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&RemoteStartTransactionResponse::status,
+                       conversions::string_to_remote_start_stop_status>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given RemoteStartTransactionResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const RemoteStartTransactionResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::remote_start_stop_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given RemoteStartTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RemoteStartTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RemoteStartTransactionResponse& k) {
@@ -7,6 +7,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -31,6 +34,23 @@ void from_json(const json& j, RemoteStopTransactionRequest& k) {
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a RemoteStopTransactionRequest
+const JsonSaxFields& json_sax_fields(const RemoteStopTransactionRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&RemoteStopTransactionRequest::transactionId>("transactionId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given RemoteStopTransactionRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const RemoteStopTransactionRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("transactionId");
+    writer.value(k.transactionId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given RemoteStopTransactionRequest \p k to the given output stream \p
 /// os \returns an output stream with the RemoteStopTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RemoteStopTransactionRequest& k) {
@@ -52,11 +72,29 @@ void to_json(json& j, const RemoteStopTransactionResponse& k) {
 
 void from_json(const json& j, RemoteStopTransactionResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_remote_start_stop_status(j.at("status"));
+    k.status = conversions::string_to_remote_start_stop_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a RemoteStopTransactionResponse
+const JsonSaxFields& json_sax_fields(const RemoteStopTransactionResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&RemoteStopTransactionResponse::status,
+                       conversions::string_to_remote_start_stop_status>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given RemoteStopTransactionResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const RemoteStopTransactionResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::remote_start_stop_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given RemoteStopTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RemoteStopTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RemoteStopTransactionResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -44,6 +47,37 @@ void from_json(const json& j, ReserveNowRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ReserveNowRequest
+const JsonSaxFields& json_sax_fields(const ReserveNowRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ReserveNowRequest::connectorId>("connectorId"),
+        json_sax_field<&ReserveNowRequest::expiryDate>("expiryDate"),
+        json_sax_field<&ReserveNowRequest::idTag>("idTag"),
+        json_sax_field<&ReserveNowRequest::reservationId>("reservationId"),
+        json_sax_field<&ReserveNowRequest::parentIdTag>("parentIdTag"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ReserveNowRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ReserveNowRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("connectorId");
+    writer.value(k.connectorId);
+    writer.key("expiryDate");
+    writer.value(k.expiryDate);
+    writer.key("idTag");
+    writer.value(k.idTag.view());
+    if (k.parentIdTag) {
+        writer.key("parentIdTag");
+        writer.value(k.parentIdTag.value().view());
+    }
+    writer.key("reservationId");
+    writer.value(k.reservationId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ReserveNowRequest \p k to the given output stream \p os
 /// \returns an output stream with the ReserveNowRequest written to
 std::ostream& operator<<(std::ostream& os, const ReserveNowRequest& k) {
@@ -65,11 +99,28 @@ void to_json(json& j, const ReserveNowResponse& k) {
 
 void from_json(const json& j, ReserveNowResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_reservation_status(j.at("status"));
+    k.status = conversions::string_to_reservation_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ReserveNowResponse
+const JsonSaxFields& json_sax_fields(const ReserveNowResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ReserveNowResponse::status, conversions::string_to_reservation_status>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ReserveNowResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ReserveNowResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::reservation_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ReserveNowResponse \p k to the given output stream \p os
 /// \returns an output stream with the ReserveNowResponse written to
 std::ostream& operator<<(std::ostream& os, const ReserveNowResponse& k) {
@@ -7,6 +7,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -26,11 +29,28 @@ void to_json(json& j, const ResetRequest& k) {
 
 void from_json(const json& j, ResetRequest& k) {
     // the required parts of the message
-    k.type = conversions::string_to_reset_type(j.at("type"));
+    k.type = conversions::string_to_reset_type(j.at("type").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ResetRequest
+const JsonSaxFields& json_sax_fields(const ResetRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ResetRequest::type, conversions::string_to_reset_type>("type"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ResetRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ResetRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("type");
+    writer.value(conversions::reset_type_to_string(k.type));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ResetRequest \p k to the given output stream \p os
 /// \returns an output stream with the ResetRequest written to
 std::ostream& operator<<(std::ostream& os, const ResetRequest& k) {
@@ -52,11 +72,28 @@ void to_json(json& j, const ResetResponse& k) {
 
 void from_json(const json& j, ResetResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_reset_status(j.at("status"));
+    k.status = conversions::string_to_reset_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ResetResponse
+const JsonSaxFields& json_sax_fields(const ResetResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ResetResponse::status, conversions::string_to_reset_status>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ResetResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ResetResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::reset_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ResetResponse \p k to the given output stream \p os
 /// \returns an output stream with the ResetResponse written to
 std::ostream& operator<<(std::ostream& os, const ResetResponse& k) {
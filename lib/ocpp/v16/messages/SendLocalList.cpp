@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -35,7 +38,7 @@ void to_json(json& j, const SendLocalListRequest& k) {
 void from_json(const json& j, SendLocalListRequest& k) {
     // the required parts of the message
     k.listVersion = j.at("listVersion");
-    k.updateType = conversions::string_to_update_type(j.at("updateType"));
+    k.updateType = conversions::string_to_update_type(j.at("updateType").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("localAuthorizationList")) {
@@ -48,6 +51,35 @@ void from_json(const json& j, SendLocalListRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SendLocalListRequest
+const JsonSaxFields& json_sax_fields(const SendLocalListRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SendLocalListRequest::listVersion>("listVersion"),
+        json_sax_field<&SendLocalListRequest::updateType, conversions::string_to_update_type>("updateType"),
+        json_sax_field<&SendLocalListRequest::localAuthorizationList>("localAuthorizationList"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SendLocalListRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SendLocalListRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("listVersion");
+    writer.value(k.listVersion);
+    if (k.localAuthorizationList) {
+        writer.key("localAuthorizationList");
+        writer.begin_array();
+        for (const auto& val : k.localAuthorizationList.value()) {
+            write_json(writer, val);
+        }
+        writer.end_array();
+    }
+    writer.key("updateType");
+    writer.value(conversions::update_type_to_string(k.updateType));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SendLocalListRequest \p k to the given output stream \p os
 /// \returns an output stream with the SendLocalListRequest written to
 std::ostream& operator<<(std::ostream& os, const SendLocalListRequest& k) {
@@ -69,11 +101,28 @@ void to_json(json& j, const SendLocalListResponse& k) {
 
 void from_json(const json& j, SendLocalListResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_update_status(j.at("status"));
+    k.status = conversions::string_to_update_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SendLocalListResponse
+const JsonSaxFields& json_sax_fields(const SendLocalListResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SendLocalListResponse::status, conversions::string_to_update_status>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SendLocalListResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SendLocalListResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::update_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SendLocalListResponse \p k to the given output stream \p os
 /// \returns an output stream with the SendLocalListResponse written to
 std::ostream& operator<<(std::ostream& os, const SendLocalListResponse& k) {
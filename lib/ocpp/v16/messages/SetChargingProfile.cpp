@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -34,6 +37,26 @@ void from_json(const json& j, SetChargingProfileRequest& k) {
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetChargingProfileRequest
+const JsonSaxFields& json_sax_fields(const SetChargingProfileRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetChargingProfileRequest::connectorId>("connectorId"),
+        json_sax_field<&SetChargingProfileRequest::csChargingProfiles>("csChargingProfiles"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetChargingProfileRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetChargingProfileRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("connectorId");
+    writer.value(k.connectorId);
+    writer.key("csChargingProfiles");
+    write_json(writer, k.csChargingProfiles);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetChargingProfileRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetChargingProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const SetChargingProfileRequest& k) {
@@ -55,11 +78,28 @@ void to_json(json& j, const SetChargingProfileResponse& k) {
 
 void from_json(const json& j, SetChargingProfileResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_charging_profile_status(j.at("status"));
+    k.status = conversions::string_to_charging_profile_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetChargingProfileResponse
+const JsonSaxFields& json_sax_fields(const SetChargingProfileResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetChargingProfileResponse::status, conversions::string_to_charging_profile_status>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetChargingProfileResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetChargingProfileResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::charging_profile_status_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetChargingProfileResponse \p k to the given output stream \p
 /// os \returns an output stream with the SetChargingProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const SetChargingProfileResponse& k) {
@@ -7,6 +7,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -31,6 +34,23 @@ void from_json(const json& j, SignCertificateRequest& k) {
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SignCertificateRequest
+const JsonSaxFields& json_sax_fields(const SignCertificateRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SignCertificateRequest::csr>("csr"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SignCertificateRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SignCertificateRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("csr");
+    writer.value(k.csr.view());
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SignCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the SignCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const SignCertificateRequest& k) {
@@ -52,11 +72,28 @@ void to_json(json& j, const SignCertificateResponse& k) {
 
 void from_json(const json& j, SignCertificateResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_status_enum_type(j.at("status"));
+    k.status = conversions::string_to_generic_status_enum_type(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SignCertificateResponse
+const JsonSaxFields& json_sax_fields(const SignCertificateResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SignCertificateResponse::status, conversions::string_to_generic_status_enum_type>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SignCertificateResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SignCertificateResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::generic_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SignCertificateResponse \p k to the given output stream \p os
 /// \returns an output stream with the SignCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const SignCertificateResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -30,7 +33,7 @@ void to_json(json& j, const SignedFirmwareStatusNotificationRequest& k) {
 
 void from_json(const json& j, SignedFirmwareStatusNotificationRequest& k) {
     // the required parts of the message
-    k.status = conversions::string_to_firmware_status_enum_type(j.at("status"));
+    k.status = conversions::string_to_firmware_status_enum_type(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("requestId")) {
@@ -38,6 +41,31 @@ void from_json(const json& j, SignedFirmwareStatusNotificationRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a
+/// SignedFirmwareStatusNotificationRequest
+const JsonSaxFields& json_sax_fields(const SignedFirmwareStatusNotificationRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SignedFirmwareStatusNotificationRequest::status,
+                       conversions::string_to_firmware_status_enum_type>("status"),
+        json_sax_field<&SignedFirmwareStatusNotificationRequest::requestId>("requestId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SignedFirmwareStatusNotificationRequest \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const SignedFirmwareStatusNotificationRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.requestId) {
+        writer.key("requestId");
+        writer.value(k.requestId.value());
+    }
+    writer.key("status");
+    writer.value(conversions::firmware_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SignedFirmwareStatusNotificationRequest \p k to the given
 /// output stream \p os \returns an output stream with the SignedFirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const SignedFirmwareStatusNotificationRequest& k) {
@@ -65,6 +93,21 @@ void from_json(const json& j, SignedFirmwareStatusNotificationResponse& k) {
     (void)k;
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a
+/// SignedFirmwareStatusNotificationResponse
+const JsonSaxFields& json_sax_fields(const SignedFirmwareStatusNotificationResponse*) {
+    static const JsonSaxFields fields;
+    return fields;
+}
+
+/// \brief Writes the given SignedFirmwareStatusNotificationResponse \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const SignedFirmwareStatusNotificationResponse& k) {
+    writer.begin_object();
+    writer.end_object();
+    (void)k; // no members to write, silence unused parameter warning
+}
+
 /// \brief Writes the string representation of the given SignedFirmwareStatusNotificationResponse \p k to the given
 /// output stream \p os \returns an output stream with the SignedFirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const SignedFirmwareStatusNotificationResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -46,6 +49,36 @@ void from_json(const json& j, SignedUpdateFirmwareRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SignedUpdateFirmwareRequest
+const JsonSaxFields& json_sax_fields(const SignedUpdateFirmwareRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SignedUpdateFirmwareRequest::requestId>("requestId"),
+        json_sax_field<&SignedUpdateFirmwareRequest::firmware>("firmware"),
+        json_sax_field<&SignedUpdateFirmwareRequest::retries>("retries"),
+        json_sax_field<&SignedUpdateFirmwareRequest::retryInterval>("retryInterval"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SignedUpdateFirmwareRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SignedUpdateFirmwareRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("firmware");
+    write_json(writer, k.firmware);
+    writer.key("requestId");
+    writer.value(k.requestId);
+    if (k.retries) {
+        writer.key("retries");
+        writer.value(k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.key("retryInterval");
+        writer.value(k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SignedUpdateFirmwareRequest \p k to the given output stream \p
 /// os \returns an output stream with the SignedUpdateFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const SignedUpdateFirmwareRequest& k) {
@@ -67,11 +100,29 @@ void to_json(json& j, const SignedUpdateFirmwareResponse& k) {
 
 void from_json(const json& j, SignedUpdateFirmwareResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_update_firmware_status_enum_type(j.at("status"));
+    k.status = conversions::string_to_update_firmware_status_enum_type(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SignedUpdateFirmwareResponse
+const JsonSaxFields& json_sax_fields(const SignedUpdateFirmwareResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SignedUpdateFirmwareResponse::status,
+                       conversions::string_to_update_firmware_status_enum_type>("status"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SignedUpdateFirmwareResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SignedUpdateFirmwareResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("status");
+    writer.value(conversions::update_firmware_status_enum_type_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SignedUpdateFirmwareResponse \p k to the given output stream \p
 /// os \returns an output stream with the SignedUpdateFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const SignedUpdateFirmwareResponse& k) {
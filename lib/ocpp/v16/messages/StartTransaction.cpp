@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -44,6 +47,37 @@ void from_json(const json& j, StartTransactionRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a StartTransactionRequest
+const JsonSaxFields& json_sax_fields(const StartTransactionRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&StartTransactionRequest::connectorId>("connectorId"),
+        json_sax_field<&StartTransactionRequest::idTag>("idTag"),
+        json_sax_field<&StartTransactionRequest::meterStart>("meterStart"),
+        json_sax_field<&StartTransactionRequest::timestamp>("timestamp"),
+        json_sax_field<&StartTransactionRequest::reservationId>("reservationId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given StartTransactionRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const StartTransactionRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("connectorId");
+    writer.value(k.connectorId);
+    writer.key("idTag");
+    writer.value(k.idTag.view());
+    writer.key("meterStart");
+    writer.value(k.meterStart);
+    if (k.reservationId) {
+        writer.key("reservationId");
+        writer.value(k.reservationId.value());
+    }
+    writer.key("timestamp");
+    writer.value(k.timestamp);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given StartTransactionRequest \p k to the given output stream \p os
 /// \returns an output stream with the StartTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const StartTransactionRequest& k) {
@@ -72,6 +106,26 @@ void from_json(const json& j, StartTransactionResponse& k) {
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a StartTransactionResponse
+const JsonSaxFields& json_sax_fields(const StartTransactionResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&StartTransactionResponse::idTagInfo>("idTagInfo"),
+        json_sax_field<&StartTransactionResponse::transactionId>("transactionId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given StartTransactionResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const StartTransactionResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("idTagInfo");
+    write_json(writer, k.idTagInfo);
+    writer.key("transactionId");
+    writer.value(k.transactionId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given StartTransactionResponse \p k to the given output stream \p os
 /// \returns an output stream with the StartTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const StartTransactionResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -42,8 +45,8 @@ void to_json(json& j, const StatusNotificationRequest& k) {
 void from_json(const json& j, StatusNotificationRequest& k) {
     // the required parts of the message
     k.connectorId = j.at("connectorId");
-    k.errorCode = conversions::string_to_charge_point_error_code(j.at("errorCode"));
-    k.status = conversions::string_to_charge_point_status(j.at("status"));
+    k.errorCode = conversions::string_to_charge_point_error_code(j.at("errorCode").get_ref<const std::string&>());
+    k.status = conversions::string_to_charge_point_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("info")) {
@@ -60,6 +63,50 @@ void from_json(const json& j, StatusNotificationRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a StatusNotificationRequest
+const JsonSaxFields& json_sax_fields(const StatusNotificationRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&StatusNotificationRequest::connectorId>("connectorId"),
+        json_sax_field<&StatusNotificationRequest::errorCode,
+                       conversions::string_to_charge_point_error_code>("errorCode"),
+        json_sax_field<&StatusNotificationRequest::status, conversions::string_to_charge_point_status>("status"),
+        json_sax_field<&StatusNotificationRequest::info>("info"),
+        json_sax_field<&StatusNotificationRequest::timestamp>("timestamp"),
+        json_sax_field<&StatusNotificationRequest::vendorId>("vendorId"),
+        json_sax_field<&StatusNotificationRequest::vendorErrorCode>("vendorErrorCode"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given StatusNotificationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const StatusNotificationRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("connectorId");
+    writer.value(k.connectorId);
+    writer.key("errorCode");
+    writer.value(conversions::charge_point_error_code_to_string(k.errorCode));
+    if (k.info) {
+        writer.key("info");
+        writer.value(k.info.value().view());
+    }
+    writer.key("status");
+    writer.value(conversions::charge_point_status_to_string(k.status));
+    if (k.timestamp) {
+        writer.key("timestamp");
+        writer.value(k.timestamp.value());
+    }
+    if (k.vendorErrorCode) {
+        writer.key("vendorErrorCode");
+        writer.value(k.vendorErrorCode.value().view());
+    }
+    if (k.vendorId) {
+        writer.key("vendorId");
+        writer.value(k.vendorId.value().view());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given StatusNotificationRequest \p k to the given output stream \p os
 /// \returns an output stream with the StatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const StatusNotificationRequest& k) {
@@ -87,6 +134,19 @@ void from_json(const json& j, StatusNotificationResponse& k) {
     (void)k;
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a StatusNotificationResponse
+const JsonSaxFields& json_sax_fields(const StatusNotificationResponse*) {
+    static const JsonSaxFields fields;
+    return fields;
+}
+
+/// \brief Writes the given StatusNotificationResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const StatusNotificationResponse& k) {
+    writer.begin_object();
+    writer.end_object();
+    (void)k; // no members to write, silence unused parameter warning
+}
+
 /// \brief Writes the string representation of the given StatusNotificationResponse \p k to the given output stream \p
 /// os \returns an output stream with the StatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const StatusNotificationResponse& k) {
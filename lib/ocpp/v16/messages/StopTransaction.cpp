@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -50,7 +53,7 @@ void from_json(const json& j, StopTransactionRequest& k) {
         k.idTag.emplace(j.at("idTag"));
     }
     if (j.contains("reason")) {
-        k.reason.emplace(conversions::string_to_reason(j.at("reason")));
+        k.reason.emplace(conversions::string_to_reason(j.at("reason").get_ref<const std::string&>()));
     }
     if (j.contains("transactionData")) {
         json arr = j.at("transactionData");
@@ -62,6 +65,48 @@ void from_json(const json& j, StopTransactionRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a StopTransactionRequest
+const JsonSaxFields& json_sax_fields(const StopTransactionRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&StopTransactionRequest::meterStop>("meterStop"),
+        json_sax_field<&StopTransactionRequest::timestamp>("timestamp"),
+        json_sax_field<&StopTransactionRequest::transactionId>("transactionId"),
+        json_sax_field<&StopTransactionRequest::idTag>("idTag"),
+        json_sax_field<&StopTransactionRequest::reason, conversions::string_to_reason>("reason"),
+        json_sax_field<&StopTransactionRequest::transactionData>("transactionData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given StopTransactionRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const StopTransactionRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.idTag) {
+        writer.key("idTag");
+        writer.value(k.idTag.value().view());
+    }
+    writer.key("meterStop");
+    writer.value(k.meterStop);
+    if (k.reason) {
+        writer.key("reason");
+        writer.value(conversions::reason_to_string(k.reason.value()));
+    }
+    writer.key("timestamp");
+    writer.value(k.timestamp);
+    if (k.transactionData) {
+        writer.key("transactionData");
+        writer.begin_array();
+        for (const auto& val : k.transactionData.value()) {
+            write_json(writer, val);
+        }
+        writer.end_array();
+    }
+    writer.key("transactionId");
+    writer.value(k.transactionId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given StopTransactionRequest \p k to the given output stream \p os
 /// \returns an output stream with the StopTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const StopTransactionRequest& k) {
@@ -91,6 +136,25 @@ void from_json(const json& j, StopTransactionResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a StopTransactionResponse
+const JsonSaxFields& json_sax_fields(const StopTransactionResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&StopTransactionResponse::idTagInfo>("idTagInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given StopTransactionResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const StopTransactionResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.idTagInfo) {
+        writer.key("idTagInfo");
+        write_json(writer, k.idTagInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given StopTransactionResponse \p k to the given output stream \p os
 /// \returns an output stream with the StopTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const StopTransactionResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -46,6 +49,36 @@ void from_json(const json& j, UpdateFirmwareRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a UpdateFirmwareRequest
+const JsonSaxFields& json_sax_fields(const UpdateFirmwareRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&UpdateFirmwareRequest::location>("location"),
+        json_sax_field<&UpdateFirmwareRequest::retrieveDate>("retrieveDate"),
+        json_sax_field<&UpdateFirmwareRequest::retries>("retries"),
+        json_sax_field<&UpdateFirmwareRequest::retryInterval>("retryInterval"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given UpdateFirmwareRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const UpdateFirmwareRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("location");
+    writer.value(k.location);
+    if (k.retries) {
+        writer.key("retries");
+        writer.value(k.retries.value());
+    }
+    writer.key("retrieveDate");
+    writer.value(k.retrieveDate);
+    if (k.retryInterval) {
+        writer.key("retryInterval");
+        writer.value(k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given UpdateFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the UpdateFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const UpdateFirmwareRequest& k) {
@@ -73,6 +106,19 @@ void from_json(const json& j, UpdateFirmwareResponse& k) {
     (void)k;
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a UpdateFirmwareResponse
+const JsonSaxFields& json_sax_fields(const UpdateFirmwareResponse*) {
+    static const JsonSaxFields fields;
+    return fields;
+}
+
+/// \brief Writes the given UpdateFirmwareResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const UpdateFirmwareResponse& k) {
+    writer.begin_object();
+    writer.end_object();
+    (void)k; // no members to write, silence unused parameter warning
+}
+
 /// \brief Writes the string representation of the given UpdateFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the UpdateFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const UpdateFirmwareResponse& k) {
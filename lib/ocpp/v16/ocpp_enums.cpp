@@ -5,6 +5,7 @@
 #include <ocpp/v16/ocpp_enums.hpp>
 
 #include <string>
+#include <string_view>
 
 #include <ocpp/common/types.hpp>
 
@@ -30,21 +31,29 @@ std::string authorization_status_to_string(AuthorizationStatus e) {
     throw EnumToStringException{e, "AuthorizationStatus"};
 }
 
-AuthorizationStatus string_to_authorization_status(const std::string& s) {
-    if (s == "Accepted") {
-        return AuthorizationStatus::Accepted;
-    }
-    if (s == "Blocked") {
-        return AuthorizationStatus::Blocked;
-    }
-    if (s == "Expired") {
-        return AuthorizationStatus::Expired;
-    }
-    if (s == "Invalid") {
-        return AuthorizationStatus::Invalid;
-    }
-    if (s == "ConcurrentTx") {
-        return AuthorizationStatus::ConcurrentTx;
+AuthorizationStatus string_to_authorization_status(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Blocked") {
+            return AuthorizationStatus::Blocked;
+        }
+        if (s == "Expired") {
+            return AuthorizationStatus::Expired;
+        }
+        if (s == "Invalid") {
+            return AuthorizationStatus::Invalid;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return AuthorizationStatus::Accepted;
+        }
+        break;
+    case 12:
+        if (s == "ConcurrentTx") {
+            return AuthorizationStatus::ConcurrentTx;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "AuthorizationStatus"};
@@ -71,15 +80,21 @@ std::string registration_status_to_string(RegistrationStatus e) {
     throw EnumToStringException{e, "RegistrationStatus"};
 }
 
-RegistrationStatus string_to_registration_status(const std::string& s) {
-    if (s == "Accepted") {
-        return RegistrationStatus::Accepted;
-    }
-    if (s == "Pending") {
-        return RegistrationStatus::Pending;
-    }
-    if (s == "Rejected") {
-        return RegistrationStatus::Rejected;
+RegistrationStatus string_to_registration_status(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Pending") {
+            return RegistrationStatus::Pending;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return RegistrationStatus::Accepted;
+        }
+        if (s == "Rejected") {
+            return RegistrationStatus::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "RegistrationStatus"};
@@ -104,12 +119,16 @@ std::string cancel_reservation_status_to_string(CancelReservationStatus e) {
     throw EnumToStringException{e, "CancelReservationStatus"};
 }
 
-CancelReservationStatus string_to_cancel_reservation_status(const std::string& s) {
-    if (s == "Accepted") {
-        return CancelReservationStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return CancelReservationStatus::Rejected;
+CancelReservationStatus string_to_cancel_reservation_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return CancelReservationStatus::Accepted;
+        }
+        if (s == "Rejected") {
+            return CancelReservationStatus::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "CancelReservationStatus"};
@@ -134,12 +153,16 @@ std::string certificate_signed_status_enum_type_to_string(CertificateSignedStatu
     throw EnumToStringException{e, "CertificateSignedStatusEnumType"};
 }
 
-CertificateSignedStatusEnumType string_to_certificate_signed_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return CertificateSignedStatusEnumType::Accepted;
-    }
-    if (s == "Rejected") {
-        return CertificateSignedStatusEnumType::Rejected;
+CertificateSignedStatusEnumType string_to_certificate_signed_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return CertificateSignedStatusEnumType::Accepted;
+        }
+        if (s == "Rejected") {
+            return CertificateSignedStatusEnumType::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "CertificateSignedStatusEnumType"};
@@ -164,12 +187,18 @@ std::string availability_type_to_string(AvailabilityType e) {
     throw EnumToStringException{e, "AvailabilityType"};
 }
 
-AvailabilityType string_to_availability_type(const std::string& s) {
-    if (s == "Inoperative") {
-        return AvailabilityType::Inoperative;
-    }
-    if (s == "Operative") {
-        return AvailabilityType::Operative;
+AvailabilityType string_to_availability_type(std::string_view s) {
+    switch (s.size()) {
+    case 9:
+        if (s == "Operative") {
+            return AvailabilityType::Operative;
+        }
+        break;
+    case 11:
+        if (s == "Inoperative") {
+            return AvailabilityType::Inoperative;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "AvailabilityType"};
@@ -196,15 +225,21 @@ std::string availability_status_to_string(AvailabilityStatus e) {
     throw EnumToStringException{e, "AvailabilityStatus"};
 }
 
-AvailabilityStatus string_to_availability_status(const std::string& s) {
-    if (s == "Accepted") {
-        return AvailabilityStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return AvailabilityStatus::Rejected;
-    }
-    if (s == "Scheduled") {
-        return AvailabilityStatus::Scheduled;
+AvailabilityStatus string_to_availability_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return AvailabilityStatus::Accepted;
+        }
+        if (s == "Rejected") {
+            return AvailabilityStatus::Rejected;
+        }
+        break;
+    case 9:
+        if (s == "Scheduled") {
+            return AvailabilityStatus::Scheduled;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "AvailabilityStatus"};
@@ -233,18 +268,26 @@ std::string configuration_status_to_string(ConfigurationStatus e) {
     throw EnumToStringException{e, "ConfigurationStatus"};
 }
 
-ConfigurationStatus string_to_configuration_status(const std::string& s) {
-    if (s == "Accepted") {
-        return ConfigurationStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return ConfigurationStatus::Rejected;
-    }
-    if (s == "RebootRequired") {
-        return ConfigurationStatus::RebootRequired;
-    }
-    if (s == "NotSupported") {
-        return ConfigurationStatus::NotSupported;
+ConfigurationStatus string_to_configuration_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return ConfigurationStatus::Accepted;
+        }
+        if (s == "Rejected") {
+            return ConfigurationStatus::Rejected;
+        }
+        break;
+    case 12:
+        if (s == "NotSupported") {
+            return ConfigurationStatus::NotSupported;
+        }
+        break;
+    case 14:
+        if (s == "RebootRequired") {
+            return ConfigurationStatus::RebootRequired;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ConfigurationStatus"};
@@ -269,12 +312,16 @@ std::string clear_cache_status_to_string(ClearCacheStatus e) {
     throw EnumToStringException{e, "ClearCacheStatus"};
 }
 
-ClearCacheStatus string_to_clear_cache_status(const std::string& s) {
-    if (s == "Accepted") {
-        return ClearCacheStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return ClearCacheStatus::Rejected;
+ClearCacheStatus string_to_clear_cache_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return ClearCacheStatus::Accepted;
+        }
+        if (s == "Rejected") {
+            return ClearCacheStatus::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ClearCacheStatus"};
@@ -301,15 +348,23 @@ std::string charging_profile_purpose_type_to_string(ChargingProfilePurposeType e
     throw EnumToStringException{e, "ChargingProfilePurposeType"};
 }
 
-ChargingProfilePurposeType string_to_charging_profile_purpose_type(const std::string& s) {
-    if (s == "ChargePointMaxProfile") {
-        return ChargingProfilePurposeType::ChargePointMaxProfile;
-    }
-    if (s == "TxDefaultProfile") {
-        return ChargingProfilePurposeType::TxDefaultProfile;
-    }
-    if (s == "TxProfile") {
-        return ChargingProfilePurposeType::TxProfile;
+ChargingProfilePurposeType string_to_charging_profile_purpose_type(std::string_view s) {
+    switch (s.size()) {
+    case 9:
+        if (s == "TxProfile") {
+            return ChargingProfilePurposeType::TxProfile;
+        }
+        break;
+    case 16:
+        if (s == "TxDefaultProfile") {
+            return ChargingProfilePurposeType::TxDefaultProfile;
+        }
+        break;
+    case 21:
+        if (s == "ChargePointMaxProfile") {
+            return ChargingProfilePurposeType::ChargePointMaxProfile;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingProfilePurposeType"};
@@ -334,12 +389,18 @@ std::string clear_charging_profile_status_to_string(ClearChargingProfileStatus e
     throw EnumToStringException{e, "ClearChargingProfileStatus"};
 }
 
-ClearChargingProfileStatus string_to_clear_charging_profile_status(const std::string& s) {
-    if (s == "Accepted") {
-        return ClearChargingProfileStatus::Accepted;
-    }
-    if (s == "Unknown") {
-        return ClearChargingProfileStatus::Unknown;
+ClearChargingProfileStatus string_to_clear_charging_profile_status(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Unknown") {
+            return ClearChargingProfileStatus::Unknown;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return ClearChargingProfileStatus::Accepted;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ClearChargingProfileStatus"};
@@ -368,18 +429,26 @@ std::string data_transfer_status_to_string(DataTransferStatus e) {
     throw EnumToStringException{e, "DataTransferStatus"};
 }
 
-DataTransferStatus string_to_data_transfer_status(const std::string& s) {
-    if (s == "Accepted") {
-        return DataTransferStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return DataTransferStatus::Rejected;
-    }
-    if (s == "UnknownMessageId") {
-        return DataTransferStatus::UnknownMessageId;
-    }
-    if (s == "UnknownVendorId") {
-        return DataTransferStatus::UnknownVendorId;
+DataTransferStatus string_to_data_transfer_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return DataTransferStatus::Accepted;
+        }
+        if (s == "Rejected") {
+            return DataTransferStatus::Rejected;
+        }
+        break;
+    case 15:
+        if (s == "UnknownVendorId") {
+            return DataTransferStatus::UnknownVendorId;
+        }
+        break;
+    case 16:
+        if (s == "UnknownMessageId") {
+            return DataTransferStatus::UnknownMessageId;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "DataTransferStatus"};
@@ -406,15 +475,19 @@ std::string hash_algorithm_enum_type_to_string(HashAlgorithmEnumType e) {
     throw EnumToStringException{e, "HashAlgorithmEnumType"};
 }
 
-HashAlgorithmEnumType string_to_hash_algorithm_enum_type(const std::string& s) {
-    if (s == "SHA256") {
-        return HashAlgorithmEnumType::SHA256;
-    }
-    if (s == "SHA384") {
-        return HashAlgorithmEnumType::SHA384;
-    }
-    if (s == "SHA512") {
-        return HashAlgorithmEnumType::SHA512;
+HashAlgorithmEnumType string_to_hash_algorithm_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "SHA256") {
+            return HashAlgorithmEnumType::SHA256;
+        }
+        if (s == "SHA384") {
+            return HashAlgorithmEnumType::SHA384;
+        }
+        if (s == "SHA512") {
+            return HashAlgorithmEnumType::SHA512;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "HashAlgorithmEnumType"};
@@ -441,15 +514,21 @@ std::string delete_certificate_status_enum_type_to_string(DeleteCertificateStatu
     throw EnumToStringException{e, "DeleteCertificateStatusEnumType"};
 }
 
-DeleteCertificateStatusEnumType string_to_delete_certificate_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return DeleteCertificateStatusEnumType::Accepted;
-    }
-    if (s == "Failed") {
-        return DeleteCertificateStatusEnumType::Failed;
-    }
-    if (s == "NotFound") {
-        return DeleteCertificateStatusEnumType::NotFound;
+DeleteCertificateStatusEnumType string_to_delete_certificate_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return DeleteCertificateStatusEnumType::Failed;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return DeleteCertificateStatusEnumType::Accepted;
+        }
+        if (s == "NotFound") {
+            return DeleteCertificateStatusEnumType::NotFound;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "DeleteCertificateStatusEnumType"};
@@ -478,18 +557,28 @@ std::string diagnostics_status_to_string(DiagnosticsStatus e) {
     throw EnumToStringException{e, "DiagnosticsStatus"};
 }
 
-DiagnosticsStatus string_to_diagnostics_status(const std::string& s) {
-    if (s == "Idle") {
-        return DiagnosticsStatus::Idle;
-    }
-    if (s == "Uploaded") {
-        return DiagnosticsStatus::Uploaded;
-    }
-    if (s == "UploadFailed") {
-        return DiagnosticsStatus::UploadFailed;
-    }
-    if (s == "Uploading") {
-        return DiagnosticsStatus::Uploading;
+DiagnosticsStatus string_to_diagnostics_status(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return DiagnosticsStatus::Idle;
+        }
+        break;
+    case 8:
+        if (s == "Uploaded") {
+            return DiagnosticsStatus::Uploaded;
+        }
+        break;
+    case 9:
+        if (s == "Uploading") {
+            return DiagnosticsStatus::Uploading;
+        }
+        break;
+    case 12:
+        if (s == "UploadFailed") {
+            return DiagnosticsStatus::UploadFailed;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "DiagnosticsStatus"};
@@ -524,27 +613,41 @@ std::string message_trigger_enum_type_to_string(MessageTriggerEnumType e) {
     throw EnumToStringException{e, "MessageTriggerEnumType"};
 }
 
-MessageTriggerEnumType string_to_message_trigger_enum_type(const std::string& s) {
-    if (s == "BootNotification") {
-        return MessageTriggerEnumType::BootNotification;
-    }
-    if (s == "LogStatusNotification") {
-        return MessageTriggerEnumType::LogStatusNotification;
-    }
-    if (s == "FirmwareStatusNotification") {
-        return MessageTriggerEnumType::FirmwareStatusNotification;
-    }
-    if (s == "Heartbeat") {
-        return MessageTriggerEnumType::Heartbeat;
-    }
-    if (s == "MeterValues") {
-        return MessageTriggerEnumType::MeterValues;
-    }
-    if (s == "SignChargePointCertificate") {
-        return MessageTriggerEnumType::SignChargePointCertificate;
-    }
-    if (s == "StatusNotification") {
-        return MessageTriggerEnumType::StatusNotification;
+MessageTriggerEnumType string_to_message_trigger_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 9:
+        if (s == "Heartbeat") {
+            return MessageTriggerEnumType::Heartbeat;
+        }
+        break;
+    case 11:
+        if (s == "MeterValues") {
+            return MessageTriggerEnumType::MeterValues;
+        }
+        break;
+    case 16:
+        if (s == "BootNotification") {
+            return MessageTriggerEnumType::BootNotification;
+        }
+        break;
+    case 18:
+        if (s == "StatusNotification") {
+            return MessageTriggerEnumType::StatusNotification;
+        }
+        break;
+    case 21:
+        if (s == "LogStatusNotification") {
+            return MessageTriggerEnumType::LogStatusNotification;
+        }
+        break;
+    case 26:
+        if (s == "FirmwareStatusNotification") {
+            return MessageTriggerEnumType::FirmwareStatusNotification;
+        }
+        if (s == "SignChargePointCertificate") {
+            return MessageTriggerEnumType::SignChargePointCertificate;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MessageTriggerEnumType"};
@@ -571,15 +674,21 @@ std::string trigger_message_status_enum_type_to_string(TriggerMessageStatusEnumT
     throw EnumToStringException{e, "TriggerMessageStatusEnumType"};
 }
 
-TriggerMessageStatusEnumType string_to_trigger_message_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return TriggerMessageStatusEnumType::Accepted;
-    }
-    if (s == "Rejected") {
-        return TriggerMessageStatusEnumType::Rejected;
-    }
-    if (s == "NotImplemented") {
-        return TriggerMessageStatusEnumType::NotImplemented;
+TriggerMessageStatusEnumType string_to_trigger_message_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return TriggerMessageStatusEnumType::Accepted;
+        }
+        if (s == "Rejected") {
+            return TriggerMessageStatusEnumType::Rejected;
+        }
+        break;
+    case 14:
+        if (s == "NotImplemented") {
+            return TriggerMessageStatusEnumType::NotImplemented;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "TriggerMessageStatusEnumType"};
@@ -614,27 +723,41 @@ std::string firmware_status_to_string(FirmwareStatus e) {
     throw EnumToStringException{e, "FirmwareStatus"};
 }
 
-FirmwareStatus string_to_firmware_status(const std::string& s) {
-    if (s == "Downloaded") {
-        return FirmwareStatus::Downloaded;
-    }
-    if (s == "DownloadFailed") {
-        return FirmwareStatus::DownloadFailed;
-    }
-    if (s == "Downloading") {
-        return FirmwareStatus::Downloading;
-    }
-    if (s == "Idle") {
-        return FirmwareStatus::Idle;
-    }
-    if (s == "InstallationFailed") {
-        return FirmwareStatus::InstallationFailed;
-    }
-    if (s == "Installing") {
-        return FirmwareStatus::Installing;
-    }
-    if (s == "Installed") {
-        return FirmwareStatus::Installed;
+FirmwareStatus string_to_firmware_status(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return FirmwareStatus::Idle;
+        }
+        break;
+    case 9:
+        if (s == "Installed") {
+            return FirmwareStatus::Installed;
+        }
+        break;
+    case 10:
+        if (s == "Downloaded") {
+            return FirmwareStatus::Downloaded;
+        }
+        if (s == "Installing") {
+            return FirmwareStatus::Installing;
+        }
+        break;
+    case 11:
+        if (s == "Downloading") {
+            return FirmwareStatus::Downloading;
+        }
+        break;
+    case 14:
+        if (s == "DownloadFailed") {
+            return FirmwareStatus::DownloadFailed;
+        }
+        break;
+    case 18:
+        if (s == "InstallationFailed") {
+            return FirmwareStatus::InstallationFailed;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "FirmwareStatus"};
@@ -659,12 +782,16 @@ std::string charging_rate_unit_to_string(ChargingRateUnit e) {
     throw EnumToStringException{e, "ChargingRateUnit"};
 }
 
-ChargingRateUnit string_to_charging_rate_unit(const std::string& s) {
-    if (s == "A") {
-        return ChargingRateUnit::A;
-    }
-    if (s == "W") {
-        return ChargingRateUnit::W;
+ChargingRateUnit string_to_charging_rate_unit(std::string_view s) {
+    switch (s.size()) {
+    case 1:
+        if (s == "A") {
+            return ChargingRateUnit::A;
+        }
+        if (s == "W") {
+            return ChargingRateUnit::W;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingRateUnit"};
@@ -689,12 +816,16 @@ std::string get_composite_schedule_status_to_string(GetCompositeScheduleStatus e
     throw EnumToStringException{e, "GetCompositeScheduleStatus"};
 }
 
-GetCompositeScheduleStatus string_to_get_composite_schedule_status(const std::string& s) {
-    if (s == "Accepted") {
-        return GetCompositeScheduleStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return GetCompositeScheduleStatus::Rejected;
+GetCompositeScheduleStatus string_to_get_composite_schedule_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return GetCompositeScheduleStatus::Accepted;
+        }
+        if (s == "Rejected") {
+            return GetCompositeScheduleStatus::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GetCompositeScheduleStatus"};
@@ -719,12 +850,18 @@ std::string certificate_use_enum_type_to_string(CertificateUseEnumType e) {
     throw EnumToStringException{e, "CertificateUseEnumType"};
 }
 
-CertificateUseEnumType string_to_certificate_use_enum_type(const std::string& s) {
-    if (s == "CentralSystemRootCertificate") {
-        return CertificateUseEnumType::CentralSystemRootCertificate;
-    }
-    if (s == "ManufacturerRootCertificate") {
-        return CertificateUseEnumType::ManufacturerRootCertificate;
+CertificateUseEnumType string_to_certificate_use_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 27:
+        if (s == "ManufacturerRootCertificate") {
+            return CertificateUseEnumType::ManufacturerRootCertificate;
+        }
+        break;
+    case 28:
+        if (s == "CentralSystemRootCertificate") {
+            return CertificateUseEnumType::CentralSystemRootCertificate;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "CertificateUseEnumType"};
@@ -749,12 +886,16 @@ std::string get_installed_certificate_status_enum_type_to_string(GetInstalledCer
     throw EnumToStringException{e, "GetInstalledCertificateStatusEnumType"};
 }
 
-GetInstalledCertificateStatusEnumType string_to_get_installed_certificate_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return GetInstalledCertificateStatusEnumType::Accepted;
-    }
-    if (s == "NotFound") {
-        return GetInstalledCertificateStatusEnumType::NotFound;
+GetInstalledCertificateStatusEnumType string_to_get_installed_certificate_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return GetInstalledCertificateStatusEnumType::Accepted;
+        }
+        if (s == "NotFound") {
+            return GetInstalledCertificateStatusEnumType::NotFound;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GetInstalledCertificateStatusEnumType"};
@@ -780,12 +921,18 @@ std::string log_enum_type_to_string(LogEnumType e) {
     throw EnumToStringException{e, "LogEnumType"};
 }
 
-LogEnumType string_to_log_enum_type(const std::string& s) {
-    if (s == "DiagnosticsLog") {
-        return LogEnumType::DiagnosticsLog;
-    }
-    if (s == "SecurityLog") {
-        return LogEnumType::SecurityLog;
+LogEnumType string_to_log_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 11:
+        if (s == "SecurityLog") {
+            return LogEnumType::SecurityLog;
+        }
+        break;
+    case 14:
+        if (s == "DiagnosticsLog") {
+            return LogEnumType::DiagnosticsLog;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "LogEnumType"};
@@ -812,15 +959,21 @@ std::string log_status_enum_type_to_string(LogStatusEnumType e) {
     throw EnumToStringException{e, "LogStatusEnumType"};
 }
 
-LogStatusEnumType string_to_log_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return LogStatusEnumType::Accepted;
-    }
-    if (s == "Rejected") {
-        return LogStatusEnumType::Rejected;
-    }
-    if (s == "AcceptedCanceled") {
-        return LogStatusEnumType::AcceptedCanceled;
+LogStatusEnumType string_to_log_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return LogStatusEnumType::Accepted;
+        }
+        if (s == "Rejected") {
+            return LogStatusEnumType::Rejected;
+        }
+        break;
+    case 16:
+        if (s == "AcceptedCanceled") {
+            return LogStatusEnumType::AcceptedCanceled;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "LogStatusEnumType"};
@@ -847,15 +1000,21 @@ std::string install_certificate_status_enum_type_to_string(InstallCertificateSta
     throw EnumToStringException{e, "InstallCertificateStatusEnumType"};
 }
 
-InstallCertificateStatusEnumType string_to_install_certificate_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return InstallCertificateStatusEnumType::Accepted;
-    }
-    if (s == "Failed") {
-        return InstallCertificateStatusEnumType::Failed;
-    }
-    if (s == "Rejected") {
-        return InstallCertificateStatusEnumType::Rejected;
+InstallCertificateStatusEnumType string_to_install_certificate_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return InstallCertificateStatusEnumType::Failed;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return InstallCertificateStatusEnumType::Accepted;
+        }
+        if (s == "Rejected") {
+            return InstallCertificateStatusEnumType::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "InstallCertificateStatusEnumType"};
@@ -891,27 +1050,43 @@ std::string upload_log_status_enum_type_to_string(UploadLogStatusEnumType e) {
     throw EnumToStringException{e, "UploadLogStatusEnumType"};
 }
 
-UploadLogStatusEnumType string_to_upload_log_status_enum_type(const std::string& s) {
-    if (s == "BadMessage") {
-        return UploadLogStatusEnumType::BadMessage;
-    }
-    if (s == "Idle") {
-        return UploadLogStatusEnumType::Idle;
-    }
-    if (s == "NotSupportedOperation") {
-        return UploadLogStatusEnumType::NotSupportedOperation;
-    }
-    if (s == "PermissionDenied") {
-        return UploadLogStatusEnumType::PermissionDenied;
-    }
-    if (s == "Uploaded") {
-        return UploadLogStatusEnumType::Uploaded;
-    }
-    if (s == "UploadFailure") {
-        return UploadLogStatusEnumType::UploadFailure;
-    }
-    if (s == "Uploading") {
-        return UploadLogStatusEnumType::Uploading;
+UploadLogStatusEnumType string_to_upload_log_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return UploadLogStatusEnumType::Idle;
+        }
+        break;
+    case 8:
+        if (s == "Uploaded") {
+            return UploadLogStatusEnumType::Uploaded;
+        }
+        break;
+    case 9:
+        if (s == "Uploading") {
+            return UploadLogStatusEnumType::Uploading;
+        }
+        break;
+    case 10:
+        if (s == "BadMessage") {
+            return UploadLogStatusEnumType::BadMessage;
+        }
+        break;
+    case 13:
+        if (s == "UploadFailure") {
+            return UploadLogStatusEnumType::UploadFailure;
+        }
+        break;
+    case 16:
+        if (s == "PermissionDenied") {
+            return UploadLogStatusEnumType::PermissionDenied;
+        }
+        break;
+    case 21:
+        if (s == "NotSupportedOperation") {
+            return UploadLogStatusEnumType::NotSupportedOperation;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UploadLogStatusEnumType"};
@@ -948,30 +1123,46 @@ std::string reading_context_to_string(ReadingContext e) {
     throw EnumToStringException{e, "ReadingContext"};
 }
 
-ReadingContext string_to_reading_context(const std::string& s) {
-    if (s == "Interruption.Begin") {
-        return ReadingContext::Interruption_Begin;
-    }
-    if (s == "Interruption.End") {
-        return ReadingContext::Interruption_End;
-    }
-    if (s == "Sample.Clock") {
-        return ReadingContext::Sample_Clock;
-    }
-    if (s == "Sample.Periodic") {
-        return ReadingContext::Sample_Periodic;
-    }
-    if (s == "Transaction.Begin") {
-        return ReadingContext::Transaction_Begin;
-    }
-    if (s == "Transaction.End") {
-        return ReadingContext::Transaction_End;
-    }
-    if (s == "Trigger") {
-        return ReadingContext::Trigger;
-    }
-    if (s == "Other") {
-        return ReadingContext::Other;
+ReadingContext string_to_reading_context(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "Other") {
+            return ReadingContext::Other;
+        }
+        break;
+    case 7:
+        if (s == "Trigger") {
+            return ReadingContext::Trigger;
+        }
+        break;
+    case 12:
+        if (s == "Sample.Clock") {
+            return ReadingContext::Sample_Clock;
+        }
+        break;
+    case 15:
+        if (s == "Sample.Periodic") {
+            return ReadingContext::Sample_Periodic;
+        }
+        if (s == "Transaction.End") {
+            return ReadingContext::Transaction_End;
+        }
+        break;
+    case 16:
+        if (s == "Interruption.End") {
+            return ReadingContext::Interruption_End;
+        }
+        break;
+    case 17:
+        if (s == "Transaction.Begin") {
+            return ReadingContext::Transaction_Begin;
+        }
+        break;
+    case 18:
+        if (s == "Interruption.Begin") {
+            return ReadingContext::Interruption_Begin;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ReadingContext"};
@@ -996,12 +1187,18 @@ std::string value_format_to_string(ValueFormat e) {
     throw EnumToStringException{e, "ValueFormat"};
 }
 
-ValueFormat string_to_value_format(const std::string& s) {
-    if (s == "Raw") {
-        return ValueFormat::Raw;
-    }
-    if (s == "SignedData") {
-        return ValueFormat::SignedData;
+ValueFormat string_to_value_format(std::string_view s) {
+    switch (s.size()) {
+    case 3:
+        if (s == "Raw") {
+            return ValueFormat::Raw;
+        }
+        break;
+    case 10:
+        if (s == "SignedData") {
+            return ValueFormat::SignedData;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ValueFormat"};
@@ -1066,72 +1263,110 @@ std::string measurand_to_string(Measurand e) {
     throw EnumToStringException{e, "Measurand"};
 }
 
-Measurand string_to_measurand(const std::string& s) {
-    if (s == "Energy.Active.Export.Register") {
-        return Measurand::Energy_Active_Export_Register;
-    }
-    if (s == "Energy.Active.Import.Register") {
-        return Measurand::Energy_Active_Import_Register;
-    }
-    if (s == "Energy.Reactive.Export.Register") {
-        return Measurand::Energy_Reactive_Export_Register;
-    }
-    if (s == "Energy.Reactive.Import.Register") {
-        return Measurand::Energy_Reactive_Import_Register;
-    }
-    if (s == "Energy.Active.Export.Interval") {
-        return Measurand::Energy_Active_Export_Interval;
-    }
-    if (s == "Energy.Active.Import.Interval") {
-        return Measurand::Energy_Active_Import_Interval;
-    }
-    if (s == "Energy.Reactive.Export.Interval") {
-        return Measurand::Energy_Reactive_Export_Interval;
-    }
-    if (s == "Energy.Reactive.Import.Interval") {
-        return Measurand::Energy_Reactive_Import_Interval;
-    }
-    if (s == "Power.Active.Export") {
-        return Measurand::Power_Active_Export;
-    }
-    if (s == "Power.Active.Import") {
-        return Measurand::Power_Active_Import;
-    }
-    if (s == "Power.Offered") {
-        return Measurand::Power_Offered;
-    }
-    if (s == "Power.Reactive.Export") {
-        return Measurand::Power_Reactive_Export;
-    }
-    if (s == "Power.Reactive.Import") {
-        return Measurand::Power_Reactive_Import;
-    }
-    if (s == "Power.Factor") {
-        return Measurand::Power_Factor;
-    }
-    if (s == "Current.Import") {
-        return Measurand::Current_Import;
-    }
-    if (s == "Current.Export") {
-        return Measurand::Current_Export;
-    }
-    if (s == "Current.Offered") {
-        return Measurand::Current_Offered;
-    }
-    if (s == "Voltage") {
-        return Measurand::Voltage;
-    }
-    if (s == "Frequency") {
-        return Measurand::Frequency;
-    }
-    if (s == "Temperature") {
-        return Measurand::Temperature;
-    }
-    if (s == "SoC") {
-        return Measurand::SoC;
-    }
-    if (s == "RPM") {
-        return Measurand::RPM;
+Measurand string_to_measurand(std::string_view s) {
+    switch (s.size()) {
+    case 3:
+        if (s == "SoC") {
+            return Measurand::SoC;
+        }
+        if (s == "RPM") {
+            return Measurand::RPM;
+        }
+        break;
+    case 7:
+        if (s == "Voltage") {
+            return Measurand::Voltage;
+        }
+        break;
+    case 9:
+        if (s == "Frequency") {
+            return Measurand::Frequency;
+        }
+        break;
+    case 11:
+        if (s == "Temperature") {
+            return Measurand::Temperature;
+        }
+        break;
+    case 12:
+        if (s == "Power.Factor") {
+            return Measurand::Power_Factor;
+        }
+        break;
+    case 13:
+        if (s == "Power.Offered") {
+            return Measurand::Power_Offered;
+        }
+        break;
+    case 14:
+        if (s == "Current.Import") {
+            return Measurand::Current_Import;
+        }
+        if (s == "Current.Export") {
+            return Measurand::Current_Export;
+        }
+        break;
+    case 15:
+        if (s == "Current.Offered") {
+            return Measurand::Current_Offered;
+        }
+        break;
+    case 19:
+        if (s == "Power.Active.Export") {
+            return Measurand::Power_Active_Export;
+        }
+        if (s == "Power.Active.Import") {
+            return Measurand::Power_Active_Import;
+        }
+        break;
+    case 21:
+        if (s == "Power.Reactive.Export") {
+            return Measurand::Power_Reactive_Export;
+        }
+        if (s == "Power.Reactive.Import") {
+            return Measurand::Power_Reactive_Import;
+        }
+        break;
+    case 29:
+        switch (s[14]) {
+        case 'E':
+            if (s == "Energy.Active.Export.Register") {
+                return Measurand::Energy_Active_Export_Register;
+            }
+            if (s == "Energy.Active.Export.Interval") {
+                return Measurand::Energy_Active_Export_Interval;
+            }
+            break;
+        case 'I':
+            if (s == "Energy.Active.Import.Register") {
+                return Measurand::Energy_Active_Import_Register;
+            }
+            if (s == "Energy.Active.Import.Interval") {
+                return Measurand::Energy_Active_Import_Interval;
+            }
+            break;
+        }
+        break;
+    case 31:
+        switch (s[16]) {
+        case 'E':
+            if (s == "Energy.Reactive.Export.Register") {
+                return Measurand::Energy_Reactive_Export_Register;
+            }
+            if (s == "Energy.Reactive.Export.Interval") {
+                return Measurand::Energy_Reactive_Export_Interval;
+            }
+            break;
+        case 'I':
+            if (s == "Energy.Reactive.Import.Register") {
+                return Measurand::Energy_Reactive_Import_Register;
+            }
+            if (s == "Energy.Reactive.Import.Interval") {
+                return Measurand::Energy_Reactive_Import_Interval;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "Measurand"};
@@ -1172,36 +1407,46 @@ std::string phase_to_string(Phase e) {
     throw EnumToStringException{e, "Phase"};
 }
 
-Phase string_to_phase(const std::string& s) {
-    if (s == "L1") {
-        return Phase::L1;
-    }
-    if (s == "L2") {
-        return Phase::L2;
-    }
-    if (s == "L3") {
-        return Phase::L3;
-    }
-    if (s == "N") {
-        return Phase::N;
-    }
-    if (s == "L1-N") {
-        return Phase::L1_N;
-    }
-    if (s == "L2-N") {
-        return Phase::L2_N;
-    }
-    if (s == "L3-N") {
-        return Phase::L3_N;
-    }
-    if (s == "L1-L2") {
-        return Phase::L1_L2;
-    }
-    if (s == "L2-L3") {
-        return Phase::L2_L3;
-    }
-    if (s == "L3-L1") {
-        return Phase::L3_L1;
+Phase string_to_phase(std::string_view s) {
+    switch (s.size()) {
+    case 1:
+        if (s == "N") {
+            return Phase::N;
+        }
+        break;
+    case 2:
+        if (s == "L1") {
+            return Phase::L1;
+        }
+        if (s == "L2") {
+            return Phase::L2;
+        }
+        if (s == "L3") {
+            return Phase::L3;
+        }
+        break;
+    case 4:
+        if (s == "L1-N") {
+            return Phase::L1_N;
+        }
+        if (s == "L2-N") {
+            return Phase::L2_N;
+        }
+        if (s == "L3-N") {
+            return Phase::L3_N;
+        }
+        break;
+    case 5:
+        if (s == "L1-L2") {
+            return Phase::L1_L2;
+        }
+        if (s == "L2-L3") {
+            return Phase::L2_L3;
+        }
+        if (s == "L3-L1") {
+            return Phase::L3_L1;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "Phase"};
@@ -1232,21 +1477,31 @@ std::string location_to_string(Location e) {
     throw EnumToStringException{e, "Location"};
 }
 
-Location string_to_location(const std::string& s) {
-    if (s == "Cable") {
-        return Location::Cable;
-    }
-    if (s == "EV") {
-        return Location::EV;
-    }
-    if (s == "Inlet") {
-        return Location::Inlet;
-    }
-    if (s == "Outlet") {
-        return Location::Outlet;
-    }
-    if (s == "Body") {
-        return Location::Body;
+Location string_to_location(std::string_view s) {
+    switch (s.size()) {
+    case 2:
+        if (s == "EV") {
+            return Location::EV;
+        }
+        break;
+    case 4:
+        if (s == "Body") {
+            return Location::Body;
+        }
+        break;
+    case 5:
+        if (s == "Cable") {
+            return Location::Cable;
+        }
+        if (s == "Inlet") {
+            return Location::Inlet;
+        }
+        break;
+    case 6:
+        if (s == "Outlet") {
+            return Location::Outlet;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "Location"};
@@ -1301,57 +1556,83 @@ std::string unit_of_measure_to_string(UnitOfMeasure e) {
     throw EnumToStringException{e, "UnitOfMeasure"};
 }
 
-UnitOfMeasure string_to_unit_of_measure(const std::string& s) {
-    if (s == "Wh") {
-        return UnitOfMeasure::Wh;
-    }
-    if (s == "kWh") {
-        return UnitOfMeasure::kWh;
-    }
-    if (s == "varh") {
-        return UnitOfMeasure::varh;
-    }
-    if (s == "kvarh") {
-        return UnitOfMeasure::kvarh;
-    }
-    if (s == "W") {
-        return UnitOfMeasure::W;
-    }
-    if (s == "kW") {
-        return UnitOfMeasure::kW;
-    }
-    if (s == "VA") {
-        return UnitOfMeasure::VA;
-    }
-    if (s == "kVA") {
-        return UnitOfMeasure::kVA;
-    }
-    if (s == "var") {
-        return UnitOfMeasure::var;
-    }
-    if (s == "kvar") {
-        return UnitOfMeasure::kvar;
-    }
-    if (s == "A") {
-        return UnitOfMeasure::A;
-    }
-    if (s == "V") {
-        return UnitOfMeasure::V;
-    }
-    if (s == "K") {
-        return UnitOfMeasure::K;
-    }
-    if (s == "Celcius") {
-        return UnitOfMeasure::Celcius;
-    }
-    if (s == "Celsius") {
-        return UnitOfMeasure::Celsius;
-    }
-    if (s == "Fahrenheit") {
-        return UnitOfMeasure::Fahrenheit;
-    }
-    if (s == "Percent") {
-        return UnitOfMeasure::Percent;
+UnitOfMeasure string_to_unit_of_measure(std::string_view s) {
+    switch (s.size()) {
+    case 1:
+        switch (s[0]) {
+        case 'W':
+            if (s == "W") {
+                return UnitOfMeasure::W;
+            }
+            break;
+        case 'A':
+            if (s == "A") {
+                return UnitOfMeasure::A;
+            }
+            break;
+        case 'V':
+            if (s == "V") {
+                return UnitOfMeasure::V;
+            }
+            break;
+        case 'K':
+            if (s == "K") {
+                return UnitOfMeasure::K;
+            }
+            break;
+        }
+        break;
+    case 2:
+        if (s == "Wh") {
+            return UnitOfMeasure::Wh;
+        }
+        if (s == "kW") {
+            return UnitOfMeasure::kW;
+        }
+        if (s == "VA") {
+            return UnitOfMeasure::VA;
+        }
+        break;
+    case 3:
+        if (s == "kWh") {
+            return UnitOfMeasure::kWh;
+        }
+        if (s == "kVA") {
+            return UnitOfMeasure::kVA;
+        }
+        if (s == "var") {
+            return UnitOfMeasure::var;
+        }
+        break;
+    case 4:
+        if (s == "varh") {
+            return UnitOfMeasure::varh;
+        }
+        if (s == "kvar") {
+            return UnitOfMeasure::kvar;
+        }
+        break;
+    case 5:
+        if (s == "kvarh") {
+            return UnitOfMeasure::kvarh;
+        }
+        break;
+    case 7:
+        if (s == "Celcius") {
+            return UnitOfMeasure::Celcius;
+        }
+        if (s == "Celsius") {
+            return UnitOfMeasure::Celsius;
+        }
+        if (s == "Percent") {
+            return UnitOfMeasure::Percent;
+        }
+        break;
+    case 10:
+        if (s == "Fahrenheit") {
+            return UnitOfMeasure::Fahrenheit;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UnitOfMeasure"};
@@ -1378,15 +1659,21 @@ std::string charging_profile_kind_type_to_string(ChargingProfileKindType e) {
     throw EnumToStringException{e, "ChargingProfileKindType"};
 }
 
-ChargingProfileKindType string_to_charging_profile_kind_type(const std::string& s) {
-    if (s == "Absolute") {
-        return ChargingProfileKindType::Absolute;
-    }
-    if (s == "Recurring") {
-        return ChargingProfileKindType::Recurring;
-    }
-    if (s == "Relative") {
-        return ChargingProfileKindType::Relative;
+ChargingProfileKindType string_to_charging_profile_kind_type(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Absolute") {
+            return ChargingProfileKindType::Absolute;
+        }
+        if (s == "Relative") {
+            return ChargingProfileKindType::Relative;
+        }
+        break;
+    case 9:
+        if (s == "Recurring") {
+            return ChargingProfileKindType::Recurring;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingProfileKindType"};
@@ -1411,12 +1698,18 @@ std::string recurrency_kind_type_to_string(RecurrencyKindType e) {
     throw EnumToStringException{e, "RecurrencyKindType"};
 }
 
-RecurrencyKindType string_to_recurrency_kind_type(const std::string& s) {
-    if (s == "Daily") {
-        return RecurrencyKindType::Daily;
-    }
-    if (s == "Weekly") {
-        return RecurrencyKindType::Weekly;
+RecurrencyKindType string_to_recurrency_kind_type(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "Daily") {
+            return RecurrencyKindType::Daily;
+        }
+        break;
+    case 6:
+        if (s == "Weekly") {
+            return RecurrencyKindType::Weekly;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "RecurrencyKindType"};
@@ -1441,12 +1734,16 @@ std::string remote_start_stop_status_to_string(RemoteStartStopStatus e) {
     throw EnumToStringException{e, "RemoteStartStopStatus"};
 }
 
-RemoteStartStopStatus string_to_remote_start_stop_status(const std::string& s) {
-    if (s == "Accepted") {
-        return RemoteStartStopStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return RemoteStartStopStatus::Rejected;
+RemoteStartStopStatus string_to_remote_start_stop_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return RemoteStartStopStatus::Accepted;
+        }
+        if (s == "Rejected") {
+            return RemoteStartStopStatus::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "RemoteStartStopStatus"};
@@ -1477,21 +1774,29 @@ std::string reservation_status_to_string(ReservationStatus e) {
     throw EnumToStringException{e, "ReservationStatus"};
 }
 
-ReservationStatus string_to_reservation_status(const std::string& s) {
-    if (s == "Accepted") {
-        return ReservationStatus::Accepted;
-    }
-    if (s == "Faulted") {
-        return ReservationStatus::Faulted;
-    }
-    if (s == "Occupied") {
-        return ReservationStatus::Occupied;
-    }
-    if (s == "Rejected") {
-        return ReservationStatus::Rejected;
-    }
-    if (s == "Unavailable") {
-        return ReservationStatus::Unavailable;
+ReservationStatus string_to_reservation_status(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Faulted") {
+            return ReservationStatus::Faulted;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return ReservationStatus::Accepted;
+        }
+        if (s == "Occupied") {
+            return ReservationStatus::Occupied;
+        }
+        if (s == "Rejected") {
+            return ReservationStatus::Rejected;
+        }
+        break;
+    case 11:
+        if (s == "Unavailable") {
+            return ReservationStatus::Unavailable;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ReservationStatus"};
@@ -1516,12 +1821,16 @@ std::string reset_type_to_string(ResetType e) {
     throw EnumToStringException{e, "ResetType"};
 }
 
-ResetType string_to_reset_type(const std::string& s) {
-    if (s == "Hard") {
-        return ResetType::Hard;
-    }
-    if (s == "Soft") {
-        return ResetType::Soft;
+ResetType string_to_reset_type(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Hard") {
+            return ResetType::Hard;
+        }
+        if (s == "Soft") {
+            return ResetType::Soft;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ResetType"};
@@ -1546,12 +1855,16 @@ std::string reset_status_to_string(ResetStatus e) {
     throw EnumToStringException{e, "ResetStatus"};
 }
 
-ResetStatus string_to_reset_status(const std::string& s) {
-    if (s == "Accepted") {
-        return ResetStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return ResetStatus::Rejected;
+ResetStatus string_to_reset_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return ResetStatus::Accepted;
+        }
+        if (s == "Rejected") {
+            return ResetStatus::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ResetStatus"};
@@ -1576,12 +1889,18 @@ std::string update_type_to_string(UpdateType e) {
     throw EnumToStringException{e, "UpdateType"};
 }
 
-UpdateType string_to_update_type(const std::string& s) {
-    if (s == "Differential") {
-        return UpdateType::Differential;
-    }
-    if (s == "Full") {
-        return UpdateType::Full;
+UpdateType string_to_update_type(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Full") {
+            return UpdateType::Full;
+        }
+        break;
+    case 12:
+        if (s == "Differential") {
+            return UpdateType::Differential;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UpdateType"};
@@ -1610,18 +1929,28 @@ std::string update_status_to_string(UpdateStatus e) {
     throw EnumToStringException{e, "UpdateStatus"};
 }
 
-UpdateStatus string_to_update_status(const std::string& s) {
-    if (s == "Accepted") {
-        return UpdateStatus::Accepted;
-    }
-    if (s == "Failed") {
-        return UpdateStatus::Failed;
-    }
-    if (s == "NotSupported") {
-        return UpdateStatus::NotSupported;
-    }
-    if (s == "VersionMismatch") {
-        return UpdateStatus::VersionMismatch;
+UpdateStatus string_to_update_status(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return UpdateStatus::Failed;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return UpdateStatus::Accepted;
+        }
+        break;
+    case 12:
+        if (s == "NotSupported") {
+            return UpdateStatus::NotSupported;
+        }
+        break;
+    case 15:
+        if (s == "VersionMismatch") {
+            return UpdateStatus::VersionMismatch;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UpdateStatus"};
@@ -1648,15 +1977,21 @@ std::string charging_profile_status_to_string(ChargingProfileStatus e) {
     throw EnumToStringException{e, "ChargingProfileStatus"};
 }
 
-ChargingProfileStatus string_to_charging_profile_status(const std::string& s) {
-    if (s == "Accepted") {
-        return ChargingProfileStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return ChargingProfileStatus::Rejected;
-    }
-    if (s == "NotSupported") {
-        return ChargingProfileStatus::NotSupported;
+ChargingProfileStatus string_to_charging_profile_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return ChargingProfileStatus::Accepted;
+        }
+        if (s == "Rejected") {
+            return ChargingProfileStatus::Rejected;
+        }
+        break;
+    case 12:
+        if (s == "NotSupported") {
+            return ChargingProfileStatus::NotSupported;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingProfileStatus"};
@@ -1681,12 +2016,16 @@ std::string generic_status_enum_type_to_string(GenericStatusEnumType e) {
     throw EnumToStringException{e, "GenericStatusEnumType"};
 }
 
-GenericStatusEnumType string_to_generic_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return GenericStatusEnumType::Accepted;
-    }
-    if (s == "Rejected") {
-        return GenericStatusEnumType::Rejected;
+GenericStatusEnumType string_to_generic_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return GenericStatusEnumType::Accepted;
+        }
+        if (s == "Rejected") {
+            return GenericStatusEnumType::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GenericStatusEnumType"};
@@ -1735,48 +2074,68 @@ std::string firmware_status_enum_type_to_string(FirmwareStatusEnumType e) {
     throw EnumToStringException{e, "FirmwareStatusEnumType"};
 }
 
-FirmwareStatusEnumType string_to_firmware_status_enum_type(const std::string& s) {
-    if (s == "Downloaded") {
-        return FirmwareStatusEnumType::Downloaded;
-    }
-    if (s == "DownloadFailed") {
-        return FirmwareStatusEnumType::DownloadFailed;
-    }
-    if (s == "Downloading") {
-        return FirmwareStatusEnumType::Downloading;
-    }
-    if (s == "DownloadScheduled") {
-        return FirmwareStatusEnumType::DownloadScheduled;
-    }
-    if (s == "DownloadPaused") {
-        return FirmwareStatusEnumType::DownloadPaused;
-    }
-    if (s == "Idle") {
-        return FirmwareStatusEnumType::Idle;
-    }
-    if (s == "InstallationFailed") {
-        return FirmwareStatusEnumType::InstallationFailed;
-    }
-    if (s == "Installing") {
-        return FirmwareStatusEnumType::Installing;
-    }
-    if (s == "Installed") {
-        return FirmwareStatusEnumType::Installed;
-    }
-    if (s == "InstallRebooting") {
-        return FirmwareStatusEnumType::InstallRebooting;
-    }
-    if (s == "InstallScheduled") {
-        return FirmwareStatusEnumType::InstallScheduled;
-    }
-    if (s == "InstallVerificationFailed") {
-        return FirmwareStatusEnumType::InstallVerificationFailed;
-    }
-    if (s == "InvalidSignature") {
-        return FirmwareStatusEnumType::InvalidSignature;
-    }
-    if (s == "SignatureVerified") {
-        return FirmwareStatusEnumType::SignatureVerified;
+FirmwareStatusEnumType string_to_firmware_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return FirmwareStatusEnumType::Idle;
+        }
+        break;
+    case 9:
+        if (s == "Installed") {
+            return FirmwareStatusEnumType::Installed;
+        }
+        break;
+    case 10:
+        if (s == "Downloaded") {
+            return FirmwareStatusEnumType::Downloaded;
+        }
+        if (s == "Installing") {
+            return FirmwareStatusEnumType::Installing;
+        }
+        break;
+    case 11:
+        if (s == "Downloading") {
+            return FirmwareStatusEnumType::Downloading;
+        }
+        break;
+    case 14:
+        if (s == "DownloadFailed") {
+            return FirmwareStatusEnumType::DownloadFailed;
+        }
+        if (s == "DownloadPaused") {
+            return FirmwareStatusEnumType::DownloadPaused;
+        }
+        break;
+    case 16:
+        if (s == "InstallRebooting") {
+            return FirmwareStatusEnumType::InstallRebooting;
+        }
+        if (s == "InstallScheduled") {
+            return FirmwareStatusEnumType::InstallScheduled;
+        }
+        if (s == "InvalidSignature") {
+            return FirmwareStatusEnumType::InvalidSignature;
+        }
+        break;
+    case 17:
+        if (s == "DownloadScheduled") {
+            return FirmwareStatusEnumType::DownloadScheduled;
+        }
+        if (s == "SignatureVerified") {
+            return FirmwareStatusEnumType::SignatureVerified;
+        }
+        break;
+    case 18:
+        if (s == "InstallationFailed") {
+            return FirmwareStatusEnumType::InstallationFailed;
+        }
+        break;
+    case 25:
+        if (s == "InstallVerificationFailed") {
+            return FirmwareStatusEnumType::InstallVerificationFailed;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "FirmwareStatusEnumType"};
@@ -1807,21 +2166,29 @@ std::string update_firmware_status_enum_type_to_string(UpdateFirmwareStatusEnumT
     throw EnumToStringException{e, "UpdateFirmwareStatusEnumType"};
 }
 
-UpdateFirmwareStatusEnumType string_to_update_firmware_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return UpdateFirmwareStatusEnumType::Accepted;
-    }
-    if (s == "Rejected") {
-        return UpdateFirmwareStatusEnumType::Rejected;
-    }
-    if (s == "AcceptedCanceled") {
-        return UpdateFirmwareStatusEnumType::AcceptedCanceled;
-    }
-    if (s == "InvalidCertificate") {
-        return UpdateFirmwareStatusEnumType::InvalidCertificate;
-    }
-    if (s == "RevokedCertificate") {
-        return UpdateFirmwareStatusEnumType::RevokedCertificate;
+UpdateFirmwareStatusEnumType string_to_update_firmware_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return UpdateFirmwareStatusEnumType::Accepted;
+        }
+        if (s == "Rejected") {
+            return UpdateFirmwareStatusEnumType::Rejected;
+        }
+        break;
+    case 16:
+        if (s == "AcceptedCanceled") {
+            return UpdateFirmwareStatusEnumType::AcceptedCanceled;
+        }
+        break;
+    case 18:
+        if (s == "InvalidCertificate") {
+            return UpdateFirmwareStatusEnumType::InvalidCertificate;
+        }
+        if (s == "RevokedCertificate") {
+            return UpdateFirmwareStatusEnumType::RevokedCertificate;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UpdateFirmwareStatusEnumType"};
@@ -1874,54 +2241,74 @@ std::string charge_point_error_code_to_string(ChargePointErrorCode e) {
     throw EnumToStringException{e, "ChargePointErrorCode"};
 }
 
-ChargePointErrorCode string_to_charge_point_error_code(const std::string& s) {
-    if (s == "ConnectorLockFailure") {
-        return ChargePointErrorCode::ConnectorLockFailure;
-    }
-    if (s == "EVCommunicationError") {
-        return ChargePointErrorCode::EVCommunicationError;
-    }
-    if (s == "GroundFailure") {
-        return ChargePointErrorCode::GroundFailure;
-    }
-    if (s == "HighTemperature") {
-        return ChargePointErrorCode::HighTemperature;
-    }
-    if (s == "InternalError") {
-        return ChargePointErrorCode::InternalError;
-    }
-    if (s == "LocalListConflict") {
-        return ChargePointErrorCode::LocalListConflict;
-    }
-    if (s == "NoError") {
-        return ChargePointErrorCode::NoError;
-    }
-    if (s == "OtherError") {
-        return ChargePointErrorCode::OtherError;
-    }
-    if (s == "OverCurrentFailure") {
-        return ChargePointErrorCode::OverCurrentFailure;
-    }
-    if (s == "PowerMeterFailure") {
-        return ChargePointErrorCode::PowerMeterFailure;
-    }
-    if (s == "PowerSwitchFailure") {
-        return ChargePointErrorCode::PowerSwitchFailure;
-    }
-    if (s == "ReaderFailure") {
-        return ChargePointErrorCode::ReaderFailure;
-    }
-    if (s == "ResetFailure") {
-        return ChargePointErrorCode::ResetFailure;
-    }
-    if (s == "UnderVoltage") {
-        return ChargePointErrorCode::UnderVoltage;
-    }
-    if (s == "OverVoltage") {
-        return ChargePointErrorCode::OverVoltage;
-    }
-    if (s == "WeakSignal") {
-        return ChargePointErrorCode::WeakSignal;
+ChargePointErrorCode string_to_charge_point_error_code(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "NoError") {
+            return ChargePointErrorCode::NoError;
+        }
+        break;
+    case 10:
+        if (s == "OtherError") {
+            return ChargePointErrorCode::OtherError;
+        }
+        if (s == "WeakSignal") {
+            return ChargePointErrorCode::WeakSignal;
+        }
+        break;
+    case 11:
+        if (s == "OverVoltage") {
+            return ChargePointErrorCode::OverVoltage;
+        }
+        break;
+    case 12:
+        if (s == "ResetFailure") {
+            return ChargePointErrorCode::ResetFailure;
+        }
+        if (s == "UnderVoltage") {
+            return ChargePointErrorCode::UnderVoltage;
+        }
+        break;
+    case 13:
+        if (s == "GroundFailure") {
+            return ChargePointErrorCode::GroundFailure;
+        }
+        if (s == "InternalError") {
+            return ChargePointErrorCode::InternalError;
+        }
+        if (s == "ReaderFailure") {
+            return ChargePointErrorCode::ReaderFailure;
+        }
+        break;
+    case 15:
+        if (s == "HighTemperature") {
+            return ChargePointErrorCode::HighTemperature;
+        }
+        break;
+    case 17:
+        if (s == "LocalListConflict") {
+            return ChargePointErrorCode::LocalListConflict;
+        }
+        if (s == "PowerMeterFailure") {
+            return ChargePointErrorCode::PowerMeterFailure;
+        }
+        break;
+    case 18:
+        if (s == "OverCurrentFailure") {
+            return ChargePointErrorCode::OverCurrentFailure;
+        }
+        if (s == "PowerSwitchFailure") {
+            return ChargePointErrorCode::PowerSwitchFailure;
+        }
+        break;
+    case 20:
+        if (s == "ConnectorLockFailure") {
+            return ChargePointErrorCode::ConnectorLockFailure;
+        }
+        if (s == "EVCommunicationError") {
+            return ChargePointErrorCode::EVCommunicationError;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargePointErrorCode"};
@@ -1960,33 +2347,45 @@ std::string charge_point_status_to_string(ChargePointStatus e) {
     throw EnumToStringException{e, "ChargePointStatus"};
 }
 
-ChargePointStatus string_to_charge_point_status(const std::string& s) {
-    if (s == "Available") {
-        return ChargePointStatus::Available;
-    }
-    if (s == "Preparing") {
-        return ChargePointStatus::Preparing;
-    }
-    if (s == "Charging") {
-        return ChargePointStatus::Charging;
-    }
-    if (s == "SuspendedEVSE") {
-        return ChargePointStatus::SuspendedEVSE;
-    }
-    if (s == "SuspendedEV") {
-        return ChargePointStatus::SuspendedEV;
-    }
-    if (s == "Finishing") {
-        return ChargePointStatus::Finishing;
-    }
-    if (s == "Reserved") {
-        return ChargePointStatus::Reserved;
-    }
-    if (s == "Unavailable") {
-        return ChargePointStatus::Unavailable;
-    }
-    if (s == "Faulted") {
-        return ChargePointStatus::Faulted;
+ChargePointStatus string_to_charge_point_status(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Faulted") {
+            return ChargePointStatus::Faulted;
+        }
+        break;
+    case 8:
+        if (s == "Charging") {
+            return ChargePointStatus::Charging;
+        }
+        if (s == "Reserved") {
+            return ChargePointStatus::Reserved;
+        }
+        break;
+    case 9:
+        if (s == "Available") {
+            return ChargePointStatus::Available;
+        }
+        if (s == "Preparing") {
+            return ChargePointStatus::Preparing;
+        }
+        if (s == "Finishing") {
+            return ChargePointStatus::Finishing;
+        }
+        break;
+    case 11:
+        if (s == "SuspendedEV") {
+            return ChargePointStatus::SuspendedEV;
+        }
+        if (s == "Unavailable") {
+            return ChargePointStatus::Unavailable;
+        }
+        break;
+    case 13:
+        if (s == "SuspendedEVSE") {
+            return ChargePointStatus::SuspendedEVSE;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargePointStatus"};
@@ -2029,39 +2428,53 @@ std::string reason_to_string(Reason e) {
     throw EnumToStringException{e, "Reason"};
 }
 
-Reason string_to_reason(const std::string& s) {
-    if (s == "EmergencyStop") {
-        return Reason::EmergencyStop;
-    }
-    if (s == "EVDisconnected") {
-        return Reason::EVDisconnected;
-    }
-    if (s == "HardReset") {
-        return Reason::HardReset;
-    }
-    if (s == "Local") {
-        return Reason::Local;
-    }
-    if (s == "Other") {
-        return Reason::Other;
-    }
-    if (s == "PowerLoss") {
-        return Reason::PowerLoss;
-    }
-    if (s == "Reboot") {
-        return Reason::Reboot;
-    }
-    if (s == "Remote") {
-        return Reason::Remote;
-    }
-    if (s == "SoftReset") {
-        return Reason::SoftReset;
-    }
-    if (s == "UnlockCommand") {
-        return Reason::UnlockCommand;
-    }
-    if (s == "DeAuthorized") {
-        return Reason::DeAuthorized;
+Reason string_to_reason(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "Local") {
+            return Reason::Local;
+        }
+        if (s == "Other") {
+            return Reason::Other;
+        }
+        break;
+    case 6:
+        if (s == "Reboot") {
+            return Reason::Reboot;
+        }
+        if (s == "Remote") {
+            return Reason::Remote;
+        }
+        break;
+    case 9:
+        if (s == "HardReset") {
+            return Reason::HardReset;
+        }
+        if (s == "PowerLoss") {
+            return Reason::PowerLoss;
+        }
+        if (s == "SoftReset") {
+            return Reason::SoftReset;
+        }
+        break;
+    case 12:
+        if (s == "DeAuthorized") {
+            return Reason::DeAuthorized;
+        }
+        break;
+    case 13:
+        if (s == "EmergencyStop") {
+            return Reason::EmergencyStop;
+        }
+        if (s == "UnlockCommand") {
+            return Reason::UnlockCommand;
+        }
+        break;
+    case 14:
+        if (s == "EVDisconnected") {
+            return Reason::EVDisconnected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "Reason"};
@@ -2094,24 +2507,38 @@ std::string message_trigger_to_string(MessageTrigger e) {
     throw EnumToStringException{e, "MessageTrigger"};
 }
 
-MessageTrigger string_to_message_trigger(const std::string& s) {
-    if (s == "BootNotification") {
-        return MessageTrigger::BootNotification;
-    }
-    if (s == "DiagnosticsStatusNotification") {
-        return MessageTrigger::DiagnosticsStatusNotification;
-    }
-    if (s == "FirmwareStatusNotification") {
-        return MessageTrigger::FirmwareStatusNotification;
-    }
-    if (s == "Heartbeat") {
-        return MessageTrigger::Heartbeat;
-    }
-    if (s == "MeterValues") {
-        return MessageTrigger::MeterValues;
-    }
-    if (s == "StatusNotification") {
-        return MessageTrigger::StatusNotification;
+MessageTrigger string_to_message_trigger(std::string_view s) {
+    switch (s.size()) {
+    case 9:
+        if (s == "Heartbeat") {
+            return MessageTrigger::Heartbeat;
+        }
+        break;
+    case 11:
+        if (s == "MeterValues") {
+            return MessageTrigger::MeterValues;
+        }
+        break;
+    case 16:
+        if (s == "BootNotification") {
+            return MessageTrigger::BootNotification;
+        }
+        break;
+    case 18:
+        if (s == "StatusNotification") {
+            return MessageTrigger::StatusNotification;
+        }
+        break;
+    case 26:
+        if (s == "FirmwareStatusNotification") {
+            return MessageTrigger::FirmwareStatusNotification;
+        }
+        break;
+    case 29:
+        if (s == "DiagnosticsStatusNotification") {
+            return MessageTrigger::DiagnosticsStatusNotification;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MessageTrigger"};
@@ -2138,15 +2565,21 @@ std::string trigger_message_status_to_string(TriggerMessageStatus e) {
     throw EnumToStringException{e, "TriggerMessageStatus"};
 }
 
-TriggerMessageStatus string_to_trigger_message_status(const std::string& s) {
-    if (s == "Accepted") {
-        return TriggerMessageStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return TriggerMessageStatus::Rejected;
-    }
-    if (s == "NotImplemented") {
-        return TriggerMessageStatus::NotImplemented;
+TriggerMessageStatus string_to_trigger_message_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return TriggerMessageStatus::Accepted;
+        }
+        if (s == "Rejected") {
+            return TriggerMessageStatus::Rejected;
+        }
+        break;
+    case 14:
+        if (s == "NotImplemented") {
+            return TriggerMessageStatus::NotImplemented;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "TriggerMessageStatus"};
@@ -2173,15 +2606,21 @@ std::string unlock_status_to_string(UnlockStatus e) {
     throw EnumToStringException{e, "UnlockStatus"};
 }
 
-UnlockStatus string_to_unlock_status(const std::string& s) {
-    if (s == "Unlocked") {
-        return UnlockStatus::Unlocked;
-    }
-    if (s == "UnlockFailed") {
-        return UnlockStatus::UnlockFailed;
-    }
-    if (s == "NotSupported") {
-        return UnlockStatus::NotSupported;
+UnlockStatus string_to_unlock_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Unlocked") {
+            return UnlockStatus::Unlocked;
+        }
+        break;
+    case 12:
+        if (s == "UnlockFailed") {
+            return UnlockStatus::UnlockFailed;
+        }
+        if (s == "NotSupported") {
+            return UnlockStatus::NotSupported;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UnlockStatus"};
@@ -9,6 +9,8 @@
 
 #include <nlohmann/json.hpp>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 
@@ -33,7 +35,7 @@ void to_json(json& j, const IdTagInfo& k) {
 /// \brief Conversion from a given json object \p j to a given IdTagInfo \p k
 void from_json(const json& j, IdTagInfo& k) {
     // the required parts of the message
-    k.status = conversions::string_to_authorization_status(j.at("status"));
+    k.status = conversions::string_to_authorization_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("expiryDate")) {
@@ -44,6 +46,33 @@ void from_json(const json& j, IdTagInfo& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a IdTagInfo
+const JsonSaxFields& json_sax_fields(const IdTagInfo*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&IdTagInfo::status, conversions::string_to_authorization_status>("status"),
+        json_sax_field<&IdTagInfo::expiryDate>("expiryDate"),
+        json_sax_field<&IdTagInfo::parentIdTag>("parentIdTag"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given IdTagInfo \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const IdTagInfo& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.expiryDate) {
+        writer.key("expiryDate");
+        writer.value(k.expiryDate.value());
+    }
+    if (k.parentIdTag) {
+        writer.key("parentIdTag");
+        writer.value(k.parentIdTag.value().view());
+    }
+    writer.key("status");
+    writer.value(conversions::authorization_status_to_string(k.status));
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given IdTagInfo \p k to the given output stream \p os
 /// \returns an output stream with the IdTagInfo written to
 std::ostream& operator<<(std::ostream& os, const IdTagInfo& k) {
@@ -66,7 +95,8 @@ void to_json(json& j, const CertificateHashDataType& k) {
 /// \brief Conversion from a given json object \p j to a given CertificateHashDataType \p k
 void from_json(const json& j, CertificateHashDataType& k) {
     // the required parts of the message
-    k.hashAlgorithm = conversions::string_to_hash_algorithm_enum_type(j.at("hashAlgorithm"));
+    k.hashAlgorithm =
+        conversions::string_to_hash_algorithm_enum_type(j.at("hashAlgorithm").get_ref<const std::string&>());
     k.issuerNameHash = j.at("issuerNameHash");
     k.issuerKeyHash = j.at("issuerKeyHash");
     k.serialNumber = j.at("serialNumber");
@@ -74,6 +104,33 @@ void from_json(const json& j, CertificateHashDataType& k) {
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CertificateHashDataType
+const JsonSaxFields& json_sax_fields(const CertificateHashDataType*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&CertificateHashDataType::hashAlgorithm,
+                       conversions::string_to_hash_algorithm_enum_type>("hashAlgorithm"),
+        json_sax_field<&CertificateHashDataType::issuerNameHash>("issuerNameHash"),
+        json_sax_field<&CertificateHashDataType::issuerKeyHash>("issuerKeyHash"),
+        json_sax_field<&CertificateHashDataType::serialNumber>("serialNumber"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given CertificateHashDataType \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CertificateHashDataType& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("hashAlgorithm");
+    writer.value(conversions::hash_algorithm_enum_type_to_string(k.hashAlgorithm));
+    writer.key("issuerKeyHash");
+    writer.value(k.issuerKeyHash.view());
+    writer.key("issuerNameHash");
+    writer.value(k.issuerNameHash.view());
+    writer.key("serialNumber");
+    writer.value(k.serialNumber.view());
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given CertificateHashDataType \p k to the given output stream \p os
 /// \returns an output stream with the CertificateHashDataType written to
 std::ostream& operator<<(std::ostream& os, const CertificateHashDataType& k) {
@@ -106,6 +163,31 @@ void from_json(const json& j, ChargingSchedulePeriod& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChargingSchedulePeriod
+const JsonSaxFields& json_sax_fields(const ChargingSchedulePeriod*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ChargingSchedulePeriod::startPeriod>("startPeriod"),
+        json_sax_field<&ChargingSchedulePeriod::limit>("limit"),
+        json_sax_field<&ChargingSchedulePeriod::numberPhases>("numberPhases"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ChargingSchedulePeriod \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChargingSchedulePeriod& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("limit");
+    writer.value(k.limit);
+    if (k.numberPhases) {
+        writer.key("numberPhases");
+        writer.value(k.numberPhases.value());
+    }
+    writer.key("startPeriod");
+    writer.value(k.startPeriod);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingSchedulePeriod \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedulePeriod written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedulePeriod& k) {
@@ -135,7 +217,8 @@ void to_json(json& j, const ChargingSchedule& k) {
 /// \brief Conversion from a given json object \p j to a given ChargingSchedule \p k
 void from_json(const json& j, ChargingSchedule& k) {
     // the required parts of the message
-    k.chargingRateUnit = conversions::string_to_charging_rate_unit(j.at("chargingRateUnit"));
+    k.chargingRateUnit =
+        conversions::string_to_charging_rate_unit(j.at("chargingRateUnit").get_ref<const std::string&>());
     for (auto val : j.at("chargingSchedulePeriod")) {
         k.chargingSchedulePeriod.push_back(val);
     }
@@ -152,6 +235,46 @@ void from_json(const json& j, ChargingSchedule& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChargingSchedule
+const JsonSaxFields& json_sax_fields(const ChargingSchedule*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ChargingSchedule::chargingRateUnit,
+                       conversions::string_to_charging_rate_unit>("chargingRateUnit"),
+        json_sax_field<&ChargingSchedule::chargingSchedulePeriod>("chargingSchedulePeriod"),
+        json_sax_field<&ChargingSchedule::duration>("duration"),
+        json_sax_field<&ChargingSchedule::startSchedule>("startSchedule"),
+        json_sax_field<&ChargingSchedule::minChargingRate>("minChargingRate"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ChargingSchedule \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChargingSchedule& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("chargingRateUnit");
+    writer.value(conversions::charging_rate_unit_to_string(k.chargingRateUnit));
+    writer.key("chargingSchedulePeriod");
+    writer.begin_array();
+    for (const auto& val : k.chargingSchedulePeriod) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    if (k.duration) {
+        writer.key("duration");
+        writer.value(k.duration.value());
+    }
+    if (k.minChargingRate) {
+        writer.key("minChargingRate");
+        writer.value(k.minChargingRate.value());
+    }
+    if (k.startSchedule) {
+        writer.key("startSchedule");
+        writer.value(k.startSchedule.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingSchedule \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedule written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedule& k) {
@@ -184,6 +307,31 @@ void from_json(const json& j, KeyValue& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a KeyValue
+const JsonSaxFields& json_sax_fields(const KeyValue*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&KeyValue::key>("key"),
+        json_sax_field<&KeyValue::readonly>("readonly"),
+        json_sax_field<&KeyValue::value>("value"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given KeyValue \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const KeyValue& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("key");
+    writer.value(k.key.view());
+    writer.key("readonly");
+    writer.value(k.readonly);
+    if (k.value) {
+        writer.key("value");
+        writer.value(k.value.value().view());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given KeyValue \p k to the given output stream \p os
 /// \returns an output stream with the KeyValue written to
 std::ostream& operator<<(std::ostream& os, const KeyValue& k) {
@@ -220,6 +368,33 @@ void from_json(const json& j, LogParametersType& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a LogParametersType
+const JsonSaxFields& json_sax_fields(const LogParametersType*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&LogParametersType::remoteLocation>("remoteLocation"),
+        json_sax_field<&LogParametersType::oldestTimestamp>("oldestTimestamp"),
+        json_sax_field<&LogParametersType::latestTimestamp>("latestTimestamp"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given LogParametersType \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const LogParametersType& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.latestTimestamp) {
+        writer.key("latestTimestamp");
+        writer.value(k.latestTimestamp.value());
+    }
+    if (k.oldestTimestamp) {
+        writer.key("oldestTimestamp");
+        writer.value(k.oldestTimestamp.value());
+    }
+    writer.key("remoteLocation");
+    writer.value(k.remoteLocation.view());
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given LogParametersType \p k to the given output stream \p os
 /// \returns an output stream with the LogParametersType written to
 std::ostream& operator<<(std::ostream& os, const LogParametersType& k) {
@@ -261,23 +436,70 @@ void from_json(const json& j, SampledValue& k) {
 
     // the optional parts of the message
     if (j.contains("context")) {
-        k.context.emplace(conversions::string_to_reading_context(j.at("context")));
+        k.context.emplace(conversions::string_to_reading_context(j.at("context").get_ref<const std::string&>()));
     }
     if (j.contains("format")) {
-        k.format.emplace(conversions::string_to_value_format(j.at("format")));
+        k.format.emplace(conversions::string_to_value_format(j.at("format").get_ref<const std::string&>()));
     }
     if (j.contains("measurand")) {
-        k.measurand.emplace(conversions::string_to_measurand(j.at("measurand")));
+        k.measurand.emplace(conversions::string_to_measurand(j.at("measurand").get_ref<const std::string&>()));
     }
     if (j.contains("phase")) {
-        k.phase.emplace(conversions::string_to_phase(j.at("phase")));
+        k.phase.emplace(conversions::string_to_phase(j.at("phase").get_ref<const std::string&>()));
     }
     if (j.contains("location")) {
-        k.location.emplace(conversions::string_to_location(j.at("location")));
+        k.location.emplace(conversions::string_to_location(j.at("location").get_ref<const std::string&>()));
     }
     if (j.contains("unit")) {
-        k.unit.emplace(conversions::string_to_unit_of_measure(j.at("unit")));
+        k.unit.emplace(conversions::string_to_unit_of_measure(j.at("unit").get_ref<const std::string&>()));
+    }
+}
+
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SampledValue
+const JsonSaxFields& json_sax_fields(const SampledValue*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SampledValue::value>("value"),
+        json_sax_field<&SampledValue::context, conversions::string_to_reading_context>("context"),
+        json_sax_field<&SampledValue::format, conversions::string_to_value_format>("format"),
+        json_sax_field<&SampledValue::measurand, conversions::string_to_measurand>("measurand"),
+        json_sax_field<&SampledValue::phase, conversions::string_to_phase>("phase"),
+        json_sax_field<&SampledValue::location, conversions::string_to_location>("location"),
+        json_sax_field<&SampledValue::unit, conversions::string_to_unit_of_measure>("unit"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SampledValue \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SampledValue& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.context) {
+        writer.key("context");
+        writer.value(conversions::reading_context_to_string(k.context.value()));
+    }
+    if (k.format) {
+        writer.key("format");
+        writer.value(conversions::value_format_to_string(k.format.value()));
+    }
+    if (k.location) {
+        writer.key("location");
+        writer.value(conversions::location_to_string(k.location.value()));
+    }
+    if (k.measurand) {
+        writer.key("measurand");
+        writer.value(conversions::measurand_to_string(k.measurand.value()));
+    }
+    if (k.phase) {
+        writer.key("phase");
+        writer.value(conversions::phase_to_string(k.phase.value()));
     }
+    if (k.unit) {
+        writer.key("unit");
+        writer.value(conversions::unit_of_measure_to_string(k.unit.value()));
+    }
+    writer.key("value");
+    writer.value(k.value);
+    writer.end_object();
 }
 
 // \brief Writes the string representation of the given SampledValue \p k to the given output stream \p os
@@ -309,6 +531,30 @@ void from_json(const json& j, MeterValue& k) {
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a MeterValue
+const JsonSaxFields& json_sax_fields(const MeterValue*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&MeterValue::timestamp>("timestamp"),
+        json_sax_field<&MeterValue::sampledValue>("sampledValue"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given MeterValue \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const MeterValue& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("sampledValue");
+    writer.begin_array();
+    for (const auto& val : k.sampledValue) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    writer.key("timestamp");
+    writer.value(k.timestamp);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given MeterValue \p k to the given output stream \p os
 /// \returns an output stream with the MeterValue written to
 std::ostream& operator<<(std::ostream& os, const MeterValue& k) {
@@ -346,8 +592,11 @@ void from_json(const json& j, ChargingProfile& k) {
     // the required parts of the message
     k.chargingProfileId = j.at("chargingProfileId");
     k.stackLevel = j.at("stackLevel");
-    k.chargingProfilePurpose = conversions::string_to_charging_profile_purpose_type(j.at("chargingProfilePurpose"));
-    k.chargingProfileKind = conversions::string_to_charging_profile_kind_type(j.at("chargingProfileKind"));
+    k.chargingProfilePurpose =
+        conversions::string_to_charging_profile_purpose_type(
+            j.at("chargingProfilePurpose").get_ref<const std::string&>());
+    k.chargingProfileKind =
+        conversions::string_to_charging_profile_kind_type(j.at("chargingProfileKind").get_ref<const std::string&>());
     k.chargingSchedule = j.at("chargingSchedule");
 
     // the optional parts of the message
@@ -355,7 +604,8 @@ void from_json(const json& j, ChargingProfile& k) {
         k.transactionId.emplace(j.at("transactionId"));
     }
     if (j.contains("recurrencyKind")) {
-        k.recurrencyKind.emplace(conversions::string_to_recurrency_kind_type(j.at("recurrencyKind")));
+        k.recurrencyKind.emplace(
+            conversions::string_to_recurrency_kind_type(j.at("recurrencyKind").get_ref<const std::string&>()));
     }
     if (j.contains("validFrom")) {
         k.validFrom.emplace(j.at("validFrom").get<std::string>());
@@ -365,6 +615,57 @@ void from_json(const json& j, ChargingProfile& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChargingProfile
+const JsonSaxFields& json_sax_fields(const ChargingProfile*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ChargingProfile::chargingProfileId>("chargingProfileId"),
+        json_sax_field<&ChargingProfile::stackLevel>("stackLevel"),
+        json_sax_field<&ChargingProfile::chargingProfilePurpose,
+                       conversions::string_to_charging_profile_purpose_type>("chargingProfilePurpose"),
+        json_sax_field<&ChargingProfile::chargingProfileKind,
+                       conversions::string_to_charging_profile_kind_type>("chargingProfileKind"),
+        json_sax_field<&ChargingProfile::chargingSchedule>("chargingSchedule"),
+        json_sax_field<&ChargingProfile::transactionId>("transactionId"),
+        json_sax_field<&ChargingProfile::recurrencyKind, conversions::string_to_recurrency_kind_type>("recurrencyKind"),
+        json_sax_field<&ChargingProfile::validFrom>("validFrom"),
+        json_sax_field<&ChargingProfile::validTo>("validTo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ChargingProfile \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChargingProfile& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("chargingProfileId");
+    writer.value(k.chargingProfileId);
+    writer.key("chargingProfileKind");
+    writer.value(conversions::charging_profile_kind_type_to_string(k.chargingProfileKind));
+    writer.key("chargingProfilePurpose");
+    writer.value(conversions::charging_profile_purpose_type_to_string(k.chargingProfilePurpose));
+    writer.key("chargingSchedule");
+    write_json(writer, k.chargingSchedule);
+    if (k.recurrencyKind) {
+        writer.key("recurrencyKind");
+        writer.value(conversions::recurrency_kind_type_to_string(k.recurrencyKind.value()));
+    }
+    writer.key("stackLevel");
+    writer.value(k.stackLevel);
+    if (k.transactionId) {
+        writer.key("transactionId");
+        writer.value(k.transactionId.value());
+    }
+    if (k.validFrom) {
+        writer.key("validFrom");
+        writer.value(k.validFrom.value());
+    }
+    if (k.validTo) {
+        writer.key("validTo");
+        writer.value(k.validTo.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingProfile \p k to the given output stream \p os
 /// \returns an output stream with the ChargingProfile written to
 std::ostream& operator<<(std::ostream& os, const ChargingProfile& k) {
@@ -395,6 +696,28 @@ void from_json(const json& j, LocalAuthorizationList& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a LocalAuthorizationList
+const JsonSaxFields& json_sax_fields(const LocalAuthorizationList*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&LocalAuthorizationList::idTag>("idTag"),
+        json_sax_field<&LocalAuthorizationList::idTagInfo>("idTagInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given LocalAuthorizationList \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const LocalAuthorizationList& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("idTag");
+    writer.value(k.idTag.view());
+    if (k.idTagInfo) {
+        writer.key("idTagInfo");
+        write_json(writer, k.idTagInfo.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given LocalAuthorizationList \p k to the given output stream \p os
 /// \returns an output stream with the LocalAuthorizationList written to
 std::ostream& operator<<(std::ostream& os, const LocalAuthorizationList& k) {
@@ -435,6 +758,39 @@ void from_json(const json& j, FirmwareType& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a FirmwareType
+const JsonSaxFields& json_sax_fields(const FirmwareType*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&FirmwareType::location>("location"),
+        json_sax_field<&FirmwareType::signingCertificate>("signingCertificate"),
+        json_sax_field<&FirmwareType::signature>("signature"),
+        json_sax_field<&FirmwareType::retrieveDateTime>("retrieveDateTime"),
+        json_sax_field<&FirmwareType::installDateTime>("installDateTime"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given FirmwareType \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const FirmwareType& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.installDateTime) {
+        writer.key("installDateTime");
+        writer.value(k.installDateTime.value());
+    }
+    writer.key("location");
+    writer.value(k.location.view());
+    if (k.retrieveDateTime) {
+        writer.key("retrieveDateTime");
+        writer.value(k.retrieveDateTime.value());
+    }
+    writer.key("signature");
+    writer.value(k.signature.view());
+    writer.key("signingCertificate");
+    writer.value(k.signingCertificate.view());
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given FirmwareType \p k to the given output stream \p os
 /// \returns an output stream with the FirmwareType written to
 std::ostream& operator<<(std::ostream& os, const FirmwareType& k) {
@@ -464,6 +820,30 @@ void from_json(const json& j, TransactionData& k) {
     // the optional parts of the message
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a TransactionData
+const JsonSaxFields& json_sax_fields(const TransactionData*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&TransactionData::timestamp>("timestamp"),
+        json_sax_field<&TransactionData::sampledValue>("sampledValue"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given TransactionData \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const TransactionData& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("sampledValue");
+    writer.begin_array();
+    for (const auto& val : k.sampledValue) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    writer.key("timestamp");
+    writer.value(k.timestamp);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given TransactionData \p k to the given output stream \p os
 /// \returns an output stream with the TransactionData written to
 std::ostream& operator<<(std::ostream& os, const TransactionData& k) {
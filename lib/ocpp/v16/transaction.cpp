@@ -160,12 +160,28 @@ int32_t TransactionHandler::get_negative_random_transaction_id() {
     return distr(this->gen);
 }
 
+void TransactionHandler::erase_from_id_tag_index(const std::shared_ptr<Transaction>& transaction) {
+    auto [begin, end] = this->transactions_by_id_tag.equal_range(transaction->get_id_tag());
+    for (auto it = begin; it != end; ++it) {
+        if (it->second == transaction) {
+            this->transactions_by_id_tag.erase(it);
+            return;
+        }
+    }
+}
+
 void TransactionHandler::add_transaction(std::shared_ptr<Transaction> transaction) {
     std::lock_guard<std::mutex> lk(this->active_transactions_mutex);
-    this->active_transactions.at(transaction->get_connector()) = std::move(transaction);
+    auto& active_transaction = this->active_transactions.at(transaction->get_connector());
+    if (active_transaction != nullptr) {
+        this->erase_from_id_tag_index(active_transaction);
+    }
+    this->transactions_by_id_tag.emplace(transaction->get_id_tag(), transaction);
+    active_transaction = std::move(transaction);
 }
 
 void TransactionHandler::add_stopped_transaction(int32_t connector) {
+    std::lock_guard<std::mutex> lk(this->active_transactions_mutex);
     this->stopped_transactions.push_back(std::move(this->active_transactions.at(connector)));
 }
 
@@ -176,16 +192,25 @@ bool TransactionHandler::remove_active_transaction(int32_t connector) {
     }
     {
         std::lock_guard<std::mutex> lock(this->active_transactions_mutex);
-        this->active_transactions.at(connector) = nullptr;
+        auto& active_transaction = this->active_transactions.at(connector);
+        if (active_transaction != nullptr) {
+            this->erase_from_id_tag_index(active_transaction);
+        }
+        active_transaction = nullptr;
     }
     return true;
 }
 
 void TransactionHandler::erase_stopped_transaction(std::string stop_transaction_message_id) {
+    std::lock_guard<std::mutex> lock(this->active_transactions_mutex);
     this->stopped_transactions.erase(
         std::remove_if(this->stopped_transactions.begin(), this->stopped_transactions.end(),
-                       [stop_transaction_message_id](std::shared_ptr<Transaction>& transaction) {
-                           return transaction->get_stop_transaction_message_id() == stop_transaction_message_id;
+                       [this, stop_transaction_message_id](std::shared_ptr<Transaction>& transaction) {
+                           if (transaction->get_stop_transaction_message_id() == stop_transaction_message_id) {
+                               this->erase_from_id_tag_index(transaction);
+                               return true;
+                           }
+                           return false;
                        }),
         this->stopped_transactions.end());
 }
@@ -216,18 +241,26 @@ std::shared_ptr<Transaction> TransactionHandler::get_transaction(const std::stri
 }
 
 std::shared_ptr<Transaction> TransactionHandler::get_transaction_from_id_tag(const std::string& id_tag) {
-    std::lock_guard<std::mutex> lock(this->active_transactions_mutex);
-    for (const auto& transaction : this->active_transactions) {
-        if (transaction != nullptr && (transaction->get_id_tag().get() == id_tag)) {
-            return transaction;
-        }
+    if (id_tag.size() > 20) {
+        return nullptr;
     }
-    for (auto transaction : this->stopped_transactions) {
-        if (transaction->get_id_tag().get() == id_tag) {
-            return transaction;
+    std::lock_guard<std::mutex> lock(this->active_transactions_mutex);
+    std::shared_ptr<Transaction> result = nullptr;
+    auto [begin, end] = this->transactions_by_id_tag.equal_range(CiString<20>(id_tag));
+    for (auto it = begin; it != end; ++it) {
+        const auto& transaction = it->second;
+        const auto connector = transaction->get_connector();
+        if (this->active_transactions.at(connector) == transaction) {
+            // the active transaction on the lowest connector
+            if (result == nullptr or this->active_transactions.at(result->get_connector()) != result or
+                connector < result->get_connector()) {
+                result = transaction;
+            }
+        } else if (result == nullptr) {
+            result = transaction;
         }
     }
-    return nullptr;
+    return result;
 }
 
 int32_t TransactionHandler::get_connector_from_transaction_id(int32_t transaction_id) {
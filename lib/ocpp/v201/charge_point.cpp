@@ -29,6 +29,8 @@ namespace v201 {
 
 const auto DEFAULT_BOOT_NOTIFICATION_RETRY_INTERVAL = std::chrono::seconds(30);
 const auto DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD = 2E5;
+const auto DEFAULT_MESSAGE_QUEUE_MAX_MESSAGES_IN_FLIGHT = 1;
+const auto DEFAULT_MESSAGE_QUEUE_COALESCED_MESSAGE_TYPES = "StatusNotification";
 const auto DEFAULT_MAX_MESSAGE_SIZE = 65000;
 
 static DisplayMessageContent message_content_to_display_message_content(const MessageContent& message_content);
@@ -39,8 +41,8 @@ ChargePoint::ChargePoint(const std::map<int32_t, int32_t>& evse_connector_struct
                          std::shared_ptr<DeviceModel> device_model, std::shared_ptr<DatabaseHandler> database_handler,
                          std::shared_ptr<MessageQueue<v201::MessageType>> message_queue,
                          const std::string& message_log_path, const std::shared_ptr<EvseSecurity> evse_security,
-                         const Callbacks& callbacks) :
-    ocpp::ChargingStationBase(evse_security),
+                         const Callbacks& callbacks, std::shared_ptr<ChargingStationHost> host) :
+    ocpp::ChargingStationBase(evse_security, std::nullopt, host),
     message_queue(message_queue),
     device_model(device_model),
     database_handler(database_handler),
@@ -51,14 +53,25 @@ ChargePoint::ChargePoint(const std::map<int32_t, int32_t>& evse_connector_struct
     firmware_status(FirmwareStatusEnum::Idle),
     upload_log_status(UploadLogStatusEnum::Idle),
     bootreason(BootReasonEnum::PowerUp),
-    ocsp_updater(this->evse_security, this->send_callback<GetCertificateStatusRequest, GetCertificateStatusResponse>(
-                                          MessageType::GetCertificateStatusResponse)),
+    ocsp_updater(this->evse_security,
+                 this->send_callback<GetCertificateStatusRequest, GetCertificateStatusResponse>(
+                     MessageType::GetCertificateStatusResponse),
+                 DEFAULT_OCSP_CACHE_UPDATE_INTERVAL, DEFAULT_OCSP_CACHE_UPDATE_RETRY_INTERVAL, &this->io_service),
     monitoring_updater(
         device_model, [this](const std::vector<EventData>& events) { this->notify_event_req(events); },
         [this]() { return this->is_offline(); }),
     csr_attempt(1),
-    client_certificate_expiration_check_timer([this]() { this->scheduled_check_client_certificate_expiration(); }),
-    v2g_certificate_expiration_check_timer([this]() { this->scheduled_check_v2g_certificate_expiration(); }),
+    heartbeat_timer(&this->io_service),
+    boot_notification_timer(&this->io_service),
+    client_certificate_expiration_check_timer(&this->io_service,
+                                              [this]() { this->scheduled_check_client_certificate_expiration(); }),
+    v2g_certificate_expiration_check_timer(&this->io_service,
+                                           [this]() { this->scheduled_check_v2g_certificate_expiration(); }),
+    aligned_meter_values_timer(&this->io_service),
+    certificate_signed_timer(&this->io_service),
+    auth_cache_cleanup_timer(&this->io_service),
+    auth_cache_cleanup_trigger_timer(&this->io_service),
+    auth_cache_size_update_timer(&this->io_service),
     callbacks(callbacks) {
 
     if (!this->device_model) {
@@ -82,28 +95,29 @@ ChargePoint::ChargePoint(const std::map<int32_t, int32_t>& evse_connector_struct
                          const std::string& device_model_migration_path, const std::string& device_model_config_path,
                          const std::string& ocpp_main_path, const std::string& core_database_path,
                          const std::string& sql_init_path, const std::string& message_log_path,
-                         const std::shared_ptr<EvseSecurity> evse_security, const Callbacks& callbacks) :
+                         const std::shared_ptr<EvseSecurity> evse_security, const Callbacks& callbacks,
+                         std::shared_ptr<ChargingStationHost> host) :
     ChargePoint(evse_connector_structure,
                 std::make_unique<DeviceModelStorageSqlite>(device_model_storage_address, device_model_migration_path,
                                                            device_model_config_path, initialize_device_model),
-                ocpp_main_path, core_database_path, sql_init_path, message_log_path, evse_security, callbacks) {
+                ocpp_main_path, core_database_path, sql_init_path, message_log_path, evse_security, callbacks, host) {
 }
 
 ChargePoint::ChargePoint(const std::map<int32_t, int32_t>& evse_connector_structure,
                          const std::string& device_model_storage_address, const std::string& ocpp_main_path,
                          const std::string& core_database_path, const std::string& sql_init_path,
                          const std::string& message_log_path, const std::shared_ptr<EvseSecurity> evse_security,
-                         const Callbacks& callbacks) :
+                         const Callbacks& callbacks, std::shared_ptr<ChargingStationHost> host) :
     ChargePoint(evse_connector_structure, std::make_unique<DeviceModelStorageSqlite>(device_model_storage_address),
-                ocpp_main_path, core_database_path, sql_init_path, message_log_path, evse_security, callbacks) {
+                ocpp_main_path, core_database_path, sql_init_path, message_log_path, evse_security, callbacks, host) {
 }
 
 ChargePoint::ChargePoint(const std::map<int32_t, int32_t>& evse_connector_structure,
                          std::unique_ptr<DeviceModelStorage> device_model_storage, const std::string& ocpp_main_path,
                          const std::string& core_database_path, const std::string& sql_init_path,
                          const std::string& message_log_path, const std::shared_ptr<EvseSecurity> evse_security,
-                         const Callbacks& callbacks) :
-    ocpp::ChargingStationBase(evse_security),
+                         const Callbacks& callbacks, std::shared_ptr<ChargingStationHost> host) :
+    ocpp::ChargingStationBase(evse_security, std::nullopt, host),
     registration_status(RegistrationStatusEnum::Rejected),
     skip_invalid_csms_certificate_notifications(false),
     reset_scheduled(false),
@@ -111,17 +125,27 @@ ChargePoint::ChargePoint(const std::map<int32_t, int32_t>& evse_connector_struct
     firmware_status(FirmwareStatusEnum::Idle),
     upload_log_status(UploadLogStatusEnum::Idle),
     bootreason(BootReasonEnum::PowerUp),
-    ocsp_updater(this->evse_security, this->send_callback<GetCertificateStatusRequest, GetCertificateStatusResponse>(
-                                          MessageType::GetCertificateStatusResponse)),
+    ocsp_updater(this->evse_security,
+                 this->send_callback<GetCertificateStatusRequest, GetCertificateStatusResponse>(
+                     MessageType::GetCertificateStatusResponse),
+                 DEFAULT_OCSP_CACHE_UPDATE_INTERVAL, DEFAULT_OCSP_CACHE_UPDATE_RETRY_INTERVAL, &this->io_service),
     device_model(std::make_shared<DeviceModel>(std::move(device_model_storage))),
     monitoring_updater(
         device_model, [this](const std::vector<EventData>& events) { this->notify_event_req(events); },
         [this]() { return this->is_offline(); }),
     csr_attempt(1),
-    client_certificate_expiration_check_timer([this]() { this->scheduled_check_client_certificate_expiration(); }),
-    v2g_certificate_expiration_check_timer([this]() { this->scheduled_check_v2g_certificate_expiration(); }),
-    callbacks(callbacks),
-    stop_auth_cache_cleanup_handler(false) {
+    heartbeat_timer(&this->io_service),
+    boot_notification_timer(&this->io_service),
+    client_certificate_expiration_check_timer(&this->io_service,
+                                              [this]() { this->scheduled_check_client_certificate_expiration(); }),
+    v2g_certificate_expiration_check_timer(&this->io_service,
+                                           [this]() { this->scheduled_check_v2g_certificate_expiration(); }),
+    aligned_meter_values_timer(&this->io_service),
+    certificate_signed_timer(&this->io_service),
+    auth_cache_cleanup_timer(&this->io_service),
+    auth_cache_cleanup_trigger_timer(&this->io_service),
+    auth_cache_size_update_timer(&this->io_service),
+    callbacks(callbacks) {
     // Make sure the received callback struct is completely filled early before we actually start running
     if (!this->callbacks.all_callbacks_valid(this->device_model)) {
         EVLOG_AND_THROW(std::invalid_argument("All non-optional callbacks must be supplied"));
@@ -129,6 +153,7 @@ ChargePoint::ChargePoint(const std::map<int32_t, int32_t>& evse_connector_struct
 
     auto database_connection = std::make_unique<common::DatabaseConnection>(fs::path(core_database_path) / "cp.db");
     this->database_handler = std::make_shared<DatabaseHandler>(std::move(database_connection), sql_init_path);
+    this->database_handler->set_message_queue_flush_io_context(&this->io_service);
 
     initialize(evse_connector_structure, message_log_path);
 
@@ -150,31 +175,118 @@ ChargePoint::ChargePoint(const std::map<int32_t, int32_t>& evse_connector_struct
         EVLOG_warning << "Could not apply MessageTypesDiscardForQueueing configuration";
     }
 
+    MessageQueueConfig<v201::MessageType> message_queue_config{
+        this->device_model->get_value<int>(ControllerComponentVariables::MessageAttempts),
+        this->device_model->get_value<int>(ControllerComponentVariables::MessageAttemptInterval),
+        this->device_model->get_optional_value<int>(ControllerComponentVariables::MessageQueueSizeThreshold)
+            .value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
+        this->device_model->get_optional_value<bool>(ControllerComponentVariables::QueueAllMessages).value_or(false),
+        message_types_discard_for_queueing,
+        this->device_model->get_value<int>(ControllerComponentVariables::MessageTimeout)};
+    message_queue_config.max_messages_in_flight =
+        this->device_model->get_optional_value<int>(ControllerComponentVariables::MessageQueueMaxMessagesInFlight)
+            .value_or(DEFAULT_MESSAGE_QUEUE_MAX_MESSAGES_IN_FLIGHT);
+
+    const auto apply_scheduling_class = [this, &message_queue_config](const ComponentVariable& component_variable,
+                                                                      const MessageSchedulingClass scheduling_class) {
+        try {
+            const auto message_types_csl = ocpp::split_string(
+                this->device_model->get_optional_value<std::string>(component_variable).value_or(""), ',');
+            for (const auto& element : message_types_csl) {
+                message_queue_config.message_scheduling_classes[conversions::string_to_messagetype(element)] =
+                    scheduling_class;
+            }
+        } catch (const StringToEnumException& e) {
+            EVLOG_warning << "Could not convert configured MessageType value of "
+                          << component_variable.variable.value().name << ". Please check your configuration: "
+                          << e.what();
+        } catch (...) {
+            EVLOG_warning << "Could not apply " << component_variable.variable.value().name << " configuration";
+        }
+    };
+    apply_scheduling_class(ControllerComponentVariables::MessageQueueHighPriorityMessageTypes,
+                           MessageSchedulingClass::High);
+    apply_scheduling_class(ControllerComponentVariables::MessageQueueLowPriorityMessageTypes,
+                           MessageSchedulingClass::Low);
+    message_queue_config.high_priority_messages_before_transaction_messages =
+        this->device_model
+            ->get_optional_value<bool>(ControllerComponentVariables::MessageQueueHighPriorityBeforeTransactionMessages)
+            .value_or(false);
+    message_queue_config.weighted_fair_scheduling =
+        this->device_model->get_optional_value<bool>(ControllerComponentVariables::MessageQueueWeightedFairScheduling)
+            .value_or(false);
+
+    try {
+        const auto coalesced_message_types_csl = ocpp::split_string(
+            this->device_model
+                ->get_optional_value<std::string>(ControllerComponentVariables::MessageQueueCoalescedMessageTypes)
+                .value_or(DEFAULT_MESSAGE_QUEUE_COALESCED_MESSAGE_TYPES),
+            ',');
+        std::transform(coalesced_message_types_csl.begin(), coalesced_message_types_csl.end(),
+                       std::inserter(message_queue_config.coalesced_message_types,
+                                     message_queue_config.coalesced_message_types.end()),
+                       [](const std::string element) { return conversions::string_to_messagetype(element); });
+    } catch (const StringToEnumException& e) {
+        EVLOG_warning << "Could not convert configured MessageType value of MessageQueueCoalescedMessageTypes. Please "
+                         "check you configuration: "
+                      << e.what();
+    } catch (...) {
+        EVLOG_warning << "Could not apply MessageQueueCoalescedMessageTypes configuration";
+    }
+
+    const auto directly_deserialized_message_types = this->device_model->get_optional_value<std::string>(
+        ControllerComponentVariables::MessageQueueDirectlyDeserializedMessageTypes);
+    if (directly_deserialized_message_types.has_value()) {
+        try {
+            const auto message_types_csl = ocpp::split_string(directly_deserialized_message_types.value(), ',');
+            std::transform(message_types_csl.begin(), message_types_csl.end(),
+                           std::inserter(message_queue_config.directly_deserialized_message_types,
+                                         message_queue_config.directly_deserialized_message_types.end()),
+                           [](const std::string element) { return conversions::string_to_messagetype(element); });
+        } catch (const StringToEnumException& e) {
+            EVLOG_warning << "Could not convert configured MessageType value of "
+                             "MessageQueueDirectlyDeserializedMessageTypes. Please check your configuration: "
+                          << e.what();
+        } catch (...) {
+            EVLOG_warning << "Could not apply MessageQueueDirectlyDeserializedMessageTypes configuration";
+        }
+    }
+
     this->message_queue = std::make_unique<ocpp::MessageQueue<v201::MessageType>>(
-        [this](json message) -> bool { return this->connectivity_manager->send_to_websocket(message.dump()); },
-        MessageQueueConfig<v201::MessageType>{
-            this->device_model->get_value<int>(ControllerComponentVariables::MessageAttempts),
-            this->device_model->get_value<int>(ControllerComponentVariables::MessageAttemptInterval),
-            this->device_model->get_optional_value<int>(ControllerComponentVariables::MessageQueueSizeThreshold)
-                .value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
-            this->device_model->get_optional_value<bool>(ControllerComponentVariables::QueueAllMessages)
-                .value_or(false),
-            message_types_discard_for_queueing,
-            this->device_model->get_value<int>(ControllerComponentVariables::MessageTimeout)},
-        this->database_handler);
+        [this](const std::string& message) -> bool { return this->connectivity_manager->send_to_websocket(message); },
+        message_queue_config, this->database_handler, &this->io_service);
+
+    const auto message_schemas_path =
+        this->device_model->get_optional_value<std::string>(ControllerComponentVariables::MessageSchemasPath);
+    if (message_schemas_path.has_value() and !message_schemas_path.value().empty()) {
+        this->message_schema_validator = std::make_unique<MessageSchemaValidator<v201::MessageType>>(
+            message_schemas_path.value(),
+            [](const std::string& action) { return conversions::string_to_messagetype(action); });
+    }
 }
 
 ChargePoint::~ChargePoint() {
-    {
-        std::scoped_lock lk(this->auth_cache_cleanup_mutex);
-        this->stop_auth_cache_cleanup_handler = true;
-    }
-    this->auth_cache_cleanup_cv.notify_one();
-    this->auth_cache_cleanup_thread.join();
+    // a running OCSP cache update waits for a response, which can need the io_service, so it is stopped before
+    this->ocsp_updater.stop();
+    this->hold_io_service([this]() {
+        for (auto* timer : {&this->heartbeat_timer, &this->boot_notification_timer,
+                            &this->client_certificate_expiration_check_timer,
+                            &this->v2g_certificate_expiration_check_timer, &this->certificate_signed_timer,
+                            &this->auth_cache_cleanup_timer, &this->auth_cache_cleanup_trigger_timer,
+                            &this->auth_cache_size_update_timer}) {
+            timer->stop();
+        }
+        this->aligned_meter_values_timer.stop();
+        if (this->message_queue != nullptr) {
+            this->message_queue->stop_timers();
+        }
+        this->database_handler->stop_message_queue_flush_timer();
+    });
 }
 
 void ChargePoint::start(BootReasonEnum bootreason) {
     this->message_queue->start();
+    this->connectivity_manager->get_reconnect_scheduler()->on_start();
 
     this->bootreason = bootreason;
     // Trigger all initial status notifications and callbacks related to component state
@@ -1170,7 +1282,15 @@ void ChargePoint::initialize(const std::map<int32_t, int32_t>& evse_connector_st
     this->configure_message_logging_format(message_log_path);
     this->monitoring_updater.start_monitoring();
 
-    this->auth_cache_cleanup_thread = std::thread(&ChargePoint::cache_cleanup_handler, this);
+    // Run the update once so the ram variable gets initialized
+    this->auth_cache_size_update_timer.timeout([this]() { this->update_authorization_cache_size(); },
+                                               std::chrono::seconds(0));
+    this->auth_cache_cleanup_timer.interval(
+        [this]() {
+            EVLOG_debug << "Time based authorization cache cleanup";
+            this->cache_cleanup_handler();
+        },
+        std::chrono::minutes(15));
 
     this->connectivity_manager =
         std::make_unique<ConnectivityManager>(*this->device_model, this->evse_security, this->logging,
@@ -1264,52 +1384,52 @@ void ChargePoint::handle_message(const EnhancedMessage<v201::MessageType>& messa
         this->handle_boot_notification_response(json_message);
         break;
     case MessageType::SetVariables:
-        this->handle_set_variables_req(json_message);
+        this->handle_set_variables_req(to_call<SetVariablesRequest>(message));
         break;
     case MessageType::GetVariables:
         this->handle_get_variables_req(message);
         break;
     case MessageType::GetBaseReport:
-        this->handle_get_base_report_req(json_message);
+        this->handle_get_base_report_req(to_call<GetBaseReportRequest>(message));
         break;
     case MessageType::GetReport:
         this->handle_get_report_req(message);
         break;
     case MessageType::Reset:
-        this->handle_reset_req(json_message);
+        this->handle_reset_req(to_call<ResetRequest>(message));
         break;
     case MessageType::SetNetworkProfile:
-        this->handle_set_network_profile_req(json_message);
+        this->handle_set_network_profile_req(to_call<SetNetworkProfileRequest>(message));
         break;
     case MessageType::ChangeAvailability:
-        this->handle_change_availability_req(json_message);
+        this->handle_change_availability_req(to_call<ChangeAvailabilityRequest>(message));
         break;
     case MessageType::TransactionEventResponse:
         this->handle_transaction_event_response(message);
         break;
     case MessageType::RequestStartTransaction:
-        this->handle_remote_start_transaction_request(json_message);
+        this->handle_remote_start_transaction_request(to_call<RequestStartTransactionRequest>(message));
         break;
     case MessageType::RequestStopTransaction:
-        this->handle_remote_stop_transaction_request(json_message);
+        this->handle_remote_stop_transaction_request(to_call<RequestStopTransactionRequest>(message));
         break;
     case MessageType::DataTransfer:
-        this->handle_data_transfer_req(json_message);
+        this->handle_data_transfer_req(to_call<DataTransferRequest>(message));
         break;
     case MessageType::GetLog:
-        this->handle_get_log_req(json_message);
+        this->handle_get_log_req(to_call<GetLogRequest>(message));
         break;
     case MessageType::ClearCache:
-        this->handle_clear_cache_req(json_message);
+        this->handle_clear_cache_req(to_call<ClearCacheRequest>(message));
         break;
     case MessageType::UpdateFirmware:
-        this->handle_firmware_update_req(json_message);
+        this->handle_firmware_update_req(to_call<UpdateFirmwareRequest>(message));
         break;
     case MessageType::UnlockConnector:
-        this->handle_unlock_connector(json_message);
+        this->handle_unlock_connector(to_call<UnlockConnectorRequest>(message));
         break;
     case MessageType::TriggerMessage:
-        this->handle_trigger_message(json_message);
+        this->handle_trigger_message(to_call<TriggerMessageRequest>(message));
         break;
     case MessageType::SignCertificateResponse:
         this->handle_sign_certificate_response(json_message);
@@ -1318,67 +1438,67 @@ void ChargePoint::handle_message(const EnhancedMessage<v201::MessageType>& messa
         this->handle_heartbeat_response(json_message);
         break;
     case MessageType::SendLocalList:
-        this->handle_send_local_authorization_list_req(json_message);
+        this->handle_send_local_authorization_list_req(to_call<SendLocalListRequest>(message));
         break;
     case MessageType::GetLocalListVersion:
-        this->handle_get_local_authorization_list_version_req(json_message);
+        this->handle_get_local_authorization_list_version_req(to_call<GetLocalListVersionRequest>(message));
         break;
     case MessageType::CertificateSigned:
-        this->handle_certificate_signed_req(json_message);
+        this->handle_certificate_signed_req(to_call<CertificateSignedRequest>(message));
         break;
     case MessageType::GetTransactionStatus:
-        this->handle_get_transaction_status(json_message);
+        this->handle_get_transaction_status(to_call<GetTransactionStatusRequest>(message));
         break;
     case MessageType::GetInstalledCertificateIds:
-        this->handle_get_installed_certificate_ids_req(json_message);
+        this->handle_get_installed_certificate_ids_req(to_call<GetInstalledCertificateIdsRequest>(message));
         break;
     case MessageType::InstallCertificate:
-        this->handle_install_certificate_req(json_message);
+        this->handle_install_certificate_req(to_call<InstallCertificateRequest>(message));
         break;
     case MessageType::DeleteCertificate:
-        this->handle_delete_certificate_req(json_message);
+        this->handle_delete_certificate_req(to_call<DeleteCertificateRequest>(message));
         break;
     case MessageType::CustomerInformation:
-        this->handle_customer_information_req(json_message);
+        this->handle_customer_information_req(to_call<CustomerInformationRequest>(message));
         break;
     case MessageType::SetChargingProfile:
-        this->handle_set_charging_profile_req(json_message);
+        this->handle_set_charging_profile_req(to_call<SetChargingProfileRequest>(message));
         break;
     case MessageType::ClearChargingProfile:
-        this->handle_clear_charging_profile_req(json_message);
+        this->handle_clear_charging_profile_req(to_call<ClearChargingProfileRequest>(message));
         break;
     case MessageType::GetChargingProfiles:
-        this->handle_get_charging_profiles_req(json_message);
+        this->handle_get_charging_profiles_req(to_call<GetChargingProfilesRequest>(message));
         break;
     case MessageType::GetCompositeSchedule:
-        this->handle_get_composite_schedule_req(json_message);
+        this->handle_get_composite_schedule_req(to_call<GetCompositeScheduleRequest>(message));
         break;
     case MessageType::SetMonitoringBase:
-        this->handle_set_monitoring_base_req(json_message);
+        this->handle_set_monitoring_base_req(to_call<SetMonitoringBaseRequest>(message));
         break;
     case MessageType::SetMonitoringLevel:
-        this->handle_set_monitoring_level_req(json_message);
+        this->handle_set_monitoring_level_req(to_call<SetMonitoringLevelRequest>(message));
         break;
     case MessageType::SetVariableMonitoring:
         this->handle_set_variable_monitoring_req(message);
         break;
     case MessageType::GetMonitoringReport:
-        this->handle_get_monitoring_report_req(json_message);
+        this->handle_get_monitoring_report_req(to_call<GetMonitoringReportRequest>(message));
         break;
     case MessageType::ClearVariableMonitoring:
-        this->handle_clear_variable_monitoring_req(json_message);
+        this->handle_clear_variable_monitoring_req(to_call<ClearVariableMonitoringRequest>(message));
         break;
     case MessageType::GetDisplayMessages:
-        this->handle_get_display_message(json_message);
+        this->handle_get_display_message(to_call<GetDisplayMessagesRequest>(message));
         break;
     case MessageType::SetDisplayMessage:
-        this->handle_set_display_message(json_message);
+        this->handle_set_display_message(to_call<SetDisplayMessageRequest>(message));
         break;
     case MessageType::ClearDisplayMessage:
-        this->handle_clear_display_message(json_message);
+        this->handle_clear_display_message(to_call<ClearDisplayMessageRequest>(message));
         break;
     case MessageType::CostUpdated:
-        this->handle_costupdated_req(json_message);
+        this->handle_costupdated_req(to_call<CostUpdatedRequest>(message));
         break;
     default:
         if (message.messageTypeId == MessageTypeId::CALL) {
@@ -1406,9 +1526,26 @@ void ChargePoint::message_callback(const std::string& message) {
     }
 
     enhanced_message.message_size = message.size();
-    auto json_message = enhanced_message.message;
-    this->logging->central_system(conversions::messagetype_to_string(enhanced_message.messageType), message);
+    const auto& json_message = enhanced_message.message;
+    if (enhanced_message.call_text.has_value()) {
+        // the payload is missing from json_message, format the received text instead
+        this->logging->central_system(conversions::messagetype_to_string(enhanced_message.messageType), message);
+    } else {
+        this->logging->central_system(conversions::messagetype_to_string(enhanced_message.messageType), message,
+                                      json_message);
+    }
     try {
+        if (this->message_schema_validator != nullptr) {
+            const auto call_error = this->message_schema_validator->validate(enhanced_message);
+            if (call_error.has_value()) {
+                EVLOG_error << "Received an invalid "
+                            << conversions::messagetype_to_string(enhanced_message.messageType) << ": "
+                            << call_error.value().errorDescription;
+                this->send(call_error.value());
+                return;
+            }
+        }
+
         if (this->registration_status == RegistrationStatusEnum::Accepted) {
             this->handle_message(enhanced_message);
         } else if (this->registration_status == RegistrationStatusEnum::Pending) {
@@ -1453,7 +1590,7 @@ void ChargePoint::message_callback(const std::string& message) {
             if (enhanced_message.messageType == MessageType::BootNotificationResponse) {
                 this->handle_boot_notification_response(json_message);
             } else if (enhanced_message.messageType == MessageType::TriggerMessage) {
-                Call<TriggerMessageRequest> call(json_message);
+                const auto call = to_call<TriggerMessageRequest>(enhanced_message);
                 if (call.msg.requestedMessage == MessageTriggerEnum::BootNotification) {
                     this->handle_message(enhanced_message);
                 } else {
@@ -2420,6 +2557,7 @@ void ChargePoint::handle_boot_notification_response(CallResult<BootNotificationR
 
     if (this->registration_status == RegistrationStatusEnum::Accepted) {
         this->message_queue->set_registration_status_accepted();
+        this->connectivity_manager->get_reconnect_scheduler()->on_boot_notification_accepted();
         // B01.FR.06 Only use boot timestamp if TimeSource contains Heartbeat
         if (this->callbacks.time_sync_callback.has_value() and
             this->device_model->get_value<std::string>(ControllerComponentVariables::TimeSource).find("Heartbeat") !=
@@ -2479,7 +2617,7 @@ void ChargePoint::handle_set_variables_req(Call<SetVariablesRequest> call) {
 }
 
 void ChargePoint::handle_get_variables_req(const EnhancedMessage<v201::MessageType>& message) {
-    Call<GetVariablesRequest> call = message.call_message;
+    Call<GetVariablesRequest> call = to_call<GetVariablesRequest>(message);
     const auto msg = call.msg;
 
     const auto max_variables_per_message =
@@ -2525,7 +2663,7 @@ void ChargePoint::handle_get_base_report_req(Call<GetBaseReportRequest> call) {
 }
 
 void ChargePoint::handle_get_report_req(const EnhancedMessage<v201::MessageType>& message) {
-    Call<GetReportRequest> call = message.call_message;
+    Call<GetReportRequest> call = to_call<GetReportRequest>(message);
     const auto msg = call.msg;
     std::vector<ReportData> report_data;
     GetReportResponse response;
@@ -3707,7 +3845,7 @@ void ChargePoint::handle_set_monitoring_level_req(Call<SetMonitoringLevelRequest
 }
 
 void ChargePoint::handle_set_variable_monitoring_req(const EnhancedMessage<v201::MessageType>& message) {
-    Call<SetVariableMonitoringRequest> call = message.call_message;
+    Call<SetVariableMonitoringRequest> call = to_call<SetVariableMonitoringRequest>(message);
     SetVariableMonitoringResponse response;
     const auto& msg = call.msg;
 
@@ -3992,7 +4130,8 @@ void ChargePoint::handle_data_transfer_req(Call<DataTransferRequest> call) {
 }
 
 template <class T> bool ChargePoint::send(ocpp::Call<T> call, const bool initiated_by_trigger_message) {
-    const auto message_type = conversions::string_to_messagetype(json(call).at(CALL_ACTION));
+    const auto message_type =
+        conversions::string_to_messagetype(json(call).at(CALL_ACTION).get_ref<const std::string&>());
     const auto message_transmission_priority = get_message_transmission_priority(
         is_boot_notification_message(message_type), initiated_by_trigger_message,
         (this->registration_status == RegistrationStatusEnum::Accepted), is_transaction_message(message_type),
@@ -4011,7 +4150,8 @@ template <class T> bool ChargePoint::send(ocpp::Call<T> call, const bool initiat
 }
 
 template <class T> std::future<EnhancedMessage<v201::MessageType>> ChargePoint::send_async(ocpp::Call<T> call) {
-    const auto message_type = conversions::string_to_messagetype(json(call).at(CALL_ACTION));
+    const auto message_type =
+        conversions::string_to_messagetype(json(call).at(CALL_ACTION).get_ref<const std::string&>());
     const auto message_transmission_priority = get_message_transmission_priority(
         is_boot_notification_message(message_type), false,
         (this->registration_status == RegistrationStatusEnum::Accepted), is_transaction_message(message_type),
@@ -4258,60 +4398,39 @@ void ChargePoint::websocket_connection_failed(ConnectionFailedReason reason) {
 }
 
 void ChargePoint::trigger_authorization_cache_cleanup() {
-    {
-        std::scoped_lock lk(this->auth_cache_cleanup_mutex);
-        this->auth_cache_cleanup_required = true;
-    }
-    this->auth_cache_cleanup_cv.notify_one();
+    this->auth_cache_cleanup_trigger_timer.timeout(
+        [this]() {
+            EVLOG_debug << "Triggered authorization cache cleanup";
+            this->cache_cleanup_handler();
+        },
+        std::chrono::seconds(0));
 }
 
 void ChargePoint::cache_cleanup_handler() {
-    // Run the update once so the ram variable gets initialized
-    this->update_authorization_cache_size();
-
-    while (true) {
-        {
-            // Wait for next wakeup or timeout
-            std::unique_lock lk(this->auth_cache_cleanup_mutex);
-            if (this->auth_cache_cleanup_cv.wait_for(lk, std::chrono::minutes(15), [&]() {
-                    return this->stop_auth_cache_cleanup_handler or this->auth_cache_cleanup_required;
-                })) {
-                EVLOG_debug << "Triggered authorization cache cleanup";
-            } else {
-                EVLOG_debug << "Time based authorization cache cleanup";
-            }
-            this->auth_cache_cleanup_required = false;
-        }
-
-        if (this->stop_auth_cache_cleanup_handler) {
-            break;
-        }
-
-        auto lifetime = this->device_model->get_optional_value<int>(ControllerComponentVariables::AuthCacheLifeTime);
-        try {
-            this->database_handler->authorization_cache_delete_expired_entries(
-                lifetime.has_value() ? std::optional<std::chrono::seconds>(*lifetime) : std::nullopt);
-
-            auto meta_data = this->device_model->get_variable_meta_data(
-                ControllerComponentVariables::AuthCacheStorage.component,
-                ControllerComponentVariables::AuthCacheStorage.variable.value());
-
-            if (meta_data.has_value()) {
-                auto max_storage = meta_data->characteristics.maxLimit;
-                if (max_storage.has_value()) {
-                    while (this->database_handler->authorization_cache_get_binary_size() > max_storage.value()) {
-                        this->database_handler->authorization_cache_delete_nr_of_oldest_entries(1);
-                    }
+    auto lifetime = this->device_model->get_optional_value<int>(ControllerComponentVariables::AuthCacheLifeTime);
+    try {
+        this->database_handler->authorization_cache_delete_expired_entries(
+            lifetime.has_value() ? std::optional<std::chrono::seconds>(*lifetime) : std::nullopt);
+
+        auto meta_data = this->device_model->get_variable_meta_data(
+            ControllerComponentVariables::AuthCacheStorage.component,
+            ControllerComponentVariables::AuthCacheStorage.variable.value());
+
+        if (meta_data.has_value()) {
+            auto max_storage = meta_data->characteristics.maxLimit;
+            if (max_storage.has_value()) {
+                while (this->database_handler->authorization_cache_get_binary_size() > max_storage.value()) {
+                    this->database_handler->authorization_cache_delete_nr_of_oldest_entries(1);
                 }
             }
-        } catch (const DatabaseException& e) {
-            EVLOG_warning << "Could not delete expired authorization cache entries from database: " << e.what();
-        } catch (const std::exception& e) {
-            EVLOG_warning << "Could not delete expired authorization cache entries from database: " << e.what();
         }
-
-        this->update_authorization_cache_size();
+    } catch (const DatabaseException& e) {
+        EVLOG_warning << "Could not delete expired authorization cache entries from database: " << e.what();
+    } catch (const std::exception& e) {
+        EVLOG_warning << "Could not delete expired authorization cache entries from database: " << e.what();
     }
+
+    this->update_authorization_cache_size();
 }
 
 GetCompositeScheduleResponse ChargePoint::get_composite_schedule_internal(const GetCompositeScheduleRequest& request) {
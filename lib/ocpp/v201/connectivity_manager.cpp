@@ -23,6 +23,7 @@ ConnectivityManager::ConnectivityManager(DeviceModel& device_model, std::shared_
     logging{logging},
     websocket{nullptr},
     message_callback{message_callback},
+    reconnect_scheduler{std::make_shared<ReconnectScheduler>()},
     disable_automatic_websocket_reconnects{false},
     network_configuration_priority{0} {
 }
@@ -86,6 +87,10 @@ bool ConnectivityManager::is_websocket_connected() {
     return this->websocket != nullptr && this->websocket->is_connected();
 }
 
+std::shared_ptr<ReconnectScheduler> ConnectivityManager::get_reconnect_scheduler() {
+    return this->reconnect_scheduler;
+}
+
 void ConnectivityManager::start() {
     init_websocket();
     if (websocket != nullptr) {
@@ -168,6 +173,7 @@ void ConnectivityManager::init_websocket() {
     }
 
     this->websocket = std::make_unique<Websocket>(connection_options, this->evse_security, this->logging);
+    this->websocket->set_reconnect_scheduler(this->reconnect_scheduler, std::stoi(configuration_slot));
 
     if (this->websocket_connected_callback.has_value()) {
         this->websocket->register_connected_callback(websocket_connected_callback.value());
@@ -243,7 +249,18 @@ WebsocketConnectionOptions ConnectivityManager::get_ws_connection_options(const
             .value_or(false),
         this->device_model.get_optional_value<std::string>(ControllerComponentVariables::IFace),
         this->device_model.get_optional_value<bool>(ControllerComponentVariables::EnableTLSKeylog).value_or(false),
-        this->device_model.get_optional_value<std::string>(ControllerComponentVariables::TLSKeylogFile)};
+        this->device_model.get_optional_value<std::string>(ControllerComponentVariables::TLSKeylogFile),
+        false, // use_single_threaded_event_loop, the message handlers can wait for responses of the CSMS
+        this->device_model.get_optional_value<size_t>(ControllerComponentVariables::MaxReceivedMessageSize)
+            .value_or(0),
+        this->device_model.get_optional_value<bool>(ControllerComponentVariables::WebsocketPermessageDeflate)
+            .value_or(false),
+        this->device_model.get_optional_value<int>(ControllerComponentVariables::WebsocketPermessageDeflateWindowBits)
+            .value_or(15),
+        this->device_model
+            .get_optional_value<int>(ControllerComponentVariables::WebsocketPermessageDeflateCompressionLevel)
+            .value_or(6),
+        this->device_model.get_optional_value<int>(ControllerComponentVariables::ReconnectProbeInterval).value_or(0)};
 
     return connection_options;
 }
@@ -268,6 +268,34 @@ const ComponentVariable& TLSKeylogFile = {
         "TLSKeylogFile",
     }),
 };
+const ComponentVariable& WebsocketPermessageDeflate = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "WebsocketPermessageDeflate",
+    }),
+};
+const ComponentVariable& WebsocketPermessageDeflateWindowBits = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "WebsocketPermessageDeflateWindowBits",
+    }),
+};
+const ComponentVariable& WebsocketPermessageDeflateCompressionLevel = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "WebsocketPermessageDeflateCompressionLevel",
+    }),
+};
+const ComponentVariable& ReconnectProbeInterval = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "ReconnectProbeInterval",
+    }),
+};
 const ComponentVariable& OcspRequestInterval = {
     ControllerComponents::InternalCtrlr,
     std::nullopt,
@@ -338,6 +366,62 @@ const ComponentVariable& MessageQueueSizeThreshold = {
         "MessageQueueSizeThreshold",
     }),
 };
+const ComponentVariable& MessageQueueMaxMessagesInFlight = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "MessageQueueMaxMessagesInFlight",
+    }),
+};
+const ComponentVariable& MessageQueueHighPriorityMessageTypes = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "MessageQueueHighPriorityMessageTypes",
+    }),
+};
+const ComponentVariable& MessageQueueLowPriorityMessageTypes = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "MessageQueueLowPriorityMessageTypes",
+    }),
+};
+const ComponentVariable& MessageQueueHighPriorityBeforeTransactionMessages = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "MessageQueueHighPriorityBeforeTransactionMessages",
+    }),
+};
+const ComponentVariable& MessageQueueWeightedFairScheduling = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "MessageQueueWeightedFairScheduling",
+    }),
+};
+const ComponentVariable& MessageQueueCoalescedMessageTypes = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "MessageQueueCoalescedMessageTypes",
+    }),
+};
+const ComponentVariable& MessageQueueDirectlyDeserializedMessageTypes = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "MessageQueueDirectlyDeserializedMessageTypes",
+    }),
+};
+const ComponentVariable& MessageSchemasPath = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "MessageSchemasPath",
+    }),
+};
 const ComponentVariable& MaxMessageSize = {
     ControllerComponents::InternalCtrlr,
     std::nullopt,
@@ -345,6 +429,13 @@ const ComponentVariable& MaxMessageSize = {
         "MaxMessageSize",
     }),
 };
+const ComponentVariable& MaxReceivedMessageSize = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "MaxReceivedMessageSize",
+    }),
+};
 const ComponentVariable& ResumeTransactionsOnBoot = {
     ControllerComponents::InternalCtrlr,
     std::nullopt,
@@ -1167,14 +1167,14 @@ void from_json(const json& j, ComponentKey& c) {
 }
 
 void from_json(const json& j, VariableMonitoringMeta& c) {
-    c.type = conversions::string_to_variable_monitor_type(j.at("config_type"));
+    c.type = conversions::string_to_variable_monitor_type(j.at("config_type").get_ref<const std::string&>());
 
     if (j.contains("reference_value")) {
         c.reference_value = j.at("reference_value");
     }
 
     c.monitor.severity = j.at("severity");
-    c.monitor.type = conversions::string_to_monitor_enum(j.at("type"));
+    c.monitor.type = conversions::string_to_monitor_enum(j.at("type").get_ref<const std::string&>());
     c.monitor.value = j.at("value");
 
     if (j.contains("transaction")) {
@@ -16,25 +16,85 @@ bool is_start_transaction_message(const ocpp::v201::MessageType message_type) {
     return false;
 }
 
+bool is_transaction_event_message(const ocpp::v201::MessageType message_type) {
+    return message_type == v201::MessageType::TransactionEvent;
+}
+
 bool is_boot_notification_message(const ocpp::v201::MessageType message_type) {
     return message_type == ocpp::v201::MessageType::BootNotification;
 }
 
 template <> bool ControlMessage<v201::MessageType>::is_transaction_update_message() const {
     if (this->messageType == v201::MessageType::TransactionEvent) {
-        return v201::TransactionEventRequest{this->message.at(CALL_PAYLOAD)}.eventType ==
+        return v201::TransactionEventRequest{this->json_message().at(CALL_PAYLOAD)}.eventType ==
                v201::TransactionEventEnum::Updated;
     }
     return false;
 }
 
+template <> std::optional<std::string> ControlMessage<v201::MessageType>::transaction_id() const {
+    if (this->messageType == v201::MessageType::TransactionEvent) {
+        const auto& payload = this->json_message().at(CALL_PAYLOAD);
+        if (payload.contains("transactionInfo")) {
+            return payload.at("transactionInfo").value("transactionId", "");
+        }
+    }
+    return std::nullopt;
+}
+
+template <> bool ControlMessage<v201::MessageType>::contains_signed_meter_values() const {
+    if (this->messageType != v201::MessageType::TransactionEvent) {
+        return false;
+    }
+    const auto& payload = this->json_message().at(CALL_PAYLOAD);
+    for (const auto& meter_value : payload.value("meterValue", json::array())) {
+        for (const auto& sampled_value : meter_value.value("sampledValue", json::array())) {
+            if (sampled_value.contains("signedMeterValue")) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template <> std::optional<std::string> ControlMessage<v201::MessageType>::coalescing_key() const {
+    const auto& payload = this->json_message().at(CALL_PAYLOAD);
+    switch (this->messageType) {
+    case v201::MessageType::StatusNotification:
+        return payload.at("evseId").dump() + "/" + payload.at("connectorId").dump();
+    case v201::MessageType::NotifyEvent: {
+        // a report that is split over multiple messages is never coalesced
+        if (payload.value("tbc", false)) {
+            return std::nullopt;
+        }
+        std::string key;
+        for (const auto& event_data : payload.at("eventData")) {
+            key += event_data.at("component").dump() + event_data.at("variable").dump();
+        }
+        return key;
+    }
+    case v201::MessageType::Heartbeat:
+        return "";
+    case v201::MessageType::LogStatusNotification:
+        // only the states of the same log upload supersede each other
+        if (payload.contains("requestId")) {
+            return payload.at("requestId").dump();
+        }
+        return std::nullopt;
+    default:
+        // the intermediate states of firmware sequences are never coalesced
+        return std::nullopt;
+    }
+}
+
 template <>
 ControlMessage<v201::MessageType>::ControlMessage(const json& message, const bool stall_until_accepted) :
-    message(message.get<json::array_t>()),
-    messageType(v201::conversions::string_to_messagetype(message.at(CALL_ACTION))),
+    messageType(v201::conversions::string_to_messagetype(message.at(CALL_ACTION).get_ref<const std::string&>())),
     message_attempts(0),
     initial_unique_id(message[MESSAGE_ID]),
-    stall_until_accepted(stall_until_accepted) {
+    stall_until_accepted(stall_until_accepted),
+    unique_id(message[MESSAGE_ID]),
+    message(message.get<json::array_t>()) {
 }
 
 template <> v201::MessageType MessageQueue<v201::MessageType>::string_to_messagetype(const std::string& s) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -58,6 +61,42 @@ void from_json(const json& j, AuthorizeRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a AuthorizeRequest
+const JsonSaxFields& json_sax_fields(const AuthorizeRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&AuthorizeRequest::idToken>("idToken"),
+        json_sax_field<&AuthorizeRequest::customData>("customData"),
+        json_sax_field<&AuthorizeRequest::certificate>("certificate"),
+        json_sax_field<&AuthorizeRequest::iso15118CertificateHashData>("iso15118CertificateHashData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given AuthorizeRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const AuthorizeRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.certificate) {
+        writer.key("certificate");
+        writer.value(k.certificate.value().view());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("idToken");
+    write_json(writer, k.idToken);
+    if (k.iso15118CertificateHashData) {
+        writer.key("iso15118CertificateHashData");
+        writer.begin_array();
+        for (const auto& val : k.iso15118CertificateHashData.value()) {
+            write_json(writer, val);
+        }
+        writer.end_array();
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given AuthorizeRequest \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizeRequest written to
 std::ostream& operator<<(std::ostream& os, const AuthorizeRequest& k) {
@@ -93,8 +132,37 @@ void from_json(const json& j, AuthorizeResponse& k) {
     }
     if (j.contains("certificateStatus")) {
         k.certificateStatus.emplace(
-            conversions::string_to_authorize_certificate_status_enum(j.at("certificateStatus")));
+            conversions::string_to_authorize_certificate_status_enum(
+                j.at("certificateStatus").get_ref<const std::string&>()));
+    }
+}
+
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a AuthorizeResponse
+const JsonSaxFields& json_sax_fields(const AuthorizeResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&AuthorizeResponse::idTokenInfo>("idTokenInfo"),
+        json_sax_field<&AuthorizeResponse::customData>("customData"),
+        json_sax_field<&AuthorizeResponse::certificateStatus,
+                       conversions::string_to_authorize_certificate_status_enum>("certificateStatus"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given AuthorizeResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const AuthorizeResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.certificateStatus) {
+        writer.key("certificateStatus");
+        writer.value(conversions::authorize_certificate_status_enum_to_string(k.certificateStatus.value()));
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
     }
+    writer.key("idTokenInfo");
+    write_json(writer, k.idTokenInfo);
+    writer.end_object();
 }
 
 /// \brief Writes the string representation of the given AuthorizeResponse \p k to the given output stream \p os
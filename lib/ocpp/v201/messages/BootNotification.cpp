@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -32,7 +35,7 @@ void to_json(json& j, const BootNotificationRequest& k) {
 void from_json(const json& j, BootNotificationRequest& k) {
     // the required parts of the message
     k.chargingStation = j.at("chargingStation");
-    k.reason = conversions::string_to_boot_reason_enum(j.at("reason"));
+    k.reason = conversions::string_to_boot_reason_enum(j.at("reason").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -40,6 +43,31 @@ void from_json(const json& j, BootNotificationRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a BootNotificationRequest
+const JsonSaxFields& json_sax_fields(const BootNotificationRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&BootNotificationRequest::chargingStation>("chargingStation"),
+        json_sax_field<&BootNotificationRequest::reason, conversions::string_to_boot_reason_enum>("reason"),
+        json_sax_field<&BootNotificationRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given BootNotificationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const BootNotificationRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("chargingStation");
+    write_json(writer, k.chargingStation);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("reason");
+    writer.value(conversions::boot_reason_enum_to_string(k.reason));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given BootNotificationRequest \p k to the given output stream \p os
 /// \returns an output stream with the BootNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const BootNotificationRequest& k) {
@@ -71,7 +99,7 @@ void from_json(const json& j, BootNotificationResponse& k) {
     // the required parts of the message
     k.currentTime = ocpp::DateTime(std::string(j.at("currentTime")));
     k.interval = j.at("interval");
-    k.status = conversions::string_to_registration_status_enum(j.at("status"));
+    k.status = conversions::string_to_registration_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -82,6 +110,39 @@ void from_json(const json& j, BootNotificationResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a BootNotificationResponse
+const JsonSaxFields& json_sax_fields(const BootNotificationResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&BootNotificationResponse::currentTime>("currentTime"),
+        json_sax_field<&BootNotificationResponse::interval>("interval"),
+        json_sax_field<&BootNotificationResponse::status, conversions::string_to_registration_status_enum>("status"),
+        json_sax_field<&BootNotificationResponse::customData>("customData"),
+        json_sax_field<&BootNotificationResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given BootNotificationResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const BootNotificationResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("currentTime");
+    writer.value(k.currentTime);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("interval");
+    writer.value(k.interval);
+    writer.key("status");
+    writer.value(conversions::registration_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given BootNotificationResponse \p k to the given output stream \p os
 /// \returns an output stream with the BootNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const BootNotificationResponse& k) {
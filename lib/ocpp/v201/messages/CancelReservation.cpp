@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -38,6 +41,28 @@ void from_json(const json& j, CancelReservationRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CancelReservationRequest
+const JsonSaxFields& json_sax_fields(const CancelReservationRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&CancelReservationRequest::reservationId>("reservationId"),
+        json_sax_field<&CancelReservationRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given CancelReservationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CancelReservationRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("reservationId");
+    writer.value(k.reservationId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CancelReservationRequest \p k to the given output stream \p os
 /// \returns an output stream with the CancelReservationRequest written to
 std::ostream& operator<<(std::ostream& os, const CancelReservationRequest& k) {
@@ -65,7 +90,7 @@ void to_json(json& j, const CancelReservationResponse& k) {
 
 void from_json(const json& j, CancelReservationResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_cancel_reservation_status_enum(j.at("status"));
+    k.status = conversions::string_to_cancel_reservation_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -76,6 +101,34 @@ void from_json(const json& j, CancelReservationResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CancelReservationResponse
+const JsonSaxFields& json_sax_fields(const CancelReservationResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&CancelReservationResponse::status,
+                       conversions::string_to_cancel_reservation_status_enum>("status"),
+        json_sax_field<&CancelReservationResponse::customData>("customData"),
+        json_sax_field<&CancelReservationResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given CancelReservationResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CancelReservationResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::cancel_reservation_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CancelReservationResponse \p k to the given output stream \p os
 /// \returns an output stream with the CancelReservationResponse written to
 std::ostream& operator<<(std::ostream& os, const CancelReservationResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -33,7 +36,8 @@ void to_json(json& j, const ChangeAvailabilityRequest& k) {
 
 void from_json(const json& j, ChangeAvailabilityRequest& k) {
     // the required parts of the message
-    k.operationalStatus = conversions::string_to_operational_status_enum(j.at("operationalStatus"));
+    k.operationalStatus =
+        conversions::string_to_operational_status_enum(j.at("operationalStatus").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -44,6 +48,34 @@ void from_json(const json& j, ChangeAvailabilityRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChangeAvailabilityRequest
+const JsonSaxFields& json_sax_fields(const ChangeAvailabilityRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ChangeAvailabilityRequest::operationalStatus,
+                       conversions::string_to_operational_status_enum>("operationalStatus"),
+        json_sax_field<&ChangeAvailabilityRequest::customData>("customData"),
+        json_sax_field<&ChangeAvailabilityRequest::evse>("evse"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ChangeAvailabilityRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChangeAvailabilityRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.evse) {
+        writer.key("evse");
+        write_json(writer, k.evse.value());
+    }
+    writer.key("operationalStatus");
+    writer.value(conversions::operational_status_enum_to_string(k.operationalStatus));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ChangeAvailabilityRequest \p k to the given output stream \p os
 /// \returns an output stream with the ChangeAvailabilityRequest written to
 std::ostream& operator<<(std::ostream& os, const ChangeAvailabilityRequest& k) {
@@ -71,7 +103,7 @@ void to_json(json& j, const ChangeAvailabilityResponse& k) {
 
 void from_json(const json& j, ChangeAvailabilityResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_change_availability_status_enum(j.at("status"));
+    k.status = conversions::string_to_change_availability_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -82,6 +114,34 @@ void from_json(const json& j, ChangeAvailabilityResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChangeAvailabilityResponse
+const JsonSaxFields& json_sax_fields(const ChangeAvailabilityResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ChangeAvailabilityResponse::status,
+                       conversions::string_to_change_availability_status_enum>("status"),
+        json_sax_field<&ChangeAvailabilityResponse::customData>("customData"),
+        json_sax_field<&ChangeAvailabilityResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ChangeAvailabilityResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChangeAvailabilityResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::change_availability_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ChangeAvailabilityResponse \p k to the given output stream \p
 /// os \returns an output stream with the ChangeAvailabilityResponse written to
 std::ostream& operator<<(std::ostream& os, const ChangeAvailabilityResponse& k) {
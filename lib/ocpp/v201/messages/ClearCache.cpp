@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -35,6 +38,25 @@ void from_json(const json& j, ClearCacheRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearCacheRequest
+const JsonSaxFields& json_sax_fields(const ClearCacheRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ClearCacheRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ClearCacheRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearCacheRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearCacheRequest \p k to the given output stream \p os
 /// \returns an output stream with the ClearCacheRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearCacheRequest& k) {
@@ -62,7 +84,7 @@ void to_json(json& j, const ClearCacheResponse& k) {
 
 void from_json(const json& j, ClearCacheResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_clear_cache_status_enum(j.at("status"));
+    k.status = conversions::string_to_clear_cache_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -73,6 +95,33 @@ void from_json(const json& j, ClearCacheResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearCacheResponse
+const JsonSaxFields& json_sax_fields(const ClearCacheResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ClearCacheResponse::status, conversions::string_to_clear_cache_status_enum>("status"),
+        json_sax_field<&ClearCacheResponse::customData>("customData"),
+        json_sax_field<&ClearCacheResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ClearCacheResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearCacheResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::clear_cache_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearCacheResponse \p k to the given output stream \p os
 /// \returns an output stream with the ClearCacheResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearCacheResponse& k) {
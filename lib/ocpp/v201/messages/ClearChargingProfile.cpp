@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -47,6 +50,35 @@ void from_json(const json& j, ClearChargingProfileRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearChargingProfileRequest
+const JsonSaxFields& json_sax_fields(const ClearChargingProfileRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ClearChargingProfileRequest::customData>("customData"),
+        json_sax_field<&ClearChargingProfileRequest::chargingProfileId>("chargingProfileId"),
+        json_sax_field<&ClearChargingProfileRequest::chargingProfileCriteria>("chargingProfileCriteria"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ClearChargingProfileRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearChargingProfileRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.chargingProfileCriteria) {
+        writer.key("chargingProfileCriteria");
+        write_json(writer, k.chargingProfileCriteria.value());
+    }
+    if (k.chargingProfileId) {
+        writer.key("chargingProfileId");
+        writer.value(k.chargingProfileId.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearChargingProfileRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearChargingProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfileRequest& k) {
@@ -74,7 +106,7 @@ void to_json(json& j, const ClearChargingProfileResponse& k) {
 
 void from_json(const json& j, ClearChargingProfileResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_clear_charging_profile_status_enum(j.at("status"));
+    k.status = conversions::string_to_clear_charging_profile_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -85,6 +117,34 @@ void from_json(const json& j, ClearChargingProfileResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearChargingProfileResponse
+const JsonSaxFields& json_sax_fields(const ClearChargingProfileResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ClearChargingProfileResponse::status,
+                       conversions::string_to_clear_charging_profile_status_enum>("status"),
+        json_sax_field<&ClearChargingProfileResponse::customData>("customData"),
+        json_sax_field<&ClearChargingProfileResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ClearChargingProfileResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearChargingProfileResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::clear_charging_profile_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearChargingProfileResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearChargingProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfileResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -38,6 +41,28 @@ void from_json(const json& j, ClearDisplayMessageRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearDisplayMessageRequest
+const JsonSaxFields& json_sax_fields(const ClearDisplayMessageRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ClearDisplayMessageRequest::id>("id"),
+        json_sax_field<&ClearDisplayMessageRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ClearDisplayMessageRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearDisplayMessageRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("id");
+    writer.value(k.id);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearDisplayMessageRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearDisplayMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearDisplayMessageRequest& k) {
@@ -65,7 +90,7 @@ void to_json(json& j, const ClearDisplayMessageResponse& k) {
 
 void from_json(const json& j, ClearDisplayMessageResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_clear_message_status_enum(j.at("status"));
+    k.status = conversions::string_to_clear_message_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -76,6 +101,34 @@ void from_json(const json& j, ClearDisplayMessageResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearDisplayMessageResponse
+const JsonSaxFields& json_sax_fields(const ClearDisplayMessageResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ClearDisplayMessageResponse::status,
+                       conversions::string_to_clear_message_status_enum>("status"),
+        json_sax_field<&ClearDisplayMessageResponse::customData>("customData"),
+        json_sax_field<&ClearDisplayMessageResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ClearDisplayMessageResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearDisplayMessageResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::clear_message_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearDisplayMessageResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearDisplayMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearDisplayMessageResponse& k) {
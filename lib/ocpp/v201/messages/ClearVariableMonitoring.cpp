@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -40,6 +43,32 @@ void from_json(const json& j, ClearVariableMonitoringRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearVariableMonitoringRequest
+const JsonSaxFields& json_sax_fields(const ClearVariableMonitoringRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ClearVariableMonitoringRequest::id>("id"),
+        json_sax_field<&ClearVariableMonitoringRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ClearVariableMonitoringRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearVariableMonitoringRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("id");
+    writer.begin_array();
+    for (const auto& val : k.id) {
+        writer.value(val);
+    }
+    writer.end_array();
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearVariableMonitoringRequest \p k to the given output stream
 /// \p os \returns an output stream with the ClearVariableMonitoringRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearVariableMonitoringRequest& k) {
@@ -74,6 +103,32 @@ void from_json(const json& j, ClearVariableMonitoringResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearVariableMonitoringResponse
+const JsonSaxFields& json_sax_fields(const ClearVariableMonitoringResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ClearVariableMonitoringResponse::clearMonitoringResult>("clearMonitoringResult"),
+        json_sax_field<&ClearVariableMonitoringResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ClearVariableMonitoringResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearVariableMonitoringResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("clearMonitoringResult");
+    writer.begin_array();
+    for (const auto& val : k.clearMonitoringResult) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearVariableMonitoringResponse \p k to the given output stream
 /// \p os \returns an output stream with the ClearVariableMonitoringResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearVariableMonitoringResponse& k) {
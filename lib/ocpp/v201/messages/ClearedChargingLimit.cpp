@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -33,7 +36,8 @@ void to_json(json& j, const ClearedChargingLimitRequest& k) {
 
 void from_json(const json& j, ClearedChargingLimitRequest& k) {
     // the required parts of the message
-    k.chargingLimitSource = conversions::string_to_charging_limit_source_enum(j.at("chargingLimitSource"));
+    k.chargingLimitSource =
+        conversions::string_to_charging_limit_source_enum(j.at("chargingLimitSource").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -44,6 +48,34 @@ void from_json(const json& j, ClearedChargingLimitRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearedChargingLimitRequest
+const JsonSaxFields& json_sax_fields(const ClearedChargingLimitRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ClearedChargingLimitRequest::chargingLimitSource,
+                       conversions::string_to_charging_limit_source_enum>("chargingLimitSource"),
+        json_sax_field<&ClearedChargingLimitRequest::customData>("customData"),
+        json_sax_field<&ClearedChargingLimitRequest::evseId>("evseId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ClearedChargingLimitRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearedChargingLimitRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("chargingLimitSource");
+    writer.value(conversions::charging_limit_source_enum_to_string(k.chargingLimitSource));
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.evseId) {
+        writer.key("evseId");
+        writer.value(k.evseId.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearedChargingLimitRequest \p k to the given output stream \p
 /// os \returns an output stream with the ClearedChargingLimitRequest written to
 std::ostream& operator<<(std::ostream& os, const ClearedChargingLimitRequest& k) {
@@ -73,6 +105,25 @@ void from_json(const json& j, ClearedChargingLimitResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearedChargingLimitResponse
+const JsonSaxFields& json_sax_fields(const ClearedChargingLimitResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ClearedChargingLimitResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ClearedChargingLimitResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearedChargingLimitResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ClearedChargingLimitResponse \p k to the given output stream \p
 /// os \returns an output stream with the ClearedChargingLimitResponse written to
 std::ostream& operator<<(std::ostream& os, const ClearedChargingLimitResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -40,6 +43,31 @@ void from_json(const json& j, CostUpdatedRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CostUpdatedRequest
+const JsonSaxFields& json_sax_fields(const CostUpdatedRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&CostUpdatedRequest::totalCost>("totalCost"),
+        json_sax_field<&CostUpdatedRequest::transactionId>("transactionId"),
+        json_sax_field<&CostUpdatedRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given CostUpdatedRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CostUpdatedRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("totalCost");
+    writer.value(k.totalCost);
+    writer.key("transactionId");
+    writer.value(k.transactionId.view());
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CostUpdatedRequest \p k to the given output stream \p os
 /// \returns an output stream with the CostUpdatedRequest written to
 std::ostream& operator<<(std::ostream& os, const CostUpdatedRequest& k) {
@@ -69,6 +97,25 @@ void from_json(const json& j, CostUpdatedResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CostUpdatedResponse
+const JsonSaxFields& json_sax_fields(const CostUpdatedResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&CostUpdatedResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given CostUpdatedResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CostUpdatedResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CostUpdatedResponse \p k to the given output stream \p os
 /// \returns an output stream with the CostUpdatedResponse written to
 std::ostream& operator<<(std::ostream& os, const CostUpdatedResponse& k) {
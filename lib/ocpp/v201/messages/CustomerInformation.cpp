@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -60,6 +63,49 @@ void from_json(const json& j, CustomerInformationRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CustomerInformationRequest
+const JsonSaxFields& json_sax_fields(const CustomerInformationRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&CustomerInformationRequest::requestId>("requestId"),
+        json_sax_field<&CustomerInformationRequest::report>("report"),
+        json_sax_field<&CustomerInformationRequest::clear>("clear"),
+        json_sax_field<&CustomerInformationRequest::customData>("customData"),
+        json_sax_field<&CustomerInformationRequest::customerCertificate>("customerCertificate"),
+        json_sax_field<&CustomerInformationRequest::idToken>("idToken"),
+        json_sax_field<&CustomerInformationRequest::customerIdentifier>("customerIdentifier"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given CustomerInformationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CustomerInformationRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("clear");
+    writer.value(k.clear);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.customerCertificate) {
+        writer.key("customerCertificate");
+        write_json(writer, k.customerCertificate.value());
+    }
+    if (k.customerIdentifier) {
+        writer.key("customerIdentifier");
+        writer.value(k.customerIdentifier.value().view());
+    }
+    if (k.idToken) {
+        writer.key("idToken");
+        write_json(writer, k.idToken.value());
+    }
+    writer.key("report");
+    writer.value(k.report);
+    writer.key("requestId");
+    writer.value(k.requestId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CustomerInformationRequest \p k to the given output stream \p
 /// os \returns an output stream with the CustomerInformationRequest written to
 std::ostream& operator<<(std::ostream& os, const CustomerInformationRequest& k) {
@@ -87,7 +133,7 @@ void to_json(json& j, const CustomerInformationResponse& k) {
 
 void from_json(const json& j, CustomerInformationResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_customer_information_status_enum(j.at("status"));
+    k.status = conversions::string_to_customer_information_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -98,6 +144,34 @@ void from_json(const json& j, CustomerInformationResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CustomerInformationResponse
+const JsonSaxFields& json_sax_fields(const CustomerInformationResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&CustomerInformationResponse::status,
+                       conversions::string_to_customer_information_status_enum>("status"),
+        json_sax_field<&CustomerInformationResponse::customData>("customData"),
+        json_sax_field<&CustomerInformationResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given CustomerInformationResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CustomerInformationResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::customer_information_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given CustomerInformationResponse \p k to the given output stream \p
 /// os \returns an output stream with the CustomerInformationResponse written to
 std::ostream& operator<<(std::ostream& os, const CustomerInformationResponse& k) {
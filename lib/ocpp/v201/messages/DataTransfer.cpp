@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -50,6 +53,38 @@ void from_json(const json& j, DataTransferRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a DataTransferRequest
+const JsonSaxFields& json_sax_fields(const DataTransferRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&DataTransferRequest::vendorId>("vendorId"),
+        json_sax_field<&DataTransferRequest::customData>("customData"),
+        json_sax_field<&DataTransferRequest::messageId>("messageId"),
+        json_sax_field<&DataTransferRequest::data>("data"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given DataTransferRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const DataTransferRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.data) {
+        writer.key("data");
+        writer.value(k.data.value());
+    }
+    if (k.messageId) {
+        writer.key("messageId");
+        writer.value(k.messageId.value().view());
+    }
+    writer.key("vendorId");
+    writer.value(k.vendorId.view());
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given DataTransferRequest \p k to the given output stream \p os
 /// \returns an output stream with the DataTransferRequest written to
 std::ostream& operator<<(std::ostream& os, const DataTransferRequest& k) {
@@ -80,7 +115,7 @@ void to_json(json& j, const DataTransferResponse& k) {
 
 void from_json(const json& j, DataTransferResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_data_transfer_status_enum(j.at("status"));
+    k.status = conversions::string_to_data_transfer_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -94,6 +129,38 @@ void from_json(const json& j, DataTransferResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a DataTransferResponse
+const JsonSaxFields& json_sax_fields(const DataTransferResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&DataTransferResponse::status, conversions::string_to_data_transfer_status_enum>("status"),
+        json_sax_field<&DataTransferResponse::customData>("customData"),
+        json_sax_field<&DataTransferResponse::statusInfo>("statusInfo"),
+        json_sax_field<&DataTransferResponse::data>("data"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given DataTransferResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const DataTransferResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.data) {
+        writer.key("data");
+        writer.value(k.data.value());
+    }
+    writer.key("status");
+    writer.value(conversions::data_transfer_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given DataTransferResponse \p k to the given output stream \p os
 /// \returns an output stream with the DataTransferResponse written to
 std::ostream& operator<<(std::ostream& os, const DataTransferResponse& k) {
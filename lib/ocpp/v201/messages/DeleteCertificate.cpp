@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -38,6 +41,28 @@ void from_json(const json& j, DeleteCertificateRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a DeleteCertificateRequest
+const JsonSaxFields& json_sax_fields(const DeleteCertificateRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&DeleteCertificateRequest::certificateHashData>("certificateHashData"),
+        json_sax_field<&DeleteCertificateRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given DeleteCertificateRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const DeleteCertificateRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("certificateHashData");
+    write_json(writer, k.certificateHashData);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given DeleteCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the DeleteCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const DeleteCertificateRequest& k) {
@@ -65,7 +90,7 @@ void to_json(json& j, const DeleteCertificateResponse& k) {
 
 void from_json(const json& j, DeleteCertificateResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_delete_certificate_status_enum(j.at("status"));
+    k.status = conversions::string_to_delete_certificate_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -76,6 +101,34 @@ void from_json(const json& j, DeleteCertificateResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a DeleteCertificateResponse
+const JsonSaxFields& json_sax_fields(const DeleteCertificateResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&DeleteCertificateResponse::status,
+                       conversions::string_to_delete_certificate_status_enum>("status"),
+        json_sax_field<&DeleteCertificateResponse::customData>("customData"),
+        json_sax_field<&DeleteCertificateResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given DeleteCertificateResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const DeleteCertificateResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::delete_certificate_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given DeleteCertificateResponse \p k to the given output stream \p os
 /// \returns an output stream with the DeleteCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const DeleteCertificateResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -33,7 +36,7 @@ void to_json(json& j, const FirmwareStatusNotificationRequest& k) {
 
 void from_json(const json& j, FirmwareStatusNotificationRequest& k) {
     // the required parts of the message
-    k.status = conversions::string_to_firmware_status_enum(j.at("status"));
+    k.status = conversions::string_to_firmware_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -44,6 +47,35 @@ void from_json(const json& j, FirmwareStatusNotificationRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a FirmwareStatusNotificationRequest
+const JsonSaxFields& json_sax_fields(const FirmwareStatusNotificationRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&FirmwareStatusNotificationRequest::status,
+                       conversions::string_to_firmware_status_enum>("status"),
+        json_sax_field<&FirmwareStatusNotificationRequest::customData>("customData"),
+        json_sax_field<&FirmwareStatusNotificationRequest::requestId>("requestId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given FirmwareStatusNotificationRequest \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.requestId) {
+        writer.key("requestId");
+        writer.value(k.requestId.value());
+    }
+    writer.key("status");
+    writer.value(conversions::firmware_status_enum_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given FirmwareStatusNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the FirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const FirmwareStatusNotificationRequest& k) {
@@ -73,6 +105,26 @@ void from_json(const json& j, FirmwareStatusNotificationResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a FirmwareStatusNotificationResponse
+const JsonSaxFields& json_sax_fields(const FirmwareStatusNotificationResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&FirmwareStatusNotificationResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given FirmwareStatusNotificationResponse \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given FirmwareStatusNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the FirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const FirmwareStatusNotificationResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -33,7 +36,7 @@ void to_json(json& j, const Get15118EVCertificateRequest& k) {
 void from_json(const json& j, Get15118EVCertificateRequest& k) {
     // the required parts of the message
     k.iso15118SchemaVersion = j.at("iso15118SchemaVersion");
-    k.action = conversions::string_to_certificate_action_enum(j.at("action"));
+    k.action = conversions::string_to_certificate_action_enum(j.at("action").get_ref<const std::string&>());
     k.exiRequest = j.at("exiRequest");
 
     // the optional parts of the message
@@ -42,6 +45,34 @@ void from_json(const json& j, Get15118EVCertificateRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a Get15118EVCertificateRequest
+const JsonSaxFields& json_sax_fields(const Get15118EVCertificateRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&Get15118EVCertificateRequest::iso15118SchemaVersion>("iso15118SchemaVersion"),
+        json_sax_field<&Get15118EVCertificateRequest::action, conversions::string_to_certificate_action_enum>("action"),
+        json_sax_field<&Get15118EVCertificateRequest::exiRequest>("exiRequest"),
+        json_sax_field<&Get15118EVCertificateRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given Get15118EVCertificateRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const Get15118EVCertificateRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("action");
+    writer.value(conversions::certificate_action_enum_to_string(k.action));
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("exiRequest");
+    writer.value(k.exiRequest.view());
+    writer.key("iso15118SchemaVersion");
+    writer.value(k.iso15118SchemaVersion.view());
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given Get15118EVCertificateRequest \p k to the given output stream \p
 /// os \returns an output stream with the Get15118EVCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const Get15118EVCertificateRequest& k) {
@@ -70,7 +101,7 @@ void to_json(json& j, const Get15118EVCertificateResponse& k) {
 
 void from_json(const json& j, Get15118EVCertificateResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_iso15118evcertificate_status_enum(j.at("status"));
+    k.status = conversions::string_to_iso15118evcertificate_status_enum(j.at("status").get_ref<const std::string&>());
     k.exiResponse = j.at("exiResponse");
 
     // the optional parts of the message
@@ -82,6 +113,37 @@ void from_json(const json& j, Get15118EVCertificateResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a Get15118EVCertificateResponse
+const JsonSaxFields& json_sax_fields(const Get15118EVCertificateResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&Get15118EVCertificateResponse::status,
+                       conversions::string_to_iso15118evcertificate_status_enum>("status"),
+        json_sax_field<&Get15118EVCertificateResponse::exiResponse>("exiResponse"),
+        json_sax_field<&Get15118EVCertificateResponse::customData>("customData"),
+        json_sax_field<&Get15118EVCertificateResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given Get15118EVCertificateResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const Get15118EVCertificateResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("exiResponse");
+    writer.value(k.exiResponse.view());
+    writer.key("status");
+    writer.value(conversions::iso15118evcertificate_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given Get15118EVCertificateResponse \p k to the given output stream
 /// \p os \returns an output stream with the Get15118EVCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const Get15118EVCertificateResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -32,7 +35,7 @@ void to_json(json& j, const GetBaseReportRequest& k) {
 void from_json(const json& j, GetBaseReportRequest& k) {
     // the required parts of the message
     k.requestId = j.at("requestId");
-    k.reportBase = conversions::string_to_report_base_enum(j.at("reportBase"));
+    k.reportBase = conversions::string_to_report_base_enum(j.at("reportBase").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -40,6 +43,31 @@ void from_json(const json& j, GetBaseReportRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetBaseReportRequest
+const JsonSaxFields& json_sax_fields(const GetBaseReportRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetBaseReportRequest::requestId>("requestId"),
+        json_sax_field<&GetBaseReportRequest::reportBase, conversions::string_to_report_base_enum>("reportBase"),
+        json_sax_field<&GetBaseReportRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetBaseReportRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetBaseReportRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("reportBase");
+    writer.value(conversions::report_base_enum_to_string(k.reportBase));
+    writer.key("requestId");
+    writer.value(k.requestId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetBaseReportRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetBaseReportRequest written to
 std::ostream& operator<<(std::ostream& os, const GetBaseReportRequest& k) {
@@ -67,7 +95,7 @@ void to_json(json& j, const GetBaseReportResponse& k) {
 
 void from_json(const json& j, GetBaseReportResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_device_model_status_enum(j.at("status"));
+    k.status = conversions::string_to_generic_device_model_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -78,6 +106,34 @@ void from_json(const json& j, GetBaseReportResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetBaseReportResponse
+const JsonSaxFields& json_sax_fields(const GetBaseReportResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetBaseReportResponse::status,
+                       conversions::string_to_generic_device_model_status_enum>("status"),
+        json_sax_field<&GetBaseReportResponse::customData>("customData"),
+        json_sax_field<&GetBaseReportResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetBaseReportResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetBaseReportResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::generic_device_model_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetBaseReportResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetBaseReportResponse written to
 std::ostream& operator<<(std::ostream& os, const GetBaseReportResponse& k) {
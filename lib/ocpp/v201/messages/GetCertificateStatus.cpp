@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -38,6 +41,28 @@ void from_json(const json& j, GetCertificateStatusRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetCertificateStatusRequest
+const JsonSaxFields& json_sax_fields(const GetCertificateStatusRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetCertificateStatusRequest::ocspRequestData>("ocspRequestData"),
+        json_sax_field<&GetCertificateStatusRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetCertificateStatusRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetCertificateStatusRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("ocspRequestData");
+    write_json(writer, k.ocspRequestData);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetCertificateStatusRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetCertificateStatusRequest written to
 std::ostream& operator<<(std::ostream& os, const GetCertificateStatusRequest& k) {
@@ -68,7 +93,7 @@ void to_json(json& j, const GetCertificateStatusResponse& k) {
 
 void from_json(const json& j, GetCertificateStatusResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_get_certificate_status_enum(j.at("status"));
+    k.status = conversions::string_to_get_certificate_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -82,6 +107,39 @@ void from_json(const json& j, GetCertificateStatusResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetCertificateStatusResponse
+const JsonSaxFields& json_sax_fields(const GetCertificateStatusResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetCertificateStatusResponse::status,
+                       conversions::string_to_get_certificate_status_enum>("status"),
+        json_sax_field<&GetCertificateStatusResponse::customData>("customData"),
+        json_sax_field<&GetCertificateStatusResponse::statusInfo>("statusInfo"),
+        json_sax_field<&GetCertificateStatusResponse::ocspResult>("ocspResult"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetCertificateStatusResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetCertificateStatusResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.ocspResult) {
+        writer.key("ocspResult");
+        writer.value(k.ocspResult.value().view());
+    }
+    writer.key("status");
+    writer.value(conversions::get_certificate_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetCertificateStatusResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetCertificateStatusResponse written to
 std::ostream& operator<<(std::ostream& os, const GetCertificateStatusResponse& k) {
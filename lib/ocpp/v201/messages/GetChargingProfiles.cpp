@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -46,6 +49,36 @@ void from_json(const json& j, GetChargingProfilesRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetChargingProfilesRequest
+const JsonSaxFields& json_sax_fields(const GetChargingProfilesRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetChargingProfilesRequest::requestId>("requestId"),
+        json_sax_field<&GetChargingProfilesRequest::chargingProfile>("chargingProfile"),
+        json_sax_field<&GetChargingProfilesRequest::customData>("customData"),
+        json_sax_field<&GetChargingProfilesRequest::evseId>("evseId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetChargingProfilesRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetChargingProfilesRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("chargingProfile");
+    write_json(writer, k.chargingProfile);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.evseId) {
+        writer.key("evseId");
+        writer.value(k.evseId.value());
+    }
+    writer.key("requestId");
+    writer.value(k.requestId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetChargingProfilesRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetChargingProfilesRequest written to
 std::ostream& operator<<(std::ostream& os, const GetChargingProfilesRequest& k) {
@@ -73,7 +106,7 @@ void to_json(json& j, const GetChargingProfilesResponse& k) {
 
 void from_json(const json& j, GetChargingProfilesResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_get_charging_profile_status_enum(j.at("status"));
+    k.status = conversions::string_to_get_charging_profile_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -84,6 +117,34 @@ void from_json(const json& j, GetChargingProfilesResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetChargingProfilesResponse
+const JsonSaxFields& json_sax_fields(const GetChargingProfilesResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetChargingProfilesResponse::status,
+                       conversions::string_to_get_charging_profile_status_enum>("status"),
+        json_sax_field<&GetChargingProfilesResponse::customData>("customData"),
+        json_sax_field<&GetChargingProfilesResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetChargingProfilesResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetChargingProfilesResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::get_charging_profile_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetChargingProfilesResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetChargingProfilesResponse written to
 std::ostream& operator<<(std::ostream& os, const GetChargingProfilesResponse& k) {
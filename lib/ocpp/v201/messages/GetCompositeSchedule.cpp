@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -42,10 +45,42 @@ void from_json(const json& j, GetCompositeScheduleRequest& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("chargingRateUnit")) {
-        k.chargingRateUnit.emplace(conversions::string_to_charging_rate_unit_enum(j.at("chargingRateUnit")));
+        k.chargingRateUnit.emplace(
+            conversions::string_to_charging_rate_unit_enum(j.at("chargingRateUnit").get_ref<const std::string&>()));
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetCompositeScheduleRequest
+const JsonSaxFields& json_sax_fields(const GetCompositeScheduleRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetCompositeScheduleRequest::duration>("duration"),
+        json_sax_field<&GetCompositeScheduleRequest::evseId>("evseId"),
+        json_sax_field<&GetCompositeScheduleRequest::customData>("customData"),
+        json_sax_field<&GetCompositeScheduleRequest::chargingRateUnit,
+                       conversions::string_to_charging_rate_unit_enum>("chargingRateUnit"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetCompositeScheduleRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetCompositeScheduleRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.chargingRateUnit) {
+        writer.key("chargingRateUnit");
+        writer.value(conversions::charging_rate_unit_enum_to_string(k.chargingRateUnit.value()));
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("duration");
+    writer.value(k.duration);
+    writer.key("evseId");
+    writer.value(k.evseId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetCompositeScheduleRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetCompositeScheduleRequest written to
 std::ostream& operator<<(std::ostream& os, const GetCompositeScheduleRequest& k) {
@@ -76,7 +111,7 @@ void to_json(json& j, const GetCompositeScheduleResponse& k) {
 
 void from_json(const json& j, GetCompositeScheduleResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_status_enum(j.at("status"));
+    k.status = conversions::string_to_generic_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -90,6 +125,38 @@ void from_json(const json& j, GetCompositeScheduleResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetCompositeScheduleResponse
+const JsonSaxFields& json_sax_fields(const GetCompositeScheduleResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetCompositeScheduleResponse::status, conversions::string_to_generic_status_enum>("status"),
+        json_sax_field<&GetCompositeScheduleResponse::customData>("customData"),
+        json_sax_field<&GetCompositeScheduleResponse::statusInfo>("statusInfo"),
+        json_sax_field<&GetCompositeScheduleResponse::schedule>("schedule"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetCompositeScheduleResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetCompositeScheduleResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.schedule) {
+        writer.key("schedule");
+        write_json(writer, k.schedule.value());
+    }
+    writer.key("status");
+    writer.value(conversions::generic_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetCompositeScheduleResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetCompositeScheduleResponse written to
 std::ostream& operator<<(std::ostream& os, const GetCompositeScheduleResponse& k) {
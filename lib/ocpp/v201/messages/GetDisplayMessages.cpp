@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -57,11 +60,53 @@ void from_json(const json& j, GetDisplayMessagesRequest& k) {
         k.id.emplace(vec);
     }
     if (j.contains("priority")) {
-        k.priority.emplace(conversions::string_to_message_priority_enum(j.at("priority")));
+        k.priority.emplace(
+            conversions::string_to_message_priority_enum(j.at("priority").get_ref<const std::string&>()));
     }
     if (j.contains("state")) {
-        k.state.emplace(conversions::string_to_message_state_enum(j.at("state")));
+        k.state.emplace(conversions::string_to_message_state_enum(j.at("state").get_ref<const std::string&>()));
+    }
+}
+
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetDisplayMessagesRequest
+const JsonSaxFields& json_sax_fields(const GetDisplayMessagesRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetDisplayMessagesRequest::requestId>("requestId"),
+        json_sax_field<&GetDisplayMessagesRequest::customData>("customData"),
+        json_sax_field<&GetDisplayMessagesRequest::id>("id"),
+        json_sax_field<&GetDisplayMessagesRequest::priority, conversions::string_to_message_priority_enum>("priority"),
+        json_sax_field<&GetDisplayMessagesRequest::state, conversions::string_to_message_state_enum>("state"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetDisplayMessagesRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetDisplayMessagesRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.id) {
+        writer.key("id");
+        writer.begin_array();
+        for (const auto& val : k.id.value()) {
+            writer.value(val);
+        }
+        writer.end_array();
+    }
+    if (k.priority) {
+        writer.key("priority");
+        writer.value(conversions::message_priority_enum_to_string(k.priority.value()));
+    }
+    writer.key("requestId");
+    writer.value(k.requestId);
+    if (k.state) {
+        writer.key("state");
+        writer.value(conversions::message_state_enum_to_string(k.state.value()));
     }
+    writer.end_object();
 }
 
 /// \brief Writes the string representation of the given GetDisplayMessagesRequest \p k to the given output stream \p os
@@ -91,7 +136,7 @@ void to_json(json& j, const GetDisplayMessagesResponse& k) {
 
 void from_json(const json& j, GetDisplayMessagesResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_get_display_messages_status_enum(j.at("status"));
+    k.status = conversions::string_to_get_display_messages_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -102,6 +147,34 @@ void from_json(const json& j, GetDisplayMessagesResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetDisplayMessagesResponse
+const JsonSaxFields& json_sax_fields(const GetDisplayMessagesResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetDisplayMessagesResponse::status,
+                       conversions::string_to_get_display_messages_status_enum>("status"),
+        json_sax_field<&GetDisplayMessagesResponse::customData>("customData"),
+        json_sax_field<&GetDisplayMessagesResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetDisplayMessagesResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetDisplayMessagesResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::get_display_messages_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetDisplayMessagesResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetDisplayMessagesResponse written to
 std::ostream& operator<<(std::ostream& os, const GetDisplayMessagesResponse& k) {
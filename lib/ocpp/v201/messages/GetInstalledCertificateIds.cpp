@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -47,12 +50,42 @@ void from_json(const json& j, GetInstalledCertificateIdsRequest& k) {
         json arr = j.at("certificateType");
         std::vector<GetCertificateIdUseEnum> vec;
         for (auto val : arr) {
-            vec.push_back(conversions::string_to_get_certificate_id_use_enum(val));
+            vec.push_back(conversions::string_to_get_certificate_id_use_enum(val.get_ref<const std::string&>()));
         }
         k.certificateType.emplace(vec);
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetInstalledCertificateIdsRequest
+const JsonSaxFields& json_sax_fields(const GetInstalledCertificateIdsRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetInstalledCertificateIdsRequest::customData>("customData"),
+        json_sax_field<&GetInstalledCertificateIdsRequest::certificateType,
+                       conversions::string_to_get_certificate_id_use_enum>("certificateType"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetInstalledCertificateIdsRequest \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.certificateType) {
+        writer.key("certificateType");
+        writer.begin_array();
+        for (const auto& val : k.certificateType.value()) {
+            writer.value(conversions::get_certificate_id_use_enum_to_string(val));
+        }
+        writer.end_array();
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetInstalledCertificateIdsRequest \p k to the given output
 /// stream \p os \returns an output stream with the GetInstalledCertificateIdsRequest written to
 std::ostream& operator<<(std::ostream& os, const GetInstalledCertificateIdsRequest& k) {
@@ -86,7 +119,8 @@ void to_json(json& j, const GetInstalledCertificateIdsResponse& k) {
 
 void from_json(const json& j, GetInstalledCertificateIdsResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_get_installed_certificate_status_enum(j.at("status"));
+    k.status =
+        conversions::string_to_get_installed_certificate_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -105,6 +139,44 @@ void from_json(const json& j, GetInstalledCertificateIdsResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetInstalledCertificateIdsResponse
+const JsonSaxFields& json_sax_fields(const GetInstalledCertificateIdsResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetInstalledCertificateIdsResponse::status,
+                       conversions::string_to_get_installed_certificate_status_enum>("status"),
+        json_sax_field<&GetInstalledCertificateIdsResponse::customData>("customData"),
+        json_sax_field<&GetInstalledCertificateIdsResponse::statusInfo>("statusInfo"),
+        json_sax_field<&GetInstalledCertificateIdsResponse::certificateHashDataChain>("certificateHashDataChain"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetInstalledCertificateIdsResponse \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.certificateHashDataChain) {
+        writer.key("certificateHashDataChain");
+        writer.begin_array();
+        for (const auto& val : k.certificateHashDataChain.value()) {
+            write_json(writer, val);
+        }
+        writer.end_array();
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::get_installed_certificate_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetInstalledCertificateIdsResponse \p k to the given output
 /// stream \p os \returns an output stream with the GetInstalledCertificateIdsResponse written to
 std::ostream& operator<<(std::ostream& os, const GetInstalledCertificateIdsResponse& k) {
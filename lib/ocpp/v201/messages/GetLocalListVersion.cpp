@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -35,6 +38,25 @@ void from_json(const json& j, GetLocalListVersionRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetLocalListVersionRequest
+const JsonSaxFields& json_sax_fields(const GetLocalListVersionRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetLocalListVersionRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetLocalListVersionRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetLocalListVersionRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetLocalListVersionRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetLocalListVersionRequest written to
 std::ostream& operator<<(std::ostream& os, const GetLocalListVersionRequest& k) {
@@ -67,6 +89,28 @@ void from_json(const json& j, GetLocalListVersionResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetLocalListVersionResponse
+const JsonSaxFields& json_sax_fields(const GetLocalListVersionResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetLocalListVersionResponse::versionNumber>("versionNumber"),
+        json_sax_field<&GetLocalListVersionResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetLocalListVersionResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetLocalListVersionResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("versionNumber");
+    writer.value(k.versionNumber);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetLocalListVersionResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetLocalListVersionResponse written to
 std::ostream& operator<<(std::ostream& os, const GetLocalListVersionResponse& k) {
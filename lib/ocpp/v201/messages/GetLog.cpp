@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -39,7 +42,7 @@ void to_json(json& j, const GetLogRequest& k) {
 void from_json(const json& j, GetLogRequest& k) {
     // the required parts of the message
     k.log = j.at("log");
-    k.logType = conversions::string_to_log_enum(j.at("logType"));
+    k.logType = conversions::string_to_log_enum(j.at("logType").get_ref<const std::string&>());
     k.requestId = j.at("requestId");
 
     // the optional parts of the message
@@ -54,6 +57,44 @@ void from_json(const json& j, GetLogRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetLogRequest
+const JsonSaxFields& json_sax_fields(const GetLogRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetLogRequest::log>("log"),
+        json_sax_field<&GetLogRequest::logType, conversions::string_to_log_enum>("logType"),
+        json_sax_field<&GetLogRequest::requestId>("requestId"),
+        json_sax_field<&GetLogRequest::customData>("customData"),
+        json_sax_field<&GetLogRequest::retries>("retries"),
+        json_sax_field<&GetLogRequest::retryInterval>("retryInterval"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetLogRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetLogRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("log");
+    write_json(writer, k.log);
+    writer.key("logType");
+    writer.value(conversions::log_enum_to_string(k.logType));
+    writer.key("requestId");
+    writer.value(k.requestId);
+    if (k.retries) {
+        writer.key("retries");
+        writer.value(k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.key("retryInterval");
+        writer.value(k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetLogRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetLogRequest written to
 std::ostream& operator<<(std::ostream& os, const GetLogRequest& k) {
@@ -84,7 +125,7 @@ void to_json(json& j, const GetLogResponse& k) {
 
 void from_json(const json& j, GetLogResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_log_status_enum(j.at("status"));
+    k.status = conversions::string_to_log_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -98,6 +139,38 @@ void from_json(const json& j, GetLogResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetLogResponse
+const JsonSaxFields& json_sax_fields(const GetLogResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetLogResponse::status, conversions::string_to_log_status_enum>("status"),
+        json_sax_field<&GetLogResponse::customData>("customData"),
+        json_sax_field<&GetLogResponse::statusInfo>("statusInfo"),
+        json_sax_field<&GetLogResponse::filename>("filename"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetLogResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetLogResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.filename) {
+        writer.key("filename");
+        writer.value(k.filename.value().view());
+    }
+    writer.key("status");
+    writer.value(conversions::log_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetLogResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetLogResponse written to
 std::ostream& operator<<(std::ostream& os, const GetLogResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -60,12 +63,53 @@ void from_json(const json& j, GetMonitoringReportRequest& k) {
         json arr = j.at("monitoringCriteria");
         std::vector<MonitoringCriterionEnum> vec;
         for (auto val : arr) {
-            vec.push_back(conversions::string_to_monitoring_criterion_enum(val));
+            vec.push_back(conversions::string_to_monitoring_criterion_enum(val.get_ref<const std::string&>()));
         }
         k.monitoringCriteria.emplace(vec);
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetMonitoringReportRequest
+const JsonSaxFields& json_sax_fields(const GetMonitoringReportRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetMonitoringReportRequest::requestId>("requestId"),
+        json_sax_field<&GetMonitoringReportRequest::customData>("customData"),
+        json_sax_field<&GetMonitoringReportRequest::componentVariable>("componentVariable"),
+        json_sax_field<&GetMonitoringReportRequest::monitoringCriteria,
+                       conversions::string_to_monitoring_criterion_enum>("monitoringCriteria"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetMonitoringReportRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetMonitoringReportRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.componentVariable) {
+        writer.key("componentVariable");
+        writer.begin_array();
+        for (const auto& val : k.componentVariable.value()) {
+            write_json(writer, val);
+        }
+        writer.end_array();
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.monitoringCriteria) {
+        writer.key("monitoringCriteria");
+        writer.begin_array();
+        for (const auto& val : k.monitoringCriteria.value()) {
+            writer.value(conversions::monitoring_criterion_enum_to_string(val));
+        }
+        writer.end_array();
+    }
+    writer.key("requestId");
+    writer.value(k.requestId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetMonitoringReportRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetMonitoringReportRequest written to
 std::ostream& operator<<(std::ostream& os, const GetMonitoringReportRequest& k) {
@@ -93,7 +137,7 @@ void to_json(json& j, const GetMonitoringReportResponse& k) {
 
 void from_json(const json& j, GetMonitoringReportResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_device_model_status_enum(j.at("status"));
+    k.status = conversions::string_to_generic_device_model_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -104,6 +148,34 @@ void from_json(const json& j, GetMonitoringReportResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetMonitoringReportResponse
+const JsonSaxFields& json_sax_fields(const GetMonitoringReportResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetMonitoringReportResponse::status,
+                       conversions::string_to_generic_device_model_status_enum>("status"),
+        json_sax_field<&GetMonitoringReportResponse::customData>("customData"),
+        json_sax_field<&GetMonitoringReportResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetMonitoringReportResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetMonitoringReportResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::generic_device_model_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetMonitoringReportResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetMonitoringReportResponse written to
 std::ostream& operator<<(std::ostream& os, const GetMonitoringReportResponse& k) {
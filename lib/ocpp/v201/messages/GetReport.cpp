@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -60,12 +63,53 @@ void from_json(const json& j, GetReportRequest& k) {
         json arr = j.at("componentCriteria");
         std::vector<ComponentCriterionEnum> vec;
         for (auto val : arr) {
-            vec.push_back(conversions::string_to_component_criterion_enum(val));
+            vec.push_back(conversions::string_to_component_criterion_enum(val.get_ref<const std::string&>()));
         }
         k.componentCriteria.emplace(vec);
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetReportRequest
+const JsonSaxFields& json_sax_fields(const GetReportRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetReportRequest::requestId>("requestId"),
+        json_sax_field<&GetReportRequest::customData>("customData"),
+        json_sax_field<&GetReportRequest::componentVariable>("componentVariable"),
+        json_sax_field<&GetReportRequest::componentCriteria,
+                       conversions::string_to_component_criterion_enum>("componentCriteria"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetReportRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetReportRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.componentCriteria) {
+        writer.key("componentCriteria");
+        writer.begin_array();
+        for (const auto& val : k.componentCriteria.value()) {
+            writer.value(conversions::component_criterion_enum_to_string(val));
+        }
+        writer.end_array();
+    }
+    if (k.componentVariable) {
+        writer.key("componentVariable");
+        writer.begin_array();
+        for (const auto& val : k.componentVariable.value()) {
+            write_json(writer, val);
+        }
+        writer.end_array();
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("requestId");
+    writer.value(k.requestId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetReportRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetReportRequest written to
 std::ostream& operator<<(std::ostream& os, const GetReportRequest& k) {
@@ -93,7 +137,7 @@ void to_json(json& j, const GetReportResponse& k) {
 
 void from_json(const json& j, GetReportResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_device_model_status_enum(j.at("status"));
+    k.status = conversions::string_to_generic_device_model_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -104,6 +148,33 @@ void from_json(const json& j, GetReportResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetReportResponse
+const JsonSaxFields& json_sax_fields(const GetReportResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetReportResponse::status, conversions::string_to_generic_device_model_status_enum>("status"),
+        json_sax_field<&GetReportResponse::customData>("customData"),
+        json_sax_field<&GetReportResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetReportResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetReportResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::generic_device_model_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetReportResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetReportResponse written to
 std::ostream& operator<<(std::ostream& os, const GetReportResponse& k) {
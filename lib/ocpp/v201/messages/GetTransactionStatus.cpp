@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -41,6 +44,30 @@ void from_json(const json& j, GetTransactionStatusRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetTransactionStatusRequest
+const JsonSaxFields& json_sax_fields(const GetTransactionStatusRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetTransactionStatusRequest::customData>("customData"),
+        json_sax_field<&GetTransactionStatusRequest::transactionId>("transactionId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetTransactionStatusRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetTransactionStatusRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.transactionId) {
+        writer.key("transactionId");
+        writer.value(k.transactionId.value().view());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetTransactionStatusRequest \p k to the given output stream \p
 /// os \returns an output stream with the GetTransactionStatusRequest written to
 std::ostream& operator<<(std::ostream& os, const GetTransactionStatusRequest& k) {
@@ -79,6 +106,33 @@ void from_json(const json& j, GetTransactionStatusResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetTransactionStatusResponse
+const JsonSaxFields& json_sax_fields(const GetTransactionStatusResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetTransactionStatusResponse::messagesInQueue>("messagesInQueue"),
+        json_sax_field<&GetTransactionStatusResponse::customData>("customData"),
+        json_sax_field<&GetTransactionStatusResponse::ongoingIndicator>("ongoingIndicator"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetTransactionStatusResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetTransactionStatusResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("messagesInQueue");
+    writer.value(k.messagesInQueue);
+    if (k.ongoingIndicator) {
+        writer.key("ongoingIndicator");
+        writer.value(k.ongoingIndicator.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetTransactionStatusResponse \p k to the given output stream \p
 /// os \returns an output stream with the GetTransactionStatusResponse written to
 std::ostream& operator<<(std::ostream& os, const GetTransactionStatusResponse& k) {
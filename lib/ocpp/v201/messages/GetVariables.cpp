@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -40,6 +43,32 @@ void from_json(const json& j, GetVariablesRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetVariablesRequest
+const JsonSaxFields& json_sax_fields(const GetVariablesRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetVariablesRequest::getVariableData>("getVariableData"),
+        json_sax_field<&GetVariablesRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetVariablesRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetVariablesRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("getVariableData");
+    writer.begin_array();
+    for (const auto& val : k.getVariableData) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetVariablesRequest \p k to the given output stream \p os
 /// \returns an output stream with the GetVariablesRequest written to
 std::ostream& operator<<(std::ostream& os, const GetVariablesRequest& k) {
@@ -74,6 +103,32 @@ void from_json(const json& j, GetVariablesResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetVariablesResponse
+const JsonSaxFields& json_sax_fields(const GetVariablesResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetVariablesResponse::getVariableResult>("getVariableResult"),
+        json_sax_field<&GetVariablesResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetVariablesResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetVariablesResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("getVariableResult");
+    writer.begin_array();
+    for (const auto& val : k.getVariableResult) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given GetVariablesResponse \p k to the given output stream \p os
 /// \returns an output stream with the GetVariablesResponse written to
 std::ostream& operator<<(std::ostream& os, const GetVariablesResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -31,7 +34,8 @@ void to_json(json& j, const InstallCertificateRequest& k) {
 
 void from_json(const json& j, InstallCertificateRequest& k) {
     // the required parts of the message
-    k.certificateType = conversions::string_to_install_certificate_use_enum(j.at("certificateType"));
+    k.certificateType =
+        conversions::string_to_install_certificate_use_enum(j.at("certificateType").get_ref<const std::string&>());
     k.certificate = j.at("certificate");
 
     // the optional parts of the message
@@ -40,6 +44,32 @@ void from_json(const json& j, InstallCertificateRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a InstallCertificateRequest
+const JsonSaxFields& json_sax_fields(const InstallCertificateRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&InstallCertificateRequest::certificateType,
+                       conversions::string_to_install_certificate_use_enum>("certificateType"),
+        json_sax_field<&InstallCertificateRequest::certificate>("certificate"),
+        json_sax_field<&InstallCertificateRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given InstallCertificateRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const InstallCertificateRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("certificate");
+    writer.value(k.certificate.view());
+    writer.key("certificateType");
+    writer.value(conversions::install_certificate_use_enum_to_string(k.certificateType));
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given InstallCertificateRequest \p k to the given output stream \p os
 /// \returns an output stream with the InstallCertificateRequest written to
 std::ostream& operator<<(std::ostream& os, const InstallCertificateRequest& k) {
@@ -67,7 +97,7 @@ void to_json(json& j, const InstallCertificateResponse& k) {
 
 void from_json(const json& j, InstallCertificateResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_install_certificate_status_enum(j.at("status"));
+    k.status = conversions::string_to_install_certificate_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -78,6 +108,34 @@ void from_json(const json& j, InstallCertificateResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a InstallCertificateResponse
+const JsonSaxFields& json_sax_fields(const InstallCertificateResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&InstallCertificateResponse::status,
+                       conversions::string_to_install_certificate_status_enum>("status"),
+        json_sax_field<&InstallCertificateResponse::customData>("customData"),
+        json_sax_field<&InstallCertificateResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given InstallCertificateResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const InstallCertificateResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::install_certificate_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given InstallCertificateResponse \p k to the given output stream \p
 /// os \returns an output stream with the InstallCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const InstallCertificateResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -58,6 +61,42 @@ void from_json(const json& j, NotifyChargingLimitRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyChargingLimitRequest
+const JsonSaxFields& json_sax_fields(const NotifyChargingLimitRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&NotifyChargingLimitRequest::chargingLimit>("chargingLimit"),
+        json_sax_field<&NotifyChargingLimitRequest::customData>("customData"),
+        json_sax_field<&NotifyChargingLimitRequest::chargingSchedule>("chargingSchedule"),
+        json_sax_field<&NotifyChargingLimitRequest::evseId>("evseId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given NotifyChargingLimitRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyChargingLimitRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("chargingLimit");
+    write_json(writer, k.chargingLimit);
+    if (k.chargingSchedule) {
+        writer.key("chargingSchedule");
+        writer.begin_array();
+        for (const auto& val : k.chargingSchedule.value()) {
+            write_json(writer, val);
+        }
+        writer.end_array();
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.evseId) {
+        writer.key("evseId");
+        writer.value(k.evseId.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyChargingLimitRequest \p k to the given output stream \p
 /// os \returns an output stream with the NotifyChargingLimitRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyChargingLimitRequest& k) {
@@ -87,6 +126,25 @@ void from_json(const json& j, NotifyChargingLimitResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyChargingLimitResponse
+const JsonSaxFields& json_sax_fields(const NotifyChargingLimitResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&NotifyChargingLimitResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given NotifyChargingLimitResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyChargingLimitResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyChargingLimitResponse \p k to the given output stream \p
 /// os \returns an output stream with the NotifyChargingLimitResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyChargingLimitResponse& k) {
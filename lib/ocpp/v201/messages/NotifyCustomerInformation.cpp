@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -50,6 +53,42 @@ void from_json(const json& j, NotifyCustomerInformationRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyCustomerInformationRequest
+const JsonSaxFields& json_sax_fields(const NotifyCustomerInformationRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&NotifyCustomerInformationRequest::data>("data"),
+        json_sax_field<&NotifyCustomerInformationRequest::seqNo>("seqNo"),
+        json_sax_field<&NotifyCustomerInformationRequest::generatedAt>("generatedAt"),
+        json_sax_field<&NotifyCustomerInformationRequest::requestId>("requestId"),
+        json_sax_field<&NotifyCustomerInformationRequest::customData>("customData"),
+        json_sax_field<&NotifyCustomerInformationRequest::tbc>("tbc"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given NotifyCustomerInformationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyCustomerInformationRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("data");
+    writer.value(k.data.view());
+    writer.key("generatedAt");
+    writer.value(k.generatedAt);
+    writer.key("requestId");
+    writer.value(k.requestId);
+    writer.key("seqNo");
+    writer.value(k.seqNo);
+    if (k.tbc) {
+        writer.key("tbc");
+        writer.value(k.tbc.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyCustomerInformationRequest \p k to the given output
 /// stream \p os \returns an output stream with the NotifyCustomerInformationRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyCustomerInformationRequest& k) {
@@ -79,6 +118,26 @@ void from_json(const json& j, NotifyCustomerInformationResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyCustomerInformationResponse
+const JsonSaxFields& json_sax_fields(const NotifyCustomerInformationResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&NotifyCustomerInformationResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given NotifyCustomerInformationResponse \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const NotifyCustomerInformationResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyCustomerInformationResponse \p k to the given output
 /// stream \p os \returns an output stream with the NotifyCustomerInformationResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyCustomerInformationResponse& k) {
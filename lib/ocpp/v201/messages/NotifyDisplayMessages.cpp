@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -58,6 +61,42 @@ void from_json(const json& j, NotifyDisplayMessagesRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyDisplayMessagesRequest
+const JsonSaxFields& json_sax_fields(const NotifyDisplayMessagesRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&NotifyDisplayMessagesRequest::requestId>("requestId"),
+        json_sax_field<&NotifyDisplayMessagesRequest::customData>("customData"),
+        json_sax_field<&NotifyDisplayMessagesRequest::messageInfo>("messageInfo"),
+        json_sax_field<&NotifyDisplayMessagesRequest::tbc>("tbc"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given NotifyDisplayMessagesRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyDisplayMessagesRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.messageInfo) {
+        writer.key("messageInfo");
+        writer.begin_array();
+        for (const auto& val : k.messageInfo.value()) {
+            write_json(writer, val);
+        }
+        writer.end_array();
+    }
+    writer.key("requestId");
+    writer.value(k.requestId);
+    if (k.tbc) {
+        writer.key("tbc");
+        writer.value(k.tbc.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyDisplayMessagesRequest \p k to the given output stream \p
 /// os \returns an output stream with the NotifyDisplayMessagesRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyDisplayMessagesRequest& k) {
@@ -87,6 +126,25 @@ void from_json(const json& j, NotifyDisplayMessagesResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyDisplayMessagesResponse
+const JsonSaxFields& json_sax_fields(const NotifyDisplayMessagesResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&NotifyDisplayMessagesResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given NotifyDisplayMessagesResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyDisplayMessagesResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyDisplayMessagesResponse \p k to the given output stream
 /// \p os \returns an output stream with the NotifyDisplayMessagesResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyDisplayMessagesResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -46,6 +49,36 @@ void from_json(const json& j, NotifyEVChargingNeedsRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyEVChargingNeedsRequest
+const JsonSaxFields& json_sax_fields(const NotifyEVChargingNeedsRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&NotifyEVChargingNeedsRequest::chargingNeeds>("chargingNeeds"),
+        json_sax_field<&NotifyEVChargingNeedsRequest::evseId>("evseId"),
+        json_sax_field<&NotifyEVChargingNeedsRequest::customData>("customData"),
+        json_sax_field<&NotifyEVChargingNeedsRequest::maxScheduleTuples>("maxScheduleTuples"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given NotifyEVChargingNeedsRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyEVChargingNeedsRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("chargingNeeds");
+    write_json(writer, k.chargingNeeds);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("evseId");
+    writer.value(k.evseId);
+    if (k.maxScheduleTuples) {
+        writer.key("maxScheduleTuples");
+        writer.value(k.maxScheduleTuples.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyEVChargingNeedsRequest \p k to the given output stream \p
 /// os \returns an output stream with the NotifyEVChargingNeedsRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingNeedsRequest& k) {
@@ -73,7 +106,7 @@ void to_json(json& j, const NotifyEVChargingNeedsResponse& k) {
 
 void from_json(const json& j, NotifyEVChargingNeedsResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_notify_evcharging_needs_status_enum(j.at("status"));
+    k.status = conversions::string_to_notify_evcharging_needs_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -84,6 +117,34 @@ void from_json(const json& j, NotifyEVChargingNeedsResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyEVChargingNeedsResponse
+const JsonSaxFields& json_sax_fields(const NotifyEVChargingNeedsResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&NotifyEVChargingNeedsResponse::status,
+                       conversions::string_to_notify_evcharging_needs_status_enum>("status"),
+        json_sax_field<&NotifyEVChargingNeedsResponse::customData>("customData"),
+        json_sax_field<&NotifyEVChargingNeedsResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given NotifyEVChargingNeedsResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyEVChargingNeedsResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::notify_evcharging_needs_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyEVChargingNeedsResponse \p k to the given output stream
 /// \p os \returns an output stream with the NotifyEVChargingNeedsResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingNeedsResponse& k) {
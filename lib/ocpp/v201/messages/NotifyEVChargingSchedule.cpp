@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -42,6 +45,34 @@ void from_json(const json& j, NotifyEVChargingScheduleRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyEVChargingScheduleRequest
+const JsonSaxFields& json_sax_fields(const NotifyEVChargingScheduleRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&NotifyEVChargingScheduleRequest::timeBase>("timeBase"),
+        json_sax_field<&NotifyEVChargingScheduleRequest::chargingSchedule>("chargingSchedule"),
+        json_sax_field<&NotifyEVChargingScheduleRequest::evseId>("evseId"),
+        json_sax_field<&NotifyEVChargingScheduleRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given NotifyEVChargingScheduleRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyEVChargingScheduleRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("chargingSchedule");
+    write_json(writer, k.chargingSchedule);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("evseId");
+    writer.value(k.evseId);
+    writer.key("timeBase");
+    writer.value(k.timeBase);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyEVChargingScheduleRequest \p k to the given output stream
 /// \p os \returns an output stream with the NotifyEVChargingScheduleRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingScheduleRequest& k) {
@@ -69,7 +100,7 @@ void to_json(json& j, const NotifyEVChargingScheduleResponse& k) {
 
 void from_json(const json& j, NotifyEVChargingScheduleResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_status_enum(j.at("status"));
+    k.status = conversions::string_to_generic_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -80,6 +111,33 @@ void from_json(const json& j, NotifyEVChargingScheduleResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyEVChargingScheduleResponse
+const JsonSaxFields& json_sax_fields(const NotifyEVChargingScheduleResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&NotifyEVChargingScheduleResponse::status, conversions::string_to_generic_status_enum>("status"),
+        json_sax_field<&NotifyEVChargingScheduleResponse::customData>("customData"),
+        json_sax_field<&NotifyEVChargingScheduleResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given NotifyEVChargingScheduleResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyEVChargingScheduleResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::generic_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyEVChargingScheduleResponse \p k to the given output
 /// stream \p os \returns an output stream with the NotifyEVChargingScheduleResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyEVChargingScheduleResponse& k) {
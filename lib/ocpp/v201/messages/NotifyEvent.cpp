@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -50,6 +53,43 @@ void from_json(const json& j, NotifyEventRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyEventRequest
+const JsonSaxFields& json_sax_fields(const NotifyEventRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&NotifyEventRequest::generatedAt>("generatedAt"),
+        json_sax_field<&NotifyEventRequest::seqNo>("seqNo"),
+        json_sax_field<&NotifyEventRequest::eventData>("eventData"),
+        json_sax_field<&NotifyEventRequest::customData>("customData"),
+        json_sax_field<&NotifyEventRequest::tbc>("tbc"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given NotifyEventRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyEventRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("eventData");
+    writer.begin_array();
+    for (const auto& val : k.eventData) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    writer.key("generatedAt");
+    writer.value(k.generatedAt);
+    writer.key("seqNo");
+    writer.value(k.seqNo);
+    if (k.tbc) {
+        writer.key("tbc");
+        writer.value(k.tbc.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyEventRequest \p k to the given output stream \p os
 /// \returns an output stream with the NotifyEventRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyEventRequest& k) {
@@ -79,6 +119,25 @@ void from_json(const json& j, NotifyEventResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyEventResponse
+const JsonSaxFields& json_sax_fields(const NotifyEventResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&NotifyEventResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given NotifyEventResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyEventResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyEventResponse \p k to the given output stream \p os
 /// \returns an output stream with the NotifyEventResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyEventResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -62,6 +65,48 @@ void from_json(const json& j, NotifyMonitoringReportRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyMonitoringReportRequest
+const JsonSaxFields& json_sax_fields(const NotifyMonitoringReportRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&NotifyMonitoringReportRequest::requestId>("requestId"),
+        json_sax_field<&NotifyMonitoringReportRequest::seqNo>("seqNo"),
+        json_sax_field<&NotifyMonitoringReportRequest::generatedAt>("generatedAt"),
+        json_sax_field<&NotifyMonitoringReportRequest::customData>("customData"),
+        json_sax_field<&NotifyMonitoringReportRequest::monitor>("monitor"),
+        json_sax_field<&NotifyMonitoringReportRequest::tbc>("tbc"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given NotifyMonitoringReportRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyMonitoringReportRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("generatedAt");
+    writer.value(k.generatedAt);
+    if (k.monitor) {
+        writer.key("monitor");
+        writer.begin_array();
+        for (const auto& val : k.monitor.value()) {
+            write_json(writer, val);
+        }
+        writer.end_array();
+    }
+    writer.key("requestId");
+    writer.value(k.requestId);
+    writer.key("seqNo");
+    writer.value(k.seqNo);
+    if (k.tbc) {
+        writer.key("tbc");
+        writer.value(k.tbc.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyMonitoringReportRequest \p k to the given output stream
 /// \p os \returns an output stream with the NotifyMonitoringReportRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyMonitoringReportRequest& k) {
@@ -91,6 +136,25 @@ void from_json(const json& j, NotifyMonitoringReportResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyMonitoringReportResponse
+const JsonSaxFields& json_sax_fields(const NotifyMonitoringReportResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&NotifyMonitoringReportResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given NotifyMonitoringReportResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyMonitoringReportResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyMonitoringReportResponse \p k to the given output stream
 /// \p os \returns an output stream with the NotifyMonitoringReportResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyMonitoringReportResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -62,6 +65,48 @@ void from_json(const json& j, NotifyReportRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyReportRequest
+const JsonSaxFields& json_sax_fields(const NotifyReportRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&NotifyReportRequest::requestId>("requestId"),
+        json_sax_field<&NotifyReportRequest::generatedAt>("generatedAt"),
+        json_sax_field<&NotifyReportRequest::seqNo>("seqNo"),
+        json_sax_field<&NotifyReportRequest::customData>("customData"),
+        json_sax_field<&NotifyReportRequest::reportData>("reportData"),
+        json_sax_field<&NotifyReportRequest::tbc>("tbc"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given NotifyReportRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyReportRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("generatedAt");
+    writer.value(k.generatedAt);
+    if (k.reportData) {
+        writer.key("reportData");
+        writer.begin_array();
+        for (const auto& val : k.reportData.value()) {
+            write_json(writer, val);
+        }
+        writer.end_array();
+    }
+    writer.key("requestId");
+    writer.value(k.requestId);
+    writer.key("seqNo");
+    writer.value(k.seqNo);
+    if (k.tbc) {
+        writer.key("tbc");
+        writer.value(k.tbc.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyReportRequest \p k to the given output stream \p os
 /// \returns an output stream with the NotifyReportRequest written to
 std::ostream& operator<<(std::ostream& os, const NotifyReportRequest& k) {
@@ -91,6 +136,25 @@ void from_json(const json& j, NotifyReportResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NotifyReportResponse
+const JsonSaxFields& json_sax_fields(const NotifyReportResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&NotifyReportResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given NotifyReportResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NotifyReportResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given NotifyReportResponse \p k to the given output stream \p os
 /// \returns an output stream with the NotifyReportResponse written to
 std::ostream& operator<<(std::ostream& os, const NotifyReportResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -54,6 +57,44 @@ void from_json(const json& j, PublishFirmwareRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a PublishFirmwareRequest
+const JsonSaxFields& json_sax_fields(const PublishFirmwareRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&PublishFirmwareRequest::location>("location"),
+        json_sax_field<&PublishFirmwareRequest::checksum>("checksum"),
+        json_sax_field<&PublishFirmwareRequest::requestId>("requestId"),
+        json_sax_field<&PublishFirmwareRequest::customData>("customData"),
+        json_sax_field<&PublishFirmwareRequest::retries>("retries"),
+        json_sax_field<&PublishFirmwareRequest::retryInterval>("retryInterval"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given PublishFirmwareRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const PublishFirmwareRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("checksum");
+    writer.value(k.checksum.view());
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("location");
+    writer.value(k.location.view());
+    writer.key("requestId");
+    writer.value(k.requestId);
+    if (k.retries) {
+        writer.key("retries");
+        writer.value(k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.key("retryInterval");
+        writer.value(k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given PublishFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the PublishFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareRequest& k) {
@@ -81,7 +122,7 @@ void to_json(json& j, const PublishFirmwareResponse& k) {
 
 void from_json(const json& j, PublishFirmwareResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_status_enum(j.at("status"));
+    k.status = conversions::string_to_generic_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -92,6 +133,33 @@ void from_json(const json& j, PublishFirmwareResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a PublishFirmwareResponse
+const JsonSaxFields& json_sax_fields(const PublishFirmwareResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&PublishFirmwareResponse::status, conversions::string_to_generic_status_enum>("status"),
+        json_sax_field<&PublishFirmwareResponse::customData>("customData"),
+        json_sax_field<&PublishFirmwareResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given PublishFirmwareResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const PublishFirmwareResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::generic_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given PublishFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the PublishFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -39,7 +42,7 @@ void to_json(json& j, const PublishFirmwareStatusNotificationRequest& k) {
 
 void from_json(const json& j, PublishFirmwareStatusNotificationRequest& k) {
     // the required parts of the message
-    k.status = conversions::string_to_publish_firmware_status_enum(j.at("status"));
+    k.status = conversions::string_to_publish_firmware_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -58,6 +61,45 @@ void from_json(const json& j, PublishFirmwareStatusNotificationRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a
+/// PublishFirmwareStatusNotificationRequest
+const JsonSaxFields& json_sax_fields(const PublishFirmwareStatusNotificationRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&PublishFirmwareStatusNotificationRequest::status,
+                       conversions::string_to_publish_firmware_status_enum>("status"),
+        json_sax_field<&PublishFirmwareStatusNotificationRequest::customData>("customData"),
+        json_sax_field<&PublishFirmwareStatusNotificationRequest::location>("location"),
+        json_sax_field<&PublishFirmwareStatusNotificationRequest::requestId>("requestId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given PublishFirmwareStatusNotificationRequest \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const PublishFirmwareStatusNotificationRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.location) {
+        writer.key("location");
+        writer.begin_array();
+        for (const auto& val : k.location.value()) {
+            writer.value(val.view());
+        }
+        writer.end_array();
+    }
+    if (k.requestId) {
+        writer.key("requestId");
+        writer.value(k.requestId.value());
+    }
+    writer.key("status");
+    writer.value(conversions::publish_firmware_status_enum_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given PublishFirmwareStatusNotificationRequest \p k to the given
 /// output stream \p os \returns an output stream with the PublishFirmwareStatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareStatusNotificationRequest& k) {
@@ -87,6 +129,27 @@ void from_json(const json& j, PublishFirmwareStatusNotificationResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a
+/// PublishFirmwareStatusNotificationResponse
+const JsonSaxFields& json_sax_fields(const PublishFirmwareStatusNotificationResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&PublishFirmwareStatusNotificationResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given PublishFirmwareStatusNotificationResponse \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const PublishFirmwareStatusNotificationResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given PublishFirmwareStatusNotificationResponse \p k to the given
 /// output stream \p os \returns an output stream with the PublishFirmwareStatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const PublishFirmwareStatusNotificationResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -37,7 +40,8 @@ void to_json(json& j, const ReportChargingProfilesRequest& k) {
 void from_json(const json& j, ReportChargingProfilesRequest& k) {
     // the required parts of the message
     k.requestId = j.at("requestId");
-    k.chargingLimitSource = conversions::string_to_charging_limit_source_enum(j.at("chargingLimitSource"));
+    k.chargingLimitSource =
+        conversions::string_to_charging_limit_source_enum(j.at("chargingLimitSource").get_ref<const std::string&>());
     for (auto val : j.at("chargingProfile")) {
         k.chargingProfile.push_back(val);
     }
@@ -52,6 +56,47 @@ void from_json(const json& j, ReportChargingProfilesRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ReportChargingProfilesRequest
+const JsonSaxFields& json_sax_fields(const ReportChargingProfilesRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ReportChargingProfilesRequest::requestId>("requestId"),
+        json_sax_field<&ReportChargingProfilesRequest::chargingLimitSource,
+                       conversions::string_to_charging_limit_source_enum>("chargingLimitSource"),
+        json_sax_field<&ReportChargingProfilesRequest::chargingProfile>("chargingProfile"),
+        json_sax_field<&ReportChargingProfilesRequest::evseId>("evseId"),
+        json_sax_field<&ReportChargingProfilesRequest::customData>("customData"),
+        json_sax_field<&ReportChargingProfilesRequest::tbc>("tbc"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ReportChargingProfilesRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ReportChargingProfilesRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("chargingLimitSource");
+    writer.value(conversions::charging_limit_source_enum_to_string(k.chargingLimitSource));
+    writer.key("chargingProfile");
+    writer.begin_array();
+    for (const auto& val : k.chargingProfile) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("evseId");
+    writer.value(k.evseId);
+    writer.key("requestId");
+    writer.value(k.requestId);
+    if (k.tbc) {
+        writer.key("tbc");
+        writer.value(k.tbc.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ReportChargingProfilesRequest \p k to the given output stream
 /// \p os \returns an output stream with the ReportChargingProfilesRequest written to
 std::ostream& operator<<(std::ostream& os, const ReportChargingProfilesRequest& k) {
@@ -81,6 +126,25 @@ void from_json(const json& j, ReportChargingProfilesResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ReportChargingProfilesResponse
+const JsonSaxFields& json_sax_fields(const ReportChargingProfilesResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ReportChargingProfilesResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ReportChargingProfilesResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ReportChargingProfilesResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ReportChargingProfilesResponse \p k to the given output stream
 /// \p os \returns an output stream with the ReportChargingProfilesResponse written to
 std::ostream& operator<<(std::ostream& os, const ReportChargingProfilesResponse& k) {
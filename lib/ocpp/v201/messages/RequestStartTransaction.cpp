@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -58,6 +61,46 @@ void from_json(const json& j, RequestStartTransactionRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a RequestStartTransactionRequest
+const JsonSaxFields& json_sax_fields(const RequestStartTransactionRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&RequestStartTransactionRequest::idToken>("idToken"),
+        json_sax_field<&RequestStartTransactionRequest::remoteStartId>("remoteStartId"),
+        json_sax_field<&RequestStartTransactionRequest::customData>("customData"),
+        json_sax_field<&RequestStartTransactionRequest::evseId>("evseId"),
+        json_sax_field<&RequestStartTransactionRequest::groupIdToken>("groupIdToken"),
+        json_sax_field<&RequestStartTransactionRequest::chargingProfile>("chargingProfile"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given RequestStartTransactionRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const RequestStartTransactionRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.chargingProfile) {
+        writer.key("chargingProfile");
+        write_json(writer, k.chargingProfile.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.evseId) {
+        writer.key("evseId");
+        writer.value(k.evseId.value());
+    }
+    if (k.groupIdToken) {
+        writer.key("groupIdToken");
+        write_json(writer, k.groupIdToken.value());
+    }
+    writer.key("idToken");
+    write_json(writer, k.idToken);
+    writer.key("remoteStartId");
+    writer.value(k.remoteStartId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given RequestStartTransactionRequest \p k to the given output stream
 /// \p os \returns an output stream with the RequestStartTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RequestStartTransactionRequest& k) {
@@ -88,7 +131,7 @@ void to_json(json& j, const RequestStartTransactionResponse& k) {
 
 void from_json(const json& j, RequestStartTransactionResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_request_start_stop_status_enum(j.at("status"));
+    k.status = conversions::string_to_request_start_stop_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -102,6 +145,39 @@ void from_json(const json& j, RequestStartTransactionResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a RequestStartTransactionResponse
+const JsonSaxFields& json_sax_fields(const RequestStartTransactionResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&RequestStartTransactionResponse::status,
+                       conversions::string_to_request_start_stop_status_enum>("status"),
+        json_sax_field<&RequestStartTransactionResponse::customData>("customData"),
+        json_sax_field<&RequestStartTransactionResponse::statusInfo>("statusInfo"),
+        json_sax_field<&RequestStartTransactionResponse::transactionId>("transactionId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given RequestStartTransactionResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const RequestStartTransactionResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::request_start_stop_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    if (k.transactionId) {
+        writer.key("transactionId");
+        writer.value(k.transactionId.value().view());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given RequestStartTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RequestStartTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RequestStartTransactionResponse& k) {
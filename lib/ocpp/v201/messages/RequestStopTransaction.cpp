@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -38,6 +41,28 @@ void from_json(const json& j, RequestStopTransactionRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a RequestStopTransactionRequest
+const JsonSaxFields& json_sax_fields(const RequestStopTransactionRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&RequestStopTransactionRequest::transactionId>("transactionId"),
+        json_sax_field<&RequestStopTransactionRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given RequestStopTransactionRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const RequestStopTransactionRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("transactionId");
+    writer.value(k.transactionId.view());
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given RequestStopTransactionRequest \p k to the given output stream
 /// \p os \returns an output stream with the RequestStopTransactionRequest written to
 std::ostream& operator<<(std::ostream& os, const RequestStopTransactionRequest& k) {
@@ -65,7 +90,7 @@ void to_json(json& j, const RequestStopTransactionResponse& k) {
 
 void from_json(const json& j, RequestStopTransactionResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_request_start_stop_status_enum(j.at("status"));
+    k.status = conversions::string_to_request_start_stop_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -76,6 +101,34 @@ void from_json(const json& j, RequestStopTransactionResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a RequestStopTransactionResponse
+const JsonSaxFields& json_sax_fields(const RequestStopTransactionResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&RequestStopTransactionResponse::status,
+                       conversions::string_to_request_start_stop_status_enum>("status"),
+        json_sax_field<&RequestStopTransactionResponse::customData>("customData"),
+        json_sax_field<&RequestStopTransactionResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given RequestStopTransactionResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const RequestStopTransactionResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::request_start_stop_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given RequestStopTransactionResponse \p k to the given output stream
 /// \p os \returns an output stream with the RequestStopTransactionResponse written to
 std::ostream& operator<<(std::ostream& os, const RequestStopTransactionResponse& k) {
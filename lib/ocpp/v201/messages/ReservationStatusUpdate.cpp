@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -32,7 +35,9 @@ void to_json(json& j, const ReservationStatusUpdateRequest& k) {
 void from_json(const json& j, ReservationStatusUpdateRequest& k) {
     // the required parts of the message
     k.reservationId = j.at("reservationId");
-    k.reservationUpdateStatus = conversions::string_to_reservation_update_status_enum(j.at("reservationUpdateStatus"));
+    k.reservationUpdateStatus =
+        conversions::string_to_reservation_update_status_enum(
+            j.at("reservationUpdateStatus").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -40,6 +45,32 @@ void from_json(const json& j, ReservationStatusUpdateRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ReservationStatusUpdateRequest
+const JsonSaxFields& json_sax_fields(const ReservationStatusUpdateRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ReservationStatusUpdateRequest::reservationId>("reservationId"),
+        json_sax_field<&ReservationStatusUpdateRequest::reservationUpdateStatus,
+                       conversions::string_to_reservation_update_status_enum>("reservationUpdateStatus"),
+        json_sax_field<&ReservationStatusUpdateRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ReservationStatusUpdateRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ReservationStatusUpdateRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("reservationId");
+    writer.value(k.reservationId);
+    writer.key("reservationUpdateStatus");
+    writer.value(conversions::reservation_update_status_enum_to_string(k.reservationUpdateStatus));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ReservationStatusUpdateRequest \p k to the given output stream
 /// \p os \returns an output stream with the ReservationStatusUpdateRequest written to
 std::ostream& operator<<(std::ostream& os, const ReservationStatusUpdateRequest& k) {
@@ -69,6 +100,25 @@ void from_json(const json& j, ReservationStatusUpdateResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ReservationStatusUpdateResponse
+const JsonSaxFields& json_sax_fields(const ReservationStatusUpdateResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ReservationStatusUpdateResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ReservationStatusUpdateResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ReservationStatusUpdateResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ReservationStatusUpdateResponse \p k to the given output stream
 /// \p os \returns an output stream with the ReservationStatusUpdateResponse written to
 std::ostream& operator<<(std::ostream& os, const ReservationStatusUpdateResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -50,7 +53,8 @@ void from_json(const json& j, ReserveNowRequest& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("connectorType")) {
-        k.connectorType.emplace(conversions::string_to_connector_enum(j.at("connectorType")));
+        k.connectorType.emplace(
+            conversions::string_to_connector_enum(j.at("connectorType").get_ref<const std::string&>()));
     }
     if (j.contains("evseId")) {
         k.evseId.emplace(j.at("evseId"));
@@ -60,6 +64,49 @@ void from_json(const json& j, ReserveNowRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ReserveNowRequest
+const JsonSaxFields& json_sax_fields(const ReserveNowRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ReserveNowRequest::id>("id"),
+        json_sax_field<&ReserveNowRequest::expiryDateTime>("expiryDateTime"),
+        json_sax_field<&ReserveNowRequest::idToken>("idToken"),
+        json_sax_field<&ReserveNowRequest::customData>("customData"),
+        json_sax_field<&ReserveNowRequest::connectorType, conversions::string_to_connector_enum>("connectorType"),
+        json_sax_field<&ReserveNowRequest::evseId>("evseId"),
+        json_sax_field<&ReserveNowRequest::groupIdToken>("groupIdToken"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ReserveNowRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ReserveNowRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.connectorType) {
+        writer.key("connectorType");
+        writer.value(conversions::connector_enum_to_string(k.connectorType.value()));
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.evseId) {
+        writer.key("evseId");
+        writer.value(k.evseId.value());
+    }
+    writer.key("expiryDateTime");
+    writer.value(k.expiryDateTime);
+    if (k.groupIdToken) {
+        writer.key("groupIdToken");
+        write_json(writer, k.groupIdToken.value());
+    }
+    writer.key("id");
+    writer.value(k.id);
+    writer.key("idToken");
+    write_json(writer, k.idToken);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ReserveNowRequest \p k to the given output stream \p os
 /// \returns an output stream with the ReserveNowRequest written to
 std::ostream& operator<<(std::ostream& os, const ReserveNowRequest& k) {
@@ -87,7 +134,7 @@ void to_json(json& j, const ReserveNowResponse& k) {
 
 void from_json(const json& j, ReserveNowResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_reserve_now_status_enum(j.at("status"));
+    k.status = conversions::string_to_reserve_now_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -98,6 +145,33 @@ void from_json(const json& j, ReserveNowResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ReserveNowResponse
+const JsonSaxFields& json_sax_fields(const ReserveNowResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ReserveNowResponse::status, conversions::string_to_reserve_now_status_enum>("status"),
+        json_sax_field<&ReserveNowResponse::customData>("customData"),
+        json_sax_field<&ReserveNowResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ReserveNowResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ReserveNowResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::reserve_now_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ReserveNowResponse \p k to the given output stream \p os
 /// \returns an output stream with the ReserveNowResponse written to
 std::ostream& operator<<(std::ostream& os, const ReserveNowResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -33,7 +36,7 @@ void to_json(json& j, const ResetRequest& k) {
 
 void from_json(const json& j, ResetRequest& k) {
     // the required parts of the message
-    k.type = conversions::string_to_reset_enum(j.at("type"));
+    k.type = conversions::string_to_reset_enum(j.at("type").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -44,6 +47,33 @@ void from_json(const json& j, ResetRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ResetRequest
+const JsonSaxFields& json_sax_fields(const ResetRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ResetRequest::type, conversions::string_to_reset_enum>("type"),
+        json_sax_field<&ResetRequest::customData>("customData"),
+        json_sax_field<&ResetRequest::evseId>("evseId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ResetRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ResetRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.evseId) {
+        writer.key("evseId");
+        writer.value(k.evseId.value());
+    }
+    writer.key("type");
+    writer.value(conversions::reset_enum_to_string(k.type));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ResetRequest \p k to the given output stream \p os
 /// \returns an output stream with the ResetRequest written to
 std::ostream& operator<<(std::ostream& os, const ResetRequest& k) {
@@ -71,7 +101,7 @@ void to_json(json& j, const ResetResponse& k) {
 
 void from_json(const json& j, ResetResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_reset_status_enum(j.at("status"));
+    k.status = conversions::string_to_reset_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -82,6 +112,33 @@ void from_json(const json& j, ResetResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ResetResponse
+const JsonSaxFields& json_sax_fields(const ResetResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ResetResponse::status, conversions::string_to_reset_status_enum>("status"),
+        json_sax_field<&ResetResponse::customData>("customData"),
+        json_sax_field<&ResetResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ResetResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ResetResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::reset_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given ResetResponse \p k to the given output stream \p os
 /// \returns an output stream with the ResetResponse written to
 std::ostream& operator<<(std::ostream& os, const ResetResponse& k) {
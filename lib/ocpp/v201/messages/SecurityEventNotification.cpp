@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -46,6 +49,36 @@ void from_json(const json& j, SecurityEventNotificationRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SecurityEventNotificationRequest
+const JsonSaxFields& json_sax_fields(const SecurityEventNotificationRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SecurityEventNotificationRequest::type>("type"),
+        json_sax_field<&SecurityEventNotificationRequest::timestamp>("timestamp"),
+        json_sax_field<&SecurityEventNotificationRequest::customData>("customData"),
+        json_sax_field<&SecurityEventNotificationRequest::techInfo>("techInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SecurityEventNotificationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SecurityEventNotificationRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.techInfo) {
+        writer.key("techInfo");
+        writer.value(k.techInfo.value().view());
+    }
+    writer.key("timestamp");
+    writer.value(k.timestamp);
+    writer.key("type");
+    writer.value(k.type.view());
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SecurityEventNotificationRequest \p k to the given output
 /// stream \p os \returns an output stream with the SecurityEventNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const SecurityEventNotificationRequest& k) {
@@ -75,6 +108,26 @@ void from_json(const json& j, SecurityEventNotificationResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SecurityEventNotificationResponse
+const JsonSaxFields& json_sax_fields(const SecurityEventNotificationResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SecurityEventNotificationResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SecurityEventNotificationResponse \p k to \p writer, the output is the same as
+/// json(k).dump()
+void write_json(JsonWriter& writer, const SecurityEventNotificationResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SecurityEventNotificationResponse \p k to the given output
 /// stream \p os \returns an output stream with the SecurityEventNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const SecurityEventNotificationResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -38,7 +41,7 @@ void to_json(json& j, const SendLocalListRequest& k) {
 void from_json(const json& j, SendLocalListRequest& k) {
     // the required parts of the message
     k.versionNumber = j.at("versionNumber");
-    k.updateType = conversions::string_to_update_enum(j.at("updateType"));
+    k.updateType = conversions::string_to_update_enum(j.at("updateType").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -54,6 +57,40 @@ void from_json(const json& j, SendLocalListRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SendLocalListRequest
+const JsonSaxFields& json_sax_fields(const SendLocalListRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SendLocalListRequest::versionNumber>("versionNumber"),
+        json_sax_field<&SendLocalListRequest::updateType, conversions::string_to_update_enum>("updateType"),
+        json_sax_field<&SendLocalListRequest::customData>("customData"),
+        json_sax_field<&SendLocalListRequest::localAuthorizationList>("localAuthorizationList"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SendLocalListRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SendLocalListRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.localAuthorizationList) {
+        writer.key("localAuthorizationList");
+        writer.begin_array();
+        for (const auto& val : k.localAuthorizationList.value()) {
+            write_json(writer, val);
+        }
+        writer.end_array();
+    }
+    writer.key("updateType");
+    writer.value(conversions::update_enum_to_string(k.updateType));
+    writer.key("versionNumber");
+    writer.value(k.versionNumber);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SendLocalListRequest \p k to the given output stream \p os
 /// \returns an output stream with the SendLocalListRequest written to
 std::ostream& operator<<(std::ostream& os, const SendLocalListRequest& k) {
@@ -81,7 +118,7 @@ void to_json(json& j, const SendLocalListResponse& k) {
 
 void from_json(const json& j, SendLocalListResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_send_local_list_status_enum(j.at("status"));
+    k.status = conversions::string_to_send_local_list_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -92,6 +129,33 @@ void from_json(const json& j, SendLocalListResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SendLocalListResponse
+const JsonSaxFields& json_sax_fields(const SendLocalListResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SendLocalListResponse::status, conversions::string_to_send_local_list_status_enum>("status"),
+        json_sax_field<&SendLocalListResponse::customData>("customData"),
+        json_sax_field<&SendLocalListResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SendLocalListResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SendLocalListResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::send_local_list_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SendLocalListResponse \p k to the given output stream \p os
 /// \returns an output stream with the SendLocalListResponse written to
 std::ostream& operator<<(std::ostream& os, const SendLocalListResponse& k) {
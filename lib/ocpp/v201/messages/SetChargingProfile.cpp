@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -40,6 +43,31 @@ void from_json(const json& j, SetChargingProfileRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetChargingProfileRequest
+const JsonSaxFields& json_sax_fields(const SetChargingProfileRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetChargingProfileRequest::evseId>("evseId"),
+        json_sax_field<&SetChargingProfileRequest::chargingProfile>("chargingProfile"),
+        json_sax_field<&SetChargingProfileRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetChargingProfileRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetChargingProfileRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("chargingProfile");
+    write_json(writer, k.chargingProfile);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("evseId");
+    writer.value(k.evseId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetChargingProfileRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetChargingProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const SetChargingProfileRequest& k) {
@@ -67,7 +95,7 @@ void to_json(json& j, const SetChargingProfileResponse& k) {
 
 void from_json(const json& j, SetChargingProfileResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_charging_profile_status_enum(j.at("status"));
+    k.status = conversions::string_to_charging_profile_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -78,6 +106,34 @@ void from_json(const json& j, SetChargingProfileResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetChargingProfileResponse
+const JsonSaxFields& json_sax_fields(const SetChargingProfileResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetChargingProfileResponse::status,
+                       conversions::string_to_charging_profile_status_enum>("status"),
+        json_sax_field<&SetChargingProfileResponse::customData>("customData"),
+        json_sax_field<&SetChargingProfileResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetChargingProfileResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetChargingProfileResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::charging_profile_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetChargingProfileResponse \p k to the given output stream \p
 /// os \returns an output stream with the SetChargingProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const SetChargingProfileResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -38,6 +41,28 @@ void from_json(const json& j, SetDisplayMessageRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetDisplayMessageRequest
+const JsonSaxFields& json_sax_fields(const SetDisplayMessageRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetDisplayMessageRequest::message>("message"),
+        json_sax_field<&SetDisplayMessageRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetDisplayMessageRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetDisplayMessageRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("message");
+    write_json(writer, k.message);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetDisplayMessageRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetDisplayMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const SetDisplayMessageRequest& k) {
@@ -65,7 +90,7 @@ void to_json(json& j, const SetDisplayMessageResponse& k) {
 
 void from_json(const json& j, SetDisplayMessageResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_display_message_status_enum(j.at("status"));
+    k.status = conversions::string_to_display_message_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -76,6 +101,34 @@ void from_json(const json& j, SetDisplayMessageResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetDisplayMessageResponse
+const JsonSaxFields& json_sax_fields(const SetDisplayMessageResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetDisplayMessageResponse::status,
+                       conversions::string_to_display_message_status_enum>("status"),
+        json_sax_field<&SetDisplayMessageResponse::customData>("customData"),
+        json_sax_field<&SetDisplayMessageResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetDisplayMessageResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetDisplayMessageResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::display_message_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetDisplayMessageResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetDisplayMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const SetDisplayMessageResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -30,7 +33,8 @@ void to_json(json& j, const SetMonitoringBaseRequest& k) {
 
 void from_json(const json& j, SetMonitoringBaseRequest& k) {
     // the required parts of the message
-    k.monitoringBase = conversions::string_to_monitoring_base_enum(j.at("monitoringBase"));
+    k.monitoringBase =
+        conversions::string_to_monitoring_base_enum(j.at("monitoringBase").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -38,6 +42,29 @@ void from_json(const json& j, SetMonitoringBaseRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetMonitoringBaseRequest
+const JsonSaxFields& json_sax_fields(const SetMonitoringBaseRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetMonitoringBaseRequest::monitoringBase,
+                       conversions::string_to_monitoring_base_enum>("monitoringBase"),
+        json_sax_field<&SetMonitoringBaseRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetMonitoringBaseRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetMonitoringBaseRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("monitoringBase");
+    writer.value(conversions::monitoring_base_enum_to_string(k.monitoringBase));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetMonitoringBaseRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringBaseRequest written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringBaseRequest& k) {
@@ -65,7 +92,7 @@ void to_json(json& j, const SetMonitoringBaseResponse& k) {
 
 void from_json(const json& j, SetMonitoringBaseResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_device_model_status_enum(j.at("status"));
+    k.status = conversions::string_to_generic_device_model_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -76,6 +103,34 @@ void from_json(const json& j, SetMonitoringBaseResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetMonitoringBaseResponse
+const JsonSaxFields& json_sax_fields(const SetMonitoringBaseResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetMonitoringBaseResponse::status,
+                       conversions::string_to_generic_device_model_status_enum>("status"),
+        json_sax_field<&SetMonitoringBaseResponse::customData>("customData"),
+        json_sax_field<&SetMonitoringBaseResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetMonitoringBaseResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetMonitoringBaseResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::generic_device_model_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetMonitoringBaseResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringBaseResponse written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringBaseResponse& k) {
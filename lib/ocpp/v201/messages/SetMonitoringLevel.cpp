@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -38,6 +41,28 @@ void from_json(const json& j, SetMonitoringLevelRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetMonitoringLevelRequest
+const JsonSaxFields& json_sax_fields(const SetMonitoringLevelRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetMonitoringLevelRequest::severity>("severity"),
+        json_sax_field<&SetMonitoringLevelRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetMonitoringLevelRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetMonitoringLevelRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("severity");
+    writer.value(k.severity);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetMonitoringLevelRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringLevelRequest written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringLevelRequest& k) {
@@ -65,7 +90,7 @@ void to_json(json& j, const SetMonitoringLevelResponse& k) {
 
 void from_json(const json& j, SetMonitoringLevelResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_status_enum(j.at("status"));
+    k.status = conversions::string_to_generic_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -76,6 +101,33 @@ void from_json(const json& j, SetMonitoringLevelResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetMonitoringLevelResponse
+const JsonSaxFields& json_sax_fields(const SetMonitoringLevelResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetMonitoringLevelResponse::status, conversions::string_to_generic_status_enum>("status"),
+        json_sax_field<&SetMonitoringLevelResponse::customData>("customData"),
+        json_sax_field<&SetMonitoringLevelResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetMonitoringLevelResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetMonitoringLevelResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::generic_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetMonitoringLevelResponse \p k to the given output stream \p
 /// os \returns an output stream with the SetMonitoringLevelResponse written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringLevelResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -40,6 +43,31 @@ void from_json(const json& j, SetNetworkProfileRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetNetworkProfileRequest
+const JsonSaxFields& json_sax_fields(const SetNetworkProfileRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetNetworkProfileRequest::configurationSlot>("configurationSlot"),
+        json_sax_field<&SetNetworkProfileRequest::connectionData>("connectionData"),
+        json_sax_field<&SetNetworkProfileRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetNetworkProfileRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetNetworkProfileRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("configurationSlot");
+    writer.value(k.configurationSlot);
+    writer.key("connectionData");
+    write_json(writer, k.connectionData);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetNetworkProfileRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetNetworkProfileRequest written to
 std::ostream& operator<<(std::ostream& os, const SetNetworkProfileRequest& k) {
@@ -67,7 +95,7 @@ void to_json(json& j, const SetNetworkProfileResponse& k) {
 
 void from_json(const json& j, SetNetworkProfileResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_set_network_profile_status_enum(j.at("status"));
+    k.status = conversions::string_to_set_network_profile_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -78,6 +106,34 @@ void from_json(const json& j, SetNetworkProfileResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetNetworkProfileResponse
+const JsonSaxFields& json_sax_fields(const SetNetworkProfileResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetNetworkProfileResponse::status,
+                       conversions::string_to_set_network_profile_status_enum>("status"),
+        json_sax_field<&SetNetworkProfileResponse::customData>("customData"),
+        json_sax_field<&SetNetworkProfileResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetNetworkProfileResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetNetworkProfileResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::set_network_profile_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetNetworkProfileResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetNetworkProfileResponse written to
 std::ostream& operator<<(std::ostream& os, const SetNetworkProfileResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -40,6 +43,32 @@ void from_json(const json& j, SetVariableMonitoringRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetVariableMonitoringRequest
+const JsonSaxFields& json_sax_fields(const SetVariableMonitoringRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetVariableMonitoringRequest::setMonitoringData>("setMonitoringData"),
+        json_sax_field<&SetVariableMonitoringRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetVariableMonitoringRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetVariableMonitoringRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("setMonitoringData");
+    writer.begin_array();
+    for (const auto& val : k.setMonitoringData) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetVariableMonitoringRequest \p k to the given output stream \p
 /// os \returns an output stream with the SetVariableMonitoringRequest written to
 std::ostream& operator<<(std::ostream& os, const SetVariableMonitoringRequest& k) {
@@ -74,6 +103,32 @@ void from_json(const json& j, SetVariableMonitoringResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetVariableMonitoringResponse
+const JsonSaxFields& json_sax_fields(const SetVariableMonitoringResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetVariableMonitoringResponse::setMonitoringResult>("setMonitoringResult"),
+        json_sax_field<&SetVariableMonitoringResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetVariableMonitoringResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetVariableMonitoringResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("setMonitoringResult");
+    writer.begin_array();
+    for (const auto& val : k.setMonitoringResult) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetVariableMonitoringResponse \p k to the given output stream
 /// \p os \returns an output stream with the SetVariableMonitoringResponse written to
 std::ostream& operator<<(std::ostream& os, const SetVariableMonitoringResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -40,6 +43,32 @@ void from_json(const json& j, SetVariablesRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetVariablesRequest
+const JsonSaxFields& json_sax_fields(const SetVariablesRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetVariablesRequest::setVariableData>("setVariableData"),
+        json_sax_field<&SetVariablesRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetVariablesRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetVariablesRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("setVariableData");
+    writer.begin_array();
+    for (const auto& val : k.setVariableData) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetVariablesRequest \p k to the given output stream \p os
 /// \returns an output stream with the SetVariablesRequest written to
 std::ostream& operator<<(std::ostream& os, const SetVariablesRequest& k) {
@@ -74,6 +103,32 @@ void from_json(const json& j, SetVariablesResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetVariablesResponse
+const JsonSaxFields& json_sax_fields(const SetVariablesResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetVariablesResponse::setVariableResult>("setVariableResult"),
+        json_sax_field<&SetVariablesResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetVariablesResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetVariablesResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("setVariableResult");
+    writer.begin_array();
+    for (const auto& val : k.setVariableResult) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SetVariablesResponse \p k to the given output stream \p os
 /// \returns an output stream with the SetVariablesResponse written to
 std::ostream& operator<<(std::ostream& os, const SetVariablesResponse& k) {
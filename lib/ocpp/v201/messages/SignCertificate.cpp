@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -40,8 +43,37 @@ void from_json(const json& j, SignCertificateRequest& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("certificateType")) {
-        k.certificateType.emplace(conversions::string_to_certificate_signing_use_enum(j.at("certificateType")));
+        k.certificateType.emplace(
+            conversions::string_to_certificate_signing_use_enum(j.at("certificateType").get_ref<const std::string&>()));
+    }
+}
+
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SignCertificateRequest
+const JsonSaxFields& json_sax_fields(const SignCertificateRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SignCertificateRequest::csr>("csr"),
+        json_sax_field<&SignCertificateRequest::customData>("customData"),
+        json_sax_field<&SignCertificateRequest::certificateType,
+                       conversions::string_to_certificate_signing_use_enum>("certificateType"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SignCertificateRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SignCertificateRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.certificateType) {
+        writer.key("certificateType");
+        writer.value(conversions::certificate_signing_use_enum_to_string(k.certificateType.value()));
+    }
+    writer.key("csr");
+    writer.value(k.csr.view());
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
     }
+    writer.end_object();
 }
 
 /// \brief Writes the string representation of the given SignCertificateRequest \p k to the given output stream \p os
@@ -71,7 +103,7 @@ void to_json(json& j, const SignCertificateResponse& k) {
 
 void from_json(const json& j, SignCertificateResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_status_enum(j.at("status"));
+    k.status = conversions::string_to_generic_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -82,6 +114,33 @@ void from_json(const json& j, SignCertificateResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SignCertificateResponse
+const JsonSaxFields& json_sax_fields(const SignCertificateResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SignCertificateResponse::status, conversions::string_to_generic_status_enum>("status"),
+        json_sax_field<&SignCertificateResponse::customData>("customData"),
+        json_sax_field<&SignCertificateResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SignCertificateResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SignCertificateResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::generic_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given SignCertificateResponse \p k to the given output stream \p os
 /// \returns an output stream with the SignCertificateResponse written to
 std::ostream& operator<<(std::ostream& os, const SignCertificateResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -34,7 +37,8 @@ void to_json(json& j, const StatusNotificationRequest& k) {
 void from_json(const json& j, StatusNotificationRequest& k) {
     // the required parts of the message
     k.timestamp = ocpp::DateTime(std::string(j.at("timestamp")));
-    k.connectorStatus = conversions::string_to_connector_status_enum(j.at("connectorStatus"));
+    k.connectorStatus =
+        conversions::string_to_connector_status_enum(j.at("connectorStatus").get_ref<const std::string&>());
     k.evseId = j.at("evseId");
     k.connectorId = j.at("connectorId");
 
@@ -44,6 +48,38 @@ void from_json(const json& j, StatusNotificationRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a StatusNotificationRequest
+const JsonSaxFields& json_sax_fields(const StatusNotificationRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&StatusNotificationRequest::timestamp>("timestamp"),
+        json_sax_field<&StatusNotificationRequest::connectorStatus,
+                       conversions::string_to_connector_status_enum>("connectorStatus"),
+        json_sax_field<&StatusNotificationRequest::evseId>("evseId"),
+        json_sax_field<&StatusNotificationRequest::connectorId>("connectorId"),
+        json_sax_field<&StatusNotificationRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given StatusNotificationRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const StatusNotificationRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("connectorId");
+    writer.value(k.connectorId);
+    writer.key("connectorStatus");
+    writer.value(conversions::connector_status_enum_to_string(k.connectorStatus));
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("evseId");
+    writer.value(k.evseId);
+    writer.key("timestamp");
+    writer.value(k.timestamp);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given StatusNotificationRequest \p k to the given output stream \p os
 /// \returns an output stream with the StatusNotificationRequest written to
 std::ostream& operator<<(std::ostream& os, const StatusNotificationRequest& k) {
@@ -73,6 +109,25 @@ void from_json(const json& j, StatusNotificationResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a StatusNotificationResponse
+const JsonSaxFields& json_sax_fields(const StatusNotificationResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&StatusNotificationResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given StatusNotificationResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const StatusNotificationResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given StatusNotificationResponse \p k to the given output stream \p
 /// os \returns an output stream with the StatusNotificationResponse written to
 std::ostream& operator<<(std::ostream& os, const StatusNotificationResponse& k) {
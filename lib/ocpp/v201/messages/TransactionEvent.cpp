@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -58,9 +61,9 @@ void to_json(json& j, const TransactionEventRequest& k) {
 
 void from_json(const json& j, TransactionEventRequest& k) {
     // the required parts of the message
-    k.eventType = conversions::string_to_transaction_event_enum(j.at("eventType"));
+    k.eventType = conversions::string_to_transaction_event_enum(j.at("eventType").get_ref<const std::string&>());
     k.timestamp = ocpp::DateTime(std::string(j.at("timestamp")));
-    k.triggerReason = conversions::string_to_trigger_reason_enum(j.at("triggerReason"));
+    k.triggerReason = conversions::string_to_trigger_reason_enum(j.at("triggerReason").get_ref<const std::string&>());
     k.seqNo = j.at("seqNo");
     k.transactionInfo = j.at("transactionInfo");
 
@@ -96,6 +99,80 @@ void from_json(const json& j, TransactionEventRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a TransactionEventRequest
+const JsonSaxFields& json_sax_fields(const TransactionEventRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&TransactionEventRequest::eventType, conversions::string_to_transaction_event_enum>("eventType"),
+        json_sax_field<&TransactionEventRequest::timestamp>("timestamp"),
+        json_sax_field<&TransactionEventRequest::triggerReason,
+                       conversions::string_to_trigger_reason_enum>("triggerReason"),
+        json_sax_field<&TransactionEventRequest::seqNo>("seqNo"),
+        json_sax_field<&TransactionEventRequest::transactionInfo>("transactionInfo"),
+        json_sax_field<&TransactionEventRequest::customData>("customData"),
+        json_sax_field<&TransactionEventRequest::meterValue>("meterValue"),
+        json_sax_field<&TransactionEventRequest::offline>("offline"),
+        json_sax_field<&TransactionEventRequest::numberOfPhasesUsed>("numberOfPhasesUsed"),
+        json_sax_field<&TransactionEventRequest::cableMaxCurrent>("cableMaxCurrent"),
+        json_sax_field<&TransactionEventRequest::reservationId>("reservationId"),
+        json_sax_field<&TransactionEventRequest::evse>("evse"),
+        json_sax_field<&TransactionEventRequest::idToken>("idToken"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given TransactionEventRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const TransactionEventRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.cableMaxCurrent) {
+        writer.key("cableMaxCurrent");
+        writer.value(k.cableMaxCurrent.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("eventType");
+    writer.value(conversions::transaction_event_enum_to_string(k.eventType));
+    if (k.evse) {
+        writer.key("evse");
+        write_json(writer, k.evse.value());
+    }
+    if (k.idToken) {
+        writer.key("idToken");
+        write_json(writer, k.idToken.value());
+    }
+    if (k.meterValue) {
+        writer.key("meterValue");
+        writer.begin_array();
+        for (const auto& val : k.meterValue.value()) {
+            write_json(writer, val);
+        }
+        writer.end_array();
+    }
+    if (k.numberOfPhasesUsed) {
+        writer.key("numberOfPhasesUsed");
+        writer.value(k.numberOfPhasesUsed.value());
+    }
+    if (k.offline) {
+        writer.key("offline");
+        writer.value(k.offline.value());
+    }
+    if (k.reservationId) {
+        writer.key("reservationId");
+        writer.value(k.reservationId.value());
+    }
+    writer.key("seqNo");
+    writer.value(k.seqNo);
+    writer.key("timestamp");
+    writer.value(k.timestamp);
+    writer.key("transactionInfo");
+    write_json(writer, k.transactionInfo);
+    writer.key("triggerReason");
+    writer.value(conversions::trigger_reason_enum_to_string(k.triggerReason));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given TransactionEventRequest \p k to the given output stream \p os
 /// \returns an output stream with the TransactionEventRequest written to
 std::ostream& operator<<(std::ostream& os, const TransactionEventRequest& k) {
@@ -149,6 +226,45 @@ void from_json(const json& j, TransactionEventResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a TransactionEventResponse
+const JsonSaxFields& json_sax_fields(const TransactionEventResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&TransactionEventResponse::customData>("customData"),
+        json_sax_field<&TransactionEventResponse::totalCost>("totalCost"),
+        json_sax_field<&TransactionEventResponse::chargingPriority>("chargingPriority"),
+        json_sax_field<&TransactionEventResponse::idTokenInfo>("idTokenInfo"),
+        json_sax_field<&TransactionEventResponse::updatedPersonalMessage>("updatedPersonalMessage"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given TransactionEventResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const TransactionEventResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.chargingPriority) {
+        writer.key("chargingPriority");
+        writer.value(k.chargingPriority.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.idTokenInfo) {
+        writer.key("idTokenInfo");
+        write_json(writer, k.idTokenInfo.value());
+    }
+    if (k.totalCost) {
+        writer.key("totalCost");
+        writer.value(k.totalCost.value());
+    }
+    if (k.updatedPersonalMessage) {
+        writer.key("updatedPersonalMessage");
+        write_json(writer, k.updatedPersonalMessage.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given TransactionEventResponse \p k to the given output stream \p os
 /// \returns an output stream with the TransactionEventResponse written to
 std::ostream& operator<<(std::ostream& os, const TransactionEventResponse& k) {
@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -33,7 +36,8 @@ void to_json(json& j, const TriggerMessageRequest& k) {
 
 void from_json(const json& j, TriggerMessageRequest& k) {
     // the required parts of the message
-    k.requestedMessage = conversions::string_to_message_trigger_enum(j.at("requestedMessage"));
+    k.requestedMessage =
+        conversions::string_to_message_trigger_enum(j.at("requestedMessage").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -44,6 +48,34 @@ void from_json(const json& j, TriggerMessageRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a TriggerMessageRequest
+const JsonSaxFields& json_sax_fields(const TriggerMessageRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&TriggerMessageRequest::requestedMessage,
+                       conversions::string_to_message_trigger_enum>("requestedMessage"),
+        json_sax_field<&TriggerMessageRequest::customData>("customData"),
+        json_sax_field<&TriggerMessageRequest::evse>("evse"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given TriggerMessageRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const TriggerMessageRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.evse) {
+        writer.key("evse");
+        write_json(writer, k.evse.value());
+    }
+    writer.key("requestedMessage");
+    writer.value(conversions::message_trigger_enum_to_string(k.requestedMessage));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given TriggerMessageRequest \p k to the given output stream \p os
 /// \returns an output stream with the TriggerMessageRequest written to
 std::ostream& operator<<(std::ostream& os, const TriggerMessageRequest& k) {
@@ -71,7 +103,7 @@ void to_json(json& j, const TriggerMessageResponse& k) {
 
 void from_json(const json& j, TriggerMessageResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_trigger_message_status_enum(j.at("status"));
+    k.status = conversions::string_to_trigger_message_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -82,6 +114,33 @@ void from_json(const json& j, TriggerMessageResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a TriggerMessageResponse
+const JsonSaxFields& json_sax_fields(const TriggerMessageResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&TriggerMessageResponse::status, conversions::string_to_trigger_message_status_enum>("status"),
+        json_sax_field<&TriggerMessageResponse::customData>("customData"),
+        json_sax_field<&TriggerMessageResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given TriggerMessageResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const TriggerMessageResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::trigger_message_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given TriggerMessageResponse \p k to the given output stream \p os
 /// \returns an output stream with the TriggerMessageResponse written to
 std::ostream& operator<<(std::ostream& os, const TriggerMessageResponse& k) {
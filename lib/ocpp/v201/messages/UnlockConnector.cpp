@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -40,6 +43,31 @@ void from_json(const json& j, UnlockConnectorRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a UnlockConnectorRequest
+const JsonSaxFields& json_sax_fields(const UnlockConnectorRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&UnlockConnectorRequest::evseId>("evseId"),
+        json_sax_field<&UnlockConnectorRequest::connectorId>("connectorId"),
+        json_sax_field<&UnlockConnectorRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given UnlockConnectorRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const UnlockConnectorRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("connectorId");
+    writer.value(k.connectorId);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("evseId");
+    writer.value(k.evseId);
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given UnlockConnectorRequest \p k to the given output stream \p os
 /// \returns an output stream with the UnlockConnectorRequest written to
 std::ostream& operator<<(std::ostream& os, const UnlockConnectorRequest& k) {
@@ -67,7 +95,7 @@ void to_json(json& j, const UnlockConnectorResponse& k) {
 
 void from_json(const json& j, UnlockConnectorResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_unlock_status_enum(j.at("status"));
+    k.status = conversions::string_to_unlock_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -78,6 +106,33 @@ void from_json(const json& j, UnlockConnectorResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a UnlockConnectorResponse
+const JsonSaxFields& json_sax_fields(const UnlockConnectorResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&UnlockConnectorResponse::status, conversions::string_to_unlock_status_enum>("status"),
+        json_sax_field<&UnlockConnectorResponse::customData>("customData"),
+        json_sax_field<&UnlockConnectorResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given UnlockConnectorResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const UnlockConnectorResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::unlock_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given UnlockConnectorResponse \p k to the given output stream \p os
 /// \returns an output stream with the UnlockConnectorResponse written to
 std::ostream& operator<<(std::ostream& os, const UnlockConnectorResponse& k) {
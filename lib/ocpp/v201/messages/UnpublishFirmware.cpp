@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -38,6 +41,28 @@ void from_json(const json& j, UnpublishFirmwareRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a UnpublishFirmwareRequest
+const JsonSaxFields& json_sax_fields(const UnpublishFirmwareRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&UnpublishFirmwareRequest::checksum>("checksum"),
+        json_sax_field<&UnpublishFirmwareRequest::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given UnpublishFirmwareRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const UnpublishFirmwareRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("checksum");
+    writer.value(k.checksum.view());
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given UnpublishFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the UnpublishFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const UnpublishFirmwareRequest& k) {
@@ -62,7 +87,7 @@ void to_json(json& j, const UnpublishFirmwareResponse& k) {
 
 void from_json(const json& j, UnpublishFirmwareResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_unpublish_firmware_status_enum(j.at("status"));
+    k.status = conversions::string_to_unpublish_firmware_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -70,6 +95,29 @@ void from_json(const json& j, UnpublishFirmwareResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a UnpublishFirmwareResponse
+const JsonSaxFields& json_sax_fields(const UnpublishFirmwareResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&UnpublishFirmwareResponse::status,
+                       conversions::string_to_unpublish_firmware_status_enum>("status"),
+        json_sax_field<&UnpublishFirmwareResponse::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given UnpublishFirmwareResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const UnpublishFirmwareResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::unpublish_firmware_status_enum_to_string(k.status));
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given UnpublishFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the UnpublishFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const UnpublishFirmwareResponse& k) {
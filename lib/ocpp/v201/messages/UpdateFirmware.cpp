@@ -8,6 +8,9 @@
 #include <ostream>
 #include <string>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
+
 using json = nlohmann::json;
 
 namespace ocpp {
@@ -52,6 +55,41 @@ void from_json(const json& j, UpdateFirmwareRequest& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a UpdateFirmwareRequest
+const JsonSaxFields& json_sax_fields(const UpdateFirmwareRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&UpdateFirmwareRequest::requestId>("requestId"),
+        json_sax_field<&UpdateFirmwareRequest::firmware>("firmware"),
+        json_sax_field<&UpdateFirmwareRequest::customData>("customData"),
+        json_sax_field<&UpdateFirmwareRequest::retries>("retries"),
+        json_sax_field<&UpdateFirmwareRequest::retryInterval>("retryInterval"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given UpdateFirmwareRequest \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const UpdateFirmwareRequest& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("firmware");
+    write_json(writer, k.firmware);
+    writer.key("requestId");
+    writer.value(k.requestId);
+    if (k.retries) {
+        writer.key("retries");
+        writer.value(k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.key("retryInterval");
+        writer.value(k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given UpdateFirmwareRequest \p k to the given output stream \p os
 /// \returns an output stream with the UpdateFirmwareRequest written to
 std::ostream& operator<<(std::ostream& os, const UpdateFirmwareRequest& k) {
@@ -79,7 +117,7 @@ void to_json(json& j, const UpdateFirmwareResponse& k) {
 
 void from_json(const json& j, UpdateFirmwareResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_update_firmware_status_enum(j.at("status"));
+    k.status = conversions::string_to_update_firmware_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -90,6 +128,33 @@ void from_json(const json& j, UpdateFirmwareResponse& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a UpdateFirmwareResponse
+const JsonSaxFields& json_sax_fields(const UpdateFirmwareResponse*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&UpdateFirmwareResponse::status, conversions::string_to_update_firmware_status_enum>("status"),
+        json_sax_field<&UpdateFirmwareResponse::customData>("customData"),
+        json_sax_field<&UpdateFirmwareResponse::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given UpdateFirmwareResponse \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const UpdateFirmwareResponse& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("status");
+    writer.value(conversions::update_firmware_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Writes the string representation of the given UpdateFirmwareResponse \p k to the given output stream \p os
 /// \returns an output stream with the UpdateFirmwareResponse written to
 std::ostream& operator<<(std::ostream& os, const UpdateFirmwareResponse& k) {
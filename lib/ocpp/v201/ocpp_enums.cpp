@@ -5,6 +5,7 @@
 #include <ocpp/v201/ocpp_enums.hpp>
 
 #include <string>
+#include <string_view>
 
 #include <ocpp/common/types.hpp>
 
@@ -36,30 +37,42 @@ std::string id_token_enum_to_string(IdTokenEnum e) {
     throw EnumToStringException{e, "IdTokenEnum"};
 }
 
-IdTokenEnum string_to_id_token_enum(const std::string& s) {
-    if (s == "Central") {
-        return IdTokenEnum::Central;
-    }
-    if (s == "eMAID") {
-        return IdTokenEnum::eMAID;
-    }
-    if (s == "ISO14443") {
-        return IdTokenEnum::ISO14443;
-    }
-    if (s == "ISO15693") {
-        return IdTokenEnum::ISO15693;
-    }
-    if (s == "KeyCode") {
-        return IdTokenEnum::KeyCode;
-    }
-    if (s == "Local") {
-        return IdTokenEnum::Local;
-    }
-    if (s == "MacAddress") {
-        return IdTokenEnum::MacAddress;
-    }
-    if (s == "NoAuthorization") {
-        return IdTokenEnum::NoAuthorization;
+IdTokenEnum string_to_id_token_enum(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "eMAID") {
+            return IdTokenEnum::eMAID;
+        }
+        if (s == "Local") {
+            return IdTokenEnum::Local;
+        }
+        break;
+    case 7:
+        if (s == "Central") {
+            return IdTokenEnum::Central;
+        }
+        if (s == "KeyCode") {
+            return IdTokenEnum::KeyCode;
+        }
+        break;
+    case 8:
+        if (s == "ISO14443") {
+            return IdTokenEnum::ISO14443;
+        }
+        if (s == "ISO15693") {
+            return IdTokenEnum::ISO15693;
+        }
+        break;
+    case 10:
+        if (s == "MacAddress") {
+            return IdTokenEnum::MacAddress;
+        }
+        break;
+    case 15:
+        if (s == "NoAuthorization") {
+            return IdTokenEnum::NoAuthorization;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "IdTokenEnum"};
@@ -86,15 +99,19 @@ std::string hash_algorithm_enum_to_string(HashAlgorithmEnum e) {
     throw EnumToStringException{e, "HashAlgorithmEnum"};
 }
 
-HashAlgorithmEnum string_to_hash_algorithm_enum(const std::string& s) {
-    if (s == "SHA256") {
-        return HashAlgorithmEnum::SHA256;
-    }
-    if (s == "SHA384") {
-        return HashAlgorithmEnum::SHA384;
-    }
-    if (s == "SHA512") {
-        return HashAlgorithmEnum::SHA512;
+HashAlgorithmEnum string_to_hash_algorithm_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "SHA256") {
+            return HashAlgorithmEnum::SHA256;
+        }
+        if (s == "SHA384") {
+            return HashAlgorithmEnum::SHA384;
+        }
+        if (s == "SHA512") {
+            return HashAlgorithmEnum::SHA512;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "HashAlgorithmEnum"};
@@ -135,36 +152,60 @@ std::string authorization_status_enum_to_string(AuthorizationStatusEnum e) {
     throw EnumToStringException{e, "AuthorizationStatusEnum"};
 }
 
-AuthorizationStatusEnum string_to_authorization_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return AuthorizationStatusEnum::Accepted;
-    }
-    if (s == "Blocked") {
-        return AuthorizationStatusEnum::Blocked;
-    }
-    if (s == "ConcurrentTx") {
-        return AuthorizationStatusEnum::ConcurrentTx;
-    }
-    if (s == "Expired") {
-        return AuthorizationStatusEnum::Expired;
-    }
-    if (s == "Invalid") {
-        return AuthorizationStatusEnum::Invalid;
-    }
-    if (s == "NoCredit") {
-        return AuthorizationStatusEnum::NoCredit;
-    }
-    if (s == "NotAllowedTypeEVSE") {
-        return AuthorizationStatusEnum::NotAllowedTypeEVSE;
-    }
-    if (s == "NotAtThisLocation") {
-        return AuthorizationStatusEnum::NotAtThisLocation;
-    }
-    if (s == "NotAtThisTime") {
-        return AuthorizationStatusEnum::NotAtThisTime;
-    }
-    if (s == "Unknown") {
-        return AuthorizationStatusEnum::Unknown;
+AuthorizationStatusEnum string_to_authorization_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        switch (s[0]) {
+        case 'B':
+            if (s == "Blocked") {
+                return AuthorizationStatusEnum::Blocked;
+            }
+            break;
+        case 'E':
+            if (s == "Expired") {
+                return AuthorizationStatusEnum::Expired;
+            }
+            break;
+        case 'I':
+            if (s == "Invalid") {
+                return AuthorizationStatusEnum::Invalid;
+            }
+            break;
+        case 'U':
+            if (s == "Unknown") {
+                return AuthorizationStatusEnum::Unknown;
+            }
+            break;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return AuthorizationStatusEnum::Accepted;
+        }
+        if (s == "NoCredit") {
+            return AuthorizationStatusEnum::NoCredit;
+        }
+        break;
+    case 12:
+        if (s == "ConcurrentTx") {
+            return AuthorizationStatusEnum::ConcurrentTx;
+        }
+        break;
+    case 13:
+        if (s == "NotAtThisTime") {
+            return AuthorizationStatusEnum::NotAtThisTime;
+        }
+        break;
+    case 17:
+        if (s == "NotAtThisLocation") {
+            return AuthorizationStatusEnum::NotAtThisLocation;
+        }
+        break;
+    case 18:
+        if (s == "NotAllowedTypeEVSE") {
+            return AuthorizationStatusEnum::NotAllowedTypeEVSE;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "AuthorizationStatusEnum"};
@@ -193,18 +234,26 @@ std::string message_format_enum_to_string(MessageFormatEnum e) {
     throw EnumToStringException{e, "MessageFormatEnum"};
 }
 
-MessageFormatEnum string_to_message_format_enum(const std::string& s) {
-    if (s == "ASCII") {
-        return MessageFormatEnum::ASCII;
-    }
-    if (s == "HTML") {
-        return MessageFormatEnum::HTML;
-    }
-    if (s == "URI") {
-        return MessageFormatEnum::URI;
-    }
-    if (s == "UTF8") {
-        return MessageFormatEnum::UTF8;
+MessageFormatEnum string_to_message_format_enum(std::string_view s) {
+    switch (s.size()) {
+    case 3:
+        if (s == "URI") {
+            return MessageFormatEnum::URI;
+        }
+        break;
+    case 4:
+        if (s == "HTML") {
+            return MessageFormatEnum::HTML;
+        }
+        if (s == "UTF8") {
+            return MessageFormatEnum::UTF8;
+        }
+        break;
+    case 5:
+        if (s == "ASCII") {
+            return MessageFormatEnum::ASCII;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MessageFormatEnum"};
@@ -239,27 +288,39 @@ std::string authorize_certificate_status_enum_to_string(AuthorizeCertificateStat
     throw EnumToStringException{e, "AuthorizeCertificateStatusEnum"};
 }
 
-AuthorizeCertificateStatusEnum string_to_authorize_certificate_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return AuthorizeCertificateStatusEnum::Accepted;
-    }
-    if (s == "SignatureError") {
-        return AuthorizeCertificateStatusEnum::SignatureError;
-    }
-    if (s == "CertificateExpired") {
-        return AuthorizeCertificateStatusEnum::CertificateExpired;
-    }
-    if (s == "CertificateRevoked") {
-        return AuthorizeCertificateStatusEnum::CertificateRevoked;
-    }
-    if (s == "NoCertificateAvailable") {
-        return AuthorizeCertificateStatusEnum::NoCertificateAvailable;
-    }
-    if (s == "CertChainError") {
-        return AuthorizeCertificateStatusEnum::CertChainError;
-    }
-    if (s == "ContractCancelled") {
-        return AuthorizeCertificateStatusEnum::ContractCancelled;
+AuthorizeCertificateStatusEnum string_to_authorize_certificate_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return AuthorizeCertificateStatusEnum::Accepted;
+        }
+        break;
+    case 14:
+        if (s == "SignatureError") {
+            return AuthorizeCertificateStatusEnum::SignatureError;
+        }
+        if (s == "CertChainError") {
+            return AuthorizeCertificateStatusEnum::CertChainError;
+        }
+        break;
+    case 17:
+        if (s == "ContractCancelled") {
+            return AuthorizeCertificateStatusEnum::ContractCancelled;
+        }
+        break;
+    case 18:
+        if (s == "CertificateExpired") {
+            return AuthorizeCertificateStatusEnum::CertificateExpired;
+        }
+        if (s == "CertificateRevoked") {
+            return AuthorizeCertificateStatusEnum::CertificateRevoked;
+        }
+        break;
+    case 22:
+        if (s == "NoCertificateAvailable") {
+            return AuthorizeCertificateStatusEnum::NoCertificateAvailable;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "AuthorizeCertificateStatusEnum"};
@@ -298,33 +359,49 @@ std::string boot_reason_enum_to_string(BootReasonEnum e) {
     throw EnumToStringException{e, "BootReasonEnum"};
 }
 
-BootReasonEnum string_to_boot_reason_enum(const std::string& s) {
-    if (s == "ApplicationReset") {
-        return BootReasonEnum::ApplicationReset;
-    }
-    if (s == "FirmwareUpdate") {
-        return BootReasonEnum::FirmwareUpdate;
-    }
-    if (s == "LocalReset") {
-        return BootReasonEnum::LocalReset;
-    }
-    if (s == "PowerUp") {
-        return BootReasonEnum::PowerUp;
-    }
-    if (s == "RemoteReset") {
-        return BootReasonEnum::RemoteReset;
-    }
-    if (s == "ScheduledReset") {
-        return BootReasonEnum::ScheduledReset;
-    }
-    if (s == "Triggered") {
-        return BootReasonEnum::Triggered;
-    }
-    if (s == "Unknown") {
-        return BootReasonEnum::Unknown;
-    }
-    if (s == "Watchdog") {
-        return BootReasonEnum::Watchdog;
+BootReasonEnum string_to_boot_reason_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "PowerUp") {
+            return BootReasonEnum::PowerUp;
+        }
+        if (s == "Unknown") {
+            return BootReasonEnum::Unknown;
+        }
+        break;
+    case 8:
+        if (s == "Watchdog") {
+            return BootReasonEnum::Watchdog;
+        }
+        break;
+    case 9:
+        if (s == "Triggered") {
+            return BootReasonEnum::Triggered;
+        }
+        break;
+    case 10:
+        if (s == "LocalReset") {
+            return BootReasonEnum::LocalReset;
+        }
+        break;
+    case 11:
+        if (s == "RemoteReset") {
+            return BootReasonEnum::RemoteReset;
+        }
+        break;
+    case 14:
+        if (s == "FirmwareUpdate") {
+            return BootReasonEnum::FirmwareUpdate;
+        }
+        if (s == "ScheduledReset") {
+            return BootReasonEnum::ScheduledReset;
+        }
+        break;
+    case 16:
+        if (s == "ApplicationReset") {
+            return BootReasonEnum::ApplicationReset;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "BootReasonEnum"};
@@ -351,15 +428,21 @@ std::string registration_status_enum_to_string(RegistrationStatusEnum e) {
     throw EnumToStringException{e, "RegistrationStatusEnum"};
 }
 
-RegistrationStatusEnum string_to_registration_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return RegistrationStatusEnum::Accepted;
-    }
-    if (s == "Pending") {
-        return RegistrationStatusEnum::Pending;
-    }
-    if (s == "Rejected") {
-        return RegistrationStatusEnum::Rejected;
+RegistrationStatusEnum string_to_registration_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Pending") {
+            return RegistrationStatusEnum::Pending;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return RegistrationStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return RegistrationStatusEnum::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "RegistrationStatusEnum"};
@@ -384,12 +467,16 @@ std::string cancel_reservation_status_enum_to_string(CancelReservationStatusEnum
     throw EnumToStringException{e, "CancelReservationStatusEnum"};
 }
 
-CancelReservationStatusEnum string_to_cancel_reservation_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return CancelReservationStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return CancelReservationStatusEnum::Rejected;
+CancelReservationStatusEnum string_to_cancel_reservation_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return CancelReservationStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return CancelReservationStatusEnum::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "CancelReservationStatusEnum"};
@@ -414,12 +501,18 @@ std::string certificate_signing_use_enum_to_string(CertificateSigningUseEnum e)
     throw EnumToStringException{e, "CertificateSigningUseEnum"};
 }
 
-CertificateSigningUseEnum string_to_certificate_signing_use_enum(const std::string& s) {
-    if (s == "ChargingStationCertificate") {
-        return CertificateSigningUseEnum::ChargingStationCertificate;
-    }
-    if (s == "V2GCertificate") {
-        return CertificateSigningUseEnum::V2GCertificate;
+CertificateSigningUseEnum string_to_certificate_signing_use_enum(std::string_view s) {
+    switch (s.size()) {
+    case 14:
+        if (s == "V2GCertificate") {
+            return CertificateSigningUseEnum::V2GCertificate;
+        }
+        break;
+    case 26:
+        if (s == "ChargingStationCertificate") {
+            return CertificateSigningUseEnum::ChargingStationCertificate;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "CertificateSigningUseEnum"};
@@ -444,12 +537,16 @@ std::string certificate_signed_status_enum_to_string(CertificateSignedStatusEnum
     throw EnumToStringException{e, "CertificateSignedStatusEnum"};
 }
 
-CertificateSignedStatusEnum string_to_certificate_signed_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return CertificateSignedStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return CertificateSignedStatusEnum::Rejected;
+CertificateSignedStatusEnum string_to_certificate_signed_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return CertificateSignedStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return CertificateSignedStatusEnum::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "CertificateSignedStatusEnum"};
@@ -474,12 +571,18 @@ std::string operational_status_enum_to_string(OperationalStatusEnum e) {
     throw EnumToStringException{e, "OperationalStatusEnum"};
 }
 
-OperationalStatusEnum string_to_operational_status_enum(const std::string& s) {
-    if (s == "Inoperative") {
-        return OperationalStatusEnum::Inoperative;
-    }
-    if (s == "Operative") {
-        return OperationalStatusEnum::Operative;
+OperationalStatusEnum string_to_operational_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 9:
+        if (s == "Operative") {
+            return OperationalStatusEnum::Operative;
+        }
+        break;
+    case 11:
+        if (s == "Inoperative") {
+            return OperationalStatusEnum::Inoperative;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "OperationalStatusEnum"};
@@ -506,15 +609,21 @@ std::string change_availability_status_enum_to_string(ChangeAvailabilityStatusEn
     throw EnumToStringException{e, "ChangeAvailabilityStatusEnum"};
 }
 
-ChangeAvailabilityStatusEnum string_to_change_availability_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ChangeAvailabilityStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return ChangeAvailabilityStatusEnum::Rejected;
-    }
-    if (s == "Scheduled") {
-        return ChangeAvailabilityStatusEnum::Scheduled;
+ChangeAvailabilityStatusEnum string_to_change_availability_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return ChangeAvailabilityStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return ChangeAvailabilityStatusEnum::Rejected;
+        }
+        break;
+    case 9:
+        if (s == "Scheduled") {
+            return ChangeAvailabilityStatusEnum::Scheduled;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChangeAvailabilityStatusEnum"};
@@ -539,12 +648,16 @@ std::string clear_cache_status_enum_to_string(ClearCacheStatusEnum e) {
     throw EnumToStringException{e, "ClearCacheStatusEnum"};
 }
 
-ClearCacheStatusEnum string_to_clear_cache_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ClearCacheStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return ClearCacheStatusEnum::Rejected;
+ClearCacheStatusEnum string_to_clear_cache_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return ClearCacheStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return ClearCacheStatusEnum::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ClearCacheStatusEnum"};
@@ -573,18 +686,28 @@ std::string charging_profile_purpose_enum_to_string(ChargingProfilePurposeEnum e
     throw EnumToStringException{e, "ChargingProfilePurposeEnum"};
 }
 
-ChargingProfilePurposeEnum string_to_charging_profile_purpose_enum(const std::string& s) {
-    if (s == "ChargingStationExternalConstraints") {
-        return ChargingProfilePurposeEnum::ChargingStationExternalConstraints;
-    }
-    if (s == "ChargingStationMaxProfile") {
-        return ChargingProfilePurposeEnum::ChargingStationMaxProfile;
-    }
-    if (s == "TxDefaultProfile") {
-        return ChargingProfilePurposeEnum::TxDefaultProfile;
-    }
-    if (s == "TxProfile") {
-        return ChargingProfilePurposeEnum::TxProfile;
+ChargingProfilePurposeEnum string_to_charging_profile_purpose_enum(std::string_view s) {
+    switch (s.size()) {
+    case 9:
+        if (s == "TxProfile") {
+            return ChargingProfilePurposeEnum::TxProfile;
+        }
+        break;
+    case 16:
+        if (s == "TxDefaultProfile") {
+            return ChargingProfilePurposeEnum::TxDefaultProfile;
+        }
+        break;
+    case 25:
+        if (s == "ChargingStationMaxProfile") {
+            return ChargingProfilePurposeEnum::ChargingStationMaxProfile;
+        }
+        break;
+    case 34:
+        if (s == "ChargingStationExternalConstraints") {
+            return ChargingProfilePurposeEnum::ChargingStationExternalConstraints;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingProfilePurposeEnum"};
@@ -609,12 +732,18 @@ std::string clear_charging_profile_status_enum_to_string(ClearChargingProfileSta
     throw EnumToStringException{e, "ClearChargingProfileStatusEnum"};
 }
 
-ClearChargingProfileStatusEnum string_to_clear_charging_profile_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ClearChargingProfileStatusEnum::Accepted;
-    }
-    if (s == "Unknown") {
-        return ClearChargingProfileStatusEnum::Unknown;
+ClearChargingProfileStatusEnum string_to_clear_charging_profile_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Unknown") {
+            return ClearChargingProfileStatusEnum::Unknown;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return ClearChargingProfileStatusEnum::Accepted;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ClearChargingProfileStatusEnum"};
@@ -639,12 +768,18 @@ std::string clear_message_status_enum_to_string(ClearMessageStatusEnum e) {
     throw EnumToStringException{e, "ClearMessageStatusEnum"};
 }
 
-ClearMessageStatusEnum string_to_clear_message_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ClearMessageStatusEnum::Accepted;
-    }
-    if (s == "Unknown") {
-        return ClearMessageStatusEnum::Unknown;
+ClearMessageStatusEnum string_to_clear_message_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Unknown") {
+            return ClearMessageStatusEnum::Unknown;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return ClearMessageStatusEnum::Accepted;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ClearMessageStatusEnum"};
@@ -671,15 +806,19 @@ std::string clear_monitoring_status_enum_to_string(ClearMonitoringStatusEnum e)
     throw EnumToStringException{e, "ClearMonitoringStatusEnum"};
 }
 
-ClearMonitoringStatusEnum string_to_clear_monitoring_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ClearMonitoringStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return ClearMonitoringStatusEnum::Rejected;
-    }
-    if (s == "NotFound") {
-        return ClearMonitoringStatusEnum::NotFound;
+ClearMonitoringStatusEnum string_to_clear_monitoring_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return ClearMonitoringStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return ClearMonitoringStatusEnum::Rejected;
+        }
+        if (s == "NotFound") {
+            return ClearMonitoringStatusEnum::NotFound;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ClearMonitoringStatusEnum"};
@@ -708,18 +847,26 @@ std::string charging_limit_source_enum_to_string(ChargingLimitSourceEnum e) {
     throw EnumToStringException{e, "ChargingLimitSourceEnum"};
 }
 
-ChargingLimitSourceEnum string_to_charging_limit_source_enum(const std::string& s) {
-    if (s == "EMS") {
-        return ChargingLimitSourceEnum::EMS;
-    }
-    if (s == "Other") {
-        return ChargingLimitSourceEnum::Other;
-    }
-    if (s == "SO") {
-        return ChargingLimitSourceEnum::SO;
-    }
-    if (s == "CSO") {
-        return ChargingLimitSourceEnum::CSO;
+ChargingLimitSourceEnum string_to_charging_limit_source_enum(std::string_view s) {
+    switch (s.size()) {
+    case 2:
+        if (s == "SO") {
+            return ChargingLimitSourceEnum::SO;
+        }
+        break;
+    case 3:
+        if (s == "EMS") {
+            return ChargingLimitSourceEnum::EMS;
+        }
+        if (s == "CSO") {
+            return ChargingLimitSourceEnum::CSO;
+        }
+        break;
+    case 5:
+        if (s == "Other") {
+            return ChargingLimitSourceEnum::Other;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingLimitSourceEnum"};
@@ -746,15 +893,21 @@ std::string customer_information_status_enum_to_string(CustomerInformationStatus
     throw EnumToStringException{e, "CustomerInformationStatusEnum"};
 }
 
-CustomerInformationStatusEnum string_to_customer_information_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return CustomerInformationStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return CustomerInformationStatusEnum::Rejected;
-    }
-    if (s == "Invalid") {
-        return CustomerInformationStatusEnum::Invalid;
+CustomerInformationStatusEnum string_to_customer_information_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Invalid") {
+            return CustomerInformationStatusEnum::Invalid;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return CustomerInformationStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return CustomerInformationStatusEnum::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "CustomerInformationStatusEnum"};
@@ -783,18 +936,26 @@ std::string data_transfer_status_enum_to_string(DataTransferStatusEnum e) {
     throw EnumToStringException{e, "DataTransferStatusEnum"};
 }
 
-DataTransferStatusEnum string_to_data_transfer_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return DataTransferStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return DataTransferStatusEnum::Rejected;
-    }
-    if (s == "UnknownMessageId") {
-        return DataTransferStatusEnum::UnknownMessageId;
-    }
-    if (s == "UnknownVendorId") {
-        return DataTransferStatusEnum::UnknownVendorId;
+DataTransferStatusEnum string_to_data_transfer_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return DataTransferStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return DataTransferStatusEnum::Rejected;
+        }
+        break;
+    case 15:
+        if (s == "UnknownVendorId") {
+            return DataTransferStatusEnum::UnknownVendorId;
+        }
+        break;
+    case 16:
+        if (s == "UnknownMessageId") {
+            return DataTransferStatusEnum::UnknownMessageId;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "DataTransferStatusEnum"};
@@ -821,15 +982,21 @@ std::string delete_certificate_status_enum_to_string(DeleteCertificateStatusEnum
     throw EnumToStringException{e, "DeleteCertificateStatusEnum"};
 }
 
-DeleteCertificateStatusEnum string_to_delete_certificate_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return DeleteCertificateStatusEnum::Accepted;
-    }
-    if (s == "Failed") {
-        return DeleteCertificateStatusEnum::Failed;
-    }
-    if (s == "NotFound") {
-        return DeleteCertificateStatusEnum::NotFound;
+DeleteCertificateStatusEnum string_to_delete_certificate_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return DeleteCertificateStatusEnum::Failed;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return DeleteCertificateStatusEnum::Accepted;
+        }
+        if (s == "NotFound") {
+            return DeleteCertificateStatusEnum::NotFound;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "DeleteCertificateStatusEnum"};
@@ -878,48 +1045,68 @@ std::string firmware_status_enum_to_string(FirmwareStatusEnum e) {
     throw EnumToStringException{e, "FirmwareStatusEnum"};
 }
 
-FirmwareStatusEnum string_to_firmware_status_enum(const std::string& s) {
-    if (s == "Downloaded") {
-        return FirmwareStatusEnum::Downloaded;
-    }
-    if (s == "DownloadFailed") {
-        return FirmwareStatusEnum::DownloadFailed;
-    }
-    if (s == "Downloading") {
-        return FirmwareStatusEnum::Downloading;
-    }
-    if (s == "DownloadScheduled") {
-        return FirmwareStatusEnum::DownloadScheduled;
-    }
-    if (s == "DownloadPaused") {
-        return FirmwareStatusEnum::DownloadPaused;
-    }
-    if (s == "Idle") {
-        return FirmwareStatusEnum::Idle;
-    }
-    if (s == "InstallationFailed") {
-        return FirmwareStatusEnum::InstallationFailed;
-    }
-    if (s == "Installing") {
-        return FirmwareStatusEnum::Installing;
-    }
-    if (s == "Installed") {
-        return FirmwareStatusEnum::Installed;
-    }
-    if (s == "InstallRebooting") {
-        return FirmwareStatusEnum::InstallRebooting;
-    }
-    if (s == "InstallScheduled") {
-        return FirmwareStatusEnum::InstallScheduled;
-    }
-    if (s == "InstallVerificationFailed") {
-        return FirmwareStatusEnum::InstallVerificationFailed;
-    }
-    if (s == "InvalidSignature") {
-        return FirmwareStatusEnum::InvalidSignature;
-    }
-    if (s == "SignatureVerified") {
-        return FirmwareStatusEnum::SignatureVerified;
+FirmwareStatusEnum string_to_firmware_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return FirmwareStatusEnum::Idle;
+        }
+        break;
+    case 9:
+        if (s == "Installed") {
+            return FirmwareStatusEnum::Installed;
+        }
+        break;
+    case 10:
+        if (s == "Downloaded") {
+            return FirmwareStatusEnum::Downloaded;
+        }
+        if (s == "Installing") {
+            return FirmwareStatusEnum::Installing;
+        }
+        break;
+    case 11:
+        if (s == "Downloading") {
+            return FirmwareStatusEnum::Downloading;
+        }
+        break;
+    case 14:
+        if (s == "DownloadFailed") {
+            return FirmwareStatusEnum::DownloadFailed;
+        }
+        if (s == "DownloadPaused") {
+            return FirmwareStatusEnum::DownloadPaused;
+        }
+        break;
+    case 16:
+        if (s == "InstallRebooting") {
+            return FirmwareStatusEnum::InstallRebooting;
+        }
+        if (s == "InstallScheduled") {
+            return FirmwareStatusEnum::InstallScheduled;
+        }
+        if (s == "InvalidSignature") {
+            return FirmwareStatusEnum::InvalidSignature;
+        }
+        break;
+    case 17:
+        if (s == "DownloadScheduled") {
+            return FirmwareStatusEnum::DownloadScheduled;
+        }
+        if (s == "SignatureVerified") {
+            return FirmwareStatusEnum::SignatureVerified;
+        }
+        break;
+    case 18:
+        if (s == "InstallationFailed") {
+            return FirmwareStatusEnum::InstallationFailed;
+        }
+        break;
+    case 25:
+        if (s == "InstallVerificationFailed") {
+            return FirmwareStatusEnum::InstallVerificationFailed;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "FirmwareStatusEnum"};
@@ -944,12 +1131,18 @@ std::string certificate_action_enum_to_string(CertificateActionEnum e) {
     throw EnumToStringException{e, "CertificateActionEnum"};
 }
 
-CertificateActionEnum string_to_certificate_action_enum(const std::string& s) {
-    if (s == "Install") {
-        return CertificateActionEnum::Install;
-    }
-    if (s == "Update") {
-        return CertificateActionEnum::Update;
+CertificateActionEnum string_to_certificate_action_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Update") {
+            return CertificateActionEnum::Update;
+        }
+        break;
+    case 7:
+        if (s == "Install") {
+            return CertificateActionEnum::Install;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "CertificateActionEnum"};
@@ -974,12 +1167,18 @@ std::string iso15118evcertificate_status_enum_to_string(Iso15118EVCertificateSta
     throw EnumToStringException{e, "Iso15118EVCertificateStatusEnum"};
 }
 
-Iso15118EVCertificateStatusEnum string_to_iso15118evcertificate_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return Iso15118EVCertificateStatusEnum::Accepted;
-    }
-    if (s == "Failed") {
-        return Iso15118EVCertificateStatusEnum::Failed;
+Iso15118EVCertificateStatusEnum string_to_iso15118evcertificate_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return Iso15118EVCertificateStatusEnum::Failed;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return Iso15118EVCertificateStatusEnum::Accepted;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "Iso15118EVCertificateStatusEnum"};
@@ -1006,15 +1205,23 @@ std::string report_base_enum_to_string(ReportBaseEnum e) {
     throw EnumToStringException{e, "ReportBaseEnum"};
 }
 
-ReportBaseEnum string_to_report_base_enum(const std::string& s) {
-    if (s == "ConfigurationInventory") {
-        return ReportBaseEnum::ConfigurationInventory;
-    }
-    if (s == "FullInventory") {
-        return ReportBaseEnum::FullInventory;
-    }
-    if (s == "SummaryInventory") {
-        return ReportBaseEnum::SummaryInventory;
+ReportBaseEnum string_to_report_base_enum(std::string_view s) {
+    switch (s.size()) {
+    case 13:
+        if (s == "FullInventory") {
+            return ReportBaseEnum::FullInventory;
+        }
+        break;
+    case 16:
+        if (s == "SummaryInventory") {
+            return ReportBaseEnum::SummaryInventory;
+        }
+        break;
+    case 22:
+        if (s == "ConfigurationInventory") {
+            return ReportBaseEnum::ConfigurationInventory;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ReportBaseEnum"};
@@ -1043,18 +1250,26 @@ std::string generic_device_model_status_enum_to_string(GenericDeviceModelStatusE
     throw EnumToStringException{e, "GenericDeviceModelStatusEnum"};
 }
 
-GenericDeviceModelStatusEnum string_to_generic_device_model_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GenericDeviceModelStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return GenericDeviceModelStatusEnum::Rejected;
-    }
-    if (s == "NotSupported") {
-        return GenericDeviceModelStatusEnum::NotSupported;
-    }
-    if (s == "EmptyResultSet") {
-        return GenericDeviceModelStatusEnum::EmptyResultSet;
+GenericDeviceModelStatusEnum string_to_generic_device_model_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return GenericDeviceModelStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return GenericDeviceModelStatusEnum::Rejected;
+        }
+        break;
+    case 12:
+        if (s == "NotSupported") {
+            return GenericDeviceModelStatusEnum::NotSupported;
+        }
+        break;
+    case 14:
+        if (s == "EmptyResultSet") {
+            return GenericDeviceModelStatusEnum::EmptyResultSet;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GenericDeviceModelStatusEnum"};
@@ -1079,12 +1294,18 @@ std::string get_certificate_status_enum_to_string(GetCertificateStatusEnum e) {
     throw EnumToStringException{e, "GetCertificateStatusEnum"};
 }
 
-GetCertificateStatusEnum string_to_get_certificate_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GetCertificateStatusEnum::Accepted;
-    }
-    if (s == "Failed") {
-        return GetCertificateStatusEnum::Failed;
+GetCertificateStatusEnum string_to_get_certificate_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return GetCertificateStatusEnum::Failed;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return GetCertificateStatusEnum::Accepted;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GetCertificateStatusEnum"};
@@ -1109,12 +1330,18 @@ std::string get_charging_profile_status_enum_to_string(GetChargingProfileStatusE
     throw EnumToStringException{e, "GetChargingProfileStatusEnum"};
 }
 
-GetChargingProfileStatusEnum string_to_get_charging_profile_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GetChargingProfileStatusEnum::Accepted;
-    }
-    if (s == "NoProfiles") {
-        return GetChargingProfileStatusEnum::NoProfiles;
+GetChargingProfileStatusEnum string_to_get_charging_profile_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return GetChargingProfileStatusEnum::Accepted;
+        }
+        break;
+    case 10:
+        if (s == "NoProfiles") {
+            return GetChargingProfileStatusEnum::NoProfiles;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GetChargingProfileStatusEnum"};
@@ -1139,12 +1366,16 @@ std::string charging_rate_unit_enum_to_string(ChargingRateUnitEnum e) {
     throw EnumToStringException{e, "ChargingRateUnitEnum"};
 }
 
-ChargingRateUnitEnum string_to_charging_rate_unit_enum(const std::string& s) {
-    if (s == "W") {
-        return ChargingRateUnitEnum::W;
-    }
-    if (s == "A") {
-        return ChargingRateUnitEnum::A;
+ChargingRateUnitEnum string_to_charging_rate_unit_enum(std::string_view s) {
+    switch (s.size()) {
+    case 1:
+        if (s == "W") {
+            return ChargingRateUnitEnum::W;
+        }
+        if (s == "A") {
+            return ChargingRateUnitEnum::A;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingRateUnitEnum"};
@@ -1169,12 +1400,16 @@ std::string generic_status_enum_to_string(GenericStatusEnum e) {
     throw EnumToStringException{e, "GenericStatusEnum"};
 }
 
-GenericStatusEnum string_to_generic_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GenericStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return GenericStatusEnum::Rejected;
+GenericStatusEnum string_to_generic_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return GenericStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return GenericStatusEnum::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GenericStatusEnum"};
@@ -1201,15 +1436,21 @@ std::string message_priority_enum_to_string(MessagePriorityEnum e) {
     throw EnumToStringException{e, "MessagePriorityEnum"};
 }
 
-MessagePriorityEnum string_to_message_priority_enum(const std::string& s) {
-    if (s == "AlwaysFront") {
-        return MessagePriorityEnum::AlwaysFront;
-    }
-    if (s == "InFront") {
-        return MessagePriorityEnum::InFront;
-    }
-    if (s == "NormalCycle") {
-        return MessagePriorityEnum::NormalCycle;
+MessagePriorityEnum string_to_message_priority_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "InFront") {
+            return MessagePriorityEnum::InFront;
+        }
+        break;
+    case 11:
+        if (s == "AlwaysFront") {
+            return MessagePriorityEnum::AlwaysFront;
+        }
+        if (s == "NormalCycle") {
+            return MessagePriorityEnum::NormalCycle;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MessagePriorityEnum"};
@@ -1238,18 +1479,28 @@ std::string message_state_enum_to_string(MessageStateEnum e) {
     throw EnumToStringException{e, "MessageStateEnum"};
 }
 
-MessageStateEnum string_to_message_state_enum(const std::string& s) {
-    if (s == "Charging") {
-        return MessageStateEnum::Charging;
-    }
-    if (s == "Faulted") {
-        return MessageStateEnum::Faulted;
-    }
-    if (s == "Idle") {
-        return MessageStateEnum::Idle;
-    }
-    if (s == "Unavailable") {
-        return MessageStateEnum::Unavailable;
+MessageStateEnum string_to_message_state_enum(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return MessageStateEnum::Idle;
+        }
+        break;
+    case 7:
+        if (s == "Faulted") {
+            return MessageStateEnum::Faulted;
+        }
+        break;
+    case 8:
+        if (s == "Charging") {
+            return MessageStateEnum::Charging;
+        }
+        break;
+    case 11:
+        if (s == "Unavailable") {
+            return MessageStateEnum::Unavailable;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MessageStateEnum"};
@@ -1274,12 +1525,18 @@ std::string get_display_messages_status_enum_to_string(GetDisplayMessagesStatusE
     throw EnumToStringException{e, "GetDisplayMessagesStatusEnum"};
 }
 
-GetDisplayMessagesStatusEnum string_to_get_display_messages_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GetDisplayMessagesStatusEnum::Accepted;
-    }
-    if (s == "Unknown") {
-        return GetDisplayMessagesStatusEnum::Unknown;
+GetDisplayMessagesStatusEnum string_to_get_display_messages_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Unknown") {
+            return GetDisplayMessagesStatusEnum::Unknown;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return GetDisplayMessagesStatusEnum::Accepted;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GetDisplayMessagesStatusEnum"};
@@ -1310,21 +1567,31 @@ std::string get_certificate_id_use_enum_to_string(GetCertificateIdUseEnum e) {
     throw EnumToStringException{e, "GetCertificateIdUseEnum"};
 }
 
-GetCertificateIdUseEnum string_to_get_certificate_id_use_enum(const std::string& s) {
-    if (s == "V2GRootCertificate") {
-        return GetCertificateIdUseEnum::V2GRootCertificate;
-    }
-    if (s == "MORootCertificate") {
-        return GetCertificateIdUseEnum::MORootCertificate;
-    }
-    if (s == "CSMSRootCertificate") {
-        return GetCertificateIdUseEnum::CSMSRootCertificate;
-    }
-    if (s == "V2GCertificateChain") {
-        return GetCertificateIdUseEnum::V2GCertificateChain;
-    }
-    if (s == "ManufacturerRootCertificate") {
-        return GetCertificateIdUseEnum::ManufacturerRootCertificate;
+GetCertificateIdUseEnum string_to_get_certificate_id_use_enum(std::string_view s) {
+    switch (s.size()) {
+    case 17:
+        if (s == "MORootCertificate") {
+            return GetCertificateIdUseEnum::MORootCertificate;
+        }
+        break;
+    case 18:
+        if (s == "V2GRootCertificate") {
+            return GetCertificateIdUseEnum::V2GRootCertificate;
+        }
+        break;
+    case 19:
+        if (s == "CSMSRootCertificate") {
+            return GetCertificateIdUseEnum::CSMSRootCertificate;
+        }
+        if (s == "V2GCertificateChain") {
+            return GetCertificateIdUseEnum::V2GCertificateChain;
+        }
+        break;
+    case 27:
+        if (s == "ManufacturerRootCertificate") {
+            return GetCertificateIdUseEnum::ManufacturerRootCertificate;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GetCertificateIdUseEnum"};
@@ -1349,12 +1616,16 @@ std::string get_installed_certificate_status_enum_to_string(GetInstalledCertific
     throw EnumToStringException{e, "GetInstalledCertificateStatusEnum"};
 }
 
-GetInstalledCertificateStatusEnum string_to_get_installed_certificate_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GetInstalledCertificateStatusEnum::Accepted;
-    }
-    if (s == "NotFound") {
-        return GetInstalledCertificateStatusEnum::NotFound;
+GetInstalledCertificateStatusEnum string_to_get_installed_certificate_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return GetInstalledCertificateStatusEnum::Accepted;
+        }
+        if (s == "NotFound") {
+            return GetInstalledCertificateStatusEnum::NotFound;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GetInstalledCertificateStatusEnum"};
@@ -1380,12 +1651,18 @@ std::string log_enum_to_string(LogEnum e) {
     throw EnumToStringException{e, "LogEnum"};
 }
 
-LogEnum string_to_log_enum(const std::string& s) {
-    if (s == "DiagnosticsLog") {
-        return LogEnum::DiagnosticsLog;
-    }
-    if (s == "SecurityLog") {
-        return LogEnum::SecurityLog;
+LogEnum string_to_log_enum(std::string_view s) {
+    switch (s.size()) {
+    case 11:
+        if (s == "SecurityLog") {
+            return LogEnum::SecurityLog;
+        }
+        break;
+    case 14:
+        if (s == "DiagnosticsLog") {
+            return LogEnum::DiagnosticsLog;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "LogEnum"};
@@ -1412,15 +1689,21 @@ std::string log_status_enum_to_string(LogStatusEnum e) {
     throw EnumToStringException{e, "LogStatusEnum"};
 }
 
-LogStatusEnum string_to_log_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return LogStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return LogStatusEnum::Rejected;
-    }
-    if (s == "AcceptedCanceled") {
-        return LogStatusEnum::AcceptedCanceled;
+LogStatusEnum string_to_log_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return LogStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return LogStatusEnum::Rejected;
+        }
+        break;
+    case 16:
+        if (s == "AcceptedCanceled") {
+            return LogStatusEnum::AcceptedCanceled;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "LogStatusEnum"};
@@ -1447,15 +1730,23 @@ std::string monitoring_criterion_enum_to_string(MonitoringCriterionEnum e) {
     throw EnumToStringException{e, "MonitoringCriterionEnum"};
 }
 
-MonitoringCriterionEnum string_to_monitoring_criterion_enum(const std::string& s) {
-    if (s == "ThresholdMonitoring") {
-        return MonitoringCriterionEnum::ThresholdMonitoring;
-    }
-    if (s == "DeltaMonitoring") {
-        return MonitoringCriterionEnum::DeltaMonitoring;
-    }
-    if (s == "PeriodicMonitoring") {
-        return MonitoringCriterionEnum::PeriodicMonitoring;
+MonitoringCriterionEnum string_to_monitoring_criterion_enum(std::string_view s) {
+    switch (s.size()) {
+    case 15:
+        if (s == "DeltaMonitoring") {
+            return MonitoringCriterionEnum::DeltaMonitoring;
+        }
+        break;
+    case 18:
+        if (s == "PeriodicMonitoring") {
+            return MonitoringCriterionEnum::PeriodicMonitoring;
+        }
+        break;
+    case 19:
+        if (s == "ThresholdMonitoring") {
+            return MonitoringCriterionEnum::ThresholdMonitoring;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MonitoringCriterionEnum"};
@@ -1484,18 +1775,26 @@ std::string component_criterion_enum_to_string(ComponentCriterionEnum e) {
     throw EnumToStringException{e, "ComponentCriterionEnum"};
 }
 
-ComponentCriterionEnum string_to_component_criterion_enum(const std::string& s) {
-    if (s == "Active") {
-        return ComponentCriterionEnum::Active;
-    }
-    if (s == "Available") {
-        return ComponentCriterionEnum::Available;
-    }
-    if (s == "Enabled") {
-        return ComponentCriterionEnum::Enabled;
-    }
-    if (s == "Problem") {
-        return ComponentCriterionEnum::Problem;
+ComponentCriterionEnum string_to_component_criterion_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Active") {
+            return ComponentCriterionEnum::Active;
+        }
+        break;
+    case 7:
+        if (s == "Enabled") {
+            return ComponentCriterionEnum::Enabled;
+        }
+        if (s == "Problem") {
+            return ComponentCriterionEnum::Problem;
+        }
+        break;
+    case 9:
+        if (s == "Available") {
+            return ComponentCriterionEnum::Available;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ComponentCriterionEnum"};
@@ -1524,18 +1823,32 @@ std::string attribute_enum_to_string(AttributeEnum e) {
     throw EnumToStringException{e, "AttributeEnum"};
 }
 
-AttributeEnum string_to_attribute_enum(const std::string& s) {
-    if (s == "Actual") {
-        return AttributeEnum::Actual;
-    }
-    if (s == "Target") {
-        return AttributeEnum::Target;
-    }
-    if (s == "MinSet") {
-        return AttributeEnum::MinSet;
-    }
-    if (s == "MaxSet") {
-        return AttributeEnum::MaxSet;
+AttributeEnum string_to_attribute_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        switch (s[2]) {
+        case 't':
+            if (s == "Actual") {
+                return AttributeEnum::Actual;
+            }
+            break;
+        case 'r':
+            if (s == "Target") {
+                return AttributeEnum::Target;
+            }
+            break;
+        case 'n':
+            if (s == "MinSet") {
+                return AttributeEnum::MinSet;
+            }
+            break;
+        case 'x':
+            if (s == "MaxSet") {
+                return AttributeEnum::MaxSet;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "AttributeEnum"};
@@ -1566,21 +1879,31 @@ std::string get_variable_status_enum_to_string(GetVariableStatusEnum e) {
     throw EnumToStringException{e, "GetVariableStatusEnum"};
 }
 
-GetVariableStatusEnum string_to_get_variable_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GetVariableStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return GetVariableStatusEnum::Rejected;
-    }
-    if (s == "UnknownComponent") {
-        return GetVariableStatusEnum::UnknownComponent;
-    }
-    if (s == "UnknownVariable") {
-        return GetVariableStatusEnum::UnknownVariable;
-    }
-    if (s == "NotSupportedAttributeType") {
-        return GetVariableStatusEnum::NotSupportedAttributeType;
+GetVariableStatusEnum string_to_get_variable_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return GetVariableStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return GetVariableStatusEnum::Rejected;
+        }
+        break;
+    case 15:
+        if (s == "UnknownVariable") {
+            return GetVariableStatusEnum::UnknownVariable;
+        }
+        break;
+    case 16:
+        if (s == "UnknownComponent") {
+            return GetVariableStatusEnum::UnknownComponent;
+        }
+        break;
+    case 25:
+        if (s == "NotSupportedAttributeType") {
+            return GetVariableStatusEnum::NotSupportedAttributeType;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GetVariableStatusEnum"};
@@ -1609,18 +1932,28 @@ std::string install_certificate_use_enum_to_string(InstallCertificateUseEnum e)
     throw EnumToStringException{e, "InstallCertificateUseEnum"};
 }
 
-InstallCertificateUseEnum string_to_install_certificate_use_enum(const std::string& s) {
-    if (s == "V2GRootCertificate") {
-        return InstallCertificateUseEnum::V2GRootCertificate;
-    }
-    if (s == "MORootCertificate") {
-        return InstallCertificateUseEnum::MORootCertificate;
-    }
-    if (s == "CSMSRootCertificate") {
-        return InstallCertificateUseEnum::CSMSRootCertificate;
-    }
-    if (s == "ManufacturerRootCertificate") {
-        return InstallCertificateUseEnum::ManufacturerRootCertificate;
+InstallCertificateUseEnum string_to_install_certificate_use_enum(std::string_view s) {
+    switch (s.size()) {
+    case 17:
+        if (s == "MORootCertificate") {
+            return InstallCertificateUseEnum::MORootCertificate;
+        }
+        break;
+    case 18:
+        if (s == "V2GRootCertificate") {
+            return InstallCertificateUseEnum::V2GRootCertificate;
+        }
+        break;
+    case 19:
+        if (s == "CSMSRootCertificate") {
+            return InstallCertificateUseEnum::CSMSRootCertificate;
+        }
+        break;
+    case 27:
+        if (s == "ManufacturerRootCertificate") {
+            return InstallCertificateUseEnum::ManufacturerRootCertificate;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "InstallCertificateUseEnum"};
@@ -1647,15 +1980,21 @@ std::string install_certificate_status_enum_to_string(InstallCertificateStatusEn
     throw EnumToStringException{e, "InstallCertificateStatusEnum"};
 }
 
-InstallCertificateStatusEnum string_to_install_certificate_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return InstallCertificateStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return InstallCertificateStatusEnum::Rejected;
-    }
-    if (s == "Failed") {
-        return InstallCertificateStatusEnum::Failed;
+InstallCertificateStatusEnum string_to_install_certificate_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return InstallCertificateStatusEnum::Failed;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return InstallCertificateStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return InstallCertificateStatusEnum::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "InstallCertificateStatusEnum"};
@@ -1692,30 +2031,46 @@ std::string upload_log_status_enum_to_string(UploadLogStatusEnum e) {
     throw EnumToStringException{e, "UploadLogStatusEnum"};
 }
 
-UploadLogStatusEnum string_to_upload_log_status_enum(const std::string& s) {
-    if (s == "BadMessage") {
-        return UploadLogStatusEnum::BadMessage;
-    }
-    if (s == "Idle") {
-        return UploadLogStatusEnum::Idle;
-    }
-    if (s == "NotSupportedOperation") {
-        return UploadLogStatusEnum::NotSupportedOperation;
-    }
-    if (s == "PermissionDenied") {
-        return UploadLogStatusEnum::PermissionDenied;
-    }
-    if (s == "Uploaded") {
-        return UploadLogStatusEnum::Uploaded;
-    }
-    if (s == "UploadFailure") {
-        return UploadLogStatusEnum::UploadFailure;
-    }
-    if (s == "Uploading") {
-        return UploadLogStatusEnum::Uploading;
-    }
-    if (s == "AcceptedCanceled") {
-        return UploadLogStatusEnum::AcceptedCanceled;
+UploadLogStatusEnum string_to_upload_log_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return UploadLogStatusEnum::Idle;
+        }
+        break;
+    case 8:
+        if (s == "Uploaded") {
+            return UploadLogStatusEnum::Uploaded;
+        }
+        break;
+    case 9:
+        if (s == "Uploading") {
+            return UploadLogStatusEnum::Uploading;
+        }
+        break;
+    case 10:
+        if (s == "BadMessage") {
+            return UploadLogStatusEnum::BadMessage;
+        }
+        break;
+    case 13:
+        if (s == "UploadFailure") {
+            return UploadLogStatusEnum::UploadFailure;
+        }
+        break;
+    case 16:
+        if (s == "PermissionDenied") {
+            return UploadLogStatusEnum::PermissionDenied;
+        }
+        if (s == "AcceptedCanceled") {
+            return UploadLogStatusEnum::AcceptedCanceled;
+        }
+        break;
+    case 21:
+        if (s == "NotSupportedOperation") {
+            return UploadLogStatusEnum::NotSupportedOperation;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UploadLogStatusEnum"};
@@ -1752,30 +2107,46 @@ std::string reading_context_enum_to_string(ReadingContextEnum e) {
     throw EnumToStringException{e, "ReadingContextEnum"};
 }
 
-ReadingContextEnum string_to_reading_context_enum(const std::string& s) {
-    if (s == "Interruption.Begin") {
-        return ReadingContextEnum::Interruption_Begin;
-    }
-    if (s == "Interruption.End") {
-        return ReadingContextEnum::Interruption_End;
-    }
-    if (s == "Other") {
-        return ReadingContextEnum::Other;
-    }
-    if (s == "Sample.Clock") {
-        return ReadingContextEnum::Sample_Clock;
-    }
-    if (s == "Sample.Periodic") {
-        return ReadingContextEnum::Sample_Periodic;
-    }
-    if (s == "Transaction.Begin") {
-        return ReadingContextEnum::Transaction_Begin;
-    }
-    if (s == "Transaction.End") {
-        return ReadingContextEnum::Transaction_End;
-    }
-    if (s == "Trigger") {
-        return ReadingContextEnum::Trigger;
+ReadingContextEnum string_to_reading_context_enum(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "Other") {
+            return ReadingContextEnum::Other;
+        }
+        break;
+    case 7:
+        if (s == "Trigger") {
+            return ReadingContextEnum::Trigger;
+        }
+        break;
+    case 12:
+        if (s == "Sample.Clock") {
+            return ReadingContextEnum::Sample_Clock;
+        }
+        break;
+    case 15:
+        if (s == "Sample.Periodic") {
+            return ReadingContextEnum::Sample_Periodic;
+        }
+        if (s == "Transaction.End") {
+            return ReadingContextEnum::Transaction_End;
+        }
+        break;
+    case 16:
+        if (s == "Interruption.End") {
+            return ReadingContextEnum::Interruption_End;
+        }
+        break;
+    case 17:
+        if (s == "Transaction.Begin") {
+            return ReadingContextEnum::Transaction_Begin;
+        }
+        break;
+    case 18:
+        if (s == "Interruption.Begin") {
+            return ReadingContextEnum::Interruption_Begin;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ReadingContextEnum"};
@@ -1846,81 +2217,131 @@ std::string measurand_enum_to_string(MeasurandEnum e) {
     throw EnumToStringException{e, "MeasurandEnum"};
 }
 
-MeasurandEnum string_to_measurand_enum(const std::string& s) {
-    if (s == "Current.Export") {
-        return MeasurandEnum::Current_Export;
-    }
-    if (s == "Current.Import") {
-        return MeasurandEnum::Current_Import;
-    }
-    if (s == "Current.Offered") {
-        return MeasurandEnum::Current_Offered;
-    }
-    if (s == "Energy.Active.Export.Register") {
-        return MeasurandEnum::Energy_Active_Export_Register;
-    }
-    if (s == "Energy.Active.Import.Register") {
-        return MeasurandEnum::Energy_Active_Import_Register;
-    }
-    if (s == "Energy.Reactive.Export.Register") {
-        return MeasurandEnum::Energy_Reactive_Export_Register;
-    }
-    if (s == "Energy.Reactive.Import.Register") {
-        return MeasurandEnum::Energy_Reactive_Import_Register;
-    }
-    if (s == "Energy.Active.Export.Interval") {
-        return MeasurandEnum::Energy_Active_Export_Interval;
-    }
-    if (s == "Energy.Active.Import.Interval") {
-        return MeasurandEnum::Energy_Active_Import_Interval;
-    }
-    if (s == "Energy.Active.Net") {
-        return MeasurandEnum::Energy_Active_Net;
-    }
-    if (s == "Energy.Reactive.Export.Interval") {
-        return MeasurandEnum::Energy_Reactive_Export_Interval;
-    }
-    if (s == "Energy.Reactive.Import.Interval") {
-        return MeasurandEnum::Energy_Reactive_Import_Interval;
-    }
-    if (s == "Energy.Reactive.Net") {
-        return MeasurandEnum::Energy_Reactive_Net;
-    }
-    if (s == "Energy.Apparent.Net") {
-        return MeasurandEnum::Energy_Apparent_Net;
-    }
-    if (s == "Energy.Apparent.Import") {
-        return MeasurandEnum::Energy_Apparent_Import;
-    }
-    if (s == "Energy.Apparent.Export") {
-        return MeasurandEnum::Energy_Apparent_Export;
-    }
-    if (s == "Frequency") {
-        return MeasurandEnum::Frequency;
-    }
-    if (s == "Power.Active.Export") {
-        return MeasurandEnum::Power_Active_Export;
-    }
-    if (s == "Power.Active.Import") {
-        return MeasurandEnum::Power_Active_Import;
-    }
-    if (s == "Power.Factor") {
-        return MeasurandEnum::Power_Factor;
-    }
-    if (s == "Power.Offered") {
-        return MeasurandEnum::Power_Offered;
-    }
-    if (s == "Power.Reactive.Export") {
-        return MeasurandEnum::Power_Reactive_Export;
-    }
-    if (s == "Power.Reactive.Import") {
-        return MeasurandEnum::Power_Reactive_Import;
-    }
-    if (s == "SoC") {
-        return MeasurandEnum::SoC;
-    }
-    if (s == "Voltage") {
-        return MeasurandEnum::Voltage;
+MeasurandEnum string_to_measurand_enum(std::string_view s) {
+    switch (s.size()) {
+    case 3:
+        if (s == "SoC") {
+            return MeasurandEnum::SoC;
+        }
+        break;
+    case 7:
+        if (s == "Voltage") {
+            return MeasurandEnum::Voltage;
+        }
+        break;
+    case 9:
+        if (s == "Frequency") {
+            return MeasurandEnum::Frequency;
+        }
+        break;
+    case 12:
+        if (s == "Power.Factor") {
+            return MeasurandEnum::Power_Factor;
+        }
+        break;
+    case 13:
+        if (s == "Power.Offered") {
+            return MeasurandEnum::Power_Offered;
+        }
+        break;
+    case 14:
+        if (s == "Current.Export") {
+            return MeasurandEnum::Current_Export;
+        }
+        if (s == "Current.Import") {
+            return MeasurandEnum::Current_Import;
+        }
+        break;
+    case 15:
+        if (s == "Current.Offered") {
+            return MeasurandEnum::Current_Offered;
+        }
+        break;
+    case 17:
+        if (s == "Energy.Active.Net") {
+            return MeasurandEnum::Energy_Active_Net;
+        }
+        break;
+    case 19:
+        switch (s[13]) {
+        case 'v':
+            if (s == "Energy.Reactive.Net") {
+                return MeasurandEnum::Energy_Reactive_Net;
+            }
+            break;
+        case 'n':
+            if (s == "Energy.Apparent.Net") {
+                return MeasurandEnum::Energy_Apparent_Net;
+            }
+            break;
+        case 'E':
+            if (s == "Power.Active.Export") {
+                return MeasurandEnum::Power_Active_Export;
+            }
+            break;
+        case 'I':
+            if (s == "Power.Active.Import") {
+                return MeasurandEnum::Power_Active_Import;
+            }
+            break;
+        }
+        break;
+    case 21:
+        if (s == "Power.Reactive.Export") {
+            return MeasurandEnum::Power_Reactive_Export;
+        }
+        if (s == "Power.Reactive.Import") {
+            return MeasurandEnum::Power_Reactive_Import;
+        }
+        break;
+    case 22:
+        if (s == "Energy.Apparent.Import") {
+            return MeasurandEnum::Energy_Apparent_Import;
+        }
+        if (s == "Energy.Apparent.Export") {
+            return MeasurandEnum::Energy_Apparent_Export;
+        }
+        break;
+    case 29:
+        switch (s[14]) {
+        case 'E':
+            if (s == "Energy.Active.Export.Register") {
+                return MeasurandEnum::Energy_Active_Export_Register;
+            }
+            if (s == "Energy.Active.Export.Interval") {
+                return MeasurandEnum::Energy_Active_Export_Interval;
+            }
+            break;
+        case 'I':
+            if (s == "Energy.Active.Import.Register") {
+                return MeasurandEnum::Energy_Active_Import_Register;
+            }
+            if (s == "Energy.Active.Import.Interval") {
+                return MeasurandEnum::Energy_Active_Import_Interval;
+            }
+            break;
+        }
+        break;
+    case 31:
+        switch (s[16]) {
+        case 'E':
+            if (s == "Energy.Reactive.Export.Register") {
+                return MeasurandEnum::Energy_Reactive_Export_Register;
+            }
+            if (s == "Energy.Reactive.Export.Interval") {
+                return MeasurandEnum::Energy_Reactive_Export_Interval;
+            }
+            break;
+        case 'I':
+            if (s == "Energy.Reactive.Import.Register") {
+                return MeasurandEnum::Energy_Reactive_Import_Register;
+            }
+            if (s == "Energy.Reactive.Import.Interval") {
+                return MeasurandEnum::Energy_Reactive_Import_Interval;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MeasurandEnum"};
@@ -1961,36 +2382,46 @@ std::string phase_enum_to_string(PhaseEnum e) {
     throw EnumToStringException{e, "PhaseEnum"};
 }
 
-PhaseEnum string_to_phase_enum(const std::string& s) {
-    if (s == "L1") {
-        return PhaseEnum::L1;
-    }
-    if (s == "L2") {
-        return PhaseEnum::L2;
-    }
-    if (s == "L3") {
-        return PhaseEnum::L3;
-    }
-    if (s == "N") {
-        return PhaseEnum::N;
-    }
-    if (s == "L1-N") {
-        return PhaseEnum::L1_N;
-    }
-    if (s == "L2-N") {
-        return PhaseEnum::L2_N;
-    }
-    if (s == "L3-N") {
-        return PhaseEnum::L3_N;
-    }
-    if (s == "L1-L2") {
-        return PhaseEnum::L1_L2;
-    }
-    if (s == "L2-L3") {
-        return PhaseEnum::L2_L3;
-    }
-    if (s == "L3-L1") {
-        return PhaseEnum::L3_L1;
+PhaseEnum string_to_phase_enum(std::string_view s) {
+    switch (s.size()) {
+    case 1:
+        if (s == "N") {
+            return PhaseEnum::N;
+        }
+        break;
+    case 2:
+        if (s == "L1") {
+            return PhaseEnum::L1;
+        }
+        if (s == "L2") {
+            return PhaseEnum::L2;
+        }
+        if (s == "L3") {
+            return PhaseEnum::L3;
+        }
+        break;
+    case 4:
+        if (s == "L1-N") {
+            return PhaseEnum::L1_N;
+        }
+        if (s == "L2-N") {
+            return PhaseEnum::L2_N;
+        }
+        if (s == "L3-N") {
+            return PhaseEnum::L3_N;
+        }
+        break;
+    case 5:
+        if (s == "L1-L2") {
+            return PhaseEnum::L1_L2;
+        }
+        if (s == "L2-L3") {
+            return PhaseEnum::L2_L3;
+        }
+        if (s == "L3-L1") {
+            return PhaseEnum::L3_L1;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "PhaseEnum"};
@@ -2021,21 +2452,31 @@ std::string location_enum_to_string(LocationEnum e) {
     throw EnumToStringException{e, "LocationEnum"};
 }
 
-LocationEnum string_to_location_enum(const std::string& s) {
-    if (s == "Body") {
-        return LocationEnum::Body;
-    }
-    if (s == "Cable") {
-        return LocationEnum::Cable;
-    }
-    if (s == "EV") {
-        return LocationEnum::EV;
-    }
-    if (s == "Inlet") {
-        return LocationEnum::Inlet;
-    }
-    if (s == "Outlet") {
-        return LocationEnum::Outlet;
+LocationEnum string_to_location_enum(std::string_view s) {
+    switch (s.size()) {
+    case 2:
+        if (s == "EV") {
+            return LocationEnum::EV;
+        }
+        break;
+    case 4:
+        if (s == "Body") {
+            return LocationEnum::Body;
+        }
+        break;
+    case 5:
+        if (s == "Cable") {
+            return LocationEnum::Cable;
+        }
+        if (s == "Inlet") {
+            return LocationEnum::Inlet;
+        }
+        break;
+    case 6:
+        if (s == "Outlet") {
+            return LocationEnum::Outlet;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "LocationEnum"};
@@ -2062,15 +2503,23 @@ std::string cost_kind_enum_to_string(CostKindEnum e) {
     throw EnumToStringException{e, "CostKindEnum"};
 }
 
-CostKindEnum string_to_cost_kind_enum(const std::string& s) {
-    if (s == "CarbonDioxideEmission") {
-        return CostKindEnum::CarbonDioxideEmission;
-    }
-    if (s == "RelativePricePercentage") {
-        return CostKindEnum::RelativePricePercentage;
-    }
-    if (s == "RenewableGenerationPercentage") {
-        return CostKindEnum::RenewableGenerationPercentage;
+CostKindEnum string_to_cost_kind_enum(std::string_view s) {
+    switch (s.size()) {
+    case 21:
+        if (s == "CarbonDioxideEmission") {
+            return CostKindEnum::CarbonDioxideEmission;
+        }
+        break;
+    case 23:
+        if (s == "RelativePricePercentage") {
+            return CostKindEnum::RelativePricePercentage;
+        }
+        break;
+    case 29:
+        if (s == "RenewableGenerationPercentage") {
+            return CostKindEnum::RenewableGenerationPercentage;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "CostKindEnum"};
@@ -2099,18 +2548,28 @@ std::string energy_transfer_mode_enum_to_string(EnergyTransferModeEnum e) {
     throw EnumToStringException{e, "EnergyTransferModeEnum"};
 }
 
-EnergyTransferModeEnum string_to_energy_transfer_mode_enum(const std::string& s) {
-    if (s == "DC") {
-        return EnergyTransferModeEnum::DC;
-    }
-    if (s == "AC_single_phase") {
-        return EnergyTransferModeEnum::AC_single_phase;
-    }
-    if (s == "AC_two_phase") {
-        return EnergyTransferModeEnum::AC_two_phase;
-    }
-    if (s == "AC_three_phase") {
-        return EnergyTransferModeEnum::AC_three_phase;
+EnergyTransferModeEnum string_to_energy_transfer_mode_enum(std::string_view s) {
+    switch (s.size()) {
+    case 2:
+        if (s == "DC") {
+            return EnergyTransferModeEnum::DC;
+        }
+        break;
+    case 12:
+        if (s == "AC_two_phase") {
+            return EnergyTransferModeEnum::AC_two_phase;
+        }
+        break;
+    case 14:
+        if (s == "AC_three_phase") {
+            return EnergyTransferModeEnum::AC_three_phase;
+        }
+        break;
+    case 15:
+        if (s == "AC_single_phase") {
+            return EnergyTransferModeEnum::AC_single_phase;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "EnergyTransferModeEnum"};
@@ -2137,15 +2596,21 @@ std::string notify_evcharging_needs_status_enum_to_string(NotifyEVChargingNeedsS
     throw EnumToStringException{e, "NotifyEVChargingNeedsStatusEnum"};
 }
 
-NotifyEVChargingNeedsStatusEnum string_to_notify_evcharging_needs_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return NotifyEVChargingNeedsStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return NotifyEVChargingNeedsStatusEnum::Rejected;
-    }
-    if (s == "Processing") {
-        return NotifyEVChargingNeedsStatusEnum::Processing;
+NotifyEVChargingNeedsStatusEnum string_to_notify_evcharging_needs_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return NotifyEVChargingNeedsStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return NotifyEVChargingNeedsStatusEnum::Rejected;
+        }
+        break;
+    case 10:
+        if (s == "Processing") {
+            return NotifyEVChargingNeedsStatusEnum::Processing;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "NotifyEVChargingNeedsStatusEnum"};
@@ -2172,15 +2637,21 @@ std::string event_trigger_enum_to_string(EventTriggerEnum e) {
     throw EnumToStringException{e, "EventTriggerEnum"};
 }
 
-EventTriggerEnum string_to_event_trigger_enum(const std::string& s) {
-    if (s == "Alerting") {
-        return EventTriggerEnum::Alerting;
-    }
-    if (s == "Delta") {
-        return EventTriggerEnum::Delta;
-    }
-    if (s == "Periodic") {
-        return EventTriggerEnum::Periodic;
+EventTriggerEnum string_to_event_trigger_enum(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "Delta") {
+            return EventTriggerEnum::Delta;
+        }
+        break;
+    case 8:
+        if (s == "Alerting") {
+            return EventTriggerEnum::Alerting;
+        }
+        if (s == "Periodic") {
+            return EventTriggerEnum::Periodic;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "EventTriggerEnum"};
@@ -2209,18 +2680,28 @@ std::string event_notification_enum_to_string(EventNotificationEnum e) {
     throw EnumToStringException{e, "EventNotificationEnum"};
 }
 
-EventNotificationEnum string_to_event_notification_enum(const std::string& s) {
-    if (s == "HardWiredNotification") {
-        return EventNotificationEnum::HardWiredNotification;
-    }
-    if (s == "HardWiredMonitor") {
-        return EventNotificationEnum::HardWiredMonitor;
-    }
-    if (s == "PreconfiguredMonitor") {
-        return EventNotificationEnum::PreconfiguredMonitor;
-    }
-    if (s == "CustomMonitor") {
-        return EventNotificationEnum::CustomMonitor;
+EventNotificationEnum string_to_event_notification_enum(std::string_view s) {
+    switch (s.size()) {
+    case 13:
+        if (s == "CustomMonitor") {
+            return EventNotificationEnum::CustomMonitor;
+        }
+        break;
+    case 16:
+        if (s == "HardWiredMonitor") {
+            return EventNotificationEnum::HardWiredMonitor;
+        }
+        break;
+    case 20:
+        if (s == "PreconfiguredMonitor") {
+            return EventNotificationEnum::PreconfiguredMonitor;
+        }
+        break;
+    case 21:
+        if (s == "HardWiredNotification") {
+            return EventNotificationEnum::HardWiredNotification;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "EventNotificationEnum"};
@@ -2251,21 +2732,31 @@ std::string monitor_enum_to_string(MonitorEnum e) {
     throw EnumToStringException{e, "MonitorEnum"};
 }
 
-MonitorEnum string_to_monitor_enum(const std::string& s) {
-    if (s == "UpperThreshold") {
-        return MonitorEnum::UpperThreshold;
-    }
-    if (s == "LowerThreshold") {
-        return MonitorEnum::LowerThreshold;
-    }
-    if (s == "Delta") {
-        return MonitorEnum::Delta;
-    }
-    if (s == "Periodic") {
-        return MonitorEnum::Periodic;
-    }
-    if (s == "PeriodicClockAligned") {
-        return MonitorEnum::PeriodicClockAligned;
+MonitorEnum string_to_monitor_enum(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "Delta") {
+            return MonitorEnum::Delta;
+        }
+        break;
+    case 8:
+        if (s == "Periodic") {
+            return MonitorEnum::Periodic;
+        }
+        break;
+    case 14:
+        if (s == "UpperThreshold") {
+            return MonitorEnum::UpperThreshold;
+        }
+        if (s == "LowerThreshold") {
+            return MonitorEnum::LowerThreshold;
+        }
+        break;
+    case 20:
+        if (s == "PeriodicClockAligned") {
+            return MonitorEnum::PeriodicClockAligned;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MonitorEnum"};
@@ -2292,15 +2783,21 @@ std::string mutability_enum_to_string(MutabilityEnum e) {
     throw EnumToStringException{e, "MutabilityEnum"};
 }
 
-MutabilityEnum string_to_mutability_enum(const std::string& s) {
-    if (s == "ReadOnly") {
-        return MutabilityEnum::ReadOnly;
-    }
-    if (s == "WriteOnly") {
-        return MutabilityEnum::WriteOnly;
-    }
-    if (s == "ReadWrite") {
-        return MutabilityEnum::ReadWrite;
+MutabilityEnum string_to_mutability_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "ReadOnly") {
+            return MutabilityEnum::ReadOnly;
+        }
+        break;
+    case 9:
+        if (s == "WriteOnly") {
+            return MutabilityEnum::WriteOnly;
+        }
+        if (s == "ReadWrite") {
+            return MutabilityEnum::ReadWrite;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MutabilityEnum"};
@@ -2337,30 +2834,42 @@ std::string data_enum_to_string(DataEnum e) {
     throw EnumToStringException{e, "DataEnum"};
 }
 
-DataEnum string_to_data_enum(const std::string& s) {
-    if (s == "string") {
-        return DataEnum::string;
-    }
-    if (s == "decimal") {
-        return DataEnum::decimal;
-    }
-    if (s == "integer") {
-        return DataEnum::integer;
-    }
-    if (s == "dateTime") {
-        return DataEnum::dateTime;
-    }
-    if (s == "boolean") {
-        return DataEnum::boolean;
-    }
-    if (s == "OptionList") {
-        return DataEnum::OptionList;
-    }
-    if (s == "SequenceList") {
-        return DataEnum::SequenceList;
-    }
-    if (s == "MemberList") {
-        return DataEnum::MemberList;
+DataEnum string_to_data_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "string") {
+            return DataEnum::string;
+        }
+        break;
+    case 7:
+        if (s == "decimal") {
+            return DataEnum::decimal;
+        }
+        if (s == "integer") {
+            return DataEnum::integer;
+        }
+        if (s == "boolean") {
+            return DataEnum::boolean;
+        }
+        break;
+    case 8:
+        if (s == "dateTime") {
+            return DataEnum::dateTime;
+        }
+        break;
+    case 10:
+        if (s == "OptionList") {
+            return DataEnum::OptionList;
+        }
+        if (s == "MemberList") {
+            return DataEnum::MemberList;
+        }
+        break;
+    case 12:
+        if (s == "SequenceList") {
+            return DataEnum::SequenceList;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "DataEnum"};
@@ -2401,36 +2910,56 @@ std::string publish_firmware_status_enum_to_string(PublishFirmwareStatusEnum e)
     throw EnumToStringException{e, "PublishFirmwareStatusEnum"};
 }
 
-PublishFirmwareStatusEnum string_to_publish_firmware_status_enum(const std::string& s) {
-    if (s == "Idle") {
-        return PublishFirmwareStatusEnum::Idle;
-    }
-    if (s == "DownloadScheduled") {
-        return PublishFirmwareStatusEnum::DownloadScheduled;
-    }
-    if (s == "Downloading") {
-        return PublishFirmwareStatusEnum::Downloading;
-    }
-    if (s == "Downloaded") {
-        return PublishFirmwareStatusEnum::Downloaded;
-    }
-    if (s == "Published") {
-        return PublishFirmwareStatusEnum::Published;
-    }
-    if (s == "DownloadFailed") {
-        return PublishFirmwareStatusEnum::DownloadFailed;
-    }
-    if (s == "DownloadPaused") {
-        return PublishFirmwareStatusEnum::DownloadPaused;
-    }
-    if (s == "InvalidChecksum") {
-        return PublishFirmwareStatusEnum::InvalidChecksum;
-    }
-    if (s == "ChecksumVerified") {
-        return PublishFirmwareStatusEnum::ChecksumVerified;
-    }
-    if (s == "PublishFailed") {
-        return PublishFirmwareStatusEnum::PublishFailed;
+PublishFirmwareStatusEnum string_to_publish_firmware_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return PublishFirmwareStatusEnum::Idle;
+        }
+        break;
+    case 9:
+        if (s == "Published") {
+            return PublishFirmwareStatusEnum::Published;
+        }
+        break;
+    case 10:
+        if (s == "Downloaded") {
+            return PublishFirmwareStatusEnum::Downloaded;
+        }
+        break;
+    case 11:
+        if (s == "Downloading") {
+            return PublishFirmwareStatusEnum::Downloading;
+        }
+        break;
+    case 13:
+        if (s == "PublishFailed") {
+            return PublishFirmwareStatusEnum::PublishFailed;
+        }
+        break;
+    case 14:
+        if (s == "DownloadFailed") {
+            return PublishFirmwareStatusEnum::DownloadFailed;
+        }
+        if (s == "DownloadPaused") {
+            return PublishFirmwareStatusEnum::DownloadPaused;
+        }
+        break;
+    case 15:
+        if (s == "InvalidChecksum") {
+            return PublishFirmwareStatusEnum::InvalidChecksum;
+        }
+        break;
+    case 16:
+        if (s == "ChecksumVerified") {
+            return PublishFirmwareStatusEnum::ChecksumVerified;
+        }
+        break;
+    case 17:
+        if (s == "DownloadScheduled") {
+            return PublishFirmwareStatusEnum::DownloadScheduled;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "PublishFirmwareStatusEnum"};
@@ -2457,15 +2986,21 @@ std::string charging_profile_kind_enum_to_string(ChargingProfileKindEnum e) {
     throw EnumToStringException{e, "ChargingProfileKindEnum"};
 }
 
-ChargingProfileKindEnum string_to_charging_profile_kind_enum(const std::string& s) {
-    if (s == "Absolute") {
-        return ChargingProfileKindEnum::Absolute;
-    }
-    if (s == "Recurring") {
-        return ChargingProfileKindEnum::Recurring;
-    }
-    if (s == "Relative") {
-        return ChargingProfileKindEnum::Relative;
+ChargingProfileKindEnum string_to_charging_profile_kind_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Absolute") {
+            return ChargingProfileKindEnum::Absolute;
+        }
+        if (s == "Relative") {
+            return ChargingProfileKindEnum::Relative;
+        }
+        break;
+    case 9:
+        if (s == "Recurring") {
+            return ChargingProfileKindEnum::Recurring;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingProfileKindEnum"};
@@ -2490,12 +3025,18 @@ std::string recurrency_kind_enum_to_string(RecurrencyKindEnum e) {
     throw EnumToStringException{e, "RecurrencyKindEnum"};
 }
 
-RecurrencyKindEnum string_to_recurrency_kind_enum(const std::string& s) {
-    if (s == "Daily") {
-        return RecurrencyKindEnum::Daily;
-    }
-    if (s == "Weekly") {
-        return RecurrencyKindEnum::Weekly;
+RecurrencyKindEnum string_to_recurrency_kind_enum(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "Daily") {
+            return RecurrencyKindEnum::Daily;
+        }
+        break;
+    case 6:
+        if (s == "Weekly") {
+            return RecurrencyKindEnum::Weekly;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "RecurrencyKindEnum"};
@@ -2520,12 +3061,16 @@ std::string request_start_stop_status_enum_to_string(RequestStartStopStatusEnum
     throw EnumToStringException{e, "RequestStartStopStatusEnum"};
 }
 
-RequestStartStopStatusEnum string_to_request_start_stop_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return RequestStartStopStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return RequestStartStopStatusEnum::Rejected;
+RequestStartStopStatusEnum string_to_request_start_stop_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return RequestStartStopStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return RequestStartStopStatusEnum::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "RequestStartStopStatusEnum"};
@@ -2550,12 +3095,16 @@ std::string reservation_update_status_enum_to_string(ReservationUpdateStatusEnum
     throw EnumToStringException{e, "ReservationUpdateStatusEnum"};
 }
 
-ReservationUpdateStatusEnum string_to_reservation_update_status_enum(const std::string& s) {
-    if (s == "Expired") {
-        return ReservationUpdateStatusEnum::Expired;
-    }
-    if (s == "Removed") {
-        return ReservationUpdateStatusEnum::Removed;
+ReservationUpdateStatusEnum string_to_reservation_update_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Expired") {
+            return ReservationUpdateStatusEnum::Expired;
+        }
+        if (s == "Removed") {
+            return ReservationUpdateStatusEnum::Removed;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ReservationUpdateStatusEnum"};
@@ -2620,72 +3169,112 @@ std::string connector_enum_to_string(ConnectorEnum e) {
     throw EnumToStringException{e, "ConnectorEnum"};
 }
 
-ConnectorEnum string_to_connector_enum(const std::string& s) {
-    if (s == "cCCS1") {
-        return ConnectorEnum::cCCS1;
-    }
-    if (s == "cCCS2") {
-        return ConnectorEnum::cCCS2;
-    }
-    if (s == "cG105") {
-        return ConnectorEnum::cG105;
-    }
-    if (s == "cTesla") {
-        return ConnectorEnum::cTesla;
-    }
-    if (s == "cType1") {
-        return ConnectorEnum::cType1;
-    }
-    if (s == "cType2") {
-        return ConnectorEnum::cType2;
-    }
-    if (s == "s309-1P-16A") {
-        return ConnectorEnum::s309_1P_16A;
-    }
-    if (s == "s309-1P-32A") {
-        return ConnectorEnum::s309_1P_32A;
-    }
-    if (s == "s309-3P-16A") {
-        return ConnectorEnum::s309_3P_16A;
-    }
-    if (s == "s309-3P-32A") {
-        return ConnectorEnum::s309_3P_32A;
-    }
-    if (s == "sBS1361") {
-        return ConnectorEnum::sBS1361;
-    }
-    if (s == "sCEE-7-7") {
-        return ConnectorEnum::sCEE_7_7;
-    }
-    if (s == "sType2") {
-        return ConnectorEnum::sType2;
-    }
-    if (s == "sType3") {
-        return ConnectorEnum::sType3;
-    }
-    if (s == "Other1PhMax16A") {
-        return ConnectorEnum::Other1PhMax16A;
-    }
-    if (s == "Other1PhOver16A") {
-        return ConnectorEnum::Other1PhOver16A;
-    }
-    if (s == "Other3Ph") {
-        return ConnectorEnum::Other3Ph;
-    }
-    if (s == "Pan") {
-        return ConnectorEnum::Pan;
-    }
-    if (s == "wInductive") {
-        return ConnectorEnum::wInductive;
-    }
-    if (s == "wResonant") {
-        return ConnectorEnum::wResonant;
-    }
-    if (s == "Undetermined") {
-        return ConnectorEnum::Undetermined;
-    }
-    if (s == "Unknown") {
-        return ConnectorEnum::Unknown;
+ConnectorEnum string_to_connector_enum(std::string_view s) {
+    switch (s.size()) {
+    case 3:
+        if (s == "Pan") {
+            return ConnectorEnum::Pan;
+        }
+        break;
+    case 5:
+        if (s == "cCCS1") {
+            return ConnectorEnum::cCCS1;
+        }
+        if (s == "cCCS2") {
+            return ConnectorEnum::cCCS2;
+        }
+        if (s == "cG105") {
+            return ConnectorEnum::cG105;
+        }
+        break;
+    case 6:
+        switch (s[5]) {
+        case 'a':
+            if (s == "cTesla") {
+                return ConnectorEnum::cTesla;
+            }
+            break;
+        case '1':
+            if (s == "cType1") {
+                return ConnectorEnum::cType1;
+            }
+            break;
+        case '2':
+            if (s == "cType2") {
+                return ConnectorEnum::cType2;
+            }
+            if (s == "sType2") {
+                return ConnectorEnum::sType2;
+            }
+            break;
+        case '3':
+            if (s == "sType3") {
+                return ConnectorEnum::sType3;
+            }
+            break;
+        }
+        break;
+    case 7:
+        if (s == "sBS1361") {
+            return ConnectorEnum::sBS1361;
+        }
+        if (s == "Unknown") {
+            return ConnectorEnum::Unknown;
+        }
+        break;
+    case 8:
+        if (s == "sCEE-7-7") {
+            return ConnectorEnum::sCEE_7_7;
+        }
+        if (s == "Other3Ph") {
+            return ConnectorEnum::Other3Ph;
+        }
+        break;
+    case 9:
+        if (s == "wResonant") {
+            return ConnectorEnum::wResonant;
+        }
+        break;
+    case 10:
+        if (s == "wInductive") {
+            return ConnectorEnum::wInductive;
+        }
+        break;
+    case 11:
+        switch (s[5]) {
+        case '1':
+            if (s == "s309-1P-16A") {
+                return ConnectorEnum::s309_1P_16A;
+            }
+            if (s == "s309-1P-32A") {
+                return ConnectorEnum::s309_1P_32A;
+            }
+            break;
+        case '3':
+            if (s == "s309-3P-16A") {
+                return ConnectorEnum::s309_3P_16A;
+            }
+            if (s == "s309-3P-32A") {
+                return ConnectorEnum::s309_3P_32A;
+            }
+            break;
+        }
+        break;
+    case 12:
+        if (s == "Undetermined") {
+            return ConnectorEnum::Undetermined;
+        }
+        break;
+    case 14:
+        if (s == "Other1PhMax16A") {
+            return ConnectorEnum::Other1PhMax16A;
+        }
+        break;
+    case 15:
+        if (s == "Other1PhOver16A") {
+            return ConnectorEnum::Other1PhOver16A;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ConnectorEnum"};
@@ -2716,21 +3305,29 @@ std::string reserve_now_status_enum_to_string(ReserveNowStatusEnum e) {
     throw EnumToStringException{e, "ReserveNowStatusEnum"};
 }
 
-ReserveNowStatusEnum string_to_reserve_now_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ReserveNowStatusEnum::Accepted;
-    }
-    if (s == "Faulted") {
-        return ReserveNowStatusEnum::Faulted;
-    }
-    if (s == "Occupied") {
-        return ReserveNowStatusEnum::Occupied;
-    }
-    if (s == "Rejected") {
-        return ReserveNowStatusEnum::Rejected;
-    }
-    if (s == "Unavailable") {
-        return ReserveNowStatusEnum::Unavailable;
+ReserveNowStatusEnum string_to_reserve_now_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Faulted") {
+            return ReserveNowStatusEnum::Faulted;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return ReserveNowStatusEnum::Accepted;
+        }
+        if (s == "Occupied") {
+            return ReserveNowStatusEnum::Occupied;
+        }
+        if (s == "Rejected") {
+            return ReserveNowStatusEnum::Rejected;
+        }
+        break;
+    case 11:
+        if (s == "Unavailable") {
+            return ReserveNowStatusEnum::Unavailable;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ReserveNowStatusEnum"};
@@ -2755,12 +3352,18 @@ std::string reset_enum_to_string(ResetEnum e) {
     throw EnumToStringException{e, "ResetEnum"};
 }
 
-ResetEnum string_to_reset_enum(const std::string& s) {
-    if (s == "Immediate") {
-        return ResetEnum::Immediate;
-    }
-    if (s == "OnIdle") {
-        return ResetEnum::OnIdle;
+ResetEnum string_to_reset_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "OnIdle") {
+            return ResetEnum::OnIdle;
+        }
+        break;
+    case 9:
+        if (s == "Immediate") {
+            return ResetEnum::Immediate;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ResetEnum"};
@@ -2787,15 +3390,21 @@ std::string reset_status_enum_to_string(ResetStatusEnum e) {
     throw EnumToStringException{e, "ResetStatusEnum"};
 }
 
-ResetStatusEnum string_to_reset_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ResetStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return ResetStatusEnum::Rejected;
-    }
-    if (s == "Scheduled") {
-        return ResetStatusEnum::Scheduled;
+ResetStatusEnum string_to_reset_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return ResetStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return ResetStatusEnum::Rejected;
+        }
+        break;
+    case 9:
+        if (s == "Scheduled") {
+            return ResetStatusEnum::Scheduled;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ResetStatusEnum"};
@@ -2820,12 +3429,18 @@ std::string update_enum_to_string(UpdateEnum e) {
     throw EnumToStringException{e, "UpdateEnum"};
 }
 
-UpdateEnum string_to_update_enum(const std::string& s) {
-    if (s == "Differential") {
-        return UpdateEnum::Differential;
-    }
-    if (s == "Full") {
-        return UpdateEnum::Full;
+UpdateEnum string_to_update_enum(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Full") {
+            return UpdateEnum::Full;
+        }
+        break;
+    case 12:
+        if (s == "Differential") {
+            return UpdateEnum::Differential;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UpdateEnum"};
@@ -2852,15 +3467,23 @@ std::string send_local_list_status_enum_to_string(SendLocalListStatusEnum e) {
     throw EnumToStringException{e, "SendLocalListStatusEnum"};
 }
 
-SendLocalListStatusEnum string_to_send_local_list_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return SendLocalListStatusEnum::Accepted;
-    }
-    if (s == "Failed") {
-        return SendLocalListStatusEnum::Failed;
-    }
-    if (s == "VersionMismatch") {
-        return SendLocalListStatusEnum::VersionMismatch;
+SendLocalListStatusEnum string_to_send_local_list_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return SendLocalListStatusEnum::Failed;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return SendLocalListStatusEnum::Accepted;
+        }
+        break;
+    case 15:
+        if (s == "VersionMismatch") {
+            return SendLocalListStatusEnum::VersionMismatch;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "SendLocalListStatusEnum"};
@@ -2885,12 +3508,16 @@ std::string charging_profile_status_enum_to_string(ChargingProfileStatusEnum e)
     throw EnumToStringException{e, "ChargingProfileStatusEnum"};
 }
 
-ChargingProfileStatusEnum string_to_charging_profile_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ChargingProfileStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return ChargingProfileStatusEnum::Rejected;
+ChargingProfileStatusEnum string_to_charging_profile_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return ChargingProfileStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return ChargingProfileStatusEnum::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingProfileStatusEnum"};
@@ -2923,24 +3550,36 @@ std::string display_message_status_enum_to_string(DisplayMessageStatusEnum e) {
     throw EnumToStringException{e, "DisplayMessageStatusEnum"};
 }
 
-DisplayMessageStatusEnum string_to_display_message_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return DisplayMessageStatusEnum::Accepted;
-    }
-    if (s == "NotSupportedMessageFormat") {
-        return DisplayMessageStatusEnum::NotSupportedMessageFormat;
-    }
-    if (s == "Rejected") {
-        return DisplayMessageStatusEnum::Rejected;
-    }
-    if (s == "NotSupportedPriority") {
-        return DisplayMessageStatusEnum::NotSupportedPriority;
-    }
-    if (s == "NotSupportedState") {
-        return DisplayMessageStatusEnum::NotSupportedState;
-    }
-    if (s == "UnknownTransaction") {
-        return DisplayMessageStatusEnum::UnknownTransaction;
+DisplayMessageStatusEnum string_to_display_message_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return DisplayMessageStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return DisplayMessageStatusEnum::Rejected;
+        }
+        break;
+    case 17:
+        if (s == "NotSupportedState") {
+            return DisplayMessageStatusEnum::NotSupportedState;
+        }
+        break;
+    case 18:
+        if (s == "UnknownTransaction") {
+            return DisplayMessageStatusEnum::UnknownTransaction;
+        }
+        break;
+    case 20:
+        if (s == "NotSupportedPriority") {
+            return DisplayMessageStatusEnum::NotSupportedPriority;
+        }
+        break;
+    case 25:
+        if (s == "NotSupportedMessageFormat") {
+            return DisplayMessageStatusEnum::NotSupportedMessageFormat;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "DisplayMessageStatusEnum"};
@@ -2967,15 +3606,23 @@ std::string monitoring_base_enum_to_string(MonitoringBaseEnum e) {
     throw EnumToStringException{e, "MonitoringBaseEnum"};
 }
 
-MonitoringBaseEnum string_to_monitoring_base_enum(const std::string& s) {
-    if (s == "All") {
-        return MonitoringBaseEnum::All;
-    }
-    if (s == "FactoryDefault") {
-        return MonitoringBaseEnum::FactoryDefault;
-    }
-    if (s == "HardWiredOnly") {
-        return MonitoringBaseEnum::HardWiredOnly;
+MonitoringBaseEnum string_to_monitoring_base_enum(std::string_view s) {
+    switch (s.size()) {
+    case 3:
+        if (s == "All") {
+            return MonitoringBaseEnum::All;
+        }
+        break;
+    case 13:
+        if (s == "HardWiredOnly") {
+            return MonitoringBaseEnum::HardWiredOnly;
+        }
+        break;
+    case 14:
+        if (s == "FactoryDefault") {
+            return MonitoringBaseEnum::FactoryDefault;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MonitoringBaseEnum"};
@@ -3004,18 +3651,24 @@ std::string apnauthentication_enum_to_string(APNAuthenticationEnum e) {
     throw EnumToStringException{e, "APNAuthenticationEnum"};
 }
 
-APNAuthenticationEnum string_to_apnauthentication_enum(const std::string& s) {
-    if (s == "CHAP") {
-        return APNAuthenticationEnum::CHAP;
-    }
-    if (s == "NONE") {
-        return APNAuthenticationEnum::NONE;
-    }
-    if (s == "PAP") {
-        return APNAuthenticationEnum::PAP;
-    }
-    if (s == "AUTO") {
-        return APNAuthenticationEnum::AUTO;
+APNAuthenticationEnum string_to_apnauthentication_enum(std::string_view s) {
+    switch (s.size()) {
+    case 3:
+        if (s == "PAP") {
+            return APNAuthenticationEnum::PAP;
+        }
+        break;
+    case 4:
+        if (s == "CHAP") {
+            return APNAuthenticationEnum::CHAP;
+        }
+        if (s == "NONE") {
+            return APNAuthenticationEnum::NONE;
+        }
+        if (s == "AUTO") {
+            return APNAuthenticationEnum::AUTO;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "APNAuthenticationEnum"};
@@ -3044,18 +3697,32 @@ std::string ocppversion_enum_to_string(OCPPVersionEnum e) {
     throw EnumToStringException{e, "OCPPVersionEnum"};
 }
 
-OCPPVersionEnum string_to_ocppversion_enum(const std::string& s) {
-    if (s == "OCPP12") {
-        return OCPPVersionEnum::OCPP12;
-    }
-    if (s == "OCPP15") {
-        return OCPPVersionEnum::OCPP15;
-    }
-    if (s == "OCPP16") {
-        return OCPPVersionEnum::OCPP16;
-    }
-    if (s == "OCPP20") {
-        return OCPPVersionEnum::OCPP20;
+OCPPVersionEnum string_to_ocppversion_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        switch (s[5]) {
+        case '2':
+            if (s == "OCPP12") {
+                return OCPPVersionEnum::OCPP12;
+            }
+            break;
+        case '5':
+            if (s == "OCPP15") {
+                return OCPPVersionEnum::OCPP15;
+            }
+            break;
+        case '6':
+            if (s == "OCPP16") {
+                return OCPPVersionEnum::OCPP16;
+            }
+            break;
+        case '0':
+            if (s == "OCPP20") {
+                return OCPPVersionEnum::OCPP20;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "OCPPVersionEnum"};
@@ -3080,12 +3747,16 @@ std::string ocpptransport_enum_to_string(OCPPTransportEnum e) {
     throw EnumToStringException{e, "OCPPTransportEnum"};
 }
 
-OCPPTransportEnum string_to_ocpptransport_enum(const std::string& s) {
-    if (s == "JSON") {
-        return OCPPTransportEnum::JSON;
-    }
-    if (s == "SOAP") {
-        return OCPPTransportEnum::SOAP;
+OCPPTransportEnum string_to_ocpptransport_enum(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "JSON") {
+            return OCPPTransportEnum::JSON;
+        }
+        if (s == "SOAP") {
+            return OCPPTransportEnum::SOAP;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "OCPPTransportEnum"};
@@ -3122,30 +3793,56 @@ std::string ocppinterface_enum_to_string(OCPPInterfaceEnum e) {
     throw EnumToStringException{e, "OCPPInterfaceEnum"};
 }
 
-OCPPInterfaceEnum string_to_ocppinterface_enum(const std::string& s) {
-    if (s == "Wired0") {
-        return OCPPInterfaceEnum::Wired0;
-    }
-    if (s == "Wired1") {
-        return OCPPInterfaceEnum::Wired1;
-    }
-    if (s == "Wired2") {
-        return OCPPInterfaceEnum::Wired2;
-    }
-    if (s == "Wired3") {
-        return OCPPInterfaceEnum::Wired3;
-    }
-    if (s == "Wireless0") {
-        return OCPPInterfaceEnum::Wireless0;
-    }
-    if (s == "Wireless1") {
-        return OCPPInterfaceEnum::Wireless1;
-    }
-    if (s == "Wireless2") {
-        return OCPPInterfaceEnum::Wireless2;
-    }
-    if (s == "Wireless3") {
-        return OCPPInterfaceEnum::Wireless3;
+OCPPInterfaceEnum string_to_ocppinterface_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        switch (s[5]) {
+        case '0':
+            if (s == "Wired0") {
+                return OCPPInterfaceEnum::Wired0;
+            }
+            break;
+        case '1':
+            if (s == "Wired1") {
+                return OCPPInterfaceEnum::Wired1;
+            }
+            break;
+        case '2':
+            if (s == "Wired2") {
+                return OCPPInterfaceEnum::Wired2;
+            }
+            break;
+        case '3':
+            if (s == "Wired3") {
+                return OCPPInterfaceEnum::Wired3;
+            }
+            break;
+        }
+        break;
+    case 9:
+        switch (s[8]) {
+        case '0':
+            if (s == "Wireless0") {
+                return OCPPInterfaceEnum::Wireless0;
+            }
+            break;
+        case '1':
+            if (s == "Wireless1") {
+                return OCPPInterfaceEnum::Wireless1;
+            }
+            break;
+        case '2':
+            if (s == "Wireless2") {
+                return OCPPInterfaceEnum::Wireless2;
+            }
+            break;
+        case '3':
+            if (s == "Wireless3") {
+                return OCPPInterfaceEnum::Wireless3;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "OCPPInterfaceEnum"};
@@ -3174,18 +3871,24 @@ std::string vpnenum_to_string(VPNEnum e) {
     throw EnumToStringException{e, "VPNEnum"};
 }
 
-VPNEnum string_to_vpnenum(const std::string& s) {
-    if (s == "IKEv2") {
-        return VPNEnum::IKEv2;
-    }
-    if (s == "IPSec") {
-        return VPNEnum::IPSec;
-    }
-    if (s == "L2TP") {
-        return VPNEnum::L2TP;
-    }
-    if (s == "PPTP") {
-        return VPNEnum::PPTP;
+VPNEnum string_to_vpnenum(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "L2TP") {
+            return VPNEnum::L2TP;
+        }
+        if (s == "PPTP") {
+            return VPNEnum::PPTP;
+        }
+        break;
+    case 5:
+        if (s == "IKEv2") {
+            return VPNEnum::IKEv2;
+        }
+        if (s == "IPSec") {
+            return VPNEnum::IPSec;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "VPNEnum"};
@@ -3212,15 +3915,21 @@ std::string set_network_profile_status_enum_to_string(SetNetworkProfileStatusEnu
     throw EnumToStringException{e, "SetNetworkProfileStatusEnum"};
 }
 
-SetNetworkProfileStatusEnum string_to_set_network_profile_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return SetNetworkProfileStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return SetNetworkProfileStatusEnum::Rejected;
-    }
-    if (s == "Failed") {
-        return SetNetworkProfileStatusEnum::Failed;
+SetNetworkProfileStatusEnum string_to_set_network_profile_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return SetNetworkProfileStatusEnum::Failed;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return SetNetworkProfileStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return SetNetworkProfileStatusEnum::Rejected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "SetNetworkProfileStatusEnum"};
@@ -3253,24 +3962,36 @@ std::string set_monitoring_status_enum_to_string(SetMonitoringStatusEnum e) {
     throw EnumToStringException{e, "SetMonitoringStatusEnum"};
 }
 
-SetMonitoringStatusEnum string_to_set_monitoring_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return SetMonitoringStatusEnum::Accepted;
-    }
-    if (s == "UnknownComponent") {
-        return SetMonitoringStatusEnum::UnknownComponent;
-    }
-    if (s == "UnknownVariable") {
-        return SetMonitoringStatusEnum::UnknownVariable;
-    }
-    if (s == "UnsupportedMonitorType") {
-        return SetMonitoringStatusEnum::UnsupportedMonitorType;
-    }
-    if (s == "Rejected") {
-        return SetMonitoringStatusEnum::Rejected;
-    }
-    if (s == "Duplicate") {
-        return SetMonitoringStatusEnum::Duplicate;
+SetMonitoringStatusEnum string_to_set_monitoring_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return SetMonitoringStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return SetMonitoringStatusEnum::Rejected;
+        }
+        break;
+    case 9:
+        if (s == "Duplicate") {
+            return SetMonitoringStatusEnum::Duplicate;
+        }
+        break;
+    case 15:
+        if (s == "UnknownVariable") {
+            return SetMonitoringStatusEnum::UnknownVariable;
+        }
+        break;
+    case 16:
+        if (s == "UnknownComponent") {
+            return SetMonitoringStatusEnum::UnknownComponent;
+        }
+        break;
+    case 22:
+        if (s == "UnsupportedMonitorType") {
+            return SetMonitoringStatusEnum::UnsupportedMonitorType;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "SetMonitoringStatusEnum"};
@@ -3303,24 +4024,36 @@ std::string set_variable_status_enum_to_string(SetVariableStatusEnum e) {
     throw EnumToStringException{e, "SetVariableStatusEnum"};
 }
 
-SetVariableStatusEnum string_to_set_variable_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return SetVariableStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return SetVariableStatusEnum::Rejected;
-    }
-    if (s == "UnknownComponent") {
-        return SetVariableStatusEnum::UnknownComponent;
-    }
-    if (s == "UnknownVariable") {
-        return SetVariableStatusEnum::UnknownVariable;
-    }
-    if (s == "NotSupportedAttributeType") {
-        return SetVariableStatusEnum::NotSupportedAttributeType;
-    }
-    if (s == "RebootRequired") {
-        return SetVariableStatusEnum::RebootRequired;
+SetVariableStatusEnum string_to_set_variable_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return SetVariableStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return SetVariableStatusEnum::Rejected;
+        }
+        break;
+    case 14:
+        if (s == "RebootRequired") {
+            return SetVariableStatusEnum::RebootRequired;
+        }
+        break;
+    case 15:
+        if (s == "UnknownVariable") {
+            return SetVariableStatusEnum::UnknownVariable;
+        }
+        break;
+    case 16:
+        if (s == "UnknownComponent") {
+            return SetVariableStatusEnum::UnknownComponent;
+        }
+        break;
+    case 25:
+        if (s == "NotSupportedAttributeType") {
+            return SetVariableStatusEnum::NotSupportedAttributeType;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "SetVariableStatusEnum"};
@@ -3351,21 +4084,31 @@ std::string connector_status_enum_to_string(ConnectorStatusEnum e) {
     throw EnumToStringException{e, "ConnectorStatusEnum"};
 }
 
-ConnectorStatusEnum string_to_connector_status_enum(const std::string& s) {
-    if (s == "Available") {
-        return ConnectorStatusEnum::Available;
-    }
-    if (s == "Occupied") {
-        return ConnectorStatusEnum::Occupied;
-    }
-    if (s == "Reserved") {
-        return ConnectorStatusEnum::Reserved;
-    }
-    if (s == "Unavailable") {
-        return ConnectorStatusEnum::Unavailable;
-    }
-    if (s == "Faulted") {
-        return ConnectorStatusEnum::Faulted;
+ConnectorStatusEnum string_to_connector_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Faulted") {
+            return ConnectorStatusEnum::Faulted;
+        }
+        break;
+    case 8:
+        if (s == "Occupied") {
+            return ConnectorStatusEnum::Occupied;
+        }
+        if (s == "Reserved") {
+            return ConnectorStatusEnum::Reserved;
+        }
+        break;
+    case 9:
+        if (s == "Available") {
+            return ConnectorStatusEnum::Available;
+        }
+        break;
+    case 11:
+        if (s == "Unavailable") {
+            return ConnectorStatusEnum::Unavailable;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ConnectorStatusEnum"};
@@ -3392,15 +4135,21 @@ std::string transaction_event_enum_to_string(TransactionEventEnum e) {
     throw EnumToStringException{e, "TransactionEventEnum"};
 }
 
-TransactionEventEnum string_to_transaction_event_enum(const std::string& s) {
-    if (s == "Ended") {
-        return TransactionEventEnum::Ended;
-    }
-    if (s == "Started") {
-        return TransactionEventEnum::Started;
-    }
-    if (s == "Updated") {
-        return TransactionEventEnum::Updated;
+TransactionEventEnum string_to_transaction_event_enum(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "Ended") {
+            return TransactionEventEnum::Ended;
+        }
+        break;
+    case 7:
+        if (s == "Started") {
+            return TransactionEventEnum::Started;
+        }
+        if (s == "Updated") {
+            return TransactionEventEnum::Updated;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "TransactionEventEnum"};
@@ -3463,69 +4212,105 @@ std::string trigger_reason_enum_to_string(TriggerReasonEnum e) {
     throw EnumToStringException{e, "TriggerReasonEnum"};
 }
 
-TriggerReasonEnum string_to_trigger_reason_enum(const std::string& s) {
-    if (s == "Authorized") {
-        return TriggerReasonEnum::Authorized;
-    }
-    if (s == "CablePluggedIn") {
-        return TriggerReasonEnum::CablePluggedIn;
-    }
-    if (s == "ChargingRateChanged") {
-        return TriggerReasonEnum::ChargingRateChanged;
-    }
-    if (s == "ChargingStateChanged") {
-        return TriggerReasonEnum::ChargingStateChanged;
-    }
-    if (s == "Deauthorized") {
-        return TriggerReasonEnum::Deauthorized;
-    }
-    if (s == "EnergyLimitReached") {
-        return TriggerReasonEnum::EnergyLimitReached;
-    }
-    if (s == "EVCommunicationLost") {
-        return TriggerReasonEnum::EVCommunicationLost;
-    }
-    if (s == "EVConnectTimeout") {
-        return TriggerReasonEnum::EVConnectTimeout;
-    }
-    if (s == "MeterValueClock") {
-        return TriggerReasonEnum::MeterValueClock;
-    }
-    if (s == "MeterValuePeriodic") {
-        return TriggerReasonEnum::MeterValuePeriodic;
-    }
-    if (s == "TimeLimitReached") {
-        return TriggerReasonEnum::TimeLimitReached;
-    }
-    if (s == "Trigger") {
-        return TriggerReasonEnum::Trigger;
-    }
-    if (s == "UnlockCommand") {
-        return TriggerReasonEnum::UnlockCommand;
-    }
-    if (s == "StopAuthorized") {
-        return TriggerReasonEnum::StopAuthorized;
-    }
-    if (s == "EVDeparted") {
-        return TriggerReasonEnum::EVDeparted;
-    }
-    if (s == "EVDetected") {
-        return TriggerReasonEnum::EVDetected;
-    }
-    if (s == "RemoteStop") {
-        return TriggerReasonEnum::RemoteStop;
-    }
-    if (s == "RemoteStart") {
-        return TriggerReasonEnum::RemoteStart;
-    }
-    if (s == "AbnormalCondition") {
-        return TriggerReasonEnum::AbnormalCondition;
-    }
-    if (s == "SignedDataReceived") {
-        return TriggerReasonEnum::SignedDataReceived;
-    }
-    if (s == "ResetCommand") {
-        return TriggerReasonEnum::ResetCommand;
+TriggerReasonEnum string_to_trigger_reason_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Trigger") {
+            return TriggerReasonEnum::Trigger;
+        }
+        break;
+    case 10:
+        switch (s[6]) {
+        case 'i':
+            if (s == "Authorized") {
+                return TriggerReasonEnum::Authorized;
+            }
+            break;
+        case 'r':
+            if (s == "EVDeparted") {
+                return TriggerReasonEnum::EVDeparted;
+            }
+            break;
+        case 'c':
+            if (s == "EVDetected") {
+                return TriggerReasonEnum::EVDetected;
+            }
+            break;
+        case 'S':
+            if (s == "RemoteStop") {
+                return TriggerReasonEnum::RemoteStop;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if (s == "RemoteStart") {
+            return TriggerReasonEnum::RemoteStart;
+        }
+        break;
+    case 12:
+        if (s == "Deauthorized") {
+            return TriggerReasonEnum::Deauthorized;
+        }
+        if (s == "ResetCommand") {
+            return TriggerReasonEnum::ResetCommand;
+        }
+        break;
+    case 13:
+        if (s == "UnlockCommand") {
+            return TriggerReasonEnum::UnlockCommand;
+        }
+        break;
+    case 14:
+        if (s == "CablePluggedIn") {
+            return TriggerReasonEnum::CablePluggedIn;
+        }
+        if (s == "StopAuthorized") {
+            return TriggerReasonEnum::StopAuthorized;
+        }
+        break;
+    case 15:
+        if (s == "MeterValueClock") {
+            return TriggerReasonEnum::MeterValueClock;
+        }
+        break;
+    case 16:
+        if (s == "EVConnectTimeout") {
+            return TriggerReasonEnum::EVConnectTimeout;
+        }
+        if (s == "TimeLimitReached") {
+            return TriggerReasonEnum::TimeLimitReached;
+        }
+        break;
+    case 17:
+        if (s == "AbnormalCondition") {
+            return TriggerReasonEnum::AbnormalCondition;
+        }
+        break;
+    case 18:
+        if (s == "EnergyLimitReached") {
+            return TriggerReasonEnum::EnergyLimitReached;
+        }
+        if (s == "MeterValuePeriodic") {
+            return TriggerReasonEnum::MeterValuePeriodic;
+        }
+        if (s == "SignedDataReceived") {
+            return TriggerReasonEnum::SignedDataReceived;
+        }
+        break;
+    case 19:
+        if (s == "ChargingRateChanged") {
+            return TriggerReasonEnum::ChargingRateChanged;
+        }
+        if (s == "EVCommunicationLost") {
+            return TriggerReasonEnum::EVCommunicationLost;
+        }
+        break;
+    case 20:
+        if (s == "ChargingStateChanged") {
+            return TriggerReasonEnum::ChargingStateChanged;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "TriggerReasonEnum"};
@@ -3556,21 +4341,31 @@ std::string charging_state_enum_to_string(ChargingStateEnum e) {
     throw EnumToStringException{e, "ChargingStateEnum"};
 }
 
-ChargingStateEnum string_to_charging_state_enum(const std::string& s) {
-    if (s == "Charging") {
-        return ChargingStateEnum::Charging;
-    }
-    if (s == "EVConnected") {
-        return ChargingStateEnum::EVConnected;
-    }
-    if (s == "SuspendedEV") {
-        return ChargingStateEnum::SuspendedEV;
-    }
-    if (s == "SuspendedEVSE") {
-        return ChargingStateEnum::SuspendedEVSE;
-    }
-    if (s == "Idle") {
-        return ChargingStateEnum::Idle;
+ChargingStateEnum string_to_charging_state_enum(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return ChargingStateEnum::Idle;
+        }
+        break;
+    case 8:
+        if (s == "Charging") {
+            return ChargingStateEnum::Charging;
+        }
+        break;
+    case 11:
+        if (s == "EVConnected") {
+            return ChargingStateEnum::EVConnected;
+        }
+        if (s == "SuspendedEV") {
+            return ChargingStateEnum::SuspendedEV;
+        }
+        break;
+    case 13:
+        if (s == "SuspendedEVSE") {
+            return ChargingStateEnum::SuspendedEVSE;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingStateEnum"};
@@ -3629,63 +4424,89 @@ std::string reason_enum_to_string(ReasonEnum e) {
     throw EnumToStringException{e, "ReasonEnum"};
 }
 
-ReasonEnum string_to_reason_enum(const std::string& s) {
-    if (s == "DeAuthorized") {
-        return ReasonEnum::DeAuthorized;
-    }
-    if (s == "EmergencyStop") {
-        return ReasonEnum::EmergencyStop;
-    }
-    if (s == "EnergyLimitReached") {
-        return ReasonEnum::EnergyLimitReached;
-    }
-    if (s == "EVDisconnected") {
-        return ReasonEnum::EVDisconnected;
-    }
-    if (s == "GroundFault") {
-        return ReasonEnum::GroundFault;
-    }
-    if (s == "ImmediateReset") {
-        return ReasonEnum::ImmediateReset;
-    }
-    if (s == "Local") {
-        return ReasonEnum::Local;
-    }
-    if (s == "LocalOutOfCredit") {
-        return ReasonEnum::LocalOutOfCredit;
-    }
-    if (s == "MasterPass") {
-        return ReasonEnum::MasterPass;
-    }
-    if (s == "Other") {
-        return ReasonEnum::Other;
-    }
-    if (s == "OvercurrentFault") {
-        return ReasonEnum::OvercurrentFault;
-    }
-    if (s == "PowerLoss") {
-        return ReasonEnum::PowerLoss;
-    }
-    if (s == "PowerQuality") {
-        return ReasonEnum::PowerQuality;
-    }
-    if (s == "Reboot") {
-        return ReasonEnum::Reboot;
-    }
-    if (s == "Remote") {
-        return ReasonEnum::Remote;
-    }
-    if (s == "SOCLimitReached") {
-        return ReasonEnum::SOCLimitReached;
-    }
-    if (s == "StoppedByEV") {
-        return ReasonEnum::StoppedByEV;
-    }
-    if (s == "TimeLimitReached") {
-        return ReasonEnum::TimeLimitReached;
-    }
-    if (s == "Timeout") {
-        return ReasonEnum::Timeout;
+ReasonEnum string_to_reason_enum(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "Local") {
+            return ReasonEnum::Local;
+        }
+        if (s == "Other") {
+            return ReasonEnum::Other;
+        }
+        break;
+    case 6:
+        if (s == "Reboot") {
+            return ReasonEnum::Reboot;
+        }
+        if (s == "Remote") {
+            return ReasonEnum::Remote;
+        }
+        break;
+    case 7:
+        if (s == "Timeout") {
+            return ReasonEnum::Timeout;
+        }
+        break;
+    case 9:
+        if (s == "PowerLoss") {
+            return ReasonEnum::PowerLoss;
+        }
+        break;
+    case 10:
+        if (s == "MasterPass") {
+            return ReasonEnum::MasterPass;
+        }
+        break;
+    case 11:
+        if (s == "GroundFault") {
+            return ReasonEnum::GroundFault;
+        }
+        if (s == "StoppedByEV") {
+            return ReasonEnum::StoppedByEV;
+        }
+        break;
+    case 12:
+        if (s == "DeAuthorized") {
+            return ReasonEnum::DeAuthorized;
+        }
+        if (s == "PowerQuality") {
+            return ReasonEnum::PowerQuality;
+        }
+        break;
+    case 13:
+        if (s == "EmergencyStop") {
+            return ReasonEnum::EmergencyStop;
+        }
+        break;
+    case 14:
+        if (s == "EVDisconnected") {
+            return ReasonEnum::EVDisconnected;
+        }
+        if (s == "ImmediateReset") {
+            return ReasonEnum::ImmediateReset;
+        }
+        break;
+    case 15:
+        if (s == "SOCLimitReached") {
+            return ReasonEnum::SOCLimitReached;
+        }
+        break;
+    case 16:
+        if (s == "LocalOutOfCredit") {
+            return ReasonEnum::LocalOutOfCredit;
+        }
+        if (s == "OvercurrentFault") {
+            return ReasonEnum::OvercurrentFault;
+        }
+        if (s == "TimeLimitReached") {
+            return ReasonEnum::TimeLimitReached;
+        }
+        break;
+    case 18:
+        if (s == "EnergyLimitReached") {
+            return ReasonEnum::EnergyLimitReached;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ReasonEnum"};
@@ -3728,39 +4549,59 @@ std::string message_trigger_enum_to_string(MessageTriggerEnum e) {
     throw EnumToStringException{e, "MessageTriggerEnum"};
 }
 
-MessageTriggerEnum string_to_message_trigger_enum(const std::string& s) {
-    if (s == "BootNotification") {
-        return MessageTriggerEnum::BootNotification;
-    }
-    if (s == "LogStatusNotification") {
-        return MessageTriggerEnum::LogStatusNotification;
-    }
-    if (s == "FirmwareStatusNotification") {
-        return MessageTriggerEnum::FirmwareStatusNotification;
-    }
-    if (s == "Heartbeat") {
-        return MessageTriggerEnum::Heartbeat;
-    }
-    if (s == "MeterValues") {
-        return MessageTriggerEnum::MeterValues;
-    }
-    if (s == "SignChargingStationCertificate") {
-        return MessageTriggerEnum::SignChargingStationCertificate;
-    }
-    if (s == "SignV2GCertificate") {
-        return MessageTriggerEnum::SignV2GCertificate;
-    }
-    if (s == "StatusNotification") {
-        return MessageTriggerEnum::StatusNotification;
-    }
-    if (s == "TransactionEvent") {
-        return MessageTriggerEnum::TransactionEvent;
-    }
-    if (s == "SignCombinedCertificate") {
-        return MessageTriggerEnum::SignCombinedCertificate;
-    }
-    if (s == "PublishFirmwareStatusNotification") {
-        return MessageTriggerEnum::PublishFirmwareStatusNotification;
+MessageTriggerEnum string_to_message_trigger_enum(std::string_view s) {
+    switch (s.size()) {
+    case 9:
+        if (s == "Heartbeat") {
+            return MessageTriggerEnum::Heartbeat;
+        }
+        break;
+    case 11:
+        if (s == "MeterValues") {
+            return MessageTriggerEnum::MeterValues;
+        }
+        break;
+    case 16:
+        if (s == "BootNotification") {
+            return MessageTriggerEnum::BootNotification;
+        }
+        if (s == "TransactionEvent") {
+            return MessageTriggerEnum::TransactionEvent;
+        }
+        break;
+    case 18:
+        if (s == "SignV2GCertificate") {
+            return MessageTriggerEnum::SignV2GCertificate;
+        }
+        if (s == "StatusNotification") {
+            return MessageTriggerEnum::StatusNotification;
+        }
+        break;
+    case 21:
+        if (s == "LogStatusNotification") {
+            return MessageTriggerEnum::LogStatusNotification;
+        }
+        break;
+    case 23:
+        if (s == "SignCombinedCertificate") {
+            return MessageTriggerEnum::SignCombinedCertificate;
+        }
+        break;
+    case 26:
+        if (s == "FirmwareStatusNotification") {
+            return MessageTriggerEnum::FirmwareStatusNotification;
+        }
+        break;
+    case 30:
+        if (s == "SignChargingStationCertificate") {
+            return MessageTriggerEnum::SignChargingStationCertificate;
+        }
+        break;
+    case 33:
+        if (s == "PublishFirmwareStatusNotification") {
+            return MessageTriggerEnum::PublishFirmwareStatusNotification;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MessageTriggerEnum"};
@@ -3787,15 +4628,21 @@ std::string trigger_message_status_enum_to_string(TriggerMessageStatusEnum e) {
     throw EnumToStringException{e, "TriggerMessageStatusEnum"};
 }
 
-TriggerMessageStatusEnum string_to_trigger_message_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return TriggerMessageStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return TriggerMessageStatusEnum::Rejected;
-    }
-    if (s == "NotImplemented") {
-        return TriggerMessageStatusEnum::NotImplemented;
+TriggerMessageStatusEnum string_to_trigger_message_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return TriggerMessageStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return TriggerMessageStatusEnum::Rejected;
+        }
+        break;
+    case 14:
+        if (s == "NotImplemented") {
+            return TriggerMessageStatusEnum::NotImplemented;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "TriggerMessageStatusEnum"};
@@ -3824,18 +4671,28 @@ std::string unlock_status_enum_to_string(UnlockStatusEnum e) {
     throw EnumToStringException{e, "UnlockStatusEnum"};
 }
 
-UnlockStatusEnum string_to_unlock_status_enum(const std::string& s) {
-    if (s == "Unlocked") {
-        return UnlockStatusEnum::Unlocked;
-    }
-    if (s == "UnlockFailed") {
-        return UnlockStatusEnum::UnlockFailed;
-    }
-    if (s == "OngoingAuthorizedTransaction") {
-        return UnlockStatusEnum::OngoingAuthorizedTransaction;
-    }
-    if (s == "UnknownConnector") {
-        return UnlockStatusEnum::UnknownConnector;
+UnlockStatusEnum string_to_unlock_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Unlocked") {
+            return UnlockStatusEnum::Unlocked;
+        }
+        break;
+    case 12:
+        if (s == "UnlockFailed") {
+            return UnlockStatusEnum::UnlockFailed;
+        }
+        break;
+    case 16:
+        if (s == "UnknownConnector") {
+            return UnlockStatusEnum::UnknownConnector;
+        }
+        break;
+    case 28:
+        if (s == "OngoingAuthorizedTransaction") {
+            return UnlockStatusEnum::OngoingAuthorizedTransaction;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UnlockStatusEnum"};
@@ -3862,15 +4719,23 @@ std::string unpublish_firmware_status_enum_to_string(UnpublishFirmwareStatusEnum
     throw EnumToStringException{e, "UnpublishFirmwareStatusEnum"};
 }
 
-UnpublishFirmwareStatusEnum string_to_unpublish_firmware_status_enum(const std::string& s) {
-    if (s == "DownloadOngoing") {
-        return UnpublishFirmwareStatusEnum::DownloadOngoing;
-    }
-    if (s == "NoFirmware") {
-        return UnpublishFirmwareStatusEnum::NoFirmware;
-    }
-    if (s == "Unpublished") {
-        return UnpublishFirmwareStatusEnum::Unpublished;
+UnpublishFirmwareStatusEnum string_to_unpublish_firmware_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 10:
+        if (s == "NoFirmware") {
+            return UnpublishFirmwareStatusEnum::NoFirmware;
+        }
+        break;
+    case 11:
+        if (s == "Unpublished") {
+            return UnpublishFirmwareStatusEnum::Unpublished;
+        }
+        break;
+    case 15:
+        if (s == "DownloadOngoing") {
+            return UnpublishFirmwareStatusEnum::DownloadOngoing;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UnpublishFirmwareStatusEnum"};
@@ -3901,21 +4766,29 @@ std::string update_firmware_status_enum_to_string(UpdateFirmwareStatusEnum e) {
     throw EnumToStringException{e, "UpdateFirmwareStatusEnum"};
 }
 
-UpdateFirmwareStatusEnum string_to_update_firmware_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return UpdateFirmwareStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return UpdateFirmwareStatusEnum::Rejected;
-    }
-    if (s == "AcceptedCanceled") {
-        return UpdateFirmwareStatusEnum::AcceptedCanceled;
-    }
-    if (s == "InvalidCertificate") {
-        return UpdateFirmwareStatusEnum::InvalidCertificate;
-    }
-    if (s == "RevokedCertificate") {
-        return UpdateFirmwareStatusEnum::RevokedCertificate;
+UpdateFirmwareStatusEnum string_to_update_firmware_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return UpdateFirmwareStatusEnum::Accepted;
+        }
+        if (s == "Rejected") {
+            return UpdateFirmwareStatusEnum::Rejected;
+        }
+        break;
+    case 16:
+        if (s == "AcceptedCanceled") {
+            return UpdateFirmwareStatusEnum::AcceptedCanceled;
+        }
+        break;
+    case 18:
+        if (s == "InvalidCertificate") {
+            return UpdateFirmwareStatusEnum::InvalidCertificate;
+        }
+        if (s == "RevokedCertificate") {
+            return UpdateFirmwareStatusEnum::RevokedCertificate;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UpdateFirmwareStatusEnum"};
@@ -9,6 +9,8 @@
 
 #include <nlohmann/json.hpp>
 
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 
@@ -40,6 +42,31 @@ void from_json(const json& j, AdditionalInfo& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a AdditionalInfo
+const JsonSaxFields& json_sax_fields(const AdditionalInfo*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&AdditionalInfo::additionalIdToken>("additionalIdToken"),
+        json_sax_field<&AdditionalInfo::type>("type"),
+        json_sax_field<&AdditionalInfo::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given AdditionalInfo \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const AdditionalInfo& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("additionalIdToken");
+    writer.value(k.additionalIdToken.view());
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("type");
+    writer.value(k.type.view());
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given AdditionalInfo \p k to the given output stream \p os
 /// \returns an output stream with the AdditionalInfo written to
 std::ostream& operator<<(std::ostream& os, const AdditionalInfo& k) {
@@ -70,7 +97,7 @@ void to_json(json& j, const IdToken& k) {
 void from_json(const json& j, IdToken& k) {
     // the required parts of the message
     k.idToken = j.at("idToken");
-    k.type = conversions::string_to_id_token_enum(j.at("type"));
+    k.type = conversions::string_to_id_token_enum(j.at("type").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -86,6 +113,40 @@ void from_json(const json& j, IdToken& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a IdToken
+const JsonSaxFields& json_sax_fields(const IdToken*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&IdToken::idToken>("idToken"),
+        json_sax_field<&IdToken::type, conversions::string_to_id_token_enum>("type"),
+        json_sax_field<&IdToken::customData>("customData"),
+        json_sax_field<&IdToken::additionalInfo>("additionalInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given IdToken \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const IdToken& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.additionalInfo) {
+        writer.key("additionalInfo");
+        writer.begin_array();
+        for (const auto& val : k.additionalInfo.value()) {
+            write_json(writer, val);
+        }
+        writer.end_array();
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("idToken");
+    writer.value(k.idToken.view());
+    writer.key("type");
+    writer.value(conversions::id_token_enum_to_string(k.type));
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given IdToken \p k to the given output stream \p os
 /// \returns an output stream with the IdToken written to
 std::ostream& operator<<(std::ostream& os, const IdToken& k) {
@@ -112,7 +173,7 @@ void to_json(json& j, const OCSPRequestData& k) {
 /// \brief Conversion from a given json object \p j to a given OCSPRequestData \p k
 void from_json(const json& j, OCSPRequestData& k) {
     // the required parts of the message
-    k.hashAlgorithm = conversions::string_to_hash_algorithm_enum(j.at("hashAlgorithm"));
+    k.hashAlgorithm = conversions::string_to_hash_algorithm_enum(j.at("hashAlgorithm").get_ref<const std::string&>());
     k.issuerNameHash = j.at("issuerNameHash");
     k.issuerKeyHash = j.at("issuerKeyHash");
     k.serialNumber = j.at("serialNumber");
@@ -124,6 +185,40 @@ void from_json(const json& j, OCSPRequestData& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a OCSPRequestData
+const JsonSaxFields& json_sax_fields(const OCSPRequestData*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&OCSPRequestData::hashAlgorithm, conversions::string_to_hash_algorithm_enum>("hashAlgorithm"),
+        json_sax_field<&OCSPRequestData::issuerNameHash>("issuerNameHash"),
+        json_sax_field<&OCSPRequestData::issuerKeyHash>("issuerKeyHash"),
+        json_sax_field<&OCSPRequestData::serialNumber>("serialNumber"),
+        json_sax_field<&OCSPRequestData::responderURL>("responderURL"),
+        json_sax_field<&OCSPRequestData::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given OCSPRequestData \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const OCSPRequestData& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("hashAlgorithm");
+    writer.value(conversions::hash_algorithm_enum_to_string(k.hashAlgorithm));
+    writer.key("issuerKeyHash");
+    writer.value(k.issuerKeyHash.view());
+    writer.key("issuerNameHash");
+    writer.value(k.issuerNameHash.view());
+    writer.key("responderURL");
+    writer.value(k.responderURL.view());
+    writer.key("serialNumber");
+    writer.value(k.serialNumber.view());
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given OCSPRequestData \p k to the given output stream \p os
 /// \returns an output stream with the OCSPRequestData written to
 std::ostream& operator<<(std::ostream& os, const OCSPRequestData& k) {
@@ -150,7 +245,7 @@ void to_json(json& j, const MessageContent& k) {
 /// \brief Conversion from a given json object \p j to a given MessageContent \p k
 void from_json(const json& j, MessageContent& k) {
     // the required parts of the message
-    k.format = conversions::string_to_message_format_enum(j.at("format"));
+    k.format = conversions::string_to_message_format_enum(j.at("format").get_ref<const std::string&>());
     k.content = j.at("content");
 
     // the optional parts of the message
@@ -162,6 +257,36 @@ void from_json(const json& j, MessageContent& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a MessageContent
+const JsonSaxFields& json_sax_fields(const MessageContent*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&MessageContent::format, conversions::string_to_message_format_enum>("format"),
+        json_sax_field<&MessageContent::content>("content"),
+        json_sax_field<&MessageContent::customData>("customData"),
+        json_sax_field<&MessageContent::language>("language"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given MessageContent \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const MessageContent& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("content");
+    writer.value(k.content.view());
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("format");
+    writer.value(conversions::message_format_enum_to_string(k.format));
+    if (k.language) {
+        writer.key("language");
+        writer.value(k.language.value().view());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given MessageContent \p k to the given output stream \p os
 /// \returns an output stream with the MessageContent written to
 std::ostream& operator<<(std::ostream& os, const MessageContent& k) {
@@ -208,7 +333,7 @@ void to_json(json& j, const IdTokenInfo& k) {
 /// \brief Conversion from a given json object \p j to a given IdTokenInfo \p k
 void from_json(const json& j, IdTokenInfo& k) {
     // the required parts of the message
-    k.status = conversions::string_to_authorization_status_enum(j.at("status"));
+    k.status = conversions::string_to_authorization_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -242,6 +367,67 @@ void from_json(const json& j, IdTokenInfo& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a IdTokenInfo
+const JsonSaxFields& json_sax_fields(const IdTokenInfo*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&IdTokenInfo::status, conversions::string_to_authorization_status_enum>("status"),
+        json_sax_field<&IdTokenInfo::customData>("customData"),
+        json_sax_field<&IdTokenInfo::cacheExpiryDateTime>("cacheExpiryDateTime"),
+        json_sax_field<&IdTokenInfo::chargingPriority>("chargingPriority"),
+        json_sax_field<&IdTokenInfo::language1>("language1"),
+        json_sax_field<&IdTokenInfo::evseId>("evseId"),
+        json_sax_field<&IdTokenInfo::groupIdToken>("groupIdToken"),
+        json_sax_field<&IdTokenInfo::language2>("language2"),
+        json_sax_field<&IdTokenInfo::personalMessage>("personalMessage"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given IdTokenInfo \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const IdTokenInfo& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.cacheExpiryDateTime) {
+        writer.key("cacheExpiryDateTime");
+        writer.value(k.cacheExpiryDateTime.value());
+    }
+    if (k.chargingPriority) {
+        writer.key("chargingPriority");
+        writer.value(k.chargingPriority.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.evseId) {
+        writer.key("evseId");
+        writer.begin_array();
+        for (const auto& val : k.evseId.value()) {
+            writer.value(val);
+        }
+        writer.end_array();
+    }
+    if (k.groupIdToken) {
+        writer.key("groupIdToken");
+        write_json(writer, k.groupIdToken.value());
+    }
+    if (k.language1) {
+        writer.key("language1");
+        writer.value(k.language1.value().view());
+    }
+    if (k.language2) {
+        writer.key("language2");
+        writer.value(k.language2.value().view());
+    }
+    if (k.personalMessage) {
+        writer.key("personalMessage");
+        write_json(writer, k.personalMessage.value());
+    }
+    writer.key("status");
+    writer.value(conversions::authorization_status_enum_to_string(k.status));
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given IdTokenInfo \p k to the given output stream \p os
 /// \returns an output stream with the IdTokenInfo written to
 std::ostream& operator<<(std::ostream& os, const IdTokenInfo& k) {
@@ -281,6 +467,35 @@ void from_json(const json& j, Modem& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a Modem
+const JsonSaxFields& json_sax_fields(const Modem*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&Modem::customData>("customData"),
+        json_sax_field<&Modem::iccid>("iccid"),
+        json_sax_field<&Modem::imsi>("imsi"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given Modem \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const Modem& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.iccid) {
+        writer.key("iccid");
+        writer.value(k.iccid.value().view());
+    }
+    if (k.imsi) {
+        writer.key("imsi");
+        writer.value(k.imsi.value().view());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given Modem \p k to the given output stream \p os
 /// \returns an output stream with the Modem written to
 std::ostream& operator<<(std::ostream& os, const Modem& k) {
@@ -331,6 +546,46 @@ void from_json(const json& j, ChargingStation& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChargingStation
+const JsonSaxFields& json_sax_fields(const ChargingStation*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ChargingStation::model>("model"),
+        json_sax_field<&ChargingStation::vendorName>("vendorName"),
+        json_sax_field<&ChargingStation::customData>("customData"),
+        json_sax_field<&ChargingStation::serialNumber>("serialNumber"),
+        json_sax_field<&ChargingStation::modem>("modem"),
+        json_sax_field<&ChargingStation::firmwareVersion>("firmwareVersion"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ChargingStation \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChargingStation& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.firmwareVersion) {
+        writer.key("firmwareVersion");
+        writer.value(k.firmwareVersion.value().view());
+    }
+    writer.key("model");
+    writer.value(k.model.view());
+    if (k.modem) {
+        writer.key("modem");
+        write_json(writer, k.modem.value());
+    }
+    if (k.serialNumber) {
+        writer.key("serialNumber");
+        writer.value(k.serialNumber.value().view());
+    }
+    writer.key("vendorName");
+    writer.value(k.vendorName.view());
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingStation \p k to the given output stream \p os
 /// \returns an output stream with the ChargingStation written to
 std::ostream& operator<<(std::ostream& os, const ChargingStation& k) {
@@ -367,6 +622,33 @@ void from_json(const json& j, StatusInfo& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a StatusInfo
+const JsonSaxFields& json_sax_fields(const StatusInfo*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&StatusInfo::reasonCode>("reasonCode"),
+        json_sax_field<&StatusInfo::customData>("customData"),
+        json_sax_field<&StatusInfo::additionalInfo>("additionalInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given StatusInfo \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const StatusInfo& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.additionalInfo) {
+        writer.key("additionalInfo");
+        writer.value(k.additionalInfo.value().view());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("reasonCode");
+    writer.value(k.reasonCode.view());
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given StatusInfo \p k to the given output stream \p os
 /// \returns an output stream with the StatusInfo written to
 std::ostream& operator<<(std::ostream& os, const StatusInfo& k) {
@@ -403,6 +685,33 @@ void from_json(const json& j, EVSE& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a EVSE
+const JsonSaxFields& json_sax_fields(const EVSE*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&EVSE::id>("id"),
+        json_sax_field<&EVSE::customData>("customData"),
+        json_sax_field<&EVSE::connectorId>("connectorId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given EVSE \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const EVSE& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.connectorId) {
+        writer.key("connectorId");
+        writer.value(k.connectorId.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("id");
+    writer.value(k.id);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given EVSE \p k to the given output stream \p os
 /// \returns an output stream with the EVSE written to
 std::ostream& operator<<(std::ostream& os, const EVSE& k) {
@@ -443,13 +752,49 @@ void from_json(const json& j, ClearChargingProfile& k) {
     }
     if (j.contains("chargingProfilePurpose")) {
         k.chargingProfilePurpose.emplace(
-            conversions::string_to_charging_profile_purpose_enum(j.at("chargingProfilePurpose")));
+            conversions::string_to_charging_profile_purpose_enum(
+                j.at("chargingProfilePurpose").get_ref<const std::string&>()));
     }
     if (j.contains("stackLevel")) {
         k.stackLevel.emplace(j.at("stackLevel"));
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearChargingProfile
+const JsonSaxFields& json_sax_fields(const ClearChargingProfile*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ClearChargingProfile::customData>("customData"),
+        json_sax_field<&ClearChargingProfile::evseId>("evseId"),
+        json_sax_field<&ClearChargingProfile::chargingProfilePurpose,
+                       conversions::string_to_charging_profile_purpose_enum>("chargingProfilePurpose"),
+        json_sax_field<&ClearChargingProfile::stackLevel>("stackLevel"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ClearChargingProfile \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearChargingProfile& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.chargingProfilePurpose) {
+        writer.key("chargingProfilePurpose");
+        writer.value(conversions::charging_profile_purpose_enum_to_string(k.chargingProfilePurpose.value()));
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.evseId) {
+        writer.key("evseId");
+        writer.value(k.evseId.value());
+    }
+    if (k.stackLevel) {
+        writer.key("stackLevel");
+        writer.value(k.stackLevel.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ClearChargingProfile \p k to the given output stream \p os
 /// \returns an output stream with the ClearChargingProfile written to
 std::ostream& operator<<(std::ostream& os, const ClearChargingProfile& k) {
@@ -476,7 +821,7 @@ void to_json(json& j, const ClearMonitoringResult& k) {
 /// \brief Conversion from a given json object \p j to a given ClearMonitoringResult \p k
 void from_json(const json& j, ClearMonitoringResult& k) {
     // the required parts of the message
-    k.status = conversions::string_to_clear_monitoring_status_enum(j.at("status"));
+    k.status = conversions::string_to_clear_monitoring_status_enum(j.at("status").get_ref<const std::string&>());
     k.id = j.at("id");
 
     // the optional parts of the message
@@ -488,6 +833,36 @@ void from_json(const json& j, ClearMonitoringResult& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ClearMonitoringResult
+const JsonSaxFields& json_sax_fields(const ClearMonitoringResult*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ClearMonitoringResult::status, conversions::string_to_clear_monitoring_status_enum>("status"),
+        json_sax_field<&ClearMonitoringResult::id>("id"),
+        json_sax_field<&ClearMonitoringResult::customData>("customData"),
+        json_sax_field<&ClearMonitoringResult::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ClearMonitoringResult \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ClearMonitoringResult& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("id");
+    writer.value(k.id);
+    writer.key("status");
+    writer.value(conversions::clear_monitoring_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ClearMonitoringResult \p k to the given output stream \p os
 /// \returns an output stream with the ClearMonitoringResult written to
 std::ostream& operator<<(std::ostream& os, const ClearMonitoringResult& k) {
@@ -513,7 +888,7 @@ void to_json(json& j, const CertificateHashDataType& k) {
 /// \brief Conversion from a given json object \p j to a given CertificateHashDataType \p k
 void from_json(const json& j, CertificateHashDataType& k) {
     // the required parts of the message
-    k.hashAlgorithm = conversions::string_to_hash_algorithm_enum(j.at("hashAlgorithm"));
+    k.hashAlgorithm = conversions::string_to_hash_algorithm_enum(j.at("hashAlgorithm").get_ref<const std::string&>());
     k.issuerNameHash = j.at("issuerNameHash");
     k.issuerKeyHash = j.at("issuerKeyHash");
     k.serialNumber = j.at("serialNumber");
@@ -524,6 +899,38 @@ void from_json(const json& j, CertificateHashDataType& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CertificateHashDataType
+const JsonSaxFields& json_sax_fields(const CertificateHashDataType*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&CertificateHashDataType::hashAlgorithm,
+                       conversions::string_to_hash_algorithm_enum>("hashAlgorithm"),
+        json_sax_field<&CertificateHashDataType::issuerNameHash>("issuerNameHash"),
+        json_sax_field<&CertificateHashDataType::issuerKeyHash>("issuerKeyHash"),
+        json_sax_field<&CertificateHashDataType::serialNumber>("serialNumber"),
+        json_sax_field<&CertificateHashDataType::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given CertificateHashDataType \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CertificateHashDataType& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("hashAlgorithm");
+    writer.value(conversions::hash_algorithm_enum_to_string(k.hashAlgorithm));
+    writer.key("issuerKeyHash");
+    writer.value(k.issuerKeyHash.view());
+    writer.key("issuerNameHash");
+    writer.value(k.issuerNameHash.view());
+    writer.key("serialNumber");
+    writer.value(k.serialNumber.view());
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given CertificateHashDataType \p k to the given output stream \p os
 /// \returns an output stream with the CertificateHashDataType written to
 std::ostream& operator<<(std::ostream& os, const CertificateHashDataType& k) {
@@ -578,7 +985,8 @@ void from_json(const json& j, ChargingProfileCriterion& k) {
     }
     if (j.contains("chargingProfilePurpose")) {
         k.chargingProfilePurpose.emplace(
-            conversions::string_to_charging_profile_purpose_enum(j.at("chargingProfilePurpose")));
+            conversions::string_to_charging_profile_purpose_enum(
+                j.at("chargingProfilePurpose").get_ref<const std::string&>()));
     }
     if (j.contains("stackLevel")) {
         k.stackLevel.emplace(j.at("stackLevel"));
@@ -595,12 +1003,61 @@ void from_json(const json& j, ChargingProfileCriterion& k) {
         json arr = j.at("chargingLimitSource");
         std::vector<ChargingLimitSourceEnum> vec;
         for (auto val : arr) {
-            vec.push_back(conversions::string_to_charging_limit_source_enum(val));
+            vec.push_back(conversions::string_to_charging_limit_source_enum(val.get_ref<const std::string&>()));
         }
         k.chargingLimitSource.emplace(vec);
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChargingProfileCriterion
+const JsonSaxFields& json_sax_fields(const ChargingProfileCriterion*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ChargingProfileCriterion::customData>("customData"),
+        json_sax_field<&ChargingProfileCriterion::chargingProfilePurpose,
+                       conversions::string_to_charging_profile_purpose_enum>("chargingProfilePurpose"),
+        json_sax_field<&ChargingProfileCriterion::stackLevel>("stackLevel"),
+        json_sax_field<&ChargingProfileCriterion::chargingProfileId>("chargingProfileId"),
+        json_sax_field<&ChargingProfileCriterion::chargingLimitSource,
+                       conversions::string_to_charging_limit_source_enum>("chargingLimitSource"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ChargingProfileCriterion \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChargingProfileCriterion& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.chargingLimitSource) {
+        writer.key("chargingLimitSource");
+        writer.begin_array();
+        for (const auto& val : k.chargingLimitSource.value()) {
+            writer.value(conversions::charging_limit_source_enum_to_string(val));
+        }
+        writer.end_array();
+    }
+    if (k.chargingProfileId) {
+        writer.key("chargingProfileId");
+        writer.begin_array();
+        for (const auto& val : k.chargingProfileId.value()) {
+            writer.value(val);
+        }
+        writer.end_array();
+    }
+    if (k.chargingProfilePurpose) {
+        writer.key("chargingProfilePurpose");
+        writer.value(conversions::charging_profile_purpose_enum_to_string(k.chargingProfilePurpose.value()));
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.stackLevel) {
+        writer.key("stackLevel");
+        writer.value(k.stackLevel.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingProfileCriterion \p k to the given output stream \p os
 /// \returns an output stream with the ChargingProfileCriterion written to
 std::ostream& operator<<(std::ostream& os, const ChargingProfileCriterion& k) {
@@ -645,6 +1102,41 @@ void from_json(const json& j, ChargingSchedulePeriod& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChargingSchedulePeriod
+const JsonSaxFields& json_sax_fields(const ChargingSchedulePeriod*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ChargingSchedulePeriod::startPeriod>("startPeriod"),
+        json_sax_field<&ChargingSchedulePeriod::limit>("limit"),
+        json_sax_field<&ChargingSchedulePeriod::customData>("customData"),
+        json_sax_field<&ChargingSchedulePeriod::numberPhases>("numberPhases"),
+        json_sax_field<&ChargingSchedulePeriod::phaseToUse>("phaseToUse"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ChargingSchedulePeriod \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChargingSchedulePeriod& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("limit");
+    writer.value(k.limit);
+    if (k.numberPhases) {
+        writer.key("numberPhases");
+        writer.value(k.numberPhases.value());
+    }
+    if (k.phaseToUse) {
+        writer.key("phaseToUse");
+        writer.value(k.phaseToUse.value());
+    }
+    writer.key("startPeriod");
+    writer.value(k.startPeriod);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingSchedulePeriod \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedulePeriod written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedulePeriod& k) {
@@ -678,7 +1170,8 @@ void from_json(const json& j, CompositeSchedule& k) {
     k.duration = j.at("duration");
     k.scheduleStart = ocpp::DateTime(std::string(j.at("scheduleStart")));
     ;
-    k.chargingRateUnit = conversions::string_to_charging_rate_unit_enum(j.at("chargingRateUnit"));
+    k.chargingRateUnit =
+        conversions::string_to_charging_rate_unit_enum(j.at("chargingRateUnit").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -686,6 +1179,45 @@ void from_json(const json& j, CompositeSchedule& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CompositeSchedule
+const JsonSaxFields& json_sax_fields(const CompositeSchedule*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&CompositeSchedule::chargingSchedulePeriod>("chargingSchedulePeriod"),
+        json_sax_field<&CompositeSchedule::evseId>("evseId"),
+        json_sax_field<&CompositeSchedule::duration>("duration"),
+        json_sax_field<&CompositeSchedule::scheduleStart>("scheduleStart"),
+        json_sax_field<&CompositeSchedule::chargingRateUnit,
+                       conversions::string_to_charging_rate_unit_enum>("chargingRateUnit"),
+        json_sax_field<&CompositeSchedule::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given CompositeSchedule \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CompositeSchedule& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("chargingRateUnit");
+    writer.value(conversions::charging_rate_unit_enum_to_string(k.chargingRateUnit));
+    writer.key("chargingSchedulePeriod");
+    writer.begin_array();
+    for (const auto& val : k.chargingSchedulePeriod) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("duration");
+    writer.value(k.duration);
+    writer.key("evseId");
+    writer.value(k.evseId);
+    writer.key("scheduleStart");
+    writer.value(k.scheduleStart);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given CompositeSchedule \p k to the given output stream \p os
 /// \returns an output stream with the CompositeSchedule written to
 std::ostream& operator<<(std::ostream& os, const CompositeSchedule& k) {
@@ -716,7 +1248,8 @@ void to_json(json& j, const CertificateHashDataChain& k) {
 void from_json(const json& j, CertificateHashDataChain& k) {
     // the required parts of the message
     k.certificateHashData = j.at("certificateHashData");
-    k.certificateType = conversions::string_to_get_certificate_id_use_enum(j.at("certificateType"));
+    k.certificateType =
+        conversions::string_to_get_certificate_id_use_enum(j.at("certificateType").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -732,6 +1265,41 @@ void from_json(const json& j, CertificateHashDataChain& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a CertificateHashDataChain
+const JsonSaxFields& json_sax_fields(const CertificateHashDataChain*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&CertificateHashDataChain::certificateHashData>("certificateHashData"),
+        json_sax_field<&CertificateHashDataChain::certificateType,
+                       conversions::string_to_get_certificate_id_use_enum>("certificateType"),
+        json_sax_field<&CertificateHashDataChain::customData>("customData"),
+        json_sax_field<&CertificateHashDataChain::childCertificateHashData>("childCertificateHashData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given CertificateHashDataChain \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const CertificateHashDataChain& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("certificateHashData");
+    write_json(writer, k.certificateHashData);
+    writer.key("certificateType");
+    writer.value(conversions::get_certificate_id_use_enum_to_string(k.certificateType));
+    if (k.childCertificateHashData) {
+        writer.key("childCertificateHashData");
+        writer.begin_array();
+        for (const auto& val : k.childCertificateHashData.value()) {
+            write_json(writer, val);
+        }
+        writer.end_array();
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given CertificateHashDataChain \p k to the given output stream \p os
 /// \returns an output stream with the CertificateHashDataChain written to
 std::ostream& operator<<(std::ostream& os, const CertificateHashDataChain& k) {
@@ -774,6 +1342,38 @@ void from_json(const json& j, LogParameters& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a LogParameters
+const JsonSaxFields& json_sax_fields(const LogParameters*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&LogParameters::remoteLocation>("remoteLocation"),
+        json_sax_field<&LogParameters::customData>("customData"),
+        json_sax_field<&LogParameters::oldestTimestamp>("oldestTimestamp"),
+        json_sax_field<&LogParameters::latestTimestamp>("latestTimestamp"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given LogParameters \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const LogParameters& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.latestTimestamp) {
+        writer.key("latestTimestamp");
+        writer.value(k.latestTimestamp.value());
+    }
+    if (k.oldestTimestamp) {
+        writer.key("oldestTimestamp");
+        writer.value(k.oldestTimestamp.value());
+    }
+    writer.key("remoteLocation");
+    writer.value(k.remoteLocation.view());
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given LogParameters \p k to the given output stream \p os
 /// \returns an output stream with the LogParameters written to
 std::ostream& operator<<(std::ostream& os, const LogParameters& k) {
@@ -816,6 +1416,38 @@ void from_json(const json& j, Component& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a Component
+const JsonSaxFields& json_sax_fields(const Component*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&Component::name>("name"),
+        json_sax_field<&Component::customData>("customData"),
+        json_sax_field<&Component::evse>("evse"),
+        json_sax_field<&Component::instance>("instance"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given Component \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const Component& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.evse) {
+        writer.key("evse");
+        write_json(writer, k.evse.value());
+    }
+    if (k.instance) {
+        writer.key("instance");
+        writer.value(k.instance.value().view());
+    }
+    writer.key("name");
+    writer.value(k.name.view());
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given Component \p k to the given output stream \p os
 /// \returns an output stream with the Component written to
 std::ostream& operator<<(std::ostream& os, const Component& k) {
@@ -852,6 +1484,33 @@ void from_json(const json& j, Variable& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a Variable
+const JsonSaxFields& json_sax_fields(const Variable*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&Variable::name>("name"),
+        json_sax_field<&Variable::customData>("customData"),
+        json_sax_field<&Variable::instance>("instance"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given Variable \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const Variable& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.instance) {
+        writer.key("instance");
+        writer.value(k.instance.value().view());
+    }
+    writer.key("name");
+    writer.value(k.name.view());
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given Variable \p k to the given output stream \p os
 /// \returns an output stream with the Variable written to
 std::ostream& operator<<(std::ostream& os, const Variable& k) {
@@ -888,6 +1547,33 @@ void from_json(const json& j, ComponentVariable& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ComponentVariable
+const JsonSaxFields& json_sax_fields(const ComponentVariable*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ComponentVariable::component>("component"),
+        json_sax_field<&ComponentVariable::customData>("customData"),
+        json_sax_field<&ComponentVariable::variable>("variable"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ComponentVariable \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ComponentVariable& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.variable) {
+        writer.key("variable");
+        write_json(writer, k.variable.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ComponentVariable \p k to the given output stream \p os
 /// \returns an output stream with the ComponentVariable written to
 std::ostream& operator<<(std::ostream& os, const ComponentVariable& k) {
@@ -922,8 +1608,39 @@ void from_json(const json& j, GetVariableData& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("attributeType")) {
-        k.attributeType.emplace(conversions::string_to_attribute_enum(j.at("attributeType")));
+        k.attributeType.emplace(
+            conversions::string_to_attribute_enum(j.at("attributeType").get_ref<const std::string&>()));
+    }
+}
+
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetVariableData
+const JsonSaxFields& json_sax_fields(const GetVariableData*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetVariableData::component>("component"),
+        json_sax_field<&GetVariableData::variable>("variable"),
+        json_sax_field<&GetVariableData::customData>("customData"),
+        json_sax_field<&GetVariableData::attributeType, conversions::string_to_attribute_enum>("attributeType"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetVariableData \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetVariableData& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.attributeType) {
+        writer.key("attributeType");
+        writer.value(conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
     }
+    writer.key("variable");
+    write_json(writer, k.variable);
+    writer.end_object();
 }
 
 // \brief Writes the string representation of the given GetVariableData \p k to the given output stream \p os
@@ -959,7 +1676,8 @@ void to_json(json& j, const GetVariableResult& k) {
 /// \brief Conversion from a given json object \p j to a given GetVariableResult \p k
 void from_json(const json& j, GetVariableResult& k) {
     // the required parts of the message
-    k.attributeStatus = conversions::string_to_get_variable_status_enum(j.at("attributeStatus"));
+    k.attributeStatus =
+        conversions::string_to_get_variable_status_enum(j.at("attributeStatus").get_ref<const std::string&>());
     k.component = j.at("component");
     k.variable = j.at("variable");
 
@@ -971,13 +1689,58 @@ void from_json(const json& j, GetVariableResult& k) {
         k.attributeStatusInfo.emplace(j.at("attributeStatusInfo"));
     }
     if (j.contains("attributeType")) {
-        k.attributeType.emplace(conversions::string_to_attribute_enum(j.at("attributeType")));
+        k.attributeType.emplace(
+            conversions::string_to_attribute_enum(j.at("attributeType").get_ref<const std::string&>()));
     }
     if (j.contains("attributeValue")) {
         k.attributeValue.emplace(j.at("attributeValue"));
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a GetVariableResult
+const JsonSaxFields& json_sax_fields(const GetVariableResult*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&GetVariableResult::attributeStatus,
+                       conversions::string_to_get_variable_status_enum>("attributeStatus"),
+        json_sax_field<&GetVariableResult::component>("component"),
+        json_sax_field<&GetVariableResult::variable>("variable"),
+        json_sax_field<&GetVariableResult::customData>("customData"),
+        json_sax_field<&GetVariableResult::attributeStatusInfo>("attributeStatusInfo"),
+        json_sax_field<&GetVariableResult::attributeType, conversions::string_to_attribute_enum>("attributeType"),
+        json_sax_field<&GetVariableResult::attributeValue>("attributeValue"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given GetVariableResult \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const GetVariableResult& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("attributeStatus");
+    writer.value(conversions::get_variable_status_enum_to_string(k.attributeStatus));
+    if (k.attributeStatusInfo) {
+        writer.key("attributeStatusInfo");
+        write_json(writer, k.attributeStatusInfo.value());
+    }
+    if (k.attributeType) {
+        writer.key("attributeType");
+        writer.value(conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    if (k.attributeValue) {
+        writer.key("attributeValue");
+        writer.value(k.attributeValue.value().view());
+    }
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("variable");
+    write_json(writer, k.variable);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given GetVariableResult \p k to the given output stream \p os
 /// \returns an output stream with the GetVariableResult written to
 std::ostream& operator<<(std::ostream& os, const GetVariableResult& k) {
@@ -1014,6 +1777,37 @@ void from_json(const json& j, SignedMeterValue& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SignedMeterValue
+const JsonSaxFields& json_sax_fields(const SignedMeterValue*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SignedMeterValue::signedMeterData>("signedMeterData"),
+        json_sax_field<&SignedMeterValue::signingMethod>("signingMethod"),
+        json_sax_field<&SignedMeterValue::encodingMethod>("encodingMethod"),
+        json_sax_field<&SignedMeterValue::publicKey>("publicKey"),
+        json_sax_field<&SignedMeterValue::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SignedMeterValue \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SignedMeterValue& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("encodingMethod");
+    writer.value(k.encodingMethod.view());
+    writer.key("publicKey");
+    writer.value(k.publicKey.view());
+    writer.key("signedMeterData");
+    writer.value(k.signedMeterData.view());
+    writer.key("signingMethod");
+    writer.value(k.signingMethod.view());
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given SignedMeterValue \p k to the given output stream \p os
 /// \returns an output stream with the SignedMeterValue written to
 std::ostream& operator<<(std::ostream& os, const SignedMeterValue& k) {
@@ -1053,6 +1847,35 @@ void from_json(const json& j, UnitOfMeasure& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a UnitOfMeasure
+const JsonSaxFields& json_sax_fields(const UnitOfMeasure*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&UnitOfMeasure::customData>("customData"),
+        json_sax_field<&UnitOfMeasure::unit>("unit"),
+        json_sax_field<&UnitOfMeasure::multiplier>("multiplier"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given UnitOfMeasure \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const UnitOfMeasure& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.multiplier) {
+        writer.key("multiplier");
+        writer.value(k.multiplier.value());
+    }
+    if (k.unit) {
+        writer.key("unit");
+        writer.value(k.unit.value().view());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given UnitOfMeasure \p k to the given output stream \p os
 /// \returns an output stream with the UnitOfMeasure written to
 std::ostream& operator<<(std::ostream& os, const UnitOfMeasure& k) {
@@ -1100,16 +1923,16 @@ void from_json(const json& j, SampledValue& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("context")) {
-        k.context.emplace(conversions::string_to_reading_context_enum(j.at("context")));
+        k.context.emplace(conversions::string_to_reading_context_enum(j.at("context").get_ref<const std::string&>()));
     }
     if (j.contains("measurand")) {
-        k.measurand.emplace(conversions::string_to_measurand_enum(j.at("measurand")));
+        k.measurand.emplace(conversions::string_to_measurand_enum(j.at("measurand").get_ref<const std::string&>()));
     }
     if (j.contains("phase")) {
-        k.phase.emplace(conversions::string_to_phase_enum(j.at("phase")));
+        k.phase.emplace(conversions::string_to_phase_enum(j.at("phase").get_ref<const std::string&>()));
     }
     if (j.contains("location")) {
-        k.location.emplace(conversions::string_to_location_enum(j.at("location")));
+        k.location.emplace(conversions::string_to_location_enum(j.at("location").get_ref<const std::string&>()));
     }
     if (j.contains("signedMeterValue")) {
         k.signedMeterValue.emplace(j.at("signedMeterValue"));
@@ -1119,11 +1942,63 @@ void from_json(const json& j, SampledValue& k) {
     }
 }
 
-// \brief Writes the string representation of the given SampledValue \p k to the given output stream \p os
-/// \returns an output stream with the SampledValue written to
-std::ostream& operator<<(std::ostream& os, const SampledValue& k) {
-    os << json(k).dump(4);
-    return os;
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SampledValue
+const JsonSaxFields& json_sax_fields(const SampledValue*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SampledValue::value>("value"),
+        json_sax_field<&SampledValue::customData>("customData"),
+        json_sax_field<&SampledValue::context, conversions::string_to_reading_context_enum>("context"),
+        json_sax_field<&SampledValue::measurand, conversions::string_to_measurand_enum>("measurand"),
+        json_sax_field<&SampledValue::phase, conversions::string_to_phase_enum>("phase"),
+        json_sax_field<&SampledValue::location, conversions::string_to_location_enum>("location"),
+        json_sax_field<&SampledValue::signedMeterValue>("signedMeterValue"),
+        json_sax_field<&SampledValue::unitOfMeasure>("unitOfMeasure"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SampledValue \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SampledValue& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.context) {
+        writer.key("context");
+        writer.value(conversions::reading_context_enum_to_string(k.context.value()));
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.location) {
+        writer.key("location");
+        writer.value(conversions::location_enum_to_string(k.location.value()));
+    }
+    if (k.measurand) {
+        writer.key("measurand");
+        writer.value(conversions::measurand_enum_to_string(k.measurand.value()));
+    }
+    if (k.phase) {
+        writer.key("phase");
+        writer.value(conversions::phase_enum_to_string(k.phase.value()));
+    }
+    if (k.signedMeterValue) {
+        writer.key("signedMeterValue");
+        write_json(writer, k.signedMeterValue.value());
+    }
+    if (k.unitOfMeasure) {
+        writer.key("unitOfMeasure");
+        write_json(writer, k.unitOfMeasure.value());
+    }
+    writer.key("value");
+    writer.value(k.value);
+    writer.end_object();
+}
+
+// \brief Writes the string representation of the given SampledValue \p k to the given output stream \p os
+/// \returns an output stream with the SampledValue written to
+std::ostream& operator<<(std::ostream& os, const SampledValue& k) {
+    os << json(k).dump(4);
+    return os;
 }
 
 /// \brief Conversion from a given MeterValue \p k to a given json object \p j
@@ -1154,6 +2029,35 @@ void from_json(const json& j, MeterValue& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a MeterValue
+const JsonSaxFields& json_sax_fields(const MeterValue*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&MeterValue::sampledValue>("sampledValue"),
+        json_sax_field<&MeterValue::timestamp>("timestamp"),
+        json_sax_field<&MeterValue::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given MeterValue \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const MeterValue& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("sampledValue");
+    writer.begin_array();
+    for (const auto& val : k.sampledValue) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    writer.key("timestamp");
+    writer.value(k.timestamp);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given MeterValue \p k to the given output stream \p os
 /// \returns an output stream with the MeterValue written to
 std::ostream& operator<<(std::ostream& os, const MeterValue& k) {
@@ -1190,6 +2094,33 @@ void from_json(const json& j, RelativeTimeInterval& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a RelativeTimeInterval
+const JsonSaxFields& json_sax_fields(const RelativeTimeInterval*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&RelativeTimeInterval::start>("start"),
+        json_sax_field<&RelativeTimeInterval::customData>("customData"),
+        json_sax_field<&RelativeTimeInterval::duration>("duration"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given RelativeTimeInterval \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const RelativeTimeInterval& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.duration) {
+        writer.key("duration");
+        writer.value(k.duration.value());
+    }
+    writer.key("start");
+    writer.value(k.start);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given RelativeTimeInterval \p k to the given output stream \p os
 /// \returns an output stream with the RelativeTimeInterval written to
 std::ostream& operator<<(std::ostream& os, const RelativeTimeInterval& k) {
@@ -1216,7 +2147,7 @@ void to_json(json& j, const Cost& k) {
 /// \brief Conversion from a given json object \p j to a given Cost \p k
 void from_json(const json& j, Cost& k) {
     // the required parts of the message
-    k.costKind = conversions::string_to_cost_kind_enum(j.at("costKind"));
+    k.costKind = conversions::string_to_cost_kind_enum(j.at("costKind").get_ref<const std::string&>());
     k.amount = j.at("amount");
 
     // the optional parts of the message
@@ -1228,6 +2159,36 @@ void from_json(const json& j, Cost& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a Cost
+const JsonSaxFields& json_sax_fields(const Cost*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&Cost::costKind, conversions::string_to_cost_kind_enum>("costKind"),
+        json_sax_field<&Cost::amount>("amount"),
+        json_sax_field<&Cost::customData>("customData"),
+        json_sax_field<&Cost::amountMultiplier>("amountMultiplier"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given Cost \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const Cost& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("amount");
+    writer.value(k.amount);
+    if (k.amountMultiplier) {
+        writer.key("amountMultiplier");
+        writer.value(k.amountMultiplier.value());
+    }
+    writer.key("costKind");
+    writer.value(conversions::cost_kind_enum_to_string(k.costKind));
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given Cost \p k to the given output stream \p os
 /// \returns an output stream with the Cost written to
 std::ostream& operator<<(std::ostream& os, const Cost& k) {
@@ -1262,6 +2223,35 @@ void from_json(const json& j, ConsumptionCost& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ConsumptionCost
+const JsonSaxFields& json_sax_fields(const ConsumptionCost*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ConsumptionCost::startValue>("startValue"),
+        json_sax_field<&ConsumptionCost::cost>("cost"),
+        json_sax_field<&ConsumptionCost::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ConsumptionCost \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ConsumptionCost& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("cost");
+    writer.begin_array();
+    for (const auto& val : k.cost) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("startValue");
+    writer.value(k.startValue);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ConsumptionCost \p k to the given output stream \p os
 /// \returns an output stream with the ConsumptionCost written to
 std::ostream& operator<<(std::ostream& os, const ConsumptionCost& k) {
@@ -1312,6 +2302,42 @@ void from_json(const json& j, SalesTariffEntry& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SalesTariffEntry
+const JsonSaxFields& json_sax_fields(const SalesTariffEntry*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SalesTariffEntry::relativeTimeInterval>("relativeTimeInterval"),
+        json_sax_field<&SalesTariffEntry::customData>("customData"),
+        json_sax_field<&SalesTariffEntry::ePriceLevel>("ePriceLevel"),
+        json_sax_field<&SalesTariffEntry::consumptionCost>("consumptionCost"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SalesTariffEntry \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SalesTariffEntry& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.consumptionCost) {
+        writer.key("consumptionCost");
+        writer.begin_array();
+        for (const auto& val : k.consumptionCost.value()) {
+            write_json(writer, val);
+        }
+        writer.end_array();
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.ePriceLevel) {
+        writer.key("ePriceLevel");
+        writer.value(k.ePriceLevel.value());
+    }
+    writer.key("relativeTimeInterval");
+    write_json(writer, k.relativeTimeInterval);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given SalesTariffEntry \p k to the given output stream \p os
 /// \returns an output stream with the SalesTariffEntry written to
 std::ostream& operator<<(std::ostream& os, const SalesTariffEntry& k) {
@@ -1358,6 +2384,45 @@ void from_json(const json& j, SalesTariff& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SalesTariff
+const JsonSaxFields& json_sax_fields(const SalesTariff*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SalesTariff::id>("id"),
+        json_sax_field<&SalesTariff::salesTariffEntry>("salesTariffEntry"),
+        json_sax_field<&SalesTariff::customData>("customData"),
+        json_sax_field<&SalesTariff::salesTariffDescription>("salesTariffDescription"),
+        json_sax_field<&SalesTariff::numEPriceLevels>("numEPriceLevels"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SalesTariff \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SalesTariff& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("id");
+    writer.value(k.id);
+    if (k.numEPriceLevels) {
+        writer.key("numEPriceLevels");
+        writer.value(k.numEPriceLevels.value());
+    }
+    if (k.salesTariffDescription) {
+        writer.key("salesTariffDescription");
+        writer.value(k.salesTariffDescription.value().view());
+    }
+    writer.key("salesTariffEntry");
+    writer.begin_array();
+    for (const auto& val : k.salesTariffEntry) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given SalesTariff \p k to the given output stream \p os
 /// \returns an output stream with the SalesTariff written to
 std::ostream& operator<<(std::ostream& os, const SalesTariff& k) {
@@ -1395,7 +2460,8 @@ void to_json(json& j, const ChargingSchedule& k) {
 void from_json(const json& j, ChargingSchedule& k) {
     // the required parts of the message
     k.id = j.at("id");
-    k.chargingRateUnit = conversions::string_to_charging_rate_unit_enum(j.at("chargingRateUnit"));
+    k.chargingRateUnit =
+        conversions::string_to_charging_rate_unit_enum(j.at("chargingRateUnit").get_ref<const std::string&>());
     for (auto val : j.at("chargingSchedulePeriod")) {
         k.chargingSchedulePeriod.push_back(val);
     }
@@ -1418,6 +2484,59 @@ void from_json(const json& j, ChargingSchedule& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChargingSchedule
+const JsonSaxFields& json_sax_fields(const ChargingSchedule*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ChargingSchedule::id>("id"),
+        json_sax_field<&ChargingSchedule::chargingRateUnit,
+                       conversions::string_to_charging_rate_unit_enum>("chargingRateUnit"),
+        json_sax_field<&ChargingSchedule::chargingSchedulePeriod>("chargingSchedulePeriod"),
+        json_sax_field<&ChargingSchedule::customData>("customData"),
+        json_sax_field<&ChargingSchedule::startSchedule>("startSchedule"),
+        json_sax_field<&ChargingSchedule::duration>("duration"),
+        json_sax_field<&ChargingSchedule::minChargingRate>("minChargingRate"),
+        json_sax_field<&ChargingSchedule::salesTariff>("salesTariff"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ChargingSchedule \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChargingSchedule& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("chargingRateUnit");
+    writer.value(conversions::charging_rate_unit_enum_to_string(k.chargingRateUnit));
+    writer.key("chargingSchedulePeriod");
+    writer.begin_array();
+    for (const auto& val : k.chargingSchedulePeriod) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.duration) {
+        writer.key("duration");
+        writer.value(k.duration.value());
+    }
+    writer.key("id");
+    writer.value(k.id);
+    if (k.minChargingRate) {
+        writer.key("minChargingRate");
+        writer.value(k.minChargingRate.value());
+    }
+    if (k.salesTariff) {
+        writer.key("salesTariff");
+        write_json(writer, k.salesTariff.value());
+    }
+    if (k.startSchedule) {
+        writer.key("startSchedule");
+        writer.value(k.startSchedule.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingSchedule \p k to the given output stream \p os
 /// \returns an output stream with the ChargingSchedule written to
 std::ostream& operator<<(std::ostream& os, const ChargingSchedule& k) {
@@ -1443,7 +2562,8 @@ void to_json(json& j, const ChargingLimit& k) {
 /// \brief Conversion from a given json object \p j to a given ChargingLimit \p k
 void from_json(const json& j, ChargingLimit& k) {
     // the required parts of the message
-    k.chargingLimitSource = conversions::string_to_charging_limit_source_enum(j.at("chargingLimitSource"));
+    k.chargingLimitSource =
+        conversions::string_to_charging_limit_source_enum(j.at("chargingLimitSource").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -1454,6 +2574,34 @@ void from_json(const json& j, ChargingLimit& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChargingLimit
+const JsonSaxFields& json_sax_fields(const ChargingLimit*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ChargingLimit::chargingLimitSource,
+                       conversions::string_to_charging_limit_source_enum>("chargingLimitSource"),
+        json_sax_field<&ChargingLimit::customData>("customData"),
+        json_sax_field<&ChargingLimit::isGridCritical>("isGridCritical"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ChargingLimit \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChargingLimit& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("chargingLimitSource");
+    writer.value(conversions::charging_limit_source_enum_to_string(k.chargingLimitSource));
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.isGridCritical) {
+        writer.key("isGridCritical");
+        writer.value(k.isGridCritical.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingLimit \p k to the given output stream \p os
 /// \returns an output stream with the ChargingLimit written to
 std::ostream& operator<<(std::ostream& os, const ChargingLimit& k) {
@@ -1494,7 +2642,7 @@ void to_json(json& j, const MessageInfo& k) {
 void from_json(const json& j, MessageInfo& k) {
     // the required parts of the message
     k.id = j.at("id");
-    k.priority = conversions::string_to_message_priority_enum(j.at("priority"));
+    k.priority = conversions::string_to_message_priority_enum(j.at("priority").get_ref<const std::string&>());
     k.message = j.at("message");
 
     // the optional parts of the message
@@ -1505,7 +2653,7 @@ void from_json(const json& j, MessageInfo& k) {
         k.display.emplace(j.at("display"));
     }
     if (j.contains("state")) {
-        k.state.emplace(conversions::string_to_message_state_enum(j.at("state")));
+        k.state.emplace(conversions::string_to_message_state_enum(j.at("state").get_ref<const std::string&>()));
     }
     if (j.contains("startDateTime")) {
         k.startDateTime.emplace(j.at("startDateTime").get<std::string>());
@@ -1518,6 +2666,59 @@ void from_json(const json& j, MessageInfo& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a MessageInfo
+const JsonSaxFields& json_sax_fields(const MessageInfo*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&MessageInfo::id>("id"),
+        json_sax_field<&MessageInfo::priority, conversions::string_to_message_priority_enum>("priority"),
+        json_sax_field<&MessageInfo::message>("message"),
+        json_sax_field<&MessageInfo::customData>("customData"),
+        json_sax_field<&MessageInfo::display>("display"),
+        json_sax_field<&MessageInfo::state, conversions::string_to_message_state_enum>("state"),
+        json_sax_field<&MessageInfo::startDateTime>("startDateTime"),
+        json_sax_field<&MessageInfo::endDateTime>("endDateTime"),
+        json_sax_field<&MessageInfo::transactionId>("transactionId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given MessageInfo \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const MessageInfo& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.display) {
+        writer.key("display");
+        write_json(writer, k.display.value());
+    }
+    if (k.endDateTime) {
+        writer.key("endDateTime");
+        writer.value(k.endDateTime.value());
+    }
+    writer.key("id");
+    writer.value(k.id);
+    writer.key("message");
+    write_json(writer, k.message);
+    writer.key("priority");
+    writer.value(conversions::message_priority_enum_to_string(k.priority));
+    if (k.startDateTime) {
+        writer.key("startDateTime");
+        writer.value(k.startDateTime.value());
+    }
+    if (k.state) {
+        writer.key("state");
+        writer.value(conversions::message_state_enum_to_string(k.state.value()));
+    }
+    if (k.transactionId) {
+        writer.key("transactionId");
+        writer.value(k.transactionId.value().view());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given MessageInfo \p k to the given output stream \p os
 /// \returns an output stream with the MessageInfo written to
 std::ostream& operator<<(std::ostream& os, const MessageInfo& k) {
@@ -1554,6 +2755,37 @@ void from_json(const json& j, ACChargingParameters& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ACChargingParameters
+const JsonSaxFields& json_sax_fields(const ACChargingParameters*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ACChargingParameters::energyAmount>("energyAmount"),
+        json_sax_field<&ACChargingParameters::evMinCurrent>("evMinCurrent"),
+        json_sax_field<&ACChargingParameters::evMaxCurrent>("evMaxCurrent"),
+        json_sax_field<&ACChargingParameters::evMaxVoltage>("evMaxVoltage"),
+        json_sax_field<&ACChargingParameters::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ACChargingParameters \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ACChargingParameters& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("energyAmount");
+    writer.value(k.energyAmount);
+    writer.key("evMaxCurrent");
+    writer.value(k.evMaxCurrent);
+    writer.key("evMaxVoltage");
+    writer.value(k.evMaxVoltage);
+    writer.key("evMinCurrent");
+    writer.value(k.evMinCurrent);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ACChargingParameters \p k to the given output stream \p os
 /// \returns an output stream with the ACChargingParameters written to
 std::ostream& operator<<(std::ostream& os, const ACChargingParameters& k) {
@@ -1622,6 +2854,61 @@ void from_json(const json& j, DCChargingParameters& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a DCChargingParameters
+const JsonSaxFields& json_sax_fields(const DCChargingParameters*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&DCChargingParameters::evMaxCurrent>("evMaxCurrent"),
+        json_sax_field<&DCChargingParameters::evMaxVoltage>("evMaxVoltage"),
+        json_sax_field<&DCChargingParameters::customData>("customData"),
+        json_sax_field<&DCChargingParameters::energyAmount>("energyAmount"),
+        json_sax_field<&DCChargingParameters::evMaxPower>("evMaxPower"),
+        json_sax_field<&DCChargingParameters::stateOfCharge>("stateOfCharge"),
+        json_sax_field<&DCChargingParameters::evEnergyCapacity>("evEnergyCapacity"),
+        json_sax_field<&DCChargingParameters::fullSoC>("fullSoC"),
+        json_sax_field<&DCChargingParameters::bulkSoC>("bulkSoC"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given DCChargingParameters \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const DCChargingParameters& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.bulkSoC) {
+        writer.key("bulkSoC");
+        writer.value(k.bulkSoC.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.energyAmount) {
+        writer.key("energyAmount");
+        writer.value(k.energyAmount.value());
+    }
+    if (k.evEnergyCapacity) {
+        writer.key("evEnergyCapacity");
+        writer.value(k.evEnergyCapacity.value());
+    }
+    writer.key("evMaxCurrent");
+    writer.value(k.evMaxCurrent);
+    if (k.evMaxPower) {
+        writer.key("evMaxPower");
+        writer.value(k.evMaxPower.value());
+    }
+    writer.key("evMaxVoltage");
+    writer.value(k.evMaxVoltage);
+    if (k.fullSoC) {
+        writer.key("fullSoC");
+        writer.value(k.fullSoC.value());
+    }
+    if (k.stateOfCharge) {
+        writer.key("stateOfCharge");
+        writer.value(k.stateOfCharge.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given DCChargingParameters \p k to the given output stream \p os
 /// \returns an output stream with the DCChargingParameters written to
 std::ostream& operator<<(std::ostream& os, const DCChargingParameters& k) {
@@ -1653,7 +2940,8 @@ void to_json(json& j, const ChargingNeeds& k) {
 /// \brief Conversion from a given json object \p j to a given ChargingNeeds \p k
 void from_json(const json& j, ChargingNeeds& k) {
     // the required parts of the message
-    k.requestedEnergyTransfer = conversions::string_to_energy_transfer_mode_enum(j.at("requestedEnergyTransfer"));
+    k.requestedEnergyTransfer =
+        conversions::string_to_energy_transfer_mode_enum(j.at("requestedEnergyTransfer").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -1670,6 +2958,44 @@ void from_json(const json& j, ChargingNeeds& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChargingNeeds
+const JsonSaxFields& json_sax_fields(const ChargingNeeds*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ChargingNeeds::requestedEnergyTransfer,
+                       conversions::string_to_energy_transfer_mode_enum>("requestedEnergyTransfer"),
+        json_sax_field<&ChargingNeeds::customData>("customData"),
+        json_sax_field<&ChargingNeeds::acChargingParameters>("acChargingParameters"),
+        json_sax_field<&ChargingNeeds::dcChargingParameters>("dcChargingParameters"),
+        json_sax_field<&ChargingNeeds::departureTime>("departureTime"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ChargingNeeds \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChargingNeeds& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.acChargingParameters) {
+        writer.key("acChargingParameters");
+        write_json(writer, k.acChargingParameters.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.dcChargingParameters) {
+        writer.key("dcChargingParameters");
+        write_json(writer, k.dcChargingParameters.value());
+    }
+    if (k.departureTime) {
+        writer.key("departureTime");
+        writer.value(k.departureTime.value());
+    }
+    writer.key("requestedEnergyTransfer");
+    writer.value(conversions::energy_transfer_mode_enum_to_string(k.requestedEnergyTransfer));
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingNeeds \p k to the given output stream \p os
 /// \returns an output stream with the ChargingNeeds written to
 std::ostream& operator<<(std::ostream& os, const ChargingNeeds& k) {
@@ -1719,10 +3045,11 @@ void from_json(const json& j, EventData& k) {
     k.eventId = j.at("eventId");
     k.timestamp = ocpp::DateTime(std::string(j.at("timestamp")));
     ;
-    k.trigger = conversions::string_to_event_trigger_enum(j.at("trigger"));
+    k.trigger = conversions::string_to_event_trigger_enum(j.at("trigger").get_ref<const std::string&>());
     k.actualValue = j.at("actualValue");
     k.component = j.at("component");
-    k.eventNotificationType = conversions::string_to_event_notification_enum(j.at("eventNotificationType"));
+    k.eventNotificationType =
+        conversions::string_to_event_notification_enum(j.at("eventNotificationType").get_ref<const std::string&>());
     k.variable = j.at("variable");
 
     // the optional parts of the message
@@ -1749,6 +3076,77 @@ void from_json(const json& j, EventData& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a EventData
+const JsonSaxFields& json_sax_fields(const EventData*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&EventData::eventId>("eventId"),
+        json_sax_field<&EventData::timestamp>("timestamp"),
+        json_sax_field<&EventData::trigger, conversions::string_to_event_trigger_enum>("trigger"),
+        json_sax_field<&EventData::actualValue>("actualValue"),
+        json_sax_field<&EventData::component>("component"),
+        json_sax_field<&EventData::eventNotificationType,
+                       conversions::string_to_event_notification_enum>("eventNotificationType"),
+        json_sax_field<&EventData::variable>("variable"),
+        json_sax_field<&EventData::customData>("customData"),
+        json_sax_field<&EventData::cause>("cause"),
+        json_sax_field<&EventData::techCode>("techCode"),
+        json_sax_field<&EventData::techInfo>("techInfo"),
+        json_sax_field<&EventData::cleared>("cleared"),
+        json_sax_field<&EventData::transactionId>("transactionId"),
+        json_sax_field<&EventData::variableMonitoringId>("variableMonitoringId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given EventData \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const EventData& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("actualValue");
+    writer.value(k.actualValue.view());
+    if (k.cause) {
+        writer.key("cause");
+        writer.value(k.cause.value());
+    }
+    if (k.cleared) {
+        writer.key("cleared");
+        writer.value(k.cleared.value());
+    }
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("eventId");
+    writer.value(k.eventId);
+    writer.key("eventNotificationType");
+    writer.value(conversions::event_notification_enum_to_string(k.eventNotificationType));
+    if (k.techCode) {
+        writer.key("techCode");
+        writer.value(k.techCode.value().view());
+    }
+    if (k.techInfo) {
+        writer.key("techInfo");
+        writer.value(k.techInfo.value().view());
+    }
+    writer.key("timestamp");
+    writer.value(k.timestamp);
+    if (k.transactionId) {
+        writer.key("transactionId");
+        writer.value(k.transactionId.value().view());
+    }
+    writer.key("trigger");
+    writer.value(conversions::event_trigger_enum_to_string(k.trigger));
+    writer.key("variable");
+    write_json(writer, k.variable);
+    if (k.variableMonitoringId) {
+        writer.key("variableMonitoringId");
+        writer.value(k.variableMonitoringId.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given EventData \p k to the given output stream \p os
 /// \returns an output stream with the EventData written to
 std::ostream& operator<<(std::ostream& os, const EventData& k) {
@@ -1778,7 +3176,7 @@ void from_json(const json& j, VariableMonitoring& k) {
     k.id = j.at("id");
     k.transaction = j.at("transaction");
     k.value = j.at("value");
-    k.type = conversions::string_to_monitor_enum(j.at("type"));
+    k.type = conversions::string_to_monitor_enum(j.at("type").get_ref<const std::string&>());
     k.severity = j.at("severity");
 
     // the optional parts of the message
@@ -1787,6 +3185,40 @@ void from_json(const json& j, VariableMonitoring& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a VariableMonitoring
+const JsonSaxFields& json_sax_fields(const VariableMonitoring*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&VariableMonitoring::id>("id"),
+        json_sax_field<&VariableMonitoring::transaction>("transaction"),
+        json_sax_field<&VariableMonitoring::value>("value"),
+        json_sax_field<&VariableMonitoring::type, conversions::string_to_monitor_enum>("type"),
+        json_sax_field<&VariableMonitoring::severity>("severity"),
+        json_sax_field<&VariableMonitoring::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given VariableMonitoring \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const VariableMonitoring& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("id");
+    writer.value(k.id);
+    writer.key("severity");
+    writer.value(k.severity);
+    writer.key("transaction");
+    writer.value(k.transaction);
+    writer.key("type");
+    writer.value(conversions::monitor_enum_to_string(k.type));
+    writer.key("value");
+    writer.value(k.value);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given VariableMonitoring \p k to the given output stream \p os
 /// \returns an output stream with the VariableMonitoring written to
 std::ostream& operator<<(std::ostream& os, const VariableMonitoring& k) {
@@ -1823,6 +3255,38 @@ void from_json(const json& j, MonitoringData& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a MonitoringData
+const JsonSaxFields& json_sax_fields(const MonitoringData*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&MonitoringData::component>("component"),
+        json_sax_field<&MonitoringData::variable>("variable"),
+        json_sax_field<&MonitoringData::variableMonitoring>("variableMonitoring"),
+        json_sax_field<&MonitoringData::customData>("customData"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given MonitoringData \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const MonitoringData& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("variable");
+    write_json(writer, k.variable);
+    writer.key("variableMonitoring");
+    writer.begin_array();
+    for (const auto& val : k.variableMonitoring) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given MonitoringData \p k to the given output stream \p os
 /// \returns an output stream with the MonitoringData written to
 std::ostream& operator<<(std::ostream& os, const MonitoringData& k) {
@@ -1864,7 +3328,7 @@ void from_json(const json& j, VariableAttribute& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("type")) {
-        k.type.emplace(conversions::string_to_attribute_enum(j.at("type")));
+        k.type.emplace(conversions::string_to_attribute_enum(j.at("type").get_ref<const std::string&>()));
     }
 
     if (j.contains("value")) {
@@ -1888,7 +3352,7 @@ void from_json(const json& j, VariableAttribute& k) {
     }
 
     if (j.contains("mutability")) {
-        k.mutability.emplace(conversions::string_to_mutability_enum(j.at("mutability")));
+        k.mutability.emplace(conversions::string_to_mutability_enum(j.at("mutability").get_ref<const std::string&>()));
     }
     if (j.contains("persistent")) {
         k.persistent.emplace(j.at("persistent"));
@@ -1898,6 +3362,50 @@ void from_json(const json& j, VariableAttribute& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a VariableAttribute
+const JsonSaxFields& json_sax_fields(const VariableAttribute*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&VariableAttribute::customData>("customData"),
+        json_sax_field<&VariableAttribute::type, conversions::string_to_attribute_enum>("type"),
+        json_sax_field<&VariableAttribute::value>("value"),
+        json_sax_field<&VariableAttribute::mutability, conversions::string_to_mutability_enum>("mutability"),
+        json_sax_field<&VariableAttribute::persistent>("persistent"),
+        json_sax_field<&VariableAttribute::constant>("constant"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given VariableAttribute \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const VariableAttribute& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.constant) {
+        writer.key("constant");
+        writer.value(k.constant.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.mutability) {
+        writer.key("mutability");
+        writer.value(conversions::mutability_enum_to_string(k.mutability.value()));
+    }
+    if (k.persistent) {
+        writer.key("persistent");
+        writer.value(k.persistent.value());
+    }
+    if (k.type) {
+        writer.key("type");
+        writer.value(conversions::attribute_enum_to_string(k.type.value()));
+    }
+    if (k.value) {
+        writer.key("value");
+        writer.value(k.value.value().view());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given VariableAttribute \p k to the given output stream \p os
 /// \returns an output stream with the VariableAttribute written to
 std::ostream& operator<<(std::ostream& os, const VariableAttribute& k) {
@@ -1933,7 +3441,7 @@ void to_json(json& j, const VariableCharacteristics& k) {
 /// \brief Conversion from a given json object \p j to a given VariableCharacteristics \p k
 void from_json(const json& j, VariableCharacteristics& k) {
     // the required parts of the message
-    k.dataType = conversions::string_to_data_enum(j.at("dataType"));
+    k.dataType = conversions::string_to_data_enum(j.at("dataType").get_ref<const std::string&>());
     k.supportsMonitoring = j.at("supportsMonitoring");
 
     // the optional parts of the message
@@ -1954,6 +3462,51 @@ void from_json(const json& j, VariableCharacteristics& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a VariableCharacteristics
+const JsonSaxFields& json_sax_fields(const VariableCharacteristics*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&VariableCharacteristics::dataType, conversions::string_to_data_enum>("dataType"),
+        json_sax_field<&VariableCharacteristics::supportsMonitoring>("supportsMonitoring"),
+        json_sax_field<&VariableCharacteristics::customData>("customData"),
+        json_sax_field<&VariableCharacteristics::unit>("unit"),
+        json_sax_field<&VariableCharacteristics::minLimit>("minLimit"),
+        json_sax_field<&VariableCharacteristics::maxLimit>("maxLimit"),
+        json_sax_field<&VariableCharacteristics::valuesList>("valuesList"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given VariableCharacteristics \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const VariableCharacteristics& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("dataType");
+    writer.value(conversions::data_enum_to_string(k.dataType));
+    if (k.maxLimit) {
+        writer.key("maxLimit");
+        writer.value(k.maxLimit.value());
+    }
+    if (k.minLimit) {
+        writer.key("minLimit");
+        writer.value(k.minLimit.value());
+    }
+    writer.key("supportsMonitoring");
+    writer.value(k.supportsMonitoring);
+    if (k.unit) {
+        writer.key("unit");
+        writer.value(k.unit.value().view());
+    }
+    if (k.valuesList) {
+        writer.key("valuesList");
+        writer.value(k.valuesList.value().view());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given VariableCharacteristics \p k to the given output stream \p os
 /// \returns an output stream with the VariableCharacteristics written to
 std::ostream& operator<<(std::ostream& os, const VariableCharacteristics& k) {
@@ -1996,6 +3549,43 @@ void from_json(const json& j, ReportData& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ReportData
+const JsonSaxFields& json_sax_fields(const ReportData*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ReportData::component>("component"),
+        json_sax_field<&ReportData::variable>("variable"),
+        json_sax_field<&ReportData::variableAttribute>("variableAttribute"),
+        json_sax_field<&ReportData::customData>("customData"),
+        json_sax_field<&ReportData::variableCharacteristics>("variableCharacteristics"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ReportData \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ReportData& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("variable");
+    write_json(writer, k.variable);
+    writer.key("variableAttribute");
+    writer.begin_array();
+    for (const auto& val : k.variableAttribute) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    if (k.variableCharacteristics) {
+        writer.key("variableCharacteristics");
+        write_json(writer, k.variableCharacteristics.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ReportData \p k to the given output stream \p os
 /// \returns an output stream with the ReportData written to
 std::ostream& operator<<(std::ostream& os, const ReportData& k) {
@@ -2036,8 +3626,11 @@ void from_json(const json& j, ChargingProfile& k) {
     // the required parts of the message
     k.id = j.at("id");
     k.stackLevel = j.at("stackLevel");
-    k.chargingProfilePurpose = conversions::string_to_charging_profile_purpose_enum(j.at("chargingProfilePurpose"));
-    k.chargingProfileKind = conversions::string_to_charging_profile_kind_enum(j.at("chargingProfileKind"));
+    k.chargingProfilePurpose =
+        conversions::string_to_charging_profile_purpose_enum(
+            j.at("chargingProfilePurpose").get_ref<const std::string&>());
+    k.chargingProfileKind =
+        conversions::string_to_charging_profile_kind_enum(j.at("chargingProfileKind").get_ref<const std::string&>());
     for (auto val : j.at("chargingSchedule")) {
         k.chargingSchedule.push_back(val);
     }
@@ -2047,7 +3640,8 @@ void from_json(const json& j, ChargingProfile& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("recurrencyKind")) {
-        k.recurrencyKind.emplace(conversions::string_to_recurrency_kind_enum(j.at("recurrencyKind")));
+        k.recurrencyKind.emplace(
+            conversions::string_to_recurrency_kind_enum(j.at("recurrencyKind").get_ref<const std::string&>()));
     }
     if (j.contains("validFrom")) {
         k.validFrom.emplace(j.at("validFrom").get<std::string>());
@@ -2060,6 +3654,66 @@ void from_json(const json& j, ChargingProfile& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a ChargingProfile
+const JsonSaxFields& json_sax_fields(const ChargingProfile*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&ChargingProfile::id>("id"),
+        json_sax_field<&ChargingProfile::stackLevel>("stackLevel"),
+        json_sax_field<&ChargingProfile::chargingProfilePurpose,
+                       conversions::string_to_charging_profile_purpose_enum>("chargingProfilePurpose"),
+        json_sax_field<&ChargingProfile::chargingProfileKind,
+                       conversions::string_to_charging_profile_kind_enum>("chargingProfileKind"),
+        json_sax_field<&ChargingProfile::chargingSchedule>("chargingSchedule"),
+        json_sax_field<&ChargingProfile::customData>("customData"),
+        json_sax_field<&ChargingProfile::recurrencyKind, conversions::string_to_recurrency_kind_enum>("recurrencyKind"),
+        json_sax_field<&ChargingProfile::validFrom>("validFrom"),
+        json_sax_field<&ChargingProfile::validTo>("validTo"),
+        json_sax_field<&ChargingProfile::transactionId>("transactionId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given ChargingProfile \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const ChargingProfile& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("chargingProfileKind");
+    writer.value(conversions::charging_profile_kind_enum_to_string(k.chargingProfileKind));
+    writer.key("chargingProfilePurpose");
+    writer.value(conversions::charging_profile_purpose_enum_to_string(k.chargingProfilePurpose));
+    writer.key("chargingSchedule");
+    writer.begin_array();
+    for (const auto& val : k.chargingSchedule) {
+        write_json(writer, val);
+    }
+    writer.end_array();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("id");
+    writer.value(k.id);
+    if (k.recurrencyKind) {
+        writer.key("recurrencyKind");
+        writer.value(conversions::recurrency_kind_enum_to_string(k.recurrencyKind.value()));
+    }
+    writer.key("stackLevel");
+    writer.value(k.stackLevel);
+    if (k.transactionId) {
+        writer.key("transactionId");
+        writer.value(k.transactionId.value().view());
+    }
+    if (k.validFrom) {
+        writer.key("validFrom");
+        writer.value(k.validFrom.value());
+    }
+    if (k.validTo) {
+        writer.key("validTo");
+        writer.value(k.validTo.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given ChargingProfile \p k to the given output stream \p os
 /// \returns an output stream with the ChargingProfile written to
 std::ostream& operator<<(std::ostream& os, const ChargingProfile& k) {
@@ -2096,6 +3750,33 @@ void from_json(const json& j, AuthorizationData& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a AuthorizationData
+const JsonSaxFields& json_sax_fields(const AuthorizationData*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&AuthorizationData::idToken>("idToken"),
+        json_sax_field<&AuthorizationData::customData>("customData"),
+        json_sax_field<&AuthorizationData::idTokenInfo>("idTokenInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given AuthorizationData \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const AuthorizationData& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("idToken");
+    write_json(writer, k.idToken);
+    if (k.idTokenInfo) {
+        writer.key("idTokenInfo");
+        write_json(writer, k.idTokenInfo.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given AuthorizationData \p k to the given output stream \p os
 /// \returns an output stream with the AuthorizationData written to
 std::ostream& operator<<(std::ostream& os, const AuthorizationData& k) {
@@ -2135,7 +3816,8 @@ void to_json(json& j, const APN& k) {
 void from_json(const json& j, APN& k) {
     // the required parts of the message
     k.apn = j.at("apn");
-    k.apnAuthentication = conversions::string_to_apnauthentication_enum(j.at("apnAuthentication"));
+    k.apnAuthentication =
+        conversions::string_to_apnauthentication_enum(j.at("apnAuthentication").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -2158,6 +3840,56 @@ void from_json(const json& j, APN& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a APN
+const JsonSaxFields& json_sax_fields(const APN*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&APN::apn>("apn"),
+        json_sax_field<&APN::apnAuthentication, conversions::string_to_apnauthentication_enum>("apnAuthentication"),
+        json_sax_field<&APN::customData>("customData"),
+        json_sax_field<&APN::apnUserName>("apnUserName"),
+        json_sax_field<&APN::apnPassword>("apnPassword"),
+        json_sax_field<&APN::simPin>("simPin"),
+        json_sax_field<&APN::preferredNetwork>("preferredNetwork"),
+        json_sax_field<&APN::useOnlyPreferredNetwork>("useOnlyPreferredNetwork"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given APN \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const APN& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("apn");
+    writer.value(k.apn.view());
+    writer.key("apnAuthentication");
+    writer.value(conversions::apnauthentication_enum_to_string(k.apnAuthentication));
+    if (k.apnPassword) {
+        writer.key("apnPassword");
+        writer.value(k.apnPassword.value().view());
+    }
+    if (k.apnUserName) {
+        writer.key("apnUserName");
+        writer.value(k.apnUserName.value().view());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.preferredNetwork) {
+        writer.key("preferredNetwork");
+        writer.value(k.preferredNetwork.value().view());
+    }
+    if (k.simPin) {
+        writer.key("simPin");
+        writer.value(k.simPin.value());
+    }
+    if (k.useOnlyPreferredNetwork) {
+        writer.key("useOnlyPreferredNetwork");
+        writer.value(k.useOnlyPreferredNetwork.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given APN \p k to the given output stream \p os
 /// \returns an output stream with the APN written to
 std::ostream& operator<<(std::ostream& os, const APN& k) {
@@ -2191,7 +3923,7 @@ void from_json(const json& j, VPN& k) {
     k.user = j.at("user");
     k.password = j.at("password");
     k.key = j.at("key");
-    k.type = conversions::string_to_vpnenum(j.at("type"));
+    k.type = conversions::string_to_vpnenum(j.at("type").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -2202,6 +3934,45 @@ void from_json(const json& j, VPN& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a VPN
+const JsonSaxFields& json_sax_fields(const VPN*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&VPN::server>("server"),
+        json_sax_field<&VPN::user>("user"),
+        json_sax_field<&VPN::password>("password"),
+        json_sax_field<&VPN::key>("key"),
+        json_sax_field<&VPN::type, conversions::string_to_vpnenum>("type"),
+        json_sax_field<&VPN::customData>("customData"),
+        json_sax_field<&VPN::group>("group"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given VPN \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const VPN& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.group) {
+        writer.key("group");
+        writer.value(k.group.value().view());
+    }
+    writer.key("key");
+    writer.value(k.key.view());
+    writer.key("password");
+    writer.value(k.password.view());
+    writer.key("server");
+    writer.value(k.server.view());
+    writer.key("type");
+    writer.value(conversions::vpnenum_to_string(k.type));
+    writer.key("user");
+    writer.value(k.user.view());
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given VPN \p k to the given output stream \p os
 /// \returns an output stream with the VPN written to
 std::ostream& operator<<(std::ostream& os, const VPN& k) {
@@ -2235,12 +4006,12 @@ void to_json(json& j, const NetworkConnectionProfile& k) {
 /// \brief Conversion from a given json object \p j to a given NetworkConnectionProfile \p k
 void from_json(const json& j, NetworkConnectionProfile& k) {
     // the required parts of the message
-    k.ocppVersion = conversions::string_to_ocppversion_enum(j.at("ocppVersion"));
-    k.ocppTransport = conversions::string_to_ocpptransport_enum(j.at("ocppTransport"));
+    k.ocppVersion = conversions::string_to_ocppversion_enum(j.at("ocppVersion").get_ref<const std::string&>());
+    k.ocppTransport = conversions::string_to_ocpptransport_enum(j.at("ocppTransport").get_ref<const std::string&>());
     k.ocppCsmsUrl = j.at("ocppCsmsUrl");
     k.messageTimeout = j.at("messageTimeout");
     k.securityProfile = j.at("securityProfile");
-    k.ocppInterface = conversions::string_to_ocppinterface_enum(j.at("ocppInterface"));
+    k.ocppInterface = conversions::string_to_ocppinterface_enum(j.at("ocppInterface").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -2254,6 +4025,55 @@ void from_json(const json& j, NetworkConnectionProfile& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a NetworkConnectionProfile
+const JsonSaxFields& json_sax_fields(const NetworkConnectionProfile*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&NetworkConnectionProfile::ocppVersion, conversions::string_to_ocppversion_enum>("ocppVersion"),
+        json_sax_field<&NetworkConnectionProfile::ocppTransport,
+                       conversions::string_to_ocpptransport_enum>("ocppTransport"),
+        json_sax_field<&NetworkConnectionProfile::ocppCsmsUrl>("ocppCsmsUrl"),
+        json_sax_field<&NetworkConnectionProfile::messageTimeout>("messageTimeout"),
+        json_sax_field<&NetworkConnectionProfile::securityProfile>("securityProfile"),
+        json_sax_field<&NetworkConnectionProfile::ocppInterface,
+                       conversions::string_to_ocppinterface_enum>("ocppInterface"),
+        json_sax_field<&NetworkConnectionProfile::customData>("customData"),
+        json_sax_field<&NetworkConnectionProfile::apn>("apn"),
+        json_sax_field<&NetworkConnectionProfile::vpn>("vpn"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given NetworkConnectionProfile \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const NetworkConnectionProfile& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.apn) {
+        writer.key("apn");
+        write_json(writer, k.apn.value());
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("messageTimeout");
+    writer.value(k.messageTimeout);
+    writer.key("ocppCsmsUrl");
+    writer.value(k.ocppCsmsUrl.view());
+    writer.key("ocppInterface");
+    writer.value(conversions::ocppinterface_enum_to_string(k.ocppInterface));
+    writer.key("ocppTransport");
+    writer.value(conversions::ocpptransport_enum_to_string(k.ocppTransport));
+    writer.key("ocppVersion");
+    writer.value(conversions::ocppversion_enum_to_string(k.ocppVersion));
+    writer.key("securityProfile");
+    writer.value(k.securityProfile);
+    if (k.vpn) {
+        writer.key("vpn");
+        write_json(writer, k.vpn.value());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given NetworkConnectionProfile \p k to the given output stream \p os
 /// \returns an output stream with the NetworkConnectionProfile written to
 std::ostream& operator<<(std::ostream& os, const NetworkConnectionProfile& k) {
@@ -2285,7 +4105,7 @@ void to_json(json& j, const SetMonitoringData& k) {
 void from_json(const json& j, SetMonitoringData& k) {
     // the required parts of the message
     k.value = j.at("value");
-    k.type = conversions::string_to_monitor_enum(j.at("type"));
+    k.type = conversions::string_to_monitor_enum(j.at("type").get_ref<const std::string&>());
     k.severity = j.at("severity");
     k.component = j.at("component");
     k.variable = j.at("variable");
@@ -2302,6 +4122,50 @@ void from_json(const json& j, SetMonitoringData& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetMonitoringData
+const JsonSaxFields& json_sax_fields(const SetMonitoringData*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetMonitoringData::value>("value"),
+        json_sax_field<&SetMonitoringData::type, conversions::string_to_monitor_enum>("type"),
+        json_sax_field<&SetMonitoringData::severity>("severity"),
+        json_sax_field<&SetMonitoringData::component>("component"),
+        json_sax_field<&SetMonitoringData::variable>("variable"),
+        json_sax_field<&SetMonitoringData::customData>("customData"),
+        json_sax_field<&SetMonitoringData::id>("id"),
+        json_sax_field<&SetMonitoringData::transaction>("transaction"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetMonitoringData \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetMonitoringData& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.id) {
+        writer.key("id");
+        writer.value(k.id.value());
+    }
+    writer.key("severity");
+    writer.value(k.severity);
+    if (k.transaction) {
+        writer.key("transaction");
+        writer.value(k.transaction.value());
+    }
+    writer.key("type");
+    writer.value(conversions::monitor_enum_to_string(k.type));
+    writer.key("value");
+    writer.value(k.value);
+    writer.key("variable");
+    write_json(writer, k.variable);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given SetMonitoringData \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringData written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringData& k) {
@@ -2334,8 +4198,8 @@ void to_json(json& j, const SetMonitoringResult& k) {
 /// \brief Conversion from a given json object \p j to a given SetMonitoringResult \p k
 void from_json(const json& j, SetMonitoringResult& k) {
     // the required parts of the message
-    k.status = conversions::string_to_set_monitoring_status_enum(j.at("status"));
-    k.type = conversions::string_to_monitor_enum(j.at("type"));
+    k.status = conversions::string_to_set_monitoring_status_enum(j.at("status").get_ref<const std::string&>());
+    k.type = conversions::string_to_monitor_enum(j.at("type").get_ref<const std::string&>());
     k.component = j.at("component");
     k.variable = j.at("variable");
     k.severity = j.at("severity");
@@ -2352,6 +4216,50 @@ void from_json(const json& j, SetMonitoringResult& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetMonitoringResult
+const JsonSaxFields& json_sax_fields(const SetMonitoringResult*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetMonitoringResult::status, conversions::string_to_set_monitoring_status_enum>("status"),
+        json_sax_field<&SetMonitoringResult::type, conversions::string_to_monitor_enum>("type"),
+        json_sax_field<&SetMonitoringResult::component>("component"),
+        json_sax_field<&SetMonitoringResult::variable>("variable"),
+        json_sax_field<&SetMonitoringResult::severity>("severity"),
+        json_sax_field<&SetMonitoringResult::customData>("customData"),
+        json_sax_field<&SetMonitoringResult::id>("id"),
+        json_sax_field<&SetMonitoringResult::statusInfo>("statusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetMonitoringResult \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetMonitoringResult& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.id) {
+        writer.key("id");
+        writer.value(k.id.value());
+    }
+    writer.key("severity");
+    writer.value(k.severity);
+    writer.key("status");
+    writer.value(conversions::set_monitoring_status_enum_to_string(k.status));
+    if (k.statusInfo) {
+        writer.key("statusInfo");
+        write_json(writer, k.statusInfo.value());
+    }
+    writer.key("type");
+    writer.value(conversions::monitor_enum_to_string(k.type));
+    writer.key("variable");
+    write_json(writer, k.variable);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given SetMonitoringResult \p k to the given output stream \p os
 /// \returns an output stream with the SetMonitoringResult written to
 std::ostream& operator<<(std::ostream& os, const SetMonitoringResult& k) {
@@ -2388,10 +4296,44 @@ void from_json(const json& j, SetVariableData& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("attributeType")) {
-        k.attributeType.emplace(conversions::string_to_attribute_enum(j.at("attributeType")));
+        k.attributeType.emplace(
+            conversions::string_to_attribute_enum(j.at("attributeType").get_ref<const std::string&>()));
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetVariableData
+const JsonSaxFields& json_sax_fields(const SetVariableData*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetVariableData::attributeValue>("attributeValue"),
+        json_sax_field<&SetVariableData::component>("component"),
+        json_sax_field<&SetVariableData::variable>("variable"),
+        json_sax_field<&SetVariableData::customData>("customData"),
+        json_sax_field<&SetVariableData::attributeType, conversions::string_to_attribute_enum>("attributeType"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetVariableData \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetVariableData& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.attributeType) {
+        writer.key("attributeType");
+        writer.value(conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    writer.key("attributeValue");
+    writer.value(k.attributeValue.view());
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("variable");
+    write_json(writer, k.variable);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given SetVariableData \p k to the given output stream \p os
 /// \returns an output stream with the SetVariableData written to
 std::ostream& operator<<(std::ostream& os, const SetVariableData& k) {
@@ -2422,7 +4364,8 @@ void to_json(json& j, const SetVariableResult& k) {
 /// \brief Conversion from a given json object \p j to a given SetVariableResult \p k
 void from_json(const json& j, SetVariableResult& k) {
     // the required parts of the message
-    k.attributeStatus = conversions::string_to_set_variable_status_enum(j.at("attributeStatus"));
+    k.attributeStatus =
+        conversions::string_to_set_variable_status_enum(j.at("attributeStatus").get_ref<const std::string&>());
     k.component = j.at("component");
     k.variable = j.at("variable");
 
@@ -2431,13 +4374,53 @@ void from_json(const json& j, SetVariableResult& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("attributeType")) {
-        k.attributeType.emplace(conversions::string_to_attribute_enum(j.at("attributeType")));
+        k.attributeType.emplace(
+            conversions::string_to_attribute_enum(j.at("attributeType").get_ref<const std::string&>()));
     }
     if (j.contains("attributeStatusInfo")) {
         k.attributeStatusInfo.emplace(j.at("attributeStatusInfo"));
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a SetVariableResult
+const JsonSaxFields& json_sax_fields(const SetVariableResult*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&SetVariableResult::attributeStatus,
+                       conversions::string_to_set_variable_status_enum>("attributeStatus"),
+        json_sax_field<&SetVariableResult::component>("component"),
+        json_sax_field<&SetVariableResult::variable>("variable"),
+        json_sax_field<&SetVariableResult::customData>("customData"),
+        json_sax_field<&SetVariableResult::attributeType, conversions::string_to_attribute_enum>("attributeType"),
+        json_sax_field<&SetVariableResult::attributeStatusInfo>("attributeStatusInfo"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given SetVariableResult \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const SetVariableResult& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    writer.key("attributeStatus");
+    writer.value(conversions::set_variable_status_enum_to_string(k.attributeStatus));
+    if (k.attributeStatusInfo) {
+        writer.key("attributeStatusInfo");
+        write_json(writer, k.attributeStatusInfo.value());
+    }
+    if (k.attributeType) {
+        writer.key("attributeType");
+        writer.value(conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    writer.key("component");
+    write_json(writer, k.component);
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    writer.key("variable");
+    write_json(writer, k.variable);
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given SetVariableResult \p k to the given output stream \p os
 /// \returns an output stream with the SetVariableResult written to
 std::ostream& operator<<(std::ostream& os, const SetVariableResult& k) {
@@ -2479,19 +4462,63 @@ void from_json(const json& j, Transaction& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("chargingState")) {
-        k.chargingState.emplace(conversions::string_to_charging_state_enum(j.at("chargingState")));
+        k.chargingState.emplace(
+            conversions::string_to_charging_state_enum(j.at("chargingState").get_ref<const std::string&>()));
     }
     if (j.contains("timeSpentCharging")) {
         k.timeSpentCharging.emplace(j.at("timeSpentCharging"));
     }
     if (j.contains("stoppedReason")) {
-        k.stoppedReason.emplace(conversions::string_to_reason_enum(j.at("stoppedReason")));
+        k.stoppedReason.emplace(
+            conversions::string_to_reason_enum(j.at("stoppedReason").get_ref<const std::string&>()));
     }
     if (j.contains("remoteStartId")) {
         k.remoteStartId.emplace(j.at("remoteStartId"));
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a Transaction
+const JsonSaxFields& json_sax_fields(const Transaction*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&Transaction::transactionId>("transactionId"),
+        json_sax_field<&Transaction::customData>("customData"),
+        json_sax_field<&Transaction::chargingState, conversions::string_to_charging_state_enum>("chargingState"),
+        json_sax_field<&Transaction::timeSpentCharging>("timeSpentCharging"),
+        json_sax_field<&Transaction::stoppedReason, conversions::string_to_reason_enum>("stoppedReason"),
+        json_sax_field<&Transaction::remoteStartId>("remoteStartId"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given Transaction \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const Transaction& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.chargingState) {
+        writer.key("chargingState");
+        writer.value(conversions::charging_state_enum_to_string(k.chargingState.value()));
+    }
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.remoteStartId) {
+        writer.key("remoteStartId");
+        writer.value(k.remoteStartId.value());
+    }
+    if (k.stoppedReason) {
+        writer.key("stoppedReason");
+        writer.value(conversions::reason_enum_to_string(k.stoppedReason.value()));
+    }
+    if (k.timeSpentCharging) {
+        writer.key("timeSpentCharging");
+        writer.value(k.timeSpentCharging.value());
+    }
+    writer.key("transactionId");
+    writer.value(k.transactionId.view());
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given Transaction \p k to the given output stream \p os
 /// \returns an output stream with the Transaction written to
 std::ostream& operator<<(std::ostream& os, const Transaction& k) {
@@ -2543,6 +4570,46 @@ void from_json(const json& j, Firmware& k) {
     }
 }
 
+/// \brief Provides the fields that the JsonSaxReader reads from a json object into a Firmware
+const JsonSaxFields& json_sax_fields(const Firmware*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&Firmware::location>("location"),
+        json_sax_field<&Firmware::retrieveDateTime>("retrieveDateTime"),
+        json_sax_field<&Firmware::customData>("customData"),
+        json_sax_field<&Firmware::installDateTime>("installDateTime"),
+        json_sax_field<&Firmware::signingCertificate>("signingCertificate"),
+        json_sax_field<&Firmware::signature>("signature"),
+    };
+    return fields;
+}
+
+/// \brief Writes the given Firmware \p k to \p writer, the output is the same as json(k).dump()
+void write_json(JsonWriter& writer, const Firmware& k) {
+    // the members are written in the order of the keys of a json object
+    writer.begin_object();
+    if (k.customData) {
+        writer.key("customData");
+        writer.value(k.customData.value());
+    }
+    if (k.installDateTime) {
+        writer.key("installDateTime");
+        writer.value(k.installDateTime.value());
+    }
+    writer.key("location");
+    writer.value(k.location.view());
+    writer.key("retrieveDateTime");
+    writer.value(k.retrieveDateTime);
+    if (k.signature) {
+        writer.key("signature");
+        writer.value(k.signature.value().view());
+    }
+    if (k.signingCertificate) {
+        writer.key("signingCertificate");
+        writer.value(k.signingCertificate.value().view());
+    }
+    writer.end_object();
+}
+
 // \brief Writes the string representation of the given Firmware \p k to the given output stream \p os
 /// \returns an output stream with the Firmware written to
 std::ostream& operator<<(std::ostream& os, const Firmware& k) {
@@ -2,11 +2,10 @@
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
 
 #include <chrono>
-#include <condition_variable>
-#include <thread>
 
 #include <everest/logging.hpp>
 
+#include <ocpp/common/aligned_timer.hpp>
 #include <ocpp/v201/charge_point.hpp>
 #include <ocpp/v201/messages/GetCertificateStatus.hpp>
 #include <ocpp/v201/ocpp_types.hpp>
@@ -16,82 +15,106 @@ namespace ocpp::v201 {
 
 OcspUpdater::OcspUpdater(std::shared_ptr<EvseSecurity> evse_security, cert_status_func get_cert_status_from_csms,
                          std::chrono::seconds ocsp_cache_update_interval,
-                         std::chrono::seconds ocsp_cache_update_retry_interval) :
+                         std::chrono::seconds ocsp_cache_update_retry_interval, boost::asio::io_context* io_context) :
+    update_timer(make_steady_timer(io_context)),
     evse_security(std::move(evse_security)),
+    running(false),
+    update_running(false),
+    update_triggered(false),
     get_cert_status_from_csms(std::move(get_cert_status_from_csms)),
-    update_deadline(std::chrono::steady_clock::now()),
     ocsp_cache_update_interval(ocsp_cache_update_interval),
-    ocsp_cache_update_retry_interval(ocsp_cache_update_retry_interval),
-    running(false) {
+    ocsp_cache_update_retry_interval(ocsp_cache_update_retry_interval) {
+}
+
+OcspUpdater::~OcspUpdater() {
+    this->stop();
 }
 
 void OcspUpdater::start() {
-    std::unique_lock lock(this->update_ocsp_cache_lock);
+    std::scoped_lock lock(this->update_ocsp_cache_lock);
     this->running = true;
-    // Create the updater thread - we are holding the lock, so it will only start after we leave this function.
-    // Because the deadline is in the past, it will immediately attempt an update
-    this->updater_thread = std::thread([this] { this->updater_thread_loop(); });
+    this->update_triggered = false;
+    // Attempt an update immediately
+    this->schedule_update(std::chrono::seconds(0));
 }
 
 void OcspUpdater::stop() {
     std::unique_lock lock(this->update_ocsp_cache_lock);
     if (this->running) {
         this->running = false;
-        // Wake up the updater thread
-        this->explicit_update_trigger.notify_one();
+        this->update_timer->stop();
+        auto task = std::move(this->update_task);
         lock.unlock();
-        // wait for updater thread to exit
-        this->updater_thread.join();
+        // wait for a running update to finish
+        if (task.valid()) {
+            task.wait();
+        }
     }
 }
 
 void OcspUpdater::trigger_ocsp_cache_update() {
-    std::unique_lock lock(this->update_ocsp_cache_lock);
+    std::scoped_lock lock(this->update_ocsp_cache_lock);
     if (!this->running) {
         throw std::logic_error("Called trigger_ocsp_cache_update, but the OcspUpdater is not running.");
     }
-    // Move the deadline to "now" so the updater thread doesn't think this is a spurious wakeup
-    this->update_deadline = std::chrono::steady_clock::now();
-    // Wake up the updater thread
-    this->explicit_update_trigger.notify_one();
+    if (this->update_running) {
+        // The running update might have requested the certificate status before the trigger, so update again after it
+        this->update_triggered = true;
+        return;
+    }
+    this->schedule_update(std::chrono::seconds(0));
 }
 
-void OcspUpdater::updater_thread_loop() {
-    std::unique_lock lock(this->update_ocsp_cache_lock);
-    while (true) {
-        auto current_deadline = this->update_deadline;
-        // Wait until the last known deadline expires, or until we're woken up by the trigger
-        // This is the only place where we release this->update_ocsp_cache_lock
-        this->explicit_update_trigger.wait_until(lock, current_deadline);
-        // If the running variable is disabled, we should exit
-        if (!this->running) {
-            break;
-        }
-        // Check that the current deadline has expired - this controls for spurious wakeups
-        if (std::chrono::steady_clock::now() <= this->update_deadline) {
-            continue;
-        }
+void OcspUpdater::schedule_update(std::chrono::seconds delay) {
+    this->update_timer->timeout([this]() { this->start_update(); }, delay);
+}
 
-        // Perform the OCPP cache update
-        try {
-            this->execute_ocsp_update();
-            // Successful update, set the deadline at a week from now and go back to sleep
-            this->update_deadline = std::chrono::steady_clock::now() + this->ocsp_cache_update_interval;
-        } catch (OcspUpdateFailedException& e) {
-            // Unsuccessful update
-            if (e.allows_retry()) {
-                // Can be retried - go to sleep for a short time then retry
-                EVLOG_warning << "libocpp: OCSP status update failed: " << e.what() << ", will retry.";
-                this->update_deadline = std::chrono::steady_clock::now() + this->ocsp_cache_update_retry_interval;
-            } else {
-                // Cannot be retried - rethrow the exception. This will terminate the updater thread.
-                EVLOG_error << "libocpp FATAL: OCSP status update failed: " << e.what();
-                throw;
-            }
-        } catch (UnexpectedMessageTypeFromCSMS& e) {
-            EVLOG_warning << "libocpp: " << e.what() << ", will retry.";
-            this->update_deadline = std::chrono::steady_clock::now() + this->ocsp_cache_update_retry_interval;
+void OcspUpdater::start_update() {
+    std::scoped_lock lock(this->update_ocsp_cache_lock);
+    if (!this->running) {
+        return;
+    }
+    if (this->update_running) {
+        this->update_triggered = true;
+        return;
+    }
+    this->update_running = true;
+    this->update_task = std::async(std::launch::async, [this]() { this->run_update(); });
+}
+
+void OcspUpdater::run_update() {
+    // Perform the OCPP cache update
+    std::optional<std::chrono::seconds> next_update_delay;
+    try {
+        this->execute_ocsp_update();
+        // Successful update, set the deadline at a week from now
+        next_update_delay = this->ocsp_cache_update_interval;
+    } catch (OcspUpdateFailedException& e) {
+        // Unsuccessful update
+        if (e.allows_retry()) {
+            // Can be retried - retry after a short time
+            EVLOG_warning << "libocpp: OCSP status update failed: " << e.what() << ", will retry.";
+            next_update_delay = this->ocsp_cache_update_retry_interval;
+        } else {
+            // Cannot be retried - no further updates are scheduled unless one is triggered
+            EVLOG_error << "libocpp FATAL: OCSP status update failed: " << e.what();
         }
+    } catch (UnexpectedMessageTypeFromCSMS& e) {
+        EVLOG_warning << "libocpp: " << e.what() << ", will retry.";
+        next_update_delay = this->ocsp_cache_update_retry_interval;
+    }
+
+    std::scoped_lock lock(this->update_ocsp_cache_lock);
+    this->update_running = false;
+    if (!this->running) {
+        return;
+    }
+    if (this->update_triggered) {
+        this->update_triggered = false;
+        next_update_delay = std::chrono::seconds(0);
+    }
+    if (next_update_delay.has_value()) {
+        this->schedule_update(next_update_delay.value());
     }
 }
 
@@ -274,266 +274,671 @@ std::string messagetype_to_string(MessageType m) {
     throw EnumToStringException{m, "MessageType"};
 }
 
-MessageType string_to_messagetype(const std::string& s) {
-    if (s == "Authorize") {
-        return MessageType::Authorize;
-    } else if (s == "AuthorizeResponse") {
-        return MessageType::AuthorizeResponse;
-    } else if (s == "BootNotification") {
-        return MessageType::BootNotification;
-    } else if (s == "BootNotificationResponse") {
-        return MessageType::BootNotificationResponse;
-    } else if (s == "CancelReservation") {
-        return MessageType::CancelReservation;
-    } else if (s == "CancelReservationResponse") {
-        return MessageType::CancelReservationResponse;
-    } else if (s == "CertificateSigned") {
-        return MessageType::CertificateSigned;
-    } else if (s == "CertificateSignedResponse") {
-        return MessageType::CertificateSignedResponse;
-    } else if (s == "ChangeAvailability") {
-        return MessageType::ChangeAvailability;
-    } else if (s == "ChangeAvailabilityResponse") {
-        return MessageType::ChangeAvailabilityResponse;
-    } else if (s == "ClearCache") {
-        return MessageType::ClearCache;
-    } else if (s == "ClearCacheResponse") {
-        return MessageType::ClearCacheResponse;
-    } else if (s == "ClearChargingProfile") {
-        return MessageType::ClearChargingProfile;
-    } else if (s == "ClearChargingProfileResponse") {
-        return MessageType::ClearChargingProfileResponse;
-    } else if (s == "ClearDisplayMessage") {
-        return MessageType::ClearDisplayMessage;
-    } else if (s == "ClearDisplayMessageResponse") {
-        return MessageType::ClearDisplayMessageResponse;
-    } else if (s == "ClearedChargingLimit") {
-        return MessageType::ClearedChargingLimit;
-    } else if (s == "ClearedChargingLimitResponse") {
-        return MessageType::ClearedChargingLimitResponse;
-    } else if (s == "ClearVariableMonitoring") {
-        return MessageType::ClearVariableMonitoring;
-    } else if (s == "ClearVariableMonitoringResponse") {
-        return MessageType::ClearVariableMonitoringResponse;
-    } else if (s == "CostUpdated") {
-        return MessageType::CostUpdated;
-    } else if (s == "CostUpdatedResponse") {
-        return MessageType::CostUpdatedResponse;
-    } else if (s == "CustomerInformation") {
-        return MessageType::CustomerInformation;
-    } else if (s == "CustomerInformationResponse") {
-        return MessageType::CustomerInformationResponse;
-    } else if (s == "DataTransfer") {
-        return MessageType::DataTransfer;
-    } else if (s == "DataTransferResponse") {
-        return MessageType::DataTransferResponse;
-    } else if (s == "DeleteCertificate") {
-        return MessageType::DeleteCertificate;
-    } else if (s == "DeleteCertificateResponse") {
-        return MessageType::DeleteCertificateResponse;
-    } else if (s == "FirmwareStatusNotification") {
-        return MessageType::FirmwareStatusNotification;
-    } else if (s == "FirmwareStatusNotificationResponse") {
-        return MessageType::FirmwareStatusNotificationResponse;
-    } else if (s == "Get15118EVCertificate") {
-        return MessageType::Get15118EVCertificate;
-    } else if (s == "Get15118EVCertificateResponse") {
-        return MessageType::Get15118EVCertificateResponse;
-    } else if (s == "GetBaseReport") {
-        return MessageType::GetBaseReport;
-    } else if (s == "GetBaseReportResponse") {
-        return MessageType::GetBaseReportResponse;
-    } else if (s == "GetCertificateStatus") {
-        return MessageType::GetCertificateStatus;
-    } else if (s == "GetCertificateStatusResponse") {
-        return MessageType::GetCertificateStatusResponse;
-    } else if (s == "GetChargingProfiles") {
-        return MessageType::GetChargingProfiles;
-    } else if (s == "GetChargingProfilesResponse") {
-        return MessageType::GetChargingProfilesResponse;
-    } else if (s == "GetCompositeSchedule") {
-        return MessageType::GetCompositeSchedule;
-    } else if (s == "GetCompositeScheduleResponse") {
-        return MessageType::GetCompositeScheduleResponse;
-    } else if (s == "GetDisplayMessages") {
-        return MessageType::GetDisplayMessages;
-    } else if (s == "GetDisplayMessagesResponse") {
-        return MessageType::GetDisplayMessagesResponse;
-    } else if (s == "GetInstalledCertificateIds") {
-        return MessageType::GetInstalledCertificateIds;
-    } else if (s == "GetInstalledCertificateIdsResponse") {
-        return MessageType::GetInstalledCertificateIdsResponse;
-    } else if (s == "GetLocalListVersion") {
-        return MessageType::GetLocalListVersion;
-    } else if (s == "GetLocalListVersionResponse") {
-        return MessageType::GetLocalListVersionResponse;
-    } else if (s == "GetLog") {
-        return MessageType::GetLog;
-    } else if (s == "GetLogResponse") {
-        return MessageType::GetLogResponse;
-    } else if (s == "GetMonitoringReport") {
-        return MessageType::GetMonitoringReport;
-    } else if (s == "GetMonitoringReportResponse") {
-        return MessageType::GetMonitoringReportResponse;
-    } else if (s == "GetReport") {
-        return MessageType::GetReport;
-    } else if (s == "GetReportResponse") {
-        return MessageType::GetReportResponse;
-    } else if (s == "GetTransactionStatus") {
-        return MessageType::GetTransactionStatus;
-    } else if (s == "GetTransactionStatusResponse") {
-        return MessageType::GetTransactionStatusResponse;
-    } else if (s == "GetVariables") {
-        return MessageType::GetVariables;
-    } else if (s == "GetVariablesResponse") {
-        return MessageType::GetVariablesResponse;
-    } else if (s == "Heartbeat") {
-        return MessageType::Heartbeat;
-    } else if (s == "HeartbeatResponse") {
-        return MessageType::HeartbeatResponse;
-    } else if (s == "InstallCertificate") {
-        return MessageType::InstallCertificate;
-    } else if (s == "InstallCertificateResponse") {
-        return MessageType::InstallCertificateResponse;
-    } else if (s == "LogStatusNotification") {
-        return MessageType::LogStatusNotification;
-    } else if (s == "LogStatusNotificationResponse") {
-        return MessageType::LogStatusNotificationResponse;
-    } else if (s == "MeterValues") {
-        return MessageType::MeterValues;
-    } else if (s == "MeterValuesResponse") {
-        return MessageType::MeterValuesResponse;
-    } else if (s == "NotifyChargingLimit") {
-        return MessageType::NotifyChargingLimit;
-    } else if (s == "NotifyChargingLimitResponse") {
-        return MessageType::NotifyChargingLimitResponse;
-    } else if (s == "NotifyCustomerInformation") {
-        return MessageType::NotifyCustomerInformation;
-    } else if (s == "NotifyCustomerInformationResponse") {
-        return MessageType::NotifyCustomerInformationResponse;
-    } else if (s == "NotifyDisplayMessages") {
-        return MessageType::NotifyDisplayMessages;
-    } else if (s == "NotifyDisplayMessagesResponse") {
-        return MessageType::NotifyDisplayMessagesResponse;
-    } else if (s == "NotifyEVChargingNeeds") {
-        return MessageType::NotifyEVChargingNeeds;
-    } else if (s == "NotifyEVChargingNeedsResponse") {
-        return MessageType::NotifyEVChargingNeedsResponse;
-    } else if (s == "NotifyEVChargingSchedule") {
-        return MessageType::NotifyEVChargingSchedule;
-    } else if (s == "NotifyEVChargingScheduleResponse") {
-        return MessageType::NotifyEVChargingScheduleResponse;
-    } else if (s == "NotifyEvent") {
-        return MessageType::NotifyEvent;
-    } else if (s == "NotifyEventResponse") {
-        return MessageType::NotifyEventResponse;
-    } else if (s == "NotifyMonitoringReport") {
-        return MessageType::NotifyMonitoringReport;
-    } else if (s == "NotifyMonitoringReportResponse") {
-        return MessageType::NotifyMonitoringReportResponse;
-    } else if (s == "NotifyReport") {
-        return MessageType::NotifyReport;
-    } else if (s == "NotifyReportResponse") {
-        return MessageType::NotifyReportResponse;
-    } else if (s == "PublishFirmware") {
-        return MessageType::PublishFirmware;
-    } else if (s == "PublishFirmwareResponse") {
-        return MessageType::PublishFirmwareResponse;
-    } else if (s == "PublishFirmwareStatusNotification") {
-        return MessageType::PublishFirmwareStatusNotification;
-    } else if (s == "PublishFirmwareStatusNotificationResponse") {
-        return MessageType::PublishFirmwareStatusNotificationResponse;
-    } else if (s == "ReportChargingProfiles") {
-        return MessageType::ReportChargingProfiles;
-    } else if (s == "ReportChargingProfilesResponse") {
-        return MessageType::ReportChargingProfilesResponse;
-    } else if (s == "RequestStartTransaction") {
-        return MessageType::RequestStartTransaction;
-    } else if (s == "RequestStartTransactionResponse") {
-        return MessageType::RequestStartTransactionResponse;
-    } else if (s == "RequestStopTransaction") {
-        return MessageType::RequestStopTransaction;
-    } else if (s == "RequestStopTransactionResponse") {
-        return MessageType::RequestStopTransactionResponse;
-    } else if (s == "ReservationStatusUpdate") {
-        return MessageType::ReservationStatusUpdate;
-    } else if (s == "ReservationStatusUpdateResponse") {
-        return MessageType::ReservationStatusUpdateResponse;
-    } else if (s == "ReserveNow") {
-        return MessageType::ReserveNow;
-    } else if (s == "ReserveNowResponse") {
-        return MessageType::ReserveNowResponse;
-    } else if (s == "Reset") {
-        return MessageType::Reset;
-    } else if (s == "ResetResponse") {
-        return MessageType::ResetResponse;
-    } else if (s == "SecurityEventNotification") {
-        return MessageType::SecurityEventNotification;
-    } else if (s == "SecurityEventNotificationResponse") {
-        return MessageType::SecurityEventNotificationResponse;
-    } else if (s == "SendLocalList") {
-        return MessageType::SendLocalList;
-    } else if (s == "SendLocalListResponse") {
-        return MessageType::SendLocalListResponse;
-    } else if (s == "SetChargingProfile") {
-        return MessageType::SetChargingProfile;
-    } else if (s == "SetChargingProfileResponse") {
-        return MessageType::SetChargingProfileResponse;
-    } else if (s == "SetDisplayMessage") {
-        return MessageType::SetDisplayMessage;
-    } else if (s == "SetDisplayMessageResponse") {
-        return MessageType::SetDisplayMessageResponse;
-    } else if (s == "SetMonitoringBase") {
-        return MessageType::SetMonitoringBase;
-    } else if (s == "SetMonitoringBaseResponse") {
-        return MessageType::SetMonitoringBaseResponse;
-    } else if (s == "SetMonitoringLevel") {
-        return MessageType::SetMonitoringLevel;
-    } else if (s == "SetMonitoringLevelResponse") {
-        return MessageType::SetMonitoringLevelResponse;
-    } else if (s == "SetNetworkProfile") {
-        return MessageType::SetNetworkProfile;
-    } else if (s == "SetNetworkProfileResponse") {
-        return MessageType::SetNetworkProfileResponse;
-    } else if (s == "SetVariableMonitoring") {
-        return MessageType::SetVariableMonitoring;
-    } else if (s == "SetVariableMonitoringResponse") {
-        return MessageType::SetVariableMonitoringResponse;
-    } else if (s == "SetVariables") {
-        return MessageType::SetVariables;
-    } else if (s == "SetVariablesResponse") {
-        return MessageType::SetVariablesResponse;
-    } else if (s == "SignCertificate") {
-        return MessageType::SignCertificate;
-    } else if (s == "SignCertificateResponse") {
-        return MessageType::SignCertificateResponse;
-    } else if (s == "StatusNotification") {
-        return MessageType::StatusNotification;
-    } else if (s == "StatusNotificationResponse") {
-        return MessageType::StatusNotificationResponse;
-    } else if (s == "TransactionEvent") {
-        return MessageType::TransactionEvent;
-    } else if (s == "TransactionEventResponse") {
-        return MessageType::TransactionEventResponse;
-    } else if (s == "TriggerMessage") {
-        return MessageType::TriggerMessage;
-    } else if (s == "TriggerMessageResponse") {
-        return MessageType::TriggerMessageResponse;
-    } else if (s == "UnlockConnector") {
-        return MessageType::UnlockConnector;
-    } else if (s == "UnlockConnectorResponse") {
-        return MessageType::UnlockConnectorResponse;
-    } else if (s == "UnpublishFirmware") {
-        return MessageType::UnpublishFirmware;
-    } else if (s == "UnpublishFirmwareResponse") {
-        return MessageType::UnpublishFirmwareResponse;
-    } else if (s == "UpdateFirmware") {
-        return MessageType::UpdateFirmware;
-    } else if (s == "UpdateFirmwareResponse") {
-        return MessageType::UpdateFirmwareResponse;
-    } else if (s == "InternalError") {
-        return MessageType::InternalError;
+MessageType string_to_messagetype(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "Reset") {
+            return MessageType::Reset;
+        }
+        break;
+    case 6:
+        if (s == "GetLog") {
+            return MessageType::GetLog;
+        }
+        break;
+    case 9:
+        if (s == "Authorize") {
+            return MessageType::Authorize;
+        }
+        if (s == "GetReport") {
+            return MessageType::GetReport;
+        }
+        if (s == "Heartbeat") {
+            return MessageType::Heartbeat;
+        }
+        break;
+    case 10:
+        if (s == "ClearCache") {
+            return MessageType::ClearCache;
+        }
+        if (s == "ReserveNow") {
+            return MessageType::ReserveNow;
+        }
+        break;
+    case 11:
+        if (s == "CostUpdated") {
+            return MessageType::CostUpdated;
+        }
+        if (s == "MeterValues") {
+            return MessageType::MeterValues;
+        }
+        if (s == "NotifyEvent") {
+            return MessageType::NotifyEvent;
+        }
+        break;
+    case 12:
+        switch (s[0]) {
+        case 'D':
+            if (s == "DataTransfer") {
+                return MessageType::DataTransfer;
+            }
+            break;
+        case 'G':
+            if (s == "GetVariables") {
+                return MessageType::GetVariables;
+            }
+            break;
+        case 'N':
+            if (s == "NotifyReport") {
+                return MessageType::NotifyReport;
+            }
+            break;
+        case 'S':
+            if (s == "SetVariables") {
+                return MessageType::SetVariables;
+            }
+            break;
+        }
+        break;
+    case 13:
+        switch (s[0]) {
+        case 'G':
+            if (s == "GetBaseReport") {
+                return MessageType::GetBaseReport;
+            }
+            break;
+        case 'R':
+            if (s == "ResetResponse") {
+                return MessageType::ResetResponse;
+            }
+            break;
+        case 'S':
+            if (s == "SendLocalList") {
+                return MessageType::SendLocalList;
+            }
+            break;
+        case 'I':
+            if (s == "InternalError") {
+                return MessageType::InternalError;
+            }
+            break;
+        }
+        break;
+    case 14:
+        if (s == "GetLogResponse") {
+            return MessageType::GetLogResponse;
+        }
+        if (s == "TriggerMessage") {
+            return MessageType::TriggerMessage;
+        }
+        if (s == "UpdateFirmware") {
+            return MessageType::UpdateFirmware;
+        }
+        break;
+    case 15:
+        if (s == "PublishFirmware") {
+            return MessageType::PublishFirmware;
+        }
+        if (s == "SignCertificate") {
+            return MessageType::SignCertificate;
+        }
+        if (s == "UnlockConnector") {
+            return MessageType::UnlockConnector;
+        }
+        break;
+    case 16:
+        if (s == "BootNotification") {
+            return MessageType::BootNotification;
+        }
+        if (s == "TransactionEvent") {
+            return MessageType::TransactionEvent;
+        }
+        break;
+    case 17:
+        switch (s[3]) {
+        case 'h':
+            if (s == "AuthorizeResponse") {
+                return MessageType::AuthorizeResponse;
+            }
+            break;
+        case 'c':
+            if (s == "CancelReservation") {
+                return MessageType::CancelReservation;
+            }
+            break;
+        case 't':
+            if (s == "CertificateSigned") {
+                return MessageType::CertificateSigned;
+            }
+            break;
+        case 'e':
+            if (s == "DeleteCertificate") {
+                return MessageType::DeleteCertificate;
+            }
+            break;
+        case 'R':
+            if (s == "GetReportResponse") {
+                return MessageType::GetReportResponse;
+            }
+            break;
+        case 'r':
+            if (s == "HeartbeatResponse") {
+                return MessageType::HeartbeatResponse;
+            }
+            break;
+        case 'D':
+            if (s == "SetDisplayMessage") {
+                return MessageType::SetDisplayMessage;
+            }
+            break;
+        case 'M':
+            if (s == "SetMonitoringBase") {
+                return MessageType::SetMonitoringBase;
+            }
+            break;
+        case 'N':
+            if (s == "SetNetworkProfile") {
+                return MessageType::SetNetworkProfile;
+            }
+            break;
+        case 'u':
+            if (s == "UnpublishFirmware") {
+                return MessageType::UnpublishFirmware;
+            }
+            break;
+        }
+        break;
+    case 18:
+        switch (s[6]) {
+        case 'A':
+            if (s == "ChangeAvailability") {
+                return MessageType::ChangeAvailability;
+            }
+            break;
+        case 'a':
+            if (s == "ClearCacheResponse") {
+                return MessageType::ClearCacheResponse;
+            }
+            break;
+        case 'p':
+            if (s == "GetDisplayMessages") {
+                return MessageType::GetDisplayMessages;
+            }
+            break;
+        case 'l':
+            if (s == "InstallCertificate") {
+                return MessageType::InstallCertificate;
+            }
+            break;
+        case 'e':
+            if (s == "ReserveNowResponse") {
+                return MessageType::ReserveNowResponse;
+            }
+            break;
+        case 'r':
+            if (s == "SetChargingProfile") {
+                return MessageType::SetChargingProfile;
+            }
+            break;
+        case 'i':
+            if (s == "SetMonitoringLevel") {
+                return MessageType::SetMonitoringLevel;
+            }
+            break;
+        case 'N':
+            if (s == "StatusNotification") {
+                return MessageType::StatusNotification;
+            }
+            break;
+        }
+        break;
+    case 19:
+        switch (s[8]) {
+        case 'p':
+            if (s == "ClearDisplayMessage") {
+                return MessageType::ClearDisplayMessage;
+            }
+            break;
+        case 't':
+            if (s == "CostUpdatedResponse") {
+                return MessageType::CostUpdatedResponse;
+            }
+            break;
+        case 'I':
+            if (s == "CustomerInformation") {
+                return MessageType::CustomerInformation;
+            }
+            break;
+        case 'i':
+            if (s == "GetChargingProfiles") {
+                return MessageType::GetChargingProfiles;
+            }
+            break;
+        case 'L':
+            if (s == "GetLocalListVersion") {
+                return MessageType::GetLocalListVersion;
+            }
+            break;
+        case 'o':
+            if (s == "GetMonitoringReport") {
+                return MessageType::GetMonitoringReport;
+            }
+            break;
+        case 'u':
+            if (s == "MeterValuesResponse") {
+                return MessageType::MeterValuesResponse;
+            }
+            break;
+        case 'a':
+            if (s == "NotifyChargingLimit") {
+                return MessageType::NotifyChargingLimit;
+            }
+            break;
+        case 'e':
+            if (s == "NotifyEventResponse") {
+                return MessageType::NotifyEventResponse;
+            }
+            break;
+        }
+        break;
+    case 20:
+        switch (s[6]) {
+        case 'h':
+            if (s == "ClearChargingProfile") {
+                return MessageType::ClearChargingProfile;
+            }
+            break;
+        case 'd':
+            if (s == "ClearedChargingLimit") {
+                return MessageType::ClearedChargingLimit;
+            }
+            break;
+        case 'a':
+            if (s == "DataTransferResponse") {
+                return MessageType::DataTransferResponse;
+            }
+            break;
+        case 't':
+            if (s == "GetCertificateStatus") {
+                return MessageType::GetCertificateStatus;
+            }
+            break;
+        case 'p':
+            if (s == "GetCompositeSchedule") {
+                return MessageType::GetCompositeSchedule;
+            }
+            break;
+        case 'n':
+            if (s == "GetTransactionStatus") {
+                return MessageType::GetTransactionStatus;
+            }
+            break;
+        case 'i':
+            if (s == "GetVariablesResponse") {
+                return MessageType::GetVariablesResponse;
+            }
+            if (s == "SetVariablesResponse") {
+                return MessageType::SetVariablesResponse;
+            }
+            break;
+        case 'R':
+            if (s == "NotifyReportResponse") {
+                return MessageType::NotifyReportResponse;
+            }
+            break;
+        }
+        break;
+    case 21:
+        switch (s[6]) {
+        case '1':
+            if (s == "Get15118EVCertificate") {
+                return MessageType::Get15118EVCertificate;
+            }
+            break;
+        case 'e':
+            if (s == "GetBaseReportResponse") {
+                return MessageType::GetBaseReportResponse;
+            }
+            break;
+        case 't':
+            if (s == "LogStatusNotification") {
+                return MessageType::LogStatusNotification;
+            }
+            break;
+        case 'D':
+            if (s == "NotifyDisplayMessages") {
+                return MessageType::NotifyDisplayMessages;
+            }
+            break;
+        case 'E':
+            if (s == "NotifyEVChargingNeeds") {
+                return MessageType::NotifyEVChargingNeeds;
+            }
+            break;
+        case 'c':
+            if (s == "SendLocalListResponse") {
+                return MessageType::SendLocalListResponse;
+            }
+            break;
+        case 'i':
+            if (s == "SetVariableMonitoring") {
+                return MessageType::SetVariableMonitoring;
+            }
+            break;
+        }
+        break;
+    case 22:
+        switch (s[2]) {
+        case 't':
+            if (s == "NotifyMonitoringReport") {
+                return MessageType::NotifyMonitoringReport;
+            }
+            break;
+        case 'p':
+            if (s == "ReportChargingProfiles") {
+                return MessageType::ReportChargingProfiles;
+            }
+            break;
+        case 'q':
+            if (s == "RequestStopTransaction") {
+                return MessageType::RequestStopTransaction;
+            }
+            break;
+        case 'i':
+            if (s == "TriggerMessageResponse") {
+                return MessageType::TriggerMessageResponse;
+            }
+            break;
+        case 'd':
+            if (s == "UpdateFirmwareResponse") {
+                return MessageType::UpdateFirmwareResponse;
+            }
+            break;
+        }
+        break;
+    case 23:
+        switch (s[2]) {
+        case 'e':
+            if (s == "ClearVariableMonitoring") {
+                return MessageType::ClearVariableMonitoring;
+            }
+            break;
+        case 'b':
+            if (s == "PublishFirmwareResponse") {
+                return MessageType::PublishFirmwareResponse;
+            }
+            break;
+        case 'q':
+            if (s == "RequestStartTransaction") {
+                return MessageType::RequestStartTransaction;
+            }
+            break;
+        case 's':
+            if (s == "ReservationStatusUpdate") {
+                return MessageType::ReservationStatusUpdate;
+            }
+            break;
+        case 'g':
+            if (s == "SignCertificateResponse") {
+                return MessageType::SignCertificateResponse;
+            }
+            break;
+        case 'l':
+            if (s == "UnlockConnectorResponse") {
+                return MessageType::UnlockConnectorResponse;
+            }
+            break;
+        }
+        break;
+    case 24:
+        if (s == "BootNotificationResponse") {
+            return MessageType::BootNotificationResponse;
+        }
+        if (s == "NotifyEVChargingSchedule") {
+            return MessageType::NotifyEVChargingSchedule;
+        }
+        if (s == "TransactionEventResponse") {
+            return MessageType::TransactionEventResponse;
+        }
+        break;
+    case 25:
+        switch (s[13]) {
+        case 't':
+            if (s == "CancelReservationResponse") {
+                return MessageType::CancelReservationResponse;
+            }
+            break;
+        case 'g':
+            if (s == "CertificateSignedResponse") {
+                return MessageType::CertificateSignedResponse;
+            }
+            break;
+        case 'c':
+            if (s == "DeleteCertificateResponse") {
+                return MessageType::DeleteCertificateResponse;
+            }
+            break;
+        case 'r':
+            if (s == "NotifyCustomerInformation") {
+                return MessageType::NotifyCustomerInformation;
+            }
+            break;
+        case 'N':
+            if (s == "SecurityEventNotification") {
+                return MessageType::SecurityEventNotification;
+            }
+            break;
+        case 's':
+            if (s == "SetDisplayMessageResponse") {
+                return MessageType::SetDisplayMessageResponse;
+            }
+            break;
+        case 'B':
+            if (s == "SetMonitoringBaseResponse") {
+                return MessageType::SetMonitoringBaseResponse;
+            }
+            break;
+        case 'f':
+            if (s == "SetNetworkProfileResponse") {
+                return MessageType::SetNetworkProfileResponse;
+            }
+            break;
+        case 'w':
+            if (s == "UnpublishFirmwareResponse") {
+                return MessageType::UnpublishFirmwareResponse;
+            }
+            break;
+        }
+        break;
+    case 26:
+        switch (s[4]) {
+        case 'g':
+            if (s == "ChangeAvailabilityResponse") {
+                return MessageType::ChangeAvailabilityResponse;
+            }
+            break;
+        case 'w':
+            if (s == "FirmwareStatusNotification") {
+                return MessageType::FirmwareStatusNotification;
+            }
+            break;
+        case 'i':
+            if (s == "GetDisplayMessagesResponse") {
+                return MessageType::GetDisplayMessagesResponse;
+            }
+            break;
+        case 'n':
+            if (s == "GetInstalledCertificateIds") {
+                return MessageType::GetInstalledCertificateIds;
+            }
+            break;
+        case 'a':
+            if (s == "InstallCertificateResponse") {
+                return MessageType::InstallCertificateResponse;
+            }
+            break;
+        case 'h':
+            if (s == "SetChargingProfileResponse") {
+                return MessageType::SetChargingProfileResponse;
+            }
+            break;
+        case 'o':
+            if (s == "SetMonitoringLevelResponse") {
+                return MessageType::SetMonitoringLevelResponse;
+            }
+            break;
+        case 'u':
+            if (s == "StatusNotificationResponse") {
+                return MessageType::StatusNotificationResponse;
+            }
+            break;
+        }
+        break;
+    case 27:
+        switch (s[3]) {
+        case 'a':
+            if (s == "ClearDisplayMessageResponse") {
+                return MessageType::ClearDisplayMessageResponse;
+            }
+            break;
+        case 't':
+            if (s == "CustomerInformationResponse") {
+                return MessageType::CustomerInformationResponse;
+            }
+            break;
+        case 'C':
+            if (s == "GetChargingProfilesResponse") {
+                return MessageType::GetChargingProfilesResponse;
+            }
+            break;
+        case 'L':
+            if (s == "GetLocalListVersionResponse") {
+                return MessageType::GetLocalListVersionResponse;
+            }
+            break;
+        case 'M':
+            if (s == "GetMonitoringReportResponse") {
+                return MessageType::GetMonitoringReportResponse;
+            }
+            break;
+        case 'i':
+            if (s == "NotifyChargingLimitResponse") {
+                return MessageType::NotifyChargingLimitResponse;
+            }
+            break;
+        }
+        break;
+    case 28:
+        switch (s[5]) {
+        case 'C':
+            if (s == "ClearChargingProfileResponse") {
+                return MessageType::ClearChargingProfileResponse;
+            }
+            break;
+        case 'e':
+            if (s == "ClearedChargingLimitResponse") {
+                return MessageType::ClearedChargingLimitResponse;
+            }
+            break;
+        case 'r':
+            if (s == "GetCertificateStatusResponse") {
+                return MessageType::GetCertificateStatusResponse;
+            }
+            break;
+        case 'm':
+            if (s == "GetCompositeScheduleResponse") {
+                return MessageType::GetCompositeScheduleResponse;
+            }
+            break;
+        case 'a':
+            if (s == "GetTransactionStatusResponse") {
+                return MessageType::GetTransactionStatusResponse;
+            }
+            break;
+        }
+        break;
+    case 29:
+        switch (s[6]) {
+        case '1':
+            if (s == "Get15118EVCertificateResponse") {
+                return MessageType::Get15118EVCertificateResponse;
+            }
+            break;
+        case 't':
+            if (s == "LogStatusNotificationResponse") {
+                return MessageType::LogStatusNotificationResponse;
+            }
+            break;
+        case 'D':
+            if (s == "NotifyDisplayMessagesResponse") {
+                return MessageType::NotifyDisplayMessagesResponse;
+            }
+            break;
+        case 'E':
+            if (s == "NotifyEVChargingNeedsResponse") {
+                return MessageType::NotifyEVChargingNeedsResponse;
+            }
+            break;
+        case 'i':
+            if (s == "SetVariableMonitoringResponse") {
+                return MessageType::SetVariableMonitoringResponse;
+            }
+            break;
+        }
+        break;
+    case 30:
+        if (s == "NotifyMonitoringReportResponse") {
+            return MessageType::NotifyMonitoringReportResponse;
+        }
+        if (s == "ReportChargingProfilesResponse") {
+            return MessageType::ReportChargingProfilesResponse;
+        }
+        if (s == "RequestStopTransactionResponse") {
+            return MessageType::RequestStopTransactionResponse;
+        }
+        break;
+    case 31:
+        if (s == "ClearVariableMonitoringResponse") {
+            return MessageType::ClearVariableMonitoringResponse;
+        }
+        if (s == "RequestStartTransactionResponse") {
+            return MessageType::RequestStartTransactionResponse;
+        }
+        if (s == "ReservationStatusUpdateResponse") {
+            return MessageType::ReservationStatusUpdateResponse;
+        }
+        break;
+    case 32:
+        if (s == "NotifyEVChargingScheduleResponse") {
+            return MessageType::NotifyEVChargingScheduleResponse;
+        }
+        break;
+    case 33:
+        if (s == "NotifyCustomerInformationResponse") {
+            return MessageType::NotifyCustomerInformationResponse;
+        }
+        if (s == "PublishFirmwareStatusNotification") {
+            return MessageType::PublishFirmwareStatusNotification;
+        }
+        if (s == "SecurityEventNotificationResponse") {
+            return MessageType::SecurityEventNotificationResponse;
+        }
+        break;
+    case 34:
+        if (s == "FirmwareStatusNotificationResponse") {
+            return MessageType::FirmwareStatusNotificationResponse;
+        }
+        if (s == "GetInstalledCertificateIdsResponse") {
+            return MessageType::GetInstalledCertificateIdsResponse;
+        }
+        break;
+    case 41:
+        if (s == "PublishFirmwareStatusNotificationResponse") {
+            return MessageType::PublishFirmwareStatusNotificationResponse;
+        }
+        break;
     }
+
     throw StringToEnumException{s, "MessageType"};
 }
 } // namespace conversions
@@ -15,6 +15,11 @@ from pathlib import Path
 import subprocess
 
 
+# Maximum number of string values of an enum with the same length that are compared one after another, larger
+# groups are split by one of their characters first
+MAX_STRING_COMPARISONS = 3
+
+
 def snake_case(word: str) -> str:
     """Convert capital case to snake case.
     Only alphanumerical characters are allowed. Only inserts camelcase
@@ -53,6 +58,25 @@ def remove_last(input_string: str, search: str) -> str:
     return input_string
 
 
+def string_lookup(values: List[str]) -> List[Dict]:
+    """Groups the string values of an enum by their length and splits larger groups further by the character that
+    tells most of their values apart. The generated string to enum conversion switches over both, so that it only
+    has to compare the input with very few string values.
+    """
+    lookup = []
+    for length in sorted(set(len(value) for value in values)):
+        same_length = [value for value in values if len(value) == length]
+        bucket = {'length': length, 'index': None, 'groups': [{'char': None, 'enums': same_length}]}
+        if len(same_length) > MAX_STRING_COMPARISONS:
+            index = max(range(length), key=lambda i: (len(set(value[i] for value in same_length)), -i))
+            chars = list(dict.fromkeys(value[index] for value in same_length))
+            bucket['index'] = index
+            bucket['groups'] = [{'char': char, 'enums': [value for value in same_length if value[index] == char]}
+                                for char in chars]
+        lookup.append(bucket)
+    return lookup
+
+
 def uses_optional(types):
     for t in types:
         for property in t['properties']:
@@ -89,6 +113,7 @@ env = Environment(
 )
 env.filters['snake_case'] = snake_case
 env.filters['remove_last'] = remove_last
+env.filters['string_lookup'] = string_lookup
 env.globals['timestamp'] = datetime.utcnow
 env.globals['year'] = datetime.utcnow().year
 message_hpp_template = env.get_template('message.hpp.jinja')
@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <ocpp/common/types.hpp>
+
+namespace po = boost::program_options;
+
+// Counts every allocation of the benchmark process
+static std::atomic<size_t> allocation_count{0};
+
+void* operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace ocpp {
+namespace benchmarks {
+
+using TimePoint = std::chrono::time_point<date::utc_clock>;
+
+struct BenchmarkResult {
+    std::chrono::nanoseconds elapsed{};
+    size_t allocations;
+};
+
+/// \brief A DateTime conversion done the former way with date::parse or date::format and the way DateTime does it now
+struct DateTimeBenchmark {
+    std::string name;
+    std::function<size_t()> date;
+    std::function<size_t()> datetime;
+};
+
+/// \brief Parses \p timepoint_str like DateTime did with date::parse
+static TimePoint date_parse(const std::string& timepoint_str) {
+    TimePoint timepoint;
+    std::istringstream in{timepoint_str};
+    in >> date::parse("%FT%T%Ez", timepoint);
+    if (in.fail()) {
+        in.clear();
+        in.seekg(0);
+        in >> date::parse("%FT%TZ", timepoint);
+        if (in.fail()) {
+            in.clear();
+            in.seekg(0);
+            in >> date::parse("%FT%T", timepoint);
+        }
+    }
+    return timepoint;
+}
+
+static DateTimeBenchmark make_parse_benchmark(const std::string& name, const std::string& timepoint_str) {
+    return {name,
+            [timepoint_str]() {
+                return static_cast<size_t>(date_parse(timepoint_str).time_since_epoch().count());
+            },
+            [timepoint_str]() {
+                DateTime dt{TimePoint{}};
+                dt.from_rfc3339(timepoint_str);
+                return static_cast<size_t>(dt.to_time_point().time_since_epoch().count());
+            }};
+}
+
+static DateTimeBenchmark make_format_benchmark(const std::string& name, const DateTime& dt) {
+    return {name,
+            [dt]() {
+                return date::format("%FT%TZ", std::chrono::time_point_cast<std::chrono::milliseconds>(
+                                                  dt.to_time_point()))
+                    .size();
+            },
+            [dt]() {
+                std::array<char, DateTime::RFC3339_BUFFER_SIZE> buffer;
+                return dt.to_rfc3339(buffer).size();
+            }};
+}
+
+static BenchmarkResult run_benchmark(size_t repetitions, const std::function<size_t()>& run) {
+    volatile size_t sink = 0;
+    const auto allocations_before = allocation_count.load();
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < repetitions; r++) {
+        sink = sink + run();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return {std::chrono::duration_cast<std::chrono::nanoseconds>(end - start),
+            allocation_count.load() - allocations_before};
+}
+
+static void report(const DateTimeBenchmark& benchmark, size_t repetitions) {
+    const auto date = run_benchmark(repetitions, benchmark.date);
+    const auto datetime = run_benchmark(repetitions, benchmark.datetime);
+
+    const auto count = static_cast<double>(repetitions);
+    const double date_ns = date.elapsed.count() / count;
+    const double datetime_ns = datetime.elapsed.count() / count;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << benchmark.name << "\n";
+    std::cout << "  date:     " << date_ns << " ns / conversion, " << static_cast<double>(date.allocations) / count
+              << " allocations / conversion\n";
+    std::cout << "  DateTime: " << datetime_ns << " ns / conversion, "
+              << static_cast<double>(datetime.allocations) / count << " allocations / conversion\n";
+    std::cout << "  speedup:  " << (datetime_ns > 0 ? date_ns / datetime_ns : 0.0) << "x\n";
+}
+
+} // namespace benchmarks
+} // namespace ocpp
+
+int main(int argc, char* argv[]) {
+    using namespace ocpp;
+    using namespace ocpp::benchmarks;
+
+    po::options_description desc("DateTime parsing and formatting benchmark");
+    desc.add_options()("help,h", "produce help message");
+    desc.add_options()("repetitions", po::value<size_t>()->default_value(100000),
+                       "number of times every timestamp is parsed or formatted");
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0) {
+        std::cout << desc << "\n";
+        return 1;
+    }
+
+    const auto repetitions = vm["repetitions"].as<size_t>();
+
+    const std::vector<DateTimeBenchmark> benchmarks{
+        make_parse_benchmark("parse 2024-01-01T12:34:56.789Z", "2024-01-01T12:34:56.789Z"),
+        make_parse_benchmark("parse 2024-01-01T12:34:56Z", "2024-01-01T12:34:56Z"),
+        make_parse_benchmark("parse 2024-01-01T13:34:56.789123+01:00", "2024-01-01T13:34:56.789123+01:00"),
+        make_format_benchmark("format 2024-01-01T12:34:56.789Z", DateTime("2024-01-01T12:34:56.789Z")),
+    };
+
+    for (const auto& benchmark : benchmarks) {
+        if (benchmark.date() != benchmark.datetime()) {
+            std::cerr << "Benchmark failed: " << benchmark.name << " differs from date" << std::endl;
+            return 1;
+        }
+        report(benchmark, repetitions);
+    }
+
+    return 0;
+}
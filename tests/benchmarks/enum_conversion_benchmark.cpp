@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <ocpp/common/types.hpp>
+#include <ocpp/v201/ocpp_enums.hpp>
+#include <ocpp/v201/types.hpp>
+
+namespace po = boost::program_options;
+
+// Counts every allocation of the benchmark process, the conversions themselves are not expected to allocate
+static std::atomic<size_t> allocation_count{0};
+
+void* operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace ocpp {
+namespace benchmarks {
+
+struct BenchmarkOptions {
+    size_t conversions;
+    size_t repetitions;
+    unsigned int seed;
+};
+
+struct BenchmarkResult {
+    std::chrono::nanoseconds elapsed{};
+    size_t allocations;
+};
+
+/// \brief Inputs and conversions of one enum: the generated string to enum conversion and the chain of string
+/// comparisons in declaration order that it replaces
+struct EnumBenchmark {
+    std::string name;
+    std::vector<std::string> inputs;
+    std::function<int(std::string_view)> lookup;
+    std::function<int(const std::string&)> linear;
+};
+
+template <typename E, typename ToString, typename FromString>
+EnumBenchmark make_enum_benchmark(const std::string& name, ToString to_string, FromString from_string,
+                                  const BenchmarkOptions& options) {
+    std::vector<std::string> strings;
+    for (int i = 0;; i++) {
+        try {
+            strings.push_back(to_string(static_cast<E>(i)));
+        } catch (const EnumToStringException&) {
+            break;
+        }
+    }
+
+    // Every value is converted equally often, in random order so that branch prediction can't learn the sequence
+    std::vector<std::string> inputs;
+    inputs.reserve(options.conversions);
+    for (size_t i = 0; i < options.conversions; i++) {
+        inputs.push_back(strings.at(i % strings.size()));
+    }
+    std::shuffle(inputs.begin(), inputs.end(), std::mt19937{options.seed});
+
+    return {name, std::move(inputs), [from_string](std::string_view s) { return static_cast<int>(from_string(s)); },
+            [strings](const std::string& s) {
+                for (size_t i = 0; i < strings.size(); i++) {
+                    if (s == strings[i]) {
+                        return static_cast<int>(i);
+                    }
+                }
+                throw StringToEnumException{s, "linear"};
+            }};
+}
+
+template <typename Conversion>
+static BenchmarkResult run_benchmark(const std::vector<std::string>& inputs, size_t repetitions,
+                                     Conversion conversion) {
+    volatile int sink = 0;
+    const auto allocations_before = allocation_count.load();
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < repetitions; r++) {
+        for (const auto& input : inputs) {
+            sink = sink + conversion(input);
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return {std::chrono::duration_cast<std::chrono::nanoseconds>(end - start),
+            allocation_count.load() - allocations_before};
+}
+
+static void report(const EnumBenchmark& benchmark, const BenchmarkOptions& options) {
+    const auto conversions = static_cast<double>(benchmark.inputs.size() * options.repetitions);
+    const auto linear = run_benchmark(benchmark.inputs, options.repetitions, benchmark.linear);
+    const auto lookup = run_benchmark(benchmark.inputs, options.repetitions, benchmark.lookup);
+
+    const double linear_ns = linear.elapsed.count() / conversions;
+    const double lookup_ns = lookup.elapsed.count() / conversions;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << benchmark.name << "\n";
+    std::cout << "  linear:            " << linear_ns << " ns / conversion, "
+              << static_cast<double>(linear.allocations) / conversions << " allocations / conversion\n";
+    std::cout << "  generated:         " << lookup_ns << " ns / conversion, "
+              << static_cast<double>(lookup.allocations) / conversions << " allocations / conversion\n";
+    std::cout << "  speedup:           " << (lookup_ns > 0 ? linear_ns / lookup_ns : 0.0) << "x\n";
+}
+
+} // namespace benchmarks
+} // namespace ocpp
+
+int main(int argc, char* argv[]) {
+    using namespace ocpp::benchmarks;
+    using namespace ocpp::v201;
+
+    po::options_description desc("String to enum conversion benchmark");
+    desc.add_options()("help,h", "produce help message");
+    desc.add_options()("conversions", po::value<size_t>()->default_value(10000),
+                       "number of distinct inputs converted per repetition");
+    desc.add_options()("repetitions", po::value<size_t>()->default_value(100), "number of passes over the inputs");
+    desc.add_options()("seed", po::value<unsigned int>()->default_value(42), "seed used to shuffle the inputs");
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0) {
+        std::cout << desc << "\n";
+        return 1;
+    }
+
+    BenchmarkOptions options{vm["conversions"].as<size_t>(), vm["repetitions"].as<size_t>(),
+                             vm["seed"].as<unsigned int>()};
+
+    try {
+        const std::vector<EnumBenchmark> benchmarks{
+            make_enum_benchmark<MessageType>("MessageType", conversions::messagetype_to_string,
+                                             conversions::string_to_messagetype, options),
+            make_enum_benchmark<MeasurandEnum>("MeasurandEnum", conversions::measurand_enum_to_string,
+                                               conversions::string_to_measurand_enum, options),
+            make_enum_benchmark<ReadingContextEnum>("ReadingContextEnum", conversions::reading_context_enum_to_string,
+                                                    conversions::string_to_reading_context_enum, options),
+            make_enum_benchmark<AttributeEnum>("AttributeEnum", conversions::attribute_enum_to_string,
+                                               conversions::string_to_attribute_enum, options),
+        };
+
+        for (const auto& benchmark : benchmarks) {
+            report(benchmark, options);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
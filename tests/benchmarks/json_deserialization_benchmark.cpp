@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/v16/messages/SendLocalList.hpp>
+#include <ocpp/v201/messages/SetChargingProfile.hpp>
+
+namespace po = boost::program_options;
+
+// Counts every allocation of the benchmark process
+static std::atomic<size_t> allocation_count{0};
+
+void* operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace ocpp {
+namespace benchmarks {
+
+struct BenchmarkOptions {
+    size_t entries;
+    size_t repetitions;
+};
+
+struct BenchmarkResult {
+    std::chrono::nanoseconds elapsed{};
+    size_t allocations;
+};
+
+/// \brief A received CALL and the two ways of deserializing it: json::parse followed by the from_json conversion, and
+/// the JsonSaxReader that reads the text directly into the message type
+struct MessageBenchmark {
+    std::string name;
+    std::string message;
+    std::function<size_t(const std::string&)> dom;
+    std::function<size_t(const std::string&)> sax;
+};
+
+/// \brief Creates a SetChargingProfile CALL with a charging schedule of \p entries periods
+static std::string make_set_charging_profile(size_t entries) {
+    json periods = json::array();
+    for (size_t i = 0; i < entries; i++) {
+        periods.push_back({{"startPeriod", i * 60}, {"limit", 11000.0 - static_cast<double>(i)}, {"numberPhases", 3}});
+    }
+    const json payload = {{"evseId", 1},
+                          {"chargingProfile",
+                           {{"id", 1},
+                            {"stackLevel", 0},
+                            {"chargingProfilePurpose", "TxDefaultProfile"},
+                            {"chargingProfileKind", "Absolute"},
+                            {"chargingSchedule",
+                             {{{"id", 1},
+                               {"chargingRateUnit", "W"},
+                               {"startSchedule", "2024-01-01T00:00:00.000Z"},
+                               {"chargingSchedulePeriod", periods}}}}}}};
+    return json::array({MessageTypeId::CALL, "1", "SetChargingProfile", payload}).dump();
+}
+
+/// \brief Creates a SendLocalList CALL with \p entries authorization data entries
+static std::string make_send_local_list(size_t entries) {
+    json list = json::array();
+    for (size_t i = 0; i < entries; i++) {
+        list.push_back({{"idTag", "TAG" + std::to_string(i)},
+                        {"idTagInfo", {{"status", "Accepted"}, {"parentIdTag", "PARENT" + std::to_string(i % 10)}}}});
+    }
+    const json payload = {{"listVersion", 1}, {"updateType", "Full"}, {"localAuthorizationList", list}};
+    return json::array({MessageTypeId::CALL, "1", "SendLocalList", payload}).dump();
+}
+
+template <typename T, typename Size>
+static MessageBenchmark make_message_benchmark(const std::string& name, const std::string& message, Size size) {
+    return {name, message,
+            [size](const std::string& text) {
+                const Call<T> call = json::parse(text);
+                return size(call.msg);
+            },
+            [size](const std::string& text) { return size(read_call<T>(text).msg); }};
+}
+
+static BenchmarkResult run_benchmark(const std::string& message, size_t repetitions,
+                                     const std::function<size_t(const std::string&)>& deserialize) {
+    volatile size_t sink = 0;
+    const auto allocations_before = allocation_count.load();
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < repetitions; r++) {
+        sink = sink + deserialize(message);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return {std::chrono::duration_cast<std::chrono::nanoseconds>(end - start),
+            allocation_count.load() - allocations_before};
+}
+
+static void report(const MessageBenchmark& benchmark, const BenchmarkOptions& options) {
+    const auto repetitions = static_cast<double>(options.repetitions);
+    const auto dom = run_benchmark(benchmark.message, options.repetitions, benchmark.dom);
+    const auto sax = run_benchmark(benchmark.message, options.repetitions, benchmark.sax);
+
+    const double dom_us = dom.elapsed.count() / repetitions / 1000.0;
+    const double sax_us = sax.elapsed.count() / repetitions / 1000.0;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << benchmark.name << " (" << benchmark.message.size() << " bytes)\n";
+    std::cout << "  json::parse + from_json: " << dom_us << " us / message, "
+              << static_cast<double>(dom.allocations) / repetitions << " allocations / message\n";
+    std::cout << "  JsonSaxReader:           " << sax_us << " us / message, "
+              << static_cast<double>(sax.allocations) / repetitions << " allocations / message\n";
+    std::cout << "  speedup:                 " << (sax_us > 0 ? dom_us / sax_us : 0.0) << "x\n";
+}
+
+} // namespace benchmarks
+} // namespace ocpp
+
+int main(int argc, char* argv[]) {
+    using namespace ocpp;
+    using namespace ocpp::benchmarks;
+
+    po::options_description desc("Message deserialization benchmark");
+    desc.add_options()("help,h", "produce help message");
+    desc.add_options()("entries", po::value<size_t>()->default_value(500),
+                       "number of charging schedule periods and local authorization list entries per message");
+    desc.add_options()("repetitions", po::value<size_t>()->default_value(1000),
+                       "number of times every message is deserialized");
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0) {
+        std::cout << desc << "\n";
+        return 1;
+    }
+
+    BenchmarkOptions options{vm["entries"].as<size_t>(), vm["repetitions"].as<size_t>()};
+
+    try {
+        const std::vector<MessageBenchmark> benchmarks{
+            make_message_benchmark<v201::SetChargingProfileRequest>(
+                "SetChargingProfile", make_set_charging_profile(options.entries),
+                [](const v201::SetChargingProfileRequest& request) {
+                    return request.chargingProfile.chargingSchedule.at(0).chargingSchedulePeriod.size();
+                }),
+            make_message_benchmark<v16::SendLocalListRequest>(
+                "SendLocalList", make_send_local_list(options.entries),
+                [](const v16::SendLocalListRequest& request) { return request.localAuthorizationList->size(); }),
+        };
+
+        for (const auto& benchmark : benchmarks) {
+            report(benchmark, options);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <ocpp/common/call_types.hpp>
+#include <ocpp/common/json_writer.hpp>
+#include <ocpp/common/message_queue.hpp>
+#include <ocpp/v201/messages/NotifyReport.hpp>
+#include <ocpp/v201/messages/TransactionEvent.hpp>
+
+namespace po = boost::program_options;
+
+// Counts every allocation of the benchmark process
+static std::atomic<size_t> allocation_count{0};
+
+void* operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace ocpp {
+namespace benchmarks {
+
+struct BenchmarkOptions {
+    size_t entries;
+    size_t repetitions;
+};
+
+struct BenchmarkResult {
+    std::chrono::nanoseconds elapsed{};
+    size_t allocations;
+};
+
+/// \brief An outgoing CALL and the two ways of serializing it: the to_json conversion followed by json::dump, and the
+/// generated write_json functions that write the text into a JsonWriter that is reused for every message. A CALL that
+/// is pushed to the message queue still needs its json value, so for it only the json::dump of the queued message is
+/// replaced by write_json
+struct MessageBenchmark {
+    std::string name;
+    std::function<size_t()> dom;
+    std::function<size_t()> writer;
+    std::function<size_t()> queued_dom;
+    std::function<size_t()> queued_writer;
+};
+
+/// \brief Creates a TransactionEvent with \p entries meter values of a typical three phase meter
+static v201::TransactionEventRequest make_transaction_event(size_t entries) {
+    const json sampled_values = {
+        {{"value", 1234.5}, {"measurand", "Energy.Active.Import.Register"}, {"context", "Sample.Periodic"}},
+        {{"value", 7400.0}, {"measurand", "Power.Active.Import"}, {"context", "Sample.Periodic"}},
+        {{"value", 230.1}, {"measurand", "Voltage"}, {"phase", "L1-N"}, {"unitOfMeasure", {{"unit", "V"}}}},
+        {{"value", 229.8}, {"measurand", "Voltage"}, {"phase", "L2-N"}, {"unitOfMeasure", {{"unit", "V"}}}},
+        {{"value", 231.2}, {"measurand", "Voltage"}, {"phase", "L3-N"}, {"unitOfMeasure", {{"unit", "V"}}}},
+        {{"value", 10.7}, {"measurand", "Current.Import"}, {"phase", "L1"}},
+        {{"value", 10.6}, {"measurand", "Current.Import"}, {"phase", "L2"}},
+        {{"value", 10.8}, {"measurand", "Current.Import"}, {"phase", "L3"}},
+    };
+    json meter_values = json::array();
+    for (size_t i = 0; i < entries; i++) {
+        meter_values.push_back({{"timestamp", "2024-01-01T00:00:00.000Z"}, {"sampledValue", sampled_values}});
+    }
+    return json{{"eventType", "Updated"},
+                {"timestamp", "2024-01-01T00:00:00.000Z"},
+                {"triggerReason", "MeterValuePeriodic"},
+                {"seqNo", 1},
+                {"transactionInfo", {{"transactionId", "8a3d5b1e-8f5c-4d5e-9a6b-1c2d3e4f5a6b"}}},
+                {"evse", {{"id", 1}, {"connectorId", 1}}},
+                {"meterValue", meter_values}};
+}
+
+/// \brief Creates a NotifyReport with \p entries report data entries like the ones of a base report
+static v201::NotifyReportRequest make_notify_report(size_t entries) {
+    json report_data = json::array();
+    for (size_t i = 0; i < entries; i++) {
+        report_data.push_back({{"component", {{"name", "SampledDataCtrlr"}, {"evse", {{"id", i % 2 + 1}}}}},
+                               {"variable", {{"name", "TxUpdatedMeasurands"}, {"instance", std::to_string(i)}}},
+                               {"variableAttribute",
+                                {{{"type", "Actual"},
+                                  {"value", "Energy.Active.Import.Register,Power.Active.Import"},
+                                  {"mutability", "ReadWrite"},
+                                  {"persistent", true},
+                                  {"constant", false}}}},
+                               {"variableCharacteristics",
+                                {{"dataType", "MemberList"},
+                                 {"supportsMonitoring", false},
+                                 {"valuesList", "Energy.Active.Import.Register,Power.Active.Import,Voltage"}}}});
+    }
+    return json{{"requestId", 1},
+                {"generatedAt", "2024-01-01T00:00:00.000Z"},
+                {"seqNo", 0},
+                {"tbc", false},
+                {"reportData", report_data}};
+}
+
+template <typename T> static MessageBenchmark make_message_benchmark(const std::string& name, const T& message) {
+    const auto call = std::make_shared<Call<T>>(message, MessageId("8a3d5b1e-8f5c-4d5e-9a6b-1c2d3e4f5a6b"));
+    const auto writer = std::make_shared<JsonWriter>();
+    return {name, [call]() { return json(*call).dump().size(); },
+            [call, writer]() {
+                writer->clear();
+                write_json(*writer, *call);
+                return writer->str().size();
+            },
+            [call]() {
+                ControlMessage<v201::MessageType> message(*call);
+                return message.serialized_message()->size();
+            },
+            [call, writer]() {
+                // like MessageQueue::push: the queued message keeps a copy of the text and no json value, the writer
+                // keeps its buffer
+                writer->clear();
+                write_json(*writer, *call);
+                ControlMessage<v201::MessageType> message(writer->str(), v201::MessageType::TransactionEvent,
+                                                          call->uniqueId);
+                return message.serialized_message()->size();
+            }};
+}
+
+static BenchmarkResult run_benchmark(size_t repetitions, const std::function<size_t()>& serialize) {
+    volatile size_t sink = 0;
+    const auto allocations_before = allocation_count.load();
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < repetitions; r++) {
+        sink = sink + serialize();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return {std::chrono::duration_cast<std::chrono::nanoseconds>(end - start),
+            allocation_count.load() - allocations_before};
+}
+
+static void report(const MessageBenchmark& benchmark, const BenchmarkOptions& options) {
+    const auto repetitions = static_cast<double>(options.repetitions);
+    // the first message sizes the buffer of the reused writer
+    const auto size = benchmark.writer();
+    const auto dom = run_benchmark(options.repetitions, benchmark.dom);
+    const auto writer = run_benchmark(options.repetitions, benchmark.writer);
+    const auto queued_dom = run_benchmark(options.repetitions, benchmark.queued_dom);
+    const auto queued_writer = run_benchmark(options.repetitions, benchmark.queued_writer);
+
+    const double dom_us = dom.elapsed.count() / repetitions / 1000.0;
+    const double writer_us = writer.elapsed.count() / repetitions / 1000.0;
+    const double queued_dom_us = queued_dom.elapsed.count() / repetitions / 1000.0;
+    const double queued_writer_us = queued_writer.elapsed.count() / repetitions / 1000.0;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << benchmark.name << " (" << size << " bytes)\n";
+    std::cout << "  to_json + json::dump: " << dom_us << " us / message, "
+              << static_cast<double>(dom.allocations) / repetitions << " allocations / message\n";
+    std::cout << "  JsonWriter:           " << writer_us << " us / message, "
+              << static_cast<double>(writer.allocations) / repetitions << " allocations / message\n";
+    std::cout << "  speedup:              " << (writer_us > 0 ? dom_us / writer_us : 0.0) << "x\n";
+    std::cout << "  queued CALL, json::dump: " << queued_dom_us << " us / message, "
+              << static_cast<double>(queued_dom.allocations) / repetitions << " allocations / message\n";
+    std::cout << "  queued CALL, JsonWriter: " << queued_writer_us << " us / message, "
+              << static_cast<double>(queued_writer.allocations) / repetitions << " allocations / message\n";
+    std::cout << "  queued CALL speedup:     " << (queued_writer_us > 0 ? queued_dom_us / queued_writer_us : 0.0)
+              << "x\n";
+}
+
+} // namespace benchmarks
+} // namespace ocpp
+
+int main(int argc, char* argv[]) {
+    using namespace ocpp;
+    using namespace ocpp::benchmarks;
+
+    po::options_description desc("Message serialization benchmark");
+    desc.add_options()("help,h", "produce help message");
+    desc.add_options()("entries", po::value<size_t>()->default_value(100),
+                       "number of meter values and report data entries per message");
+    desc.add_options()("repetitions", po::value<size_t>()->default_value(1000),
+                       "number of times every message is serialized");
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0) {
+        std::cout << desc << "\n";
+        return 1;
+    }
+
+    BenchmarkOptions options{vm["entries"].as<size_t>(), vm["repetitions"].as<size_t>()};
+
+    try {
+        const std::vector<MessageBenchmark> benchmarks{
+            make_message_benchmark("TransactionEvent", make_transaction_event(options.entries)),
+            make_message_benchmark("NotifyReport", make_notify_report(options.entries)),
+        };
+
+        for (const auto& benchmark : benchmarks) {
+            if (benchmark.dom() != benchmark.writer() or benchmark.queued_dom() != benchmark.queued_writer()) {
+                std::cerr << "Benchmark failed: " << benchmark.name << " is not serialized like json::dump"
+                          << std::endl;
+                return 1;
+            }
+            report(benchmark, options);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,233 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include "loopback_csms.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+
+#include <libwebsockets.h>
+
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/x509.h>
+#include <openssl/x509v3.h>
+
+namespace ocpp {
+namespace benchmarks {
+
+namespace {
+
+template <typename T, void (*Free)(T*)> using OpenSSLPtr = std::unique_ptr<T, decltype(Free)>;
+
+void add_extension(X509* certificate, int nid, const char* value) {
+    X509V3_CTX ctx;
+    X509V3_set_ctx_nodb(&ctx);
+    X509V3_set_ctx(&ctx, certificate, certificate, nullptr, nullptr, 0);
+    X509_EXTENSION* extension = X509V3_EXT_conf_nid(nullptr, &ctx, nid, value);
+    if (extension == nullptr or X509_add_ext(certificate, extension, -1) != 1) {
+        X509_EXTENSION_free(extension);
+        throw std::runtime_error("Could not add extension to self-signed certificate");
+    }
+    X509_EXTENSION_free(extension);
+}
+
+void write_pem(const std::filesystem::path& path, const std::function<int(FILE*)>& write) {
+    FILE* file = std::fopen(path.c_str(), "w");
+    if (file == nullptr) {
+        throw std::runtime_error("Could not open " + path.string() + " for writing");
+    }
+    const int result = write(file);
+    std::fclose(file);
+    if (result != 1) {
+        throw std::runtime_error("Could not write " + path.string());
+    }
+}
+
+int callback_loopback(lws* wsi, lws_callback_reasons reason, void* user, void* in, size_t len) {
+    if (wsi == nullptr) {
+        return 0;
+    }
+    auto* csms = static_cast<LoopbackCsms*>(lws_context_user(lws_get_context(wsi)));
+    if (csms == nullptr) {
+        return 0;
+    }
+    return csms->process_callback(wsi, static_cast<int>(reason), in, len);
+}
+
+// The client offers exactly one of the OCPP subprotocols, which are all handled the same
+const lws_protocols protocols[] = {{"ocpp1.6", callback_loopback, 0, 0, 0, nullptr, 0},
+                                   {"ocpp2.0.1", callback_loopback, 0, 0, 0, nullptr, 0},
+                                   LWS_PROTOCOL_LIST_TERM};
+
+#ifndef LWS_WITHOUT_EXTENSIONS
+const lws_extension extensions[] = {
+    {"permessage-deflate", lws_extension_callback_pm_deflate, "permessage-deflate; client_max_window_bits"},
+    {nullptr, nullptr, nullptr}};
+#endif
+
+} // namespace
+
+SelfSignedCertificate generate_self_signed_certificate(const std::filesystem::path& directory) {
+    OpenSSLPtr<EVP_PKEY, EVP_PKEY_free> key(EVP_EC_gen("P-256"), EVP_PKEY_free);
+    OpenSSLPtr<X509, X509_free> certificate(X509_new(), X509_free);
+    if (key == nullptr or certificate == nullptr) {
+        throw std::runtime_error("Could not create key for self-signed certificate");
+    }
+
+    X509_set_version(certificate.get(), 2);
+    ASN1_INTEGER_set(X509_get_serialNumber(certificate.get()), 1);
+    X509_gmtime_adj(X509_getm_notBefore(certificate.get()), 0);
+    X509_gmtime_adj(X509_getm_notAfter(certificate.get()), 60L * 60 * 24);
+    X509_set_pubkey(certificate.get(), key.get());
+
+    X509_NAME* name = X509_get_subject_name(certificate.get());
+    X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, reinterpret_cast<const unsigned char*>("localhost"), -1, -1,
+                               0);
+    X509_set_issuer_name(certificate.get(), name);
+
+    // The certificate is its own trust anchor for the client
+    add_extension(certificate.get(), NID_basic_constraints, "critical,CA:TRUE");
+    add_extension(certificate.get(), NID_key_usage, "critical,digitalSignature,keyCertSign");
+    add_extension(certificate.get(), NID_subject_alt_name, "DNS:localhost,IP:127.0.0.1");
+
+    if (X509_sign(certificate.get(), key.get(), EVP_sha256()) == 0) {
+        throw std::runtime_error("Could not sign self-signed certificate");
+    }
+
+    SelfSignedCertificate result{directory / "loopback_csms_cert.pem", directory / "loopback_csms_key.pem"};
+    write_pem(result.certificate_path, [&](FILE* file) { return PEM_write_X509(file, certificate.get()); });
+    write_pem(result.private_key_path, [&](FILE* file) {
+        return PEM_write_PrivateKey(file, key.get(), nullptr, nullptr, 0, nullptr, nullptr);
+    });
+    return result;
+}
+
+LoopbackCsms::LoopbackCsms(int port, const std::optional<SelfSignedCertificate>& certificate,
+                           bool enable_permessage_deflate, size_t fragment_size) :
+    context(nullptr, lws_context_destroy), port(port), fragment_size(fragment_size), stopped(false) {
+    lws_set_log_level(LLL_ERR, nullptr);
+
+    lws_context_creation_info info;
+    std::memset(&info, 0, sizeof(lws_context_creation_info));
+
+    info.port = port;
+    info.iface = "127.0.0.1";
+    info.protocols = protocols;
+    info.user = this;
+
+    // Lifetime of these is important since libwebsockets reads the files while creating the context
+    std::string certificate_path;
+    std::string private_key_path;
+    if (certificate.has_value()) {
+        certificate_path = certificate.value().certificate_path.string();
+        private_key_path = certificate.value().private_key_path.string();
+        info.options |= LWS_SERVER_OPTION_DO_SSL_GLOBAL_INIT;
+        info.ssl_cert_filepath = certificate_path.c_str();
+        info.ssl_private_key_filepath = private_key_path.c_str();
+    }
+
+    if (enable_permessage_deflate) {
+#ifndef LWS_WITHOUT_EXTENSIONS
+        info.extensions = extensions;
+#else
+        std::fprintf(stderr, "permessage-deflate is enabled, but libwebsockets has been built without extension "
+                             "support\n");
+#endif
+    }
+
+    this->context.reset(lws_create_context(&info));
+    if (this->context == nullptr) {
+        throw std::runtime_error("Could not create libwebsockets context of the loopback CSMS");
+    }
+
+    if (lws_vhost* vhost = lws_get_vhost_by_name(this->context.get(), "default")) {
+        this->port = lws_get_vhost_listen_port(vhost);
+    }
+}
+
+LoopbackCsms::~LoopbackCsms() {
+}
+
+int LoopbackCsms::get_port() const {
+    return this->port;
+}
+
+void LoopbackCsms::run() {
+    while (!this->stopped and lws_service(this->context.get(), 0) >= 0) {
+    }
+}
+
+void LoopbackCsms::stop() {
+    this->stopped = true;
+    lws_cancel_service(this->context.get());
+}
+
+int LoopbackCsms::process_callback(lws* wsi, int callback_reason, void* in, size_t len) {
+    switch (static_cast<lws_callback_reasons>(callback_reason)) {
+    case LWS_CALLBACK_ESTABLISHED:
+        this->sessions[wsi] = Session{};
+        break;
+
+    case LWS_CALLBACK_CLOSED:
+        this->sessions.erase(wsi);
+        break;
+
+    case LWS_CALLBACK_RECEIVE: {
+        auto& session = this->sessions[wsi];
+        session.received.append(static_cast<const char*>(in), len);
+        if (lws_remaining_packet_payload(wsi) == 0 and lws_is_final_fragment(wsi)) {
+            session.pending.push(std::move(session.received));
+            session.received = std::string{};
+            lws_callback_on_writable(wsi);
+        }
+    } break;
+
+    case LWS_CALLBACK_SERVER_WRITEABLE: {
+        auto it = this->sessions.find(wsi);
+        if (it == this->sessions.end() or it->second.pending.empty()) {
+            break;
+        }
+
+        // A single write per callback, libwebsockets buffers what could not be written yet
+        auto& session = it->second;
+        const auto& message = session.pending.front();
+        size_t length = message.size() - session.written;
+        if (this->fragment_size > 0) {
+            length = std::min(length, this->fragment_size);
+        }
+        const bool is_start = session.written == 0;
+        const bool is_end = session.written + length == message.size();
+
+        this->write_buffer.resize(LWS_PRE + length);
+        std::memcpy(this->write_buffer.data() + LWS_PRE, message.data() + session.written, length);
+        const auto written =
+            lws_write(wsi, reinterpret_cast<unsigned char*>(this->write_buffer.data() + LWS_PRE), length,
+                      static_cast<lws_write_protocol>(lws_write_ws_flags(LWS_WRITE_TEXT, is_start, is_end)));
+        if (written < 0) {
+            return -1;
+        }
+
+        if (is_end) {
+            session.pending.pop();
+            session.written = 0;
+        } else {
+            session.written += length;
+        }
+
+        if (!session.pending.empty()) {
+            lws_callback_on_writable(wsi);
+        }
+    } break;
+
+    default:
+        break;
+    }
+
+    return 0;
+}
+
+} // namespace benchmarks
+} // namespace ocpp
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_BENCHMARKS_LOOPBACK_CSMS_HPP
+#define OCPP_BENCHMARKS_LOOPBACK_CSMS_HPP
+
+#include <atomic>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <string>
+
+struct lws;
+struct lws_context;
+
+namespace ocpp {
+namespace benchmarks {
+
+/// \brief Paths of a self-signed certificate and its private key, written to PEM files
+struct SelfSignedCertificate {
+    std::filesystem::path certificate_path;
+    std::filesystem::path private_key_path;
+};
+
+/// \brief Generates an EC key and a self-signed certificate for localhost / 127.0.0.1 that is also usable as its own
+/// CA and writes both to \p directory
+/// \throws std::runtime_error if the certificate could not be generated or written
+SelfSignedCertificate generate_self_signed_certificate(const std::filesystem::path& directory);
+
+/// \brief Minimal stand-in for a CSMS that accepts websocket connections with the OCPP subprotocols on the loopback
+/// interface and echoes every received message back to its sender unchanged
+class LoopbackCsms {
+public:
+    /// \brief Creates a server that listens on \p port of 127.0.0.1, on a free port chosen by the kernel if \p port
+    /// is 0. TLS is used if \p certificate is set. The permessage-deflate extension is accepted if \p
+    /// enable_permessage_deflate is true. Echoed messages are split into fragments of at most \p fragment_size bytes,
+    /// 0 echoes each message in a single frame
+    /// \throws std::runtime_error if the libwebsockets context could not be created
+    LoopbackCsms(int port, const std::optional<SelfSignedCertificate>& certificate, bool enable_permessage_deflate,
+                 size_t fragment_size = 0);
+    ~LoopbackCsms();
+
+    /// \brief Returns the port the server is listening on
+    int get_port() const;
+
+    /// \brief Services the connections until stop() is called or the process is terminated
+    void run();
+
+    /// \brief Makes run() return, can be called from any thread
+    void stop();
+
+    int process_callback(lws* wsi, int callback_reason, void* in, size_t len);
+
+private:
+    struct Session {
+        std::string received;
+        std::queue<std::string> pending;
+        // Bytes of the front of pending that have already been written
+        size_t written = 0;
+    };
+
+    std::unique_ptr<lws_context, void (*)(lws_context*)> context;
+    std::map<lws*, Session> sessions;
+    // Reused for writing, holds LWS_PRE bytes of padding in front of the payload
+    std::string write_buffer;
+    int port;
+    size_t fragment_size;
+    std::atomic_bool stopped;
+};
+
+} // namespace benchmarks
+} // namespace ocpp
+
+#endif // OCPP_BENCHMARKS_LOOPBACK_CSMS_HPP
@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <ocpp/common/message_schema_validator.hpp>
+#include <ocpp/v201/messages/SetChargingProfile.hpp>
+#include <ocpp/v201/messages/SetVariables.hpp>
+
+namespace po = boost::program_options;
+
+namespace ocpp {
+namespace benchmarks {
+
+struct BenchmarkOptions {
+    size_t entries;
+    size_t repetitions;
+};
+
+/// \brief A received CALL, the deserialization that every received CALL goes through and the schema validation that
+/// is added in front of it
+struct MessageBenchmark {
+    std::string name;
+    std::string message;
+    std::function<size_t(const json&)> deserialize;
+};
+
+/// \brief Creates a SetChargingProfile CALL with a charging schedule of \p entries periods
+static std::string make_set_charging_profile(size_t entries) {
+    json periods = json::array();
+    for (size_t i = 0; i < entries; i++) {
+        periods.push_back({{"startPeriod", i * 60}, {"limit", 11000.0 - static_cast<double>(i)}, {"numberPhases", 3}});
+    }
+    const json payload = {{"evseId", 1},
+                          {"chargingProfile",
+                           {{"id", 1},
+                            {"stackLevel", 0},
+                            {"chargingProfilePurpose", "TxDefaultProfile"},
+                            {"chargingProfileKind", "Absolute"},
+                            {"chargingSchedule",
+                             {{{"id", 1},
+                               {"chargingRateUnit", "W"},
+                               {"startSchedule", "2024-01-01T00:00:00.000Z"},
+                               {"chargingSchedulePeriod", periods}}}}}}};
+    return json::array({MessageTypeId::CALL, "1", "SetChargingProfile", payload}).dump();
+}
+
+/// \brief Creates a SetVariables CALL that sets \p entries variables
+static std::string make_set_variables(size_t entries) {
+    json data = json::array();
+    for (size_t i = 0; i < entries; i++) {
+        data.push_back({{"attributeType", "Actual"},
+                        {"attributeValue", std::to_string(i)},
+                        {"component", {{"name", "SampledDataCtrlr"}, {"evse", {{"id", 1}}}}},
+                        {"variable", {{"name", "TxUpdatedInterval"}, {"instance", std::to_string(i)}}}});
+    }
+    return json::array({MessageTypeId::CALL, "1", "SetVariables", {{"setVariableData", data}}}).dump();
+}
+
+template <typename T, typename Size>
+static MessageBenchmark make_message_benchmark(const std::string& name, const std::string& message, Size size) {
+    return {name, message, [size](const json& call) {
+                const Call<T> c = call;
+                return size(c.msg);
+            }};
+}
+
+static std::chrono::nanoseconds run_benchmark(size_t repetitions, const std::function<size_t()>& run) {
+    volatile size_t sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < repetitions; r++) {
+        sink = sink + run();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+}
+
+static void report(const MessageBenchmark& benchmark, const MessageSchemaValidator<v201::MessageType>& validator,
+                   const BenchmarkOptions& options) {
+    EnhancedMessage<v201::MessageType> message;
+    message.message = json::parse(benchmark.message);
+    message.uniqueId = MessageId("1");
+    message.messageTypeId = MessageTypeId::CALL;
+    message.messageType = v201::conversions::string_to_messagetype(message.message.at(CALL_ACTION).get<std::string>());
+
+    const auto call_error = validator.validate(message);
+    if (call_error.has_value()) {
+        throw std::runtime_error(benchmark.name + " is invalid: " + call_error.value().errorDescription);
+    }
+
+    const auto parse =
+        run_benchmark(options.repetitions, [&benchmark]() { return json::parse(benchmark.message).size(); });
+    const auto deserialize =
+        run_benchmark(options.repetitions, [&benchmark, &message]() { return benchmark.deserialize(message.message); });
+    const auto validate = run_benchmark(options.repetitions, [&validator, &message]() {
+        return static_cast<size_t>(validator.validate(message).has_value());
+    });
+
+    const auto repetitions = static_cast<double>(options.repetitions);
+    const double parse_us = parse.count() / repetitions / 1000.0;
+    const double deserialize_us = deserialize.count() / repetitions / 1000.0;
+    const double validate_us = validate.count() / repetitions / 1000.0;
+    const double received_us = parse_us + deserialize_us;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << benchmark.name << " (" << benchmark.message.size() << " bytes)\n";
+    std::cout << "  json::parse:       " << parse_us << " us / message\n";
+    std::cout << "  from_json:         " << deserialize_us << " us / message\n";
+    std::cout << "  schema validation: " << validate_us << " us / message, "
+              << (received_us > 0 ? validate_us / received_us * 100.0 : 0.0) << "% of parse + from_json\n";
+}
+
+} // namespace benchmarks
+} // namespace ocpp
+
+int main(int argc, char* argv[]) {
+    using namespace ocpp;
+    using namespace ocpp::benchmarks;
+
+    po::options_description desc("Schema validation benchmark of received messages");
+    desc.add_options()("help,h", "produce help message");
+    desc.add_options()("schemas", po::value<std::string>()->required(),
+                       "directory with the OCPP 2.0.1 JSON schemas, e.g. SetChargingProfileRequest.json");
+    desc.add_options()("entries", po::value<size_t>()->default_value(10),
+                       "number of charging schedule periods and variables per message");
+    desc.add_options()("repetitions", po::value<size_t>()->default_value(10000),
+                       "number of times every message is validated");
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+
+    if (vm.count("help") != 0) {
+        std::cout << desc << "\n";
+        return 1;
+    }
+    po::notify(vm);
+
+    BenchmarkOptions options{vm["entries"].as<size_t>(), vm["repetitions"].as<size_t>()};
+
+    try {
+        const auto load_start = std::chrono::steady_clock::now();
+        const MessageSchemaValidator<v201::MessageType> validator(
+            vm["schemas"].as<std::string>(),
+            [](const std::string& action) { return v201::conversions::string_to_messagetype(action); });
+        const auto load_end = std::chrono::steady_clock::now();
+        std::cout << "Loaded " << validator.size() << " schemas in "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(load_end - load_start).count() << " ms\n";
+
+        const std::vector<MessageBenchmark> benchmarks{
+            make_message_benchmark<v201::SetChargingProfileRequest>(
+                "SetChargingProfile", make_set_charging_profile(options.entries),
+                [](const v201::SetChargingProfileRequest& request) {
+                    return request.chargingProfile.chargingSchedule.at(0).chargingSchedulePeriod.size();
+                }),
+            make_message_benchmark<v201::SetVariablesRequest>(
+                "SetVariables", make_set_variables(options.entries),
+                [](const v201::SetVariablesRequest& request) { return request.setVariableData.size(); }),
+        };
+
+        for (const auto& benchmark : benchmarks) {
+            report(benchmark, validator, options);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,480 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <boost/program_options.hpp>
+#include <everest/logging.hpp>
+
+#include <ocpp/common/evse_security.hpp>
+#include <ocpp/common/websocket/websocket_base.hpp>
+
+#ifdef LIBOCPP_ENABLE_DEPRECATED_WEBSOCKETPP
+#include <ocpp/common/websocket/websocket_plain.hpp>
+#include <ocpp/common/websocket/websocket_tls.hpp>
+#endif
+#include <ocpp/common/websocket/websocket_libwebsockets.hpp>
+
+#include "loopback_csms.hpp"
+
+namespace po = boost::program_options;
+
+// Counts every allocation of the benchmark process. The loopback CSMS runs in a child process, so only allocations of
+// the websocket client and of the benchmark itself are counted
+static std::atomic<size_t> allocation_count{0};
+
+void* operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace ocpp {
+namespace benchmarks {
+
+/// \brief EvseSecurity that only provides the self-signed certificate of the loopback CSMS as CSMS root
+class LoopbackEvseSecurity : public EvseSecurity {
+public:
+    explicit LoopbackEvseSecurity(const std::string& verify_file) : verify_file(verify_file) {
+    }
+
+    InstallCertificateResult install_ca_certificate(const std::string&, const CaCertificateType&) override {
+        return InstallCertificateResult::InvalidFormat;
+    }
+    DeleteCertificateResult delete_certificate(const CertificateHashDataType&) override {
+        return DeleteCertificateResult::NotFound;
+    }
+    InstallCertificateResult update_leaf_certificate(const std::string&, const CertificateSigningUseEnum&) override {
+        return InstallCertificateResult::InvalidFormat;
+    }
+    CertificateValidationResult verify_certificate(const std::string&, const LeafCertificateType&) override {
+        return CertificateValidationResult::IssuerNotFound;
+    }
+    std::vector<CertificateHashDataChain> get_installed_certificates(const std::vector<CertificateType>&) override {
+        return {};
+    }
+    std::vector<OCSPRequestData> get_v2g_ocsp_request_data() override {
+        return {};
+    }
+    std::vector<OCSPRequestData> get_mo_ocsp_request_data(const std::string&) override {
+        return {};
+    }
+    void update_ocsp_cache(const CertificateHashDataType&, const std::string&) override {
+    }
+    bool is_ca_certificate_installed(const CaCertificateType& certificate_type) override {
+        return certificate_type == CaCertificateType::CSMS and !this->verify_file.empty();
+    }
+    GetCertificateSignRequestResult generate_certificate_signing_request(const CertificateSigningUseEnum&,
+                                                                         const std::string&, const std::string&,
+                                                                         const std::string&, bool) override {
+        return {GetCertificateSignRequestStatus::GenerationError, std::nullopt};
+    }
+    GetCertificateInfoResult get_leaf_certificate_info(const CertificateSigningUseEnum&, bool) override {
+        return {GetCertificateInfoStatus::NotFound, std::nullopt};
+    }
+    bool update_certificate_links(const CertificateSigningUseEnum&) override {
+        return false;
+    }
+    std::string get_verify_file(const CaCertificateType&) override {
+        return this->verify_file;
+    }
+    int get_leaf_expiry_days_count(const CertificateSigningUseEnum&) override {
+        return 0;
+    }
+
+private:
+    std::string verify_file;
+};
+
+struct BenchmarkOptions {
+    bool tls;
+    std::string implementation;
+    size_t message_size;
+    size_t messages;
+    size_t warmup;
+    double rate;
+    bool single_threaded;
+    bool permessage_deflate;
+};
+
+struct BenchmarkResult {
+    size_t messages = 0;
+    size_t lost = 0;
+    std::chrono::steady_clock::duration elapsed{};
+    std::vector<std::chrono::steady_clock::duration> round_trips;
+    size_t allocations = 0;
+    std::chrono::nanoseconds cpu_time{};
+    WebsocketTlsStatistics tls_statistics;
+};
+
+/// \brief Starts the loopback CSMS in a child process and returns its pid and the port it listens on
+static std::pair<pid_t, int> start_loopback_csms(const std::optional<SelfSignedCertificate>& certificate,
+                                                 bool permessage_deflate) {
+    int port_pipe[2];
+    if (pipe(port_pipe) != 0) {
+        throw std::runtime_error("Could not create pipe to the loopback CSMS");
+    }
+
+    const pid_t pid = fork();
+    if (pid < 0) {
+        throw std::runtime_error("Could not fork the loopback CSMS");
+    }
+
+    if (pid == 0) {
+        close(port_pipe[0]);
+        int port = -1;
+        try {
+            LoopbackCsms csms(0, certificate, permessage_deflate);
+            port = csms.get_port();
+            (void)!write(port_pipe[1], &port, sizeof(port));
+            close(port_pipe[1]);
+            csms.run();
+        } catch (const std::exception& e) {
+            std::cerr << "Loopback CSMS failed: " << e.what() << std::endl;
+            (void)!write(port_pipe[1], &port, sizeof(port));
+        }
+        _exit(0);
+    }
+
+    close(port_pipe[1]);
+    int port = -1;
+    const auto bytes_read = read(port_pipe[0], &port, sizeof(port));
+    close(port_pipe[0]);
+    if (bytes_read != sizeof(port) or port <= 0) {
+        kill(pid, SIGTERM);
+        waitpid(pid, nullptr, 0);
+        throw std::runtime_error("Loopback CSMS did not start");
+    }
+    return {pid, port};
+}
+
+static std::chrono::nanoseconds process_cpu_time() {
+    timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+}
+
+/// \brief Returns a CALL of \p size bytes (at least the size of the envelope) that carries \p sequence as message id
+static std::string make_message(size_t sequence, size_t size) {
+    std::string message = "[2,\"" + std::to_string(sequence) + "\",\"DataTransfer\",{\"data\":\"";
+    const std::string suffix = "\"}]";
+    if (message.size() + suffix.size() < size) {
+        message.append(size - message.size() - suffix.size(), 'x');
+    }
+    message += suffix;
+    return message;
+}
+
+static std::optional<size_t> parse_sequence(const std::string& message) {
+    const auto start = message.find('"');
+    if (start == std::string::npos) {
+        return std::nullopt;
+    }
+    size_t sequence = 0;
+    size_t i = start + 1;
+    for (; i < message.size() and message[i] >= '0' and message[i] <= '9'; ++i) {
+        sequence = sequence * 10 + (message[i] - '0');
+    }
+    if (i == start + 1 or i >= message.size() or message[i] != '"') {
+        return std::nullopt;
+    }
+    return sequence;
+}
+
+static std::unique_ptr<WebsocketBase> make_websocket(const BenchmarkOptions& options,
+                                                     const WebsocketConnectionOptions& connection_options,
+                                                     std::shared_ptr<EvseSecurity> evse_security) {
+    if (options.implementation == "websocketpp") {
+#ifdef LIBOCPP_ENABLE_DEPRECATED_WEBSOCKETPP
+        if (options.tls) {
+            return std::make_unique<WebsocketTLS>(connection_options, evse_security);
+        }
+        return std::make_unique<WebsocketPlain>(connection_options);
+#else
+        throw std::invalid_argument("libocpp has been built without LIBOCPP_ENABLE_DEPRECATED_WEBSOCKETPP");
+#endif
+    }
+    return std::make_unique<WebsocketTlsTPM>(connection_options, evse_security);
+}
+
+static BenchmarkResult run_benchmark(const BenchmarkOptions& options, int port,
+                                     const std::optional<SelfSignedCertificate>& certificate) {
+    const int security_profile = options.tls ? 2 : 1;
+    const auto uri = Uri::parse_and_validate((options.tls ? "wss://127.0.0.1:" : "ws://127.0.0.1:") +
+                                                 std::to_string(port),
+                                             "benchmark", security_profile);
+
+    WebsocketConnectionOptions connection_options{OcppProtocolVersion::v201,
+                                                  uri,
+                                                  security_profile,
+                                                  std::string("benchmark-password"),
+                                                  1,
+                                                  1,
+                                                  1,
+                                                  0,
+                                                  "ECDHE-ECDSA-AES128-GCM-SHA256:ECDHE-ECDSA-AES256-GCM-SHA384",
+                                                  "TLS_AES_256_GCM_SHA384:TLS_AES_128_GCM_SHA256",
+                                                  0,
+                                                  "payload",
+                                                  5,
+                                                  false,
+                                                  std::nullopt,
+                                                  std::nullopt,
+                                                  // the certificate is issued for localhost, the server is reached
+                                                  // via its address
+                                                  false,
+                                                  false,
+                                                  false,
+                                                  std::nullopt};
+    connection_options.use_single_threaded_event_loop = options.single_threaded;
+    connection_options.enable_permessage_deflate = options.permessage_deflate;
+
+    auto evse_security = std::make_shared<LoopbackEvseSecurity>(
+        certificate.has_value() ? certificate.value().certificate_path.string() : std::string{});
+    auto websocket = make_websocket(options, connection_options, evse_security);
+
+    const size_t total = options.warmup + options.messages;
+    std::vector<std::chrono::steady_clock::time_point> sent_at(total);
+    std::vector<std::chrono::steady_clock::time_point> received_at(total);
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool connected = false;
+    size_t received = 0;
+
+    websocket->register_connected_callback([&](const int) {
+        std::lock_guard<std::mutex> lk(mutex);
+        connected = true;
+        cv.notify_all();
+    });
+    websocket->register_closed_callback([](const WebsocketCloseReason) {});
+    websocket->register_disconnected_callback([]() {});
+    websocket->register_message_callback([&](const std::string& message) {
+        const auto now = std::chrono::steady_clock::now();
+        const auto sequence = parse_sequence(message);
+        if (!sequence.has_value() or sequence.value() >= total) {
+            return;
+        }
+        std::lock_guard<std::mutex> lk(mutex);
+        received_at[sequence.value()] = now;
+        received += 1;
+        cv.notify_all();
+    });
+
+    if (!websocket->connect()) {
+        throw std::runtime_error("Could not connect to the loopback CSMS");
+    }
+    {
+        std::unique_lock<std::mutex> lk(mutex);
+        if (!cv.wait_for(lk, std::chrono::seconds(10), [&] { return connected; })) {
+            throw std::runtime_error("Connected callback has not been called");
+        }
+    }
+
+    // Messages are prepared up front, so that the measurement does not include building them
+    std::vector<std::string> messages;
+    messages.reserve(total);
+    for (size_t i = 0; i < total; ++i) {
+        messages.push_back(make_message(i, options.message_size));
+    }
+
+    auto send = [&](size_t i) {
+        sent_at[i] = std::chrono::steady_clock::now();
+        websocket->send(messages[i]);
+    };
+
+    auto wait_for_received = [&](size_t count, std::chrono::seconds timeout) {
+        std::unique_lock<std::mutex> lk(mutex);
+        return cv.wait_for(lk, timeout, [&] { return received >= count; });
+    };
+
+    // Warmup runs closed loop, so that buffers and pools are populated before counting
+    for (size_t i = 0; i < options.warmup; ++i) {
+        send(i);
+        wait_for_received(i + 1, std::chrono::seconds(5));
+    }
+
+    BenchmarkResult result;
+    const auto allocations_before = allocation_count.load();
+    const auto cpu_before = process_cpu_time();
+    const auto start = std::chrono::steady_clock::now();
+
+    if (options.rate <= 0) {
+        // Closed loop: the next message is sent when the echo of the previous one has been received
+        for (size_t i = options.warmup; i < total; ++i) {
+            send(i);
+            if (!wait_for_received(i + 1, std::chrono::seconds(5))) {
+                break;
+            }
+        }
+    } else {
+        // Open loop: messages are sent at the requested rate regardless of the echoes
+        const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(1.0 / options.rate));
+        auto next = start;
+        for (size_t i = options.warmup; i < total; ++i) {
+            std::this_thread::sleep_until(next);
+            send(i);
+            next += interval;
+        }
+        wait_for_received(total, std::chrono::seconds(10));
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+    result.cpu_time = process_cpu_time() - cpu_before;
+    result.allocations = allocation_count.load() - allocations_before;
+    result.elapsed = end - start;
+
+    websocket->disconnect(WebsocketCloseReason::Normal);
+    result.tls_statistics = websocket->get_tls_statistics();
+
+    std::lock_guard<std::mutex> lk(mutex);
+    result.messages = options.messages;
+    for (size_t i = options.warmup; i < total; ++i) {
+        if (received_at[i] == std::chrono::steady_clock::time_point{}) {
+            result.lost += 1;
+        } else {
+            result.round_trips.push_back(received_at[i] - sent_at[i]);
+        }
+    }
+    std::sort(result.round_trips.begin(), result.round_trips.end());
+    return result;
+}
+
+static double to_us(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+static void report(const BenchmarkOptions& options, const BenchmarkResult& result) {
+    const size_t completed = result.messages - result.lost;
+    const double seconds = std::chrono::duration<double>(result.elapsed).count();
+
+    auto percentile = [&](double p) {
+        if (result.round_trips.empty()) {
+            return 0.0;
+        }
+        const auto index = std::min(result.round_trips.size() - 1,
+                                    static_cast<size_t>(p * static_cast<double>(result.round_trips.size())));
+        return to_us(result.round_trips[index]);
+    };
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "transport:           " << (options.tls ? "TLS" : "plain") << " (" << options.implementation
+              << (options.single_threaded ? ", single threaded" : "")
+              << (options.permessage_deflate ? ", permessage-deflate" : "") << ")\n";
+    std::cout << "message size:        " << options.message_size << " bytes\n";
+    std::cout << "messages:            " << completed << " echoed, " << result.lost << " lost\n";
+    std::cout << "throughput:          " << (seconds > 0 ? completed / seconds : 0.0) << " msg/s, "
+              << (seconds > 0 ? completed * options.message_size / seconds / (1024 * 1024) : 0.0) << " MiB/s\n";
+    std::cout << "round trip p50:      " << percentile(0.50) << " us\n";
+    std::cout << "round trip p99:      " << percentile(0.99) << " us\n";
+    std::cout << "round trip max:      " << (result.round_trips.empty() ? 0.0 : to_us(result.round_trips.back()))
+              << " us\n";
+    if (result.messages > 0) {
+        std::cout << "allocations / msg:   " << static_cast<double>(result.allocations) / result.messages << "\n";
+        std::cout << "CPU / msg:           " << to_us(result.cpu_time) / result.messages << " us\n";
+    }
+    if (result.tls_statistics.handshakes > 0) {
+        std::cout << "TLS handshake:       " << to_us(result.tls_statistics.total_handshake_time) /
+                                                     result.tls_statistics.handshakes
+                  << " us average, " << result.tls_statistics.resumed_handshakes << " of "
+                  << result.tls_statistics.handshakes << " resumed\n";
+    }
+}
+
+} // namespace benchmarks
+} // namespace ocpp
+
+int main(int argc, char* argv[]) {
+    using namespace ocpp::benchmarks;
+
+    po::options_description desc("Websocket transport benchmark against a loopback CSMS");
+    desc.add_options()("help,h", "produce help message");
+    desc.add_options()("tls", po::bool_switch(), "connect with TLS (security profile 2) instead of plain websockets");
+    desc.add_options()("implementation", po::value<std::string>()->default_value("libwebsockets"),
+                       "websocket implementation: libwebsockets or websocketpp");
+    desc.add_options()("message-size", po::value<size_t>()->default_value(256), "size of each message in bytes");
+    desc.add_options()("messages", po::value<size_t>()->default_value(10000), "number of measured messages");
+    desc.add_options()("warmup", po::value<size_t>()->default_value(100), "number of messages sent before measuring");
+    desc.add_options()("rate", po::value<double>()->default_value(0),
+                       "messages per second, 0 sends each message after the previous echo has been received");
+    desc.add_options()("single-threaded", po::bool_switch(), "use the single threaded event loop of libwebsockets");
+    desc.add_options()("permessage-deflate", po::bool_switch(), "offer and accept permessage-deflate");
+    desc.add_options()("logconf", po::value<std::string>()->default_value(LOGGING_CONFIG_DEFAULT),
+                       "The path to a custom logging.ini");
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0) {
+        std::cout << desc << "\n";
+        return 1;
+    }
+
+    BenchmarkOptions options{vm["tls"].as<bool>(),
+                             vm["implementation"].as<std::string>(),
+                             vm["message-size"].as<size_t>(),
+                             vm["messages"].as<size_t>(),
+                             vm["warmup"].as<size_t>(),
+                             vm["rate"].as<double>(),
+                             vm["single-threaded"].as<bool>(),
+                             vm["permessage-deflate"].as<bool>()};
+
+    std::optional<SelfSignedCertificate> certificate;
+    const auto certificate_directory = std::filesystem::temp_directory_path() /
+                                       ("libocpp_websocket_benchmark_" + std::to_string(getpid()));
+
+    int exit_code = 0;
+    pid_t csms_pid = -1;
+    try {
+        if (options.tls) {
+            std::filesystem::create_directories(certificate_directory);
+            certificate = generate_self_signed_certificate(certificate_directory);
+        }
+
+        // Forked before any thread is started
+        const auto [pid, port] = start_loopback_csms(certificate, options.permessage_deflate);
+        csms_pid = pid;
+
+        Everest::Logging::init(vm["logconf"].as<std::string>(), "websocket_benchmark");
+
+        const auto result = run_benchmark(options, port, certificate);
+        report(options, result);
+    } catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        exit_code = 1;
+    }
+
+    if (csms_pid > 0) {
+        kill(csms_pid, SIGTERM);
+        waitpid(csms_pid, nullptr, 0);
+    }
+    std::filesystem::remove_all(certificate_directory);
+
+    return exit_code;
+}
@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ocpp/common/types.hpp>
+
+namespace ocpp {
+
+/// \brief Returns the string representations of all values of the enum \p E. The values of the generated enums are
+/// contiguous, so they are enumerated until \p to_string throws
+template <typename E, typename ToString> std::vector<std::string> enum_strings(ToString to_string) {
+    std::vector<std::string> strings;
+    for (int i = 0;; i++) {
+        try {
+            strings.push_back(to_string(static_cast<E>(i)));
+        } catch (const EnumToStringException&) {
+            break;
+        }
+    }
+    return strings;
+}
+
+/// \brief Checks \p from_string against the linear comparison it replaces: every string representation of \p E must
+/// convert back to its value, and every other string, including near misses of the valid ones, must throw a
+/// StringToEnumException. String representations in \p not_convertible are expected to throw as well
+template <typename E, typename ToString, typename FromString>
+void expect_enum_conversions(ToString to_string, FromString from_string, const std::string& name,
+                             const std::vector<std::string>& not_convertible = {}) {
+    SCOPED_TRACE(name);
+    const auto strings = enum_strings<E>(to_string);
+    ASSERT_FALSE(strings.empty());
+
+    auto reference = [&strings, &not_convertible](std::string_view s) -> std::optional<E> {
+        if (std::find(not_convertible.begin(), not_convertible.end(), s) != not_convertible.end()) {
+            return std::nullopt;
+        }
+        for (size_t i = 0; i < strings.size(); i++) {
+            if (s == strings.at(i)) {
+                return static_cast<E>(i);
+            }
+        }
+        return std::nullopt;
+    };
+
+    std::vector<std::string> candidates{"", " ", std::string(1, '\0')};
+    for (const auto& s : strings) {
+        candidates.push_back(s);
+        candidates.push_back(s + "x");
+        candidates.push_back(s + '\0');
+        candidates.push_back(" " + s);
+        candidates.push_back(s.substr(0, s.size() - 1));
+        candidates.push_back(s.substr(1));
+        for (size_t i = 0; i < s.size(); i++) {
+            auto changed = s;
+            changed[i] = std::isupper(static_cast<unsigned char>(s[i])) ? std::tolower(s[i]) : std::toupper(s[i]);
+            if (changed == s) {
+                changed[i] = '#';
+            }
+            candidates.push_back(changed);
+        }
+    }
+
+    for (const auto& candidate : candidates) {
+        const auto expected = reference(candidate);
+        if (expected.has_value()) {
+            EXPECT_EQ(from_string(candidate), expected.value()) << candidate;
+        } else {
+            EXPECT_THROW(from_string(candidate), StringToEnumException) << candidate;
+        }
+    }
+}
+
+} // namespace ocpp
+
+#define EXPECT_ENUM_CONVERSIONS(Enum, name)                                                                            \
+    ocpp::expect_enum_conversions<Enum>(conversions::name##_to_string, conversions::string_to_##name, #Enum)
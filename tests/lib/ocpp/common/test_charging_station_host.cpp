@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <future>
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include <everest/timer.hpp>
+#include <ocpp/common/charging_station_base.hpp>
+#include <ocpp/common/charging_station_host.hpp>
+
+#include "evse_security_mock.hpp"
+
+using namespace ocpp;
+
+namespace {
+
+class TimerStation : public ChargingStationBase {
+    std::vector<int> ticks;
+    Everest::SteadyTimer tick_timer;
+
+public:
+    TimerStation(std::shared_ptr<ChargingStationHost> host, std::promise<void>& started) :
+        ChargingStationBase(std::make_shared<EvseSecurityMock>(), std::nullopt, host), tick_timer(&this->io_service) {
+        this->tick_timer.interval(
+            [this, &started]() {
+                if (this->ticks.empty()) {
+                    started.set_value();
+                }
+                // keeps the handler running while the station is destroyed
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                this->ticks.push_back(static_cast<int>(this->ticks.size()));
+            },
+            std::chrono::milliseconds(1));
+    }
+
+    ~TimerStation() override {
+        this->hold_io_service([this]() { this->tick_timer.stop(); });
+    }
+};
+
+} // namespace
+
+TEST(ChargingStationHostTest, AtLeastOneExecutor) {
+    ChargingStationHost host(0);
+    EXPECT_EQ(host.get_number_of_executors(), 1);
+}
+
+TEST(ChargingStationHostTest, StationsAreSpreadOverExecutors) {
+    ChargingStationHost host(4);
+    std::set<boost::asio::io_service*> io_services;
+    std::vector<boost::asio::io_service*> acquired;
+    for (int i = 0; i < 8; i++) {
+        auto& io_service = host.acquire_io_service();
+        io_services.insert(&io_service);
+        acquired.push_back(&io_service);
+    }
+    EXPECT_EQ(io_services.size(), 4);
+    EXPECT_EQ(host.get_number_of_stations(), 8);
+
+    for (auto* io_service : acquired) {
+        host.release_io_service(*io_service);
+    }
+    EXPECT_EQ(host.get_number_of_stations(), 0);
+}
+
+TEST(ChargingStationHostTest, ReleasedExecutorIsReused) {
+    ChargingStationHost host(2);
+    auto& first = host.acquire_io_service();
+    auto& second = host.acquire_io_service();
+    EXPECT_NE(&first, &second);
+
+    host.release_io_service(first);
+    EXPECT_EQ(&host.acquire_io_service(), &first);
+}
+
+TEST(ChargingStationHostTest, TimersRunOnSharedExecutor) {
+    ChargingStationHost host(1);
+    auto& io_service = host.acquire_io_service();
+
+    std::promise<std::thread::id> first_thread;
+    std::promise<std::thread::id> second_thread;
+    Everest::SteadyTimer first_timer(&io_service);
+    Everest::SteadyTimer second_timer(&io_service);
+    first_timer.timeout([&first_thread]() { first_thread.set_value(std::this_thread::get_id()); },
+                        std::chrono::milliseconds(1));
+    second_timer.timeout([&second_thread]() { second_thread.set_value(std::this_thread::get_id()); },
+                         std::chrono::milliseconds(1));
+
+    auto first_future = first_thread.get_future();
+    auto second_future = second_thread.get_future();
+    ASSERT_EQ(first_future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_EQ(second_future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    const auto first_thread_id = first_future.get();
+    EXPECT_EQ(first_thread_id, second_future.get());
+    EXPECT_NE(first_thread_id, std::this_thread::get_id());
+
+    host.release_io_service(io_service);
+}
+
+TEST(ChargingStationHostTest, StationIsDestroyedWhileItsTimerRuns) {
+    auto host = std::make_shared<ChargingStationHost>(1);
+    std::promise<void> other_started;
+    TimerStation other(host, other_started);
+    for (int i = 0; i < 20; i++) {
+        std::promise<void> started;
+        auto station = std::make_unique<TimerStation>(host, started);
+        ASSERT_EQ(started.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+        station.reset();
+    }
+    EXPECT_EQ(host->get_number_of_stations(), 1);
+
+    // the executor keeps running the timers of the other station
+    auto& io_service = host->acquire_io_service();
+    std::promise<void> posted;
+    boost::asio::post(io_service, [&posted]() { posted.set_value(); });
+    EXPECT_EQ(posted.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    host->release_io_service(io_service);
+}
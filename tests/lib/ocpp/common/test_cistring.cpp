@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <ocpp/common/cistring.hpp>
+
+using namespace ocpp;
+
+TEST(CiStringTest, StoresShortStringsInline) {
+    EXPECT_LT(sizeof(CiString<20>), sizeof(std::string));
+    EXPECT_EQ(sizeof(CiString<500>), sizeof(std::string));
+
+    const CiString<20> id_tag("DEADBEEF");
+    const CiString<20> copy = id_tag;
+    EXPECT_EQ(copy.get(), "DEADBEEF");
+    EXPECT_EQ(copy.view(), "DEADBEEF");
+}
+
+TEST(CiStringTest, SetsUpToMaximumLength) {
+    CiString<20> id_tag;
+    EXPECT_EQ(id_tag.get(), "");
+
+    id_tag.set(std::string(20, 'a'));
+    EXPECT_EQ(id_tag.get(), std::string(20, 'a'));
+    EXPECT_THROW(id_tag.set(std::string(21, 'a')), std::runtime_error);
+    EXPECT_EQ(id_tag.get(), std::string(20, 'a'));
+
+    id_tag.set("short");
+    EXPECT_EQ(id_tag.get(), "short");
+
+    CiString<500> description(std::string(500, 'b'));
+    EXPECT_EQ(description.get(), std::string(500, 'b'));
+    EXPECT_THROW(CiString<500>(std::string(501, 'b')), std::runtime_error);
+    EXPECT_THROW(CiString<8>("123456789"), std::runtime_error);
+}
+
+TEST(CiStringTest, ValidatesPrintableAscii) {
+    CiString<20> id_tag;
+    EXPECT_TRUE(id_tag.is_valid("DEADBEEF 0123~"));
+    EXPECT_THROW(id_tag.is_valid("DEADBEEF\t"), std::runtime_error);
+    EXPECT_THROW(id_tag.is_valid("Stra\xc3\x9f"
+                                 "e"),
+                 std::runtime_error);
+
+    // the check is available on const strings, but not applied when the string is set
+    const CiString<20> tabbed("a\tb");
+    EXPECT_EQ(tabbed.get(), "a\tb");
+    EXPECT_THROW(tabbed.is_valid(tabbed.view()), std::runtime_error);
+}
+
+TEST(CiStringTest, ComparesCaseInsensitively) {
+    const CiString<36> lhs("Transaction-1");
+    const CiString<36> rhs("TRANSACTION-1");
+    EXPECT_TRUE(lhs == rhs);
+    EXPECT_FALSE(lhs != rhs);
+    EXPECT_TRUE(lhs == "transaction-1");
+    EXPECT_FALSE(lhs != "transaction-1");
+    EXPECT_TRUE(lhs != "Transaction-2");
+    EXPECT_TRUE(lhs != CiString<36>("Transaction-10"));
+}
+
+TEST(CiStringTest, WritesToStreamsAndJson) {
+    const CiString<255> vendor("EVerest");
+    std::ostringstream stream;
+    stream << vendor;
+    EXPECT_EQ(stream.str(), "EVerest");
+
+    json j = vendor;
+    EXPECT_EQ(j, "EVerest");
+    EXPECT_EQ(j.get<CiString<255>>(), vendor);
+}
+
+TEST(CiStringTest, OrdersCaseInsensitively) {
+    EXPECT_FALSE(CiString<20>("abc") < CiString<20>("ABC"));
+    EXPECT_FALSE(CiString<20>("ABC") < CiString<20>("abc"));
+    EXPECT_TRUE(CiString<20>("abc") < CiString<20>("ABD"));
+    EXPECT_TRUE(CiString<20>("ABC") < CiString<20>("abcd"));
+    // '_' is between the upper and the lower case letters
+    EXPECT_TRUE(CiString<20>("A_") < CiString<20>("Aa"));
+    EXPECT_TRUE(CiString<20>("a_") < CiString<20>("AA"));
+
+    std::map<CiString<50>, int> keys{{CiString<50>("HeartbeatInterval"), 1}};
+    EXPECT_EQ(keys.count(CiString<50>("heartbeatinterval")), 1);
+}
+
+TEST(CiStringTest, HashesCaseInsensitively) {
+    EXPECT_EQ(CiStringHash<20>()(CiString<20>("DeadBeef")), CiStringHash<20>()(CiString<20>("DEADBEEF")));
+    EXPECT_EQ(std::hash<CiString<20>>()(CiString<20>("DeadBeef")), std::hash<CiString<20>>()(CiString<20>("deadbeef")));
+    EXPECT_TRUE(CiStringEqual<36>()(CiString<36>("Transaction-1"), CiString<36>("TRANSACTION-1")));
+    EXPECT_FALSE(CiStringEqual<36>()(CiString<36>("Transaction-1"), CiString<36>("Transaction-2")));
+
+    CiStringMap<20, int> id_tags;
+    id_tags[CiString<20>("DeadBeef")] = 1;
+    id_tags[CiString<20>("DEADBEEF")] = 2;
+    id_tags[CiString<20>("BeefBeef")] = 3;
+    EXPECT_EQ(id_tags.size(), 2);
+    EXPECT_EQ(id_tags.at(CiString<20>("deadbeef")), 2);
+    EXPECT_EQ(id_tags.count(CiString<20>("BEEFDEAD")), 0);
+
+    CiStringSet<50> keys{CiString<50>("HeartbeatInterval"), CiString<50>("HEARTBEATINTERVAL")};
+    EXPECT_EQ(keys.size(), 1);
+}
+
+TEST(StringTest, ComparesAndHashesCaseSensitively) {
+    const String<20> lhs("DEADBEEF");
+    const String<20> rhs("deadbeef");
+    EXPECT_TRUE(lhs != rhs);
+    EXPECT_TRUE(lhs == String<20>("DEADBEEF"));
+    EXPECT_EQ(std::hash<String<20>>()(lhs), std::hash<std::string>()("DEADBEEF"));
+    EXPECT_EQ(std::hash<String<500>>()(String<500>("DEADBEEF")), std::hash<std::string>()("DEADBEEF"));
+}
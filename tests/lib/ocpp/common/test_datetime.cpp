@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ocpp/common/json_writer.hpp>
+#include <ocpp/common/types.hpp>
+
+using namespace ocpp;
+
+namespace {
+
+using TimePoint = std::chrono::time_point<date::utc_clock>;
+
+/// \brief The date::parse based parsing that DateTime used before, \p timepoint is not changed if it fails
+void reference_from_rfc3339(const std::string& timepoint_str, TimePoint& timepoint) {
+    std::istringstream in{timepoint_str};
+    in >> date::parse("%FT%T%Ez", timepoint);
+    if (in.fail()) {
+        in.clear();
+        in.seekg(0);
+        in >> date::parse("%FT%TZ", timepoint);
+        if (in.fail()) {
+            in.clear();
+            in.seekg(0);
+            in >> date::parse("%FT%T", timepoint);
+        }
+    }
+}
+
+/// \brief The date::format based formatting that DateTime used before
+std::string reference_to_rfc3339(const TimePoint& timepoint) {
+    return date::format("%FT%TZ", std::chrono::time_point_cast<std::chrono::milliseconds>(timepoint));
+}
+
+/// \brief Parses \p timepoint_str with DateTime and with the reference, both starting from the same time point
+void expect_same_parse_result(const std::string& timepoint_str) {
+    const TimePoint initial{std::chrono::seconds{12345}};
+    TimePoint expected = initial;
+    reference_from_rfc3339(timepoint_str, expected);
+    DateTime dt{initial};
+    dt.from_rfc3339(timepoint_str);
+    EXPECT_EQ(dt.to_time_point(), expected) << timepoint_str;
+}
+
+std::string two_digits(int value) {
+    char buffer[3];
+    std::snprintf(buffer, sizeof(buffer), "%02d", value);
+    return buffer;
+}
+
+/// \brief Creates a random timestamp with a random number of fractional digits and a random UTC offset
+std::string random_timestamp(std::mt19937& gen) {
+    std::uniform_int_distribution<int> year(1970, 2200);
+    std::uniform_int_distribution<int> month(1, 12);
+    std::uniform_int_distribution<int> day(1, 31);
+    std::uniform_int_distribution<int> hours(0, 23);
+    std::uniform_int_distribution<int> minutes(0, 59);
+    std::uniform_int_distribution<int> digits(0, 9);
+    std::uniform_int_distribution<int> suffix(0, 2);
+
+    std::string str = std::to_string(year(gen)) + "-" + two_digits(month(gen)) + "-" + two_digits(day(gen)) + "T" +
+                      two_digits(hours(gen)) + ":" + two_digits(minutes(gen)) + ":" + two_digits(minutes(gen));
+    const auto fraction_digits = digits(gen);
+    if (fraction_digits > 0) {
+        str += ".";
+        for (int i = 0; i < fraction_digits; i++) {
+            str += static_cast<char>('0' + digits(gen));
+        }
+    }
+    switch (suffix(gen)) {
+    case 0:
+        str += "Z";
+        break;
+    case 1:
+        str += (digits(gen) < 5 ? "+" : "-") + two_digits(hours(gen)) + ":" + two_digits(minutes(gen));
+        break;
+    default:
+        break;
+    }
+    return str;
+}
+
+} // namespace
+
+TEST(DateTimeTest, ParsesUtcTimestamps) {
+    EXPECT_EQ(DateTime("2024-01-01T00:00:00Z").to_time_point().time_since_epoch(),
+              std::chrono::seconds{1704067200} + std::chrono::seconds{27});
+    EXPECT_EQ(DateTime("2024-01-01T00:00:00.123Z").to_rfc3339(), "2024-01-01T00:00:00.123Z");
+    EXPECT_EQ(DateTime("2024-02-29T23:59:59.999999Z").to_rfc3339(), "2024-02-29T23:59:59.999Z");
+    EXPECT_EQ(DateTime("2024-01-01T00:00:00").to_rfc3339(), "2024-01-01T00:00:00.000Z");
+}
+
+TEST(DateTimeTest, ParsesUtcOffsets) {
+    EXPECT_EQ(DateTime("2024-01-01T01:30:00+01:30").to_rfc3339(), "2024-01-01T00:00:00.000Z");
+    EXPECT_EQ(DateTime("2023-12-31T22:00:00.5-02:00").to_rfc3339(), "2024-01-01T00:00:00.500Z");
+    EXPECT_EQ(DateTime("2024-01-01T00:00:00+00:00").to_rfc3339(), "2024-01-01T00:00:00.000Z");
+}
+
+TEST(DateTimeTest, KeepsTimePointOfInvalidTimestamps) {
+    const TimePoint initial{std::chrono::seconds{12345}};
+    for (const auto& timepoint_str :
+         {"", "2024", "2024-01-01", "2024-13-01T00:00:00Z", "2024-02-30T00:00:00Z", "2024-01-01T24:00:00Z",
+          "2024-01-01T00:60:00Z", "2024-01-01 00:00:00Z", "not a timestamp"}) {
+        DateTime dt{initial};
+        dt.from_rfc3339(timepoint_str);
+        EXPECT_EQ(dt.to_time_point(), initial) << timepoint_str;
+    }
+}
+
+TEST(DateTimeTest, HandlesLeapSeconds) {
+    const DateTime dt("2016-12-31T23:59:60.5Z");
+    EXPECT_EQ(dt.to_rfc3339(), "2016-12-31T23:59:60.500Z");
+    EXPECT_EQ(DateTime("2017-01-01T00:00:00Z").to_time_point() - dt.to_time_point(), std::chrono::milliseconds{500});
+}
+
+TEST(DateTimeTest, ParsesLikeDateParse) {
+    const std::vector<std::string> timestamps{
+        "2024-01-01T00:00:00.1234567891Z", "2024-01-01T00:00:00.Z", "2024-01-01T00:00:00Zjunk",
+        "2024-01-01T00:00:00+01",          "2024-01-01T00:00:00+0100", "2024-01-01T00:00:00+1:00",
+        "2024-01-01T00:00:00 ",            "2024-1-1T0:0:0Z",          "2016-12-31T23:59:60Z",
+        "2016-12-31T23:59:60+01:00",       "2024-01-01T00:00:00.000000001+14:00",
+    };
+    for (const auto& timestamp : timestamps) {
+        expect_same_parse_result(timestamp);
+    }
+
+    std::mt19937 gen(1);
+    for (int i = 0; i < 10000; i++) {
+        expect_same_parse_result(random_timestamp(gen));
+    }
+}
+
+TEST(DateTimeTest, ParsesMutatedTimestampsLikeDateParse) {
+    std::mt19937 gen(2);
+    const std::string alphabet = "0123456789-+:.TZ tz";
+    std::uniform_int_distribution<std::size_t> character(0, alphabet.size() - 1);
+    std::uniform_int_distribution<int> mutation(0, 2);
+    for (int i = 0; i < 10000; i++) {
+        auto timestamp = random_timestamp(gen);
+        std::uniform_int_distribution<std::size_t> position(0, timestamp.size() - 1);
+        switch (mutation(gen)) {
+        case 0:
+            timestamp[position(gen)] = alphabet[character(gen)];
+            break;
+        case 1:
+            timestamp.erase(position(gen), 1);
+            break;
+        default:
+            timestamp.insert(position(gen), 1, alphabet[character(gen)]);
+            break;
+        }
+        expect_same_parse_result(timestamp);
+    }
+}
+
+TEST(DateTimeTest, FormatsLikeDateFormat) {
+    std::mt19937_64 gen(3);
+    // 1900 to 2200, negative time points are truncated towards zero like by the former std::chrono::time_point_cast
+    std::uniform_int_distribution<std::int64_t> milliseconds(-2208988800000, 7258118400000);
+    std::uniform_int_distribution<std::int64_t> nanoseconds(0, 999999);
+    for (int i = 0; i < 10000; i++) {
+        const TimePoint timepoint{std::chrono::milliseconds{milliseconds(gen)} +
+                                  std::chrono::nanoseconds{nanoseconds(gen)}};
+        const DateTime dt{timepoint};
+        std::array<char, DateTime::RFC3339_BUFFER_SIZE> buffer;
+        EXPECT_EQ(dt.to_rfc3339(), reference_to_rfc3339(timepoint));
+        EXPECT_EQ(dt.to_rfc3339(buffer), reference_to_rfc3339(timepoint));
+
+        // the written strings are read back to the same millisecond
+        EXPECT_EQ(DateTime(dt.to_rfc3339()).to_time_point(),
+                  std::chrono::time_point_cast<std::chrono::milliseconds>(timepoint));
+    }
+}
+
+TEST(DateTimeTest, WritesJsonLikeToJson) {
+    const DateTime dt("2024-01-01T12:34:56.789Z");
+    JsonWriter writer;
+    writer.begin_array();
+    writer.value(dt);
+    writer.end_array();
+    EXPECT_EQ(writer.str(), json::array({dt.to_rfc3339()}).dump());
+}
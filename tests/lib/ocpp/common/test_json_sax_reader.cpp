@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <ocpp/common/json_sax_reader.hpp>
+#include <ocpp/v16/messages/Authorize.hpp>
+#include <ocpp/v16/messages/SendLocalList.hpp>
+#include <ocpp/v201/messages/SetChargingProfile.hpp>
+
+using namespace ocpp;
+
+namespace {
+
+const std::string send_local_list_call =
+    R"([2,"12345","SendLocalList",{"listVersion":3,"updateType":"Full","localAuthorizationList":[)"
+    R"({"idTag":"TAG1","idTagInfo":{"status":"Accepted","parentIdTag":"PARENT","expiryDate":"2024-01-01T00:00:00Z"}},)"
+    R"({"idTag":"TAG2","idTagInfo":{"status":"Blocked"}},{"idTag":"TAG3"}]}])";
+
+const std::string set_charging_profile_call =
+    R"([2,"67890","SetChargingProfile",{"evseId":1,"customData":{"vendorId":"v","nested":{"list":[1,2.5,true]}},)"
+    R"("chargingProfile":{"id":7,"stackLevel":2,"chargingProfilePurpose":"TxDefaultProfile",)"
+    R"("chargingProfileKind":"Absolute","validFrom":"2024-01-01T00:00:00Z","chargingSchedule":[{"id":1,)"
+    R"("chargingRateUnit":"W","startSchedule":"2024-01-01T00:00:00Z","minChargingRate":1.5,"chargingSchedulePeriod":[)"
+    R"({"startPeriod":0,"limit":11000},{"startPeriod":3600,"limit":7400.5,"numberPhases":3}]}]}}])";
+
+/// \brief Reads \p message with read_call and with json::parse and the from_json conversion, both have to throw the
+/// same exception
+template <typename T> void expect_same_error(const std::string& message) {
+    std::string sax_error;
+    std::string dom_error;
+    try {
+        read_call<T>(message);
+    } catch (const std::exception& e) {
+        sax_error = e.what();
+    }
+    try {
+        Call<T> call = json::parse(message);
+    } catch (const std::exception& e) {
+        dom_error = e.what();
+    }
+    EXPECT_FALSE(sax_error.empty()) << message;
+    EXPECT_EQ(sax_error, dom_error) << message;
+}
+
+} // namespace
+
+TEST(JsonSaxReaderTest, ReadsSendLocalListLikeFromJson) {
+    const auto call = read_call<v16::SendLocalListRequest>(send_local_list_call);
+    const Call<v16::SendLocalListRequest> expected = json::parse(send_local_list_call);
+
+    EXPECT_EQ(call.uniqueId, expected.uniqueId);
+    EXPECT_EQ(json(call.msg), json(expected.msg));
+    ASSERT_TRUE(call.msg.localAuthorizationList.has_value());
+    EXPECT_EQ(call.msg.localAuthorizationList->size(), 3);
+    EXPECT_FALSE(call.msg.localAuthorizationList->at(2).idTagInfo.has_value());
+}
+
+TEST(JsonSaxReaderTest, ReadsSetChargingProfileLikeFromJson) {
+    const auto call = read_call<v201::SetChargingProfileRequest>(set_charging_profile_call);
+    const Call<v201::SetChargingProfileRequest> expected = json::parse(set_charging_profile_call);
+
+    EXPECT_EQ(call.uniqueId, expected.uniqueId);
+    EXPECT_EQ(json(call.msg), json(expected.msg));
+    EXPECT_EQ(call.msg.chargingProfile.chargingSchedule.at(0).chargingSchedulePeriod.at(1).limit, 7400.5);
+    EXPECT_EQ(call.msg.customData->at("nested").at("list"), json::parse("[1,2.5,true]"));
+}
+
+TEST(JsonSaxReaderTest, SkipsUnknownKeys) {
+    const auto call = read_call<v16::AuthorizeRequest>(
+        R"([2,"1","Authorize",{"unknown":{"a":[{"b":[]},"idTag"]},"idTag":"TAG","other":"x"}])");
+    EXPECT_EQ(call.msg.idTag.get(), "TAG");
+}
+
+TEST(JsonSaxReaderTest, LastDuplicateKeyWins) {
+    const auto call = read_call<v16::SendLocalListRequest>(
+        R"([2,"1","SendLocalList",{"listVersion":1,"updateType":"Full","localAuthorizationList":[{"idTag":"A"}],)"
+        R"("localAuthorizationList":[{"idTag":"B"}]}])");
+    ASSERT_EQ(call.msg.localAuthorizationList->size(), 1);
+    EXPECT_EQ(call.msg.localAuthorizationList->at(0).idTag.get(), "B");
+}
+
+TEST(JsonSaxReaderTest, ThrowsLikeFromJson) {
+    expect_same_error<v16::AuthorizeRequest>(R"([2,"1","Authorize",{}])");
+    expect_same_error<v16::AuthorizeRequest>(R"([2,"1","Authorize",{"idTag":5}])");
+    expect_same_error<v16::AuthorizeRequest>(R"([2,"1","Authorize",[]])");
+    expect_same_error<v16::AuthorizeRequest>(R"([2,"1","Authorize"])");
+    expect_same_error<v16::AuthorizeRequest>(R"({"idTag":"x"})");
+    expect_same_error<v16::AuthorizeRequest>(R"([2,"1","Authorize",{"idTag":"x")");
+    expect_same_error<v16::AuthorizeRequest>(R"([2,"1","Authorize",{"idTag":"012345678901234567890"}])");
+    expect_same_error<v16::SendLocalListRequest>(R"([2,"1","SendLocalList",{"listVersion":1,"updateType":"No"}])");
+    expect_same_error<v16::SendLocalListRequest>(R"([2,"1","SendLocalList",{"listVersion":"1","updateType":"Full"}])");
+}
+
+TEST(JsonSaxReaderTest, ParseMessageSkipsSelectedPayloads) {
+    bool payload_skipped = false;
+    const auto message = parse_message(
+        send_local_list_call, [](const std::string& action) { return action == "SendLocalList"; }, payload_skipped);
+    EXPECT_TRUE(payload_skipped);
+    EXPECT_EQ(message, json::parse(R"([2,"12345","SendLocalList",null])"));
+
+    const auto parsed = parse_message(
+        set_charging_profile_call, [](const std::string& action) { return action == "SendLocalList"; },
+        payload_skipped);
+    EXPECT_FALSE(payload_skipped);
+    EXPECT_EQ(parsed, json::parse(set_charging_profile_call));
+
+    const auto result = parse_message(
+        R"([3,"12345",{"status":"Accepted"}])", [](const std::string&) { return true; }, payload_skipped);
+    EXPECT_FALSE(payload_skipped);
+    EXPECT_EQ(result, json::parse(R"([3,"12345",{"status":"Accepted"}])"));
+}
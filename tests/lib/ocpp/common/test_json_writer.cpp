@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+
+#include <ocpp/common/call_types.hpp>
+#include <ocpp/common/json_writer.hpp>
+#include <ocpp/v16/messages/BootNotification.hpp>
+#include <ocpp/v16/messages/SendLocalList.hpp>
+#include <ocpp/v201/messages/GetChargingProfiles.hpp>
+#include <ocpp/v201/messages/NotifyReport.hpp>
+#include <ocpp/v201/messages/SetChargingProfile.hpp>
+#include <ocpp/v201/messages/TransactionEvent.hpp>
+
+using namespace ocpp;
+
+namespace {
+
+/// \brief Writes \p value with the JsonWriter and returns the written text
+template <typename T> std::string write(const T& value) {
+    JsonWriter writer;
+    write_json(writer, value);
+    return writer.str();
+}
+
+/// \brief Reads the payload of \p message into a T and expects that writing it gives the output of json::dump
+template <typename T> void expect_same_as_dump(const json& payload) {
+    const T message = payload;
+    EXPECT_EQ(write(message), json(message).dump());
+    const Call<T> call(message, MessageId("id"));
+    EXPECT_EQ(write(call), json(call).dump());
+}
+
+std::string write_string(const std::string& value) {
+    JsonWriter writer;
+    writer.value(value);
+    return writer.str();
+}
+
+std::string write_number(double value) {
+    JsonWriter writer;
+    writer.value(value);
+    return writer.str();
+}
+
+} // namespace
+
+TEST(JsonWriterTest, WritesStringsLikeDump) {
+    const std::vector<std::string> strings{
+        "",
+        "plain",
+        "quote \" and backslash \\",
+        std::string("control \b\f\n\r\t \x01\x1f\x7f and null ") + '\0' + " inside",
+        "UTF-8 \xc3\xa4\xe2\x82\xac\xf0\x9f\x94\x8c and ascii",
+    };
+    for (const auto& s : strings) {
+        EXPECT_EQ(write_string(s), json(s).dump()) << s;
+    }
+}
+
+TEST(JsonWriterTest, ThrowsLikeDumpForInvalidUtf8) {
+    const std::vector<std::string> strings{"\xff", "a\xc3", "overlong \xc0\xaf", "surrogate \xed\xa0\x80",
+                                           "above U+10FFFF \xf4\x90\x80\x80"};
+    for (const auto& s : strings) {
+        std::string dump_error;
+        try {
+            json(s).dump();
+        } catch (const json::type_error& e) {
+            dump_error = e.what();
+        }
+        EXPECT_FALSE(dump_error.empty());
+        try {
+            write_string(s);
+            ADD_FAILURE() << "no exception for " << s;
+        } catch (const json::type_error& e) {
+            EXPECT_EQ(e.what(), dump_error);
+        }
+    }
+}
+
+TEST(JsonWriterTest, WritesRandomStringsLikeDump) {
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> byte{0, 255};
+    std::uniform_int_distribution<int> length{0, 24};
+    for (int i = 0; i < 10000; i++) {
+        std::string s(length(generator), ' ');
+        for (auto& c : s) {
+            c = static_cast<char>(byte(generator));
+        }
+        std::string expected;
+        try {
+            expected = json(s).dump();
+        } catch (const json::type_error&) {
+            EXPECT_THROW(write_string(s), json::type_error);
+            continue;
+        }
+        EXPECT_EQ(write_string(s), expected);
+    }
+}
+
+TEST(JsonWriterTest, WritesNumbersLikeDump) {
+    const std::vector<float> floats{0.0f, -0.0f, 1.0f, 0.1f, 7400.5f, -11000.0f, 1e20f, 3.4e38f, 1.17549435e-38f};
+    for (const auto f : floats) {
+        EXPECT_EQ(write_number(f), json(f).dump()) << f;
+    }
+    EXPECT_EQ(write_number(std::numeric_limits<double>::quiet_NaN()), "null");
+    EXPECT_EQ(write_number(std::numeric_limits<double>::infinity()), "null");
+
+    for (const auto i : {0, 1, -1, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max()}) {
+        JsonWriter writer;
+        writer.value(i);
+        EXPECT_EQ(writer.str(), json(i).dump());
+    }
+
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<uint32_t> bits;
+    for (int i = 0; i < 10000; i++) {
+        const auto b = bits(generator);
+        float f;
+        std::memcpy(&f, &b, sizeof(f));
+        if (std::isfinite(f)) {
+            EXPECT_EQ(write_number(f), json(f).dump());
+        }
+    }
+}
+
+TEST(JsonWriterTest, ClearKeepsWriting) {
+    JsonWriter writer;
+    writer.begin_array();
+    writer.value(1);
+    writer.begin_object();
+    writer.key("a");
+    writer.begin_array();
+    writer.end_array();
+    writer.key("b");
+    writer.value(true);
+    writer.end_object();
+    writer.end_array();
+    EXPECT_EQ(writer.str(), R"([1,{"a":[],"b":true}])");
+
+    writer.clear();
+    writer.value("next");
+    EXPECT_EQ(writer.str(), R"("next")");
+}
+
+TEST(JsonWriterTest, WritesTransactionEventLikeDump) {
+    const auto sampled_value = json{{"value", 230.1},
+                                    {"measurand", "Voltage"},
+                                    {"phase", "L1-N"},
+                                    {"context", "Sample.Periodic"},
+                                    {"location", "Outlet"},
+                                    {"unitOfMeasure", {{"unit", "V"}, {"multiplier", 0}}}};
+    const auto signed_value = json{{"value", 0.1},
+                                   {"measurand", "Energy.Active.Import.Register"},
+                                   {"signedMeterValue",
+                                    {{"signedMeterData", "data"},
+                                     {"signingMethod", "ECDSA"},
+                                     {"encodingMethod", "OCMF"},
+                                     {"publicKey", "key"}}}};
+    expect_same_as_dump<v201::TransactionEventRequest>(
+        {{"eventType", "Updated"},
+         {"timestamp", "2024-01-01T00:00:00.000Z"},
+         {"triggerReason", "MeterValuePeriodic"},
+         {"seqNo", 12},
+         {"offline", false},
+         {"transactionInfo", {{"transactionId", "tx \"1\""}, {"chargingState", "Charging"}}},
+         {"evse", {{"id", 1}, {"connectorId", 1}}},
+         {"idToken", {{"idToken", "TOKEN"}, {"type", "ISO14443"}}},
+         {"customData", {{"vendorId", "vendor"}, {"list", {1, 2.5, "x"}}}},
+         {"meterValue",
+          {{{"timestamp", "2024-01-01T00:00:00.000Z"}, {"sampledValue", {sampled_value, signed_value}}},
+           {{"timestamp", "2024-01-01T00:01:00.000Z"}, {"sampledValue", {sampled_value}}}}}});
+}
+
+TEST(JsonWriterTest, WritesNotifyReportLikeDump) {
+    json report_data = json::array();
+    for (int i = 0; i < 10; i++) {
+        report_data.push_back(
+            {{"component", {{"name", "Component" + std::to_string(i)}, {"evse", {{"id", i}}}}},
+             {"variable", {{"name", "Variable"}, {"instance", "Instance"}}},
+             {"variableAttribute", {{{"type", "Actual"}, {"value", "v\n" + std::to_string(i)}, {"persistent", true}}}},
+             {"variableCharacteristics",
+              {{"dataType", "decimal"}, {"supportsMonitoring", false}, {"minLimit", -1.5}, {"maxLimit", 1e6}}}});
+    }
+    expect_same_as_dump<v201::NotifyReportRequest>(
+        {{"requestId", 1}, {"generatedAt", "2024-01-01T00:00:00.000Z"}, {"seqNo", 0}, {"tbc", true},
+         {"reportData", report_data}});
+}
+
+TEST(JsonWriterTest, WritesOtherTypesLikeDump) {
+    expect_same_as_dump<v201::GetChargingProfilesRequest>(
+        {{"requestId", 1},
+         {"chargingProfile", {{"chargingLimitSource", {"EMS", "SO"}}, {"chargingProfileId", {1, 2, 3}}}}});
+    expect_same_as_dump<v201::GetChargingProfilesRequest>({{"requestId", 1}, {"chargingProfile", json::object()}});
+    expect_same_as_dump<v201::SetChargingProfileRequest>(
+        {{"evseId", 0},
+         {"chargingProfile",
+          {{"id", 1},
+           {"stackLevel", 0},
+           {"chargingProfilePurpose", "TxDefaultProfile"},
+           {"chargingProfileKind", "Absolute"},
+           {"chargingSchedule",
+            {{{"id", 1},
+              {"chargingRateUnit", "W"},
+              {"chargingSchedulePeriod", {{{"startPeriod", 0}, {"limit", 11000.5}, {"numberPhases", 3}}}}}}}}}});
+    expect_same_as_dump<v16::BootNotificationRequest>(
+        {{"chargePointVendor", "Vendor"}, {"chargePointModel", "Model \xc3\xa4"}, {"firmwareVersion", "1.0"}});
+    expect_same_as_dump<v16::SendLocalListRequest>(
+        {{"listVersion", 1},
+         {"updateType", "Full"},
+         {"localAuthorizationList", {{{"idTag", "A"}, {"idTagInfo", {{"status", "Accepted"}}}}, {{"idTag", "B"}}}}});
+}
+
+TEST(JsonWriterTest, WritesCallResultAndCallErrorLikeDump) {
+    v201::TransactionEventResponse response;
+    response.totalCost = 1.25f;
+    const CallResult<v201::TransactionEventResponse> call_result(response, MessageId("id"));
+    EXPECT_EQ(write(call_result), json(call_result).dump());
+
+    const CallError call_error(MessageId("id"), "FormationViolation", "description \"x\"", json{{"detail", 1}});
+    EXPECT_EQ(write(call_error), json(call_error).dump());
+}
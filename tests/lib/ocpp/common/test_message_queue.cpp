@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
+#include <boost/asio/io_context.hpp>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <nlohmann/json.hpp>
@@ -95,6 +96,24 @@ void from_json(const json& j, TestRequest& k) {
     }
 }
 
+const JsonSaxFields& json_sax_fields(const TestRequest*) {
+    static const JsonSaxFields fields{
+        json_sax_field<&TestRequest::data>("data"),
+    };
+    return fields;
+}
+
+void write_json(JsonWriter& writer, const TestRequest& k) {
+    if (not k.data) {
+        writer.value(json{});
+        return;
+    }
+    writer.begin_object();
+    writer.key("data");
+    writer.value(k.data.value());
+    writer.end_object();
+}
+
 template <> std::string MessageQueue<TestMessageType>::messagetype_to_string(TestMessageType m) {
     return to_string(m);
 }
@@ -105,9 +124,12 @@ template <> TestMessageType MessageQueue<TestMessageType>::string_to_messagetype
 
 template <> ControlMessage<TestMessageType>::ControlMessage(const json& message, bool stall_until_accepted) {
     this->message = message.get<json::array_t>();
-    EVLOG_info << this->message;
-    this->messageType = to_test_message_type(this->message[2]);
+    EVLOG_info << message;
+    this->messageType = to_test_message_type(message[2]);
     this->message_attempts = 0;
+    this->initial_unique_id = message[MESSAGE_ID];
+    this->unique_id = message[MESSAGE_ID];
+    this->stall_until_accepted = stall_until_accepted;
 }
 
 std::ostream& operator<<(std::ostream& os, const TestMessageType& message_type) {
@@ -123,10 +145,34 @@ bool is_start_transaction_message(const TestMessageType message_type) {
     return false;
 }
 
+bool is_transaction_event_message(const TestMessageType message_type) {
+    return message_type == TestMessageType::TRANSACTIONAL or message_type == TestMessageType::TRANSACTIONAL_UPDATE;
+}
+
 template <> bool ControlMessage<TestMessageType>::is_transaction_update_message() const {
     return this->messageType == TestMessageType::TRANSACTIONAL_UPDATE;
 }
 
+template <> std::optional<std::string> ControlMessage<TestMessageType>::transaction_id() const {
+    const auto& payload = this->json_message().at(CALL_PAYLOAD);
+    if (payload.contains("transaction_id")) {
+        return payload.at("transaction_id").get<std::string>();
+    }
+    return std::nullopt;
+}
+
+template <> bool ControlMessage<TestMessageType>::contains_signed_meter_values() const {
+    return this->json_message().at(CALL_PAYLOAD).value("signed", false);
+}
+
+template <> std::optional<std::string> ControlMessage<TestMessageType>::coalescing_key() const {
+    const auto& payload = this->json_message().at(CALL_PAYLOAD);
+    if (payload.contains("coalescing_key")) {
+        return payload.at("coalescing_key").get<std::string>();
+    }
+    return std::nullopt;
+}
+
 bool is_boot_notification_message(const TestMessageType message_type) {
     return message_type == TestMessageType::BootNotification;
 }
@@ -145,8 +191,15 @@ public:
     }
 
     MOCK_METHOD(std::vector<common::DBTransactionMessage>, get_message_queue_messages, (const QueueType), (override));
+    MOCK_METHOD(int64_t, get_message_queue_end, (const QueueType), (override));
+    MOCK_METHOD(std::vector<common::DBTransactionMessage>, get_message_queue_messages_page,
+                (const QueueType, const int64_t, const int64_t, const std::size_t, const std::optional<std::string>&),
+                (override));
     MOCK_METHOD(void, insert_message_queue_message, (const common::DBTransactionMessage&, const QueueType), (override));
     MOCK_METHOD(void, remove_message_queue_message, (const std::string&, const QueueType), (override));
+    MOCK_METHOD(void, remove_message_queue_messages, (const std::vector<std::string>&, const QueueType), (override));
+    MOCK_METHOD(void, flush_message_queue_operations, (), (override));
+    MOCK_METHOD(void, clear_message_queue, (const QueueType), (override));
 };
 
 class MessageQueueTest : public ::testing::Test {
@@ -206,8 +259,12 @@ protected:
         return identifier;
     }
 
+    std::function<bool(const std::string& message)> send_callback() {
+        return [this](const std::string& message) { return this->send_callback_mock.Call(json::parse(message)); };
+    }
+
     void init_message_queue() {
-        message_queue = std::make_unique<MessageQueue<TestMessageType>>(send_callback_mock.AsStdFunction(), config, db);
+        message_queue = std::make_unique<MessageQueue<TestMessageType>>(send_callback(), config, db);
         message_queue->start();
         message_queue->set_registration_status_accepted();
         message_queue->resume(std::chrono::seconds(0));
@@ -217,7 +274,7 @@ protected:
         if (message_queue) {
             message_queue->stop();
         }
-        message_queue = std::make_unique<MessageQueue<TestMessageType>>(send_callback_mock.AsStdFunction(), config, db);
+        message_queue = std::make_unique<MessageQueue<TestMessageType>>(send_callback(), config, db);
         message_queue->start();
         message_queue->set_registration_status_accepted();
         message_queue->resume(std::chrono::seconds(0));
@@ -251,6 +308,106 @@ TEST_F(MessageQueueTest, test_transactional_message_is_sent) {
     wait_for_calls();
 }
 
+// \brief Test that a transactional message is persisted when push returns, also without a worker
+TEST_F(MessageQueueTest, test_transactional_message_is_persisted_when_pushed) {
+    // a queue whose worker is never started, so the pushing thread has to persist the message itself
+    MessageQueue<TestMessageType> unstarted_message_queue(send_callback(), config, db);
+
+    EXPECT_CALL(send_callback_mock, Call(testing::_)).Times(0);
+    EXPECT_CALL(*db, insert_message_queue_message(testing::Field(&common::DBTransactionMessage::unique_id, "0"),
+                                                  QueueType::Transaction))
+        .Times(1);
+
+    Call<TestRequest> call;
+    call.msg.type = TestMessageType::TRANSACTIONAL;
+    call.msg.data = "test_data";
+    call.uniqueId = "0";
+    unstarted_message_queue.push(call);
+    testing::Mock::VerifyAndClearExpectations(db.get());
+
+    EXPECT_CALL(*db, insert_message_queue_message(testing::Field(&common::DBTransactionMessage::unique_id, "1"),
+                                                  QueueType::Transaction))
+        .Times(1);
+
+    call.uniqueId = "1";
+    unstarted_message_queue.push_async(call);
+    testing::Mock::VerifyAndClearExpectations(db.get());
+}
+
+// \brief Test that transactional messages pushed concurrently are committed by the worker in one database transaction
+//  before push returns
+TEST_F(MessageQueueTest, test_concurrently_pushed_transactional_messages_share_one_commit) {
+    constexpr int number_of_producers = 8;
+    message_queue->pause();
+
+    std::mutex inserted_mutex;
+    std::set<std::string> inserted;
+    std::atomic<int> producers_pushing{0};
+    EXPECT_CALL(send_callback_mock, Call(testing::_)).Times(0);
+    EXPECT_CALL(*db, insert_message_queue_message(testing::_, QueueType::Transaction))
+        .Times(number_of_producers)
+        .WillRepeatedly(testing::Invoke([&](const common::DBTransactionMessage& message, const QueueType) {
+            // hold up the worker until all producers are about to push, so that their messages pile up in the ingress
+            while (producers_pushing < number_of_producers) {
+                std::this_thread::yield();
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            std::lock_guard<std::mutex> lk(inserted_mutex);
+            inserted.insert(message.unique_id);
+        }));
+    EXPECT_CALL(*db, flush_message_queue_operations()).Times(testing::Between(1, 2));
+
+    std::vector<std::thread> producers;
+    for (int i = 0; i < number_of_producers; i++) {
+        producers.emplace_back([&, i]() {
+            Call<TestRequest> call;
+            call.msg.type = TestMessageType::TRANSACTIONAL;
+            call.msg.data = "test_data";
+            call.uniqueId = std::to_string(i);
+            producers_pushing++;
+            message_queue->push(call);
+            // the message has been committed when push returns
+            std::lock_guard<std::mutex> lk(inserted_mutex);
+            EXPECT_EQ(inserted.count(std::to_string(i)), 1);
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    testing::Mock::VerifyAndClearExpectations(db.get());
+}
+
+// \brief Test that the timers of a queue that is given an io_context run on that io_context
+TEST_F(MessageQueueTest, test_in_flight_timeout_runs_on_io_context) {
+    boost::asio::io_context io_context;
+    config.message_timeout_seconds = 1;
+    MessageQueue<TestMessageType> io_context_message_queue(send_callback(), config, db, &io_context);
+    io_context_message_queue.start();
+    io_context_message_queue.set_registration_status_accepted();
+    io_context_message_queue.resume(std::chrono::seconds(0));
+
+    EXPECT_CALL(send_callback_mock, Call(json{2, "0", "non_transactional", json{{"data", "test_data"}}}))
+        .WillOnce(MarkAndReturn(true));
+
+    Call<TestRequest> call;
+    call.msg.type = TestMessageType::NON_TRANSACTIONAL;
+    call.msg.data = "test_data";
+    call.uniqueId = "0";
+    auto future = io_context_message_queue.push_async(call);
+    wait_for_calls();
+
+    // the CSMS never responds, but the timeout is only handled once the io_context runs
+    EXPECT_EQ(future.wait_for(std::chrono::milliseconds(1500)), std::future_status::timeout);
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready and
+           std::chrono::steady_clock::now() < deadline) {
+        io_context.run_one_for(std::chrono::milliseconds(100));
+    }
+    EXPECT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+
+    io_context_message_queue.stop();
+}
+
 // \brief Test sending a non-transactional message
 TEST_F(MessageQueueTest, test_non_transactional_message_is_sent) {
 
@@ -349,6 +506,292 @@ TEST_F(MessageQueueTest, test_queuing_up_of_non_transactional_messages) {
     wait_for_calls(message_count + 1);
 }
 
+// \brief Test that with an in-flight window > 1 non-transactional messages are sent without waiting for responses,
+//  while transactional messages are still sent one at a time
+TEST_F(MessageQueueTest, test_pipelining_of_non_transactional_messages) {
+    config.max_messages_in_flight = 3;
+    config.queues_total_size_threshold = 10;
+    restart_message_queue();
+
+    EXPECT_CALL(send_callback_mock, Call(testing::_)).WillRepeatedly(MarkAndReturn(true));
+    EXPECT_CALL(*db, insert_message_queue_message(testing::_, QueueType::Transaction)).Times(2);
+    EXPECT_CALL(*db, remove_message_queue_message(testing::_, QueueType::Transaction)).Times(1);
+
+    auto first_transactional_msg_id = push_message_call(TestMessageType::TRANSACTIONAL);
+    push_message_call(TestMessageType::TRANSACTIONAL);
+    push_message_call(TestMessageType::NON_TRANSACTIONAL);
+    push_message_call(TestMessageType::NON_TRANSACTIONAL);
+
+    // the first transactional and both non-transactional messages fill the window
+    wait_for_calls(3);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(3, get_call_count());
+
+    // the second transactional message is sent once the first one has been responded to
+    message_queue->receive(json{3, first_transactional_msg_id, ""}.dump());
+    wait_for_calls(4);
+}
+
+// \brief Test that the worker does not busy wait while a sendable transactional message is held back by the
+//  transactional message in flight
+TEST_F(MessageQueueTest, test_no_busy_waiting_while_transactional_message_is_in_flight) {
+    config.max_messages_in_flight = 3;
+    restart_message_queue();
+
+    EXPECT_CALL(send_callback_mock, Call(testing::_)).WillRepeatedly(MarkAndReturn(true));
+    EXPECT_CALL(*db, insert_message_queue_message(testing::_, QueueType::Transaction)).Times(2);
+    EXPECT_CALL(*db, remove_message_queue_message(testing::_, QueueType::Transaction)).Times(1);
+
+    auto first_transactional_msg_id = push_message_call(TestMessageType::TRANSACTIONAL);
+    push_message_call(TestMessageType::TRANSACTIONAL);
+    wait_for_calls(1);
+
+    // the second transactional message is sendable, but has to wait for the response to the first one
+    const auto wakeups = message_queue->get_worker_wakeups();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    EXPECT_EQ(1, get_call_count());
+    EXPECT_LE(message_queue->get_worker_wakeups() - wakeups, 2);
+
+    message_queue->receive(json{3, first_transactional_msg_id, ""}.dump());
+    wait_for_calls(2);
+}
+
+// \brief Test that high priority messages are only sent before older queued transactional messages if configured
+TEST_F(MessageQueueTest, test_high_priority_messages_before_transactional_messages) {
+    config.queue_all_messages = true;
+    config.message_scheduling_classes[TestMessageType::NON_TRANSACTIONAL] = MessageSchedulingClass::High;
+
+    for (const bool before_transaction_messages : {false, true}) {
+        config.high_priority_messages_before_transaction_messages = before_transaction_messages;
+        restart_message_queue();
+        message_queue->pause();
+
+        std::vector<std::string> sent;
+        const testing::Action<bool(json)> mark_and_respond = MarkAndReturn(true, true);
+        EXPECT_CALL(send_callback_mock, Call(testing::_))
+            .Times(2)
+            .WillRepeatedly(testing::Invoke([&sent, mark_and_respond](const json& message) {
+                sent.push_back(message.at(MESSAGE_ID));
+                return mark_and_respond.Perform(std::make_tuple(message));
+            }));
+        EXPECT_CALL(*db, insert_message_queue_message(testing::_, testing::_)).Times(testing::AnyNumber());
+        EXPECT_CALL(*db, remove_message_queue_message(testing::_, testing::_)).Times(testing::AnyNumber());
+
+        const auto transactional = push_message_call(TestMessageType::TRANSACTIONAL);
+        const auto high_priority = push_message_call(TestMessageType::NON_TRANSACTIONAL);
+        message_queue->resume(std::chrono::seconds(0));
+        wait_for_calls(before_transaction_messages ? 4 : 2);
+
+        if (before_transaction_messages) {
+            EXPECT_THAT(sent, testing::ElementsAre(high_priority, transactional));
+        } else {
+            EXPECT_THAT(sent, testing::ElementsAre(transactional, high_priority));
+        }
+        testing::Mock::VerifyAndClearExpectations(&send_callback_mock);
+    }
+}
+
+// \brief Test that the original CALL is attached to the CALLRESULT of a transaction related message only, since the json
+// value of other pushed messages is never built
+TEST_F(MessageQueueTest, test_call_result_contains_call_message) {
+    EXPECT_CALL(*db, insert_message_queue_message(testing::_, QueueType::Transaction));
+    EXPECT_CALL(*db, remove_message_queue_message(testing::_, QueueType::Transaction));
+    EXPECT_CALL(send_callback_mock, Call(testing::_)).Times(2).WillRepeatedly(MarkAndReturn(true));
+
+    Call<TestRequest> call;
+    call.msg.type = TestMessageType::TRANSACTIONAL;
+    call.msg.data = "call";
+    call.uniqueId = "call";
+    auto future = message_queue->push_async(call);
+    wait_for_calls(1);
+
+    const auto call_result = message_queue->receive(json{3, "call", json::object()}.dump());
+    EXPECT_EQ(call_result.messageType, TestMessageType::TRANSACTIONAL_RESPONSE);
+    EXPECT_EQ(call_result.call_message, json(call));
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    EXPECT_EQ(future.get().call_message, json(call));
+
+    call.msg.type = TestMessageType::NON_TRANSACTIONAL;
+    call.uniqueId = "non_transactional";
+    auto non_transactional_future = message_queue->push_async(call);
+    wait_for_calls(2);
+
+    const auto non_transactional_result =
+        message_queue->receive(json{3, "non_transactional", json::object()}.dump());
+    EXPECT_EQ(non_transactional_result.messageType, TestMessageType::NON_TRANSACTIONAL_RESPONSE);
+    EXPECT_TRUE(non_transactional_result.call_message.is_null());
+}
+
+// \brief Test that the payload of received CALLs of directly deserialized message types is read from the received text
+TEST_F(MessageQueueTest, test_receive_directly_deserialized_call) {
+    config.directly_deserialized_message_types = {TestMessageType::NON_TRANSACTIONAL};
+    restart_message_queue();
+
+    const auto direct = message_queue->receive(
+        json{2, "direct", "non_transactional", {{"data", "payload"}, {"unknown", {{"nested", {1, 2}}}}}}.dump());
+    EXPECT_EQ(direct.messageType, TestMessageType::NON_TRANSACTIONAL);
+    EXPECT_EQ(direct.uniqueId, "direct");
+    ASSERT_TRUE(direct.call_text.has_value());
+    EXPECT_TRUE(direct.message.at(CALL_PAYLOAD).is_null());
+    const auto direct_call = to_call<TestRequest>(direct);
+    EXPECT_EQ(direct_call.uniqueId, "direct");
+    EXPECT_EQ(direct_call.msg.data, "payload");
+
+    const auto parsed = message_queue->receive(json{2, "parsed", "transactional", {{"data", "payload"}}}.dump());
+    EXPECT_FALSE(parsed.call_text.has_value());
+    EXPECT_EQ(parsed.message.at(CALL_PAYLOAD), json({{"data", "payload"}}));
+    EXPECT_EQ(to_call<TestRequest>(parsed).msg.data, "payload");
+}
+
+// \brief Test that persisted messages are restored in batches and before messages that are pushed after a restart
+TEST_F(MessageQueueTest, test_replay_of_persisted_messages_in_batches) {
+    config.queue_all_messages = true;
+    config.persisted_messages_replay_batch_size = 2;
+    restart_message_queue();
+
+    auto persisted_message = [](const int64_t position) {
+        common::DBTransactionMessage message;
+        message.position = position;
+        message.unique_id = "persisted_" + std::to_string(position);
+        message.message_type = to_string(TestMessageType::TRANSACTIONAL);
+        message.message_attempts = 0;
+        message.serialized_message = std::make_shared<const std::string>(
+            json{2, message.unique_id, message.message_type, json::object()}.dump());
+        return message;
+    };
+    auto has_id = [](const std::string& id) {
+        return testing::Truly([id](const json& message) { return message.at(MESSAGE_ID) == id; });
+    };
+
+    EXPECT_CALL(*db, get_message_queue_end(QueueType::Normal)).WillOnce(testing::Return(0));
+    EXPECT_CALL(*db, get_message_queue_end(QueueType::Transaction)).WillOnce(testing::Return(3));
+    EXPECT_CALL(*db, get_message_queue_messages_page(QueueType::Transaction, 0, 3, 2, testing::_))
+        .WillOnce(testing::Return(std::vector{persisted_message(1), persisted_message(2)}));
+    EXPECT_CALL(*db, get_message_queue_messages_page(QueueType::Transaction, 2, 3, 2, testing::_))
+        .WillOnce(testing::Return(std::vector{persisted_message(3)}));
+    EXPECT_CALL(*db, insert_message_queue_message(testing::_, QueueType::Transaction));
+    EXPECT_CALL(*db, remove_message_queue_message(testing::_, QueueType::Transaction)).Times(4);
+
+    testing::Sequence s;
+    EXPECT_CALL(send_callback_mock, Call(has_id("persisted_1"))).InSequence(s).WillOnce(MarkAndReturn(true, true));
+    EXPECT_CALL(send_callback_mock, Call(has_id("persisted_2"))).InSequence(s).WillOnce(MarkAndReturn(true, true));
+    EXPECT_CALL(send_callback_mock, Call(has_id("persisted_3"))).InSequence(s).WillOnce(MarkAndReturn(true, true));
+    EXPECT_CALL(send_callback_mock, Call(has_id("pushed"))).InSequence(s).WillOnce(MarkAndReturn(true, true));
+
+    message_queue->get_persisted_messages_from_db();
+    push_message_call(TestMessageType::TRANSACTIONAL, "pushed");
+
+    wait_for_calls(4);
+}
+
+// \brief Test that persisted messages that could not be read from the database are replayed on the next wake-up
+TEST_F(MessageQueueTest, test_replay_of_persisted_messages_is_retried_after_database_error) {
+    config.queue_all_messages = true;
+    restart_message_queue();
+
+    common::DBTransactionMessage persisted_message;
+    persisted_message.position = 1;
+    persisted_message.unique_id = "persisted";
+    persisted_message.message_type = to_string(TestMessageType::TRANSACTIONAL);
+    persisted_message.message_attempts = 0;
+    persisted_message.serialized_message = std::make_shared<const std::string>(
+        json{2, persisted_message.unique_id, persisted_message.message_type, json::object()}.dump());
+    auto has_id = [](const std::string& id) {
+        return testing::Truly([id](const json& message) { return message.at(MESSAGE_ID) == id; });
+    };
+
+    EXPECT_CALL(*db, get_message_queue_end(QueueType::Normal)).WillOnce(testing::Return(0));
+    EXPECT_CALL(*db, get_message_queue_end(QueueType::Transaction)).WillOnce(testing::Return(1));
+    EXPECT_CALL(*db, get_message_queue_messages_page(QueueType::Transaction, 0, 1, testing::_, testing::_))
+        .WillOnce(testing::Throw(common::QueryExecutionException("database is locked")))
+        .WillOnce(testing::Return(std::vector{persisted_message}));
+    EXPECT_CALL(*db, insert_message_queue_message(testing::_, QueueType::Transaction));
+    EXPECT_CALL(*db, remove_message_queue_message(testing::_, QueueType::Transaction)).Times(2);
+
+    testing::Sequence s;
+    EXPECT_CALL(send_callback_mock, Call(has_id("persisted"))).InSequence(s).WillOnce(MarkAndReturn(true, true));
+    EXPECT_CALL(send_callback_mock, Call(has_id("pushed"))).InSequence(s).WillOnce(MarkAndReturn(true, true));
+
+    message_queue->get_persisted_messages_from_db();
+    // wakes up the worker, which retries reading the persisted messages if it has not done so already
+    push_message_call(TestMessageType::TRANSACTIONAL, "pushed");
+
+    wait_for_calls(2);
+}
+
+// \brief Test that without queue_all_messages the normal message queue table is only cleared once all of its messages
+// have been restored
+TEST_F(MessageQueueTest, test_normal_message_queue_table_is_cleared_after_all_messages_are_restored) {
+    config.queue_all_messages = false;
+    restart_message_queue();
+
+    common::DBTransactionMessage persisted_message;
+    persisted_message.position = 1;
+    persisted_message.unique_id = "persisted";
+    persisted_message.message_type = to_string(TestMessageType::NON_TRANSACTIONAL);
+    persisted_message.message_attempts = 0;
+    persisted_message.serialized_message = std::make_shared<const std::string>(
+        json{2, persisted_message.unique_id, persisted_message.message_type, json::object()}.dump());
+    auto has_id = [](const std::string& id) {
+        return testing::Truly([id](const json& message) { return message.at(MESSAGE_ID) == id; });
+    };
+
+    EXPECT_CALL(*db, get_message_queue_end(QueueType::Normal)).WillOnce(testing::Return(1));
+    EXPECT_CALL(*db, get_message_queue_end(QueueType::Transaction)).WillOnce(testing::Return(0));
+
+    testing::Sequence s;
+    EXPECT_CALL(*db, get_message_queue_messages_page(QueueType::Normal, 0, 1, testing::_, testing::_))
+        .InSequence(s)
+        .WillOnce(testing::Throw(common::QueryExecutionException("database is locked")));
+    EXPECT_CALL(*db, get_message_queue_messages_page(QueueType::Normal, 0, 1, testing::_, testing::_))
+        .InSequence(s)
+        .WillOnce(testing::Return(std::vector{persisted_message}));
+    EXPECT_CALL(*db, clear_message_queue(QueueType::Normal)).InSequence(s);
+    EXPECT_CALL(send_callback_mock, Call(has_id("persisted"))).WillOnce(MarkAndReturn(true, true));
+    EXPECT_CALL(send_callback_mock, Call(has_id("pushed"))).WillOnce(MarkAndReturn(true, true));
+
+    message_queue->get_persisted_messages_from_db();
+    // wakes up the worker, which retries restoring the persisted messages and clears the table afterwards
+    push_message_call(TestMessageType::NON_TRANSACTIONAL, "pushed");
+
+    wait_for_calls(2);
+}
+
+// \brief Test that a queued message is replaced in place by a newer message with the same coalescing key
+TEST_F(MessageQueueTest, test_coalescing_of_superseded_messages) {
+    config.queues_total_size_threshold = 10;
+    config.queue_all_messages = true;
+    config.coalesced_message_types = {TestMessageType::NON_TRANSACTIONAL};
+    restart_message_queue();
+
+    auto has_id = [](const std::string& id) {
+        return testing::Truly([id](const json& message) { return message.at(MESSAGE_ID) == id; });
+    };
+    testing::Sequence s;
+    EXPECT_CALL(send_callback_mock, Call(has_id("status_1_new"))).InSequence(s).WillOnce(MarkAndReturn(true, true));
+    EXPECT_CALL(send_callback_mock, Call(has_id("status_2"))).InSequence(s).WillOnce(MarkAndReturn(true, true));
+    EXPECT_CALL(send_callback_mock, Call(has_id("other"))).InSequence(s).WillOnce(MarkAndReturn(true, true));
+    EXPECT_CALL(*db, insert_message_queue_message(testing::_, QueueType::Normal)).Times(4);
+    EXPECT_CALL(*db, remove_message_queue_message(testing::_, QueueType::Normal)).Times(3);
+    EXPECT_CALL(*db, remove_message_queue_message("status_1", QueueType::Normal));
+
+    // go offline
+    message_queue->pause();
+
+    auto push = [this](const std::string& id, const json& payload) {
+        message_queue->push(json{2, id, to_string(TestMessageType::NON_TRANSACTIONAL), payload});
+    };
+    push("status_1", {{"coalescing_key", "1"}});
+    push("status_2", {{"coalescing_key", "2"}});
+    push("status_1_new", {{"coalescing_key", "1"}});
+    push("other", json::object());
+
+    // go online again
+    message_queue->resume(std::chrono::seconds(0));
+
+    wait_for_calls(3);
+}
+
 // \brief Test that if the max size threshold is exceeded, the non-transactional  messages are dropped
 //  Sends both non-transactions and transactional messages while on pause, expects a certain amount of non-transactional
 //  to be dropped.
@@ -365,7 +808,10 @@ TEST_F(MessageQueueTest, test_clean_up_non_transactional_queue) {
     EXPECT_CALL(*db, insert_message_queue_message(testing::_, testing::_))
         .Times(sent_transactional_messages + sent_non_transactional_messages);
     EXPECT_CALL(*db, remove_message_queue_message(testing::_, testing::_))
-        .Times(sent_transactional_messages + sent_non_transactional_messages)
+        .Times(sent_transactional_messages + sent_non_transactional_messages - expected_skipped_transactional_messages)
+        .WillRepeatedly(testing::Return());
+    EXPECT_CALL(*db, remove_message_queue_messages(testing::SizeIs(2), QueueType::Normal))
+        .Times(3)
         .WillRepeatedly(testing::Return());
 
     // go offline
@@ -424,18 +870,24 @@ TEST_F(MessageQueueTest, test_clean_up_transactional_queue) {
      *
      *   Expected dropping behavior
      *   - adding msg 13-22 -> each drop 1 non-transactional (floored 10% of queue thresholds)
-     *   - adding msg 23 (update of third transaction) -> drop 4 messages with ids 13,15,19,21
-     *   - adding msg 27 (update of fourth transaction) -> drop 3 message with ids 14,20,23
+     *   - adding msg 23-29 -> each drop 1 update message; the messages carry no transaction id, so all updates are
+     *     thinned as one group of which the first (13) and the latest update are kept
      */
     const std::set<std::string> expected_dropped_transaction_messages = {
-        "test_call_13", "test_call_15", "test_call_19", "test_call_21", "test_call_14", "test_call_20", "test_call_23",
+        "test_call_14", "test_call_15", "test_call_16", "test_call_19", "test_call_20", "test_call_21", "test_call_22",
     };
     const int expected_sent_messages = 13;
     config.queue_all_messages = true;
     restart_message_queue();
 
     EXPECT_CALL(*db, insert_message_queue_message(testing::_, testing::_)).Times(30);
-    EXPECT_CALL(*db, remove_message_queue_message(testing::_, testing::_)).Times(30).WillRepeatedly(testing::Return());
+    EXPECT_CALL(*db, remove_message_queue_message(testing::_, testing::_)).Times(13).WillRepeatedly(testing::Return());
+    EXPECT_CALL(*db, remove_message_queue_messages(testing::SizeIs(1), QueueType::Normal))
+        .Times(10)
+        .WillRepeatedly(testing::Return());
+    EXPECT_CALL(*db, remove_message_queue_messages(testing::SizeIs(1), QueueType::Transaction))
+        .Times(7)
+        .WillRepeatedly(testing::Return());
 
     // go offline
     message_queue->pause();
@@ -480,4 +932,229 @@ TEST_F(MessageQueueTest, test_clean_up_transactional_queue) {
     wait_for_calls(expected_sent_messages);
 }
 
+// \brief Test that transaction update messages are thinned per transaction, keeping the first and last update of each
+//  transaction and all updates with signed meter values, and that the dropped messages are deleted in one batch
+TEST_F(MessageQueueTest, test_thinning_of_transactional_queue_per_transaction) {
+    config.queues_total_size_threshold = 12;
+    config.queue_all_messages = true;
+    restart_message_queue();
+
+    auto make_message = [](const std::string& id, TestMessageType type, const std::string& transaction_id,
+                           bool signed_meter_values = false) {
+        json payload{{"data", id}, {"transaction_id", transaction_id}};
+        if (signed_meter_values) {
+            payload["signed"] = true;
+        }
+        return json{2, id, to_string(type), payload};
+    };
+
+    std::vector<json> messages;
+    messages.push_back(make_message("a_start", TestMessageType::TRANSACTIONAL, "A"));
+    for (int i = 1; i <= 5; i++) {
+        // the third update contains signed meter values
+        messages.push_back(
+            make_message("a_update_" + std::to_string(i), TestMessageType::TRANSACTIONAL_UPDATE, "A", i == 3));
+    }
+    messages.push_back(make_message("b_start", TestMessageType::TRANSACTIONAL, "B"));
+    for (int i = 1; i <= 4; i++) {
+        messages.push_back(make_message("b_update_" + std::to_string(i), TestMessageType::TRANSACTIONAL_UPDATE, "B"));
+    }
+    messages.push_back(make_message("a_stop", TestMessageType::TRANSACTIONAL, "A"));
+    messages.push_back(make_message("b_stop", TestMessageType::TRANSACTIONAL, "B"));
+
+    // adding b_stop exceeds the threshold, one droppable update of each transaction is dropped
+    const std::set<std::string> expected_dropped_messages = {"a_update_2", "b_update_2"};
+
+    EXPECT_CALL(*db, insert_message_queue_message(testing::_, testing::_)).Times(messages.size());
+    EXPECT_CALL(*db, remove_message_queue_message(testing::_, testing::_))
+        .Times(messages.size() - expected_dropped_messages.size())
+        .WillRepeatedly(testing::Return());
+    EXPECT_CALL(*db, remove_message_queue_messages(testing::UnorderedElementsAre("a_update_2", "b_update_2"),
+                                                   QueueType::Transaction))
+        .Times(1);
+
+    message_queue->pause();
+
+    testing::Sequence s;
+    for (const auto& message : messages) {
+        message_queue->push(message);
+        if (!expected_dropped_messages.count(message.at(1))) {
+            EXPECT_CALL(send_callback_mock, Call(message)).InSequence(s).WillOnce(MarkAndReturn(true, true));
+        }
+    }
+
+    message_queue->resume(std::chrono::seconds(0));
+
+    wait_for_calls(messages.size() - expected_dropped_messages.size());
+}
+
+// \brief Test that the serialization of a control message is cached until it is invalidated
+TEST(ControlMessageTest, test_serialized_message_cache) {
+    const json message{2, "id", to_string(TestMessageType::TRANSACTIONAL), json{{"data", "id"}, {"value", 1.5}}};
+    ControlMessage<TestMessageType> control_message(message);
+
+    const auto serialized = control_message.serialized_message();
+    EXPECT_EQ(*serialized, message.dump());
+    EXPECT_EQ(control_message.serialized_message(), serialized);
+
+    control_message.json_message().at(CALL_PAYLOAD)["transactionId"] = 1;
+    control_message.invalidate_serialized_message();
+    EXPECT_EQ(*control_message.serialized_message(), json(control_message.json_message()).dump());
+    EXPECT_EQ(*serialized, message.dump());
+}
+
+// \brief Test that the json value of a control message created from its serialization is built when it is edited
+TEST(ControlMessageTest, test_json_message_of_serialized_message) {
+    const json message{2, "id", to_string(TestMessageType::TRANSACTIONAL), json{{"data", "id"}}};
+    ControlMessage<TestMessageType> control_message(message.dump(), TestMessageType::TRANSACTIONAL, MessageId("id"));
+    EXPECT_EQ(control_message.uniqueId(), "id");
+    EXPECT_EQ(*control_message.serialized_message(), message.dump());
+    EXPECT_EQ(json(control_message.json_message()), message);
+
+    control_message.set_unique_id(MessageId("retry"));
+    EXPECT_EQ(control_message.uniqueId(), "retry");
+    EXPECT_EQ(control_message.initial_unique_id, "id");
+    EXPECT_EQ(*control_message.serialized_message(),
+              json({2, "retry", to_string(TestMessageType::TRANSACTIONAL), json{{"data", "id"}}}).dump());
+}
+
+// \brief Test that the scheduled message queue selects messages in queue order once they are allowed to be sent
+TEST(ScheduledMessageQueueTest, test_selection_of_ready_messages) {
+    auto make_message = [](const std::string& id, const DateTime& timestamp, bool stall_until_accepted) {
+        auto message = std::make_shared<ControlMessage<TestMessageType>>(
+            json{2, id, to_string(TestMessageType::NON_TRANSACTIONAL), json::object()}, stall_until_accepted);
+        message->timestamp = timestamp;
+        message->stall_until_accepted = stall_until_accepted;
+        return message;
+    };
+
+    const auto now = date::utc_clock::now();
+    const auto later = now + std::chrono::seconds(10);
+
+    ScheduledMessageQueue<TestMessageType> queue;
+    queue.push_back(make_message("delayed", DateTime(later), false));
+    queue.push_back(make_message("stalled", DateTime(now), true));
+    queue.push_back(make_message("ready", DateTime(now), false));
+    queue.push_front(make_message("front", DateTime(now), false));
+    EXPECT_EQ(queue.size(), 4);
+    EXPECT_EQ(queue.front()->uniqueId(), "front");
+
+    auto key = queue.next_ready(now);
+    ASSERT_TRUE(key.has_value());
+    EXPECT_EQ(queue.at(key.value())->uniqueId(), "front");
+    queue.erase(key.value());
+
+    key = queue.next_ready(now);
+    ASSERT_TRUE(key.has_value());
+    EXPECT_EQ(queue.at(key.value())->uniqueId(), "ready");
+    queue.erase(key.value());
+
+    EXPECT_FALSE(queue.next_ready(now).has_value());
+    ASSERT_TRUE(queue.next_send_time().has_value());
+    EXPECT_EQ(queue.next_send_time().value(), DateTime(later).to_time_point());
+
+    queue.set_registration_status_accepted();
+    key = queue.next_ready(now);
+    ASSERT_TRUE(key.has_value());
+    EXPECT_EQ(queue.at(key.value())->uniqueId(), "stalled");
+    queue.erase(key.value());
+
+    key = queue.next_ready(later);
+    ASSERT_TRUE(key.has_value());
+    EXPECT_EQ(queue.at(key.value())->uniqueId(), "delayed");
+    queue.pop_front();
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.next_send_time().has_value());
+}
+
+TEST(ScheduledMessageQueueTest, test_scheduling_classes) {
+    const auto now = date::utc_clock::now();
+    auto make_message = [&now](const std::string& id) {
+        auto message = std::make_shared<ControlMessage<TestMessageType>>(
+            json{2, id, to_string(TestMessageType::NON_TRANSACTIONAL), json::object()});
+        message->timestamp = DateTime(now);
+        return message;
+    };
+    auto fill_queue = [&make_message](ScheduledMessageQueue<TestMessageType>& queue) {
+        for (int i = 0; i < 3; i++) {
+            queue.push_back(make_message("low_" + std::to_string(i)), MessageSchedulingClass::Low);
+            queue.push_back(make_message("normal_" + std::to_string(i)), MessageSchedulingClass::Normal);
+        }
+        queue.push_back(make_message("high_0"), MessageSchedulingClass::High);
+        queue.push_back(make_message("high_1"), MessageSchedulingClass::High);
+    };
+    auto drain_queue = [&now](ScheduledMessageQueue<TestMessageType>& queue) {
+        std::vector<std::string> sent;
+        while (const auto key = queue.next_ready(now)) {
+            sent.push_back(queue.at(key.value())->uniqueId());
+            queue.take(key.value());
+        }
+        return sent;
+    };
+
+    // strict priority: classes are drained one after the other, queue order is kept within a class
+    ScheduledMessageQueue<TestMessageType> strict_queue;
+    fill_queue(strict_queue);
+    EXPECT_EQ(strict_queue.get_statistics(MessageSchedulingClass::High).depth, 2);
+    EXPECT_EQ(strict_queue.get_statistics(MessageSchedulingClass::Low).depth, 3);
+    EXPECT_THAT(drain_queue(strict_queue),
+                testing::ElementsAre("high_0", "high_1", "normal_0", "normal_1", "normal_2", "low_0", "low_1",
+                                     "low_2"));
+    EXPECT_EQ(strict_queue.get_statistics(MessageSchedulingClass::High).depth, 0);
+    EXPECT_EQ(strict_queue.get_statistics(MessageSchedulingClass::High).sent, 2);
+    EXPECT_EQ(strict_queue.get_statistics(MessageSchedulingClass::Low).sent, 3);
+    EXPECT_GE(strict_queue.get_statistics(MessageSchedulingClass::Low).max_latency,
+              strict_queue.get_statistics(MessageSchedulingClass::High).max_latency);
+
+    // weighted fair scheduling: every class gets its share of each round
+    ScheduledMessageQueue<TestMessageType> weighted_queue;
+    weighted_queue.configure_scheduling(true, {1, 2, 1});
+    fill_queue(weighted_queue);
+    EXPECT_THAT(drain_queue(weighted_queue),
+                testing::ElementsAre("high_0", "normal_0", "normal_1", "low_0", "high_1", "normal_2", "low_1",
+                                     "low_2"));
+
+    // dropped messages are not counted as sent
+    ScheduledMessageQueue<TestMessageType> dropping_queue;
+    fill_queue(dropping_queue);
+    dropping_queue.pop_front();
+    EXPECT_EQ(dropping_queue.get_statistics(MessageSchedulingClass::Low).depth, 2);
+    EXPECT_EQ(dropping_queue.get_statistics(MessageSchedulingClass::Low).sent, 0);
+}
+
+TEST(MpscQueueTest, test_concurrent_producers) {
+    constexpr int number_of_producers = 4;
+    constexpr int values_per_producer = 10000;
+
+    MpscQueue<std::pair<int, int>> queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop().has_value());
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < number_of_producers; producer++) {
+        producers.emplace_back([&queue, producer]() {
+            for (int i = 0; i < values_per_producer; i++) {
+                queue.push({producer, i});
+            }
+        });
+    }
+
+    // the values of each producer have to be popped in the order they have been pushed
+    std::vector<int> next_value(number_of_producers, 0);
+    int popped = 0;
+    while (popped < number_of_producers * values_per_producer) {
+        if (const auto value = queue.pop()) {
+            EXPECT_EQ(value->second, next_value[value->first]);
+            next_value[value->first] = value->second + 1;
+            popped++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
 } // namespace ocpp
@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include <ocpp/common/message_schema_validator.hpp>
+#include <ocpp/v201/ocpp_enums.hpp>
+#include <ocpp/v201/types.hpp>
+
+using namespace ocpp;
+
+namespace {
+
+/// \brief The ResetRequest schema of OCPP 2.0.1
+const json reset_request_schema = json::parse(R"({
+    "$schema": "http://json-schema.org/draft-06/schema#",
+    "$id": "urn:OCPP:Cp:2:2020:3:ResetRequest",
+    "definitions": {
+        "CustomDataType": {
+            "javaType": "CustomData",
+            "type": "object",
+            "properties": {
+                "vendorId": {
+                    "type": "string",
+                    "maxLength": 255
+                }
+            },
+            "required": ["vendorId"]
+        },
+        "ResetEnumType": {
+            "javaType": "ResetEnum",
+            "type": "string",
+            "additionalProperties": false,
+            "enum": ["Immediate", "OnIdle"]
+        }
+    },
+    "type": "object",
+    "additionalProperties": false,
+    "properties": {
+        "customData": {
+            "$ref": "#/definitions/CustomDataType"
+        },
+        "type": {
+            "$ref": "#/definitions/ResetEnumType"
+        },
+        "evseId": {
+            "type": "integer"
+        }
+    },
+    "required": ["type"]
+})");
+
+json make_call(const json& payload) {
+    return json::array({MessageTypeId::CALL, "1", "Reset", payload});
+}
+
+EnhancedMessage<v201::MessageType> make_message(const json& message) {
+    EnhancedMessage<v201::MessageType> enhanced_message;
+    enhanced_message.message = message;
+    enhanced_message.uniqueId = MessageId(message.at(MESSAGE_ID).get<std::string>());
+    enhanced_message.messageTypeId = message.at(MESSAGE_TYPE_ID);
+    enhanced_message.messageType = v201::MessageType::Reset;
+    return enhanced_message;
+}
+
+} // namespace
+
+class MessageSchemaValidatorTest : public ::testing::Test {
+protected:
+    std::filesystem::path schemas_path;
+
+public:
+    MessageSchemaValidatorTest() :
+        schemas_path(std::filesystem::temp_directory_path() / "message_schema_validator_test") {
+        std::filesystem::create_directories(schemas_path);
+        this->write_schema("ResetRequest.json", reset_request_schema);
+        this->write_schema("ResetResponse.json", json::object());
+        this->write_schema("UnknownActionRequest.json", json::object());
+    }
+
+    ~MessageSchemaValidatorTest() {
+        std::filesystem::remove_all(schemas_path);
+    }
+
+    void write_schema(const std::string& name, const json& schema) {
+        std::ofstream stream{this->schemas_path / name};
+        stream << schema.dump();
+    }
+
+    MessageSchemaValidator<v201::MessageType> make_validator() {
+        return MessageSchemaValidator<v201::MessageType>(this->schemas_path, [](const std::string& action) {
+            return v201::conversions::string_to_messagetype(action);
+        });
+    }
+};
+
+TEST_F(MessageSchemaValidatorTest, FindsRequestSchemas) {
+    this->write_schema("Authorize.json", json::object());
+    this->write_schema("AuthorizeResponse.json", json::object());
+
+    const auto schemas = find_request_schemas(this->schemas_path);
+    ASSERT_EQ(schemas.size(), 3u);
+    EXPECT_EQ(schemas.at("Reset"), this->schemas_path / "ResetRequest.json");
+    EXPECT_EQ(schemas.at("Authorize"), this->schemas_path / "Authorize.json");
+    EXPECT_EQ(schemas.count("UnknownAction"), 1u);
+}
+
+TEST_F(MessageSchemaValidatorTest, IgnoresUnknownActions) {
+    const auto validator = this->make_validator();
+    EXPECT_EQ(validator.size(), 1u);
+}
+
+TEST_F(MessageSchemaValidatorTest, AcceptsValidPayload) {
+    const auto validator = this->make_validator();
+    EXPECT_FALSE(validator.validate(make_message(make_call({{"type", "Immediate"}, {"evseId", 1}}))).has_value());
+    EXPECT_FALSE(validator
+                     .validate(make_message(
+                         make_call({{"type", "OnIdle"}, {"customData", {{"vendorId", "vendor"}, {"other", 1}}}})))
+                     .has_value());
+}
+
+TEST_F(MessageSchemaValidatorTest, RejectsMalformedPayload) {
+    const auto validator = this->make_validator();
+    const std::vector<json> payloads{
+        json::object(),
+        {{"type", "Immediate"}, {"evseId", "1"}},
+        {{"type", "Immediate"}, {"unknown", true}},
+        {{"type", "Immediate"}, {"customData", json::object()}},
+        json::array(),
+    };
+    for (const auto& payload : payloads) {
+        const auto call_error = validator.validate(make_message(make_call(payload)));
+        ASSERT_TRUE(call_error.has_value()) << payload;
+        EXPECT_EQ(call_error->uniqueId, MessageId("1"));
+        EXPECT_EQ(call_error->errorCode, "FormationViolation") << payload;
+    }
+}
+
+TEST_F(MessageSchemaValidatorTest, RejectsPropertyConstraintViolations) {
+    const auto validator = this->make_validator();
+    const std::vector<json> payloads{
+        {{"type", "Later"}},
+        {{"type", "Immediate"}, {"customData", {{"vendorId", std::string(256, 'x')}}}},
+    };
+    for (const auto& payload : payloads) {
+        const auto call_error = validator.validate(make_message(make_call(payload)));
+        ASSERT_TRUE(call_error.has_value()) << payload;
+        EXPECT_EQ(call_error->errorCode, "PropertyConstraintViolation") << payload;
+    }
+}
+
+TEST_F(MessageSchemaValidatorTest, ValidatesDirectlyDeserializedPayload) {
+    const auto validator = this->make_validator();
+    auto message = make_message(json::array({MessageTypeId::CALL, "1", "Reset", nullptr}));
+    message.call_text.emplace(make_call({{"type", "Later"}}).dump());
+    const auto call_error = validator.validate(message);
+    ASSERT_TRUE(call_error.has_value());
+    EXPECT_EQ(call_error->errorCode, "PropertyConstraintViolation");
+}
+
+TEST_F(MessageSchemaValidatorTest, IgnoresCallResults) {
+    const auto validator = this->make_validator();
+    auto message = make_message(json::array({MessageTypeId::CALLRESULT, "1", json::object()}));
+    EXPECT_FALSE(validator.validate(message).has_value());
+}
+
+TEST_F(MessageSchemaValidatorTest, PinsPropertyConstraintMessages) {
+    // every value constraint keyword with a violating value and the start of the message json-schema-validator reports
+    // for it. PropertyConstraintViolation is told apart from FormationViolation by these messages, so a new version of
+    // the validator that changes one of them has to fail here
+    struct ConstraintViolation {
+        json constraint;
+        json value;
+        std::string message;
+    };
+    const std::vector<ConstraintViolation> violations{
+        {{{"type", "string"}, {"maxLength", 2}}, "abc", "instance is too long"},
+        {{{"type", "string"}, {"minLength", 2}}, "a", "instance is too short"},
+        {{{"type", "string"}, {"pattern", "^[0-9]+$"}}, "abc", "instance does not match regex pattern"},
+        {{{"type", "string"}, {"format", "date-time"}}, "yesterday", "format-checking failed"},
+        {{{"type", "string"}, {"enum", {"Immediate", "OnIdle"}}}, "Later", "instance not found in required enum"},
+        {{{"type", "string"}, {"const", "Immediate"}}, "OnIdle", "instance not const"},
+        {{{"type", "integer"}, {"maximum", 10}}, 11, "instance exceeds"},
+        {{{"type", "integer"}, {"exclusiveMaximum", 10}}, 10, "instance exceeds"},
+        {{{"type", "integer"}, {"minimum", 10}}, 9, "instance is below"},
+        {{{"type", "integer"}, {"exclusiveMinimum", 10}}, 10, "instance is below"},
+        {{{"type", "number"}, {"multipleOf", 0.5}}, 0.7, "instance is not a multiple of"},
+    };
+    for (const auto& violation : violations) {
+        SCOPED_TRACE(violation.constraint.dump());
+        this->write_schema("ConstraintRequest.json",
+                           {{"type", "object"}, {"properties", {{"value", violation.constraint}}}});
+        const auto validator = load_request_validator(this->schemas_path / "ConstraintRequest.json");
+
+        EXPECT_FALSE(validate_payload(*validator, MessageId("1"), json::object()).has_value());
+        const auto call_error = validate_payload(*validator, MessageId("1"), {{"value", violation.value}});
+        ASSERT_TRUE(call_error.has_value());
+        EXPECT_EQ(call_error->errorCode, "PropertyConstraintViolation");
+        EXPECT_EQ(call_error->errorDescription.rfind("/value: " + violation.message, 0), 0u)
+            << call_error->errorDescription;
+    }
+}
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+#include <set>
+
+#include <ocpp/common/websocket/reconnect_scheduler.hpp>
+
+using namespace ocpp;
+using namespace std::chrono_literals;
+
+namespace {
+const ReconnectBackoffParameters backoff{std::chrono::seconds(5), std::chrono::seconds(10), 3};
+// Delay the doubling backoff reaches after the repeat times: (5s + 10s) * 2^3
+constexpr std::chrono::milliseconds backoff_cap = 120s;
+} // namespace
+
+TEST(ReconnectSchedulerTest, FirstDelayWithinRandomRange) {
+    for (std::uint32_t seed = 0; seed < 100; seed++) {
+        ReconnectScheduler scheduler(seed);
+        const auto delay = scheduler.next_reconnect_delay(1, backoff);
+        EXPECT_GE(delay, 5s);
+        EXPECT_LE(delay, 15s);
+    }
+}
+
+TEST(ReconnectSchedulerTest, DelaysStayWithinMinimumAndCap) {
+    ReconnectScheduler scheduler(42);
+    for (int i = 0; i < 1000; i++) {
+        const auto delay = scheduler.next_reconnect_delay(1, backoff);
+        EXPECT_GE(delay, 5s);
+        EXPECT_LE(delay, backoff_cap);
+    }
+    EXPECT_EQ(scheduler.get_statistics(1).reconnect_attempts, 1000);
+}
+
+TEST(ReconnectSchedulerTest, DelaysAreDecorrelatedAcrossStations) {
+    // Stations that lost the connection at the same time must not reconnect in lockstep
+    std::set<std::chrono::milliseconds::rep> third_delays;
+    for (std::uint32_t seed = 0; seed < 20; seed++) {
+        ReconnectScheduler scheduler(seed);
+        scheduler.next_reconnect_delay(1, backoff);
+        scheduler.next_reconnect_delay(1, backoff);
+        third_delays.insert(scheduler.next_reconnect_delay(1, backoff).count());
+    }
+    EXPECT_GT(third_delays.size(), 15);
+}
+
+TEST(ReconnectSchedulerTest, ZeroBackoffConfigured) {
+    ReconnectScheduler scheduler(1);
+    const ReconnectBackoffParameters no_backoff{std::chrono::seconds(0), std::chrono::seconds(0), 0};
+    for (int i = 0; i < 10; i++) {
+        EXPECT_EQ(scheduler.next_reconnect_delay(1, no_backoff), 0ms);
+    }
+}
+
+TEST(ReconnectSchedulerTest, StateIsKeptPerProfile) {
+    ReconnectScheduler scheduler(7);
+    for (int i = 0; i < 5; i++) {
+        scheduler.next_reconnect_delay(1, backoff);
+    }
+
+    // Switching to another network profile starts with the initial delay
+    const auto delay = scheduler.next_reconnect_delay(2, backoff);
+    EXPECT_LE(delay, 15s);
+    EXPECT_EQ(scheduler.get_statistics(1).reconnect_attempts, 5);
+    EXPECT_EQ(scheduler.get_statistics(2).reconnect_attempts, 1);
+}
+
+TEST(ReconnectSchedulerTest, ConnectedResetsBackoff) {
+    ReconnectScheduler scheduler(3);
+    for (int i = 0; i < 4; i++) {
+        scheduler.next_reconnect_delay(1, backoff);
+    }
+    scheduler.on_connected(1);
+
+    auto statistics = scheduler.get_statistics(1);
+    EXPECT_EQ(statistics.reconnect_attempts, 0);
+    EXPECT_EQ(statistics.total_reconnect_attempts, 4);
+    EXPECT_EQ(statistics.connections, 1);
+    EXPECT_TRUE(statistics.last_time_to_connect.has_value());
+
+    EXPECT_LE(scheduler.next_reconnect_delay(1, backoff), 15s);
+}
+
+TEST(ReconnectSchedulerTest, ProbeSuccessDelayNotBeyondPendingReconnect) {
+    ReconnectScheduler scheduler(5);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_LE(scheduler.probe_success_delay(1, backoff, 3s), 3s);
+        EXPECT_LE(scheduler.probe_success_delay(1, backoff, 60s), 10s);
+    }
+    EXPECT_EQ(scheduler.get_statistics(1).probe_shortcuts, 200);
+}
+
+TEST(ReconnectSchedulerTest, TimeToBootNotificationAccepted) {
+    ReconnectScheduler scheduler;
+    EXPECT_FALSE(scheduler.on_boot_notification_accepted().has_value());
+
+    scheduler.on_start();
+    EXPECT_FALSE(scheduler.get_time_to_boot_notification_accepted().has_value());
+    EXPECT_TRUE(scheduler.on_boot_notification_accepted().has_value());
+    EXPECT_TRUE(scheduler.get_time_to_boot_notification_accepted().has_value());
+
+    // Only the first accepted BootNotification after start is measured
+    EXPECT_FALSE(scheduler.on_boot_notification_accepted().has_value());
+}
+
+TEST(ReconnectSchedulerTest, ProbeUnresolvableHost) {
+    EXPECT_FALSE(ReconnectScheduler::probe("host.invalid", 443, 100ms));
+}
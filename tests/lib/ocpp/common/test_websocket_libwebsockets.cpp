@@ -0,0 +1,333 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <libwebsockets.h>
+
+#include <ocpp/common/websocket/websocket_libwebsockets.hpp>
+
+#include "benchmarks/loopback_csms.hpp"
+#include "evse_security_mock.hpp"
+
+using namespace ocpp;
+using namespace std::chrono_literals;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace {
+
+/// \brief Runs a LoopbackCsms on its own thread for the lifetime of the object
+class LoopbackCsmsThread {
+public:
+    LoopbackCsmsThread(const std::optional<benchmarks::SelfSignedCertificate>& certificate,
+                       bool enable_permessage_deflate, size_t fragment_size) :
+        csms(0, certificate, enable_permessage_deflate, fragment_size), thread([this]() { this->csms.run(); }) {
+    }
+
+    ~LoopbackCsmsThread() {
+        this->csms.stop();
+        this->thread.join();
+    }
+
+    int get_port() const {
+        return this->csms.get_port();
+    }
+
+private:
+    benchmarks::LoopbackCsms csms;
+    std::thread thread;
+};
+
+} // namespace
+
+class WebsocketLibwebsocketsTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        if (this->websocket != nullptr) {
+            this->websocket->disconnect(WebsocketCloseReason::Normal);
+            this->websocket.reset();
+        }
+        this->csms.reset();
+        if (this->certificate.has_value()) {
+            std::filesystem::remove_all(this->certificate.value().certificate_path.parent_path());
+        }
+    }
+
+    void start_csms(bool enable_permessage_deflate = false, size_t fragment_size = 0) {
+        this->csms = std::make_unique<LoopbackCsmsThread>(std::nullopt, enable_permessage_deflate, fragment_size);
+    }
+
+    /// \brief Starts a CSMS with a self-signed certificate, which is installed as CSMS root certificate
+    void start_tls_csms() {
+        const auto directory =
+            std::filesystem::temp_directory_path() / ("libocpp_websocket_test_" + std::to_string(getpid()));
+        std::filesystem::create_directories(directory);
+        this->certificate = benchmarks::generate_self_signed_certificate(directory);
+        ON_CALL(*this->evse_security, is_ca_certificate_installed(CaCertificateType::CSMS)).WillByDefault(Return(true));
+        ON_CALL(*this->evse_security, get_verify_file(CaCertificateType::CSMS))
+            .WillByDefault(Return(this->certificate.value().certificate_path.string()));
+        this->csms = std::make_unique<LoopbackCsmsThread>(this->certificate, false, 0);
+    }
+
+    WebsocketConnectionOptions make_connection_options() {
+        const int security_profile = this->certificate.has_value() ? 2 : 1;
+        const std::string scheme = this->certificate.has_value() ? "wss" : "ws";
+        return {OcppProtocolVersion::v201,
+                Uri::parse_and_validate(scheme + "://127.0.0.1:" + std::to_string(this->csms->get_port()), "cp001",
+                                        security_profile),
+                security_profile,
+                std::string("password"),
+                1,
+                1,
+                1,
+                0,
+                "ECDHE-ECDSA-AES128-GCM-SHA256:ECDHE-ECDSA-AES256-GCM-SHA384",
+                "TLS_AES_256_GCM_SHA384:TLS_AES_128_GCM_SHA256",
+                0,
+                "payload",
+                5,
+                false,
+                std::nullopt,
+                std::nullopt,
+                false,
+                false,
+                false,
+                std::nullopt};
+    }
+
+    /// \brief Connects a new websocket with \p connection_options, \p on_message is called with every received
+    /// message after it has been recorded
+    void connect(const WebsocketConnectionOptions& connection_options,
+                 const std::function<void(const std::string&)>& on_message = nullptr) {
+        this->websocket = std::make_unique<WebsocketTlsTPM>(connection_options, this->evse_security);
+        this->websocket->register_connected_callback([](const int) {});
+        this->websocket->register_closed_callback([](const WebsocketCloseReason) {});
+        this->websocket->register_disconnected_callback([]() {});
+        this->websocket->register_message_callback([this, on_message](const std::string& message) {
+            {
+                std::lock_guard<std::mutex> lk(this->mutex);
+                this->received.push_back(message);
+            }
+            this->cv.notify_all();
+            if (on_message) {
+                on_message(message);
+            }
+        });
+        ASSERT_TRUE(this->websocket->connect());
+    }
+
+    bool wait_for_received(size_t count) {
+        std::unique_lock<std::mutex> lk(this->mutex);
+        return this->cv.wait_for(lk, 10s, [&]() { return this->received.size() >= count; });
+    }
+
+    std::vector<std::string> get_received() {
+        std::lock_guard<std::mutex> lk(this->mutex);
+        return this->received;
+    }
+
+    std::shared_ptr<NiceMock<EvseSecurityMock>> evse_security = std::make_shared<NiceMock<EvseSecurityMock>>();
+    std::optional<benchmarks::SelfSignedCertificate> certificate;
+    std::unique_ptr<LoopbackCsmsThread> csms;
+    std::unique_ptr<WebsocketTlsTPM> websocket;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::string> received;
+};
+
+TEST_F(WebsocketLibwebsocketsTest, MessagesAreEchoed) {
+    this->start_csms();
+    this->connect(this->make_connection_options());
+
+    EXPECT_TRUE(this->websocket->send("[2,\"1\",\"Heartbeat\",{}]"));
+    EXPECT_TRUE(this->websocket->send("[2,\"2\",\"Heartbeat\",{}]"));
+    ASSERT_TRUE(this->wait_for_received(2));
+    EXPECT_EQ(this->get_received(),
+              std::vector<std::string>({"[2,\"1\",\"Heartbeat\",{}]", "[2,\"2\",\"Heartbeat\",{}]"}));
+
+    const auto latency = this->websocket->get_receive_latency_statistics();
+    EXPECT_EQ(latency.received, 2);
+    EXPECT_LE(latency.max_latency, latency.total_latency);
+}
+
+TEST_F(WebsocketLibwebsocketsTest, SingleThreadedLoopDispatchesFromServiceLoop) {
+    this->start_csms();
+    auto connection_options = this->make_connection_options();
+    connection_options.use_single_threaded_event_loop = true;
+
+    // Sending from within the message callback runs on the service loop, which must neither block nor throw
+    std::vector<bool> sent_from_callback;
+    this->connect(connection_options, [&](const std::string& message) {
+        if (message == "first") {
+            sent_from_callback.push_back(this->websocket->send("second"));
+        }
+    });
+
+    EXPECT_TRUE(this->websocket->send("first"));
+    ASSERT_TRUE(this->wait_for_received(2));
+    EXPECT_EQ(this->get_received(), std::vector<std::string>({"first", "second"}));
+    EXPECT_EQ(sent_from_callback, std::vector<bool>({true}));
+    EXPECT_EQ(this->websocket->get_receive_latency_statistics().received, 2);
+}
+
+TEST_F(WebsocketLibwebsocketsTest, SendingFromMessageCallbackWaitsForTheServiceLoop) {
+    this->start_csms();
+
+    // By default received messages are dispatched from their own thread, so a send from the callback waits until the
+    // service loop has written the message
+    std::vector<bool> sent_from_callback;
+    this->connect(this->make_connection_options(), [&](const std::string& message) {
+        if (message == "first") {
+            sent_from_callback.push_back(this->websocket->send("second"));
+        }
+    });
+
+    EXPECT_TRUE(this->websocket->send("first"));
+    ASSERT_TRUE(this->wait_for_received(2));
+    EXPECT_EQ(this->get_received(), std::vector<std::string>({"first", "second"}));
+    EXPECT_EQ(sent_from_callback, std::vector<bool>({true}));
+}
+
+TEST_F(WebsocketLibwebsocketsTest, OversizedFrameIsDiscarded) {
+    this->start_csms();
+    auto connection_options = this->make_connection_options();
+    connection_options.max_received_message_size = 4096;
+    this->connect(connection_options);
+
+    EXPECT_TRUE(this->websocket->send(std::string(10000, 'x')));
+    EXPECT_TRUE(this->websocket->send("after"));
+    ASSERT_TRUE(this->wait_for_received(1));
+    EXPECT_EQ(this->get_received(), std::vector<std::string>({"after"}));
+}
+
+TEST_F(WebsocketLibwebsocketsTest, OversizedMessageIsDiscardedAcrossFragments) {
+    // Each fragment fits, the message is discarded once the fragments received so far exceed the limit
+    this->start_csms(false, 1024);
+    auto connection_options = this->make_connection_options();
+    connection_options.max_received_message_size = 4096;
+    this->connect(connection_options);
+
+    EXPECT_TRUE(this->websocket->send(std::string(10000, 'x')));
+    EXPECT_TRUE(this->websocket->send("after"));
+    EXPECT_TRUE(this->websocket->send(std::string(3000, 'y')));
+    ASSERT_TRUE(this->wait_for_received(2));
+    EXPECT_EQ(this->get_received(), std::vector<std::string>({"after", std::string(3000, 'y')}));
+}
+
+TEST_F(WebsocketLibwebsocketsTest, FragmentedMessageIsReassembled) {
+    this->start_csms(false, 1000);
+    auto connection_options = this->make_connection_options();
+    connection_options.max_received_message_size = 5000;
+    this->connect(connection_options);
+
+    // A message of exactly the maximum size is still accepted
+    std::string message(5000, 'x');
+    message.replace(0, 5, "first");
+    message.replace(message.size() - 4, 4, "last");
+    EXPECT_TRUE(this->websocket->send(message));
+    EXPECT_TRUE(this->websocket->send("after"));
+    ASSERT_TRUE(this->wait_for_received(2));
+    EXPECT_EQ(this->get_received(), std::vector<std::string>({message, "after"}));
+}
+
+TEST_F(WebsocketLibwebsocketsTest, PermessageDeflateIsCounted) {
+#ifdef LWS_WITHOUT_EXTENSIONS
+    GTEST_SKIP() << "libwebsockets has been built without extension support";
+#endif
+    this->start_csms(true);
+    auto connection_options = this->make_connection_options();
+    connection_options.enable_permessage_deflate = true;
+    this->connect(connection_options);
+
+    const std::string message = "[2,\"1\",\"DataTransfer\",{\"data\":\"" + std::string(4000, 'x') + "\"}]";
+    for (int i = 0; i < 3; i++) {
+        EXPECT_TRUE(this->websocket->send(message));
+    }
+    ASSERT_TRUE(this->wait_for_received(3));
+    EXPECT_EQ(this->get_received(), std::vector<std::string>(3, message));
+
+    const auto statistics = this->websocket->get_compression_statistics();
+    EXPECT_EQ(statistics.messages_sent, 3);
+    EXPECT_EQ(statistics.messages_received, 3);
+    EXPECT_EQ(statistics.payload_bytes_sent, 3 * message.size());
+    EXPECT_EQ(statistics.payload_bytes_received, 3 * message.size());
+    EXPECT_GT(statistics.wire_bytes_sent, 0);
+    EXPECT_LT(statistics.wire_bytes_sent, statistics.payload_bytes_sent);
+    EXPECT_GT(statistics.wire_bytes_received, 0);
+    EXPECT_LT(statistics.wire_bytes_received, statistics.payload_bytes_received);
+}
+
+TEST_F(WebsocketLibwebsocketsTest, NothingIsCompressedIfCsmsDeclinesPermessageDeflate) {
+    this->start_csms(false);
+    auto connection_options = this->make_connection_options();
+    connection_options.enable_permessage_deflate = true;
+    this->connect(connection_options);
+
+    const std::string message(4000, 'x');
+    EXPECT_TRUE(this->websocket->send(message));
+    ASSERT_TRUE(this->wait_for_received(1));
+    EXPECT_EQ(this->get_received(), std::vector<std::string>({message}));
+
+    const auto statistics = this->websocket->get_compression_statistics();
+    EXPECT_EQ(statistics.messages_sent, 1);
+    EXPECT_EQ(statistics.messages_received, 1);
+    EXPECT_EQ(statistics.payload_bytes_sent, 0);
+    EXPECT_EQ(statistics.wire_bytes_sent, 0);
+    EXPECT_EQ(statistics.payload_bytes_received, 0);
+    EXPECT_EQ(statistics.wire_bytes_received, 0);
+}
+
+TEST_F(WebsocketLibwebsocketsTest, TlsContextIsKeptAcrossReconnects) {
+    this->start_tls_csms();
+    this->connect(this->make_connection_options());
+    EXPECT_TRUE(this->websocket->send("first"));
+    ASSERT_TRUE(this->wait_for_received(1));
+
+    // The session ticket has been received with the echo, so the next handshake resumes the session
+    ASSERT_TRUE(this->websocket->connect());
+    EXPECT_TRUE(this->websocket->send("second"));
+    ASSERT_TRUE(this->wait_for_received(2));
+    EXPECT_EQ(this->get_received(), std::vector<std::string>({"first", "second"}));
+
+    const auto statistics = this->websocket->get_tls_statistics();
+    EXPECT_EQ(statistics.context_loads, 1);
+    EXPECT_EQ(statistics.handshakes, 2);
+    EXPECT_EQ(statistics.resumed_handshakes, 1);
+}
+
+TEST_F(WebsocketLibwebsocketsTest, TlsContextIsCreatedAgainWhenVerifyFileChanged) {
+    this->start_tls_csms();
+    this->connect(this->make_connection_options());
+    EXPECT_TRUE(this->websocket->send("first"));
+    ASSERT_TRUE(this->wait_for_received(1));
+
+    // An updated CSMS root certificate is loaded with a new context, which does not resume the previous session
+    const auto verify_file = this->certificate.value().certificate_path;
+    std::filesystem::last_write_time(verify_file,
+                                     std::filesystem::last_write_time(verify_file) + std::chrono::seconds(1));
+
+    ASSERT_TRUE(this->websocket->connect());
+    EXPECT_TRUE(this->websocket->send("second"));
+    ASSERT_TRUE(this->wait_for_received(2));
+    EXPECT_EQ(this->get_received(), std::vector<std::string>({"first", "second"}));
+
+    const auto statistics = this->websocket->get_tls_statistics();
+    EXPECT_EQ(statistics.context_loads, 2);
+    EXPECT_EQ(statistics.handshakes, 2);
+    EXPECT_EQ(statistics.resumed_handshakes, 0);
+}
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include <ocpp/common/websocket/websocket_message_pool.hpp>
+
+using namespace ocpp;
+
+TEST(WebsocketMessagePoolTest, PayloadIsPaddedForLwsWrite) {
+    WebsocketMessagePool pool;
+    const auto msg = pool.acquire("[2,\"1\",\"Heartbeat\",{}]", LWS_WRITE_TEXT);
+
+    EXPECT_EQ(msg->payload(), "[2,\"1\",\"Heartbeat\",{}]");
+    EXPECT_EQ(msg->payload_data(), msg->buffer.data() + LWS_PRE);
+    EXPECT_EQ(msg->payload_length, msg->payload().size());
+    EXPECT_EQ(msg->protocol, LWS_WRITE_TEXT);
+}
+
+TEST(WebsocketMessagePoolTest, ReleasedMessageIsReusedAndReset) {
+    WebsocketMessagePool pool;
+    auto first = pool.acquire("a longer first message", LWS_WRITE_TEXT);
+    WebsocketMessage* const first_ptr = first.get();
+    const auto* const first_buffer = first->buffer.data();
+    first->sent_bytes = first->payload_length;
+    first->message_sent = true;
+    first.reset();
+
+    const auto second = pool.acquire("short", LWS_WRITE_BINARY);
+    EXPECT_EQ(second.get(), first_ptr);
+    // the buffer is large enough already and not reallocated
+    EXPECT_EQ(second->buffer.data(), first_buffer);
+    EXPECT_EQ(second->payload(), "short");
+    EXPECT_EQ(second->protocol, LWS_WRITE_BINARY);
+    EXPECT_EQ(second->sent_bytes, 0);
+    EXPECT_FALSE(second->message_sent);
+}
+
+TEST(WebsocketMessagePoolTest, MessageIsNotReusedWhileReferenced) {
+    WebsocketMessagePool pool;
+    auto queued = pool.acquire("queued", LWS_WRITE_TEXT);
+    // a sender that timed out waiting for the message has returned, but the lws thread still has it queued
+    std::shared_ptr<WebsocketMessage> still_queued = queued;
+    queued.reset();
+
+    const auto other = pool.acquire("other", LWS_WRITE_TEXT);
+    EXPECT_NE(other.get(), still_queued.get());
+    EXPECT_EQ(still_queued->payload(), "queued");
+
+    WebsocketMessage* const queued_ptr = still_queued.get();
+    still_queued.reset();
+    const auto reused = pool.acquire("reused", LWS_WRITE_TEXT);
+    EXPECT_EQ(reused.get(), queued_ptr);
+    EXPECT_EQ(reused->payload(), "reused");
+}
+
+TEST(WebsocketMessagePoolTest, PoolDoesNotGrowBeyondLimit) {
+    WebsocketMessagePool pool;
+    std::vector<std::shared_ptr<WebsocketMessage>> in_use;
+    for (size_t i = 0; i < WebsocketMessagePool::MAX_POOLED_MESSAGES + 2; i++) {
+        in_use.push_back(pool.acquire(std::to_string(i), LWS_WRITE_TEXT));
+    }
+    std::vector<WebsocketMessage*> pooled;
+    for (size_t i = 0; i < WebsocketMessagePool::MAX_POOLED_MESSAGES; i++) {
+        pooled.push_back(in_use.at(i).get());
+    }
+    in_use.clear();
+
+    // the messages allocated while the pool was exhausted are not kept, only the pooled ones are handed out again
+    for (size_t i = 0; i < WebsocketMessagePool::MAX_POOLED_MESSAGES; i++) {
+        in_use.push_back(pool.acquire(std::to_string(i), LWS_WRITE_TEXT));
+        EXPECT_NE(std::find(pooled.begin(), pooled.end(), in_use.back().get()), pooled.end());
+    }
+}
+
+TEST(WebsocketMessagePoolTest, LargeBufferIsNotKept) {
+    WebsocketMessagePool pool;
+    auto large = pool.acquire(std::string(WebsocketMessagePool::MAX_POOLED_BUFFER_SIZE * 2, 'x'), LWS_WRITE_TEXT);
+    WebsocketMessage* const large_ptr = large.get();
+    EXPECT_GT(large->buffer.capacity(), WebsocketMessagePool::MAX_POOLED_BUFFER_SIZE);
+    large.reset();
+
+    const auto small = pool.acquire("small", LWS_WRITE_TEXT);
+    EXPECT_EQ(small.get(), large_ptr);
+    EXPECT_LE(small->buffer.capacity(), WebsocketMessagePool::MAX_POOLED_BUFFER_SIZE);
+    EXPECT_EQ(small->payload(), "small");
+}
@@ -4,6 +4,8 @@
 #include <gtest/gtest.h>
 #include <ocpp/common/utils.hpp>
 
+#include <random>
+
 namespace ocpp {
 namespace common {
 
@@ -87,5 +89,59 @@ TEST(Utils, test_trim_string) {
     EXPECT_EQ(trim_string("only space at end  "), "only space at end");
 }
 
+TEST(Utils, test_iequals) {
+    EXPECT_TRUE(iequals("", ""));
+    EXPECT_TRUE(iequals("IdTag-123", "idtag-123"));
+    EXPECT_TRUE(iequals("ACCEPTED", "Accepted"));
+    EXPECT_FALSE(iequals("Accepted", "Accepted "));
+    EXPECT_FALSE(iequals("[", "{"));
+    EXPECT_FALSE(iequals("@", "`"));
+    EXPECT_FALSE(iequals("\xc4", "\xe4"));
+}
+
+TEST(Utils, test_iless_and_ihash) {
+    EXPECT_FALSE(iless("", ""));
+    EXPECT_TRUE(iless("", "a"));
+    EXPECT_FALSE(iless("IdTag", "idtag"));
+    EXPECT_FALSE(iless("idtag", "IdTag"));
+    EXPECT_TRUE(iless("idtag", "IDTAG2"));
+    EXPECT_TRUE(iless("IDTAG1", "idtag2"));
+    EXPECT_TRUE(iless("Z", "\xe4"));
+
+    EXPECT_EQ(ihash("IdTag-123"), ihash("idtag-123"));
+    EXPECT_EQ(ihash("ACCEPTED"), ihash("accepted"));
+    EXPECT_NE(ihash("[]"), ihash("{}"));
+    EXPECT_NE(ihash("Accepted"), ihash("Accepted "));
+}
+
+TEST(Utils, test_is_printable_ascii) {
+    EXPECT_TRUE(is_printable_ascii(""));
+    EXPECT_TRUE(is_printable_ascii("DEADBEEF0123456789 ~!\n"));
+    EXPECT_FALSE(is_printable_ascii("DEADBEEF0123456789\t"));
+    EXPECT_FALSE(is_printable_ascii("Stra\xc3\x9f""e 12345"));
+
+    // every character at every position of the eight character blocks and the remainder
+    for (int c = 0; c < 256; c++) {
+        const bool printable = (c >= 0x20 and c <= 0x7e) or c == '\n';
+        for (std::size_t pos = 0; pos < 19; pos++) {
+            std::string data(19, 'a');
+            data[pos] = static_cast<char>(c);
+            EXPECT_EQ(is_printable_ascii(data), printable) << c << " at " << pos;
+        }
+    }
+
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<int> character(0x1f, 0x7f);
+    std::uniform_int_distribution<std::size_t> length(0, 40);
+    for (int i = 0; i < 10000; i++) {
+        std::string data(length(gen), ' ');
+        for (auto& c : data) {
+            c = static_cast<char>(character(gen));
+        }
+        const bool printable = std::all_of(data.begin(), data.end(), [](char c) { return c >= 0x20 and c <= 0x7e; });
+        EXPECT_EQ(is_printable_ascii(data), printable) << data;
+    }
+}
+
 } // namespace common
 } // namespace ocpp
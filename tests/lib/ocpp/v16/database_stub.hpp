@@ -48,6 +48,12 @@ struct SQLiteStatementTest : public ocpp::common::SQLiteStatementInterface {
     virtual int bind_int(const std::string& param, const int val) {
         return 0;
     }
+    virtual int bind_int64(const int idx, const int64_t val) {
+        return 0;
+    }
+    virtual int bind_int64(const std::string& param, const int64_t val) {
+        return 0;
+    }
     virtual int bind_datetime(const int idx, const ocpp::DateTime val) {
         return 0;
     }
@@ -81,6 +87,9 @@ struct SQLiteStatementTest : public ocpp::common::SQLiteStatementInterface {
     virtual int column_int(const int idx) {
         return 0;
     }
+    virtual int64_t column_int64(const int idx) {
+        return 0;
+    }
     virtual ocpp::DateTime column_datetime(const int idx) {
         return ocpp::DateTime();
     }
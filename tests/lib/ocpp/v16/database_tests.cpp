@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
 
+#include <boost/asio/io_context.hpp>
 #include <filesystem>
 #include <gtest/gtest.h>
 #include <iostream>
@@ -236,6 +237,50 @@ TEST_F(DatabaseTest, test_clear_authorization_cache) {
     ASSERT_EQ(std::nullopt, id_tag_info);
 }
 
+TEST_F(DatabaseTest, test_authorization_cache_case_insensitive) {
+
+    IdTagInfo exp_id_tag_info;
+    exp_id_tag_info.status = AuthorizationStatus::Accepted;
+
+    this->db_handler->insert_or_update_authorization_cache_entry(CiString<20>("DeadBeef"), exp_id_tag_info);
+    auto id_tag_info = this->db_handler->get_authorization_cache_entry(CiString<20>("DEADBEEF"));
+    ASSERT_EQ(AuthorizationStatus::Accepted, id_tag_info.value().status);
+
+    // updating the entry with a different case replaces it
+    exp_id_tag_info.status = AuthorizationStatus::Blocked;
+    this->db_handler->insert_or_update_authorization_cache_entry(CiString<20>("deadbeef"), exp_id_tag_info);
+    id_tag_info = this->db_handler->get_authorization_cache_entry(CiString<20>("DeadBeef"));
+    ASSERT_EQ(AuthorizationStatus::Blocked, id_tag_info.value().status);
+
+    // a new handler reads the same single entry from the database
+    auto database_connection = std::make_unique<common::DatabaseConnection>("file::memory:?cache=shared");
+    DatabaseHandler db_handler(std::move(database_connection), std::filesystem::path(MIGRATION_FILES_LOCATION_V16),
+                               2);
+    db_handler.open_connection();
+    id_tag_info = db_handler.get_authorization_cache_entry(CiString<20>("DEADBEEF"));
+    ASSERT_EQ(AuthorizationStatus::Blocked, id_tag_info.value().status);
+
+    this->db_handler->clear_authorization_cache();
+}
+
+TEST_F(DatabaseTest, test_local_authorization_list_case_insensitive) {
+
+    IdTagInfo exp_id_tag_info;
+    exp_id_tag_info.status = AuthorizationStatus::Accepted;
+
+    this->db_handler->insert_or_update_local_authorization_list_entry(CiString<20>("DeadBeef"), exp_id_tag_info);
+    auto id_tag_info = this->db_handler->get_local_authorization_list_entry(CiString<20>("deadbeef"));
+    ASSERT_EQ(AuthorizationStatus::Accepted, id_tag_info.value().status);
+
+    this->db_handler->insert_or_update_local_authorization_list_entry(CiString<20>("DEADBEEF"), exp_id_tag_info);
+    ASSERT_EQ(1, this->db_handler->get_local_authorization_list_number_of_entries());
+
+    this->db_handler->delete_local_authorization_list_entry("deadBEEF");
+    id_tag_info = this->db_handler->get_local_authorization_list_entry(CiString<20>("DEADBEEF"));
+    ASSERT_EQ(std::nullopt, id_tag_info);
+    ASSERT_EQ(0, this->db_handler->get_local_authorization_list_number_of_entries());
+}
+
 TEST_F(DatabaseTest, test_connector_availability) {
 
     std::vector<int32_t> connectors;
@@ -391,5 +436,206 @@ TEST_F(DatabaseTest, test_unknown_connector) {
     ASSERT_THROW(this->db_handler->get_charging_profiles(), ocpp::common::QueryExecutionException);
 }
 
+TEST_F(DatabaseTest, test_message_queue_write_behind) {
+    common::DBTransactionMessage normal_message;
+    normal_message.json_message = json::array({2, "1", "Heartbeat", json::object()});
+    normal_message.message_type = "Heartbeat";
+    normal_message.message_attempts = 0;
+    normal_message.timestamp = DateTime();
+    normal_message.unique_id = "1";
+
+    auto transaction_message = normal_message;
+    transaction_message.json_message = json::array({2, "2", "MeterValues", json::object()});
+    transaction_message.message_type = "MeterValues";
+    transaction_message.unique_id = "2";
+
+    auto database_connection = std::make_unique<common::DatabaseConnection>("file::memory:?cache=shared");
+    database_connection->open_connection();
+    const auto count_rows = [&database_connection](const std::string& table) {
+        auto stmt = database_connection->new_statement("SELECT COUNT(*) FROM " + table);
+        EXPECT_EQ(stmt->step(), SQLITE_ROW);
+        return stmt->column_int(0);
+    };
+
+    this->db_handler->set_message_queue_write_behind(100, std::chrono::hours(1));
+
+    // inserts into both tables are buffered until they are flushed
+    this->db_handler->insert_message_queue_message(normal_message, QueueType::Normal);
+    this->db_handler->insert_message_queue_message(transaction_message, QueueType::Transaction);
+    EXPECT_EQ(count_rows("NORMAL_QUEUE"), 0);
+    EXPECT_EQ(count_rows("TRANSACTION_QUEUE"), 0);
+    this->db_handler->flush_message_queue_operations();
+    EXPECT_EQ(count_rows("NORMAL_QUEUE"), 1);
+    EXPECT_EQ(count_rows("TRANSACTION_QUEUE"), 1);
+
+    // deletes are buffered but visible through get_message_queue_messages
+    this->db_handler->remove_message_queue_message(transaction_message.unique_id, QueueType::Transaction);
+    EXPECT_EQ(count_rows("TRANSACTION_QUEUE"), 1);
+    EXPECT_TRUE(this->db_handler->get_message_queue_messages(QueueType::Transaction).empty());
+    EXPECT_EQ(count_rows("TRANSACTION_QUEUE"), 0);
+
+    // a delete cancels a buffered insert
+    normal_message.unique_id = "3";
+    this->db_handler->insert_message_queue_message(normal_message, QueueType::Normal);
+    this->db_handler->remove_message_queue_message(normal_message.unique_id, QueueType::Normal);
+    EXPECT_EQ(this->db_handler->get_message_queue_messages(QueueType::Normal).size(), 1);
+
+    // buffered operations are committed by an explicit flush
+    normal_message.unique_id = "4";
+    this->db_handler->insert_message_queue_message(normal_message, QueueType::Normal);
+    EXPECT_EQ(count_rows("NORMAL_QUEUE"), 1);
+    this->db_handler->flush_message_queue_operations();
+    EXPECT_EQ(count_rows("NORMAL_QUEUE"), 2);
+
+    // and by the flush timer after the flush latency
+    this->db_handler->set_message_queue_write_behind(100, std::chrono::milliseconds(10));
+    this->db_handler->remove_message_queue_message("1", QueueType::Normal);
+    this->db_handler->remove_message_queue_message("4", QueueType::Normal);
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (count_rows("NORMAL_QUEUE") != 0 and std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_EQ(count_rows("NORMAL_QUEUE"), 0);
+}
+
+TEST_F(DatabaseTest, test_message_queue_write_behind_failed_flush) {
+    common::DBTransactionMessage message;
+    message.json_message = json::array({2, "1", "Heartbeat", json::object()});
+    message.message_type = "Heartbeat";
+    message.message_attempts = 0;
+    message.timestamp = DateTime();
+    message.unique_id = "1";
+
+    auto database_connection = std::make_unique<common::DatabaseConnection>("file::memory:?cache=shared");
+    database_connection->open_connection();
+    const auto count_rows = [&database_connection]() {
+        auto stmt = database_connection->new_statement("SELECT COUNT(*) FROM NORMAL_QUEUE");
+        EXPECT_EQ(stmt->step(), SQLITE_ROW);
+        return stmt->column_int(0);
+    };
+
+    this->db_handler->set_message_queue_write_behind(100, std::chrono::hours(1));
+    this->db_handler->insert_message_queue_message(message, QueueType::Normal);
+    this->db_handler->flush_message_queue_operations();
+    EXPECT_EQ(count_rows(), 1);
+
+    // the insert of a duplicate unique id fails, so the whole batch is rolled back and kept
+    message.unique_id = "2";
+    this->db_handler->insert_message_queue_message(message, QueueType::Normal);
+    message.unique_id = "1";
+    this->db_handler->insert_message_queue_message(message, QueueType::Normal);
+    for (int32_t attempt = 1; attempt < common::MESSAGE_QUEUE_OPERATION_MAX_ATTEMPTS; attempt++) {
+        EXPECT_THROW(this->db_handler->flush_message_queue_operations(), common::QueryExecutionException);
+        EXPECT_EQ(count_rows(), 1);
+    }
+
+    // after the last attempt the failing operation is dropped and the remaining ones are committed with the next
+    // flush
+    EXPECT_THROW(this->db_handler->flush_message_queue_operations(), common::QueryExecutionException);
+    EXPECT_EQ(count_rows(), 1);
+    this->db_handler->flush_message_queue_operations();
+    EXPECT_EQ(count_rows(), 2);
+}
+
+TEST_F(DatabaseTest, test_message_queue_write_behind_on_io_context) {
+    boost::asio::io_context io_context;
+    this->db_handler->set_message_queue_flush_io_context(&io_context);
+    this->db_handler->set_message_queue_write_behind(100, std::chrono::milliseconds(10));
+
+    common::DBTransactionMessage message;
+    message.json_message = json::array({2, "1", "Heartbeat", json::object()});
+    message.message_type = "Heartbeat";
+    message.message_attempts = 0;
+    message.timestamp = DateTime();
+    message.unique_id = "1";
+
+    auto database_connection = std::make_unique<common::DatabaseConnection>("file::memory:?cache=shared");
+    database_connection->open_connection();
+    const auto count_rows = [&database_connection]() {
+        auto stmt = database_connection->new_statement("SELECT COUNT(*) FROM NORMAL_QUEUE");
+        EXPECT_EQ(stmt->step(), SQLITE_ROW);
+        return stmt->column_int(0);
+    };
+
+    // the buffered insert is only committed once the io_context runs the flush timer
+    this->db_handler->insert_message_queue_message(message, QueueType::Normal);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(count_rows(), 0);
+    io_context.run_for(std::chrono::seconds(10));
+    EXPECT_EQ(count_rows(), 1);
+
+    // the flush timer must not outlive the io_context
+    this->db_handler.reset();
+}
+
+TEST_F(DatabaseTest, test_remove_message_queue_messages) {
+    common::DBTransactionMessage message;
+    message.json_message = json::array({2, "0", "MeterValues", json::object()});
+    message.message_type = "MeterValues";
+    message.message_attempts = 0;
+    message.timestamp = DateTime();
+
+    std::vector<std::string> unique_ids;
+    for (int i = 0; i < 1000; i++) {
+        message.unique_id = std::to_string(i);
+        this->db_handler->insert_message_queue_message(message, QueueType::Transaction);
+        if (i % 2 == 0) {
+            unique_ids.push_back(message.unique_id);
+        }
+    }
+
+    this->db_handler->remove_message_queue_messages(unique_ids, QueueType::Transaction);
+
+    const auto messages = this->db_handler->get_message_queue_messages(QueueType::Transaction);
+    ASSERT_EQ(messages.size(), 500);
+    for (const auto& remaining_message : messages) {
+        EXPECT_EQ(std::stoi(remaining_message.unique_id) % 2, 1);
+    }
+}
+
+TEST_F(DatabaseTest, test_message_queue_messages_page) {
+    common::DBTransactionMessage message;
+    message.message_attempts = 0;
+    message.timestamp = DateTime();
+
+    for (int i = 0; i < 10; i++) {
+        message.unique_id = std::to_string(i);
+        message.message_type = i % 2 == 0 ? "MeterValues" : "StopTransaction";
+        message.json_message = json::array({2, message.unique_id, message.message_type, json::object()});
+        this->db_handler->insert_message_queue_message(message, QueueType::Transaction);
+    }
+
+    const auto end = this->db_handler->get_message_queue_end(QueueType::Transaction);
+    EXPECT_EQ(this->db_handler->get_message_queue_end(QueueType::Normal), 0);
+
+    // messages inserted after the end was taken are not part of the pages
+    message.unique_id = "10";
+    this->db_handler->insert_message_queue_message(message, QueueType::Transaction);
+
+    std::vector<std::string> unique_ids;
+    int64_t position = 0;
+    while (true) {
+        const auto page = this->db_handler->get_message_queue_messages_page(QueueType::Transaction, position, end, 3);
+        if (page.empty()) {
+            break;
+        }
+        ASSERT_LE(page.size(), 3);
+        for (const auto& page_message : page) {
+            EXPECT_GT(page_message.position, position);
+            position = page_message.position;
+            unique_ids.push_back(page_message.unique_id);
+            EXPECT_EQ(json::parse(*page_message.serialized_message).at(1), page_message.unique_id);
+        }
+    }
+    EXPECT_EQ(unique_ids, (std::vector<std::string>{"0", "1", "2", "3", "4", "5", "6", "7", "8", "9"}));
+
+    const auto stop_transactions =
+        this->db_handler->get_message_queue_messages_page(QueueType::Transaction, 0, end, 10, "StopTransaction");
+    ASSERT_EQ(stop_transactions.size(), 5);
+    for (const auto& stop_transaction : stop_transactions) {
+        EXPECT_EQ(std::stoi(stop_transaction.unique_id) % 2, 1);
+    }
+}
+
 } // namespace v16
 } // namespace ocpp
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+
+#include <enum_conversion_testing_utils.hpp>
+#include <ocpp/v16/ocpp_enums.hpp>
+#include <ocpp/v16/types.hpp>
+
+namespace ocpp {
+namespace v16 {
+
+TEST(EnumConversionsTest, test_string_to_enum_matches_linear_lookup) {
+    // InternalError is only used for messages that could not be parsed, it is never converted back
+    expect_enum_conversions<MessageType>(conversions::messagetype_to_string, conversions::string_to_messagetype,
+                                         "MessageType", {"InternalError"});
+    EXPECT_ENUM_CONVERSIONS(SupportedFeatureProfiles, supported_feature_profiles);
+    EXPECT_ENUM_CONVERSIONS(ChargePointConnectionState, charge_point_connection_state);
+    EXPECT_ENUM_CONVERSIONS(AuthorizationStatus, authorization_status);
+    EXPECT_ENUM_CONVERSIONS(RegistrationStatus, registration_status);
+    EXPECT_ENUM_CONVERSIONS(CancelReservationStatus, cancel_reservation_status);
+    EXPECT_ENUM_CONVERSIONS(CertificateSignedStatusEnumType, certificate_signed_status_enum_type);
+    EXPECT_ENUM_CONVERSIONS(AvailabilityType, availability_type);
+    EXPECT_ENUM_CONVERSIONS(AvailabilityStatus, availability_status);
+    EXPECT_ENUM_CONVERSIONS(ConfigurationStatus, configuration_status);
+    EXPECT_ENUM_CONVERSIONS(ClearCacheStatus, clear_cache_status);
+    EXPECT_ENUM_CONVERSIONS(ChargingProfilePurposeType, charging_profile_purpose_type);
+    EXPECT_ENUM_CONVERSIONS(ClearChargingProfileStatus, clear_charging_profile_status);
+    EXPECT_ENUM_CONVERSIONS(DataTransferStatus, data_transfer_status);
+    EXPECT_ENUM_CONVERSIONS(HashAlgorithmEnumType, hash_algorithm_enum_type);
+    EXPECT_ENUM_CONVERSIONS(DeleteCertificateStatusEnumType, delete_certificate_status_enum_type);
+    EXPECT_ENUM_CONVERSIONS(DiagnosticsStatus, diagnostics_status);
+    EXPECT_ENUM_CONVERSIONS(MessageTriggerEnumType, message_trigger_enum_type);
+    EXPECT_ENUM_CONVERSIONS(TriggerMessageStatusEnumType, trigger_message_status_enum_type);
+    EXPECT_ENUM_CONVERSIONS(FirmwareStatus, firmware_status);
+    EXPECT_ENUM_CONVERSIONS(ChargingRateUnit, charging_rate_unit);
+    EXPECT_ENUM_CONVERSIONS(GetCompositeScheduleStatus, get_composite_schedule_status);
+    EXPECT_ENUM_CONVERSIONS(CertificateUseEnumType, certificate_use_enum_type);
+    EXPECT_ENUM_CONVERSIONS(GetInstalledCertificateStatusEnumType, get_installed_certificate_status_enum_type);
+    EXPECT_ENUM_CONVERSIONS(LogEnumType, log_enum_type);
+    EXPECT_ENUM_CONVERSIONS(LogStatusEnumType, log_status_enum_type);
+    EXPECT_ENUM_CONVERSIONS(InstallCertificateStatusEnumType, install_certificate_status_enum_type);
+    EXPECT_ENUM_CONVERSIONS(UploadLogStatusEnumType, upload_log_status_enum_type);
+    EXPECT_ENUM_CONVERSIONS(ReadingContext, reading_context);
+    EXPECT_ENUM_CONVERSIONS(ValueFormat, value_format);
+    EXPECT_ENUM_CONVERSIONS(Measurand, measurand);
+    EXPECT_ENUM_CONVERSIONS(Phase, phase);
+    EXPECT_ENUM_CONVERSIONS(Location, location);
+    EXPECT_ENUM_CONVERSIONS(UnitOfMeasure, unit_of_measure);
+    EXPECT_ENUM_CONVERSIONS(ChargingProfileKindType, charging_profile_kind_type);
+    EXPECT_ENUM_CONVERSIONS(RecurrencyKindType, recurrency_kind_type);
+    EXPECT_ENUM_CONVERSIONS(RemoteStartStopStatus, remote_start_stop_status);
+    EXPECT_ENUM_CONVERSIONS(ReservationStatus, reservation_status);
+    EXPECT_ENUM_CONVERSIONS(ResetType, reset_type);
+    EXPECT_ENUM_CONVERSIONS(ResetStatus, reset_status);
+    EXPECT_ENUM_CONVERSIONS(UpdateType, update_type);
+    EXPECT_ENUM_CONVERSIONS(UpdateStatus, update_status);
+    EXPECT_ENUM_CONVERSIONS(ChargingProfileStatus, charging_profile_status);
+    EXPECT_ENUM_CONVERSIONS(GenericStatusEnumType, generic_status_enum_type);
+    EXPECT_ENUM_CONVERSIONS(FirmwareStatusEnumType, firmware_status_enum_type);
+    EXPECT_ENUM_CONVERSIONS(UpdateFirmwareStatusEnumType, update_firmware_status_enum_type);
+    EXPECT_ENUM_CONVERSIONS(ChargePointErrorCode, charge_point_error_code);
+    EXPECT_ENUM_CONVERSIONS(ChargePointStatus, charge_point_status);
+    EXPECT_ENUM_CONVERSIONS(Reason, reason);
+    EXPECT_ENUM_CONVERSIONS(MessageTrigger, message_trigger);
+    EXPECT_ENUM_CONVERSIONS(TriggerMessageStatus, trigger_message_status);
+    EXPECT_ENUM_CONVERSIONS(UnlockStatus, unlock_status);
+}
+
+TEST(EnumConversionsTest, test_string_to_enum_does_not_require_null_termination) {
+    const std::string_view message = "HeartbeatResponse";
+    EXPECT_EQ(conversions::string_to_messagetype(message.substr(0, 9)), MessageType::Heartbeat);
+    EXPECT_EQ(conversions::string_to_messagetype(message), MessageType::HeartbeatResponse);
+}
+
+} // namespace v16
+} // namespace ocpp
@@ -196,7 +196,7 @@ public:
     create_message_queue(std::shared_ptr<DatabaseHandler>& database_handler) {
         const auto DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD = 2E5;
         return std::make_shared<ocpp::MessageQueue<v201::MessageType>>(
-            [this](json message) -> bool { return false; },
+            [this](const std::string& message) -> bool { return false; },
             MessageQueueConfig<v201::MessageType>{
                 this->device_model->get_value<int>(ControllerComponentVariables::MessageAttempts),
                 this->device_model->get_value<int>(ControllerComponentVariables::MessageAttemptInterval),
@@ -334,7 +334,8 @@ TEST_F(ChargepointTestFixtureV201, CreateChargePoint_MissingDeviceModel_ThrowsIn
     auto evse_security = std::make_shared<EvseSecurityMock>();
     configure_callbacks_with_mocks();
     auto message_queue = std::make_shared<ocpp::MessageQueue<v201::MessageType>>(
-        [this](json message) -> bool { return false; }, MessageQueueConfig<v201::MessageType>{}, database_handler);
+        [this](const std::string& message) -> bool { return false; }, MessageQueueConfig<v201::MessageType>{},
+        database_handler);
 
     EXPECT_THROW(ocpp::v201::ChargePoint(evse_connector_structure, nullptr, database_handler, message_queue, "/tmp",
                                          evse_security, callbacks),
@@ -346,7 +347,7 @@ TEST_F(ChargepointTestFixtureV201, CreateChargePoint_MissingDatabaseHandler_Thro
     auto evse_security = std::make_shared<EvseSecurityMock>();
     configure_callbacks_with_mocks();
     auto message_queue = std::make_shared<ocpp::MessageQueue<v201::MessageType>>(
-        [this](json message) -> bool { return false; }, MessageQueueConfig<v201::MessageType>{}, nullptr);
+        [this](const std::string& message) -> bool { return false; }, MessageQueueConfig<v201::MessageType>{}, nullptr);
 
     auto database_handler = nullptr;
 
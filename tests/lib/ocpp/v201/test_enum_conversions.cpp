@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <gtest/gtest.h>
+
+#include <enum_conversion_testing_utils.hpp>
+#include <ocpp/v201/ocpp_enums.hpp>
+#include <ocpp/v201/types.hpp>
+
+namespace ocpp {
+namespace v201 {
+
+TEST(EnumConversionsTest, test_string_to_enum_matches_linear_lookup) {
+    EXPECT_ENUM_CONVERSIONS(MessageType, messagetype);
+    EXPECT_ENUM_CONVERSIONS(IdTokenEnum, id_token_enum);
+    EXPECT_ENUM_CONVERSIONS(HashAlgorithmEnum, hash_algorithm_enum);
+    EXPECT_ENUM_CONVERSIONS(AuthorizationStatusEnum, authorization_status_enum);
+    EXPECT_ENUM_CONVERSIONS(MessageFormatEnum, message_format_enum);
+    EXPECT_ENUM_CONVERSIONS(AuthorizeCertificateStatusEnum, authorize_certificate_status_enum);
+    EXPECT_ENUM_CONVERSIONS(BootReasonEnum, boot_reason_enum);
+    EXPECT_ENUM_CONVERSIONS(RegistrationStatusEnum, registration_status_enum);
+    EXPECT_ENUM_CONVERSIONS(CancelReservationStatusEnum, cancel_reservation_status_enum);
+    EXPECT_ENUM_CONVERSIONS(CertificateSigningUseEnum, certificate_signing_use_enum);
+    EXPECT_ENUM_CONVERSIONS(CertificateSignedStatusEnum, certificate_signed_status_enum);
+    EXPECT_ENUM_CONVERSIONS(OperationalStatusEnum, operational_status_enum);
+    EXPECT_ENUM_CONVERSIONS(ChangeAvailabilityStatusEnum, change_availability_status_enum);
+    EXPECT_ENUM_CONVERSIONS(ClearCacheStatusEnum, clear_cache_status_enum);
+    EXPECT_ENUM_CONVERSIONS(ChargingProfilePurposeEnum, charging_profile_purpose_enum);
+    EXPECT_ENUM_CONVERSIONS(ClearChargingProfileStatusEnum, clear_charging_profile_status_enum);
+    EXPECT_ENUM_CONVERSIONS(ClearMessageStatusEnum, clear_message_status_enum);
+    EXPECT_ENUM_CONVERSIONS(ClearMonitoringStatusEnum, clear_monitoring_status_enum);
+    EXPECT_ENUM_CONVERSIONS(ChargingLimitSourceEnum, charging_limit_source_enum);
+    EXPECT_ENUM_CONVERSIONS(CustomerInformationStatusEnum, customer_information_status_enum);
+    EXPECT_ENUM_CONVERSIONS(DataTransferStatusEnum, data_transfer_status_enum);
+    EXPECT_ENUM_CONVERSIONS(DeleteCertificateStatusEnum, delete_certificate_status_enum);
+    EXPECT_ENUM_CONVERSIONS(FirmwareStatusEnum, firmware_status_enum);
+    EXPECT_ENUM_CONVERSIONS(CertificateActionEnum, certificate_action_enum);
+    EXPECT_ENUM_CONVERSIONS(Iso15118EVCertificateStatusEnum, iso15118evcertificate_status_enum);
+    EXPECT_ENUM_CONVERSIONS(ReportBaseEnum, report_base_enum);
+    EXPECT_ENUM_CONVERSIONS(GenericDeviceModelStatusEnum, generic_device_model_status_enum);
+    EXPECT_ENUM_CONVERSIONS(GetCertificateStatusEnum, get_certificate_status_enum);
+    EXPECT_ENUM_CONVERSIONS(GetChargingProfileStatusEnum, get_charging_profile_status_enum);
+    EXPECT_ENUM_CONVERSIONS(ChargingRateUnitEnum, charging_rate_unit_enum);
+    EXPECT_ENUM_CONVERSIONS(GenericStatusEnum, generic_status_enum);
+    EXPECT_ENUM_CONVERSIONS(MessagePriorityEnum, message_priority_enum);
+    EXPECT_ENUM_CONVERSIONS(MessageStateEnum, message_state_enum);
+    EXPECT_ENUM_CONVERSIONS(GetDisplayMessagesStatusEnum, get_display_messages_status_enum);
+    EXPECT_ENUM_CONVERSIONS(GetCertificateIdUseEnum, get_certificate_id_use_enum);
+    EXPECT_ENUM_CONVERSIONS(GetInstalledCertificateStatusEnum, get_installed_certificate_status_enum);
+    EXPECT_ENUM_CONVERSIONS(LogEnum, log_enum);
+    EXPECT_ENUM_CONVERSIONS(LogStatusEnum, log_status_enum);
+    EXPECT_ENUM_CONVERSIONS(MonitoringCriterionEnum, monitoring_criterion_enum);
+    EXPECT_ENUM_CONVERSIONS(ComponentCriterionEnum, component_criterion_enum);
+    EXPECT_ENUM_CONVERSIONS(AttributeEnum, attribute_enum);
+    EXPECT_ENUM_CONVERSIONS(GetVariableStatusEnum, get_variable_status_enum);
+    EXPECT_ENUM_CONVERSIONS(InstallCertificateUseEnum, install_certificate_use_enum);
+    EXPECT_ENUM_CONVERSIONS(InstallCertificateStatusEnum, install_certificate_status_enum);
+    EXPECT_ENUM_CONVERSIONS(UploadLogStatusEnum, upload_log_status_enum);
+    EXPECT_ENUM_CONVERSIONS(ReadingContextEnum, reading_context_enum);
+    EXPECT_ENUM_CONVERSIONS(MeasurandEnum, measurand_enum);
+    EXPECT_ENUM_CONVERSIONS(PhaseEnum, phase_enum);
+    EXPECT_ENUM_CONVERSIONS(LocationEnum, location_enum);
+    EXPECT_ENUM_CONVERSIONS(CostKindEnum, cost_kind_enum);
+    EXPECT_ENUM_CONVERSIONS(EnergyTransferModeEnum, energy_transfer_mode_enum);
+    EXPECT_ENUM_CONVERSIONS(NotifyEVChargingNeedsStatusEnum, notify_evcharging_needs_status_enum);
+    EXPECT_ENUM_CONVERSIONS(EventTriggerEnum, event_trigger_enum);
+    EXPECT_ENUM_CONVERSIONS(EventNotificationEnum, event_notification_enum);
+    EXPECT_ENUM_CONVERSIONS(MonitorEnum, monitor_enum);
+    EXPECT_ENUM_CONVERSIONS(MutabilityEnum, mutability_enum);
+    EXPECT_ENUM_CONVERSIONS(DataEnum, data_enum);
+    EXPECT_ENUM_CONVERSIONS(PublishFirmwareStatusEnum, publish_firmware_status_enum);
+    EXPECT_ENUM_CONVERSIONS(ChargingProfileKindEnum, charging_profile_kind_enum);
+    EXPECT_ENUM_CONVERSIONS(RecurrencyKindEnum, recurrency_kind_enum);
+    EXPECT_ENUM_CONVERSIONS(RequestStartStopStatusEnum, request_start_stop_status_enum);
+    EXPECT_ENUM_CONVERSIONS(ReservationUpdateStatusEnum, reservation_update_status_enum);
+    EXPECT_ENUM_CONVERSIONS(ConnectorEnum, connector_enum);
+    EXPECT_ENUM_CONVERSIONS(ReserveNowStatusEnum, reserve_now_status_enum);
+    EXPECT_ENUM_CONVERSIONS(ResetEnum, reset_enum);
+    EXPECT_ENUM_CONVERSIONS(ResetStatusEnum, reset_status_enum);
+    EXPECT_ENUM_CONVERSIONS(UpdateEnum, update_enum);
+    EXPECT_ENUM_CONVERSIONS(SendLocalListStatusEnum, send_local_list_status_enum);
+    EXPECT_ENUM_CONVERSIONS(ChargingProfileStatusEnum, charging_profile_status_enum);
+    EXPECT_ENUM_CONVERSIONS(DisplayMessageStatusEnum, display_message_status_enum);
+    EXPECT_ENUM_CONVERSIONS(MonitoringBaseEnum, monitoring_base_enum);
+    EXPECT_ENUM_CONVERSIONS(APNAuthenticationEnum, apnauthentication_enum);
+    EXPECT_ENUM_CONVERSIONS(OCPPVersionEnum, ocppversion_enum);
+    EXPECT_ENUM_CONVERSIONS(OCPPTransportEnum, ocpptransport_enum);
+    EXPECT_ENUM_CONVERSIONS(OCPPInterfaceEnum, ocppinterface_enum);
+    EXPECT_ENUM_CONVERSIONS(VPNEnum, vpnenum);
+    EXPECT_ENUM_CONVERSIONS(SetNetworkProfileStatusEnum, set_network_profile_status_enum);
+    EXPECT_ENUM_CONVERSIONS(SetMonitoringStatusEnum, set_monitoring_status_enum);
+    EXPECT_ENUM_CONVERSIONS(SetVariableStatusEnum, set_variable_status_enum);
+    EXPECT_ENUM_CONVERSIONS(ConnectorStatusEnum, connector_status_enum);
+    EXPECT_ENUM_CONVERSIONS(TransactionEventEnum, transaction_event_enum);
+    EXPECT_ENUM_CONVERSIONS(TriggerReasonEnum, trigger_reason_enum);
+    EXPECT_ENUM_CONVERSIONS(ChargingStateEnum, charging_state_enum);
+    EXPECT_ENUM_CONVERSIONS(ReasonEnum, reason_enum);
+    EXPECT_ENUM_CONVERSIONS(MessageTriggerEnum, message_trigger_enum);
+    EXPECT_ENUM_CONVERSIONS(TriggerMessageStatusEnum, trigger_message_status_enum);
+    EXPECT_ENUM_CONVERSIONS(UnlockStatusEnum, unlock_status_enum);
+    EXPECT_ENUM_CONVERSIONS(UnpublishFirmwareStatusEnum, unpublish_firmware_status_enum);
+    EXPECT_ENUM_CONVERSIONS(UpdateFirmwareStatusEnum, update_firmware_status_enum);
+}
+
+TEST(EnumConversionsTest, test_string_to_enum_does_not_require_null_termination) {
+    const std::string_view message = "HeartbeatResponse";
+    EXPECT_EQ(conversions::string_to_messagetype(message.substr(0, 9)), MessageType::Heartbeat);
+    EXPECT_EQ(conversions::string_to_messagetype(message), MessageType::HeartbeatResponse);
+}
+
+} // namespace v201
+} // namespace ocpp
@@ -5,6 +5,9 @@
 
 #include <ocpp/common/message_queue.hpp>
 #include <ocpp/v201/messages/Authorize.hpp>
+#include <ocpp/v201/messages/FirmwareStatusNotification.hpp>
+#include <ocpp/v201/messages/LogStatusNotification.hpp>
+#include <ocpp/v201/messages/StatusNotification.hpp>
 
 namespace ocpp {
 
@@ -45,5 +48,62 @@ TEST_F(ControlMessageV201Test, test_is_transactional_update) {
                       .is_transaction_update_message()));
 }
 
+TEST_F(ControlMessageV201Test, test_coalescing_key) {
+
+    v201::StatusNotificationRequest status_notification_request{};
+    status_notification_request.evseId = 1;
+    status_notification_request.connectorId = 1;
+    const auto connector_1_key = ControlMessage<v201::MessageType>{
+        Call<v201::StatusNotificationRequest>{status_notification_request, "0"}}
+                                     .coalescing_key();
+    status_notification_request.connectorStatus = v201::ConnectorStatusEnum::Occupied;
+    EXPECT_EQ(connector_1_key, (ControlMessage<v201::MessageType>{
+                                    Call<v201::StatusNotificationRequest>{status_notification_request, "1"}}
+                                    .coalescing_key()));
+
+    status_notification_request.connectorId = 2;
+    EXPECT_NE(connector_1_key, (ControlMessage<v201::MessageType>{
+                                    Call<v201::StatusNotificationRequest>{status_notification_request, "2"}}
+                                    .coalescing_key()));
+
+    EXPECT_FALSE((ControlMessage<v201::MessageType>{Call<v201::AuthorizeRequest>{v201::AuthorizeRequest{}, "0"}}
+                      .coalescing_key()
+                      .has_value()));
+}
+
+TEST_F(ControlMessageV201Test, test_coalescing_key_of_log_and_firmware_status_notification) {
+
+    v201::LogStatusNotificationRequest log_status_notification_request{};
+    log_status_notification_request.status = v201::UploadLogStatusEnum::Uploading;
+    log_status_notification_request.requestId = 1;
+    const auto request_1_key = ControlMessage<v201::MessageType>{
+        Call<v201::LogStatusNotificationRequest>{log_status_notification_request, "0"}}
+                                   .coalescing_key();
+    ASSERT_TRUE(request_1_key.has_value());
+    log_status_notification_request.status = v201::UploadLogStatusEnum::Uploaded;
+    EXPECT_EQ(request_1_key, (ControlMessage<v201::MessageType>{
+                                  Call<v201::LogStatusNotificationRequest>{log_status_notification_request, "1"}}
+                                  .coalescing_key()));
+
+    log_status_notification_request.requestId = 2;
+    EXPECT_NE(request_1_key, (ControlMessage<v201::MessageType>{
+                                  Call<v201::LogStatusNotificationRequest>{log_status_notification_request, "2"}}
+                                  .coalescing_key()));
+
+    log_status_notification_request.requestId.reset();
+    EXPECT_FALSE((ControlMessage<v201::MessageType>{
+        Call<v201::LogStatusNotificationRequest>{log_status_notification_request, "3"}}
+                      .coalescing_key()
+                      .has_value()));
+
+    v201::FirmwareStatusNotificationRequest firmware_status_notification_request{};
+    firmware_status_notification_request.status = v201::FirmwareStatusEnum::Downloading;
+    firmware_status_notification_request.requestId = 1;
+    EXPECT_FALSE((ControlMessage<v201::MessageType>{
+        Call<v201::FirmwareStatusNotificationRequest>{firmware_status_notification_request, "4"}}
+                      .coalescing_key()
+                      .has_value()));
+}
+
 } // namespace v201
 } // namespace ocpp
@@ -3,6 +3,10 @@
 
 #include <iostream>
 
+#include <thread>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/interprocess/sync/interprocess_semaphore.hpp>
 #include <comparators.hpp>
@@ -154,6 +158,38 @@ TEST_F(OcspUpdaterTest, test_success_boot_many) {
     ocsp_updater->stop();
 }
 
+/// \brief Tests an update that is scheduled on an io_context, like the io_service of a charging station
+TEST_F(OcspUpdaterTest, test_success_boot_on_io_context) {
+    boost::asio::io_context io_context;
+    auto work = boost::asio::make_work_guard(io_context);
+    std::thread io_context_thread([&io_context]() { io_context.run(); });
+    auto ocsp_updater = std::make_unique<v201::OcspUpdater>(
+        this->evse_security, this->status_update, v201::DEFAULT_OCSP_CACHE_UPDATE_INTERVAL,
+        v201::DEFAULT_OCSP_CACHE_UPDATE_RETRY_INTERVAL, &io_context);
+
+    v201::GetCertificateStatusResponse response_success;
+    response_success.ocspResult = "EXAMPLE OCSP RESULT";
+    response_success.status = v201::GetCertificateStatusEnum::Accepted;
+
+    EXPECT_CALL(*this->evse_security, get_v2g_ocsp_request_data())
+        .Times(1)
+        .WillOnce(testing::Return(std::vector<OCSPRequestData>{this->example_ocsp_data[0]}));
+    EXPECT_CALL(*this->charge_point, get_certificate_status(this->example_status_requests[0]))
+        .Times(1)
+        .WillOnce(testing::Return(response_success));
+    EXPECT_CALL(*this->evse_security, update_ocsp_cache(this->example_hash_data[0], "EXAMPLE OCSP RESULT"))
+        .Times(1)
+        .WillOnce(SignalCallsCompleteVoid(&this->calls_complete));
+
+    ocsp_updater->start();
+    ASSERT_TRUE(this->calls_complete.timed_wait(boost::posix_time::second_clock::universal_time() +
+                                                boost::posix_time::seconds(5)));
+    ocsp_updater->stop();
+
+    work.reset();
+    io_context_thread.join();
+}
+
 /// \brief Tests retry logic on CSMS failure to update, multiple certs
 TEST_F(OcspUpdaterTest, test_retry_boot_many) {
     auto ocsp_updater = std::make_unique<v201::OcspUpdater>(this->evse_security, this->status_update,